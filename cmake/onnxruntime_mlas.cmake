@@ -5,10 +5,13 @@ set(mlas_common_srcs
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/platform.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/threading.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/sgemm.cpp
+  ${ONNXRUNTIME_ROOT}/core/mlas/lib/bf16gemm.cpp
+  ${ONNXRUNTIME_ROOT}/core/mlas/lib/winograd.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/qgemm.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/convolve.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/pooling.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/transpose.cpp
+  ${ONNXRUNTIME_ROOT}/core/mlas/lib/cvtfp16.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/reorder.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/snchwc.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/activate.cpp
@@ -19,6 +22,7 @@ set(mlas_common_srcs
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/quantize.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/qladd.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/qlmul.cpp
+  ${ONNXRUNTIME_ROOT}/core/mlas/lib/qlbinary.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/qpostprocessor.cpp
   ${ONNXRUNTIME_ROOT}/core/mlas/lib/qlgavgpool.cpp
 )
@@ -69,6 +73,11 @@ if(MSVC)
     )
     set_source_files_properties(${mlas_platform_srcs_avx2} PROPERTIES COMPILE_FLAGS "/arch:AVX2")
 
+    set(mlas_platform_srcs_f16c
+      ${ONNXRUNTIME_ROOT}/core/mlas/lib/intrinsics/f16c/cvtfp16_f16c.cpp
+    )
+    set_source_files_properties(${mlas_platform_srcs_f16c} PROPERTIES COMPILE_FLAGS "/arch:AVX")
+
     if (onnxruntime_MINIMAL_BUILD)
       # exclude AVX512 in minimal build
       set_source_files_properties(${mlas_common_srcs} PROPERTIES COMPILE_FLAGS "-DMLAS_AVX512F_UNSUPPORTED")
@@ -78,6 +87,7 @@ if(MSVC)
       ${ONNXRUNTIME_ROOT}/core/mlas/lib/dgemm.cpp
       ${mlas_platform_srcs_avx}
       ${mlas_platform_srcs_avx2}
+      ${mlas_platform_srcs_f16c}
       ${ONNXRUNTIME_ROOT}/core/mlas/lib/amd64/QgemmU8S8KernelAvx2.asm
       ${ONNXRUNTIME_ROOT}/core/mlas/lib/amd64/QgemvU8S8KernelAvx2.asm
       ${ONNXRUNTIME_ROOT}/core/mlas/lib/amd64/QgemmU8S8KernelAvx512Core.asm
@@ -184,6 +194,22 @@ else()
       ${ONNXRUNTIME_ROOT}/core/mlas/lib/aarch64/SgemmKernelNeon.S
       ${ONNXRUNTIME_ROOT}/core/mlas/lib/aarch64/SgemvKernelNeon.S
     )
+
+    # The scalable vector kernels require explicit compiler support for the
+    # SVE intrinsics and are selected at runtime from the hardware capability
+    # bits reported by the kernel.
+    check_cxx_compiler_flag("-march=armv8.2-a+sve" HAS_ARM64_SVE)
+    if(HAS_ARM64_SVE AND CMAKE_SYSTEM_NAME STREQUAL "Linux")
+      set(mlas_platform_srcs_sve
+        ${ONNXRUNTIME_ROOT}/core/mlas/lib/aarch64/SgemmKernelSve.cpp
+      )
+      set_source_files_properties(${mlas_platform_srcs_sve} PROPERTIES COMPILE_FLAGS "-march=armv8.2-a+sve -DMLAS_SVE_SUPPORTED")
+      set_source_files_properties(${ONNXRUNTIME_ROOT}/core/mlas/lib/platform.cpp PROPERTIES COMPILE_FLAGS "-DMLAS_SVE_SUPPORTED")
+      set(mlas_platform_srcs
+        ${mlas_platform_srcs}
+        ${mlas_platform_srcs_sve}
+      )
+    endif()
   elseif(POWER)
     set(mlas_platform_srcs
       ${ONNXRUNTIME_ROOT}/core/mlas/lib/power/SgemmKernelPower.cpp
@@ -261,6 +287,11 @@ else()
     )
     set_source_files_properties(${mlas_platform_srcs_avx2} PROPERTIES COMPILE_FLAGS "-mavx2 -mfma")
 
+    set(mlas_platform_srcs_f16c
+      ${ONNXRUNTIME_ROOT}/core/mlas/lib/intrinsics/f16c/cvtfp16_f16c.cpp
+    )
+    set_source_files_properties(${mlas_platform_srcs_f16c} PROPERTIES COMPILE_FLAGS "-mavx -mf16c")
+
     # Some toolchains do not support AVX512 compiler flags but are still able
     # to build the sources. Other toolchains require the AVX512 compiler flags
     # to be specified.
@@ -314,6 +345,17 @@ else()
         if(HAS_AVX512CORE)
           set_source_files_properties(${mlas_platform_srcs_avx512core} PROPERTIES COMPILE_FLAGS "-mavx512bw -mavx512dq -mavx512vl")
         endif()
+
+        # The AVX512 BF16 kernel requires explicit compiler support for the
+        # instructions, unlike the assembly kernels above.
+        check_cxx_compiler_flag("-mavx512bf16" HAS_AVX512BF16)
+        if(HAS_AVX512BF16)
+          set(mlas_platform_srcs_avx512bf16
+            ${ONNXRUNTIME_ROOT}/core/mlas/lib/intrinsics/avx512bf16/Bf16GemmKernelAvx512Bf16.cpp
+          )
+          set_source_files_properties(${mlas_platform_srcs_avx512bf16} PROPERTIES COMPILE_FLAGS "-mavx512bw -mavx512vl -mavx512bf16 -DMLAS_AVX512BF16_SUPPORTED")
+          set_source_files_properties(${ONNXRUNTIME_ROOT}/core/mlas/lib/platform.cpp PROPERTIES COMPILE_FLAGS "-DMLAS_AVX512BF16_SUPPORTED")
+        endif()
       else()
         set_source_files_properties(${mlas_common_srcs} PROPERTIES COMPILE_FLAGS "-DMLAS_AVX512CORE_UNSUPPORTED")
       endif()
@@ -326,8 +368,10 @@ else()
       ${mlas_platform_srcs_sse2}
       ${mlas_platform_srcs_avx}
       ${mlas_platform_srcs_avx2}
+      ${mlas_platform_srcs_f16c}
       ${mlas_platform_srcs_avx512f}
       ${mlas_platform_srcs_avx512core}
+      ${mlas_platform_srcs_avx512bf16}
     )
   endif()
 endif()
@@ -754,6 +754,7 @@ if(onnxruntime_BUILD_BENCHMARKS)
     ${BENCHMARK_DIR}/eigen.cc
     ${BENCHMARK_DIR}/gelu.cc
     ${BENCHMARK_DIR}/activation.cc
+    ${BENCHMARK_DIR}/quantization.cc
     ${BENCHMARK_DIR}/reduceminmax.cc)
   target_include_directories(onnxruntime_benchmark PRIVATE ${ONNXRUNTIME_ROOT} ${onnxruntime_graph_header} ${ONNXRUNTIME_ROOT}/core/mlas/inc)
   if(WIN32)
@@ -765,6 +766,17 @@ if(onnxruntime_BUILD_BENCHMARKS)
   target_link_libraries(onnxruntime_benchmark PRIVATE onnx_test_runner_common benchmark::benchmark ${onnx_test_libs})
   add_dependencies(onnxruntime_benchmark ${onnxruntime_EXTERNAL_DEPENDENCIES})
   set_target_properties(onnxruntime_benchmark PROPERTIES FOLDER "ONNXRuntimeTest")
+
+  add_executable(onnxruntime_op_benchmark ${TEST_SRC_DIR}/op_benchmark/op_benchmark.cc)
+  target_include_directories(onnxruntime_op_benchmark PRIVATE ${ONNXRUNTIME_ROOT} ${onnxruntime_graph_header}
+          ${PROJECT_SOURCE_DIR}/external/json)
+  if(MSVC)
+    target_compile_options(onnxruntime_op_benchmark PRIVATE "$<$<COMPILE_LANGUAGE:CUDA>:SHELL:--compiler-options /utf-8>"
+            "$<$<NOT:$<COMPILE_LANGUAGE:CUDA>>:/utf-8>")
+  endif()
+  target_link_libraries(onnxruntime_op_benchmark PRIVATE onnx_test_runner_common benchmark::benchmark ${onnx_test_libs})
+  add_dependencies(onnxruntime_op_benchmark ${onnxruntime_EXTERNAL_DEPENDENCIES})
+  set_target_properties(onnxruntime_op_benchmark PROPERTIES FOLDER "ONNXRuntimeTest")
 endif()
 
 if(WIN32)
@@ -943,6 +955,24 @@ if (onnxruntime_LINK_LIBATOMIC)
 endif()
 set_target_properties(onnxruntime_mlas_test PROPERTIES FOLDER "ONNXRuntimeTest")
 
+if(onnxruntime_BUILD_BENCHMARKS)
+  add_executable(onnxruntime_mlas_benchmark ${TEST_SRC_DIR}/mlas/benchmark.cpp)
+  target_include_directories(onnxruntime_mlas_benchmark PRIVATE ${ONNXRUNTIME_ROOT}/core/mlas/inc ${ONNXRUNTIME_ROOT}/core/mlas/lib ${ONNXRUNTIME_ROOT})
+  set(onnxruntime_mlas_benchmark_libs onnxruntime_mlas onnxruntime_common benchmark::benchmark)
+  if(NOT WIN32)
+    list(APPEND onnxruntime_mlas_benchmark_libs nsync_cpp ${CMAKE_DL_LIBS})
+  endif()
+  if (onnxruntime_USE_OPENMP)
+    list(APPEND onnxruntime_mlas_benchmark_libs OpenMP::OpenMP_CXX)
+  endif()
+  list(APPEND onnxruntime_mlas_benchmark_libs Threads::Threads)
+  target_link_libraries(onnxruntime_mlas_benchmark PRIVATE ${onnxruntime_mlas_benchmark_libs})
+  if (onnxruntime_LINK_LIBATOMIC)
+    target_link_libraries(onnxruntime_mlas_benchmark PRIVATE atomic)
+  endif()
+  set_target_properties(onnxruntime_mlas_benchmark PROPERTIES FOLDER "ONNXRuntimeTest")
+endif()
+
 add_library(custom_op_library SHARED ${REPO_ROOT}/onnxruntime/test/testdata/custom_op_library/custom_op_library.cc)
 target_include_directories(custom_op_library PRIVATE ${REPO_ROOT}/include)
 if(UNIX)
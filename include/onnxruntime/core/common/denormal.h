@@ -5,8 +5,9 @@
 
 namespace onnxruntime {
 
-// Set or unset flush-to-zero and denormal=as-zero if SSE3 instructions are supported.
-// Return true if SSE3 instruction is supported, otherwise return false.
+// Set or unset flush-to-zero and denormal-as-zero on the calling thread.
+// Supported on x86/x64 with SSE3 (MXCSR) and on ARM64 (FPCR, flush-to-zero
+// only).  Return true if the mode was changed, otherwise return false.
 bool SetDenormalAsZero(bool on);
 
 #ifdef _OPENMP
@@ -89,6 +89,12 @@ struct EventRecord {
   long long ts;
   long long dur;
   std::unordered_map<std::string, std::string> args;
+  // Chrome tracing flow annotations. A non-zero bind_id ties the event that
+  // produced a flow (flow_out) to the event that consumed it (flow_in), so the
+  // trace viewer draws an arrow between them, typically across threads.
+  uint64_t bind_id{0};
+  bool flow_out{false};
+  bool flow_in{false};
 };
 }  // namespace profiling
 
@@ -16,10 +16,11 @@ namespace onnxruntime {
 //   - tensor values: The lifetimes of these tensor-values are statically
 //     determined, which is used for memory reuse/sharing optimizations. The
 //     runtime allocates/frees these values at the right time (as determined
-//     by the static allocation plan). Note that this is simplified since we
-//     do not try to optimize for "slice" like ops, where we may be able to
-//     conditionally reuse memory/data in some cases but not others.
-//     Generalizing this is future work.
+//     by the static allocation plan). "slice" like ops, which can only reuse
+//     the input's memory when the selected region is contiguous, are planned
+//     as kSlicedView: the output is planned against the input's buffer so
+//     that buffer stays alive for the view's consumers, and the kernel
+//     decides at run time whether to create a view or fall back to a copy.
 
 enum class AllocKind {
   kNotSet = -1,
@@ -28,7 +29,8 @@ enum class AllocKind {
   kPreExisting = 2,
   kAllocateStatically = 3,
   kAllocateOutput = 4,
-  kShare = 5
+  kShare = 5,
+  kSlicedView = 6
 };
 
 std::ostream& operator<<(std::ostream& out, AllocKind alloc_kind);
@@ -158,6 +158,32 @@ class IExecutionProvider {
   */
   virtual common::Status OnRunEnd();
 
+  /**
+     Records a completion marker covering all device work this provider has
+     submitted so far. A caller that invokes this right after Run() returns can
+     then use PollRunCompletion()/WaitRunCompletion() to observe when that Run's
+     work has drained, without blocking the whole device the way Sync() does.
+     Providers that execute synchronously keep the defaults, for which
+     completion is always immediate.
+  */
+  virtual common::Status RecordRunCompletion() { return Status::OK(); }
+
+  /**
+     Non-blocking check of the marker recorded by the last RecordRunCompletion()
+     call. Sets completed to true when the covered work has finished, or when no
+     marker has been recorded.
+  */
+  virtual common::Status PollRunCompletion(bool& completed) const {
+    completed = true;
+    return Status::OK();
+  }
+
+  /**
+     Blocks until the work covered by the last RecordRunCompletion() call has
+     finished on the device.
+  */
+  virtual common::Status WaitRunCompletion() const { return Sync(); }
+
   /**
      Called when session creation is complete
      This provides an opportunity for execution providers to optionally synchronize and
@@ -165,6 +191,26 @@ class IExecutionProvider {
   */
   virtual common::Status OnSessionInitializationEnd();
 
+  /**
+     Requests that the provider capture the device work of a Run into a device-side graph that
+     later Runs replay with a single launch, removing the per-node launch overhead.
+     Returns an error for providers without graph capture support (the default).
+  */
+  virtual common::Status EnableGraphCapture() {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, Type(), " does not support graph capture.");
+  }
+
+  /** True if EnableGraphCapture() completed successfully on this provider. */
+  virtual bool IsGraphCaptureEnabled() const { return false; }
+
+  /** True once a Run has been captured and ReplayGraph() can be used. */
+  virtual bool IsGraphCaptured() const { return false; }
+
+  /** Replays the captured graph. Only valid once IsGraphCaptured() returns true. */
+  virtual common::Status ReplayGraph() {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, Type(), " does not support graph replay.");
+  }
+
   void InsertAllocator(AllocatorPtr allocator);
   void ReplaceAllocator(AllocatorPtr allocator);
 
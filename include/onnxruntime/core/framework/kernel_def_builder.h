@@ -64,6 +64,10 @@ class KernelDef {
     return alias_map_;
   }
 
+  const std::vector<std::pair<int, int>>& MaySliceView() const {
+    return slice_view_map_;
+  }
+
   OrtMemType InputMemoryType(size_t input_index) const {
     auto it = input_memory_type_args_.find(input_index);
     if (it == input_memory_type_args_.end())
@@ -77,6 +81,8 @@ class KernelDef {
 
   bool AllocateInputsContiguously() const { return allocate_inputs_contiguously_; }
 
+  bool IsInputConsumedAfterRead(int input_index) const;
+
   OrtMemType OutputMemoryType(size_t output_index) const {
     auto it = output_memory_type_args_.find(output_index);
     if (it == output_memory_type_args_.end())
@@ -130,10 +136,18 @@ class KernelDef {
 
   // An element <i, j> means that output j is an alias of input i.
   std::vector<std::pair<int, int>> alias_map_;
-  
+
+  // An element <i, j> means that output j may be created as a view over a contiguous
+  // slice of input i. j of -1 means all outputs.
+  std::vector<std::pair<int, int>> slice_view_map_;
+
   // Require input tensors to be allocated contiguously.
   bool allocate_inputs_contiguously_ = false;
 
+  // Inputs the kernel finishes reading before it completes, and may therefore release
+  // mid-Compute via OpKernelContext::ReleaseConsumedInput. -1 means all inputs.
+  std::vector<int> consumed_after_read_inputs_;
+
   // The memory types of inputs/outputs of this kernel
   MemTypeMap input_memory_type_args_;
   MemTypeMap output_memory_type_args_;
@@ -220,6 +234,18 @@ class KernelDefBuilder {
   KernelDefBuilder& Alias(const std::vector<std::pair<int, int>>& aliases);
   KernelDefBuilder& Alias(int input_index, int output_index);
 
+  /**
+     Declare that the kernel may produce an output as a zero-copy view over a
+     contiguous slice of an input (via OpKernelContext::TryOutputSliceView),
+     e.g. Split along the outermost axis. Unlike Alias the view is conditional:
+     the allocation planner keeps the input's buffer alive for the output's
+     consumers, and the kernel falls back to a copy when the slice is not
+     contiguous. Pass -1 as output_index to cover all outputs of a variadic
+     kernel.
+  */
+  KernelDefBuilder& MaySliceView(const std::vector<std::pair<int, int>>& slice_views);
+  KernelDefBuilder& MaySliceView(int input_index, int output_index);
+
   /**
      Specify that this kernel requires input tensors to be allocated
      contiguously. This allows kernels to execute as a single large
@@ -229,7 +255,19 @@ class KernelDefBuilder {
     kernel_def_->allocate_inputs_contiguously_ = true;
     return *this;
   }
-  
+
+  /**
+     Mark inputs that the kernel has finished reading before its Compute returns, and that it
+     may hand back to the execution frame mid-Compute via OpKernelContext::ReleaseConsumedInput.
+     Pass -1 (or use the argument-less overload) to mark all inputs, e.g. for variadic kernels.
+     The declaration only makes early release possible; whether an input is actually dropped is
+     decided by the executor, which releases it only when this node is its last consumer.
+  */
+  KernelDefBuilder& ConsumedAfterRead(const std::vector<int>& input_indexes);
+  KernelDefBuilder& ConsumedAfterRead(int input_index);
+  KernelDefBuilder& ConsumedAfterRead() { return ConsumedAfterRead(-1); }
+
+
   /**
      Specify that this kernel requires an input arg
      in certain memory type (instead of the default, device memory).
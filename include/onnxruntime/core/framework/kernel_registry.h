@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "core/framework/op_kernel.h"
 
 namespace onnxruntime {
@@ -91,5 +93,9 @@ class KernelRegistry {
   // Kernel create function map from op name to kernel creation info.
   // key is opname+domain_name+provider_name
   KernelCreateMap kernel_creator_fn_map_;
+
+  // Index from kernel def hash to the entry in kernel_creator_fn_map_ so that lookup by hash
+  // (used when loading an ORT format model) is a single probe instead of a string-keyed search.
+  std::unordered_map<uint64_t, const KernelCreateInfo*> kernel_def_hash_map_;
 };
 }  // namespace onnxruntime
@@ -24,6 +24,7 @@ namespace onnxruntime {
 class IExecutionFrame;
 class OpKernelContext;
 class OpKernelWrapper;
+struct PrePackedWeights;
 namespace concurrency {
 class ThreadPool;
 }
@@ -70,6 +71,30 @@ class OpKernel {
     return Status::OK();
   }
 
+  // Variant of the above used when pre-packed weights may be shared across kernel instances
+  // (and sessions) via a PrepackedWeightsContainer.
+  // If the kernel packs the tensor and supports sharing, it must allocate the packed buffer(s)
+  // with 'alloc' (an allocator whose memory outlives this kernel) and transfer ownership of them
+  // to 'prepacked_weights', keeping only non-owning references for use in Compute.
+  // If 'prepacked_weights' is left empty the packed copy simply stays private to this kernel.
+  // The default implementation forwards to the non-sharing PrePack overload above.
+  virtual Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr /*alloc*/,
+                         bool& is_packed, PrePackedWeights* /*prepacked_weights*/) {
+    return PrePack(tensor, input_idx, is_packed);
+  }
+
+  // Override this function to consume pre-packed buffers previously produced by an identical
+  // kernel instance (potentially in another session) for the constant initialized 'tensor' at
+  // 'input_idx'. 'prepacked_buffers' hold non-owning references to the shared copies; the kernel
+  // must keep them (the original tensor will be released) if it sets 'used_shared_buffers' to
+  // true, in which case PrePack is not called.
+  virtual Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& /*prepacked_buffers*/,
+                                           int /*input_idx*/, const Tensor& /*tensor*/,
+                                           bool& used_shared_buffers) {
+    used_shared_buffers = false;
+    return Status::OK();
+  }
+
   const OrtMemoryInfo& Allocator(int id, OrtMemType mem_type) const {
     return op_kernel_info_.GetMemoryInfo(id, mem_type);
   }
@@ -143,6 +168,17 @@ class OpKernelContext {
     return *output_ptr;
   }
 
+  /**
+  Try to produce the output at 'output_index' as a zero-copy view over a contiguous slice of the
+  input at 'input_index', starting 'byte_offset' bytes into the input's data. Only possible when
+  the kernel declared the pair via KernelDefBuilder::MaySliceView, so the allocation planner kept
+  the input's buffer alive for the output's consumers. Returns nullptr when a view cannot be
+  handed out (e.g. the output is a graph output), in which case the kernel must fall back to
+  allocating the output via Output() and copying the slice. The returned tensor points into the
+  input's memory and must not be written to.
+  */
+  Tensor* TryOutputSliceView(int output_index, int input_index, ptrdiff_t byte_offset, const TensorShape& shape);
+
   // Fetch a sparse-tensor output corresponding to the specified index.
   // num_values must specify the number of non-zero values (commonly known as NNZ/nnz),
   // and shape must specify the shape of the underlying dense-tensor.
@@ -160,6 +196,16 @@ class OpKernelContext {
   // false.
   bool TryGetInferredOutputShape(int index, TensorShape& shape) const;
 
+  /**
+  Hand the input at 'index' back to the execution frame once the kernel has finished reading it,
+  so inputs of multi-input kernels (e.g. Concat) can be freed one by one instead of all staying
+  live until the node completes. Only inputs declared with KernelDefBuilder::ConsumedAfterRead
+  are considered, and an input is only dropped if the executor confirms this node is its last
+  consumer; in all other cases the call is a no-op. The kernel must not touch the input's data
+  after this call.
+  */
+  Status ReleaseConsumedInput(int index);
+
   const logging::Logger& Logger() const {
     return *logger_;
   }
@@ -236,6 +282,12 @@ class OpKernelContext {
  protected:
   onnxruntime::NodeIndex GetNodeIndex() const;
 
+  // Overridden by OpKernelContextInternal, which knows from the execution plan which values die
+  // at this node. The base implementation conservatively keeps everything alive.
+  virtual bool CanReleaseInput(int /*ort_value_index*/) const {
+    return false;
+  }
+
   const OrtValue* GetInputMLValue(int index) const;
   const OrtValue* GetImplicitInputMLValue(int index) const;
   OrtValue* GetOutputMLValue(int index);
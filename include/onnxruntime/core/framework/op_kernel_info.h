@@ -45,6 +45,12 @@ class OpKernelInfo : public OpNodeProtoHelper<ProtoHelperNodeContext> {
 
   bool TryGetConstantInput(int input_index, const Tensor** constant_input_value) const;
 
+  // Returns true and sets 'shape' when graph resolve time shape inference
+  // produced a fully static shape for the given input. Kernels can use this
+  // at creation time to precompute shape-dependent dispatch decisions for
+  // models with static shapes instead of re-deriving them on every Compute.
+  bool TryGetStaticInputShape(int input_index, TensorShape& shape) const;
+
   common::Status GetFusedFuncs(NodeComputeInfo*& compute_info) const;
 
  private:
@@ -26,6 +26,48 @@ struct OrtRunOptions {
   // So it is possible that only some of the nodes are executed.
   bool only_execute_path_to_fetches = false;
 
+  // Budget in bytes for CPU arena memory while this Run executes. 0 (the default) means
+  // no budget. When set, the Run fails with a clean error instead of growing the arena
+  // past the budget, and a run whose cached memory pattern already plans a larger peak
+  // allocation is rejected before executing. Concurrent budgeted runs against the same
+  // session share the most recently set value.
+  size_t run_memory_budget_bytes = 0;
+
+  // When non-empty, sampled Run() calls record their exact input tensors and the process
+  // random seed into a binary capture file named '<prefix>.<n>' (n counting recorded runs),
+  // which 'onnxruntime_perf_test -R <file>' re-executes offline under the profiler. Only
+  // runs whose feeds are all CPU tensors of non-string types are recorded. Empty (the
+  // default) disables recording.
+  std::string run_capture_path_prefix;
+
+  // Record every Nth Run() using these options (1-in-N sampling keeps always-on capture
+  // cheap in production). Values below 1 behave like 1: record every Run.
+  int run_capture_sample_ratio = 1;
+
+  // Identifies a generation sequence across Run() calls for kernels that keep incremental
+  // state between runs (currently the com.microsoft.Attention KV cache). Kernels append
+  // into preallocated per-sequence buffers instead of re-reading and re-writing growing
+  // past/present tensors each step. Empty (the default) disables stateful execution.
+  // Concurrent Runs must use distinct sequence ids; state is freed with the session.
+  std::string run_sequence_id;
+
+  // Capacity in tokens of the per-sequence state buffers. Only read on the first Run with
+  // a given run_sequence_id (or the first after a reset); the capacity is fixed for the
+  // lifetime of the sequence and a Run that would exceed it fails cleanly.
+  int run_sequence_max_length = 0;
+
+  // Set to 'true' to drop any state previously accumulated for run_sequence_id before
+  // this Run executes, so the handle can be reused for a new sequence.
+  bool run_sequence_reset = false;
+
+  // Maximum number of intra-op threads (including the calling thread) that
+  // parallel loops started by this Run may use. 0 (the default) means no limit.
+  // Lets a scheduler give an interactive Run a few cores of a shared
+  // environment pool while a batch Run uses the rest, without separate
+  // processes. The limit applies to loops initiated from the Run's calling
+  // thread; it does not reduce the size of the pool itself.
+  int intra_op_thread_limit = 0;
+
 #ifdef ENABLE_TRAINING
   // Set to 'true' to run in training mode.
   bool training_mode = true;
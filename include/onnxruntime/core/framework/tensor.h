@@ -71,6 +71,18 @@ class Tensor final {
   Tensor(MLDataType p_type, const TensorShape& shape, void* p_data, const OrtMemoryInfo& alloc,
          ptrdiff_t offset = 0);
 
+  /**
+   * Create a strided view with the given type, shape and per-dimension strides (in elements)
+   * over pre-allocated memory. The tensor does not own the data and will not delete it.
+   * Only code that explicitly checks IsContiguous() supports non-contiguous tensors - the
+   * element-wise broadcast machinery does, most kernels assume dense storage - so strided
+   * views must not be handed to arbitrary consumers.
+   * \param strides Distance in elements between consecutive indices of each dimension.
+   * \param offset Offset in bytes to the first element of the view within p_data.
+   */
+  Tensor(MLDataType p_type, const TensorShape& shape, void* p_data, const OrtMemoryInfo& alloc,
+         const std::vector<int64_t>& strides, ptrdiff_t offset = 0);
+
   /**
    * Deprecated. The orginal design is this Tensor class won't do any allocation / release.
    * However, this function will allocate the buffer for the shape, and do placement new if p_type is string tensor.
@@ -121,6 +133,19 @@ class Tensor final {
   */
   const OrtMemoryInfo& Location() const { return alloc_info_; }
 
+  /**
+     Returns the strides of the tensor in elements per dimension, computing the dense
+     row-major strides from the shape when none were set explicitly.
+  */
+  std::vector<int64_t> Strides() const;
+
+  /**
+     False only for a tensor created as a strided view whose strides differ from the dense
+     row-major strides of its shape. Consumers that assume dense storage (pretty much every
+     kernel outside the element-wise broadcast machinery) must only accept contiguous tensors.
+  */
+  bool IsContiguous() const noexcept { return is_contiguous_; }
+
   /**
      May return nullptr if tensor size is zero
   */
@@ -189,6 +214,7 @@ class Tensor final {
    * @warning this function is NOT thread-safe.
    */
   inline void Reshape(const TensorShape& new_shape) {
+    ORT_ENFORCE(is_contiguous_, "Cannot reshape a non-contiguous tensor.");
     ORT_ENFORCE(shape_.Size() == new_shape.Size(),
                 "Tensor size (" + std::to_string(shape_.Size()) +
                     ") != new size (" + std::to_string(new_shape.Size()) + ")");
@@ -236,6 +262,10 @@ class Tensor final {
   AllocatorPtr buffer_deleter_;
 
   TensorShape shape_;
+  // explicit strides in elements per dimension. empty when the tensor is a dense row-major
+  // layout (the common case), in which case Strides() computes them from the shape.
+  std::vector<int64_t> strides_;
+  bool is_contiguous_{true};
   const PrimitiveDataTypeBase* dtype_;
   OrtMemoryInfo alloc_info_;
   ptrdiff_t byte_offset_;
@@ -17,7 +17,10 @@ namespace onnxruntime {
 #endif
 #endif
 class TensorShape : private std::vector<int64_t> {
-  // TODO - Use a custom STL allocator to avoid heap allocations in the common case.
+  // The representation must stay exactly std::vector<int64_t>: GetDims() hands out a reference to
+  // it and ReinterpretBaseType() casts a plain vector to a TensorShape, so inline (small-buffer)
+  // dimension storage cannot be introduced without breaking both. Avoid heap churn by moving
+  // shapes and preferring SizeToDimension/SizeFromDimension over Slice(...).Size() instead.
   // We use negative numbers for unknown symbolic dimension. Each negative
   // number represents a unique symbolic dimension.
   // Private inheritance is used to prevent ambiguity of element versus dimension size
@@ -102,12 +105,19 @@ class TensorShape : private std::vector<int64_t> {
   /**
      Return a new TensorShape of the dimensions from dimstart to dimend.
   */
-  TensorShape Slice(size_t dimstart, size_t dimend) const;
+  TensorShape Slice(size_t dimstart, size_t dimend) const&;
 
   /**
      Return a new TensorShape of the dimensions from dimstart to end.
   */
-  TensorShape Slice(size_t dimstart) const;
+  TensorShape Slice(size_t dimstart) const&;
+
+  /**
+     Slicing an expiring TensorShape reuses its storage instead of allocating a new vector.
+  */
+  TensorShape Slice(size_t dimstart, size_t dimend) &&;
+
+  TensorShape Slice(size_t dimstart) &&;
 
   /**
      output dimensions nicely formatted
@@ -19,6 +19,7 @@
 #include "core/graph/constants.h"
 #include "core/graph/graph_nodes.h"
 #include "core/graph/node_arg.h"
+#include "core/platform/ort_mutex.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/graph/function.h"
 #include "gsl/gsl"
@@ -310,6 +311,9 @@ class Node {
   /** Add an attribute to this Node with specified attribute name and value. */
   void AddAttribute(const std::string& attr_name, const ONNX_NAMESPACE::AttributeProto& value);
 
+  /** Add an attribute to this Node, taking ownership of the value to avoid copying the AttributeProto. */
+  void AddAttribute(const std::string& attr_name, ONNX_NAMESPACE::AttributeProto&& value);
+
 #define ADD_ATTR_INTERFACES(TypeName)                                     \
   void AddAttribute(const std::string& attr_name, const TypeName& value); \
   void AddAttribute(const std::string& attr_name,                         \
@@ -487,6 +491,16 @@ class Node {
             const NodeAttributes* attributes,
             const std::string& domain);
 
+  // Overload that takes ownership of the attributes so loading a model does
+  // not deep copy every AttributeProto a second time.
+  void Init(const std::string& name,
+            const std::string& op_type,
+            const std::string& description,
+            const std::vector<NodeArg*>& input_args,
+            const std::vector<NodeArg*>& output_args,
+            NodeAttributes&& attributes,
+            const std::string& domain);
+
   // internal only method to allow selected classes to directly alter the input/output definitions and arg counts
   Definitions& MutableDefinitions() noexcept;
 
@@ -794,6 +808,17 @@ class Graph {
                 const NodeAttributes* attributes = nullptr,
                 const std::string& domain = "");
 
+  /** Add a Node to this Graph, taking ownership of the attributes to avoid copying them.
+  See the overload above for the parameter descriptions.
+  */
+  Node& AddNode(const std::string& name,
+                const std::string& op_type,
+                const std::string& description,
+                const std::vector<NodeArg*>& input_args,
+                const std::vector<NodeArg*>& output_args,
+                NodeAttributes&& attributes,
+                const std::string& domain = "");
+
   /** Remove a Node from this Graph and free it.
   The output edges of this specified node MUST have been removed before removing the node.
   The input edges of this specified node is removed while removing the node. The process of
@@ -836,6 +861,20 @@ class Graph {
   This should be done after modifying any aspect of the Graph that changes the Nodes or relationships between them. */
   Graph& SetGraphResolveNeeded() noexcept {
     graph_resolve_needed_ = true;
+    all_nodes_changed_ = true;
+    ++mutation_epoch_;
+    return *this;
+  }
+
+  /** Mark the Graph as needing Resolve() to be called due to a change to a specific Node.
+  Tracking the changed Node allows Resolve to limit type/shape inferencing to the changed nodes and the
+  nodes downstream of them when ResolveOptions.reinfer_changed_nodes_only is set. */
+  Graph& SetGraphResolveNeeded(const Node& node) noexcept {
+    graph_resolve_needed_ = true;
+    if (!all_nodes_changed_) {
+      changed_nodes_.insert(node.Index());
+    }
+    ++mutation_epoch_;
     return *this;
   }
 
@@ -901,6 +940,18 @@ class Graph {
   void KahnsTopologicalSort(const std::function<void(const Node*)>& enter,
                             const std::function<bool(const Node*, const Node*)>& comp) const;
 
+#endif
+
+  /** Gets the nodes in topological order (reverse DFS over node indexes).
+  The ordering is cached on the Graph and invalidated whenever the graph is marked as needing
+  Resolve, so the execution providers that construct a GraphViewer per GetCapability call during
+  partitioning share one sort instead of re-sorting an unchanged graph. */
+  const std::vector<NodeIndex>& GetCachedTopologicalOrder() const;
+
+#if !defined(ORT_MINIMAL_BUILD)
+  /** Gets the nodes in the priority-aware topological order used by the parallel executor.
+  Cached and invalidated like GetCachedTopologicalOrder. */
+  const std::vector<NodeIndex>& GetCachedTopologicalOrderWithPriority() const;
 #endif
 
   /** Gets the map of operator domains to their opset versions. */
@@ -1026,6 +1077,11 @@ class Graph {
     // Whether to set that no proto sync is required after resolving.
     // Useful for resolving right after loading from a GraphProto.
     bool no_proto_sync_required = false;
+    // Re-run type/shape inferencing only for the nodes that changed since the last successful Resolve,
+    // and for the nodes downstream of them. All other Resolve steps are unaffected.
+    // Opt-in as it is only safe when all changes since the last Resolve were made via the Graph/Node
+    // APIs (which track the affected node), and not e.g. by updating a NodeArg directly.
+    bool reinfer_changed_nodes_only = false;
   };
 
   /**
@@ -1142,6 +1198,11 @@ class Graph {
 
   Graph& GraphResolveNeeded(bool needed) noexcept {
     graph_resolve_needed_ = needed;
+    if (needed) {
+      // the change can't be attributed to individual nodes
+      all_nodes_changed_ = true;
+      ++mutation_epoch_;
+    }
     return *this;
   }
 
@@ -1323,11 +1384,34 @@ class Graph {
   // A flag indicates whether <*this> graph needs to be resolved.
   bool graph_resolve_needed_ = false;
 
+  // Nodes changed since the last successful Resolve. Used to limit type/shape inferencing when
+  // ResolveOptions.reinfer_changed_nodes_only is set. all_nodes_changed_ records changes that
+  // can't be attributed to individual nodes.
+  std::unordered_set<NodeIndex> changed_nodes_;
+  bool all_nodes_changed_ = true;
+
+  // Copy of the change tracking taken at the start of Resolve. Resolve itself rebuilds the node
+  // relationships, which records every node as changed, so inferencing works from this snapshot.
+  std::unordered_set<NodeIndex> changed_nodes_snapshot_;
+  bool all_nodes_changed_snapshot_ = true;
+
   bool graph_proto_sync_needed_ = false;
 
   // The topological order of node index used to do node and op match verification temporarily.
   std::vector<NodeIndex> nodes_in_topological_order_;
 
+  // Counts graph mutations: bumped by every SetGraphResolveNeeded/GraphResolveNeeded(true) call,
+  // which every structural change goes through. The cached topological orderings below record
+  // the epoch they were computed at and are recomputed when it no longer matches.
+  uint64_t mutation_epoch_ = 1;
+  mutable OrtMutex cached_topo_order_lock_;
+  mutable uint64_t cached_topo_order_epoch_ = 0;
+  mutable std::vector<NodeIndex> cached_topo_order_;
+#if !defined(ORT_MINIMAL_BUILD)
+  mutable uint64_t cached_topo_order_with_priority_epoch_ = 0;
+  mutable std::vector<NodeIndex> cached_topo_order_with_priority_;
+#endif
+
   // Full list of graph inputs. Matches number and order of inputs in the GraphProto.
   std::vector<const NodeArg*> graph_inputs_including_initializers_;
   bool graph_inputs_manually_set_ = false;
@@ -152,7 +152,20 @@ class SchemaRegistryManager : public onnxruntime::IOnnxRuntimeOpSchemaCollection
  private:
   void GetDomainToVersionMapForRegistries(DomainToVersionMap& domain_version_map, bool is_onnx_only) const;
 
+  // uncached lookup walking the registries and the ONNX schema registry
+  void GetSchemaAndHistoryImpl(const std::string& key, int max_inclusive_version, const std::string& domain,
+                               const ONNX_NAMESPACE::OpSchema** latest_schema,
+                               int* earliest_opset_where_unchanged) const;
+
   std::deque<std::shared_ptr<IOnnxRuntimeOpSchemaCollection>> registries;
+
+  // Cache of resolved lookups, keyed by "domain:op:version". Graph::Resolve looks up the same
+  // schema for every node on every Resolve round, so hits skip the registry walk entirely.
+  // Misses are cached too (as nullptr). Cleared when a registry is registered, since the new
+  // registry takes priority over previous results; the cached OpSchema pointers themselves are
+  // stable because registries never remove schemas.
+  mutable OrtMutex schema_cache_mutex_;
+  mutable std::unordered_map<std::string, std::pair<const ONNX_NAMESPACE::OpSchema*, int>> schema_lookup_cache_;
 };
 
 }  // namespace onnxruntime
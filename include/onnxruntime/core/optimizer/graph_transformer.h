@@ -41,6 +41,12 @@ class GraphTransformer {
 
   virtual bool ShouldOnlyApplyOnce() const { return false; }
 
+  /** Op types that anchor the patterns this transformer matches. When none of them appear anywhere
+  in the model the transformer cannot modify it, so GraphTransformerManager skips the pass for that
+  round. Returns nullptr when the transformer has no such anchor set and must always run.
+  */
+  virtual const std::unordered_set<std::string>* TriggerOpTypes() const { return nullptr; }
+
  protected:
   /** Helper method to call ApplyImpl on any subgraphs in the Node. */
   common::Status Recurse(Node& node, bool& modified, int graph_level, const logging::Logger& logger) const {
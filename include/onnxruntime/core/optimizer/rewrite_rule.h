@@ -70,6 +70,16 @@ class RewriteRule {
     return SatisfyCondition(graph, node, logger) ? Apply(graph, node, rule_effect, logger) : Status::OK();
   }
 
+  /** Checks only the condition of the rule without applying its body. Condition checks are read-only on the graph,
+      so they can be evaluated concurrently over disjoint sets of nodes to pre-filter candidates before a serial
+      application phase.
+      @param[in] graph The Graph.
+      @param[in] node The Node to check the condition for.
+      @returns true if the condition of the rule is satisfied for the given node. */
+  bool CheckCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const {
+    return SatisfyCondition(graph, node, logger);
+  }
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RewriteRule);
 
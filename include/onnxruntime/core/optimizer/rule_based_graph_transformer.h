@@ -53,6 +53,12 @@ class RuleBasedGraphTransformer : public GraphTransformer {
   /** Returns the total number of rules that are registered in this transformer. */
   size_t RulesCount() const;
 
+  /** The op types for which at least one rule is registered. When a rule is registered for all op
+      types there is no trigger set and the transformer always runs. */
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    return any_op_type_rules_.empty() ? &trigger_op_types_ : nullptr;
+  }
+
  protected:
   /** Applies the given set of rewrite rules on the Node of this Graph.
       @param[in] graph The Graph.
@@ -67,13 +73,21 @@ class RuleBasedGraphTransformer : public GraphTransformer {
 
  private:
   using RuleEffect = RewriteRule::RewriteRuleEffect;
-  
+
+  // Evaluates the rule conditions over the topological order with the matching work spread across worker
+  // threads, then serially applies the matched rules. Used for graphs large enough that the matching phase
+  // dominates the pass.
+  common::Status ApplyWithParallelMatch(Graph& graph, const std::vector<NodeIndex>& order, size_t thread_count,
+                                        bool& modified, int graph_level, const logging::Logger& logger) const;
+
   // The list of unique pointers for all rules (so that rules can be registered for several op types).
   std::vector<std::unique_ptr<RewriteRule>> rules_;
   // Map that associates a node's op type with the vector of rules that are registered to be triggered for that node.
   std::unordered_map<std::string, std::vector<std::reference_wrapper<const RewriteRule>>> op_type_to_rules_;
   // Rules that will be evaluated regardless of the op type of the node.
   std::vector<std::reference_wrapper<const RewriteRule>> any_op_type_rules_;
+  // The op types that have at least one rule registered, i.e. the keys of op_type_to_rules_.
+  std::unordered_set<std::string> trigger_op_types_;
 
   // Performs a single top-down traversal of the graph and applies all registered rules.
   common::Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
@@ -9,6 +9,7 @@
 
 /* Modifications Copyright (c) Microsoft. */
 
+#include <deque>
 #include <type_traits>
 
 #pragma once
@@ -32,12 +33,17 @@
 #elif defined(_MSC_VER)
 #pragma warning(pop)
 #endif
+#include <algorithm>
+
 #include "core/common/denormal.h"
 #include "core/common/make_unique.h"
 #include "core/common/spin_pause.h"
 #include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
 #include "core/platform/Barrier.h"
 
+#include <chrono>
+
 // ORT thread pool overview
 // ------------------------
 //
@@ -61,7 +67,8 @@
 //   work.
 //
 //   This spin-then-block behavior is configured via a flag provided
-//   when creating the thread pool, and by the constant spin_count.
+//   when creating the thread pool, and by the spin duration and
+//   adaptive spinning settings in ThreadOptions.
 //
 // - Although all tasks are simple void()->void functions,
 //   conceptually there are three different kinds:
@@ -139,6 +146,30 @@ class ThreadPoolLoop;
 
 class ExtendedThreadPoolInterface : public Eigen::ThreadPoolInterface {
  public:
+  // Schedule fn() ahead of any tasks submitted via Schedule().  Workers
+  // take high-priority tasks before consulting their own run queues, so
+  // a high-priority task preempts any backlog of queued normal-priority
+  // work (but does not interrupt tasks that are already running).
+  virtual void ScheduleHighPriority(std::function<void()> fn) = 0;
+
+  // Return the number of tasks currently waiting in the pool's queues,
+  // excluding tasks that are already running.  The count is assembled from
+  // per-queue sizes without stopping the pool, so it is approximate and
+  // intended for monitoring rather than synchronization.
+  virtual int NumQueuedTasks() const = 0;
+
+  // Attempt to take one pending task from the pool's queues and run it on
+  // the calling thread, returning true if a task was run.  This lets a
+  // thread that must wait for pool work to complete lend itself to the pool
+  // instead of idling, so that nested waiting (e.g. control-flow kernels
+  // executing subgraphs) cannot strand every worker.
+  virtual bool TryRunPendingTask() = 0;
+
+  // Fill stats with a snapshot of the pool's cumulative activity counters.
+  // Counters maintained above the pool (such as the per-region ones) are
+  // left untouched.
+  virtual void GetStats(ThreadPoolStats& stats) const = 0;
+
   // Start/end a parallel section, within which calls to
   // RunInParallelSection may be made.  Parallel sections are
   // non-nesting.
@@ -580,7 +611,10 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
       : env_(env),
         num_threads_(num_threads),
         allow_spinning_(allow_spinning),
+        spin_count_log2_(thread_options.spin_count_log2),
+        adaptive_spinning_(thread_options.adaptive_spinning),
         set_denormal_as_zero_(thread_options.set_denormal_as_zero),
+        sticky_submission_(thread_options.use_sticky_task_queues),
         worker_data_(num_threads),
         all_coprimes_(num_threads),
         blocked_(0),
@@ -643,15 +677,30 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
       Queue& q = worker_data_[pt->thread_id].queue;
       fn = q.PushFront(std::move(fn));
     } else {
-      // A free-standing thread (or worker of another pool), push onto a random
-      // queue.
-      int q_idx = Rand(&pt->rand) % num_threads_;
+      // A free-standing thread (or worker of another pool).  With sticky
+      // submission enabled, keep targeting the same worker's queue while it
+      // accepts work, so that a stream of short tasks from one submitter stays
+      // on a single core with a warm cache.  Otherwise (and whenever the sticky
+      // target's queue is full) push onto a random queue; work stealing between
+      // the per-thread queues still rebalances any backlog.
+      int q_idx;
+      if (sticky_submission_ && pt->preferred_queue >= 0 && pt->preferred_queue < num_threads_) {
+        q_idx = pt->preferred_queue;
+      } else {
+        q_idx = Rand(&pt->rand) % num_threads_;
+      }
       WorkerData &td = worker_data_[q_idx];
       Queue& q = td.queue;
       fn = q.PushBack(std::move(fn));
       if (!fn) {
         // The queue accepted the work; ensure that the thread will pick it up
+        if (sticky_submission_) {
+          pt->preferred_queue = q_idx;
+        }
         td.EnsureAwake();
+      } else if (sticky_submission_) {
+        // The preferred worker is backed up; choose a new target next time.
+        pt->preferred_queue = -1;
       }
     }
 
@@ -659,6 +708,71 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     if (fn) fn();
   }
 
+  // Add a task to the central high-priority queue.  Workers poll this queue
+  // ahead of their own run queues, so the task runs before any queued
+  // normal-priority work.  The queue is expected to be almost always empty
+  // (high priority is reserved for latency-critical submitters), hence a
+  // single mutex-protected deque suffices: workers only take the mutex after
+  // an atomic counter shows there is something to take.
+
+  void ScheduleHighPriority(std::function<void()> fn) override {
+    {
+      std::lock_guard<OrtMutex> lock(high_priority_mutex_);
+      high_priority_queue_.push_back(std::move(fn));
+    }
+    num_high_priority_tasks_.fetch_add(1, std::memory_order_release);
+
+    // Spinning workers will observe the counter; if none are spinning, wake a
+    // blocked worker.  Workers that are busy will poll the queue when their
+    // current task completes.
+    for (auto& td : worker_data_) {
+      WorkerData::ThreadStatus status = td.GetStatus();
+      if (status == WorkerData::ThreadStatus::Spinning) {
+        break;
+      }
+      if (status == WorkerData::ThreadStatus::Blocking ||
+          status == WorkerData::ThreadStatus::Blocked) {
+        td.EnsureAwake();
+        break;
+      }
+    }
+  }
+
+  int NumQueuedTasks() const override {
+    int count = static_cast<int>(num_high_priority_tasks_.load(std::memory_order_relaxed));
+    for (const auto& td : worker_data_) {
+      count += static_cast<int>(td.queue.Size());
+    }
+    return count;
+  }
+
+  // Pop one pending task (high-priority first, then stealing from the worker
+  // queues) and run it on the calling thread.  Stealing from the back of a
+  // queue is safe from any thread; it is the same path the workers use.
+  bool TryRunPendingTask() override {
+    Task t = PopHighPriority();
+    if (!t) {
+      for (int i = 0; i < num_threads_ && !t; i++) {
+        t = worker_data_[i].queue.PopBack();
+      }
+    }
+    if (t) {
+      t();
+      num_tasks_executed_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  void GetStats(onnxruntime::concurrency::ThreadPoolStats& stats) const override {
+    stats.num_threads = num_threads_;
+    stats.num_queued_tasks = NumQueuedTasks();
+    stats.num_tasks_executed = num_tasks_executed_.load(std::memory_order_relaxed);
+    stats.num_tasks_stolen = num_tasks_stolen_.load(std::memory_order_relaxed);
+    stats.num_parks = num_parks_.load(std::memory_order_relaxed);
+    stats.parked_time_us = parked_time_us_.load(std::memory_order_relaxed);
+  }
+
 // The thread pool maintains a set of hints for which threads will be good to distribute
 // work to.  A thread is considered "good" if it is actively spinning, meaning both that
 // it is not busy with existing work, and that it should respond quickly to the addition
@@ -1043,6 +1157,7 @@ int CurrentThreadId() const EIGEN_FINAL {
     int thread_id{-1};                // Worker thread index in pool.
     Tag tag{};                        // Work item tag used to identify this thread.
     bool leading_par_section{false};  // Leading a parallel section (used only for asserts)
+    int preferred_queue{-1};          // Sticky submission target for external threads, or -1.
   };
 
   static_assert(std::is_trivially_destructible<PerThread>::value,
@@ -1143,13 +1258,52 @@ int CurrentThreadId() const EIGEN_FINAL {
   Environment& env_;
   const int num_threads_;
   const bool allow_spinning_;
+  const int spin_count_log2_;
+  const bool adaptive_spinning_;
   const bool set_denormal_as_zero_;
+  const bool sticky_submission_;
   Eigen::MaxSizeVector<WorkerData> worker_data_;
   Eigen::MaxSizeVector<Eigen::MaxSizeVector<unsigned>> all_coprimes_;
   std::atomic<unsigned> blocked_;  // Count of blocked workers, used as a termination condition
   std::atomic<bool> done_;
   std::atomic<bool> cancelled_;
 
+  // Count of tasks executed across all workers, used by adaptive spinning to
+  // detect whether the pool is still actively processing work, and exported
+  // via GetStats together with the other activity counters below.
+  std::atomic<uint64_t> num_tasks_executed_{0};
+
+  // Activity counters exported via GetStats.  All are updated with relaxed
+  // atomics on paths that are already heavyweight (stealing, parking), so
+  // they add no cost to the per-task fast path.
+  std::atomic<uint64_t> num_tasks_stolen_{0};
+  std::atomic<uint64_t> num_parks_{0};
+  std::atomic<uint64_t> parked_time_us_{0};
+
+  // Central queue of tasks submitted via ScheduleHighPriority.  Workers poll
+  // it before taking work from their own run queues.  The counter allows the
+  // empty case (by far the common one) to be checked with a single atomic
+  // load, keeping the mutex off the per-task fast path.
+  OrtMutex high_priority_mutex_;
+  std::deque<Task> high_priority_queue_;
+  std::atomic<unsigned> num_high_priority_tasks_{0};
+
+  // Take the oldest high-priority task, or return an empty Task if there are
+  // none pending.
+  Task PopHighPriority() {
+    if (num_high_priority_tasks_.load(std::memory_order_acquire) == 0) {
+      return Task();
+    }
+    std::lock_guard<OrtMutex> lock(high_priority_mutex_);
+    if (high_priority_queue_.empty()) {
+      return Task();
+    }
+    Task t = std::move(high_priority_queue_.front());
+    high_priority_queue_.pop_front();
+    num_high_priority_tasks_.fetch_sub(1, std::memory_order_relaxed);
+    return t;
+  }
+
   // Allow control over how many bits to use in each entry in good_worker_hints_.
   // We reduce this below the full 64-bit word size for two reasons.  First, it
   // helps test coverage on machines without 64 vCPUS.  Second, it lets us
@@ -1185,26 +1339,76 @@ int CurrentThreadId() const EIGEN_FINAL {
     assert(td.GetStatus() == WorkerData::ThreadStatus::Spinning);
     SetGoodWorkerHint(thread_id, true /* Is good */);
 
-    const int log2_spin = 20;
-    const int spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
-    const int steal_count = spin_count/100;
+    // The spin duration is expressed as a power of two so that a misconfigured
+    // value cannot overflow the loop bound.  The default of 2^20 pause
+    // iterations is roughly a millisecond on current hardware.
+    const int default_log2_spin = 20;
+    const int max_log2_spin = 30;
+    const int log2_spin = (spin_count_log2_ < 0) ? default_log2_spin
+                                                 : std::min(spin_count_log2_, max_log2_spin);
+    const uint64_t spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
+    const uint64_t steal_count = spin_count/100;
+
+    // State for adaptive spinning: the count of tasks this worker has executed
+    // itself, and the count of tasks it had seen other workers execute when it
+    // last ran out of work.
+    uint64_t tasks_executed_locally = 0;
+    uint64_t last_observed_remote_tasks = 0;
 
     SetDenormalAsZero(set_denormal_as_zero_);
 
     while (!cancelled_ && !should_exit) {
-        Task t = q.PopFront();
+        // High-priority tasks run ahead of anything queued in the per-thread
+        // run queues; the check is a single atomic load when there are none.
+        Task t = PopHighPriority();
+        if (!t) {
+          t = q.PopFront();
+        }
         if (!t) {
           // Spin waiting for work.  We indicate, via SetGOodWorkerHint that we are
           // spinning.  This will bias other threads toward pushing work to our queue.
           // In addition, priodically make a best-effort attempt to steal from other
           // threads which are not themselves spinning.
 
-          SetGoodWorkerHint(thread_id, true);
-          for (int i = 0; i < spin_count && !t && !cancelled_ && !done_; i++) {
-            t = ((i+1)%steal_count == 0) ? TrySteal() : q.PopFront();
-            onnxruntime::concurrency::SpinPause();
+          // With adaptive spinning, spin only if some other worker executed a
+          // task since the last time this worker ran dry.  If not, the pool is
+          // quiescing and we block immediately rather than burning a core on a
+          // full-length spin.
+          bool should_spin = spin_count > 0;
+          if (should_spin && adaptive_spinning_) {
+            const uint64_t remote_tasks =
+                num_tasks_executed_.load(std::memory_order_relaxed) - tasks_executed_locally;
+            should_spin = (remote_tasks != last_observed_remote_tasks);
+            last_observed_remote_tasks = remote_tasks;
+          }
+
+          if (should_spin) {
+            SetGoodWorkerHint(thread_id, true);
+            // Spin with exponential backoff: initially re-check for work after
+            // every pause instruction, then in progressively larger batches so
+            // that a long spin issues fewer loads and leaves more of the core
+            // to a hyperthread peer.
+            uint64_t next_steal = steal_count;
+            uint64_t pause_batch = 1;
+            for (uint64_t i = 0; i < spin_count && !t && !cancelled_ && !done_; i += pause_batch) {
+              t = PopHighPriority();
+              if (!t) {
+                if (steal_count != 0 && i >= next_steal) {
+                  t = TrySteal();
+                  next_steal += steal_count;
+                } else {
+                  t = q.PopFront();
+                }
+              }
+              for (uint64_t p = 0; p < pause_batch; p++) {
+                onnxruntime::concurrency::SpinPause();
+              }
+              if (pause_batch < 64) {
+                pause_batch *= 2;
+              }
+            }
+            SetGoodWorkerHint(thread_id, false);
           }
-          SetGoodWorkerHint(thread_id, false);
 
           if (!t) {
             // No work passed to us while spinning; make a further full attempt to
@@ -1213,17 +1417,27 @@ int CurrentThreadId() const EIGEN_FINAL {
               t = Steal(true /* true => check all queues */);
             }
             if (!t) {
+              std::chrono::steady_clock::time_point park_start;
               td.SetBlocked(
                   // Pre-block test
                   [&]() -> bool {
                     bool should_block = true;
                     // We already did a best-effort emptiness check when stealing; now
-                    // do a full check prior to blocking.
-                    int victim = NonEmptyQueueIndex();
-                    if (victim != -1) {
+                    // do a full check prior to blocking.  High-priority work is
+                    // checked first so that it cannot be left behind by a worker
+                    // on the way to blocking.
+                    if (!cancelled_) {
+                      t = PopHighPriority();
+                    }
+                    if (t) {
                       should_block = false;
-                      if (!cancelled_) {
-                        t = worker_data_[victim].queue.PopBack();
+                    } else {
+                      int victim = NonEmptyQueueIndex();
+                      if (victim != -1) {
+                        should_block = false;
+                        if (!cancelled_) {
+                          t = worker_data_[victim].queue.PopBack();
+                        }
                       }
                     }
                     // Number of blocked threads is used as termination condition.
@@ -1238,7 +1452,8 @@ int CurrentThreadId() const EIGEN_FINAL {
                         // right after incrementing blocked_ above. Now a free-standing thread
                         // submits work and calls destructor (which sets done_). If we don't
                         // re-check queues, we will exit leaving the work unexecuted.
-                        if (NonEmptyQueueIndex() != -1) {
+                        if (NonEmptyQueueIndex() != -1 ||
+                            num_high_priority_tasks_.load(std::memory_order_acquire) != 0) {
                           // Note: we must not pop from queues before we decrement blocked_,
                           // otherwise the following scenario is possible. Consider that instead
                           // of checking for emptiness we popped the only element from queues.
@@ -1251,11 +1466,20 @@ int CurrentThreadId() const EIGEN_FINAL {
                         }
                       }
                     }
+                    if (should_block) {
+                      park_start = std::chrono::steady_clock::now();
+                    }
                     return should_block;
                   },
                   // Post-block update (executed only if we blocked)
                   [&]() {
                     blocked_--;
+                    num_parks_.fetch_add(1, std::memory_order_relaxed);
+                    parked_time_us_.fetch_add(
+                        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                  std::chrono::steady_clock::now() - park_start)
+                                                  .count()),
+                        std::memory_order_relaxed);
                   });
             }
           }
@@ -1263,6 +1487,8 @@ int CurrentThreadId() const EIGEN_FINAL {
         if (t) {
           td.SetActive();
           t();
+          num_tasks_executed_.fetch_add(1, std::memory_order_relaxed);
+          tasks_executed_locally++;
           td.SetSpinning();
         }
       }
@@ -1301,6 +1527,7 @@ int CurrentThreadId() const EIGEN_FINAL {
             worker_data_[victim].GetStatus() == WorkerData::ThreadStatus::Active) {
           Task t = worker_data_[victim].queue.PopBack();
           if (t) {
+            num_tasks_stolen_.fetch_add(1, std::memory_order_relaxed);
             return t;
           }
         }
@@ -16,6 +16,7 @@ limitations under the License.
 /* Modifications Copyright (c) Microsoft. */
 
 #pragma once
+#include <atomic>
 #include <string>
 #include <vector>
 #include <functional>
@@ -137,6 +138,30 @@ class ExtendedThreadPoolInterface;
 class LoopCounter;
 class ThreadPoolParallelSection;
 
+// Priority of tasks submitted via ThreadPool::Schedule.  High-priority tasks
+// run ahead of any queued normal-priority tasks, letting latency-critical
+// work (e.g. an interactive inference session) preempt a backlog of bulk work
+// on a shared pool.  Tasks that have already started are never interrupted.
+enum class TaskPriority {
+  kNormal = 0,
+  kHigh = 1,
+};
+
+// Cumulative activity counters for a thread pool.  The counters are collected
+// with relaxed atomic updates on the hot paths, so a snapshot is approximate;
+// the intended use is computing deltas around a region of interest (a kernel,
+// a Run() call) to see how well the region filled the pool.
+struct ThreadPoolStats {
+  int num_threads{0};                // Threads created by the pool
+  int num_queued_tasks{0};           // Tasks waiting in the queues right now
+  uint64_t num_tasks_executed{0};    // Tasks run by workers or helping threads
+  uint64_t num_tasks_stolen{0};      // Tasks taken from another worker's queue
+  uint64_t num_parks{0};             // Times a worker blocked waiting for work
+  uint64_t parked_time_us{0};        // Total time workers spent blocked
+  uint64_t num_parallel_regions{0};  // Parallel loops/sections dispatched
+  uint64_t region_degree_sum{0};     // Sum of per-region degrees of parallelism
+};
+
 class ThreadPool {
  public:
 #ifdef _WIN32
@@ -235,6 +260,18 @@ class ThreadPool {
     }
   }
 
+  // As above, with an explicit priority.  High-priority tasks are dispatched
+  // ahead of any queued normal-priority tasks.
+  static void Schedule(ThreadPool* tp,
+                       std::function<void()> fn,
+                       TaskPriority priority) {
+    if (tp) {
+      tp->Schedule(std::move(fn), priority);
+    } else {
+      fn();
+    }
+  }
+
   // ParallelFor shards the "total" units of work assuming each unit of work
   // having roughly "cost_per_unit" cost, in cycles. Each unit of work is
   // indexed 0, 1, ..., total - 1. Each shard contains 1 or more units of work
@@ -378,6 +415,44 @@ class ThreadPool {
   // working in combination with the thread initiating the loop.
   static int DegreeOfParallelism(const ThreadPool* tp);
 
+  // Scoped cap on the degree of parallelism of parallel loops started from
+  // the current thread.  Used to limit how many intra-op threads a single
+  // Run may enlist on a shared pool: while an instance is alive, loops
+  // started from this thread use at most 'limit' threads, including the
+  // thread initiating the loop.  A limit of 0 means no cap.  The previous
+  // value is restored on destruction.  Note that the limit applies to loops
+  // initiated from the thread that installed it; it is not inherited by
+  // pool workers running the loop's shards.
+  class DegreeOfParallelismLimit {
+   public:
+    explicit DegreeOfParallelismLimit(int limit);
+    ~DegreeOfParallelismLimit();
+
+   private:
+    int previous_limit_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(DegreeOfParallelismLimit);
+  };
+
+  // Returns the number of tasks currently waiting in the pool's queues, or 0 when
+  // tp is nullptr.  The count is approximate and intended for monitoring rather
+  // than synchronization.
+  static int NumQueuedTasks(const ThreadPool* tp);
+
+  // Attempt to run one task queued in the pool on the calling thread,
+  // returning true if a task was run.  Returns false if no task is pending
+  // or tp is nullptr.  Intended for threads that must wait for pool work to
+  // complete: helping with queued work keeps nested waiting (such as
+  // control-flow kernels executing subgraphs) progressing instead of
+  // stranding a thread per nesting level.
+  static bool TryRunPendingTask(ThreadPool* tp);
+
+  // Fill stats with a snapshot of the pool's cumulative activity counters,
+  // or with zeroes when tp is nullptr.  Deltas between two snapshots show
+  // how busy the pool was during the interval; in particular,
+  // region_degree_sum / num_parallel_regions below the pool size indicates
+  // parallel loops that underfill the pool.
+  static void GetStats(const ThreadPool* tp, ThreadPoolStats& stats);
+
   ORT_DISALLOW_COPY_AND_ASSIGNMENT(ThreadPool);
 
  private:
@@ -425,6 +500,25 @@ class ThreadPool {
 
   void Schedule(std::function<void()> fn);
 
+  void Schedule(std::function<void()> fn, TaskPriority priority);
+
+  // Measure the round-trip cost of running a trivial loop through the pool.
+  // Called once from the constructor; the result feeds into the decision of
+  // whether a loop is cheap enough to run inline in the caller.
+  void MeasureDispatchOverhead();
+
+  // Estimated wall-clock cost, in nanoseconds, of fanning a loop out to the
+  // pool and synchronizing on its completion.  Sampled at pool creation by
+  // MeasureDispatchOverhead.  The default is a typical cost for waking a
+  // blocked worker, and is used if no measurement has been taken.
+  double dispatch_overhead_ns_ = 1000.0;
+
+  // Counters for parallel regions dispatched through RunInParallel, kept at
+  // this level (rather than in the underlying pool) because the degree of
+  // parallelism requested for a loop is only known here.
+  std::atomic<uint64_t> num_parallel_regions_{0};
+  std::atomic<uint64_t> region_degree_sum_{0};
+
   ThreadOptions thread_options_;
 
   // If a thread pool is created with degree_of_parallelism != 1 then an underlying
@@ -5,14 +5,21 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include "core/common/common.h"
 #include "core/common/status.h"
+#include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
 #include "core/common/logging/logging.h"
 #include "core/framework/allocator.h"
 
 struct OrtThreadingOptions;
 namespace onnxruntime {
+class PrepackedWeightsContainer;
+namespace session_state_utils {
+struct InitializerDedupCache;
+}
 /** TODO: remove this class
    Provides the runtime environment for onnxruntime.
    Create one instance for the duration of execution.
@@ -74,6 +81,38 @@ class Environment {
     return shared_allocators_;
   }
 
+  /**
+   * Returns the container of pre-packed weights shared between the sessions created from this env.
+   * Sessions only use it if kOrtSessionOptionsConfigUseEnvPrepackedWeightsCache is enabled.
+  */
+  PrepackedWeightsContainer& GetPrepackedWeightsContainer() const {
+    return *prepacked_weights_container_;
+  }
+
+  /**
+   * Returns the cache of deserialized initializers shared between the sessions created from this env.
+   * Sessions only use it if kOrtSessionOptionsConfigUseEnvInitializerDedupCache is enabled.
+  */
+  session_state_utils::InitializerDedupCache& GetInitializerDedupCache() const {
+    return *initializer_dedup_cache_;
+  }
+
+  /**
+   * Returns the named model group cache of deserialized initializers, creating it on first use.
+   * Sessions select a group via kOrtSessionOptionsConfigInitializerDedupGroup so that e.g. the
+   * fine-tuned variants of one base model share their byte-identical backbone weights without
+   * mixing with an unrelated model family served from the same env.
+  */
+  session_state_utils::InitializerDedupCache& GetInitializerDedupCache(const std::string& group_name) const;
+
+  /**
+   * Drops a named model group cache. The shared weight buffers are freed once every session
+   * still referencing them has been released. No-op if the group does not exist.
+  */
+  void ReleaseInitializerDedupCacheGroup(const std::string& group_name);
+
+  ~Environment();
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Environment);
 
@@ -87,5 +126,13 @@ class Environment {
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> inter_op_thread_pool_;
   bool create_global_thread_pools_{false};
   std::vector<AllocatorPtr> shared_allocators_;
+  std::unique_ptr<PrepackedWeightsContainer> prepacked_weights_container_;
+  std::unique_ptr<session_state_utils::InitializerDedupCache> initializer_dedup_cache_;
+
+  // named model group caches, created on demand; guarded by dedup_groups_mutex_ since
+  // sessions may initialize concurrently
+  mutable OrtMutex dedup_groups_mutex_;
+  mutable std::unordered_map<std::string, std::unique_ptr<session_state_utils::InitializerDedupCache>>
+      initializer_dedup_groups_;
 };
 }  // namespace onnxruntime
@@ -201,6 +201,36 @@ typedef void(ORT_API_CALL* OrtLoggingFunction)(
     void* param, OrtLoggingLevel severity, const char* category, const char* logid, const char* code_location,
     const char* message);
 
+// Callback invoked when an asynchronous Run started by RunAsync completes.
+// \param user_data the value passed to RunAsync
+// \param outputs the output values, in the order the output names were passed to RunAsync.
+//                Only valid if status is a nullptr (success)
+// \param num_outputs number of entries in outputs
+// \param status nullptr on success, otherwise a failure status that the callback must free with ReleaseStatus
+typedef void(ORT_API_CALL* RunAsyncCallbackFn)(void* user_data, OrtValue** outputs, size_t num_outputs,
+                                               OrtStatusPtr status);
+
+// Thread work loop function to be invoked on the thread created by OrtCustomCreateThreadFn.
+// The function blocks until the pool shuts the worker down, so the supplied thread is
+// occupied for the lifetime of the thread pool.
+typedef void (*OrtThreadWorkerFn)(void* ort_worker_fn_param);
+
+typedef const struct OrtCustomHandleType {
+  char __place_holder;
+}* OrtCustomThreadHandle;
+
+// Custom thread creation function. Must create a thread (or equivalent execution context in
+// the application's own scheduler) that invokes ort_thread_worker_fn(ort_worker_fn_param)
+// exactly once, and return a non-null handle identifying it.
+// \param ort_custom_thread_creation_options the value supplied via SetGlobalCustomThreadCreationOptions
+typedef OrtCustomThreadHandle (*OrtCustomCreateThreadFn)(void* ort_custom_thread_creation_options,
+                                                         OrtThreadWorkerFn ort_thread_worker_fn,
+                                                         void* ort_worker_fn_param);
+
+// Custom thread join function. Called once per handle when the owning thread pool shuts
+// down; must block until the worker function has returned and release the thread.
+typedef void (*OrtCustomJoinThreadFn)(OrtCustomThreadHandle ort_custom_thread_handle);
+
 // Set Graph optimization level.
 // Refer https://github.com/microsoft/onnxruntime/blob/master/docs/ONNX_Runtime_Graph_Optimizations.md
 // for in-depth undersrtanding of Graph Optimizations in ORT
@@ -281,6 +311,40 @@ typedef struct OrtOpenVINOProviderOptions {
   size_t num_of_threads;  // 0 uses default number of threads
 } OrtOpenVINOProviderOptions;
 
+// Number of log2-scaled latency buckets in OrtSessionMetrics::run_latency_hist.
+#define ORT_SESSION_METRICS_NUM_LATENCY_BUCKETS 24
+
+/// <summary>
+/// Snapshot of a session's always-on lightweight metrics, filled in by SessionGetMetrics.
+/// The counters are maintained with relaxed atomic updates on the Run() path, so taking a
+/// snapshot is cheap and does not interrupt concurrent runs, but individual fields may be
+/// mutually inconsistent by a few in-flight runs.
+/// </summary>
+typedef struct OrtSessionMetrics {
+  uint64_t total_runs;             // number of completed Run() calls since session creation
+  uint64_t total_run_duration_us;  // summed wall-clock duration (microseconds) of those calls
+  // run_latency_hist[i] counts completed runs whose duration was below 2^i microseconds
+  // and at least 2^(i-1) microseconds; the last bucket also counts everything larger.
+  uint64_t run_latency_hist[ORT_SESSION_METRICS_NUM_LATENCY_BUCKETS];
+  int32_t current_num_runs;             // Run() calls currently in flight
+  int32_t num_queued_tasks;             // tasks waiting in the session's intra-op thread pool queues
+  int64_t arena_bytes_in_use;           // bytes in use by the CPU arena allocator; -1 when no arena is used
+  int64_t arena_total_allocated_bytes;  // bytes the CPU arena has reserved from the system; -1 when no arena is used
+  // Arena free-space fragmentation: a small arena_largest_free_block_bytes relative to
+  // arena_total_free_bytes means free memory is split into chunks too small to serve a
+  // large request, so the arena will keep growing. -1 when no arena is used.
+  int64_t arena_total_free_bytes;
+  int64_t arena_largest_free_block_bytes;
+  // Cumulative number of times the arena grew by reserving a new region; sample periodic
+  // snapshots to derive an extension rate. -1 when no arena is used.
+  int64_t arena_num_extensions;
+  // Cumulative memory-pattern cache outcomes: hits are Runs that found a cached allocation
+  // pattern for their input shapes, misses had to generate one or fall back to individual
+  // allocations. Both 0 when memory patterns are disabled.
+  uint64_t mem_pattern_hits;
+  uint64_t mem_pattern_misses;
+} OrtSessionMetrics;
+
 struct OrtApi;
 typedef struct OrtApi OrtApi;
 
@@ -1134,6 +1198,118 @@ struct OrtApi {
                   int max_dead_bytes_per_chunk, _Outptr_ OrtArenaCfg** out);
 
   ORT_CLASS_RELEASE(ArenaCfg);
+
+  /**
+  * Run the model asynchronously on the session's thread pool and invoke run_async_callback when it completes.
+  * The parameters are the same as Run, and all of the arrays passed in (input names, inputs, output names and
+  * outputs) must remain valid until the callback is invoked.
+  * The inter-op thread pool is used when the session has one (parallel execution mode, or global thread pools
+  * created with inter-op threads). Otherwise the intra-op thread pool is used and must have more than one thread.
+  * \param run_async_callback callback invoked when the run completes, possibly on a different thread
+  * \param user_data opaque value passed through to run_async_callback
+  */
+  ORT_API2_STATUS(RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** output,
+                  _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
+
+  /**
+  * Snapshot the session's always-on lightweight metrics: run counts, a log2-scaled latency
+  * histogram, CPU arena usage and intra-op thread pool queue depth. Unlike profiling these
+  * are maintained unconditionally with relaxed atomic updates, so this can be polled from a
+  * monitoring thread in production without measurable overhead on Run().
+  * \param metrics filled in by the call
+  */
+  ORT_API2_STATUS(SessionGetMetrics, _In_ const OrtSession* sess, _Out_ OrtSessionMetrics* metrics);
+
+  /**
+  * Set a per-Run memory budget in bytes. While a Run using these options executes, the
+  * CPU arena fails allocations cleanly instead of growing past the budget, and a run
+  * whose cached memory pattern already plans a larger peak allocation is rejected before
+  * executing. A value of 0 (the default) removes the budget.
+  */
+  ORT_API2_STATUS(RunOptionsSetRunMemoryBudget, _Inout_ OrtRunOptions* options, size_t budget_bytes);
+
+  /**
+  * Use this API to configure the global thread pool options to be used in the call to CreateEnvWithGlobalThreadPools.
+  * Pin each thread of the intra-op thread pool to a fixed set of logical processors. affinity_masks[i] is a
+  * bitmask of the logical processors that the i-th thread may run on; a mask covering a physical core and its
+  * hyperthread sibling reserves the whole core for that thread, and a zero mask leaves it unrestricted.
+  * The array must hold one entry per thread created in the pool and must remain valid until the environment
+  * has been created. Pass nullptr and 0 to remove a previously configured affinity.
+  */
+  ORT_API2_STATUS(SetGlobalIntraOpThreadAffinity, _Inout_ OrtThreadingOptions* tp_options,
+                  _In_reads_opt_(num_masks) size_t* affinity_masks, size_t num_masks);
+
+  /**
+  * Cap the number of intra-op threads (including the calling thread) that parallel loops
+  * started by Runs using these options may use. Lets a scheduler give an interactive Run
+  * a few cores of a shared environment pool while a batch Run uses the rest. The limit
+  * applies to loops initiated by the Run; it does not shrink the pool itself.
+  * \param thread_limit 0 (the default) means no limit.
+  */
+  ORT_API2_STATUS(RunOptionsSetIntraOpThreadLimit, _Inout_ OrtRunOptions* options, int thread_limit);
+
+  /**
+  * Use these 2 APIs to supply a thread creation function and a matching join function, so the
+  * threads of the global thread pools are provided by the application's own scheduler instead
+  * of being created by onnxruntime. An application that already runs a thread per core can
+  * then host the pool workers on its existing threads (or fibers) and avoid oversubscription.
+  * Both functions must be set together, before the OrtEnv is created from the options; thread
+  * affinity settings are not applied to threads the application creates. The scheduling of
+  * tasks onto the supplied threads is unchanged.
+  */
+  ORT_API2_STATUS(SetGlobalCustomCreateThreadFn, _Inout_ OrtThreadingOptions* tp_options,
+                  _In_ OrtCustomCreateThreadFn ort_custom_create_thread_fn);
+
+  /**
+  * Set the value passed as ort_custom_thread_creation_options to the custom thread creation
+  * function supplied via SetGlobalCustomCreateThreadFn. The pointer must stay valid until the
+  * OrtEnv is created from the options.
+  */
+  ORT_API2_STATUS(SetGlobalCustomThreadCreationOptions, _Inout_ OrtThreadingOptions* tp_options,
+                  _In_opt_ void* ort_custom_thread_creation_options);
+
+  ORT_API2_STATUS(SetGlobalCustomJoinThreadFn, _Inout_ OrtThreadingOptions* tp_options,
+                  _In_ OrtCustomJoinThreadFn ort_custom_join_thread_fn);
+
+  /**
+  * Record the exact inputs of sampled Runs using these options into binary capture files
+  * named '<path_prefix>.<n>', for deterministic offline replay with
+  * 'onnxruntime_perf_test -R <capture_file>'. Every sample_ratio-th Run is recorded
+  * (a ratio of 0 or 1 records every Run). Only runs whose feeds are all CPU tensors of
+  * non-string types are recorded. Pass nullptr or "" to disable recording.
+  */
+  ORT_API2_STATUS(RunOptionsEnableRunCapture, _Inout_ OrtRunOptions* options,
+                  _In_opt_ const char* path_prefix, size_t sample_ratio);
+
+  /**
+  * Set the process-wide random seed used by operators with random behavior (dropout,
+  * random generators). Replaying a recorded Run with the seed stored in its capture
+  * reproduces the original run's random streams.
+  */
+  ORT_API2_STATUS(SetGlobalRandomSeed, int64_t seed);
+
+  /**
+  * Associate the Runs using these options with a generation sequence, enabling stateful
+  * incremental decoding: kernels that keep state between decode steps (currently the
+  * com.microsoft.Attention KV cache) append into buffers preallocated for max_length
+  * tokens and identified by sequence_id, instead of re-feeding growing past tensors
+  * each step. max_length is read on the first Run with a given sequence_id and fixed
+  * thereafter. Concurrent Runs must use distinct sequence ids. Pass nullptr or "" to
+  * return to stateless execution.
+  */
+  ORT_API2_STATUS(RunOptionsSetSequenceId, _Inout_ OrtRunOptions* options,
+                  _In_opt_ const char* sequence_id, size_t max_length);
+
+  /**
+  * Drop any state accumulated for the sequence id currently set on these options before
+  * the next Run executes, so the handle can be reused for a new sequence. The flag is
+  * cleared again by RunOptionsSetSequenceId.
+  */
+  ORT_API2_STATUS(RunOptionsResetSequence, _Inout_ OrtRunOptions* options);
 };
 
 /*
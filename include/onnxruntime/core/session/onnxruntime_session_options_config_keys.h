@@ -40,3 +40,136 @@ static const char* const kOrtSessionOptionsConfigSaveModelFormat = "session.save
 // Note that an alternative way not using this option at runtime is to train and export a model without denormals
 // and that's recommended because turning this option on may hurt model accuracy.
 static const char* const kOrtSessionOptionsConfigSetDenormalAsZero = "session.set_denormal_as_zero";
+
+// If the config value is set to "1", constant initializers that kernels pre-pack (e.g. MatMul weights packed via
+// MlasGemmPackB) are stored in a cache owned by the env and shared with the other sessions created from that env,
+// keyed by the op type and the initializer contents. N sessions over the same model then hold one packed copy of
+// each such weight instead of N. Has no effect when prepacking is disabled. The default is "0".
+static const char* const kOrtSessionOptionsConfigUseEnvPrepackedWeightsCache = "session.use_env_prepacked_weights_cache";
+
+// If the config value is set to "1" and an optimized model is saved in the ORT format, pre-packed weights that
+// kernels produced while the session initialized are stored in the file together with a fingerprint of the CPU
+// capabilities they were packed for. A session loading the file on a machine with the same capabilities skips
+// re-packing those weights; on any other machine the stored buffers are ignored and the kernels re-pack as usual.
+// Packed buffers are stored in addition to the original initializer data, so the file gets larger. Has no effect
+// when the optimized model is saved in the ONNX format or when prepacking is disabled. The default is "0".
+static const char* const kOrtSessionOptionsConfigSavePrepackedWeights = "session.save_prepacked_weights";
+
+// If the config value is set to "1", activations that cannot be placed via a cached memory pattern are carved out of
+// a per-Run bump-pointer scratch arena instead of being allocated individually, and the arena is released wholesale
+// when the Run ends. The arena is sized from the cached memory pattern groups, so the first Run (and any Run before a
+// pattern has been cached) is unaffected. The default is "0".
+static const char* const kOrtSessionOptionsConfigUsePerRunScratchArena = "session.use_per_run_scratch_arena";
+
+// Specifies a comma separated list of logical processor ids to pin the intra-op threads to, e.g. "0,1,8,9".
+// The i-th intra-op thread is pinned to the i-th processor id in the list, and the list length determines the
+// intra-op thread count when intra_op_num_threads is at its default of 0. With the processors of one NUMA node
+// listed, the threads and the memory they touch first stay on that node under the OS first-touch page placement
+// policy. The setting is ignored (with a warning) if it cannot be parsed, if intra_op_num_threads is set to a
+// different non-default value, or if an affinity was already provided programmatically. The default is "" (unset).
+static const char* const kOrtSessionOptionsConfigIntraOpThreadAffinities = "session.intra_op_thread_affinities";
+
+// If the config value is set to "1", activations on a non-CPU device whose next use in the execution plan is far
+// away are copied out to CPU memory once their last consumer before the gap has run, and copied back shortly
+// before the next consumer executes, trading copy bandwidth for device memory headroom. Only tensors that are
+// individually allocated qualify (no buffer reuse, no fences), so the option is most effective with
+// enable_mem_pattern disabled, where offloading an activation returns its buffer to the device arena. Has no
+// effect on CPU-only sessions or with the parallel executor. The default is "0".
+static const char* const kOrtSessionOptionsConfigEnableActivationOffload = "session.enable_activation_offload";
+
+// If the config value is set to "1", consecutive execution-plan steps that run independent lightweight CPU kernels
+// (cheap element-wise and tensor-manipulation ops with no data dependencies among them, no fences and no buffer
+// reuse between their outputs) are executed as sibling tasks in a single parallel region on the intra-op thread
+// pool instead of one at a time, amortizing dispatch overhead across the group. Each clustered kernel runs
+// single-threaded internally; unclustered nodes are unaffected. Only used by the sequential executor, and the
+// clustered fast path is skipped while profiling is enabled so per-node events keep their usual detail. It is
+// also skipped for a run placed on a cached memory pattern, whose buffer offsets assume the plan's sequential
+// lifetimes. The default is "0".
+static const char* const kOrtSessionOptionsConfigEnableNodeClustering = "session.enable_node_clustering";
+
+// If the config value is set to "1", the caller promises that every buffer fed to Run (directly or via IOBinding)
+// stays valid and is exclusively owned by the session until Run returns, and that its contents may be overwritten.
+// The allocation planner then treats graph input buffers like intermediate values: an in-place kernel that is the
+// sole consumer of an input writes its output straight into the caller's buffer, and an input buffer whose last
+// use has passed can be recycled for a later value of the same size, removing the copy otherwise paid on every
+// large feed. Do not set this when input buffers are shared across concurrent Run calls or read back after
+// inference. The default is "0".
+static const char* const kOrtSessionOptionsConfigAllowInputBufferReuse = "session.allow_input_buffer_reuse";
+
+// If the config value is set to "1", the default CPU execution provider backs its arena with a private mimalloc
+// heap instead of BFCArena. Each session gets its own heap, so sessions using either arena can be compared in the
+// same process, and closing the session releases the heap wholesale instead of freeing chunks one by one. Only
+// honored in builds compiled with USE_MIMALLOC_ARENA_ALLOCATOR; other builds log a warning and use BFCArena.
+// Has no effect when enable_cpu_mem_arena is false or when a CPU execution provider is registered explicitly.
+// The default is "0".
+static const char* const kOrtSessionOptionsConfigUseMimallocArena = "session.use_mimalloc_arena";
+
+// Constant initializers that are byte-identical (same contents, data type, shape and planned memory location) are
+// loaded once and shared across the main graph and all subgraphs, so control flow models that export a copy of the
+// same weight into every If/Loop branch hold one buffer per distinct weight instead of one per copy. If the config
+// value is set to "1" this deduplication is disabled and every initializer keeps its own buffer. The default is "0".
+static const char* const kOrtSessionOptionsConfigDisableInitializerDedup = "session.disable_initializer_dedup";
+
+// If the config value is set to "1", the initializer deduplication above operates on a cache owned by the env and
+// shared with the other sessions created from that env, so N sessions over the same model (e.g. several replicas
+// served from one GPU) hold one copy of each distinct weight per memory location instead of N. Only constant
+// initializers participate and the shared buffers are treated as read only. Entries are kept for the lifetime of
+// the env, so the weights of a model stay resident after its last session is released. Has no effect when
+// initializer deduplication is disabled. The default is "0".
+static const char* const kOrtSessionOptionsConfigUseEnvInitializerDedupCache = "session.use_env_initializer_dedup_cache";
+
+// Names the model group whose env owned initializer cache this session shares. Sessions with the same group name
+// deduplicate their byte-identical initializers against each other - e.g. fine-tuned variants of one base model
+// share their frozen backbone weights while unrelated model families served from the same env stay isolated. The
+// group cache is created on first use and kept until Environment::ReleaseInitializerDedupCacheGroup is called for
+// it; already loaded sessions keep their weights alive after the release. Only read when
+// kOrtSessionOptionsConfigUseEnvInitializerDedupCache is "1"; when unset those sessions share the env default
+// cache. The default is "" (the env default cache).
+static const char* const kOrtSessionOptionsConfigInitializerDedupGroup = "session.initializer_dedup_group";
+
+// If the config value is set to "1", the CUDA execution provider captures the device work of one Run into a CUDA
+// graph and replays that graph on subsequent Runs with a single launch, removing the per-node launch overhead that
+// dominates small-kernel models. The first Run executes per-node so allocations and cudnn algorithm choices settle;
+// the second Run is captured; later Runs replay. Requires the CUDA execution provider (session initialization fails
+// otherwise), a model with static shapes, and do_copy_in_default_stream=true. Feed and fetch buffers must stay at
+// the same addresses across Runs - bind preallocated CUDA buffers via IOBinding - and Runs on the session must not
+// overlap, since the replayed graph reads and writes the captured addresses. The default is "0".
+static const char* const kOrtSessionOptionsConfigEnableCudaGraphCapture = "session.enable_cuda_graph_capture";
+
+// If the config value is set to "high", tasks that this session submits to the inter-op thread pool (the per-node
+// tasks of the parallel executor) are dispatched ahead of queued normal-priority tasks. When a latency-critical
+// session shares the environment's inter-op pool with bulk-scoring sessions, its Runs then jump the backlog those
+// sessions have queued instead of waiting behind it. Tasks that have already started are not interrupted. Only
+// meaningful with parallel execution mode and a shared inter-op pool. Valid values are "normal" and "high".
+// The default is "normal".
+static const char* const kOrtSessionOptionsConfigInterOpTaskPriority = "session.inter_op_task_priority";
+
+// Path of a file used to persist per-node kernel timings across sessions. When set, the durations of every
+// kernel execution are accumulated (keyed by node and input shapes) and written to the file when the session
+// is destroyed. Timings found in the file at session creation seed a per-node cost model that the parallel
+// executor uses to schedule the critical path of the graph first instead of treating all ready nodes equally.
+// The first session against a fresh path measures but runs with cost-unaware scheduling; later sessions
+// benefit from the recorded profile. The timings include a small capture overhead per node. Unset by default.
+static const char* const kOrtSessionOptionsConfigNodeTimingCachePath = "session.node_timing_cache_path";
+
+// Path of a file the session writes its allocation and execution plan to (as JSON) during initialization.
+// The dump records each value's allocation kind, buffer reuse decisions, lifetime intervals and the node
+// execution order, and can be rendered with tools/python/visualize_allocation_plan.py to verify a model
+// change didn't regress buffer reuse. Only meaningful with sequential execution mode, which is the only
+// mode that plans buffer reuse. Unset by default.
+static const char* const kOrtSessionOptionsConfigAllocationPlanDumpPath = "session.allocation_plan_dump_path";
+
+// "1": the session retains the output tensors of each Run and reuses their allocations for the next Run
+// with the same input shapes, which is the common case for a server in steady state. Runs with new shapes
+// allocate as usual. Retained outputs stay valid until the next Run with the same input shapes overwrites
+// them, so callers that need a fetch beyond that point must copy it. Has no effect on Runs that pass
+// pre-allocated fetches or use IOBinding. Default is "0" (each Run allocates its outputs fresh).
+static const char* const kOrtSessionOptionsConfigRetainOutputs = "session.retain_outputs";
+
+// "1": enables the allocation audit and makes Run() fail if a steady-state Run performs an allocation
+// through the CPU allocator seam (direct CPUAllocator use or an arena extension; requests served from
+// the arena's existing chunks don't count). The first two Runs are exempt as they legitimately grow the
+// arena and establish memory patterns. Allocations are attributed to the triggering node in INFO-level
+// log messages. The underlying counter is process wide, so this is meant for tests that run a single
+// session at a time and want to catch kernels regressing to per-Run allocation. Default is "0".
+static const char* const kOrtSessionOptionsConfigAssertAllocationFreeRuns = "session.assert_allocation_free_runs";
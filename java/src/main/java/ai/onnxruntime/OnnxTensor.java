@@ -141,6 +141,27 @@ public class OnnxTensor implements OnnxValue {
     }
   }
 
+  /**
+   * Returns a direct ByteBuffer view of the underlying OnnxTensor's memory, without copying.
+   *
+   * <p>The buffer aliases the tensor's native memory: it is only valid until this tensor is closed,
+   * and writes through the buffer are visible to the runtime. If the tensor was created from a
+   * direct buffer this returns a view over that same memory. Use {@link #getByteBuffer()} if you
+   * need a copy that outlives the tensor.
+   *
+   * <p>This method returns null if the OnnxTensor contains Strings as they are stored externally to
+   * the OnnxTensor.
+   *
+   * @return A ByteBuffer view of the OnnxTensor's memory in native byte order.
+   */
+  public ByteBuffer getBufferRef() {
+    if (info.type != OnnxJavaType.STRING) {
+      return getBuffer();
+    } else {
+      return null;
+    }
+  }
+
   /**
    * Returns a copy of the underlying OnnxTensor as a FloatBuffer if it can be losslessly converted
    * into a float (i.e. it's a float or fp16), otherwise it returns null.
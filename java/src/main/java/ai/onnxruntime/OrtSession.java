@@ -302,6 +302,97 @@ public class OrtSession implements AutoCloseable {
     }
   }
 
+  /**
+   * Scores an input feed dict, writing the outputs into the supplied pre-allocated tensors.
+   *
+   * <p>Unlike {@link #run(Map)} this does not allocate output tensors: the runtime writes each
+   * output directly into the memory of the matching tensor in {@code pinnedOutputs}. When those
+   * tensors were created from direct buffers (e.g. {@link
+   * OnnxTensor#createTensor(OrtEnvironment,java.nio.ByteBuffer,long[],OnnxJavaType)}) the results
+   * land in the caller's buffers with no boundary copy; read them back via {@link
+   * OnnxTensor#getBufferRef()}. Each pinned tensor must have the shape and type the model produces
+   * for that output.
+   *
+   * @param inputs The inputs to score.
+   * @param pinnedOutputs A map from output name to the pre-allocated tensor to write it into.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if there are zero or too many inputs or outputs.
+   */
+  public void run(Map<String, OnnxTensor> inputs, Map<String, OnnxTensor> pinnedOutputs)
+      throws OrtException {
+    run(inputs, pinnedOutputs, null);
+  }
+
+  /**
+   * Scores an input feed dict, writing the outputs into the supplied pre-allocated tensors.
+   *
+   * <p>See {@link #run(Map,Map)} for the pinned output semantics.
+   *
+   * @param inputs The inputs to score.
+   * @param pinnedOutputs A map from output name to the pre-allocated tensor to write it into.
+   * @param runOptions The RunOptions to control this run.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if there are zero or too many inputs or outputs.
+   */
+  public void run(
+      Map<String, OnnxTensor> inputs, Map<String, OnnxTensor> pinnedOutputs, RunOptions runOptions)
+      throws OrtException {
+    if (!closed) {
+      if (inputs.isEmpty() || (inputs.size() > numInputs)) {
+        throw new OrtException(
+            "Unexpected number of inputs, expected [1," + numInputs + ") found " + inputs.size());
+      }
+      if (pinnedOutputs.isEmpty() || (pinnedOutputs.size() > numOutputs)) {
+        throw new OrtException(
+            "Unexpected number of pinnedOutputs, expected [1,"
+                + numOutputs
+                + ") found "
+                + pinnedOutputs.size());
+      }
+      String[] inputNamesArray = new String[inputs.size()];
+      long[] inputHandles = new long[inputs.size()];
+      int i = 0;
+      for (Map.Entry<String, OnnxTensor> t : inputs.entrySet()) {
+        if (inputNames.contains(t.getKey())) {
+          inputNamesArray[i] = t.getKey();
+          inputHandles[i] = t.getValue().getNativeHandle();
+          i++;
+        } else {
+          throw new OrtException(
+              "Unknown input name " + t.getKey() + ", expected one of " + inputNames.toString());
+        }
+      }
+      String[] outputNamesArray = new String[pinnedOutputs.size()];
+      long[] outputHandles = new long[pinnedOutputs.size()];
+      i = 0;
+      for (Map.Entry<String, OnnxTensor> t : pinnedOutputs.entrySet()) {
+        if (outputNames.contains(t.getKey())) {
+          outputNamesArray[i] = t.getKey();
+          outputHandles[i] = t.getValue().getNativeHandle();
+          i++;
+        } else {
+          throw new OrtException(
+              "Unknown output name " + t.getKey() + ", expected one of " + outputNames.toString());
+        }
+      }
+      long runOptionsHandle = runOptions == null ? 0 : runOptions.nativeHandle;
+
+      runWithPinnedOutputs(
+          OnnxRuntime.ortApiHandle,
+          nativeHandle,
+          allocator.handle,
+          inputNamesArray,
+          inputHandles,
+          inputNamesArray.length,
+          outputNamesArray,
+          outputHandles,
+          outputNamesArray.length,
+          runOptionsHandle);
+    } else {
+      throw new IllegalStateException("Trying to score a closed OrtSession.");
+    }
+  }
+
   /**
    * Gets the metadata for the currently loaded model.
    *
@@ -424,6 +515,35 @@ public class OrtSession implements AutoCloseable {
       long runOptionsHandle)
       throws OrtException;
 
+  /**
+   * The native run call writing into pre-allocated output tensors. runOptionsHandle can be zero
+   * (i.e. the null pointer), but all other handles must be valid pointers.
+   *
+   * @param apiHandle The pointer to the api.
+   * @param nativeHandle The pointer to the session.
+   * @param allocatorHandle The pointer to the allocator.
+   * @param inputNamesArray The input names.
+   * @param inputs The input tensors.
+   * @param numInputs The number of inputs.
+   * @param outputNamesArray The requested output names.
+   * @param outputs The pre-allocated output tensors to write into.
+   * @param numOutputs The number of requested outputs.
+   * @param runOptionsHandle The (possibly null) pointer to the run options.
+   * @throws OrtException If the native call failed in some way.
+   */
+  private native void runWithPinnedOutputs(
+      long apiHandle,
+      long nativeHandle,
+      long allocatorHandle,
+      String[] inputNamesArray,
+      long[] inputs,
+      long numInputs,
+      String[] outputNamesArray,
+      long[] outputs,
+      long numOutputs,
+      long runOptionsHandle)
+      throws OrtException;
+
   private native long getProfilingStartTimeInNs(long apiHandle, long nativeHandle)
       throws OrtException;
 
@@ -19,6 +19,14 @@ export declare namespace Binding {
 
     run(feeds: InferenceSession.FeedsType, fetches: InferenceSession.FetchesType,
         options: InferenceSession.RunOptions): InferenceSession.ReturnType;
+
+    /**
+     * Run the model on the libuv worker pool without blocking the event loop. The returned
+     * tensors' data aliases native memory owned by the runtime and is released when the
+     * backing ArrayBuffers are garbage collected.
+     */
+    runAsync(feeds: InferenceSession.FeedsType, fetches: InferenceSession.FetchesType,
+             options: InferenceSession.RunOptions): Promise<InferenceSession.ReturnType>;
   }
 
   export namespace InferenceSession {
@@ -109,21 +109,14 @@ class InferenceSession implements InferenceSessionInterface {
 
     // promise start here
     //
-    //
-    return new Promise((resolve, reject) => {
-      process.nextTick(() => {
-        try {
-          const returnValue: {[name: string]: OnnxValue} = {};
-          const results = this.#session.run(feeds, fetches, options);
-          for (const key in results) {
-            returnValue[key] = new Tensor(results[key].type, results[key].data, results[key].dims);
-          }
-          resolve(returnValue);
-        } catch (e) {
-          // reject if any error is thrown
-          reject(e);
-        }
-      });
+    // the native runAsync call executes on the libuv worker pool, so the event loop is free
+    // while the model runs; the resolved tensors alias native output memory without a copy.
+    return this.#session.runAsync(feeds, fetches, options).then(results => {
+      const returnValue: {[name: string]: OnnxValue} = {};
+      for (const key in results) {
+        returnValue[key] = new Tensor(results[key].type, results[key].data, results[key].dims);
+      }
+      return returnValue;
     });
   }
 
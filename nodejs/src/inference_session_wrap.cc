@@ -28,6 +28,7 @@ Napi::Object InferenceSessionWrap::Init(Napi::Env env, Napi::Object exports) {
   Napi::Function func = DefineClass(
       env, "InferenceSession",
       {InstanceMethod("loadModel", &InferenceSessionWrap::LoadModel), InstanceMethod("run", &InferenceSessionWrap::Run),
+       InstanceMethod("runAsync", &InferenceSessionWrap::RunAsync),
        InstanceAccessor("inputNames", &InferenceSessionWrap::GetInputNames, nullptr, napi_default, nullptr),
        InstanceAccessor("outputNames", &InferenceSessionWrap::GetOutputNames, nullptr, napi_default, nullptr)});
 
@@ -188,7 +189,7 @@ Napi::Value InferenceSessionWrap::Run(const Napi::CallbackInfo &info) {
     Napi::Object result = Napi::Object::New(env);
 
     for (size_t i = 0; i < outputIndex; i++) {
-      result.Set(outputNames_[i], OrtValueToNapiValue(env, outputValues[i]));
+      result.Set(outputNames_cstr[i], OrtValueToNapiValueExternal(env, std::move(outputValues[i])));
     }
 
     return scope.Escape(result);
@@ -198,3 +199,128 @@ Napi::Value InferenceSessionWrap::Run(const Napi::CallbackInfo &info) {
     ORT_NAPI_THROW_ERROR(env, e.what());
   }
 }
+
+namespace {
+
+// Executes Session::Run on the libuv worker pool so the event loop is not blocked. The session
+// is shared: Ort::Session::Run is thread safe, so any number of workers may score concurrently
+// against the one session. Input Ort::Values alias the feed's typed array memory, so persistent
+// references keep the JS feed (and any pre-allocated fetches) alive until the run completes.
+class RunAsyncWorker : public Napi::AsyncWorker {
+public:
+  RunAsyncWorker(Napi::Env env, Napi::Object sessionObject, Ort::Session *session, Ort::RunOptions &&runOptions,
+                 Napi::Object feed, Napi::Object fetch, std::vector<std::string> &&inputNames,
+                 std::vector<Ort::Value> &&inputValues, std::vector<std::string> &&outputNames,
+                 std::vector<Ort::Value> &&outputValues)
+      : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)), session_(session),
+        runOptions_(std::move(runOptions)), sessionRef_(Napi::Persistent(sessionObject)),
+        feedRef_(Napi::Persistent(feed)), fetchRef_(Napi::Persistent(fetch)), inputNames_(std::move(inputNames)),
+        inputValues_(std::move(inputValues)), outputNames_(std::move(outputNames)),
+        outputValues_(std::move(outputValues)) {}
+
+  Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+  void Execute() override {
+    try {
+      std::vector<const char *> inputNames_cstr;
+      inputNames_cstr.reserve(inputNames_.size());
+      for (auto &name : inputNames_) {
+        inputNames_cstr.push_back(name.c_str());
+      }
+      std::vector<const char *> outputNames_cstr;
+      outputNames_cstr.reserve(outputNames_.size());
+      for (auto &name : outputNames_) {
+        outputNames_cstr.push_back(name.c_str());
+      }
+
+      session_->Run(runOptions_, inputNames_cstr.empty() ? nullptr : &inputNames_cstr[0],
+                    inputValues_.empty() ? nullptr : &inputValues_[0], inputValues_.size(),
+                    outputNames_cstr.empty() ? nullptr : &outputNames_cstr[0],
+                    outputValues_.empty() ? nullptr : &outputValues_[0], outputValues_.size());
+    } catch (std::exception const &e) {
+      SetError(e.what());
+    }
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+
+    Napi::Object result = Napi::Object::New(env);
+    for (size_t i = 0; i < outputNames_.size(); i++) {
+      result.Set(outputNames_[i], OrtValueToNapiValueExternal(env, std::move(outputValues_[i])));
+    }
+    deferred_.Resolve(result);
+  }
+
+  void OnError(const Napi::Error &e) override { deferred_.Reject(e.Value()); }
+
+private:
+  Napi::Promise::Deferred deferred_;
+  Ort::Session *session_;
+  Ort::RunOptions runOptions_;
+  Napi::ObjectReference sessionRef_;
+  Napi::ObjectReference feedRef_;
+  Napi::ObjectReference fetchRef_;
+  std::vector<std::string> inputNames_;
+  std::vector<Ort::Value> inputValues_;
+  std::vector<std::string> outputNames_;
+  std::vector<Ort::Value> outputValues_;
+};
+
+} // namespace
+
+Napi::Value InferenceSessionWrap::RunAsync(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  ORT_NAPI_THROW_ERROR_IF(!this->initialized_, env, "Session is not initialized.");
+  ORT_NAPI_THROW_TYPEERROR_IF(info.Length() < 2, env, "Expect argument: inputs(feed) and outputs(fetch).");
+  ORT_NAPI_THROW_TYPEERROR_IF(!info[0].IsObject() || !info[1].IsObject(), env,
+                              "Expect inputs(feed) and outputs(fetch) to be objects.");
+  ORT_NAPI_THROW_TYPEERROR_IF(info.Length() > 2 && (!info[2].IsObject() || info[2].IsNull()), env,
+                              "'runOptions' must be an object.");
+
+  Napi::EscapableHandleScope scope(env);
+
+  auto feed = info[0].As<Napi::Object>();
+  auto fetch = info[1].As<Napi::Object>();
+
+  std::vector<std::string> inputNames;
+  std::vector<Ort::Value> inputValues;
+  std::vector<std::string> outputNames;
+  std::vector<Ort::Value> outputValues;
+
+  try {
+    // all JS value access happens here on the event loop thread; the worker thread only
+    // touches native memory.
+    for (auto &name : inputNames_) {
+      if (feed.Has(name)) {
+        inputNames.push_back(name);
+        auto value = feed.Get(name);
+        inputValues.push_back(NapiValueToOrtValue(env, value));
+      }
+    }
+    for (auto &name : outputNames_) {
+      if (fetch.Has(name)) {
+        outputNames.push_back(name);
+        auto value = fetch.Get(name);
+        outputValues.emplace_back(value.IsNull() ? Ort::Value{nullptr} : NapiValueToOrtValue(env, value));
+      }
+    }
+
+    Ort::RunOptions runOptions{};
+    if (info.Length() > 2) {
+      ParseRunOptions(info[2].As<Napi::Object>(), runOptions);
+    }
+
+    auto *worker = new RunAsyncWorker(env, info.This().As<Napi::Object>(), session_.get(), std::move(runOptions), feed,
+                                      fetch, std::move(inputNames), std::move(inputValues), std::move(outputNames),
+                                      std::move(outputValues));
+    worker->Queue();
+    return scope.Escape(worker->GetPromise());
+  } catch (Napi::Error const &e) {
+    throw e;
+  } catch (std::exception const &e) {
+    ORT_NAPI_THROW_ERROR(env, e.what());
+  }
+}
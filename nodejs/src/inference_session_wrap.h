@@ -49,6 +49,17 @@ private:
    */
   Napi::Value Run(const Napi::CallbackInfo &info);
 
+  /**
+   * [async] run the model on the libuv worker pool without blocking the event loop.
+   * @param arg0 input object: all keys must present, value is object
+   * @param arg1 output object: at least one key must present, value can be null.
+   * @returns a Promise resolving to an object that every output specified will present.
+   *          Output tensor data aliases the native OrtValue memory (no copy); it is released
+   *          when the returned ArrayBuffers are garbage collected.
+   * @throw error if status code != 0
+   */
+  Napi::Value RunAsync(const Napi::CallbackInfo &info);
+
   // private members
 
   // persistent constructor
@@ -261,3 +261,65 @@ Napi::Value OrtValueToNapiValue(Napi::Env env, Ort::Value &value) {
 
   return scope.Escape(returnValue);
 }
+
+Napi::Value OrtValueToNapiValueExternal(Napi::Env env, Ort::Value &&value) {
+  Napi::EscapableHandleScope scope(env);
+
+  auto typeInfo = value.GetTypeInfo();
+  auto onnxType = typeInfo.GetONNXType();
+
+  ORT_NAPI_THROW_ERROR_IF(onnxType != ONNX_TYPE_TENSOR, env, "Non tensor type is temporarily not supported.");
+
+  auto tensorTypeAndShapeInfo = typeInfo.GetTensorTypeAndShapeInfo();
+  auto elemType = tensorTypeAndShapeInfo.GetElementType();
+
+  if (elemType == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+    // string tensors store their data out of line, so there is no memory to alias
+    return scope.Escape(OrtValueToNapiValue(env, value));
+  }
+
+  // type
+  auto typeCstr = DATA_TYPE_ID_TO_NAME_MAP[elemType];
+  ORT_NAPI_THROW_ERROR_IF(typeCstr == nullptr, env, "Tensor type (", elemType, ") is not supported.");
+
+  auto returnValue = Napi::Object::New(env);
+  returnValue.Set("type", Napi::String::New(env, typeCstr));
+
+  // dims
+  size_t dimsCount = tensorTypeAndShapeInfo.GetDimensionsCount();
+  std::vector<int64_t> dims;
+  if (dimsCount > 0) {
+    dims.resize(dimsCount);
+    tensorTypeAndShapeInfo.GetDimensions(&dims[0], dimsCount);
+  }
+  auto dimsArray = Napi::Array::New(env, dimsCount);
+  for (uint32_t i = 0; i < dimsCount; i++) {
+    dimsArray[i] = dims[i];
+  }
+  returnValue.Set("dims", dimsArray);
+
+  // size
+  auto size = tensorTypeAndShapeInfo.GetElementCount();
+  returnValue.Set("size", Napi::Number::From(env, size));
+
+  // data: an external ArrayBuffer over the OrtValue's memory. Ownership of the OrtValue moves
+  // into the finalizer, so the tensor memory stays valid exactly as long as JS can reach it.
+  size_t byteLength = size * DATA_TYPE_ELEMENT_SIZE_MAP[elemType];
+  Napi::ArrayBuffer arrayBuffer;
+  if (size > 0) {
+    void *data = value.GetTensorMutableData<void>();
+    auto *holder = new Ort::Value{std::move(value)};
+    arrayBuffer = Napi::ArrayBuffer::New(env, data, byteLength,
+                                         [](Napi::Env /*env*/, void * /*data*/, Ort::Value *hint) { delete hint; },
+                                         holder);
+  } else {
+    arrayBuffer = Napi::ArrayBuffer::New(env, 0);
+  }
+  napi_value typedArrayData;
+  napi_status status =
+      napi_create_typedarray(env, DATA_TYPE_TYPEDARRAY_MAP[elemType], size, arrayBuffer, 0, &typedArrayData);
+  NAPI_THROW_IF_FAILED(env, status, Napi::Value);
+  returnValue.Set("data", Napi::Value(env, typedArrayData));
+
+  return scope.Escape(returnValue);
+}
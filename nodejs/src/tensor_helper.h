@@ -13,3 +13,9 @@ Ort::Value NapiValueToOrtValue(Napi::Env env, Napi::Value value);
 
 // convert an OrtValue object to a Javascript OnnxValue object
 Napi::Value OrtValueToNapiValue(Napi::Env env, Ort::Value &value);
+
+// convert an OrtValue object to a Javascript OnnxValue object without copying the tensor data.
+// The returned object's data is a typed array over an external ArrayBuffer that aliases the
+// OrtValue's memory; the OrtValue is released by a finalizer when the ArrayBuffer is collected.
+// String tensors cannot alias native memory and fall back to the copying conversion.
+Napi::Value OrtValueToNapiValueExternal(Napi::Env env, Ort::Value &&value);
@@ -0,0 +1,536 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/beam_search.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include "core/framework/framework_common.h"
+#include "core/framework/op_kernel_context_internal.h"
+#include "core/framework/session_state.h"
+#include "core/framework/utils.h"
+#include "core/mlas/inc/mlas.h"
+
+using namespace onnxruntime::common;
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_KERNEL_EX(BeamSearch,
+                        kMSDomain,
+                        1,
+                        kCpuExecutionProvider,
+                        KernelDefBuilder()
+                            .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+                            .TypeConstraint("I", DataTypeImpl::GetTensorType<int32_t>())
+                            .TypeConstraint("V", DataTypeImpl::AllTensorTypes()),
+                        BeamSearch);
+
+struct BeamSearch::Info {
+  Info(const onnxruntime::Node& node, const GraphViewer& subgraph_in)
+      : subgraph(subgraph_in) {
+    num_state_vars = std::max(0, static_cast<int>(node.InputDefs().size()) - 4);
+    num_implicit_inputs = static_cast<int>(node.ImplicitInputDefs().size());
+
+    // tokens + state variables in, logits + state variables out
+    num_subgraph_inputs = 1 + num_state_vars;
+    num_subgraph_outputs = 1 + num_state_vars;
+
+    auto& subgraph_inputs = subgraph.GetInputs();
+    auto& subgraph_outputs = subgraph.GetOutputs();
+
+    ORT_ENFORCE(static_cast<size_t>(num_subgraph_inputs) == subgraph_inputs.size(),
+                "Graph in 'body' attribute of BeamSearch should have ", num_subgraph_inputs,
+                " inputs. Found:", subgraph_inputs.size());
+
+    ORT_ENFORCE(static_cast<size_t>(num_subgraph_outputs) == subgraph_outputs.size(),
+                "Graph in 'body' attribute of BeamSearch should have ", num_subgraph_outputs,
+                " outputs. Found:", subgraph_outputs.size());
+
+    subgraph_input_names.reserve(num_subgraph_inputs);
+    for (const auto* input : subgraph_inputs) {
+      subgraph_input_names.push_back(input->Name());
+    }
+
+    subgraph_output_names.reserve(num_subgraph_outputs);
+    for (const auto* output : subgraph_outputs) {
+      subgraph_output_names.push_back(output->Name());
+    }
+  }
+
+  const GraphViewer& subgraph;
+
+  int num_state_vars;
+  int num_implicit_inputs;
+  int num_subgraph_inputs;
+  int num_subgraph_outputs;
+
+  std::vector<std::string> subgraph_input_names;
+  std::vector<std::string> subgraph_output_names;
+};
+
+namespace {
+
+// runs the beam search decode loop for one Compute call
+class BeamSearchImpl {
+ public:
+  BeamSearchImpl(OpKernelContextInternal& context,
+                 const SessionState& session_state,
+                 const BeamSearch::Info& info,
+                 int32_t eos_token_id,
+                 int32_t pad_token_id);
+
+  // validates the inputs and sets up the feeds. save any loop dependent state in the impl
+  // rather than the kernel so BeamSearch::Compute can remain const and threadsafe.
+  Status Initialize();
+
+  Status Execute(const FeedsFetchesManager& ffm);
+
+ private:
+  // select the best num_beams continuations per batch entry from the step's log probabilities
+  void SelectBeams(const float* log_probs, int64_t vocab_size, int step);
+
+  // gather the rows of a state output along its first dimension to match the beams
+  // selected this step, producing the state feed for the next step
+  Status ReorderState(const OrtValue& src_value, OrtValue& dst_value) const;
+
+  Status WriteOutputs() const;
+
+  OpKernelContextInternal& context_;
+  const SessionState& session_state_;
+  const BeamSearch::Info& info_;
+
+  const int32_t eos_token_id_;
+  const int32_t pad_token_id_;
+
+  int64_t batch_size_ = 0;
+  int64_t num_beams_ = 0;
+  int64_t num_slots_ = 0;  // batch_size_ * num_beams_, the first dimension of all state tensors
+  int64_t max_length_ = 0;
+  float length_penalty_ = 1.f;
+
+  AllocatorPtr allocator_;
+
+  // the tokens selected in the last step, fed to the subgraph. reused across iterations.
+  OrtValue tokens_value_;
+  int32_t* tokens_data_ = nullptr;
+
+  // per slot decode state. the 'next' buffers are written during beam selection and
+  // swapped in afterwards as selection may reorder slots within a batch entry.
+  std::vector<float> beam_scores_;
+  std::vector<float> next_beam_scores_;
+  std::vector<char> beam_done_;
+  std::vector<char> next_beam_done_;
+  std::vector<int64_t> beam_lengths_;  // generated tokens per slot, used for the length penalty
+  std::vector<int64_t> next_beam_lengths_;
+  std::vector<int64_t> beam_origins_;  // slot each beam was continued from this step
+  std::vector<int32_t> sequences_;     // [num_slots, max_length] token history
+  std::vector<int32_t> next_sequences_;
+
+  int64_t cur_length_ = 0;  // valid entries per sequences_ row
+};
+
+BeamSearchImpl::BeamSearchImpl(OpKernelContextInternal& context,
+                               const SessionState& session_state,
+                               const BeamSearch::Info& info,
+                               int32_t eos_token_id,
+                               int32_t pad_token_id)
+    : context_{context},
+      session_state_{session_state},
+      info_{info},
+      eos_token_id_{eos_token_id},
+      pad_token_id_{pad_token_id} {
+}
+
+Status BeamSearchImpl::Initialize() {
+  auto status = Status::OK();
+
+  ORT_RETURN_IF_ERROR(context_.GetTempSpaceAllocator(&allocator_));
+
+  const auto* input_ids = context_.Input<Tensor>(0);
+  const auto& input_ids_shape = input_ids->Shape();
+  if (input_ids_shape.NumDimensions() != 2 || input_ids_shape[1] != 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "'input_ids' input must have shape {batch_size, 1}. Got:", input_ids_shape);
+  }
+
+  batch_size_ = input_ids_shape[0];
+
+  auto validate_scalar = [](const Tensor* tensor, const char* name) -> Status {
+    if (tensor->Shape().Size() != 1) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "'", name, "' input must be a scalar. Got shape:",
+                             tensor->Shape());
+    }
+    return Status::OK();
+  };
+
+  const auto* max_length_tensor = context_.Input<Tensor>(1);
+  ORT_RETURN_IF_ERROR(validate_scalar(max_length_tensor, "max_length"));
+  max_length_ = *max_length_tensor->Data<int32_t>();
+  ORT_RETURN_IF(max_length_ < 1, "'max_length' input must be >= 1. Got:", max_length_);
+
+  const auto* num_beams_tensor = context_.Input<Tensor>(2);
+  ORT_RETURN_IF_ERROR(validate_scalar(num_beams_tensor, "num_beams"));
+  num_beams_ = *num_beams_tensor->Data<int32_t>();
+  ORT_RETURN_IF(num_beams_ < 1, "'num_beams' input must be >= 1. Got:", num_beams_);
+
+  const auto* length_penalty_tensor = context_.Input<Tensor>(3);
+  if (length_penalty_tensor != nullptr) {
+    ORT_RETURN_IF_ERROR(validate_scalar(length_penalty_tensor, "length_penalty"));
+    length_penalty_ = *length_penalty_tensor->Data<float>();
+  }
+
+  num_slots_ = batch_size_ * num_beams_;
+
+  for (int i = 0; i < info_.num_state_vars; ++i) {
+    const auto& state_shape = context_.Input<Tensor>(i + 4)->Shape();
+    if (state_shape.NumDimensions() < 1 || state_shape[0] != num_slots_) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "State input ", i,
+                             " must have batch_size * num_beams (", num_slots_,
+                             ") as its first dimension. Got shape:", state_shape);
+    }
+  }
+
+  // the tokens feed is always created on CPU by this kernel and mutated between iterations
+  auto element_type = DataTypeImpl::GetType<int32_t>();
+  auto tokens_tensor = onnxruntime::make_unique<Tensor>(element_type, TensorShape({num_slots_, 1}), allocator_);
+  tokens_data_ = tokens_tensor->MutableData<int32_t>();
+
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  tokens_value_.Init(tokens_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+
+  beam_scores_.resize(num_slots_);
+  next_beam_scores_.resize(num_slots_);
+  beam_done_.assign(num_slots_, 0);
+  next_beam_done_.resize(num_slots_);
+  beam_lengths_.assign(num_slots_, 1);  // the start token counts towards the length penalty
+  next_beam_lengths_.resize(num_slots_);
+  beam_origins_.resize(num_slots_);
+  sequences_.assign(num_slots_ * max_length_, pad_token_id_);
+  next_sequences_.assign(num_slots_ * max_length_, pad_token_id_);
+
+  const auto* start_tokens = input_ids->Data<int32_t>();
+  for (int64_t slot = 0; slot < num_slots_; ++slot) {
+    const int32_t start_token = start_tokens[slot / num_beams_];
+    tokens_data_[slot] = start_token;
+    sequences_[slot * max_length_] = start_token;
+
+    // all beams of a batch entry start from the same token so the first step produces
+    // identical candidate rows. giving only beam 0 a viable score ensures the top
+    // num_beams candidates of that step are distinct tokens rather than duplicates.
+    beam_scores_[slot] = (slot % num_beams_ == 0) ? 0.f : std::numeric_limits<float>::lowest();
+  }
+
+  cur_length_ = 1;
+
+  return status;
+}
+
+void BeamSearchImpl::SelectBeams(const float* log_probs, int64_t vocab_size, int step) {
+  const float lowest = std::numeric_limits<float>::lowest();
+
+  std::vector<float> top_scores(num_beams_);
+  std::vector<int32_t> top_tokens(num_beams_);
+  std::vector<int64_t> top_origins(num_beams_);
+  std::vector<int64_t> order(num_beams_);
+
+  for (int64_t b = 0; b < batch_size_; ++b) {
+    std::fill(top_scores.begin(), top_scores.end(), lowest);
+    std::fill(top_tokens.begin(), top_tokens.end(), pad_token_id_);
+    std::fill(top_origins.begin(), top_origins.end(), b * num_beams_);
+
+    // keep the best num_beams candidates seen so far, replacing the current minimum.
+    // num_beams is small so a linear rescan of the minimum is cheaper than a heap.
+    int64_t min_idx = 0;
+    auto consider = [&](float score, int32_t token, int64_t origin) {
+      if (score <= top_scores[min_idx])
+        return;
+
+      top_scores[min_idx] = score;
+      top_tokens[min_idx] = token;
+      top_origins[min_idx] = origin;
+
+      for (int64_t j = 0; j < num_beams_; ++j) {
+        if (top_scores[j] < top_scores[min_idx])
+          min_idx = j;
+      }
+    };
+
+    for (int64_t beam = 0; beam < num_beams_; ++beam) {
+      const int64_t slot = b * num_beams_ + beam;
+
+      // a finished beam contributes a single candidate: itself, padded, with an
+      // unchanged score. it competes against the unfinished continuations.
+      if (beam_done_[slot]) {
+        consider(beam_scores_[slot], pad_token_id_, slot);
+        continue;
+      }
+
+      const float* row = log_probs + slot * vocab_size;
+      const float base_score = beam_scores_[slot];
+      for (int64_t v = 0; v < vocab_size; ++v) {
+        consider(base_score + row[v], static_cast<int32_t>(v), slot);
+      }
+    }
+
+    // order the survivors best first so beam 0 of each batch entry is always the leader
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&top_scores](int64_t lhs, int64_t rhs) { return top_scores[lhs] > top_scores[rhs]; });
+
+    for (int64_t j = 0; j < num_beams_; ++j) {
+      const int64_t slot = b * num_beams_ + j;
+      const int64_t origin = top_origins[order[j]];
+      const int32_t token = top_tokens[order[j]];
+
+      beam_origins_[slot] = origin;
+      next_beam_scores_[slot] = top_scores[order[j]];
+
+      const bool was_done = beam_done_[origin] != 0;
+      next_beam_done_[slot] = (was_done || token == eos_token_id_) ? 1 : 0;
+      next_beam_lengths_[slot] = beam_lengths_[origin] + (was_done ? 0 : 1);
+
+      std::copy_n(sequences_.begin() + origin * max_length_, step,
+                  next_sequences_.begin() + slot * max_length_);
+      next_sequences_[slot * max_length_ + step] = token;
+
+      tokens_data_[slot] = token;
+    }
+  }
+
+  beam_scores_.swap(next_beam_scores_);
+  beam_done_.swap(next_beam_done_);
+  beam_lengths_.swap(next_beam_lengths_);
+  sequences_.swap(next_sequences_);
+}
+
+Status BeamSearchImpl::ReorderState(const OrtValue& src_value, OrtValue& dst_value) const {
+  const auto& src = src_value.Get<Tensor>();
+  const auto& shape = src.Shape();
+
+  if (shape.NumDimensions() < 1 || shape[0] != num_slots_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                           "BeamSearch state outputs must have batch_size * num_beams (", num_slots_,
+                           ") as their first dimension. Got shape:", shape);
+  }
+
+  ORT_RETURN_IF(src.IsDataTypeString(), "BeamSearch does not support string state variables.");
+
+  auto dst_tensor = onnxruntime::make_unique<Tensor>(src.DataType(), shape, allocator_);
+
+  const size_t bytes_per_slot = src.SizeInBytes() / num_slots_;
+  const auto* src_data = static_cast<const uint8_t*>(src.DataRaw());
+  auto* dst_data = static_cast<uint8_t*>(dst_tensor->MutableDataRaw());
+
+  for (int64_t slot = 0; slot < num_slots_; ++slot) {
+    memcpy(dst_data + slot * bytes_per_slot, src_data + beam_origins_[slot] * bytes_per_slot, bytes_per_slot);
+  }
+
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  dst_value = OrtValue{dst_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc()};
+
+  return Status::OK();
+}
+
+Status BeamSearchImpl::WriteOutputs() const {
+  Tensor* sequences_out = context_.Output(0, {batch_size_, num_beams_, max_length_});
+  Tensor* scores_out = context_.Output(1, {batch_size_, num_beams_});
+
+  auto* sequences_data = sequences_out->MutableData<int32_t>();
+  auto* scores_data = scores_out != nullptr ? scores_out->MutableData<float>() : nullptr;
+
+  std::vector<float> penalized_scores(num_slots_);
+  for (int64_t slot = 0; slot < num_slots_; ++slot) {
+    penalized_scores[slot] = beam_scores_[slot] /
+                             std::pow(static_cast<float>(beam_lengths_[slot]), length_penalty_);
+  }
+
+  // beams are kept best-first per batch entry during decoding, but the length penalty
+  // can change their relative order so re-rank on the penalized scores.
+  std::vector<int64_t> order(num_beams_);
+  for (int64_t b = 0; b < batch_size_; ++b) {
+    std::iota(order.begin(), order.end(), b * num_beams_);
+    std::sort(order.begin(), order.end(),
+              [&penalized_scores](int64_t lhs, int64_t rhs) {
+                return penalized_scores[lhs] > penalized_scores[rhs];
+              });
+
+    for (int64_t j = 0; j < num_beams_; ++j) {
+      const int64_t slot = order[j];
+      auto* output_row = sequences_data + (b * num_beams_ + j) * max_length_;
+      std::copy_n(sequences_.begin() + slot * max_length_, cur_length_, output_row);
+      std::fill(output_row + cur_length_, output_row + max_length_, pad_token_id_);
+
+      if (scores_data != nullptr) {
+        scores_data[b * num_beams_ + j] = penalized_scores[slot];
+      }
+    }
+  }
+
+  return Status::OK();
+}
+
+Status BeamSearchImpl::Execute(const FeedsFetchesManager& ffm) {
+  auto status = Status::OK();
+
+  std::vector<OrtValue> feeds;
+  std::vector<OrtValue> fetches;
+
+  const auto& implicit_inputs = context_.GetImplicitInputs();
+  const auto num_implicit_inputs = implicit_inputs.size();
+
+  feeds.reserve(info_.num_subgraph_inputs + num_implicit_inputs);
+  feeds.push_back(tokens_value_);
+
+  for (int i = 0; i < info_.num_state_vars; ++i) {
+    feeds.push_back(*context_.GetInputMLValue(i + 4));
+  }
+
+  for (const auto* implicit_input : implicit_inputs) {
+    feeds.push_back(*implicit_input);
+  }
+
+  std::vector<float> log_probs;
+
+  for (int64_t step = 1; step < max_length_; ++step) {
+    fetches.clear();
+
+    ORT_RETURN_IF_ERROR(utils::ExecuteSubgraph(session_state_, ffm, feeds, fetches, {},
+                                               ExecutionMode::ORT_SEQUENTIAL, context_.GetTerminateFlag(),
+                                               context_.Logger()));
+
+    const auto& logits = fetches[0].Get<Tensor>();
+    const auto& logits_shape = logits.Shape();
+    if (logits_shape.NumDimensions() != 2 || logits_shape[0] != num_slots_) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                             "Subgraph logits output must have shape {batch_size * num_beams, vocab_size}. Got:",
+                             logits_shape);
+    }
+
+    const int64_t vocab_size = logits_shape[1];
+    ORT_RETURN_IF(vocab_size < num_beams_, "vocab_size (", vocab_size,
+                  ") must be >= num_beams (", num_beams_, ").");
+
+    log_probs.resize(logits_shape.Size());
+    MlasComputeSoftmax(logits.Data<float>(), log_probs.data(),
+                       static_cast<size_t>(num_slots_), static_cast<size_t>(vocab_size),
+                       /*LogSoftmax*/ true, context_.GetOperatorThreadPool());
+
+    SelectBeams(log_probs.data(), vocab_size, static_cast<int>(step));
+    cur_length_ = step + 1;
+
+    if (std::find(beam_done_.begin(), beam_done_.end(), 0) == beam_done_.end())
+      break;
+
+    if (step + 1 < max_length_) {
+      for (int i = 0; i < info_.num_state_vars; ++i) {
+        ORT_RETURN_IF_ERROR(ReorderState(fetches[i + 1], feeds[i + 1]));
+      }
+    }
+  }
+
+  ORT_RETURN_IF_ERROR(WriteOutputs());
+
+  return status;
+}
+
+}  // namespace
+
+BeamSearch::BeamSearch(const OpKernelInfo& info) : IControlFlowKernel(info) {
+  // make sure the attribute was present even though we don't need it here.
+  // The GraphProto is loaded as a Graph instance by main Graph::Resolve,
+  // and a SessionState instance for executing the subgraph is created by InferenceSession.
+  // This is available via Info().GetSubgraphSessionState("attribute_name") when Compute is called.
+  ONNX_NAMESPACE::GraphProto proto;
+  ORT_ENFORCE(info.GetAttr<ONNX_NAMESPACE::GraphProto>("body", &proto).IsOK());
+  ORT_IGNORE_RETURN_VALUE(proto);
+
+  int64_t value;
+  ORT_ENFORCE(info.GetAttr("eos_token_id", &value).IsOK());
+  eos_token_id_ = gsl::narrow<int32_t>(value);
+
+  ORT_ENFORCE(info.GetAttr("pad_token_id", &value).IsOK());
+  pad_token_id_ = gsl::narrow<int32_t>(value);
+}
+
+BeamSearch::~BeamSearch() = default;
+
+common::Status BeamSearch::SetupSubgraphExecutionInfo(const SessionState& session_state,
+                                                      const std::string& attribute_name,
+                                                      const SessionState& subgraph_session_state) {
+  ORT_ENFORCE(info_ == nullptr, "SetupSubgraphExecutionInfo should only be called once for each subgraph.");
+  ORT_UNUSED_PARAMETER(attribute_name);
+
+  const auto& node = Node();
+  info_ = onnxruntime::make_unique<BeamSearch::Info>(node, subgraph_session_state.GetGraphViewer());
+
+  // all inputs for the subgraph. the tokens feed is created on CPU by this kernel so we
+  // use the subgraph name for it directly; the state feeds start as outer scope values.
+  std::vector<std::string> feed_names;
+  feed_names.reserve(info_->num_subgraph_inputs + info_->num_implicit_inputs);
+
+  feed_names.push_back(info_->subgraph_input_names[0]);
+
+  const auto& node_inputs = node.InputDefs();
+  for (int i = 0; i < info_->num_state_vars; ++i) {
+    feed_names.push_back(node_inputs[i + 4]->Name());
+  }
+
+  for (auto& entry : node.ImplicitInputDefs()) {
+    feed_names.push_back(entry->Name());
+  }
+
+  std::vector<OrtDevice> feed_locations;
+
+  // skip the tokens input when looking up feed locations as we created it on CPU
+  ORT_RETURN_IF_ERROR(controlflow::detail::FindDevicesForValues(session_state, feed_names, feed_locations, 1));
+
+  // now update the feed names to use the subgraph input names for the state variables
+  // so that we know what device they're needed on
+  for (int i = 0; i < info_->num_state_vars; ++i) {
+    feed_names[i + 1] = info_->subgraph_input_names[i + 1];
+  }
+
+  std::unique_ptr<FeedsFetchesManager> ffm;
+  ORT_RETURN_IF_ERROR(FeedsFetchesManager::Create(feed_names, info_->subgraph_output_names,
+                                                  subgraph_session_state.GetOrtValueNameIdxMap(), ffm));
+  ORT_RETURN_IF_ERROR(utils::InitializeFeedFetchCopyInfo(subgraph_session_state, *ffm));
+
+  // all fetches are consumed on CPU: the logits feed beam selection and the state
+  // outputs are gathered on CPU before being fed back in for the next step.
+  const auto& cpu_allocator_info = session_state.GetExecutionProviders()
+                                       .Get(onnxruntime::kCpuExecutionProvider)
+                                       ->GetAllocator(0, OrtMemTypeDefault)
+                                       ->Info();
+
+  std::vector<const OrtMemoryInfo*> fetch_locations(info_->num_subgraph_outputs, &cpu_allocator_info);
+
+  utils::FinalizeFeedFetchCopyInfo(*ffm, feed_locations, fetch_locations);
+
+  feeds_fetches_manager_ = std::move(ffm);
+
+  return Status::OK();
+}
+
+Status BeamSearch::Compute(OpKernelContext* ctx) const {
+  auto* ctx_internal = static_cast<OpKernelContextInternal*>(ctx);
+  auto* session_state = ctx_internal->SubgraphSessionState("body");
+  ORT_ENFORCE(session_state != nullptr, "Subgraph SessionState was not found for 'body' attribute.");
+  ORT_ENFORCE(feeds_fetches_manager_, "CreateFeedsFetchesManager must be called prior to execution of graph.");
+
+  BeamSearchImpl impl{*ctx_internal, *session_state, *info_, eos_token_id_, pad_token_id_};
+
+  auto status = impl.Initialize();
+  ORT_RETURN_IF_ERROR(status);
+
+  status = impl.Execute(*feeds_fetches_manager_);
+
+  return status;
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/feeds_fetches_manager.h"
+#include "core/framework/op_kernel.h"
+#include "core/providers/cpu/controlflow/utils.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+/// Beam search decoding driven by a decoder-step subgraph in the 'body' attribute.
+/// The kernel owns the decode loop: it runs the subgraph once per generated token,
+/// selects the top beams from the logits, reorders the decoder state outputs along
+/// their first (batch_size * num_beams) dimension to match the selected beams, and
+/// feeds them back in for the next step. See the schema for the subgraph contract.
+class BeamSearch final : public controlflow::IControlFlowKernel {
+ public:
+  BeamSearch(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* ctx) const override;
+
+  common::Status SetupSubgraphExecutionInfo(const SessionState& session_state,
+                                            const std::string& attribute_name,
+                                            const SessionState& subgraph_session_state) override;
+
+  // hide internal implementation details via forward declaration.
+  struct Info;
+  ~BeamSearch();
+
+ private:
+  std::unique_ptr<Info> info_;
+  std::unique_ptr<FeedsFetchesManager> feeds_fetches_manager_;
+
+  int32_t eos_token_id_;
+  int32_t pad_token_id_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -3,13 +3,18 @@
 
 #include "attention_cpu_base.h"
 #include "attention_helper.h"
+#include "core/framework/op_kernel_context_internal.h"
+#include "core/framework/run_options.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 #include "core/common/safeint.h"
+#include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
 
+#include <unordered_map>
+
 using onnxruntime::concurrency::ThreadPool;
 
 namespace onnxruntime {
@@ -26,9 +31,28 @@ class Attention : public OpKernel, public AttentionCPUBase {
 #endif
 
  private:
+  // Per-sequence K/V state for incremental decoding (see RunOptions::run_sequence_id).
+  // The buffer holds keys then values, each laid out as (batch_size, num_heads,
+  // max_length, head_size) with the first sequence_length rows of every chunk valid.
+  struct SequenceCache {
+    BufferUniquePtr buffer;
+    int batch_size;
+    int max_length;
+    int sequence_length;
+  };
+
+  // Looks up (or creates) the cache for the sequence the Run belongs to and accounts for
+  // the sequence_length tokens this Run appends. Runs of one sequence must not overlap.
+  Status GetSequenceCache(const OrtRunOptions& run_options, int batch_size, int sequence_length,
+                          int head_size, T*& cache_key, T*& cache_value,
+                          int& cache_max_length, int& cache_sequence_length) const;
+
   BufferUniquePtr packed_weights_;
   size_t packed_weights_size_;
   TensorShape weight_shape_;
+
+  mutable OrtMutex cache_mutex_;
+  mutable std::unordered_map<std::string, SequenceCache> sequence_caches_;
 };
 
 // These ops are internal-only, so register outside of onnx
@@ -54,16 +78,21 @@ Status AttentionBase::CheckInputs(const TensorShape& input_shape,
                                   const TensorShape& weights_shape,
                                   const TensorShape& bias_shape,
                                   const Tensor*& mask_index,
-                                  const Tensor* past) const {
+                                  const Tensor* past,
+                                  const Tensor* key_value,
+                                  int cache_sequence_length) const {
   // Input shapes:
   //   input       : (batch_size, sequence_length, hidden_size)
   //   weights     : (hidden_size, 3 * hidden_size)
   //   bias        : (3 * hidden_size)
   //   mask_index  : nullptr, (batch_size), (2 * batch_size),
   //                 or (batch_size, 1), (1, 1)
-  //                 or (batch_size, past_sequence_length + sequence_length)
-  //                 or (batch_size, sequence_length, past_sequence_length + sequence_length)
+  //                 or (batch_size, past_sequence_length + kv_sequence_length)
+  //                 or (batch_size, sequence_length, past_sequence_length + kv_sequence_length)
   //   past        : (2, batch_size, num_heads, past_sequence_length, head_size)
+  //   key_value   : (batch_size, kv_sequence_length, hidden_size)
+  // For self attention kv_sequence_length == sequence_length; for cross attention it is the
+  // sequence length of the key_value input.
 
   const auto& dims = input_shape.GetDims();
   if (dims.size() != 3) {
@@ -78,6 +107,28 @@ Status AttentionBase::CheckInputs(const TensorShape& input_shape,
                            "Input 0 dimension 2 should be divisiable by value of the num_heads attribute.");
   }
 
+  int kv_sequence_length = sequence_length;
+  if (key_value != nullptr) {  // key_value is optional
+    if (is_unidirectional_) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Attribute 'unidirectional' is not supported together with input 'key_value'");
+    }
+    const auto& key_value_dims = key_value->Shape().GetDims();
+    if (key_value_dims.size() != 3) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input 'key_value' is expected to have 3 dimensions, got ",
+                             key_value_dims.size());
+    }
+    if (static_cast<int>(key_value_dims[0]) != batch_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Input 'key_value' dimension 0 should have same length as dimension 0 of input 0");
+    }
+    if (static_cast<int>(key_value_dims[2]) != hidden_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Input 'key_value' dimension 2 should have same length as dimension 2 of input 0");
+    }
+    kv_sequence_length = static_cast<int>(key_value_dims[1]);
+  }
+
   const auto& weights_dims = weights_shape.GetDims();
   if (weights_dims.size() != 2) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input 'weights' is expected to have 2 dimensions, got ",
@@ -101,7 +152,9 @@ Status AttentionBase::CheckInputs(const TensorShape& input_shape,
                            "Input 'bias' dimension 0 should have same length as dimension 1 of input 'weights'");
   }
 
-  int past_sequence_length = 0;
+  // with the session-managed KV cache the state of earlier steps is held by the kernel
+  // rather than a past input, but it still counts towards the mask dimensions.
+  int past_sequence_length = cache_sequence_length;
   if (past != nullptr) {  // past is optional
     const auto& past_dims = past->Shape().GetDims();
     if (past_dims.size() != 5) {
@@ -130,18 +183,18 @@ Status AttentionBase::CheckInputs(const TensorShape& input_shape,
         return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Inputs 'mask_index' dimension 0 shall have length of batch_size or 2 * batch_size");
       }
     } else if (mask_dims.size() == 2) {
-      if (static_cast<int>(mask_dims[0]) != batch_size || static_cast<int>(mask_dims[1]) != past_sequence_length + sequence_length) {
+      if (static_cast<int>(mask_dims[0]) != batch_size || static_cast<int>(mask_dims[1]) != past_sequence_length + kv_sequence_length) {
         // Add operator supports broadcasting. Here we handle a case with only one element in the 2nd dimension.
         if ((static_cast<int>(mask_dims[0]) == batch_size || static_cast<int>(mask_dims[0]) == 1) && static_cast<int>(mask_dims[1]) == 1) {
           // Mask will have same value after propogation, which has same effect as no mask.
           mask_index = nullptr;
         } else {
-          return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Inputs 'mask_index' with raw attention mask shall have shape batch_size x (past_sequence_length + sequence_length)");
+          return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Inputs 'mask_index' with raw attention mask shall have shape batch_size x (past_sequence_length + kv_sequence_length)");
         }
       }
     } else if (mask_dims.size() == 3) {
-      if (static_cast<int>(mask_dims[0]) != batch_size || mask_dims[1] != sequence_length || static_cast<int>(mask_dims[2]) != past_sequence_length + sequence_length) {
-        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Inputs 'mask_index' of 3d shall have shape batch_size x sequence_length x (past_sequence_length + sequence_length)");
+      if (static_cast<int>(mask_dims[0]) != batch_size || mask_dims[1] != sequence_length || static_cast<int>(mask_dims[2]) != past_sequence_length + kv_sequence_length) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Inputs 'mask_index' of 3d shall have shape batch_size x sequence_length x (past_sequence_length + kv_sequence_length)");
       }
     } else {
       return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input 'mask_index' is expected to have 1, 2 or 3 dimensions, got ",
@@ -230,6 +283,59 @@ Status Attention<T>::PrePack(const Tensor& weights, int input_idx, bool& is_pack
 
 #endif
 
+template <typename T>
+Status Attention<T>::GetSequenceCache(const OrtRunOptions& run_options, int batch_size, int sequence_length,
+                                      int head_size, T*& cache_key, T*& cache_value,
+                                      int& cache_max_length, int& cache_sequence_length) const {
+  std::lock_guard<OrtMutex> lock(cache_mutex_);
+
+  if (run_options.run_sequence_reset) {
+    sequence_caches_.erase(run_options.run_sequence_id);
+  }
+
+  auto it = sequence_caches_.find(run_options.run_sequence_id);
+  if (it == sequence_caches_.end()) {
+    const int max_length = run_options.run_sequence_max_length;
+    if (max_length < sequence_length) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "RunOptions sequence max_length (", max_length,
+                             ") must cover at least the sequence length of the first Run (", sequence_length, ")");
+    }
+
+    auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+    const size_t buffer_bytes = SafeInt<size_t>(2) * batch_size * num_heads_ * max_length * head_size * sizeof(T);
+
+    SequenceCache cache;
+    cache.buffer = BufferUniquePtr(alloc->Alloc(buffer_bytes), BufferDeleter(alloc));
+    cache.batch_size = batch_size;
+    cache.max_length = max_length;
+    cache.sequence_length = 0;
+    it = sequence_caches_.emplace(run_options.run_sequence_id, std::move(cache)).first;
+  } else if (it->second.batch_size != batch_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Batch size changed from ", it->second.batch_size, " to ", batch_size,
+                           " within sequence '", run_options.run_sequence_id, "'");
+  }
+
+  SequenceCache& cache = it->second;
+  if (cache.sequence_length + sequence_length > cache.max_length) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Sequence '", run_options.run_sequence_id, "' exceeds its max_length of ",
+                           cache.max_length);
+  }
+
+  cache_key = reinterpret_cast<T*>(cache.buffer.get());
+  cache_value = cache_key + SafeInt<size_t>(batch_size) * num_heads_ * cache.max_length * head_size;
+  cache_max_length = cache.max_length;
+  cache_sequence_length = cache.sequence_length;
+
+  // the new keys and values are appended during ApplyAttention; account for them here so the
+  // bookkeeping does not need a second pass after the compute.
+  cache.sequence_length += sequence_length;
+
+  return Status::OK();
+}
+
 template <typename T>
 Status Attention<T>::Compute(OpKernelContext* context) const {
   const Tensor* input = context->Input<Tensor>(0);
@@ -237,19 +343,51 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
   const Tensor* bias = context->Input<Tensor>(2);
   const Tensor* mask_index = context->Input<Tensor>(3);
   const Tensor* past = context->Input<Tensor>(4);
-
-  ORT_RETURN_IF_ERROR(CheckInputs(input->Shape(),
-                                  packed_weights_ ? weight_shape_ : weights->Shape(),
-                                  bias->Shape(),
-                                  mask_index,
-                                  past));
+  const Tensor* key_value = context->Input<Tensor>(5);
 
   const auto& shape = input->Shape().GetDims();
+  if (shape.size() != 3) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input 'input' is expected to have 3 dimensions, got ",
+                           shape.size());
+  }
   const int batch_size = static_cast<int>(shape[0]);
   const int sequence_length = static_cast<int>(shape[1]);
   const int hidden_size = static_cast<int>(shape[2]);
   const int head_size = hidden_size / num_heads_;
 
+  // A sequence id in the RunOptions switches unidirectional self attention to the
+  // session-managed KV cache: keys and values of earlier Runs stay in a per-sequence
+  // buffer preallocated at max_length and this step's are appended in place, instead
+  // of the past/present tensors growing and being copied in full every step.
+  T* cache_key = nullptr;
+  T* cache_value = nullptr;
+  int cache_max_length = 0;
+  int cache_sequence_length = 0;
+  const OrtRunOptions* run_options = static_cast<OpKernelContextInternal*>(context)->GetRunOptions();
+  if (run_options != nullptr && !run_options->run_sequence_id.empty() &&
+      is_unidirectional_ && key_value == nullptr) {
+    if (past != nullptr) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Input 'past' cannot be combined with a RunOptions sequence id. "
+                             "The session-managed KV cache replaces the past/present state.");
+    }
+    ORT_RETURN_IF_ERROR(GetSequenceCache(*run_options, batch_size, sequence_length, head_size,
+                                         cache_key, cache_value, cache_max_length, cache_sequence_length));
+  }
+
+  ORT_RETURN_IF_ERROR(CheckInputs(input->Shape(),
+                                  packed_weights_ ? weight_shape_ : weights->Shape(),
+                                  bias->Shape(),
+                                  mask_index,
+                                  past,
+                                  key_value,
+                                  cache_sequence_length));
+
+  // For cross attention, K and V are projected from the key_value input (e.g. encoder hidden
+  // states of a decoder model) whose sequence length can differ from that of the input.
+  const int kv_sequence_length = (key_value != nullptr) ? static_cast<int>(key_value->Shape().GetDims()[1])
+                                                        : sequence_length;
+
   Tensor* output = context->Output(0, shape);
 
   constexpr size_t element_size = sizeof(T);
@@ -260,17 +398,19 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
   auto* tp = context->GetOperatorThreadPool();
   // Compute Q, K, V
   // gemm_data(BS, 3NH) = input(BS, NH) x weights(NH, 3NH) + bias(3NH)
-  auto gemm_data = allocator->Alloc(SafeInt<size_t>(batch_size) * sequence_length * 3 * hidden_size * element_size);
+  // For cross attention K and V are computed from key_value(B, S_kv, NH) instead of input.
+  auto gemm_data = allocator->Alloc(SafeInt<size_t>(batch_size) * (sequence_length + 2 * kv_sequence_length) * hidden_size * element_size);
   BufferUniquePtr gemm_buffer(gemm_data, BufferDeleter(allocator));
 
   auto Q = reinterpret_cast<T*>(gemm_data);
   auto K = Q + batch_size * sequence_length * hidden_size;
-  auto V = K + batch_size * sequence_length * hidden_size;
+  auto V = K + batch_size * kv_sequence_length * hidden_size;
   T* QKV[3] = {Q, K, V};
 
   {
     const int loop_len = 3 * batch_size * num_heads_;
     const auto* input_data = input->template Data<T>();
+    const auto* key_value_data = (key_value != nullptr) ? key_value->template Data<T>() : input_data;
     const auto* weights_data = packed_weights_ ? nullptr : weights->template Data<T>();
     const auto* bias_data = bias->template Data<T>();
 
@@ -282,15 +422,19 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
         const int head_index = static_cast<int>((i / 3) % num_heads_);
         const int qkv_index = static_cast<int>(i % 3);
 
-        int input_offset = batch_index * sequence_length * hidden_size;
+        // Q is projected from input, K and V from key_value (which aliases input for self attention).
+        const T* gemm_input = (qkv_index == 0) ? input_data : key_value_data;
+        const int gemm_sequence_length = (qkv_index == 0) ? sequence_length : kv_sequence_length;
+
+        int input_offset = batch_index * gemm_sequence_length * hidden_size;
         int weights_offset = qkv_index * hidden_size + head_index * head_size;
         T* qkv_dest = QKV[qkv_index];
-        int qkv_offset = (batch_index * num_heads_ + head_index) * (sequence_length * head_size);
+        int qkv_offset = (batch_index * num_heads_ + head_index) * (gemm_sequence_length * head_size);
 
         // broadcast 3NH -> (3.B.N.S.H)
         const T* broadcast_data_src = bias_data + weights_offset;
         T* broadcast_data_dest = QKV[qkv_index] + qkv_offset;
-        for (int seq_index = 0; seq_index < sequence_length; seq_index++) {
+        for (int seq_index = 0; seq_index < gemm_sequence_length; seq_index++) {
           memcpy(broadcast_data_dest, broadcast_data_src, head_size * sizeof(T));
           broadcast_data_dest += head_size;
         }
@@ -304,11 +448,11 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
               static_cast<const uint8_t*>(packed_weights_.get()) + packed_weights_size_ * (weights_offset / head_size);
           MlasGemm(
               CblasNoTrans,               // TransA = no
-              sequence_length,            // M      = S
+              gemm_sequence_length,       // M      = S
               head_size,                  // N      = H
               hidden_size,                // K      = NH
               1.0f,                       // alpha
-              input_data + input_offset,  // A
+              gemm_input + input_offset,  // A
               hidden_size,                // lda    = NH
               packed_weight,              // B
               1.0f,                       // beta
@@ -318,11 +462,11 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
         } else {
           math::GemmEx<float, ThreadPool>(CblasNoTrans,                   // TransA = no
                                           CblasNoTrans,                   // TransB = no
-                                          sequence_length,                // M      = S
+                                          gemm_sequence_length,           // M      = S
                                           head_size,                      // N      = H
                                           hidden_size,                    // K      = NH
                                           1.0f,                           // alpha
-                                          input_data + input_offset,      // A
+                                          gemm_input + input_offset,      // A
                                           hidden_size,                    // lda    = NH
                                           weights_data + weights_offset,  // B
                                           3 * hidden_size,                // ldb    = 3NH
@@ -339,7 +483,9 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
   // Compute the attention score and apply the score to V
   return ApplyAttention(Q, K, V, mask_index, past, output,
                         batch_size, sequence_length,
-                        head_size, hidden_size, context);
+                        head_size, hidden_size, context,
+                        kv_sequence_length,
+                        cache_key, cache_value, cache_max_length, cache_sequence_length);
 }
 
 }  // namespace contrib
@@ -17,7 +17,9 @@ class AttentionBase {
                      const TensorShape& weights_shape,
                      const TensorShape& bias_shape,
                      const Tensor*& mask_index,  // For dummy mask with shape (1, 1) or (batch_size, 1), it will be updated to nullptr.
-                     const Tensor* past) const;
+                     const Tensor* past,
+                     const Tensor* key_value = nullptr,        // For cross attention, K and V are projected from this input.
+                     int cache_sequence_length = 0) const;     // Tokens already in the session-managed KV cache, when there is no past input.
 
   Tensor* GetPresent(OpKernelContext* context,
                      const Tensor* past,
@@ -18,27 +18,45 @@ class AttentionCPUBase : public AttentionBase {
   AttentionCPUBase(const OpKernelInfo& info) : AttentionBase(info) {}
 
   template <typename T>
-  Status ApplyAttention(const T* Q,                // Q data. Its size is BxNxSxH
-                        const T* K,                // K data. Its size is BxNxSxH
-                        const T* V,                // V value with size BxNxSxH
-                        const Tensor* mask_index,  // mask index. nullptr if no mask or its size is B
-                        const Tensor* past,        // past state
-                        Tensor* output,            // output tensor
-                        int batch_size,            // batch size
-                        int sequence_length,       // sequence length
-                        int head_size,             // head size
-                        int hidden_size,           // hidden size
-                        OpKernelContext* context) const {
+  Status ApplyAttention(const T* Q,                    // Q data. Its size is BxNxSxH
+                        const T* K,                    // K data. Its size is BxNxS_kvxH
+                        const T* V,                    // V value with size BxNxS_kvxH
+                        const Tensor* mask_index,      // mask index. nullptr if no mask or its size is B
+                        const Tensor* past,            // past state
+                        Tensor* output,                // output tensor
+                        int batch_size,                // batch size
+                        int sequence_length,           // sequence length of Q
+                        int head_size,                 // head size
+                        int hidden_size,               // hidden size
+                        OpKernelContext* context,
+                        int kv_sequence_length = -1,   // sequence length of K and V. -1 means same as Q (self attention)
+                        T* cache_key = nullptr,        // session-managed K cache with earlier steps in place, or nullptr
+                        T* cache_value = nullptr,      // session-managed V cache with earlier steps in place, or nullptr
+                        int cache_max_length = 0,      // capacity in tokens of each cache chunk
+                        int cache_sequence_length = 0) const {  // tokens already in the cache
     AllocatorPtr allocator;
     ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
 
     auto* tp = context->GetOperatorThreadPool();
 
+    if (kv_sequence_length < 0) {
+      kv_sequence_length = sequence_length;
+    }
+
+    // With the session-managed KV cache (see RunOptions::run_sequence_id) the keys and values
+    // of earlier steps are already in place, so there is no past input or present output and
+    // this step's K and V are appended into the cache instead of being concatenated.
     int past_sequence_length = 0;
-    Tensor* present = GetPresent(context, past, batch_size, head_size, sequence_length, past_sequence_length);
+    Tensor* present = nullptr;
+    if (cache_key != nullptr) {
+      past_sequence_length = cache_sequence_length;
+    } else {
+      present = GetPresent(context, past, batch_size, head_size, kv_sequence_length, past_sequence_length);
+    }
+    const size_t cache_chunk_length = static_cast<size_t>(cache_max_length) * head_size;
 
-    // Total sequence length including that of past state: S* = S' + S
-    const int all_sequence_length = past_sequence_length + sequence_length;
+    // Total sequence length of K and V including that of past state: S* = S' + S_kv
+    const int all_sequence_length = past_sequence_length + kv_sequence_length;
 
     // Compute the attention score. It does 2 things:
     //         I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
@@ -63,8 +81,8 @@ class AttentionCPUBase : public AttentionBase {
 
     ComputeAttentionProbs<T>(static_cast<T*>(attention_probs), Q, K,
                              mask_index_data, mask_index_dims, static_cast<T*>(mask_data),
-                             batch_size, sequence_length, past_sequence_length, head_size,
-                             past_data, present_data, tp);
+                             batch_size, sequence_length, kv_sequence_length, past_sequence_length, head_size,
+                             past_data, present_data, cache_key, cache_chunk_length, tp);
 
     // Compute the attentionScore * Value. It does: out_tmp(B, N, S, H) = attention_probs(B, N, S, S*) x V(B, N, S*, H)
     auto out_tmp_data =
@@ -72,8 +90,8 @@ class AttentionCPUBase : public AttentionBase {
     BufferUniquePtr out_tmp_buffer(out_tmp_data, BufferDeleter(allocator));
 
     ComputeVxAttentionScore(output->template MutableData<T>(), static_cast<T*>(out_tmp_data), static_cast<T*>(attention_probs), V,
-                            batch_size, sequence_length, past_sequence_length, head_size, hidden_size,
-                            past_data, present_data, tp);
+                            batch_size, sequence_length, kv_sequence_length, past_sequence_length, head_size, hidden_size,
+                            past_data, present_data, cache_value, cache_chunk_length, tp);
 
     return Status::OK();
   }
@@ -84,27 +102,31 @@ class AttentionCPUBase : public AttentionBase {
   //                                    1 x mask_data(B, N, S, S*)
   //  II.attention_probs(B, N, S, S*) = Softmax(attention_probs)
   template <typename T>
-  void ComputeAttentionProbs(T* attention_probs,                           // output buffer for the attention probs. Its size is BxNxSxS
+  void ComputeAttentionProbs(T* attention_probs,                           // output buffer for the attention probs. Its size is BxNxSxS*
                              const T* Q,                                   // Q data. Its size is BxNxSxH
-                             const T* K,                                   // k data. Its size is BxNxSxH
+                             const T* K,                                   // k data. Its size is BxNxS_kvxH
                              const int32_t* mask_index,                    // mask index. nullptr if no mask or its size is B
                              const std::vector<int64_t>* mask_index_dims,  // mask index shape
                              T* mask_data,                                 // buffer for mask data. It is nullptr if mask_index is nullptr, otherwise its shape is BxSxS*
                              int batch_size,                               // batch size of self-attention
-                             int sequence_length,                          // sequence length of self-attention
+                             int sequence_length,                          // sequence length of Q
+                             int kv_sequence_length,                       // sequence length of K and V
                              int past_sequence_length,                     // sequence length of past state
                              int head_size,                                // head size of self-attention
                              const T* past,                                // past state
                              T* present,                                   // present state
+                             T* cache_key,                                 // session-managed K cache, or nullptr
+                             size_t cache_chunk_length,                    // capacity of each cache chunk: max_length x H
                              ThreadPool* tp) const {
-    const int all_sequence_length = past_sequence_length + sequence_length;                  // S* = S' + S
+    const int all_sequence_length = past_sequence_length + kv_sequence_length;               // S* = S' + S_kv
     const size_t past_chunk_length = static_cast<size_t>(past_sequence_length * head_size);  // S' x H
-    const size_t input_chunk_length = static_cast<size_t>(sequence_length * head_size);      // S x H
-    const size_t present_chunk_length = past_chunk_length + input_chunk_length;              // S* x H
+    const size_t q_chunk_length = static_cast<size_t>(sequence_length * head_size);          // S x H
+    const size_t kv_chunk_length = static_cast<size_t>(kv_sequence_length * head_size);      // S_kv x H
+    const size_t present_chunk_length = past_chunk_length + kv_chunk_length;                 // S* x H
 
     {
       if (mask_data != nullptr) {
-        PrepareMask(mask_index, mask_index_dims, mask_data, is_unidirectional_, batch_size, sequence_length, past_sequence_length);
+        PrepareMask(mask_index, mask_index_dims, mask_data, is_unidirectional_, batch_size, sequence_length, past_sequence_length, kv_sequence_length);
       } else {  // no any mask
         memset(attention_probs, 0, batch_size * num_heads_ * sequence_length * all_sequence_length * sizeof(T));
       }
@@ -126,9 +148,14 @@ class AttentionCPUBase : public AttentionBase {
             memcpy(broadcast_data_dest, broadcast_data_src, sequence_length * all_sequence_length * sizeof(T));
           }
 
-          const T* k = K + input_chunk_length * i;
-          if (nullptr != present) {
-            // concatenate past_K and K : (BxNx)S'xH, (BxNx)SxH -> (BxNx)S*xH
+          const T* k = K + kv_chunk_length * i;
+          if (nullptr != cache_key) {
+            // append K for this step in place; earlier steps are already in the cache chunk
+            T* chunk = cache_key + cache_chunk_length * i;
+            memcpy(chunk + past_chunk_length, k, kv_chunk_length * sizeof(T));
+            k = chunk;
+          } else if (nullptr != present) {
+            // concatenate past_K and K : (BxNx)S'xH, (BxNx)S_kvxH -> (BxNx)S*xH
             k = ConcatStateChunk(past, k, present, past_chunk_length, present_chunk_length, i);
           }
 
@@ -138,7 +165,7 @@ class AttentionCPUBase : public AttentionBase {
           // B: K'               (B x N x) S* x H         (B x N x) H x S*       H x S*
           // C: attention_probs  (B x N x) S x S*         (B x N x) S x S*       S x S*
           math::Gemm<T, ThreadPool>(CblasNoTrans, CblasTrans, sequence_length, all_sequence_length, head_size, alpha,
-                                    Q + input_chunk_length * i, k, 1.0,
+                                    Q + q_chunk_length * i, k, 1.0,
                                     reinterpret_cast<T*>(attention_probs) + sequence_length * all_sequence_length * i, nullptr);
         }
       });
@@ -156,19 +183,23 @@ class AttentionCPUBase : public AttentionBase {
   void ComputeVxAttentionScore(T* output,                 // buffer for the result with size BxSxNxH
                                T* tmp_buffer,             // buffer for temp use with size is BxNxSxH
                                const T* attention_probs,  // Attention probs with size BxNxSxS*
-                               const T* V,                // V value with size BxNxSxH
+                               const T* V,                // V value with size BxNxS_kvxH
                                int batch_size,            // batch size
-                               int sequence_length,       // sequence length
+                               int sequence_length,       // sequence length of Q
+                               int kv_sequence_length,    // sequence length of K and V
                                int past_sequence_length,  // sequence length in past state
                                int head_size,             // head size
                                int hidden_size,           // hidden size
                                const T* past,             // past state
                                T* present,                // present state
+                               T* cache_value,            // session-managed V cache, or nullptr
+                               size_t cache_chunk_length,  // capacity of each cache chunk: max_length x H
                                ThreadPool* tp) const {
-    const int all_sequence_length = past_sequence_length + sequence_length;                  // S* = S' + S
+    const int all_sequence_length = past_sequence_length + kv_sequence_length;               // S* = S' + S_kv
     const size_t past_chunk_length = static_cast<size_t>(past_sequence_length * head_size);  // S' x H
-    const size_t input_chunk_length = static_cast<size_t>(sequence_length * head_size);      // S x H
-    const size_t present_chunk_length = past_chunk_length + input_chunk_length;              // S* x H
+    const size_t q_chunk_length = static_cast<size_t>(sequence_length * head_size);          // S x H
+    const size_t kv_chunk_length = static_cast<size_t>(kv_sequence_length * head_size);      // S_kv x H
+    const size_t present_chunk_length = past_chunk_length + kv_chunk_length;                 // S* x H
 
     // Move the pointer of past and present to start of v values.
     if (nullptr != past) {
@@ -183,13 +214,18 @@ class AttentionCPUBase : public AttentionBase {
 
     ThreadPool::TryParallelFor(tp, batch_size * num_heads_, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
       for (std::ptrdiff_t i = begin; i != end; ++i) {
-        const T* v = V + input_chunk_length * i;
-        if (nullptr != present) {
-          // concatenate past_V and V: (BxNx)S'xH, (BxNx)SxH -> (BxNx)S*xH
+        const T* v = V + kv_chunk_length * i;
+        if (nullptr != cache_value) {
+          // append V for this step in place; earlier steps are already in the cache chunk
+          T* chunk = cache_value + cache_chunk_length * i;
+          memcpy(chunk + past_chunk_length, v, kv_chunk_length * sizeof(T));
+          v = chunk;
+        } else if (nullptr != present) {
+          // concatenate past_V and V: (BxNx)S'xH, (BxNx)S_kvxH -> (BxNx)S*xH
           v = ConcatStateChunk(past, v, present, past_chunk_length, present_chunk_length, i);
         }
 
-        T* current_tmp_data = reinterpret_cast<T*>(tmp_buffer) + input_chunk_length * i;
+        T* current_tmp_data = reinterpret_cast<T*>(tmp_buffer) + q_chunk_length * i;
         math::MatMul<T>(sequence_length, head_size, all_sequence_length,
                         attention_probs + sequence_length * all_sequence_length * i,
                         v, current_tmp_data, nullptr);
@@ -66,8 +66,12 @@ void PrepareMask(const int32_t* mask_index,
                  bool is_unidirectional,
                  int batch_size,
                  int sequence_length,
-                 int past_sequence_length) {
-  const int all_sequence_length = past_sequence_length + sequence_length;
+                 int past_sequence_length,
+                 int kv_sequence_length = -1) {  // sequence length of K and V. -1 means same as sequence_length (self attention)
+  if (kv_sequence_length < 0) {
+    kv_sequence_length = sequence_length;
+  }
+  const int all_sequence_length = past_sequence_length + kv_sequence_length;
 
   // mask_data has been filled with 0, and its shape is BxSxS*
   T* p_mask = mask_data;
@@ -74,11 +74,16 @@ Status BiasGelu<T, use_approximation>::Compute(OpKernelContext* context) const {
   const T* bias_data = bias->template Data<T>();
   int64_t bias_len = bias->Shape().Size();
 
+  // only the tanh approximation needs scratch space; the exact form is computed in place
   AllocatorPtr alloc;
-  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-  BufferUniquePtr buffer = BufferUniquePtr(alloc->Alloc(SafeInt<size_t>(sizeof(T)) * elem_count),
-                                           BufferDeleter(alloc));
-  T* tmp_data = static_cast<T*>(buffer.get());
+  BufferUniquePtr buffer;
+  T* tmp_data = nullptr;
+  if (use_approximation) {
+    ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+    buffer = BufferUniquePtr(alloc->Alloc(SafeInt<size_t>(sizeof(T)) * elem_count),
+                             BufferDeleter(alloc));
+    tmp_data = static_cast<T*>(buffer.get());
+  }
 
   int64_t task_count = elem_count / bias_len;
 
@@ -87,7 +92,7 @@ Status BiasGelu<T, use_approximation>::Compute(OpKernelContext* context) const {
       [&](ptrdiff_t task_idx) {
         const T* p_input = input_data + task_idx * bias_len;
         T* p_output = output_data + task_idx * bias_len;
-        T* p_tmp = tmp_data + task_idx * bias_len;
+        T* p_tmp = (tmp_data != nullptr) ? tmp_data + task_idx * bias_len : nullptr;
 
         AddBiasGelu(p_input, bias_data, p_tmp, p_output, bias_len);
       },
@@ -112,17 +117,13 @@ void BiasGelu<T, use_approximation>::AddBiasGelu(
       output[i] = temp[i] * (output[i] + 1.0f);
     }
   } else {  // BiasGelu
-    for (int64_t i = 0; i < count; i++) {
-      T value = input[i] + bias[i];
-      output[i] = value * static_cast<T>(M_SQRT1_2);
-      temp[i] = value * 0.5f;
-    }
-
-    MlasComputeErf(output, output, count);
+    ORT_UNUSED_PARAMETER(temp);
 
     for (int64_t i = 0; i < count; i++) {
-      output[i] = temp[i] * (output[i] + 1.0f);
+      output[i] = input[i] + bias[i];
     }
+
+    MlasComputeGelu(output, output, count);
   }
 }
 
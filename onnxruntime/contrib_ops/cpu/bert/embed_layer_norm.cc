@@ -3,6 +3,7 @@
 
 #include "embed_layer_norm.h"
 #include "embed_layer_norm_helper.h"
+#include "contrib_ops/cpu/layer_norm_helper.h"
 #include "core/util/math_cpuonly.h"
 #include "core/platform/threadpool.h"
 
@@ -97,25 +98,18 @@ Status EmbedLayerNorm<T>::Compute(OpKernelContext* context) const {
       const T* input_position_embedding = position_embedding_data + position_col_index * hidden_size;
       const T* input_segment_embedding = (nullptr == segment_embedding_data) ? nullptr : segment_embedding_data + segment_col_index * hidden_size;
 
-      T sum = static_cast<T>(0);
-      for (int i = 0; i < hidden_size; i++) {
-        T subtotal = input_word_embedding[i] + input_position_embedding[i];
-        if (nullptr != segment_embedding_data)
-          subtotal += input_segment_embedding[i];
-        y[i] = subtotal;
-        sum += subtotal;
-      }
-      T mean = sum / hidden_size;
-      sum = 0;
-      for (int i = 0; i < hidden_size; i++) {
-        T a = y[i] - mean;
-        y[i] = a;
-        sum += a * a;
-      }
-      T e = sqrt(sum / hidden_size + static_cast<T>(epsilon_));
-      for (int i = 0; i < hidden_size; i++) {
-        y[i] = y[i] / e * gamma_data[i] + beta_data[i];
+      // Gather the three embedding rows into the output with a single vectorized pass,
+      // then layer-normalize the row in place.
+      ConstEigenVectorArrayMap<T> word_map(input_word_embedding, hidden_size);
+      ConstEigenVectorArrayMap<T> position_map(input_position_embedding, hidden_size);
+      EigenVectorArrayMap<T> y_map(y, hidden_size);
+      if (nullptr != segment_embedding_data) {
+        y_map = word_map + position_map + ConstEigenVectorArrayMap<T>(input_segment_embedding, hidden_size);
+      } else {
+        y_map = word_map + position_map;
       }
+
+      LayerNormalizeRow<T, false>(y, y, gamma_data, beta_data, hidden_size, static_cast<T>(epsilon_));
     }, 0);
 
     if (failed.load(std::memory_order_acquire)) {
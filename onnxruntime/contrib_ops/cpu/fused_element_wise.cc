@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cpu/activation/activations.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Applies a chain of unary element-wise functions in a single pass over the tensor.
+// The whole chain is evaluated per range handed out by the thread pool, so each block
+// is still hot in cache when the next stage consumes it, instead of every op
+// re-streaming the full tensor from memory.
+// Produced by the ElementWiseChainFusion graph transformer.
+template <typename T>
+class FusedElementWise final : public OpKernel {
+ public:
+  explicit FusedElementWise(const OpKernelInfo& info) : OpKernel(info) {
+    std::vector<std::string> activations;
+    ORT_THROW_IF_ERROR(info.GetAttrs<std::string>("activations", activations));
+    ORT_ENFORCE(activations.size() >= 2, "FusedElementWise expects at least 2 fused functions.");
+
+    // The attributes of the i-th function are carried on the fused node with an
+    // 'activation_<i>_' prefix (e.g. 'activation_0_alpha'). Strip the prefix back off
+    // so each functor's Init sees the attribute names it expects.
+    const NodeAttributes& node_attrs = info.node().GetAttributes();
+    functors_.reserve(activations.size());
+    for (size_t i = 0; i < activations.size(); ++i) {
+      const std::string prefix = "activation_" + std::to_string(i) + "_";
+      NodeAttributes attrs;
+      for (const auto& p : node_attrs) {
+        if (p.first.size() > prefix.size() && p.first.compare(0, prefix.size(), prefix) == 0) {
+          attrs[p.first.substr(prefix.size())] = p.second;
+        }
+      }
+      std::unique_ptr<functors::ElementWiseRangedTransform<T>> f;
+      ORT_THROW_IF_ERROR(functors::ElementWiseRangedTransform<T>::Create(activations[i], attrs, f));
+      functors_.push_back(std::move(f));
+    }
+  }
+
+  Status Compute(OpKernelContext* context) const override {
+    const Tensor* X = context->Input<Tensor>(0);
+    Tensor* Y = context->Output(0, X->Shape());
+    const int64_t input_size = X->Shape().Size();
+    if (input_size == 0)
+      return Status::OK();
+    ORT_ENFORCE(input_size < std::numeric_limits<std::ptrdiff_t>::max());
+
+    // Clone the functors so the members stay immutable across concurrent Runs. The first
+    // stage reads the input; every later stage transforms the output buffer in place
+    // (all the functors are purely element-wise, so aliasing input and output is safe).
+    std::vector<std::unique_ptr<functors::ElementWiseRangedTransform<T>>> stages;
+    stages.reserve(functors_.size());
+    T* output_data = Y->template MutableData<T>();
+    float cost = 0.0f;
+    for (size_t i = 0; i < functors_.size(); ++i) {
+      std::unique_ptr<functors::ElementWiseRangedTransform<T>> f(functors_[i]->Copy());
+      f->input = (i == 0) ? X->template Data<T>() : output_data;
+      f->output = output_data;
+      cost += f->Cost();
+      stages.push_back(std::move(f));
+    }
+
+    concurrency::ThreadPool::TryParallelFor(
+        context->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(input_size),
+        {static_cast<float>(sizeof(T)), static_cast<float>(sizeof(T)), cost},
+        [&stages](std::ptrdiff_t first, std::ptrdiff_t last) {
+          for (const auto& stage : stages) {
+            (*stage)(first, last);
+          }
+        });
+
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<functors::ElementWiseRangedTransform<T>>> functors_;
+};
+
+ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
+    FusedElementWise,
+    1,
+    float,
+    KernelDefBuilder().MayInplace(0, 0).TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementWise<float>);
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -9,6 +9,26 @@ namespace contrib {
 constexpr const char* ACTIVATION_NAME_PREFIX = "activation_";
 constexpr size_t ACTIVATION_NAME_PREFIX_LEN = 11;
 
+// Maps an activation attribute onto MLAS_ACTIVATION so the float Gemm kernel can
+// apply it inside the GEMM output stage. Returns false for activations MLAS has
+// no kernel for; those run through the element-wise functor as before.
+static bool MapToMlasActivation(const std::string& activation, const OpKernelInfo& info,
+                                MLAS_ACTIVATION& mlas_activation) {
+  if (activation == "Relu") {
+    mlas_activation.ActivationKind = MlasReluActivation;
+  } else if (activation == "Tanh") {
+    mlas_activation.ActivationKind = MlasTanhActivation;
+  } else if (activation == "Sigmoid") {
+    mlas_activation.ActivationKind = MlasLogisticActivation;
+  } else if (activation == "LeakyRelu") {
+    mlas_activation.ActivationKind = MlasLeakyReluActivation;
+    mlas_activation.Parameters.LeakyRelu.alpha = info.GetAttrOrDefault<float>("activation_alpha", 0.01f);
+  } else {
+    return false;
+  }
+  return true;
+}
+
 template <typename T>
 class FusedGemm final : public Gemm<T> {
  public:
@@ -20,7 +40,9 @@ class FusedGemm final : public Gemm<T> {
         attrs[p.first.substr(ACTIVATION_NAME_PREFIX_LEN)] = p.second;
       }
     }
-    ORT_THROW_IF_ERROR(functors::ElementWiseRangedTransform<T>::Create(activation, attrs, this->activation_));
+    if (!MapToMlasActivation(activation, info, this->mlas_activation_)) {
+      ORT_THROW_IF_ERROR(functors::ElementWiseRangedTransform<T>::Create(activation, attrs, this->activation_));
+    }
   }
 };
 
@@ -3,6 +3,7 @@
 
 #include "layer_norm.h"
 
+#include "layer_norm_helper.h"
 #include "core/common/safeint.h"
 #include "core/framework/tensor.h"
 #include "core/platform/threadpool.h"
@@ -106,33 +107,15 @@ Status LayerNorm<T, simplified>::Compute(OpKernelContext* p_ctx) const {
                                                  const T* p_input = X_data + task_idx * norm_size;
                                                  T* p_output = Y_data + task_idx * norm_size;
 
-                                                 T mean = 0;
-                                                 T mean_square = 0;
-
-                                                 for (int64_t h = 0; h < norm_size; h++) {
-                                                   mean += p_input[h];
-                                                   mean_square += p_input[h] * p_input[h];
-                                                 }
-
-                                                 mean = mean / norm_size;
-                                                 if (simplified) {
-                                                   mean_square = sqrt(mean_square / norm_size + epsilon_);
-                                                 } else {
-                                                   mean_square = sqrt(mean_square / norm_size - mean * mean + epsilon_);
-                                                 }
-
-                                                 for (int64_t h = 0; h < norm_size; h++) {
-                                                   if (simplified) {
-                                                     p_output[h] = p_input[h] / mean_square * scale_data[h];
-                                                   } else {
-                                                     p_output[h] = (p_input[h] - mean) / mean_square * scale_data[h] + bias_data[h];
-                                                   }
-                                                 }
+                                                 T mean;
+                                                 LayerNormalizeRow<T, simplified>(p_input, p_output, scale_data,
+                                                                                  bias_data, norm_size,
+                                                                                  static_cast<T>(epsilon_), &mean,
+                                                                                  &inv_std_var_data[task_idx]);
 
                                                  if (mean_data != nullptr) {
                                                    mean_data[task_idx] = mean;
                                                  }
-                                                 inv_std_var_data[task_idx] = 1 / mean_square;
                                                }, 0);
 
   return Status::OK();
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cmath>
+
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Row-wise layer normalization shared by the LayerNormalization and SkipLayerNormalization
+// kernels. Computes
+//   output = (input - mean) / sqrt(variance + epsilon) * scale + bias
+// over one row of norm_size elements; for simplified == true the mean subtraction and the bias
+// are dropped. The moment reductions and the normalization are Eigen expressions, so they run at
+// the SIMD width the build targets instead of the scalar accumulation loops the kernels
+// previously carried. Welford's single-pass recurrence was considered for the statistics, but
+// its loop-carried dependency defeats vectorization; with the row resident in cache the
+// vectorized two-moment reduction is faster, and the epsilon added to the variance bounds the
+// effect of cancellation.
+//
+// input and output may alias, as every output coefficient depends only on the same input
+// coefficient once the reductions are done. p_mean / p_inv_std_var optionally receive the row
+// statistics for kernels that expose them as outputs.
+template <typename T, bool simplified>
+void LayerNormalizeRow(const T* input, T* output, const T* scale, const T* bias,
+                       int64_t norm_size, T epsilon,
+                       T* p_mean = nullptr, T* p_inv_std_var = nullptr) {
+  ConstEigenVectorArrayMap<T> input_map(input, norm_size);
+  EigenVectorArrayMap<T> output_map(output, norm_size);
+  ConstEigenVectorArrayMap<T> scale_map(scale, norm_size);
+
+  const T mean = simplified ? T{0} : input_map.mean();
+  const T variance = input_map.square().sum() / norm_size - mean * mean;
+  const T inv_std_var = T{1} / std::sqrt(variance + epsilon);
+
+  if (simplified) {
+    output_map = input_map * (scale_map * inv_std_var);
+  } else {
+    ConstEigenVectorArrayMap<T> bias_map(bias, norm_size);
+    output_map = (input_map - mean) * inv_std_var * scale_map + bias_map;
+  }
+
+  if (p_mean != nullptr) {
+    *p_mean = mean;
+  }
+  if (p_inv_std_var != nullptr) {
+    *p_inv_std_var = inv_std_var;
+  }
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -67,6 +67,22 @@ ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
     NchwcAveragePool);
 
+ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
+    Pad,
+    1,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NchwcPad);
+
+ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
+    Slice,
+    1,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NchwcSlice);
+
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     Upsample,
     1,
@@ -218,6 +234,90 @@ Status NchwcAveragePool::Compute(OpKernelContext* context) const {
                                                                          : MlasAveragePoolingExcludePad);
 }
 
+Status NchwcPad::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  const auto& X_shape = X->Shape();
+  ORT_ENFORCE(X_shape.NumDimensions() == 4);
+
+  const int64_t nchwc_block_size = static_cast<int64_t>(MlasNchwcGetBlockSize());
+  ORT_ENFORCE((X_shape[1] % nchwc_block_size) == 0);
+
+  const int64_t pad_top = pads_[2];
+  const int64_t pad_left = pads_[3];
+  const int64_t pad_bottom = pads_[6];
+  const int64_t pad_right = pads_[7];
+
+  TensorShape Y_shape{X_shape[0], X_shape[1], X_shape[2] + pad_top + pad_bottom, X_shape[3] + pad_left + pad_right};
+  auto* Y = context->Output(0, Y_shape);
+
+  // The spatial padding applies uniformly to each NCHWc channel block, so the
+  // tensor can be treated as a batch of blocked images and filled with simple
+  // row copies.
+  const int64_t blocked_images = X_shape[0] * (X_shape[1] / nchwc_block_size);
+  const size_t input_row_elements = static_cast<size_t>(X_shape[3] * nchwc_block_size);
+  const size_t output_row_elements = static_cast<size_t>(Y_shape[3] * nchwc_block_size);
+
+  const auto* x_data = X->template Data<float>();
+  auto* y_data = Y->template MutableData<float>();
+
+  for (int64_t i = 0; i < blocked_images; i++) {
+    std::fill_n(y_data, static_cast<size_t>(pad_top) * output_row_elements, value_);
+    y_data += static_cast<size_t>(pad_top) * output_row_elements;
+    for (int64_t h = 0; h < X_shape[2]; h++) {
+      std::fill_n(y_data, static_cast<size_t>(pad_left * nchwc_block_size), value_);
+      memcpy(y_data + pad_left * nchwc_block_size, x_data, input_row_elements * sizeof(float));
+      std::fill_n(y_data + output_row_elements - pad_right * nchwc_block_size,
+                  static_cast<size_t>(pad_right * nchwc_block_size), value_);
+      x_data += input_row_elements;
+      y_data += output_row_elements;
+    }
+    std::fill_n(y_data, static_cast<size_t>(pad_bottom) * output_row_elements, value_);
+    y_data += static_cast<size_t>(pad_bottom) * output_row_elements;
+  }
+
+  return Status::OK();
+}
+
+Status NchwcSlice::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  const auto& X_shape = X->Shape();
+  ORT_ENFORCE(X_shape.NumDimensions() == 4);
+
+  const int64_t nchwc_block_size = static_cast<int64_t>(MlasNchwcGetBlockSize());
+  ORT_ENFORCE((X_shape[1] % nchwc_block_size) == 0);
+
+  // Resolve the slice extents against the actual input shape. The graph
+  // transform has already folded away negative starts and ends, so only the
+  // clamp to the dimension value and the full extent sentinel remain.
+  int64_t starts[4];
+  int64_t ends[4];
+  for (size_t i = 0; i < 4; i++) {
+    ends[i] = (ends_[i] < 0) ? X_shape[i] : std::min(ends_[i], X_shape[i]);
+    starts[i] = std::min(starts_[i], ends[i]);
+  }
+
+  TensorShape Y_shape{ends[0] - starts[0], X_shape[1], ends[2] - starts[2], ends[3] - starts[3]};
+  auto* Y = context->Output(0, Y_shape);
+
+  const int64_t channel_blocks = X_shape[1] / nchwc_block_size;
+  const size_t output_row_elements = static_cast<size_t>(Y_shape[3] * nchwc_block_size);
+
+  const auto* x_data = X->template Data<float>();
+  auto* y_data = Y->template MutableData<float>();
+
+  for (int64_t n = starts[0]; n < ends[0]; n++) {
+    for (int64_t c = 0; c < channel_blocks; c++) {
+      for (int64_t h = starts[2]; h < ends[2]; h++) {
+        const auto* x_row = x_data + (((n * channel_blocks + c) * X_shape[2] + h) * X_shape[3] + starts[3]) * nchwc_block_size;
+        memcpy(y_data, x_row, output_row_elements * sizeof(float));
+        y_data += output_row_elements;
+      }
+    }
+  }
+
+  return Status::OK();
+}
+
 Status NchwcUpsample::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
   const auto& X_shape = X->Shape();
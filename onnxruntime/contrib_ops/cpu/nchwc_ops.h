@@ -76,6 +76,46 @@ class NchwcAveragePool : public OpKernel, public NchwcPoolBase {
   Status Compute(OpKernelContext* context) const override;
 };
 
+class NchwcPad : public OpKernel {
+ public:
+  NchwcPad(const OpKernelInfo& info) : OpKernel(info) {
+    ORT_ENFORCE(info.GetAttrs<int64_t>("pads", pads_).IsOK());
+    ORT_ENFORCE(pads_.size() == 8);
+    // Batch and channel dimensions cannot be padded and spatial padding must
+    // not be negative.
+    ORT_ENFORCE(pads_[0] == 0 && pads_[1] == 0 && pads_[4] == 0 && pads_[5] == 0);
+    ORT_ENFORCE(pads_[2] >= 0 && pads_[3] >= 0 && pads_[6] >= 0 && pads_[7] >= 0);
+    ORT_ENFORCE(info.GetAttr<float>("value", &value_).IsOK());
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  std::vector<int64_t> pads_;
+  float value_;
+};
+
+class NchwcSlice : public OpKernel {
+ public:
+  NchwcSlice(const OpKernelInfo& info) : OpKernel(info) {
+    ORT_ENFORCE(info.GetAttrs<int64_t>("starts", starts_).IsOK());
+    ORT_ENFORCE(info.GetAttrs<int64_t>("ends", ends_).IsOK());
+    ORT_ENFORCE(starts_.size() == 4 && ends_.size() == 4);
+    // Channel slicing is not supported and the remaining starts must not be
+    // negative. An end of -1 selects the full extent of that dimension.
+    ORT_ENFORCE(starts_[1] == 0 && ends_[1] == -1);
+    for (size_t i = 0; i < 4; i++) {
+      ORT_ENFORCE(starts_[i] >= 0 && ends_[i] >= -1);
+    }
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  std::vector<int64_t> starts_;
+  std::vector<int64_t> ends_;
+};
+
 class NchwcUpsample : public OpKernel {
  public:
   NchwcUpsample(const OpKernelInfo& info) : OpKernel(info) {
@@ -0,0 +1,324 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/op_kernel.h"
+#include "core/providers/cpu/nn/conv_attributes.h"
+#include "core/common/safeint.h"
+#include "core/util/math.h"
+#include "core/mlas/inc/mlas.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Convolution over tensors stored in the channels last (NHWC) format. The
+// weights tensor keeps the standard Conv layout (M x C/group x kH x kW) and
+// is reordered into a layout usable as the B matrix of a GEMM over the im2col
+// transform of the NHWC input.
+class NhwcConv : public OpKernel {
+ public:
+  explicit NhwcConv(const OpKernelInfo& info) : OpKernel(info),
+                                                conv_attrs_(info),
+                                                is_W_packed_(false) {
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+ private:
+  static void ReorderFilter(const float* input,
+                            float* output,
+                            size_t output_channels,
+                            size_t input_channels,
+                            size_t kernel_size) {
+    for (size_t k = 0; k < kernel_size; k++) {
+      for (size_t ic = 0; ic < input_channels; ic++) {
+        for (size_t oc = 0; oc < output_channels; oc++) {
+          size_t index = (oc * input_channels * kernel_size) + (ic * kernel_size) + k;
+          *output++ = input[index];
+        }
+      }
+    }
+  }
+
+  ConvAttributes conv_attrs_;
+  TensorShape W_shape_;
+  BufferUniquePtr reordered_W_buffer_;
+  bool is_W_packed_;
+};
+
+ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
+    NhwcConv,
+    1,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NhwcConv);
+
+Status NhwcConv::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // Support reordering the weight matrix.
+  if (input_idx != 1) {
+    return Status::OK();
+  }
+
+  const auto& shape = tensor.Shape().GetDims();
+  size_t rank = shape.size();
+  if (rank <= 2) {
+    return Status::OK();
+  }
+
+  // Note: The tensor has already been allocated with this tensor shape, so all
+  // shape indices are guaranteed to fit inside size_t.
+  const size_t output_channels = static_cast<size_t>(shape[0]);
+  const size_t group_input_channels = static_cast<size_t>(shape[1]);
+  const size_t kernel_size =
+    static_cast<size_t>(std::accumulate(shape.data() + 2, shape.data() + rank, 1LL, std::multiplies<int64_t>()));
+
+  W_shape_ = shape;
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+
+  auto* reordered_W = static_cast<float*>(alloc->Alloc(SafeInt<size_t>(sizeof(float)) * output_channels * group_input_channels * kernel_size));
+  reordered_W_buffer_ = BufferUniquePtr(reordered_W, BufferDeleter(alloc));
+
+  ReorderFilter(tensor.Data<float>(), reordered_W, output_channels, group_input_channels, kernel_size);
+
+  is_W_packed_ = true;
+  is_packed = true;
+  return Status::OK();
+}
+
+Status NhwcConv::Compute(OpKernelContext* context) const {
+  const Tensor* X = context->Input<Tensor>(0);
+  const Tensor* W = is_W_packed_ ? nullptr : context->Input<Tensor>(1);
+  const auto& W_shape = is_W_packed_ ? W_shape_ : W->Shape();
+  const Tensor* B = context->Input<Tensor>(2);
+
+  const int64_t N = X->Shape()[0];
+  const int64_t M = W_shape[0];
+
+  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X->Shape(), W_shape, /*channels_last*/ true));
+
+  std::vector<int64_t> kernel_shape;
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W_shape, kernel_shape));
+
+  const size_t kernel_rank = kernel_shape.size();
+
+  std::vector<int64_t> pads(conv_attrs_.pads);
+  if (pads.empty()) {
+    pads.resize(kernel_rank * 2, 0);
+  }
+  std::vector<int64_t> dilations(conv_attrs_.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_rank, 1);
+  }
+  std::vector<int64_t> strides(conv_attrs_.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_rank, 1);
+  }
+
+  const int64_t C = X->Shape()[1 + kernel_rank];
+  const size_t spatial_dim_start = 1;
+  const size_t spatial_dim_end = spatial_dim_start + kernel_rank;
+
+  std::vector<int64_t> Y_dims({N});
+  TensorShape input_shape = X->Shape().Slice(spatial_dim_start, spatial_dim_end);
+  ORT_RETURN_IF_ERROR(conv_attrs_.InferOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
+  Y_dims.push_back(M);
+  Tensor* Y = context->Output(0, TensorShape(Y_dims));
+  TensorShape output_shape = Y->Shape().Slice(spatial_dim_start, spatial_dim_end);
+
+  // Bail out early if one of the dimensions is zero.
+  if (Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  const int64_t input_image_size = input_shape.Size();
+  const int64_t output_image_size = output_shape.Size();
+  const int64_t kernel_size = TensorShape(kernel_shape).Size();
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  // Handle the case of a dynamic weight filter.
+  BufferUniquePtr reordered_W_buffer;
+  float* reordered_W;
+  if (reordered_W_buffer_) {
+    reordered_W = static_cast<float*>(reordered_W_buffer_.get());
+  } else {
+    // Weight tensor was not constant or prepacking is disabled.
+    reordered_W = static_cast<float*>(alloc->Alloc(SafeInt<size_t>(sizeof(float)) * W_shape.Size()));
+    reordered_W_buffer = BufferUniquePtr(reordered_W, BufferDeleter(alloc));
+    ReorderFilter(W->Data<float>(),
+                  reordered_W,
+                  static_cast<size_t>(M),
+                  static_cast<size_t>(W_shape[1]),
+                  static_cast<size_t>(kernel_size));
+  }
+
+  const int64_t group_count = conv_attrs_.group;
+  const int64_t group_input_channels = W_shape[1];
+  const int64_t group_output_channels = M / group_count;
+
+  const int64_t X_offset = C * input_image_size;
+  const int64_t Y_offset = M * output_image_size;
+  const int64_t kernel_dim = group_input_channels * kernel_size;
+  const int64_t col_buffer_size = kernel_dim * output_image_size;
+
+  const auto* Xdata = X->template Data<float>();
+  const auto* Bdata = B != nullptr ? B->template Data<float>() : nullptr;
+  auto* Ydata = Y->template MutableData<float>();
+
+  BufferUniquePtr col_buffer;
+
+  // Pointwise convolutions can use the original input tensor in place,
+  // otherwise a temporary buffer is required for the im2col transform.
+  if (kernel_size != 1 || !conv_attrs_.HasStridesOneAndNoPadding()) {
+    int64_t group_col_buffer_size = (kernel_rank > 2) ? group_count * col_buffer_size : col_buffer_size;
+    auto* col_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * group_col_buffer_size);
+    col_buffer = BufferUniquePtr(col_data, BufferDeleter(alloc));
+  }
+
+  // Replicate the logic from MlasGemmU8X8Schedule to control the number of
+  // worker threads used for the convolution.
+  constexpr int32_t maximum_thread_count = 16;
+  constexpr double thread_complexity = static_cast<double>(64 * 1024);
+
+  const double complexity = static_cast<double>(output_image_size) *
+                            static_cast<double>(group_output_channels) *
+                            static_cast<double>(kernel_dim);
+
+  int32_t thread_count = maximum_thread_count;
+  if (complexity < thread_complexity * maximum_thread_count) {
+    thread_count = static_cast<int32_t>(complexity / thread_complexity) + 1;
+  }
+  if (thread_count > output_image_size) {
+    // Ensure that every thread produces at least one output.
+    thread_count = static_cast<int32_t>(output_image_size);
+  }
+
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+  thread_count = std::min(thread_count, concurrency::ThreadPool::DegreeOfParallelism(thread_pool));
+
+  for (int64_t image_id = 0; image_id < N; ++image_id) {
+    if (col_buffer && kernel_rank > 2) {
+      // Threaded implementation of ND convolution is not yet supported, so
+      // prepare all im2col transformations here.
+      for (int64_t group_id = 0; group_id < group_count; ++group_id) {
+        math::Im2col<float, StorageOrder::NHWC>()(
+            Xdata + group_id * group_input_channels,
+            group_input_channels,
+            C,
+            input_shape.GetDims().data(),
+            output_shape.GetDims().data(),
+            kernel_shape.data(),
+            strides.data(),
+            dilations.data(),
+            pads.data(),
+            static_cast<int64_t>(kernel_rank),
+            static_cast<float*>(col_buffer.get()) + group_id * col_buffer_size,
+            0.0f);
+      }
+    }
+
+    auto conv_worker = [&](ptrdiff_t batch) {
+      auto work = concurrency::ThreadPool::PartitionWork(batch, thread_count, static_cast<ptrdiff_t>(output_image_size));
+      int64_t output_start = static_cast<int64_t>(work.start);
+      int64_t output_count = static_cast<int64_t>(work.end - work.start);
+
+      auto* worker_output = Ydata + output_start * M;
+
+      for (int64_t group_id = 0; group_id < group_count; ++group_id) {
+        // Prepare the im2col transformation or use the input buffer directly for
+        // pointwise convolutions.
+        const float* worker_gemm_input;
+        if (col_buffer) {
+          auto* worker_col_buffer = static_cast<float*>(col_buffer.get()) + output_start * kernel_dim;
+          if (kernel_rank == 2) {
+            math::Im2col<float, StorageOrder::NHWC>()(
+                Xdata + group_id * group_input_channels,
+                group_input_channels,
+                C,
+                input_shape[0],
+                input_shape[1],
+                kernel_shape[0],
+                kernel_shape[1],
+                dilations[0],
+                dilations[1],
+                pads[0],
+                pads[1],
+                strides[0],
+                strides[1],
+                output_shape[1],
+                output_start,
+                output_count,
+                worker_col_buffer,
+                0.0f);
+          } else if (kernel_rank == 1) {
+            math::Im2col<float, StorageOrder::NHWC>()(
+                Xdata + group_id * group_input_channels,
+                group_input_channels,
+                C,
+                1,
+                input_shape[0],
+                1,
+                kernel_shape[0],
+                1,
+                dilations[0],
+                0,
+                pads[0],
+                1,
+                strides[0],
+                output_shape[0],
+                output_start,
+                output_count,
+                worker_col_buffer,
+                0.0f);
+          } else {
+            // Use the im2col buffer prepared outside the thread, indexed by group.
+            worker_col_buffer += group_id * col_buffer_size;
+          }
+          worker_gemm_input = worker_col_buffer;
+        } else {
+          worker_gemm_input = Xdata + output_start * kernel_dim;
+        }
+
+        MlasGemm(CblasNoTrans,
+                 CblasNoTrans,
+                 static_cast<size_t>(output_count),
+                 static_cast<size_t>(group_output_channels),
+                 static_cast<size_t>(kernel_dim),
+                 1.0f,
+                 worker_gemm_input,
+                 static_cast<size_t>(kernel_dim),
+                 reordered_W + group_id * group_output_channels,
+                 static_cast<size_t>(M),
+                 0.0f,
+                 worker_output + group_id * group_output_channels,
+                 static_cast<size_t>(M),
+                 nullptr);
+      }
+
+      if (Bdata != nullptr) {
+        float* worker_bias_output = worker_output;
+        for (int64_t i = 0; i < output_count; i++) {
+          for (int64_t m = 0; m < M; m++) {
+            worker_bias_output[m] += Bdata[m];
+          }
+          worker_bias_output += M;
+        }
+      }
+    };
+
+    concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, thread_count, conv_worker);
+
+    Xdata += X_offset;
+    Ydata += Y_offset;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -187,6 +187,147 @@ Status QLinearMul<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+template <typename T>
+Status QLinearSub<T>::Compute(OpKernelContext* context) const {
+  const ProcessBroadcastSpanFuncs functors = {
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        const T input0 = per_iter_bh.ScalarInput0<T>();
+        auto input1 = per_iter_bh.SpanInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+
+        MlasQLinearSub(&input0,
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       input1.data(),
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), true, false);
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        auto input0 = per_iter_bh.SpanInput0<T>();
+        const T input1 = per_iter_bh.ScalarInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+        MlasQLinearSub(input0.data(),
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       &input1,
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), false, true);
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        auto input0 = per_iter_bh.SpanInput0<T>();
+        auto input1 = per_iter_bh.SpanInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+
+        MlasQLinearSub(input0.data(),
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       input1.data(),
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), false, false);
+      }};
+
+  QLinearImpl<T>(*context, 1.0, functors);
+
+  return Status::OK();
+}
+
+template <typename T>
+Status QLinearMin<T>::Compute(OpKernelContext* context) const {
+  const ProcessBroadcastSpanFuncs functors = {
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        const T input0 = per_iter_bh.ScalarInput0<T>();
+        auto input1 = per_iter_bh.SpanInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+
+        MlasQLinearMin(input1.data(),
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       &input0,
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), true);
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        auto input0 = per_iter_bh.SpanInput0<T>();
+        const T input1 = per_iter_bh.ScalarInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+        MlasQLinearMin(input0.data(),
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       &input1,
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), true);
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        auto input0 = per_iter_bh.SpanInput0<T>();
+        auto input1 = per_iter_bh.SpanInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+
+        MlasQLinearMin(input0.data(),
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       input1.data(),
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), false);
+      }};
+
+  QLinearImpl<T>(*context, 1.0, functors);
+
+  return Status::OK();
+}
+
+template <typename T>
+Status QLinearMax<T>::Compute(OpKernelContext* context) const {
+  const ProcessBroadcastSpanFuncs functors = {
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        const T input0 = per_iter_bh.ScalarInput0<T>();
+        auto input1 = per_iter_bh.SpanInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+
+        MlasQLinearMax(input1.data(),
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       &input0,
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), true);
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        auto input0 = per_iter_bh.SpanInput0<T>();
+        const T input1 = per_iter_bh.ScalarInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+        MlasQLinearMax(input0.data(),
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       &input1,
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), true);
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        QLinearBroadcastHelper& qlbh = static_cast<QLinearBroadcastHelper&>(per_iter_bh);
+        auto input0 = per_iter_bh.SpanInput0<T>();
+        auto input1 = per_iter_bh.SpanInput1<T>();
+        auto output = per_iter_bh.OutputSpan<T>();
+
+        MlasQLinearMax(input0.data(),
+                       qlbh.A_scale, static_cast<T>(qlbh.A_zero_point),
+                       input1.data(),
+                       qlbh.B_scale, static_cast<T>(qlbh.B_zero_point),
+                       qlbh.C_scale, static_cast<T>(qlbh.C_zero_point),
+                       output.data(), output.size(), false);
+      }};
+
+  QLinearImpl<T>(*context, 1.0, functors);
+
+  return Status::OK();
+}
+
 #define REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(op_name, version, data_type, KERNEL_CLASS) \
   ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(                                                    \
       op_name, version, data_type,                                                      \
@@ -198,6 +339,12 @@ REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearAdd, 1, int8_t, QLinearAdd);
 REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearAdd, 1, uint8_t, QLinearAdd);
 REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearMul, 1, int8_t, QLinearMul);
 REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearMul, 1, uint8_t, QLinearMul);
+REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearSub, 1, int8_t, QLinearSub);
+REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearSub, 1, uint8_t, QLinearSub);
+REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearMin, 1, int8_t, QLinearMin);
+REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearMin, 1, uint8_t, QLinearMin);
+REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearMax, 1, int8_t, QLinearMax);
+REG_QLINEAR_ELEMENTWISE_TYPED_KERNEL(QLinearMax, 1, uint8_t, QLinearMax);
 
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -26,5 +26,29 @@ class QLinearMul final : public OpKernel {
   Status Compute(OpKernelContext* context) const override;
 };
 
+template <typename T>
+class QLinearSub final : public OpKernel {
+ public:
+  QLinearSub(const OpKernelInfo& info) : OpKernel(info) {}
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+template <typename T>
+class QLinearMin final : public OpKernel {
+ public:
+  QLinearMin(const OpKernelInfo& info) : OpKernel(info) {}
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+template <typename T>
+class QLinearMax final : public OpKernel {
+ public:
+  QLinearMax(const OpKernelInfo& info) : OpKernel(info) {}
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -168,6 +168,44 @@ Status QLinearSigmoid<T>::Compute(OpKernelContext* context) const {
   });
 }
 
+template <typename T>
+QLinearTanh<T>::QLinearTanh(const OpKernelInfo& info)
+    : QLinearLookupBase<T>(info) {
+  this->BuildLookupTableIfFixed(info, [](const float* input, float* output, size_t length) {
+    MlasComputeTanh(input, output, length);
+  });
+}
+
+template <typename T>
+Status QLinearTanh<T>::Compute(OpKernelContext* context) const {
+  return this->ComputeBase(context, [](const float* input, float* output, size_t length) {
+    MlasComputeTanh(input, output, length);
+  });
+}
+
+// Gelu(x) = 0.5 * x * (1 + erf(x / sqrt(2))), matching the contrib Gelu op.
+static void GeluArrayTransform(const float* input, float* output, size_t length) {
+  constexpr float sqrt_half = 0.70710678118654752440f;  // 1 / sqrt(2)
+  for (size_t i = 0; i < length; ++i) {
+    output[i] = input[i] * sqrt_half;
+  }
+  MlasComputeErf(output, output, length);
+  for (size_t i = 0; i < length; ++i) {
+    output[i] = 0.5f * input[i] * (output[i] + 1.0f);
+  }
+}
+
+template <typename T>
+QLinearGelu<T>::QLinearGelu(const OpKernelInfo& info)
+    : QLinearLookupBase<T>(info) {
+  this->BuildLookupTableIfFixed(info, GeluArrayTransform);
+}
+
+template <typename T>
+Status QLinearGelu<T>::Compute(OpKernelContext* context) const {
+  return this->ComputeBase(context, GeluArrayTransform);
+}
+
 #define REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(op_name, version, data_type, KERNEL_CLASS) \
   ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(                                                         \
       op_name, version, data_type,                                                           \
@@ -179,6 +217,10 @@ REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearLeakyRelu, 1, int8_t, QLinearLe
 REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearLeakyRelu, 1, uint8_t, QLinearLeakyRelu);
 REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearSigmoid, 1, int8_t, QLinearSigmoid);
 REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearSigmoid, 1, uint8_t, QLinearSigmoid);
+REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearTanh, 1, int8_t, QLinearTanh);
+REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearTanh, 1, uint8_t, QLinearTanh);
+REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearGelu, 1, int8_t, QLinearGelu);
+REGISTER_QLINEAR_LOOKUPTABLE_TYPED_KERNEL(QLinearGelu, 1, uint8_t, QLinearGelu);
 
 }  // namespace contrib
 }  // namespace onnxruntime
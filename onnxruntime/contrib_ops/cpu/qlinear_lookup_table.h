@@ -56,5 +56,21 @@ class QLinearSigmoid final : public QLinearLookupBase<T> {
   Status Compute(OpKernelContext* context) const override;
 };
 
+template <typename T>
+class QLinearTanh final : public QLinearLookupBase<T> {
+ public:
+  QLinearTanh(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+template <typename T>
+class QLinearGelu final : public QLinearLookupBase<T> {
+ public:
+  QLinearGelu(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -130,15 +130,29 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
                                                  mask_index,
                                                  past_tensor));
 
+  const auto& shape = input->Shape();
+  const int batch_size = static_cast<int>(shape[0]);
+  const int sequence_length = static_cast<int>(shape[1]);
+  const int hidden_size = static_cast<int>(shape[2]);
+  const int head_size = hidden_size / num_heads_;
+
   ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(input_scale_tensor),
                     "input scale must be a scalar or 1D tensor of size 1");
   T input_scale = *(input_scale_tensor->template Data<T>());
 
-  ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(weight_scale_tensor),
-                    "weight must be a scalar or 1D tensor of size 1");
-  T weight_scale = *(weight_scale_tensor->template Data<T>());
-
-  T dequant_scale = input_scale * weight_scale;
+  // The weight may be quantized per-column, with one scale for each of the
+  // 3 * hidden_size projection outputs.
+  const bool is_weight_scale_per_column = !IsScalarOr1ElementVector(weight_scale_tensor);
+  ORT_RETURN_IF_NOT(is_weight_scale_per_column
+                        ? weight_scale_tensor->Shape().Size() == static_cast<int64_t>(3) * hidden_size
+                        : true,
+                    "weight scale must be a scalar or 1D tensor of size 1 or 3 * hidden_size");
+  const T* weight_scale_data = weight_scale_tensor->template Data<T>();
+
+  std::vector<T> dequant_scales(weight_scale_data, weight_scale_data + weight_scale_tensor->Shape().Size());
+  for (auto& dequant_scale : dequant_scales) {
+    dequant_scale *= input_scale;
+  }
 
   uint8_t input_zero_point = 0;
   if (i_zp_tensor != nullptr) {
@@ -147,19 +161,22 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
     input_zero_point = *i_zp_tensor->template Data<uint8_t>();
   }
 
+  // A per-column weight zero point tensor is accepted as long as all of the
+  // values are identical, since the GEMM only supports a single zero point.
   uint8_t weight_zero_point = 0;
   if (w_zp_tensor != nullptr) {
-    ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(w_zp_tensor),
-                      "weight zero point must be a scalar or 1D tensor of size 1.");
-    weight_zero_point = *static_cast<const uint8_t*>(w_zp_tensor->DataRaw());
+    const int64_t w_zp_size = w_zp_tensor->Shape().Size();
+    ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(w_zp_tensor) ||
+                          w_zp_size == static_cast<int64_t>(3) * hidden_size,
+                      "weight zero point must be a scalar or 1D tensor of size 1 or 3 * hidden_size.");
+    const auto* w_zp_data = static_cast<const uint8_t*>(w_zp_tensor->DataRaw());
+    weight_zero_point = w_zp_data[0];
+    for (int64_t i = 1; i < w_zp_size; i++) {
+      ORT_RETURN_IF_NOT(w_zp_data[i] == weight_zero_point,
+                        "weight zero point must be constant");
+    }
   }
 
-  const auto& shape = input->Shape();
-  const int batch_size = static_cast<int>(shape[0]);
-  const int sequence_length = static_cast<int>(shape[1]);
-  const int hidden_size = static_cast<int>(shape[2]);
-  const int head_size = hidden_size / num_heads_;
-
   Tensor* output = context->Output(0, shape);
 
   AllocatorPtr allocator;
@@ -203,10 +220,14 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
         // B: weights        (NxHx3xNxH)        NH  x (3.N.)H         NH x H
         // C: QKV[qkv_index] (3xBxNxSxH)        (3.B.N.)S x H         S x H
 
-        MLAS_QGEMM_SCALE_BIAS_OUTPUT_PROCESSOR scale_bias_processor(qkv_dest + qkv_offset,
-                                                                    head_size,
-                                                                    &dequant_scale,
-                                                                    bias_data + weights_offset);
+        MLAS_QGEMM_SCALE_BIAS_OUTPUT_PROCESSOR scale_bias_processor(
+            qkv_dest + qkv_offset,
+            head_size,
+            dequant_scales.data() + (is_weight_scale_per_column ? weights_offset : 0),
+            bias_data + weights_offset,
+            MLAS_QGEMM_OUTPUT_MODE::ZeroMode,
+            is_weight_scale_per_column ? MLAS_QUANTIZATION_GRANULARITY::PerColumn
+                                       : MLAS_QUANTIZATION_GRANULARITY::PerMatrix);
 #ifdef MLAS_SUPPORTS_PACKED_GEMM_U8X8
         if (packed_weights_) {
           const auto* packed_weight =
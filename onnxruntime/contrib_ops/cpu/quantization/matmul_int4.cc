@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/safeint.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/cpu/math/matmul_helper.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Weight-only quantized MatMul. The weight matrix is stored transposed as
+// blocks of int4 values sharing a single scale, so a 3 GB fp32 checkpoint
+// shrinks roughly 8x on disk and in memory. The activations stay fp32: each
+// Run dequantizes the weights into a scratch buffer and runs a regular SGEMM,
+// so only the int4 data and the per-block scales are streamed from memory.
+class MatMulInt4 final : public OpKernel {
+ public:
+  MatMulInt4(const OpKernelInfo& info) : OpKernel(info) {
+    ORT_ENFORCE(info.GetAttr("K", &K_).IsOK() && K_ > 0);
+    ORT_ENFORCE(info.GetAttr("N", &N_).IsOK() && N_ > 0);
+    block_size_ = info.GetAttrOrDefault<int64_t>("block_size", 32);
+    ORT_ENFORCE(block_size_ >= 16 && (block_size_ & (block_size_ - 1)) == 0,
+                "MatMulInt4 : block_size must be a power of two and at least 16");
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  int64_t K_;
+  int64_t N_;
+  int64_t block_size_;
+};
+
+Status MatMulInt4::Compute(OpKernelContext* context) const {
+  const Tensor* a = context->Input<Tensor>(0);
+  const Tensor* b_quant = context->Input<Tensor>(1);
+  const Tensor* scales = context->Input<Tensor>(2);
+
+  const int64_t blocks_per_col = (K_ + block_size_ - 1) / block_size_;
+  const int64_t bytes_per_col = blocks_per_col * block_size_ / 2;
+
+  ORT_RETURN_IF_NOT(b_quant->Shape().Size() == N_ * bytes_per_col,
+                    "MatMulInt4 : packed weight size does not match N, K and block_size");
+  ORT_RETURN_IF_NOT(scales->Shape().Size() == N_ * blocks_per_col,
+                    "MatMulInt4 : scales size does not match N, K and block_size");
+
+  MatMulComputeHelper helper;
+  ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), TensorShape({K_, N_})));
+  Tensor* y = context->Output(0, helper.OutputShape());
+
+  // Bail out early if the output is going to be empty
+  if (y->Shape().Size() == 0)
+    return Status::OK();
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  // Dequantize the weights into a transposed (N, K) scratch buffer, one
+  // contiguous row per output column.
+  auto* b_dequant = static_cast<float*>(alloc->Alloc(SafeInt<size_t>(sizeof(float)) * N_ * K_));
+  BufferUniquePtr b_dequant_buffer(b_dequant, BufferDeleter(alloc));
+
+  const auto* b_quant_data = b_quant->Data<uint8_t>();
+  const auto* scales_data = scales->Data<float>();
+
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(N_),
+      {static_cast<double>(bytes_per_col), static_cast<double>(K_) * sizeof(float), static_cast<double>(K_) * 2.0},
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (std::ptrdiff_t n = begin; n != end; ++n) {
+          const uint8_t* col_data = b_quant_data + n * bytes_per_col;
+          const float* col_scales = scales_data + n * blocks_per_col;
+          float* dst = b_dequant + n * K_;
+          for (int64_t block = 0; block < blocks_per_col; ++block) {
+            const float scale = col_scales[block];
+            const int64_t k_base = block * block_size_;
+            for (int64_t i = 0; i < block_size_; i += 2) {
+              const uint8_t packed = *col_data++;
+              const int64_t k = k_base + i;
+              if (k < K_) {
+                dst[k] = scale * static_cast<float>((packed & 0x0F) - 8);
+              }
+              if (k + 1 < K_) {
+                dst[k + 1] = scale * static_cast<float>((packed >> 4) - 8);
+              }
+            }
+          }
+        }
+      });
+
+  const auto* a_data = a->Data<float>();
+  auto* y_data = y->MutableData<float>();
+
+  const size_t M = static_cast<size_t>(helper.M());
+  for (size_t i = 0; i < helper.OutputOffsets().size(); i++) {
+    MlasGemm(CblasNoTrans,
+             CblasTrans,
+             M,
+             static_cast<size_t>(N_),
+             static_cast<size_t>(K_),
+             1.0f,
+             a_data + helper.LeftOffsets()[i],
+             static_cast<size_t>(K_),
+             b_dequant,
+             static_cast<size_t>(K_),
+             0.0f,
+             y_data + helper.OutputOffsets()[i],
+             static_cast<size_t>(N_),
+             thread_pool);
+  }
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_KERNEL_EX(
+    MatMulInt4,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<uint8_t>()),
+    MatMulInt4);
+
+}  // namespace contrib
+}  // namespace onnxruntime
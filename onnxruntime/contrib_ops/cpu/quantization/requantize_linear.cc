@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+#include "core/providers/common.h"
+#include "core/mlas/inc/mlas.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+template <typename T>
+class RequantizeLinear final : public OpKernel {
+ public:
+  explicit RequantizeLinear(const OpKernelInfo& info) : OpKernel(info) {}
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
+    RequantizeLinear,
+    1,
+    uint8_t,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T2", {DataTypeImpl::GetTensorType<int8_t>(),
+                               DataTypeImpl::GetTensorType<uint8_t>()}),
+    RequantizeLinear<uint8_t>);
+
+ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
+    RequantizeLinear,
+    1,
+    int8_t,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<int8_t>())
+        .TypeConstraint("T2", {DataTypeImpl::GetTensorType<int8_t>(),
+                               DataTypeImpl::GetTensorType<uint8_t>()}),
+    RequantizeLinear<int8_t>);
+
+// formula is Y = saturate(round((X - X_ZeroPoint) * X_Scale / Y_Scale) + Y_ZeroPoint)
+template <typename T>
+Status RequantizeLinear<T>::Compute(OpKernelContext* ctx) const {
+  const auto& x = *ctx->Input<Tensor>(0);
+  const auto& x_scale = *ctx->Input<Tensor>(1);
+  const auto& x_zero_point = *ctx->Input<Tensor>(2);
+  const auto& y_scale = *ctx->Input<Tensor>(3);
+  const auto& y_zero_point = *ctx->Input<Tensor>(4);
+
+  ORT_ENFORCE(IsScalarOr1ElementVector(&x_scale), "x_scale must be a scalar or 1D tensor of size 1.");
+  ORT_ENFORCE(IsScalarOr1ElementVector(&x_zero_point), "x_zero_point must be a scalar or 1D tensor of size 1.");
+  ORT_ENFORCE(IsScalarOr1ElementVector(&y_scale), "y_scale must be a scalar or 1D tensor of size 1.");
+  ORT_ENFORCE(IsScalarOr1ElementVector(&y_zero_point), "y_zero_point must be a scalar or 1D tensor of size 1.");
+
+  auto& y = *ctx->Output(0, x.Shape());
+  const size_t N = static_cast<size_t>(x.Shape().Size());
+
+  const float input_scale = *x_scale.template Data<float>();
+  const T input_zero_point = *x_zero_point.template Data<T>();
+  const float output_scale = *y_scale.template Data<float>();
+
+  if (y_zero_point.IsDataType<int8_t>()) {
+    MlasRequantizeLinear(x.template Data<T>(), y.template MutableData<int8_t>(), N,
+                         input_scale, input_zero_point,
+                         output_scale, *y_zero_point.Data<int8_t>());
+  } else {
+    MlasRequantizeLinear(x.template Data<T>(), y.template MutableData<uint8_t>(), N,
+                         input_scale, input_zero_point,
+                         output_scale, *y_zero_point.Data<uint8_t>());
+  }
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -6,6 +6,7 @@
 #include "core/providers/common.h"
 #include "core/platform/threadpool.h"
 #include "skip_layer_norm.h"
+#include "layer_norm_helper.h"
 
 namespace onnxruntime {
 namespace contrib {
@@ -102,25 +103,21 @@ Status SkipLayerNorm<T>::Compute(OpKernelContext* p_ctx) const {
                                                  const T* p_skip = skip_data + task_idx * hidden_size;
                                                  T* p_output = output_data + task_idx * hidden_size;
 
-                                                 T mean = 0;
-                                                 T mean_square = 0;
-
-                                                 for (int64_t h = 0; h < hidden_size; h++) {
-                                                   T value = p_input[h] + p_skip[h];
-                                                   if (nullptr != bias_data) {
-                                                     value += bias_data[h];
-                                                   }
-                                                   p_output[h] = value;
-                                                   mean += value;
-                                                   mean_square += value * value;
+                                                 // fuse the residual add (and optional bias) into the output row,
+                                                 // then normalize it in place
+                                                 ConstEigenVectorArrayMap<T> input_map(p_input, hidden_size);
+                                                 ConstEigenVectorArrayMap<T> skip_map(p_skip, hidden_size);
+                                                 EigenVectorArrayMap<T> output_map(p_output, hidden_size);
+                                                 if (bias_data != nullptr) {
+                                                   output_map = input_map + skip_map +
+                                                                ConstEigenVectorArrayMap<T>(bias_data, hidden_size);
+                                                 } else {
+                                                   output_map = input_map + skip_map;
                                                  }
 
-                                                 mean = mean / hidden_size;
-                                                 mean_square = sqrt(mean_square / hidden_size - mean * mean + epsilon_);
-
-                                                 for (int64_t h = 0; h < hidden_size; h++) {
-                                                   p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h] + beta_data[h];
-                                                 }
+                                                 LayerNormalizeRow<T, false>(p_output, p_output, gamma_data,
+                                                                             beta_data, hidden_size,
+                                                                             static_cast<T>(epsilon_));
                                                }, 0);
 
   return Status::OK();
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Matrix product of a 2-D input with a mostly-zero 2-D weight. When the weight is a constant
+// initializer it is pre-packed into compressed sparse column form and multiplied with
+// MlasSparseGemm, which only visits the nonzero entries; otherwise the kernel falls back to a
+// dense MlasGemm. Nodes of this type are created by the SparseMatMulTransformer.
+class SparseMatMul final : public OpKernel {
+ public:
+  SparseMatMul(const OpKernelInfo& info) : OpKernel(info) {}
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  // weight in compressed sparse column form; empty if the weight was not constant or was
+  // too dense to be worth packing
+  BufferUniquePtr packed_values_;
+  BufferUniquePtr packed_row_indices_;
+  BufferUniquePtr packed_column_offsets_;
+  TensorShape b_shape_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -5,6 +5,7 @@
 #include "core/common/utf8_util.h"
 #include "core/framework/tensor.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "re2/re2.h"
 
 namespace onnxruntime {
@@ -30,6 +31,13 @@ class Tokenizer final : public OpKernel {
                          size_t N, size_t C,
                          const std::vector<int64_t>& input_dims) const;
 
+  // tokenize a single input string against separators_, leaving the result in
+  // 'row'. rows are independent of each other so this is run for shards of them
+  // in parallel from SeparatorExpressionTokenizer; both vectors are scratch the
+  // caller reuses across its rows.
+  Status SeparatorTokenizeRow(const std::string& s, std::vector<re2::StringPiece>& row,
+                              std::vector<re2::StringPiece>& tokens) const;
+
   bool mark_{false};
   std::string pad_value_;
   int64_t mincharnum_{0};
@@ -51,6 +59,21 @@ ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
 namespace tokenizer_details {
 const char start_text = 0x2;
 const char end_text = 0x3;
+
+// Rows per shard for the batch-parallel separator/token-expression paths. Sized so a
+// shard amortizes its pool allocations while a large batch still splits into enough
+// shards to occupy the thread pool.
+constexpr size_t kShardRows = 256;
+
+// Tokens for a contiguous block of input rows, collected into one pool with a per-row
+// offset table so a shard costs two allocations regardless of its row count. The token
+// text stays in the input tensor; std::string copies are only made when the output
+// tensor is written.
+struct TokenShard {
+  std::vector<re2::StringPiece> pool;
+  std::vector<size_t> row_begin;  // row count + 1 entries, offsets into pool
+  Status status;
+};
 }  // namespace tokenizer_details
 
 using namespace tokenizer_details;
@@ -118,21 +141,33 @@ Status Tokenizer::CharTokenize(OpKernelContext* ctx, size_t N, size_t C,
   // With char tokenzation we get as many tokens as the number of
   // utf8 characters in the string. So for every string we calculate its character(utf8) length
   // add padding and add start/end test separators if necessary
-  size_t max_tokens = 0;
   auto X = ctx->Input<Tensor>(0);
   auto const input_data = X->template Data<std::string>();
-  auto curr_input = input_data;
-  auto const last = input_data + N * C;
-  while (curr_input != last) {
-    const auto& s = *curr_input;
-    size_t tokens = 0;  // length in utf8 chars
-    if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
-                       tokens)) {
+  const size_t num_strings = N * C;
+
+  // the input strings validate independently of each other so distribute them
+  // across the thread pool and combine the per-string results afterwards
+  std::vector<size_t> row_lengths(num_strings);
+  std::vector<unsigned char> row_valid(num_strings);
+
+  concurrency::ThreadPool::TryBatchParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<int32_t>(num_strings),
+      [&](ptrdiff_t row_idx) {
+        const auto& s = input_data[row_idx];
+        size_t tokens = 0;  // length in utf8 chars
+        row_valid[row_idx] = utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
+                                           tokens);
+        row_lengths[row_idx] = tokens;
+      },
+      0);
+
+  size_t max_tokens = 0;
+  for (size_t row_idx = 0; row_idx < num_strings; ++row_idx) {
+    if (!row_valid[row_idx]) {
       return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
-                    "Input string contains invalid utf8 chars: " + s);
+                    "Input string contains invalid utf8 chars: " + input_data[row_idx]);
     }
-    max_tokens = std::max(max_tokens, tokens);
-    ++curr_input;
+    max_tokens = std::max(max_tokens, row_lengths[row_idx]);
   }
 
   std::vector<int64_t> output_dims(input_dims);
@@ -152,126 +187,168 @@ Status Tokenizer::CharTokenize(OpKernelContext* ctx, size_t N, size_t C,
   TensorShape output_shape(output_dims);
   auto output_tensor = ctx->Output(0, output_shape);
   auto const output_data = output_tensor->template MutableData<std::string>();
-  size_t output_index = 0;
-  curr_input = input_data;
-  while (curr_input != last) {
-    const auto& s = *curr_input;
-    if (mark_) {
-      (output_data + output_index)->assign(&start_text, 1);
-      ++output_index;
-    }
-    size_t tokens = 0;
-    const size_t str_len = s.size();
-    for (size_t token_idx = 0; token_idx < str_len;) {
-      size_t tlen = 0;
-      bool result = utf8_bytes(static_cast<unsigned char>(s[token_idx]), tlen);
-      assert(result);
-      (void)result;
-      assert(token_idx + tlen <= str_len);
-      *(output_data + output_index) = s.substr(token_idx, tlen);
-      ++output_index;
-      token_idx += tlen;
-      ++tokens;
-    }
-    if (mark_) {
-      (output_data + output_index)->assign(&end_text, 1);
-      ++output_index;
-    }
-    // Padding strings
-    assert(tokens + (mark_ * 2) <= max_tokens);
-    const size_t pads = max_tokens - (mark_ * 2) - tokens;
-    for (size_t p = 0; p < pads; ++p) {
-      *(output_data + output_index) = pad_value_;
-      ++output_index;
-    }
-    ++curr_input;
-  }
+
+  // each input string owns a fixed max_tokens wide slice of the output so the
+  // rows can be written in parallel as well
+  concurrency::ThreadPool::TryBatchParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<int32_t>(num_strings),
+      [&, max_tokens](ptrdiff_t row_idx) {
+        const auto& s = input_data[row_idx];
+        size_t output_index = row_idx * max_tokens;
+        if (mark_) {
+          (output_data + output_index)->assign(&start_text, 1);
+          ++output_index;
+        }
+        size_t tokens = 0;
+        const size_t str_len = s.size();
+        for (size_t token_idx = 0; token_idx < str_len;) {
+          size_t tlen = 0;
+          bool result = utf8_bytes(static_cast<unsigned char>(s[token_idx]), tlen);
+          assert(result);
+          (void)result;
+          assert(token_idx + tlen <= str_len);
+          (output_data + output_index)->assign(s.data() + token_idx, tlen);
+          ++output_index;
+          token_idx += tlen;
+          ++tokens;
+        }
+        if (mark_) {
+          (output_data + output_index)->assign(&end_text, 1);
+          ++output_index;
+        }
+        // Padding strings
+        assert(tokens + (mark_ * 2) <= max_tokens);
+        const size_t pads = max_tokens - (mark_ * 2) - tokens;
+        for (size_t p = 0; p < pads; ++p) {
+          *(output_data + output_index) = pad_value_;
+          ++output_index;
+        }
+      },
+      0);
+
   return Status::OK();
 }
 
-Status Tokenizer::SeparatorExpressionTokenizer(OpKernelContext* ctx,
-                                               size_t N, size_t C,
-                                               const std::vector<int64_t>& input_dims) const {
+Status Tokenizer::SeparatorTokenizeRow(const std::string& s, std::vector<re2::StringPiece>& row,
+                                       std::vector<re2::StringPiece>& tokens) const {
   using namespace re2;
-  std::vector<std::vector<StringPiece>> rows;
-  rows.reserve(N * C);
-
   // We do not constraint the search to match
   // on the beginning or end of the string
   const RE2::Anchor anchor = RE2::UNANCHORED;
 
-  // Scan all strings and attempt to find separators in them
-  // collect all the output tokens here
-  size_t max_tokens = 0;
-  auto X = ctx->Input<Tensor>(0);
-  auto const input_data = X->template Data<std::string>();
-  auto curr_input = input_data;
-  auto const last = input_data + N * C;
-  while (curr_input != last) {
-    const auto& s = *curr_input;
-    size_t utf8_chars = 0;  // length in utf8 chars
-    if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
-                       utf8_chars)) {
-      return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
-                    "Input string contains invalid utf8 chars: " + s);
-    }
+  size_t utf8_chars = 0;  // length in utf8 chars
+  if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
+                     utf8_chars)) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                  "Input string contains invalid utf8 chars: " + s);
+  }
 
-    std::vector<StringPiece> row{s};
-
-    for (const auto& sep : separators_) {
-      std::vector<StringPiece> tokens;
-      for (const auto& text : row) {
-        const auto end_pos = text.length();
-        size_t start_pos = 0;
-        StringPiece submatch;
-
-        bool match = true;
-        do {
-          match = sep->Match(text, start_pos, end_pos, anchor, &submatch, 1);
-          if (match) {
-            // Record  pos/len
-            assert(submatch.data() != nullptr);
-            size_t match_pos = submatch.data() - text.data();
-            assert(match_pos >= start_pos);
-            auto token_len = match_pos - start_pos;
-            utf8_chars = 0;
-            bool valid = utf8_len(reinterpret_cast<const unsigned char*>(text.data() + start_pos),
-                                  token_len, utf8_chars);
-            if (!valid) {
-              return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
-                            "Match contains invalid utf8 chars: " + submatch.as_string());
-            }
-            if (utf8_chars >= size_t(mincharnum_)) {
-              tokens.emplace_back(text.data() + start_pos, token_len);
-            }
-            // Update starting position
-            // Guard against empty string match
-            auto match_len = submatch.length();
-            if (match_len > 0) {
-              start_pos = match_pos + match_len;
-            } else {
-              size_t bytes = 0;
-              utf8_bytes(*submatch.data(), bytes);
-              start_pos = match_pos + bytes;
-            }
+  row.clear();
+  row.emplace_back(s);
+
+  for (const auto& sep : separators_) {
+    tokens.clear();
+    for (const auto& text : row) {
+      const auto end_pos = text.length();
+      size_t start_pos = 0;
+      StringPiece submatch;
+
+      bool match = true;
+      do {
+        match = sep->Match(text, start_pos, end_pos, anchor, &submatch, 1);
+        if (match) {
+          // Record  pos/len
+          assert(submatch.data() != nullptr);
+          size_t match_pos = submatch.data() - text.data();
+          assert(match_pos >= start_pos);
+          auto token_len = match_pos - start_pos;
+          utf8_chars = 0;
+          bool valid = utf8_len(reinterpret_cast<const unsigned char*>(text.data() + start_pos),
+                                token_len, utf8_chars);
+          if (!valid) {
+            return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                          "Match contains invalid utf8 chars: " + submatch.as_string());
+          }
+          if (utf8_chars >= size_t(mincharnum_)) {
+            tokens.emplace_back(text.data() + start_pos, token_len);
+          }
+          // Update starting position
+          // Guard against empty string match
+          auto match_len = submatch.length();
+          if (match_len > 0) {
+            start_pos = match_pos + match_len;
           } else {
-            // record trailing token
-            auto trailing_len = end_pos - start_pos;
-            utf8_chars = 0;
-            utf8_len(reinterpret_cast<const unsigned char*>(text.data() + start_pos),
-                     trailing_len, utf8_chars);
-            if (utf8_chars >= size_t(mincharnum_)) {
-              tokens.emplace_back(text.data() + start_pos, trailing_len);
-            }
+            size_t bytes = 0;
+            utf8_bytes(*submatch.data(), bytes);
+            start_pos = match_pos + bytes;
+          }
+        } else {
+          // record trailing token
+          auto trailing_len = end_pos - start_pos;
+          utf8_chars = 0;
+          utf8_len(reinterpret_cast<const unsigned char*>(text.data() + start_pos),
+                   trailing_len, utf8_chars);
+          if (utf8_chars >= size_t(mincharnum_)) {
+            tokens.emplace_back(text.data() + start_pos, trailing_len);
           }
-        } while (match);
-      }  // row
-      // Replace the row with the results of this tokenezation
-      row.swap(tokens);
-    }  // separators_
-    max_tokens = std::max(max_tokens, row.size());
-    rows.push_back(std::move(row));
-    ++curr_input;
+        }
+      } while (match);
+    }  // row
+    // Replace the row with the results of this tokenezation
+    row.swap(tokens);
+  }  // separators_
+
+  return Status::OK();
+}
+
+Status Tokenizer::SeparatorExpressionTokenizer(OpKernelContext* ctx,
+                                               size_t N, size_t C,
+                                               const std::vector<int64_t>& input_dims) const {
+  using namespace re2;
+  // Each input string is tokenized independently of the others (RE2 matching is
+  // thread safe on a const pattern), so contiguous shards of rows are distributed
+  // across the thread pool. Each shard collects its tokens into a single pool with
+  // a per-row offset table (see TokenShard), keeping the allocation count per batch
+  // proportional to the shard count rather than the row count, and the scratch rows
+  // used while re-splitting by successive separators are reused across a shard.
+  auto X = ctx->Input<Tensor>(0);
+  auto const input_data = X->template Data<std::string>();
+  const size_t num_strings = N * C;
+
+  const size_t num_shards = (num_strings + kShardRows - 1) / kShardRows;
+  std::vector<TokenShard> shards(num_shards);
+
+  concurrency::ThreadPool::TryBatchParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<int32_t>(num_shards),
+      [&](ptrdiff_t shard_idx) {
+        auto& shard = shards[shard_idx];
+        const size_t first_row = static_cast<size_t>(shard_idx) * kShardRows;
+        const size_t end_row = std::min(num_strings, first_row + kShardRows);
+        shard.row_begin.reserve(end_row - first_row + 1);
+
+        // scratch rows reused across the shard's input strings
+        std::vector<StringPiece> row;
+        std::vector<StringPiece> tokens;
+        for (size_t r = first_row; r < end_row; ++r) {
+          shard.row_begin.push_back(shard.pool.size());
+          shard.status = SeparatorTokenizeRow(input_data[r], row, tokens);
+          if (!shard.status.IsOK()) {
+            return;
+          }
+          shard.pool.insert(shard.pool.end(), row.begin(), row.end());
+        }
+        shard.row_begin.push_back(shard.pool.size());
+      },
+      0);
+
+  size_t max_tokens = 0;
+  for (const auto& shard : shards) {
+    if (!shard.status.IsOK()) {
+      return shard.status;
+    }
+    for (size_t r = 0, rows = shard.row_begin.size() - 1; r < rows; ++r) {
+      max_tokens = std::max(max_tokens, shard.row_begin[r + 1] - shard.row_begin[r]);
+    }
   }
 
   std::vector<int64_t> output_dims(input_dims);
@@ -294,39 +371,39 @@ Status Tokenizer::SeparatorExpressionTokenizer(OpKernelContext* ctx,
   auto output_tensor = ctx->Output(0, output_shape);
   auto const output_data = output_tensor->template MutableData<std::string>();
 
-#ifdef _DEBUG
-  const size_t max_output_index = N * C * max_tokens;
-#endif
-  size_t output_index = 0;
-  curr_input = input_data;
-  for (auto& row : rows) {
-#ifdef _DEBUG
-    size_t c_idx = output_index;
-#endif
-    if (mark_) {
-      (output_data + output_index)->assign(&start_text, 1);
-      ++output_index;
-    }
-    // Output tokens for this row
-    for (const auto& token : row) {
-      (output_data + output_index)->assign(token.data(), token.size());
-      ++output_index;
-    }
-    if (mark_) {
-      (output_data + output_index)->assign(&end_text, 1);
-      ++output_index;
-    }
-    const size_t pads = max_tokens - (mark_ * 2) - row.size();
-    for (size_t p = 0; p < pads; ++p) {
-      *(output_data + output_index) = pad_value_;
-      ++output_index;
-    }
-#ifdef _DEBUG
-    assert(output_index <= max_output_index);
-    assert((output_index - c_idx) <= max_tokens);
-#endif
-    ++curr_input;
-  }
+  // each input string owns a fixed max_tokens wide slice of the output so the
+  // rows can be written in parallel as well
+  concurrency::ThreadPool::TryBatchParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<int32_t>(num_strings),
+      [&, max_tokens](ptrdiff_t row_idx) {
+        const auto& shard = shards[row_idx / kShardRows];
+        const size_t local_row = static_cast<size_t>(row_idx) % kShardRows;
+        const size_t tokens_begin = shard.row_begin[local_row];
+        const size_t tokens_end = shard.row_begin[local_row + 1];
+        size_t output_index = row_idx * max_tokens;
+        if (mark_) {
+          (output_data + output_index)->assign(&start_text, 1);
+          ++output_index;
+        }
+        // Output tokens for this row
+        for (size_t t = tokens_begin; t < tokens_end; ++t) {
+          const auto& token = shard.pool[t];
+          (output_data + output_index)->assign(token.data(), token.size());
+          ++output_index;
+        }
+        if (mark_) {
+          (output_data + output_index)->assign(&end_text, 1);
+          ++output_index;
+        }
+        const size_t pads = max_tokens - (mark_ * 2) - (tokens_end - tokens_begin);
+        for (size_t p = 0; p < pads; ++p) {
+          *(output_data + output_index) = pad_value_;
+          ++output_index;
+        }
+        assert(output_index <= (static_cast<size_t>(row_idx) + 1) * max_tokens);
+      },
+      0);
+
   return Status::OK();
 }
 
@@ -334,67 +411,87 @@ Status Tokenizer::TokenExpression(OpKernelContext* ctx,
                                   size_t N, size_t C,
                                   const std::vector<int64_t>& input_dims) const {
   using namespace re2;
-  // Represents a token that will be output after
-  // first is the index, second is the size;
-  std::vector<std::vector<StringPiece>> tokens;
-  tokens.reserve(N * C);
-
-  size_t max_tokens = 0;
+  // Each input string is matched independently of the others (RE2 matching is
+  // thread safe on a const pattern), so contiguous shards of rows are distributed
+  // across the thread pool. Each shard collects its matches into a single pool with
+  // a per-row offset table (see TokenShard), keeping the allocation count per batch
+  // proportional to the shard count rather than the row count.
   auto X = ctx->Input<Tensor>(0);
   auto const input_data = X->template Data<std::string>();
-  auto curr_input = input_data;
-  auto const last = input_data + N * C;
+  const size_t num_strings = N * C;
+
+  const size_t num_shards = (num_strings + kShardRows - 1) / kShardRows;
+  std::vector<TokenShard> shards(num_shards);
 
   // We do not constraint the search to match
   // on the beginning or end of the string
   const RE2::Anchor anchor = RE2::UNANCHORED;
 
-  while (curr_input != last) {
-    const auto& s = *curr_input;
-
-    size_t utf8_chars = 0;
-    if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
-                       utf8_chars)) {
-      return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
-                    "Input string contains invalid utf8 chars: " + s);
-    }
+  concurrency::ThreadPool::TryBatchParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<int32_t>(num_shards),
+      [&](ptrdiff_t shard_idx) {
+        auto& shard = shards[shard_idx];
+        const size_t first_row = static_cast<size_t>(shard_idx) * kShardRows;
+        const size_t end_row = std::min(num_strings, first_row + kShardRows);
+        shard.row_begin.reserve(end_row - first_row + 1);
+
+        for (size_t r = first_row; r < end_row; ++r) {
+          shard.row_begin.push_back(shard.pool.size());
+          const auto& s = input_data[r];
+
+          size_t utf8_chars = 0;
+          if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
+                             utf8_chars)) {
+            shard.status = Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                                  "Input string contains invalid utf8 chars: " + s);
+            return;
+          }
 
-    tokens.emplace_back();
-    auto& row = tokens.back();
-
-    StringPiece text(s);
-    const auto end_pos = s.length();
-    size_t start_pos = 0;
-    StringPiece submatch;
-
-    bool match = true;
-    do {
-      match = regex_->Match(text, start_pos, end_pos, anchor, &submatch, 1);
-      if (match) {
-        // Record  pos/len
-        assert(submatch.data() != nullptr);
-        size_t match_pos = submatch.data() - s.data();
-        assert(match_pos >= start_pos);
-        // Guard against empty match and make
-        // sure we make progress either way
-        auto token_len = submatch.length();
-        utf8_chars = 0;
-        if (!utf8_len(reinterpret_cast<const unsigned char*>(submatch.data()), token_len, utf8_chars)) {
-          return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
-                        "Match contains invalid utf8 chars: " + submatch.as_string());
-        }
-        if (utf8_chars >= size_t(mincharnum_)) {
-          row.push_back(submatch);
-          start_pos = match_pos + token_len;
-        } else {
-          size_t bytes = 0;
-          utf8_bytes(*submatch.data(), bytes);
-          start_pos = match_pos + bytes;
+          StringPiece text(s);
+          const auto end_pos = s.length();
+          size_t start_pos = 0;
+          StringPiece submatch;
+
+          bool match = true;
+          do {
+            match = regex_->Match(text, start_pos, end_pos, anchor, &submatch, 1);
+            if (match) {
+              // Record  pos/len
+              assert(submatch.data() != nullptr);
+              size_t match_pos = submatch.data() - s.data();
+              assert(match_pos >= start_pos);
+              // Guard against empty match and make
+              // sure we make progress either way
+              auto token_len = submatch.length();
+              utf8_chars = 0;
+              if (!utf8_len(reinterpret_cast<const unsigned char*>(submatch.data()), token_len, utf8_chars)) {
+                shard.status = Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                                      "Match contains invalid utf8 chars: " + submatch.as_string());
+                return;
+              }
+              if (utf8_chars >= size_t(mincharnum_)) {
+                shard.pool.push_back(submatch);
+                start_pos = match_pos + token_len;
+              } else {
+                size_t bytes = 0;
+                utf8_bytes(*submatch.data(), bytes);
+                start_pos = match_pos + bytes;
+              }
+            }
+          } while (match);
         }
-      }
-    } while (match);
-    max_tokens = std::max(max_tokens, row.size());
-    ++curr_input;
+        shard.row_begin.push_back(shard.pool.size());
+      },
+      0);
+
+  size_t max_tokens = 0;
+  for (const auto& shard : shards) {
+    if (!shard.status.IsOK()) {
+      return shard.status;
+    }
+    for (size_t r = 0, rows = shard.row_begin.size() - 1; r < rows; ++r) {
+      max_tokens = std::max(max_tokens, shard.row_begin[r + 1] - shard.row_begin[r]);
+    }
   }
 
   // Check for empty output
@@ -418,40 +515,38 @@ Status Tokenizer::TokenExpression(OpKernelContext* ctx,
   auto output_tensor = ctx->Output(0, output_shape);
   auto const output_data = output_tensor->template MutableData<std::string>();
 
-#ifdef _DEBUG
-  const size_t max_output_index = N * C * max_tokens;
-#endif
-  curr_input = input_data;
-  size_t output_index = 0;
-  for (const auto& row : tokens) {
-    assert(curr_input != last);
-#ifdef _DEBUG
-    size_t c_idx = output_index;
-#endif
-    if (mark_) {
-      (output_data + output_index)->assign(&start_text, 1);
-      ++output_index;
-    }
-    // Output tokens for this row
-    for (const auto& token : row) {
-      (output_data + output_index)->assign(token.data(), token.length());
-      ++output_index;
-    }
-    if (mark_) {
-      (output_data + output_index)->assign(&end_text, 1);
-      ++output_index;
-    }
-    const size_t pads = max_tokens - (mark_ * 2) - row.size();
-    for (size_t p = 0; p < pads; ++p) {
-      *(output_data + output_index) = pad_value_;
-      ++output_index;
-    }
-#ifdef _DEBUG
-    assert(output_index <= max_output_index);
-    assert((output_index - c_idx) <= max_tokens);
-#endif
-    ++curr_input;
-  }
+  // each input string owns a fixed max_tokens wide slice of the output so the
+  // rows can be written in parallel as well
+  concurrency::ThreadPool::TryBatchParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<int32_t>(num_strings),
+      [&, max_tokens](ptrdiff_t row_idx) {
+        const auto& shard = shards[row_idx / kShardRows];
+        const size_t local_row = static_cast<size_t>(row_idx) % kShardRows;
+        const size_t tokens_begin = shard.row_begin[local_row];
+        const size_t tokens_end = shard.row_begin[local_row + 1];
+        size_t output_index = row_idx * max_tokens;
+        if (mark_) {
+          (output_data + output_index)->assign(&start_text, 1);
+          ++output_index;
+        }
+        // Output tokens for this row
+        for (size_t t = tokens_begin; t < tokens_end; ++t) {
+          const auto& token = shard.pool[t];
+          (output_data + output_index)->assign(token.data(), token.length());
+          ++output_index;
+        }
+        if (mark_) {
+          (output_data + output_index)->assign(&end_text, 1);
+          ++output_index;
+        }
+        const size_t pads = max_tokens - (mark_ * 2) - (tokens_end - tokens_begin);
+        for (size_t p = 0; p < pads; ++p) {
+          *(output_data + output_index) = pad_value_;
+          ++output_index;
+        }
+        assert(output_index <= (static_cast<size_t>(row_idx) + 1) * max_tokens);
+      },
+      0);
 
   return Status::OK();
 }
@@ -9,6 +9,7 @@
 #endif
 #include "unique.h"
 #include "core/providers/cpu/tensor/utils.h"
+#include <algorithm>
 
 namespace onnxruntime {
 namespace contrib {
@@ -36,14 +37,22 @@ Status Unique<float>::Compute(OpKernelContext* ctx) const {
   Tensor* output_idx = ctx->Output(1, input->Shape());
   int64_t* output_idx_data = output_idx->template MutableData<int64_t>();
 
+  // Size everything from the previous Run's unique count (plus a little slack) instead of the
+  // worst case - steady-state callers feed similarly shaped data every call, so after the first
+  // Run neither the vector nor the hash maps re-grow mid-scan. They still grow on demand if the
+  // data turns out to hold more unique elements than last time.
+  const size_t count_hint = std::max<size_t>(unique_count_hint_.load(std::memory_order_relaxed) + 16,
+                                             64);
+
   // container to hold the unique elements (in the order it was first seen)
   std::vector<float> unique_elements;
-  // number of unique elements is atmost number of elements in the raw data
-  unique_elements.reserve(num_elements);
+  unique_elements.reserve(std::min(count_hint, num_elements));
 
   // containers to store other metadata needed for other output tensors
   std::unordered_map<float, size_t> mapped_indices;
   std::unordered_map<float, size_t> element_counts;
+  mapped_indices.reserve(count_hint);
+  element_counts.reserve(count_hint);
 
   // processing
   for (size_t i = 0; i < num_elements; ++i) {
@@ -62,6 +71,8 @@ Status Unique<float>::Compute(OpKernelContext* ctx) const {
     }
   }
 
+  unique_count_hint_.store(unique_elements.size(), std::memory_order_relaxed);
+
   // 'uniques' output
   TensorShape output_shape({static_cast<int64_t>(unique_elements.size())});
   Tensor* output_uniques = ctx->Output(0, output_shape);
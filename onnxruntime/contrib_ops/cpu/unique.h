@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <atomic>
+
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
 #include "core/providers/cpu/tensor/pad.h"
@@ -14,6 +16,11 @@ class Unique final : public OpKernel {
   explicit Unique(const OpKernelInfo& op_kernel_info) : OpKernel(op_kernel_info) {}
 
   Status Compute(OpKernelContext* p_op_kernel_context) const override;
+
+ private:
+  // Number of unique elements found by the previous Run. Used to size the hash maps
+  // and the uniques buffer so steady-state calls don't rehash/re-grow while processing.
+  mutable std::atomic<size_t> unique_count_hint_{0};
 };
 
 }  // namespace contrib
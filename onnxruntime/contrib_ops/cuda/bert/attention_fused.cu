@@ -0,0 +1,221 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Fused attention kernel: computes softmax(QK'/sqrt(H))*V for one query row per thread block,
+// streaming over K/V in shared-memory tiles with an online (running max/sum) softmax. The
+// BxNxSxS* probability matrix is never materialized in global memory, which is what makes
+// the unfused GEMM+softmax+GEMM pipeline memory bound at long sequence lengths.
+
+#include <cub/cub.cuh>
+#include <cuda_fp16.h>
+#include <math_constants.h>
+#include "core/providers/cuda/cu_inc/common.cuh"
+#include "core/providers/cuda/cuda_common.h"
+#include "attention_impl.h"
+
+using namespace onnxruntime::cuda;
+using namespace cub;
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+// Number of keys processed per tile; also the thread block size.
+constexpr int kFusedAttentionTileSize = 64;
+
+// The per-thread output accumulator covers head_size elements with TileSize threads.
+constexpr int kFusedAttentionMaxHeadSize = 128;
+
+// Below this total sequence length the batched GEMMs fit in L2 and the tensor-core
+// cublas path wins; the fused kernel only pays off once the SxS* scratch spills.
+constexpr int kFusedAttentionMinSequenceLength = 512;
+
+bool CanUseFusedAttentionKernel(const int sequence_length,
+                                const int head_size,
+                                const bool use_raw_attention_mask,
+                                const void* past,
+                                const void* present) {
+  // Raw (2D/3D) attention masks and past/present state keep the unfused path; the fused
+  // kernel also stages its BxNxSxH result in scratch1, which holds S* elements per query
+  // row, hence the head_size <= sequence_length requirement.
+  return nullptr == past && nullptr == present &&
+         !use_raw_attention_mask &&
+         head_size <= kFusedAttentionMaxHeadSize &&
+         head_size <= sequence_length &&
+         sequence_length >= kFusedAttentionMinSequenceLength;
+}
+
+template <typename T, int TileSize>
+__global__ void FusedAttentionKernel(const int sequence_length,
+                                     const int head_size,
+                                     const float rsqrt_head_size,
+                                     const int* mask_end,
+                                     const int* mask_start,
+                                     const bool is_unidirectional,
+                                     const T* q,
+                                     const T* k,
+                                     const T* v,
+                                     T* output) {
+  // Shared memory layout: q row (head_size), tile probabilities (TileSize), then the
+  // K/V tile (TileSize rows padded to head_size + 1 floats to avoid bank conflicts in
+  // the dot-product reads). K and V reuse the same tile buffer, separated by barriers.
+  extern __shared__ float fused_attention_smem[];
+  float* q_shared = fused_attention_smem;
+  float* prob = q_shared + head_size;
+  float* kv_tile = prob + TileSize;
+  const int tile_stride = head_size + 1;
+
+  using BlockReduce = cub::BlockReduce<float, TileSize>;
+  __shared__ typename BlockReduce::TempStorage tmp_storage;
+  __shared__ float max_broadcast;
+  __shared__ float sum_broadcast;
+
+  const int batch = blockIdx.z;
+  const int query = blockIdx.x;
+  const int row_offset = ((batch * gridDim.y + blockIdx.y) * sequence_length + query) * head_size;
+  const T* k_head = k + (batch * gridDim.y + blockIdx.y) * sequence_length * head_size;
+  const T* v_head = v + (batch * gridDim.y + blockIdx.y) * sequence_length * head_size;
+
+  // Valid key range, following the same mask normalization as MaskedSoftmaxKernelSmall:
+  // an empty range attends to all words, and a unidirectional bound below valid_start
+  // leaves the [0, end_unid) prefix attended.
+  int valid_start = 0;
+  int valid_end = sequence_length;
+  if (nullptr != mask_end) {
+    valid_start = (nullptr != mask_start) ? max(0, mask_start[batch]) : 0;
+    valid_end = min(sequence_length, mask_end[batch]);
+    if (valid_start >= valid_end) {
+      valid_start = 0;
+      valid_end = sequence_length;
+    }
+  }
+  int prefix_end = 0;
+  if (is_unidirectional) {
+    const int end_unid = query + 1;  // no past state in the fused path, so S* == S
+    if (end_unid <= valid_start) {
+      prefix_end = end_unid;
+    } else {
+      valid_end = min(valid_end, end_unid);
+    }
+  }
+
+  // Scale is folded into q so each dot product pays it once.
+  for (int i = threadIdx.x; i < head_size; i += TileSize) {
+    q_shared[i] = float(q[row_offset + i]) * rsqrt_head_size;
+  }
+
+  float acc[kFusedAttentionMaxHeadSize / TileSize] = {0.f};
+  float running_max = -CUDART_INF_F;
+  float running_sum = 0.f;
+
+  for (int tile_start = 0; tile_start < sequence_length; tile_start += TileSize) {
+    const int tile_size = min(TileSize, sequence_length - tile_start);
+
+    __syncthreads();  // previous iteration is done reading kv_tile and prob
+    for (int i = threadIdx.x; i < tile_size * head_size; i += TileSize) {
+      kv_tile[(i / head_size) * tile_stride + (i % head_size)] = float(k_head[tile_start * head_size + i]);
+    }
+    __syncthreads();
+
+    const int key = tile_start + threadIdx.x;
+    const bool is_valid = threadIdx.x < tile_size &&
+                          ((key >= valid_start && key < valid_end) || key < prefix_end);
+    float score = -CUDART_INF_F;
+    if (is_valid) {
+      score = 0.f;
+      for (int i = 0; i < head_size; i++) {
+        score += q_shared[i] * kv_tile[threadIdx.x * tile_stride + i];
+      }
+    }
+
+    const float tile_max = BlockReduce(tmp_storage).Reduce(score, cub::Max());
+    if (threadIdx.x == 0) {
+      max_broadcast = max(running_max, tile_max);
+    }
+    __syncthreads();
+    const float new_max = max_broadcast;
+
+    // A fully masked tile before any valid key leaves new_max at -inf; keep the
+    // accumulators untouched in that case rather than computing exp(-inf - -inf).
+    float p = 0.f;
+    float correction = 0.f;
+    if (new_max > -CUDART_INF_F) {
+      p = is_valid ? expf(score - new_max) : 0.f;
+      correction = expf(running_max - new_max);
+    }
+    prob[threadIdx.x] = p;
+
+    const float tile_sum = BlockReduce(tmp_storage).Reduce(p, cub::Sum());
+    if (threadIdx.x == 0) {
+      sum_broadcast = tile_sum;
+    }
+    __syncthreads();
+
+    running_sum = running_sum * correction + sum_broadcast;
+    running_max = new_max;
+    for (int e = 0; e < kFusedAttentionMaxHeadSize / TileSize; e++) {
+      acc[e] *= correction;
+    }
+
+    for (int i = threadIdx.x; i < tile_size * head_size; i += TileSize) {
+      kv_tile[(i / head_size) * tile_stride + (i % head_size)] = float(v_head[tile_start * head_size + i]);
+    }
+    __syncthreads();
+
+    for (int e = 0; e < kFusedAttentionMaxHeadSize / TileSize; e++) {
+      const int h = threadIdx.x + e * TileSize;
+      if (h < head_size) {
+        float weighted = 0.f;
+        for (int j = 0; j < tile_size; j++) {
+          weighted += prob[j] * kv_tile[j * tile_stride + h];
+        }
+        acc[e] += weighted;
+      }
+    }
+  }
+
+  // The mask normalization above guarantees at least one valid key, so running_sum > 0.
+  const float sum_reverse = 1.f / running_sum;
+  for (int e = 0; e < kFusedAttentionMaxHeadSize / TileSize; e++) {
+    const int h = threadIdx.x + e * TileSize;
+    if (h < head_size) {
+      output[row_offset + h] = T(acc[e] * sum_reverse);
+    }
+  }
+}
+
+template <typename T>
+bool LaunchFusedAttention(cudaStream_t stream,
+                          const int sequence_length, const int batch_size, const int head_size, const int num_heads,
+                          const float rsqrt_head_size, const int* mask_end, const int* mask_start,
+                          const bool is_unidirectional,
+                          const T* q, const T* k, const T* v, T* output) {
+  constexpr int tile_size = kFusedAttentionTileSize;
+  const dim3 grid(sequence_length, num_heads, batch_size);
+  const size_t shared_bytes = (head_size + tile_size + tile_size * (head_size + 1)) * sizeof(float);
+  FusedAttentionKernel<T, tile_size><<<grid, tile_size, shared_bytes, stream>>>(
+      sequence_length, head_size, rsqrt_head_size, mask_end, mask_start, is_unidirectional, q, k, v, output);
+  return CUDA_CALL(cudaPeekAtLastError());
+}
+
+bool LaunchFusedAttentionKernel(cudaStream_t stream,
+                                const int sequence_length, const int batch_size, const int head_size, const int num_heads,
+                                const float rsqrt_head_size, const int* mask_end, const int* mask_start,
+                                const bool is_unidirectional,
+                                const float* q, const float* k, const float* v, float* output) {
+  return LaunchFusedAttention(stream, sequence_length, batch_size, head_size, num_heads,
+                              rsqrt_head_size, mask_end, mask_start, is_unidirectional, q, k, v, output);
+}
+
+bool LaunchFusedAttentionKernel(cudaStream_t stream,
+                                const int sequence_length, const int batch_size, const int head_size, const int num_heads,
+                                const float rsqrt_head_size, const int* mask_end, const int* mask_start,
+                                const bool is_unidirectional,
+                                const half* q, const half* k, const half* v, half* output) {
+  return LaunchFusedAttention(stream, sequence_length, batch_size, head_size, num_heads,
+                              rsqrt_head_size, mask_end, mask_start, is_unidirectional, q, k, v, output);
+}
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -105,9 +105,24 @@ bool QkvToContext(
   // Raw attention mask could be 2D (BxS) or 3D (BxSxS*)
   bool use_raw_attention_mask = (nullptr != mask_index && nullptr != mask_index_dims && mask_index_dims->size() >= 2);
 
+  const float rsqrt_head_size = 1.f / sqrt(static_cast<float>(head_size));
+
+  // Fused path: one kernel computes softmax(QK'/sqrt(H))*V with K/V streamed through
+  // shared-memory tiles and an online softmax, so the BxNxSxS* scores/probabilities
+  // never touch global memory. scratch1 stages the BxNxSxH result for the transpose.
+  if (CanUseFusedAttentionKernel(sequence_length, head_size, use_raw_attention_mask, past, present)) {
+    // mask_index here is 1D (or null): either (batch_size) or (2*batch_size) with start positions.
+    const int* mask_start = (nullptr != mask_index && mask_index_dims->at(0) > batch_size) ? mask_index + batch_size : nullptr;
+    if (!LaunchFusedAttentionKernel(stream, sequence_length, batch_size, head_size, num_heads,
+                                    rsqrt_head_size, mask_index, mask_start, is_unidirectional,
+                                    q, k, v, scratch1)) {
+      return false;
+    }
+    return LaunchTransCtx(stream, sequence_length, batch_size, head_size, num_heads, scratch1, output);
+  }
+
   // compute Q*K' (as K'*Q), scaled by 1/sqrt(H) and store in scratch1: BxNxSxS*
   // Q: BxNxSxH, K (present_k): BxNxS*xH, Q*K': BxNxSxS*
-  const float rsqrt_head_size = 1.f / sqrt(static_cast<float>(head_size));
   const int temp_matrix_size = sequence_length * all_sequence_length;
   // For raw attention mask, the scalar if 1/sqrt(H) is moved to softmax computation.
   T alpha = (T)(use_raw_attention_mask ? 1.0f : rsqrt_head_size);
@@ -55,6 +55,27 @@ cublasStatus_t inline CublasGemmStridedBatched(
       handle, transa, transb, m, n, k, &alpha, A, lda, strideA, B, ldb, strideB, &beta, C, ldc, strideC, batchCount);
 }
 
+// Whether the fused (tiled, online-softmax) attention kernel can handle this configuration.
+// It avoids materializing the BxNxSxS* probability matrix, but does not support raw
+// attention masks or past/present state.
+bool CanUseFusedAttentionKernel(const int sequence_length,
+                                const int head_size,
+                                const bool use_raw_attention_mask,
+                                const void* past,
+                                const void* present);
+
+bool LaunchFusedAttentionKernel(cudaStream_t stream,
+                                const int sequence_length, const int batch_size, const int head_size, const int num_heads,
+                                const float rsqrt_head_size, const int* mask_end, const int* mask_start,
+                                const bool is_unidirectional,
+                                const float* q, const float* k, const float* v, float* output);
+
+bool LaunchFusedAttentionKernel(cudaStream_t stream,
+                                const int sequence_length, const int batch_size, const int head_size, const int num_heads,
+                                const float rsqrt_head_size, const int* mask_end, const int* mask_start,
+                                const bool is_unidirectional,
+                                const half* q, const half* k, const half* v, half* output);
+
 bool LaunchTransCtx(cudaStream_t stream,
                     const int sequence_length, const int batch_size, const int head_size, const int num_heads,
                     const float* input, float* output);
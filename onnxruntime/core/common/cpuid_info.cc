@@ -5,6 +5,24 @@
 #define PLATFORM_X86
 #endif
 
+#if defined(_M_ARM64) || defined(__aarch64__)
+#define PLATFORM_ARM64
+#endif
+
+#if defined(PLATFORM_ARM64) && defined(__linux__)
+#include <sys/auxv.h>
+
+// Define the hardware capability bits for older toolchains that do not supply
+// them. The kernel unconditionally reports these bits when the features are
+// available.
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+#ifndef HWCAP2_SVE2
+#define HWCAP2_SVE2 (1 << 1)
+#endif
+#endif
+
 #if defined(PLATFORM_X86)
 #include <memory>
 #include <mutex>
@@ -71,6 +89,12 @@ CPUIDInfo::CPUIDInfo() noexcept {
       }
     }
   }
+#elif defined(PLATFORM_ARM64) && defined(__linux__)
+  const unsigned long hwcap = getauxval(AT_HWCAP);
+  has_arm_sve_ = (hwcap & HWCAP_SVE) != 0;
+
+  const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+  has_arm_sve2_ = (hwcap2 & HWCAP2_SVE2) != 0;
 #endif
 }
 
@@ -18,6 +18,8 @@ class CPUIDInfo {
   bool HasAVX512Skylake() const { return has_avx512_skylake_; }
   bool HasF16C() const { return has_f16c_; }
   bool HasSSE3() const { return has_sse3_; }
+  bool HasArmSVE() const { return has_arm_sve_; }
+  bool HasArmSVE2() const { return has_arm_sve2_; }
 
  private:
   CPUIDInfo() noexcept;
@@ -27,6 +29,8 @@ class CPUIDInfo {
   bool has_avx512_skylake_{false};
   bool has_f16c_{false};
   bool has_sse3_{false};
+  bool has_arm_sve_{false};
+  bool has_arm_sve2_{false};
 };
 
 }  // namespace onnxruntime
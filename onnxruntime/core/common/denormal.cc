@@ -5,6 +5,10 @@
 #define PLATFORM_X86
 #endif
 
+#if defined(_M_ARM64) || defined(__aarch64__)
+#define PLATFORM_ARM64
+#endif
+
 #if defined(PLATFORM_X86)
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -16,6 +20,14 @@
 #include <x86intrin.h>
 #define DENORMAL_INTRINC
 #endif
+#elif defined(PLATFORM_ARM64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define DENORMAL_FPCR
+#elif defined(__clang__) || defined(__GNUC__)
+#include <cstdint>
+#define DENORMAL_FPCR
+#endif
 #endif
 
 #include "core/common/common.h"
@@ -36,6 +48,22 @@ bool SetDenormalAsZero(bool on) {
     }
     return true;
   }
+#elif defined(DENORMAL_FPCR)
+  // On aarch64, flush-to-zero is bit 24 (FZ) of the FPCR register; there is
+  // no separate denormals-are-zero control.  The register is per-thread, so
+  // like MXCSR this takes effect only on the calling thread.
+  constexpr uint64_t fpcr_fz = uint64_t{1} << 24;
+#if defined(_MSC_VER)
+  uint64_t fpcr = _ReadStatusReg(ARM64_FPCR);
+  fpcr = on ? (fpcr | fpcr_fz) : (fpcr & ~fpcr_fz);
+  _WriteStatusReg(ARM64_FPCR, fpcr);
+#else
+  uint64_t fpcr;
+  __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+  fpcr = on ? (fpcr | fpcr_fz) : (fpcr & ~fpcr_fz);
+  __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#endif
+  return true;
 #else
   ORT_UNUSED_PARAMETER(on);
 #endif
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+// Vector-like container that stores up to N elements inline and only touches the heap
+// when the size grows past N. Used for small per-node structures on the execution hot
+// path where the typical element count is known and small. Supports just the interface
+// those call sites need rather than being a std::vector drop-in, which keeps it small
+// enough to reason about; extend it as callers require.
+template <typename T, size_t N>
+class InlinedVector {
+ public:
+  static_assert(N > 0, "Inline capacity must be non-zero.");
+
+  using value_type = T;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  InlinedVector() noexcept = default;
+
+  ~InlinedVector() {
+    clear();
+    if (data_ != InlineData()) {
+      ::operator delete(data_);
+    }
+  }
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(InlinedVector);
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_t size() const noexcept { return size_; }
+  size_t capacity() const noexcept { return capacity_; }
+
+  T* data() noexcept { return data_; }
+  const T* data() const noexcept { return data_; }
+
+  iterator begin() noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  const_iterator cbegin() const noexcept { return data_; }
+  const_iterator cend() const noexcept { return data_ + size_; }
+
+  T& operator[](size_t idx) {
+    assert(idx < size_);
+    return data_[idx];
+  }
+
+  const T& operator[](size_t idx) const {
+    assert(idx < size_);
+    return data_[idx];
+  }
+
+  T& back() {
+    assert(size_ > 0);
+    return data_[size_ - 1];
+  }
+
+  const T& back() const {
+    assert(size_ > 0);
+    return data_[size_ - 1];
+  }
+
+  void reserve(size_t new_capacity) {
+    if (new_capacity > capacity_) {
+      Grow(new_capacity);
+    }
+  }
+
+  void push_back(const T& value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      Grow(capacity_ * 2);
+    }
+
+    T* entry = new (data_ + size_) T(std::forward<Args>(args)...);
+    ++size_;
+    return *entry;
+  }
+
+  void clear() {
+    for (size_t i = 0; i < size_; ++i) {
+      data_[i].~T();
+    }
+    size_ = 0;
+  }
+
+ private:
+  T* InlineData() noexcept { return reinterpret_cast<T*>(&inline_storage_); }
+
+  void Grow(size_t new_capacity) {
+    T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+    for (size_t i = 0; i < size_; ++i) {
+      new (new_data + i) T(std::move(data_[i]));
+      data_[i].~T();
+    }
+
+    if (data_ != InlineData()) {
+      ::operator delete(data_);
+    }
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type inline_storage_;
+  T* data_{InlineData()};
+  size_t size_{0};
+  size_t capacity_{N};
+};
+
+}  // namespace onnxruntime
@@ -8,6 +8,7 @@ namespace profiling {
 using namespace std::chrono;
 
 std::atomic<size_t> Profiler::global_max_num_events_{1000 * 1000};
+std::atomic<uint64_t> Profiler::next_flow_id_{1};
 
 #ifdef ENABLE_STATIC_PROFILER_INSTANCE
 Profiler* Profiler::instance_ = nullptr;
@@ -66,15 +67,39 @@ void Profiler::EndTimeAndRecordEvent(EventCategory category,
   long long dur = TimeDiffMicroSeconds(start_time);
   long long ts = TimeDiffMicroSeconds(profiling_start_time_, start_time);
 
+  //TODO: sync_gpu if needed.
+  RecordEvent(EventRecord(category, logging::GetProcessId(),
+                          logging::GetThreadId(), event_name, ts, dur, {event_args.begin(), event_args.end()}));
+}
+
+void Profiler::EndTimeAndRecordEventWithFlow(EventCategory category,
+                                             const std::string& event_name,
+                                             const TimePoint& start_time,
+                                             uint64_t flow_id,
+                                             bool is_flow_source,
+                                             const std::initializer_list<std::pair<std::string, std::string>>& event_args) {
+  long long dur = TimeDiffMicroSeconds(start_time);
+  long long ts = TimeDiffMicroSeconds(profiling_start_time_, start_time);
+
   EventRecord event(category, logging::GetProcessId(),
                     logging::GetThreadId(), event_name, ts, dur, {event_args.begin(), event_args.end()});
+  event.bind_id = flow_id;
+  event.flow_out = is_flow_source;
+  event.flow_in = !is_flow_source;
+  RecordEvent(std::move(event));
+}
+
+uint64_t Profiler::NextFlowId() {
+  return next_flow_id_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Profiler::RecordEvent(EventRecord&& event) {
   if (profile_with_logger_) {
     custom_logger_->SendProfileEvent(event);
   } else {
-    //TODO: sync_gpu if needed.
     std::lock_guard<OrtMutex> lock(mutex_);
     if (events_.size() < max_num_events_) {
-      events_.emplace_back(event);
+      events_.emplace_back(std::move(event));
     } else {
       if (session_logger_ && !max_events_reached) {
         LOGS(*session_logger_, ERROR)
@@ -109,6 +134,16 @@ std::string Profiler::EndProfiling() {
     profile_stream_ << "\"dur\" :" << rec.dur << ",";
     profile_stream_ << "\"ts\" :" << rec.ts << ",";
     profile_stream_ << R"("ph" : "X",)";
+    if (rec.bind_id != 0) {
+      // The trace format specifies bind_id as a hex string.
+      profile_stream_ << R"("bind_id" :"0x)" << std::hex << rec.bind_id << std::dec << "\",";
+      if (rec.flow_out) {
+        profile_stream_ << R"("flow_out" : true,)";
+      }
+      if (rec.flow_in) {
+        profile_stream_ << R"("flow_in" : true,)";
+      }
+    }
     profile_stream_ << R"("name" :")" << rec.name << "\",";
     profile_stream_ << "\"args\" : {";
     bool is_first_arg = true;
@@ -78,6 +78,24 @@ class Profiler {
                              const std::initializer_list<std::pair<std::string, std::string>>& event_args = {},
                              bool sync_gpu = false);
 
+  /*
+  Record a single event that participates in a chrome tracing flow. The event
+  recorded with is_flow_source set produces the flow; the event recorded with
+  the same flow_id on the consuming side (typically another thread) completes
+  it, and the trace viewer draws an arrow between the two.
+  */
+  void EndTimeAndRecordEventWithFlow(EventCategory category,
+                                     const std::string& event_name,
+                                     const TimePoint& start_time,
+                                     uint64_t flow_id,
+                                     bool is_flow_source,
+                                     const std::initializer_list<std::pair<std::string, std::string>>& event_args = {});
+
+  /*
+  Produce a process-wide unique non-zero id tying a flow-producing event to its consumer.
+  */
+  static uint64_t NextFlowId();
+
   /*
   Write profile data to the given stream in chrome format defined below.
   https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview#
@@ -111,6 +129,16 @@ class Profiler {
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Profiler);
 
+  /*
+  Store a fully built record, or forward it to the custom logger when one is set.
+  */
+  void RecordEvent(EventRecord&& event);
+
+  /**
+   * Counter backing NextFlowId(). Starts at 1 so 0 can mean "no flow".
+   */
+  static std::atomic<uint64_t> next_flow_id_;
+
   /**
    * The maximum number of profiler records to collect.
    * This value is used to initialize the per-profiler maximum.
@@ -13,6 +13,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <chrono>
 #include <memory>
 
 #include "core/platform/threadpool.h"
@@ -155,11 +156,35 @@ ThreadPool::ThreadPool(Env* env,
                                                        *env,
                                                        thread_options_);
     underlying_threadpool_ = extended_eigen_threadpool_.get();
+    MeasureDispatchOverhead();
   }
 }
 
 ThreadPool::~ThreadPool() = default;
 
+void ThreadPool::MeasureDispatchOverhead() {
+  // Run a handful of empty two-shard loops through the pool and keep the
+  // fastest observation.  Taking the minimum rejects interference from the
+  // OS scheduler, and from worker threads that are still starting up.
+  constexpr int num_samples = 10;
+  for (int i = 0; i < num_samples; i++) {
+    auto start = std::chrono::high_resolution_clock::now();
+    RunInParallel([](unsigned) {}, 2);
+    auto sample_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start)
+            .count());
+    if (i == 0 || sample_ns < dispatch_overhead_ns_) {
+      dispatch_overhead_ns_ = sample_ns;
+    }
+  }
+  // Guard against clocks too coarse to time a single dispatch; a value of
+  // zero would disable the overhead checks entirely.
+  if (dispatch_overhead_ns_ < 1.0) {
+    dispatch_overhead_ns_ = 1.0;
+  }
+}
+
 // Base case for parallel loops, running iterations 0..total, divided into blocks
 // of block_size iterations, and calling into a function that takes a start..end
 // range of indices to run.
@@ -181,6 +206,14 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
   int num_work_items = static_cast<int>(std::min(static_cast<std::ptrdiff_t>(d_of_p), num_blocks));
   assert(num_work_items > 0);
 
+  // Degenerate fork-join with no workers to enlist (e.g. under a
+  // degree-of-parallelism limit): run the loop inline without paying for the
+  // parallel-section bookkeeping in RunInParallel.
+  if (num_work_items == 1) {
+    fn(0, total);
+    return;
+  }
+
   LoopCounter lc(total, block_size);
   std::function<void(unsigned)> run_work = [&](unsigned idx) {
     unsigned my_home_shard = lc.GetHomeShard(idx);
@@ -214,6 +247,18 @@ void ThreadPool::Schedule(std::function<void()> fn) {
   }
 }
 
+void ThreadPool::Schedule(std::function<void()> fn, TaskPriority priority) {
+  if (underlying_threadpool_) {
+    if (priority == TaskPriority::kHigh) {
+      underlying_threadpool_->ScheduleHighPriority(std::move(fn));
+    } else {
+      underlying_threadpool_->Schedule(std::move(fn));
+    }
+  } else {
+    fn();
+  }
+}
+
 thread_local ThreadPool::ParallelSection *ThreadPool::ParallelSection::current_parallel_section{nullptr};
 
 ThreadPool::ParallelSection::ParallelSection(ThreadPool *tp) {
@@ -246,6 +291,8 @@ ThreadPool::ParallelSection::~ParallelSection() {
 
 void ThreadPool::RunInParallel(std::function<void(unsigned idx)> fn, unsigned n) {
   if (underlying_threadpool_) {
+    num_parallel_regions_.fetch_add(1, std::memory_order_relaxed);
+    region_degree_sum_.fetch_add(n, std::memory_order_relaxed);
     if (ThreadPool::ParallelSection::current_parallel_section) {
       underlying_threadpool_->RunInParallelSection(*(ThreadPool::ParallelSection::current_parallel_section->ps_.get()),
                                                    std::move(fn),
@@ -280,6 +327,11 @@ bool ThreadPool::ShouldParallelizeLoop(const std::ptrdiff_t num_iterations,
 
 using CostModel = Eigen::TensorCostModel<Eigen::ThreadPoolDevice>;
 
+// Factor by which the estimated cost of a loop must exceed the measured
+// dispatch overhead before each additional thread is enlisted.  A loop that
+// cannot repay the fan-out cost this many times over runs inline instead.
+static constexpr double DISPATCH_OVERHEAD_MULTIPLIER = 4.0;
+
 // Calculates block size based on (1) the iteration cost and (2) parallel
 // efficiency. We want blocks to be not too small to mitigate parallelization
 // overheads; not too large to mitigate tail effect and potential load
@@ -351,6 +403,24 @@ void ThreadPool::ParallelFor(std::ptrdiff_t n, const TensorOpCost& c,
     return;
   }
 
+  // The cost model above knows the per-iteration cost but assumes that
+  // dispatching work to the pool is free.  Compare the estimated cost of the
+  // whole loop against the dispatch overhead measured when the pool was
+  // created, treating the per-iteration cycle estimate as nanoseconds (a
+  // deliberately conservative clock assumption, so that the check errs on the
+  // side of parallelizing).  Each thread enlisted beyond the caller must bring
+  // a comfortable multiple of the dispatch overhead in work; loops too small
+  // to afford a second thread run inline.
+  const double loop_cost_ns = static_cast<double>(n) *
+      (cost.compute_cycles() + 0.5 * (cost.bytes_loaded() + cost.bytes_stored()));
+  const double shard_cost_ns = DISPATCH_OVERHEAD_MULTIPLIER * dispatch_overhead_ns_;
+  const int affordable_d_of_p = static_cast<int>(1.0 + loop_cost_ns / shard_cost_ns);
+  if (affordable_d_of_p < 2) {
+    f(0, n);
+    return;
+  }
+  d_of_p = std::min(d_of_p, affordable_d_of_p);
+
   ptrdiff_t block = CalculateParallelForBlock(n, cost, nullptr, d_of_p);
   ParallelForFixedBlockSizeScheduling(n, block, f);
 }
@@ -364,6 +434,21 @@ bool ThreadPool::ShouldParallelize(const concurrency::ThreadPool* tp) {
   return (DegreeOfParallelism(tp) != 1);
 }
 
+// Per-thread cap on loop degree-of-parallelism (0 = no cap).  Installed via
+// DegreeOfParallelismLimit for the duration of a Run and consulted by
+// DegreeOfParallelism below.  Thread-local state lets concurrent Runs
+// against a shared pool carry different limits.
+static thread_local int current_dop_limit = 0;
+
+ThreadPool::DegreeOfParallelismLimit::DegreeOfParallelismLimit(int limit)
+    : previous_limit_(current_dop_limit) {
+  current_dop_limit = limit;
+}
+
+ThreadPool::DegreeOfParallelismLimit::~DegreeOfParallelismLimit() {
+  current_dop_limit = previous_limit_;
+}
+
 int ThreadPool::DegreeOfParallelism(const concurrency::ThreadPool* tp) {
 #ifdef _OPENMP
   // When using OpenMP, omp_get_num_threads() returns the number of threads in the
@@ -371,12 +456,37 @@ int ThreadPool::DegreeOfParallelism(const concurrency::ThreadPool* tp) {
   // across the number of threads configured.  Otherwise, given that we do not
   // use nested parallelism, we do not parallelise further.
   ORT_UNUSED_PARAMETER(tp);
-  return (omp_get_num_threads() == 1) ? omp_get_max_threads() : 1;
+  int d_of_p = (omp_get_num_threads() == 1) ? omp_get_max_threads() : 1;
 #else
   // When not using OpenMP, we parallelise over the N threads created by the pool
   // tp, plus 1 for the thread entering a loop.
-  return tp ? (tp->NumThreads()+1) : 1;
+  int d_of_p = tp ? (tp->NumThreads()+1) : 1;
 #endif
+  const int limit = current_dop_limit;
+  return (limit > 0 && limit < d_of_p) ? limit : d_of_p;
+}
+
+int ThreadPool::NumQueuedTasks(const concurrency::ThreadPool* tp) {
+  if (tp && tp->underlying_threadpool_) {
+    return tp->underlying_threadpool_->NumQueuedTasks();
+  }
+  return 0;
+}
+
+bool ThreadPool::TryRunPendingTask(concurrency::ThreadPool* tp) {
+  if (tp && tp->underlying_threadpool_) {
+    return tp->underlying_threadpool_->TryRunPendingTask();
+  }
+  return false;
+}
+
+void ThreadPool::GetStats(const concurrency::ThreadPool* tp, ThreadPoolStats& stats) {
+  stats = ThreadPoolStats();
+  if (tp && tp->underlying_threadpool_) {
+    tp->underlying_threadpool_->GetStats(stats);
+    stats.num_parallel_regions = tp->num_parallel_regions_.load(std::memory_order_relaxed);
+    stats.region_degree_sum = tp->region_degree_sum_.load(std::memory_order_relaxed);
+  }
 }
 
 // Return the number of threads created by the pool.
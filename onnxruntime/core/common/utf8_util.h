@@ -5,6 +5,9 @@
 
 #include "core/common/common.h"
 
+#include <cstdint>
+#include <cstring>
+
 namespace onnxruntime {
 namespace utf8_util {
 
@@ -31,10 +34,37 @@ inline bool utf8_bytes(unsigned char ch, size_t& len) {
   return false;
 }
 
+// Returns the length of the leading run of ASCII characters.
+// The high bits are tested a word sized chunk at a time so the common
+// mostly-ASCII case is classified without per-byte branching.
+inline size_t utf8_ascii_run(const unsigned char* s, size_t len) {
+  size_t idx = 0;
+  uint64_t chunk;
+  while (idx + sizeof(chunk) <= len) {
+    memcpy(&chunk, s + idx, sizeof(chunk));
+    if ((chunk & 0x8080808080808080ull) != 0) {
+      break;
+    }
+    idx += sizeof(chunk);
+  }
+  while (idx < len && s[idx] < 0x80u) {
+    ++idx;
+  }
+  return idx;
+}
+
 // Computes length of the utf8 string in characters
 inline bool utf8_len(const unsigned char* s, size_t bytes, size_t& len) {
   size_t result = 0;
   while (bytes > 0) {
+    // fast-forward over ASCII, which is one character per byte
+    const size_t ascii_run = utf8_ascii_run(s, bytes);
+    s += ascii_run;
+    bytes -= ascii_run;
+    result += ascii_run;
+    if (bytes == 0) {
+      break;
+    }
     size_t char_bytes = 0;
     bool valid = utf8_bytes(*s, char_bytes);
     if (!valid || bytes < char_bytes) {
@@ -52,6 +82,14 @@ inline bool utf8_validate(const unsigned char* s, size_t len, size_t& utf8_chars
   size_t utf8_len = 0;
   size_t idx = 0;
   while (idx < len) {
+    // ASCII characters need no continuation byte checks, so runs of them are
+    // validated a word sized chunk at a time.
+    const size_t ascii_run = utf8_ascii_run(s + idx, len - idx);
+    idx += ascii_run;
+    utf8_len += ascii_run;
+    if (idx >= len) {
+      break;
+    }
     size_t bytes = 0;
     auto ch = s[idx];
     if (utf8_bytes(ch, bytes)) {
@@ -45,6 +45,12 @@ struct TypeInfoBuilder;
 struct OperatorSetId;
 struct OperatorSetIdBuilder;
 
+struct CompressedBlock;
+struct CompressedBlockBuilder;
+
+struct CompressedData;
+struct CompressedDataBuilder;
+
 struct Tensor;
 struct TensorBuilder;
 
@@ -63,12 +69,32 @@ struct ModelBuilder;
 struct KernelCreateInfos;
 struct KernelCreateInfosBuilder;
 
+struct ValueLocation;
+struct ValueLocationBuilder;
+
+struct AllocationPlan;
+struct AllocationPlanBuilder;
+
+struct NodeExecutionPlan;
+
+struct ExecutionPlan;
+struct ExecutionPlanBuilder;
+
 struct SubGraphSessionState;
 struct SubGraphSessionStateBuilder;
 
 struct SessionState;
 struct SessionStateBuilder;
 
+struct PrePackedBuffer;
+struct PrePackedBufferBuilder;
+
+struct PrePackedWeight;
+struct PrePackedWeightBuilder;
+
+struct PrePackedWeightsData;
+struct PrePackedWeightsDataBuilder;
+
 struct InferenceSession;
 struct InferenceSessionBuilder;
 
@@ -328,6 +354,54 @@ template<> struct TypeInfoValueTraits<onnxruntime::experimental::fbs::MapType> {
 bool VerifyTypeInfoValue(flatbuffers::Verifier &verifier, const void *obj, TypeInfoValue type);
 bool VerifyTypeInfoValueVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
 
+enum class AllocationKind : int8_t {
+  NotSet = -1,
+  Allocate = 0,
+  Reuse = 1,
+  PreExisting = 2,
+  AllocateStatically = 3,
+  AllocateOutput = 4,
+  Share = 5,
+  SlicedView = 6,
+  MIN = NotSet,
+  MAX = SlicedView
+};
+
+inline const AllocationKind (&EnumValuesAllocationKind())[8] {
+  static const AllocationKind values[] = {
+    AllocationKind::NotSet,
+    AllocationKind::Allocate,
+    AllocationKind::Reuse,
+    AllocationKind::PreExisting,
+    AllocationKind::AllocateStatically,
+    AllocationKind::AllocateOutput,
+    AllocationKind::Share,
+    AllocationKind::SlicedView
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesAllocationKind() {
+  static const char * const names[9] = {
+    "NotSet",
+    "Allocate",
+    "Reuse",
+    "PreExisting",
+    "AllocateStatically",
+    "AllocateOutput",
+    "Share",
+    "SlicedView",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameAllocationKind(AllocationKind e) {
+  if (flatbuffers::IsOutRange(e, AllocationKind::NotSet, AllocationKind::SlicedView)) return "";
+  const size_t index = static_cast<size_t>(static_cast<int8_t>(e) - static_cast<int8_t>(AllocationKind::NotSet));
+  return EnumNamesAllocationKind()[index];
+}
+
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) EdgeEnd FLATBUFFERS_FINAL_CLASS {
  private:
   uint32_t node_index_;
@@ -355,6 +429,33 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) EdgeEnd FLATBUFFERS_FINAL_CLASS {
 };
 FLATBUFFERS_STRUCT_END(EdgeEnd, 12);
 
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) NodeExecutionPlan FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t node_index_;
+  int32_t free_from_index_;
+  int32_t free_to_index_;
+
+ public:
+  NodeExecutionPlan() {
+    memset(static_cast<void *>(this), 0, sizeof(NodeExecutionPlan));
+  }
+  NodeExecutionPlan(uint32_t _node_index, int32_t _free_from_index, int32_t _free_to_index)
+      : node_index_(flatbuffers::EndianScalar(_node_index)),
+        free_from_index_(flatbuffers::EndianScalar(_free_from_index)),
+        free_to_index_(flatbuffers::EndianScalar(_free_to_index)) {
+  }
+  uint32_t node_index() const {
+    return flatbuffers::EndianScalar(node_index_);
+  }
+  int32_t free_from_index() const {
+    return flatbuffers::EndianScalar(free_from_index_);
+  }
+  int32_t free_to_index() const {
+    return flatbuffers::EndianScalar(free_to_index_);
+  }
+};
+FLATBUFFERS_STRUCT_END(NodeExecutionPlan, 12);
+
 struct Shape FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef ShapeBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
@@ -1236,6 +1337,177 @@ inline flatbuffers::Offset<OperatorSetId> CreateOperatorSetIdDirect(
       version);
 }
 
+enum class CompressionType : int8_t {
+  NONE = 0,
+  DEFLATE = 1,
+  MIN = NONE,
+  MAX = DEFLATE
+};
+
+inline const CompressionType (&EnumValuesCompressionType())[2] {
+  static const CompressionType values[] = {
+    CompressionType::NONE,
+    CompressionType::DEFLATE
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCompressionType() {
+  static const char * const names[3] = {
+    "NONE",
+    "DEFLATE",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCompressionType(CompressionType e) {
+  if (flatbuffers::IsOutRange(e, CompressionType::NONE, CompressionType::DEFLATE)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCompressionType()[index];
+}
+
+struct CompressedBlock FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef CompressedBlockBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DATA = 4
+  };
+  const flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct CompressedBlockBuilder {
+  typedef CompressedBlock Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(CompressedBlock::VT_DATA, data);
+  }
+  explicit CompressedBlockBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  CompressedBlockBuilder &operator=(const CompressedBlockBuilder &);
+  flatbuffers::Offset<CompressedBlock> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<CompressedBlock>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<CompressedBlock> CreateCompressedBlock(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
+  CompressedBlockBuilder builder_(_fbb);
+  builder_.add_data(data);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<CompressedBlock> CreateCompressedBlockDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return onnxruntime::experimental::fbs::CreateCompressedBlock(
+      _fbb,
+      data__);
+}
+
+struct CompressedData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef CompressedDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_COMPRESSION_TYPE = 4,
+    VT_UNCOMPRESSED_LENGTH = 6,
+    VT_BLOCK_LENGTH = 8,
+    VT_BLOCKS = 10
+  };
+  onnxruntime::experimental::fbs::CompressionType compression_type() const {
+    return static_cast<onnxruntime::experimental::fbs::CompressionType>(GetField<int8_t>(VT_COMPRESSION_TYPE, 0));
+  }
+  uint64_t uncompressed_length() const {
+    return GetField<uint64_t>(VT_UNCOMPRESSED_LENGTH, 0);
+  }
+  uint64_t block_length() const {
+    return GetField<uint64_t>(VT_BLOCK_LENGTH, 0);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedBlock>> *blocks() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedBlock>> *>(VT_BLOCKS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_COMPRESSION_TYPE) &&
+           VerifyField<uint64_t>(verifier, VT_UNCOMPRESSED_LENGTH) &&
+           VerifyField<uint64_t>(verifier, VT_BLOCK_LENGTH) &&
+           VerifyOffset(verifier, VT_BLOCKS) &&
+           verifier.VerifyVector(blocks()) &&
+           verifier.VerifyVectorOfTables(blocks()) &&
+           verifier.EndTable();
+  }
+};
+
+struct CompressedDataBuilder {
+  typedef CompressedData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_compression_type(onnxruntime::experimental::fbs::CompressionType compression_type) {
+    fbb_.AddElement<int8_t>(CompressedData::VT_COMPRESSION_TYPE, static_cast<int8_t>(compression_type), 0);
+  }
+  void add_uncompressed_length(uint64_t uncompressed_length) {
+    fbb_.AddElement<uint64_t>(CompressedData::VT_UNCOMPRESSED_LENGTH, uncompressed_length, 0);
+  }
+  void add_block_length(uint64_t block_length) {
+    fbb_.AddElement<uint64_t>(CompressedData::VT_BLOCK_LENGTH, block_length, 0);
+  }
+  void add_blocks(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedBlock>>> blocks) {
+    fbb_.AddOffset(CompressedData::VT_BLOCKS, blocks);
+  }
+  explicit CompressedDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  CompressedDataBuilder &operator=(const CompressedDataBuilder &);
+  flatbuffers::Offset<CompressedData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<CompressedData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<CompressedData> CreateCompressedData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    onnxruntime::experimental::fbs::CompressionType compression_type = onnxruntime::experimental::fbs::CompressionType::NONE,
+    uint64_t uncompressed_length = 0,
+    uint64_t block_length = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedBlock>>> blocks = 0) {
+  CompressedDataBuilder builder_(_fbb);
+  builder_.add_block_length(block_length);
+  builder_.add_uncompressed_length(uncompressed_length);
+  builder_.add_blocks(blocks);
+  builder_.add_compression_type(compression_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<CompressedData> CreateCompressedDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    onnxruntime::experimental::fbs::CompressionType compression_type = onnxruntime::experimental::fbs::CompressionType::NONE,
+    uint64_t uncompressed_length = 0,
+    uint64_t block_length = 0,
+    const std::vector<flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedBlock>> *blocks = nullptr) {
+  auto blocks__ = blocks ? _fbb.CreateVector<flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedBlock>>(*blocks) : 0;
+  return onnxruntime::experimental::fbs::CreateCompressedData(
+      _fbb,
+      compression_type,
+      uncompressed_length,
+      block_length,
+      blocks__);
+}
+
 struct Tensor FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef TensorBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
@@ -1244,7 +1516,8 @@ struct Tensor FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_DIMS = 8,
     VT_DATA_TYPE = 10,
     VT_RAW_DATA = 12,
-    VT_STRING_DATA = 14
+    VT_STRING_DATA = 14,
+    VT_COMPRESSED_RAW_DATA = 16
   };
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
@@ -1264,6 +1537,9 @@ struct Tensor FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *string_data() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_STRING_DATA);
   }
+  const onnxruntime::experimental::fbs::CompressedData *compressed_raw_data() const {
+    return GetPointer<const onnxruntime::experimental::fbs::CompressedData *>(VT_COMPRESSED_RAW_DATA);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_NAME) &&
@@ -1278,6 +1554,8 @@ struct Tensor FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_STRING_DATA) &&
            verifier.VerifyVector(string_data()) &&
            verifier.VerifyVectorOfStrings(string_data()) &&
+           VerifyOffset(verifier, VT_COMPRESSED_RAW_DATA) &&
+           verifier.VerifyTable(compressed_raw_data()) &&
            verifier.EndTable();
   }
 };
@@ -1304,6 +1582,9 @@ struct TensorBuilder {
   void add_string_data(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> string_data) {
     fbb_.AddOffset(Tensor::VT_STRING_DATA, string_data);
   }
+  void add_compressed_raw_data(flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedData> compressed_raw_data) {
+    fbb_.AddOffset(Tensor::VT_COMPRESSED_RAW_DATA, compressed_raw_data);
+  }
   explicit TensorBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1323,8 +1604,10 @@ inline flatbuffers::Offset<Tensor> CreateTensor(
     flatbuffers::Offset<flatbuffers::Vector<int64_t>> dims = 0,
     onnxruntime::experimental::fbs::TensorDataType data_type = onnxruntime::experimental::fbs::TensorDataType::UNDEFINED,
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> raw_data = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> string_data = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> string_data = 0,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedData> compressed_raw_data = 0) {
   TensorBuilder builder_(_fbb);
+  builder_.add_compressed_raw_data(compressed_raw_data);
   builder_.add_string_data(string_data);
   builder_.add_raw_data(raw_data);
   builder_.add_data_type(data_type);
@@ -1341,7 +1624,8 @@ inline flatbuffers::Offset<Tensor> CreateTensorDirect(
     const std::vector<int64_t> *dims = nullptr,
     onnxruntime::experimental::fbs::TensorDataType data_type = onnxruntime::experimental::fbs::TensorDataType::UNDEFINED,
     const std::vector<uint8_t> *raw_data = nullptr,
-    const std::vector<flatbuffers::Offset<flatbuffers::String>> *string_data = nullptr) {
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *string_data = nullptr,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::CompressedData> compressed_raw_data = 0) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   auto doc_string__ = doc_string ? _fbb.CreateString(doc_string) : 0;
   auto dims__ = dims ? _fbb.CreateVector<int64_t>(*dims) : 0;
@@ -1354,7 +1638,8 @@ inline flatbuffers::Offset<Tensor> CreateTensorDirect(
       dims__,
       data_type,
       raw_data__,
-      string_data__);
+      string_data__,
+      compressed_raw_data);
 }
 
 struct SparseTensor FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -2017,6 +2302,306 @@ inline flatbuffers::Offset<KernelCreateInfos> CreateKernelCreateInfosDirect(
       kernel_def_hashes__);
 }
 
+struct ValueLocation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ValueLocationBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DEVICE_TYPE = 4,
+    VT_MEMORY_TYPE = 6,
+    VT_DEVICE_ID = 8
+  };
+  int32_t device_type() const {
+    return GetField<int32_t>(VT_DEVICE_TYPE, 0);
+  }
+  int32_t memory_type() const {
+    return GetField<int32_t>(VT_MEMORY_TYPE, 0);
+  }
+  int32_t device_id() const {
+    return GetField<int32_t>(VT_DEVICE_ID, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_DEVICE_TYPE) &&
+           VerifyField<int32_t>(verifier, VT_MEMORY_TYPE) &&
+           VerifyField<int32_t>(verifier, VT_DEVICE_ID) &&
+           verifier.EndTable();
+  }
+};
+
+struct ValueLocationBuilder {
+  typedef ValueLocation Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_device_type(int32_t device_type) {
+    fbb_.AddElement<int32_t>(ValueLocation::VT_DEVICE_TYPE, device_type, 0);
+  }
+  void add_memory_type(int32_t memory_type) {
+    fbb_.AddElement<int32_t>(ValueLocation::VT_MEMORY_TYPE, memory_type, 0);
+  }
+  void add_device_id(int32_t device_id) {
+    fbb_.AddElement<int32_t>(ValueLocation::VT_DEVICE_ID, device_id, 0);
+  }
+  explicit ValueLocationBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ValueLocationBuilder &operator=(const ValueLocationBuilder &);
+  flatbuffers::Offset<ValueLocation> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ValueLocation>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ValueLocation> CreateValueLocation(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t device_type = 0,
+    int32_t memory_type = 0,
+    int32_t device_id = 0) {
+  ValueLocationBuilder builder_(_fbb);
+  builder_.add_device_id(device_id);
+  builder_.add_memory_type(memory_type);
+  builder_.add_device_type(device_type);
+  return builder_.Finish();
+}
+
+struct AllocationPlan FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AllocationPlanBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALLOC_KIND = 4,
+    VT_REUSED_BUFFER = 6,
+    VT_CREATE_FENCE_IF_ASYNC = 8,
+    VT_LOCATION = 10,
+    VT_PROGRAM_COUNTER_STARTS = 12,
+    VT_PROGRAM_COUNTER_ENDS = 14
+  };
+  onnxruntime::experimental::fbs::AllocationKind alloc_kind() const {
+    return static_cast<onnxruntime::experimental::fbs::AllocationKind>(GetField<int8_t>(VT_ALLOC_KIND, 0));
+  }
+  int32_t reused_buffer() const {
+    return GetField<int32_t>(VT_REUSED_BUFFER, 0);
+  }
+  bool create_fence_if_async() const {
+    return GetField<uint8_t>(VT_CREATE_FENCE_IF_ASYNC, 0) != 0;
+  }
+  const onnxruntime::experimental::fbs::ValueLocation *location() const {
+    return GetPointer<const onnxruntime::experimental::fbs::ValueLocation *>(VT_LOCATION);
+  }
+  const flatbuffers::Vector<uint64_t> *program_counter_starts() const {
+    return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_PROGRAM_COUNTER_STARTS);
+  }
+  const flatbuffers::Vector<uint64_t> *program_counter_ends() const {
+    return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_PROGRAM_COUNTER_ENDS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_ALLOC_KIND) &&
+           VerifyField<int32_t>(verifier, VT_REUSED_BUFFER) &&
+           VerifyField<uint8_t>(verifier, VT_CREATE_FENCE_IF_ASYNC) &&
+           VerifyOffset(verifier, VT_LOCATION) &&
+           verifier.VerifyTable(location()) &&
+           VerifyOffset(verifier, VT_PROGRAM_COUNTER_STARTS) &&
+           verifier.VerifyVector(program_counter_starts()) &&
+           VerifyOffset(verifier, VT_PROGRAM_COUNTER_ENDS) &&
+           verifier.VerifyVector(program_counter_ends()) &&
+           verifier.EndTable();
+  }
+};
+
+struct AllocationPlanBuilder {
+  typedef AllocationPlan Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_alloc_kind(onnxruntime::experimental::fbs::AllocationKind alloc_kind) {
+    fbb_.AddElement<int8_t>(AllocationPlan::VT_ALLOC_KIND, static_cast<int8_t>(alloc_kind), 0);
+  }
+  void add_reused_buffer(int32_t reused_buffer) {
+    fbb_.AddElement<int32_t>(AllocationPlan::VT_REUSED_BUFFER, reused_buffer, 0);
+  }
+  void add_create_fence_if_async(bool create_fence_if_async) {
+    fbb_.AddElement<uint8_t>(AllocationPlan::VT_CREATE_FENCE_IF_ASYNC, static_cast<uint8_t>(create_fence_if_async), 0);
+  }
+  void add_location(flatbuffers::Offset<onnxruntime::experimental::fbs::ValueLocation> location) {
+    fbb_.AddOffset(AllocationPlan::VT_LOCATION, location);
+  }
+  void add_program_counter_starts(flatbuffers::Offset<flatbuffers::Vector<uint64_t>> program_counter_starts) {
+    fbb_.AddOffset(AllocationPlan::VT_PROGRAM_COUNTER_STARTS, program_counter_starts);
+  }
+  void add_program_counter_ends(flatbuffers::Offset<flatbuffers::Vector<uint64_t>> program_counter_ends) {
+    fbb_.AddOffset(AllocationPlan::VT_PROGRAM_COUNTER_ENDS, program_counter_ends);
+  }
+  explicit AllocationPlanBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  AllocationPlanBuilder &operator=(const AllocationPlanBuilder &);
+  flatbuffers::Offset<AllocationPlan> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<AllocationPlan>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<AllocationPlan> CreateAllocationPlan(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    onnxruntime::experimental::fbs::AllocationKind alloc_kind = onnxruntime::experimental::fbs::AllocationKind::NotSet,
+    int32_t reused_buffer = 0,
+    bool create_fence_if_async = false,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::ValueLocation> location = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint64_t>> program_counter_starts = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint64_t>> program_counter_ends = 0) {
+  AllocationPlanBuilder builder_(_fbb);
+  builder_.add_program_counter_ends(program_counter_ends);
+  builder_.add_program_counter_starts(program_counter_starts);
+  builder_.add_location(location);
+  builder_.add_reused_buffer(reused_buffer);
+  builder_.add_create_fence_if_async(create_fence_if_async);
+  builder_.add_alloc_kind(alloc_kind);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<AllocationPlan> CreateAllocationPlanDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    onnxruntime::experimental::fbs::AllocationKind alloc_kind = onnxruntime::experimental::fbs::AllocationKind::NotSet,
+    int32_t reused_buffer = 0,
+    bool create_fence_if_async = false,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::ValueLocation> location = 0,
+    const std::vector<uint64_t> *program_counter_starts = nullptr,
+    const std::vector<uint64_t> *program_counter_ends = nullptr) {
+  auto program_counter_starts__ = program_counter_starts ? _fbb.CreateVector<uint64_t>(*program_counter_starts) : 0;
+  auto program_counter_ends__ = program_counter_ends ? _fbb.CreateVector<uint64_t>(*program_counter_ends) : 0;
+  return onnxruntime::experimental::fbs::CreateAllocationPlan(
+      _fbb,
+      alloc_kind,
+      reused_buffer,
+      create_fence_if_async,
+      location,
+      program_counter_starts__,
+      program_counter_ends__);
+}
+
+struct ExecutionPlan FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ExecutionPlanBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALLOCATION_PLAN = 4,
+    VT_EXECUTION_ORDER = 6,
+    VT_INITIALIZER_ALLOCATION_ORDER = 8,
+    VT_ACTIVATION_ALLOCATION_ORDER = 10,
+    VT_TO_BE_FREED = 12,
+    VT_NODE_HAS_FENCE = 14
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::AllocationPlan>> *allocation_plan() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::AllocationPlan>> *>(VT_ALLOCATION_PLAN);
+  }
+  const flatbuffers::Vector<const onnxruntime::experimental::fbs::NodeExecutionPlan *> *execution_order() const {
+    return GetPointer<const flatbuffers::Vector<const onnxruntime::experimental::fbs::NodeExecutionPlan *> *>(VT_EXECUTION_ORDER);
+  }
+  const flatbuffers::Vector<int32_t> *initializer_allocation_order() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_INITIALIZER_ALLOCATION_ORDER);
+  }
+  const flatbuffers::Vector<int32_t> *activation_allocation_order() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_ACTIVATION_ALLOCATION_ORDER);
+  }
+  const flatbuffers::Vector<int32_t> *to_be_freed() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_TO_BE_FREED);
+  }
+  const flatbuffers::Vector<uint8_t> *node_has_fence() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_NODE_HAS_FENCE);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ALLOCATION_PLAN) &&
+           verifier.VerifyVector(allocation_plan()) &&
+           verifier.VerifyVectorOfTables(allocation_plan()) &&
+           VerifyOffset(verifier, VT_EXECUTION_ORDER) &&
+           verifier.VerifyVector(execution_order()) &&
+           VerifyOffset(verifier, VT_INITIALIZER_ALLOCATION_ORDER) &&
+           verifier.VerifyVector(initializer_allocation_order()) &&
+           VerifyOffset(verifier, VT_ACTIVATION_ALLOCATION_ORDER) &&
+           verifier.VerifyVector(activation_allocation_order()) &&
+           VerifyOffset(verifier, VT_TO_BE_FREED) &&
+           verifier.VerifyVector(to_be_freed()) &&
+           VerifyOffset(verifier, VT_NODE_HAS_FENCE) &&
+           verifier.VerifyVector(node_has_fence()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ExecutionPlanBuilder {
+  typedef ExecutionPlan Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_allocation_plan(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::AllocationPlan>>> allocation_plan) {
+    fbb_.AddOffset(ExecutionPlan::VT_ALLOCATION_PLAN, allocation_plan);
+  }
+  void add_execution_order(flatbuffers::Offset<flatbuffers::Vector<const onnxruntime::experimental::fbs::NodeExecutionPlan *>> execution_order) {
+    fbb_.AddOffset(ExecutionPlan::VT_EXECUTION_ORDER, execution_order);
+  }
+  void add_initializer_allocation_order(flatbuffers::Offset<flatbuffers::Vector<int32_t>> initializer_allocation_order) {
+    fbb_.AddOffset(ExecutionPlan::VT_INITIALIZER_ALLOCATION_ORDER, initializer_allocation_order);
+  }
+  void add_activation_allocation_order(flatbuffers::Offset<flatbuffers::Vector<int32_t>> activation_allocation_order) {
+    fbb_.AddOffset(ExecutionPlan::VT_ACTIVATION_ALLOCATION_ORDER, activation_allocation_order);
+  }
+  void add_to_be_freed(flatbuffers::Offset<flatbuffers::Vector<int32_t>> to_be_freed) {
+    fbb_.AddOffset(ExecutionPlan::VT_TO_BE_FREED, to_be_freed);
+  }
+  void add_node_has_fence(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> node_has_fence) {
+    fbb_.AddOffset(ExecutionPlan::VT_NODE_HAS_FENCE, node_has_fence);
+  }
+  explicit ExecutionPlanBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ExecutionPlanBuilder &operator=(const ExecutionPlanBuilder &);
+  flatbuffers::Offset<ExecutionPlan> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ExecutionPlan>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ExecutionPlan> CreateExecutionPlan(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::AllocationPlan>>> allocation_plan = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const onnxruntime::experimental::fbs::NodeExecutionPlan *>> execution_order = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> initializer_allocation_order = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> activation_allocation_order = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> to_be_freed = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> node_has_fence = 0) {
+  ExecutionPlanBuilder builder_(_fbb);
+  builder_.add_node_has_fence(node_has_fence);
+  builder_.add_to_be_freed(to_be_freed);
+  builder_.add_activation_allocation_order(activation_allocation_order);
+  builder_.add_initializer_allocation_order(initializer_allocation_order);
+  builder_.add_execution_order(execution_order);
+  builder_.add_allocation_plan(allocation_plan);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ExecutionPlan> CreateExecutionPlanDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<onnxruntime::experimental::fbs::AllocationPlan>> *allocation_plan = nullptr,
+    const std::vector<onnxruntime::experimental::fbs::NodeExecutionPlan> *execution_order = nullptr,
+    const std::vector<int32_t> *initializer_allocation_order = nullptr,
+    const std::vector<int32_t> *activation_allocation_order = nullptr,
+    const std::vector<int32_t> *to_be_freed = nullptr,
+    const std::vector<uint8_t> *node_has_fence = nullptr) {
+  auto allocation_plan__ = allocation_plan ? _fbb.CreateVector<flatbuffers::Offset<onnxruntime::experimental::fbs::AllocationPlan>>(*allocation_plan) : 0;
+  auto execution_order__ = execution_order ? _fbb.CreateVectorOfStructs<onnxruntime::experimental::fbs::NodeExecutionPlan>(*execution_order) : 0;
+  auto initializer_allocation_order__ = initializer_allocation_order ? _fbb.CreateVector<int32_t>(*initializer_allocation_order) : 0;
+  auto activation_allocation_order__ = activation_allocation_order ? _fbb.CreateVector<int32_t>(*activation_allocation_order) : 0;
+  auto to_be_freed__ = to_be_freed ? _fbb.CreateVector<int32_t>(*to_be_freed) : 0;
+  auto node_has_fence__ = node_has_fence ? _fbb.CreateVector<uint8_t>(*node_has_fence) : 0;
+  return onnxruntime::experimental::fbs::CreateExecutionPlan(
+      _fbb,
+      allocation_plan__,
+      execution_order__,
+      initializer_allocation_order__,
+      activation_allocation_order__,
+      to_be_freed__,
+      node_has_fence__);
+}
+
 struct SubGraphSessionState FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef SubGraphSessionStateBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
@@ -2093,7 +2678,8 @@ struct SessionState FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef SessionStateBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_KERNELS = 4,
-    VT_SUB_GRAPH_SESSION_STATES = 6
+    VT_SUB_GRAPH_SESSION_STATES = 6,
+    VT_EXECUTION_PLAN = 8
   };
   const onnxruntime::experimental::fbs::KernelCreateInfos *kernels() const {
     return GetPointer<const onnxruntime::experimental::fbs::KernelCreateInfos *>(VT_KERNELS);
@@ -2101,6 +2687,9 @@ struct SessionState FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::SubGraphSessionState>> *sub_graph_session_states() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::SubGraphSessionState>> *>(VT_SUB_GRAPH_SESSION_STATES);
   }
+  const onnxruntime::experimental::fbs::ExecutionPlan *execution_plan() const {
+    return GetPointer<const onnxruntime::experimental::fbs::ExecutionPlan *>(VT_EXECUTION_PLAN);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_KERNELS) &&
@@ -2108,6 +2697,8 @@ struct SessionState FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_SUB_GRAPH_SESSION_STATES) &&
            verifier.VerifyVector(sub_graph_session_states()) &&
            verifier.VerifyVectorOfTables(sub_graph_session_states()) &&
+           VerifyOffset(verifier, VT_EXECUTION_PLAN) &&
+           verifier.VerifyTable(execution_plan()) &&
            verifier.EndTable();
   }
 };
@@ -2122,6 +2713,9 @@ struct SessionStateBuilder {
   void add_sub_graph_session_states(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::SubGraphSessionState>>> sub_graph_session_states) {
     fbb_.AddOffset(SessionState::VT_SUB_GRAPH_SESSION_STATES, sub_graph_session_states);
   }
+  void add_execution_plan(flatbuffers::Offset<onnxruntime::experimental::fbs::ExecutionPlan> execution_plan) {
+    fbb_.AddOffset(SessionState::VT_EXECUTION_PLAN, execution_plan);
+  }
   explicit SessionStateBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2137,8 +2731,10 @@ struct SessionStateBuilder {
 inline flatbuffers::Offset<SessionState> CreateSessionState(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<onnxruntime::experimental::fbs::KernelCreateInfos> kernels = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::SubGraphSessionState>>> sub_graph_session_states = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::SubGraphSessionState>>> sub_graph_session_states = 0,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::ExecutionPlan> execution_plan = 0) {
   SessionStateBuilder builder_(_fbb);
+  builder_.add_execution_plan(execution_plan);
   builder_.add_sub_graph_session_states(sub_graph_session_states);
   builder_.add_kernels(kernels);
   return builder_.Finish();
@@ -2147,12 +2743,207 @@ inline flatbuffers::Offset<SessionState> CreateSessionState(
 inline flatbuffers::Offset<SessionState> CreateSessionStateDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<onnxruntime::experimental::fbs::KernelCreateInfos> kernels = 0,
-    std::vector<flatbuffers::Offset<onnxruntime::experimental::fbs::SubGraphSessionState>> *sub_graph_session_states = nullptr) {
+    std::vector<flatbuffers::Offset<onnxruntime::experimental::fbs::SubGraphSessionState>> *sub_graph_session_states = nullptr,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::ExecutionPlan> execution_plan = 0) {
   auto sub_graph_session_states__ = sub_graph_session_states ? _fbb.CreateVectorOfSortedTables<onnxruntime::experimental::fbs::SubGraphSessionState>(sub_graph_session_states) : 0;
   return onnxruntime::experimental::fbs::CreateSessionState(
       _fbb,
       kernels,
-      sub_graph_session_states__);
+      sub_graph_session_states__,
+      execution_plan);
+}
+
+struct PrePackedBuffer FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PrePackedBufferBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DATA = 4
+  };
+  const flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PrePackedBufferBuilder {
+  typedef PrePackedBuffer Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(PrePackedBuffer::VT_DATA, data);
+  }
+  explicit PrePackedBufferBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  PrePackedBufferBuilder &operator=(const PrePackedBufferBuilder &);
+  flatbuffers::Offset<PrePackedBuffer> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<PrePackedBuffer>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<PrePackedBuffer> CreatePrePackedBuffer(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
+  PrePackedBufferBuilder builder_(_fbb);
+  builder_.add_data(data);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<PrePackedBuffer> CreatePrePackedBufferDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return onnxruntime::experimental::fbs::CreatePrePackedBuffer(
+      _fbb,
+      data__);
+}
+
+struct PrePackedWeight FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PrePackedWeightBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_KEY = 4,
+    VT_BUFFERS = 6
+  };
+  const flatbuffers::String *key() const {
+    return GetPointer<const flatbuffers::String *>(VT_KEY);
+  }
+  bool KeyCompareLessThan(const PrePackedWeight *o) const {
+    return *key() < *o->key();
+  }
+  int KeyCompareWithValue(const char *val) const {
+    return strcmp(key()->c_str(), val);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedBuffer>> *buffers() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedBuffer>> *>(VT_BUFFERS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_KEY) &&
+           verifier.VerifyString(key()) &&
+           VerifyOffset(verifier, VT_BUFFERS) &&
+           verifier.VerifyVector(buffers()) &&
+           verifier.VerifyVectorOfTables(buffers()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PrePackedWeightBuilder {
+  typedef PrePackedWeight Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_key(flatbuffers::Offset<flatbuffers::String> key) {
+    fbb_.AddOffset(PrePackedWeight::VT_KEY, key);
+  }
+  void add_buffers(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedBuffer>>> buffers) {
+    fbb_.AddOffset(PrePackedWeight::VT_BUFFERS, buffers);
+  }
+  explicit PrePackedWeightBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  PrePackedWeightBuilder &operator=(const PrePackedWeightBuilder &);
+  flatbuffers::Offset<PrePackedWeight> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<PrePackedWeight>(end);
+    fbb_.Required(o, PrePackedWeight::VT_KEY);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<PrePackedWeight> CreatePrePackedWeight(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> key = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedBuffer>>> buffers = 0) {
+  PrePackedWeightBuilder builder_(_fbb);
+  builder_.add_buffers(buffers);
+  builder_.add_key(key);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<PrePackedWeight> CreatePrePackedWeightDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *key = nullptr,
+    const std::vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedBuffer>> *buffers = nullptr) {
+  auto key__ = key ? _fbb.CreateString(key) : 0;
+  auto buffers__ = buffers ? _fbb.CreateVector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedBuffer>>(*buffers) : 0;
+  return onnxruntime::experimental::fbs::CreatePrePackedWeight(
+      _fbb,
+      key__,
+      buffers__);
+}
+
+struct PrePackedWeightsData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PrePackedWeightsDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CPU_FINGERPRINT = 4,
+    VT_WEIGHTS = 6
+  };
+  const flatbuffers::String *cpu_fingerprint() const {
+    return GetPointer<const flatbuffers::String *>(VT_CPU_FINGERPRINT);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeight>> *weights() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeight>> *>(VT_WEIGHTS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_CPU_FINGERPRINT) &&
+           verifier.VerifyString(cpu_fingerprint()) &&
+           VerifyOffset(verifier, VT_WEIGHTS) &&
+           verifier.VerifyVector(weights()) &&
+           verifier.VerifyVectorOfTables(weights()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PrePackedWeightsDataBuilder {
+  typedef PrePackedWeightsData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_cpu_fingerprint(flatbuffers::Offset<flatbuffers::String> cpu_fingerprint) {
+    fbb_.AddOffset(PrePackedWeightsData::VT_CPU_FINGERPRINT, cpu_fingerprint);
+  }
+  void add_weights(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeight>>> weights) {
+    fbb_.AddOffset(PrePackedWeightsData::VT_WEIGHTS, weights);
+  }
+  explicit PrePackedWeightsDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  PrePackedWeightsDataBuilder &operator=(const PrePackedWeightsDataBuilder &);
+  flatbuffers::Offset<PrePackedWeightsData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<PrePackedWeightsData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<PrePackedWeightsData> CreatePrePackedWeightsData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> cpu_fingerprint = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeight>>> weights = 0) {
+  PrePackedWeightsDataBuilder builder_(_fbb);
+  builder_.add_weights(weights);
+  builder_.add_cpu_fingerprint(cpu_fingerprint);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<PrePackedWeightsData> CreatePrePackedWeightsDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *cpu_fingerprint = nullptr,
+    std::vector<flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeight>> *weights = nullptr) {
+  auto cpu_fingerprint__ = cpu_fingerprint ? _fbb.CreateString(cpu_fingerprint) : 0;
+  auto weights__ = weights ? _fbb.CreateVectorOfSortedTables<onnxruntime::experimental::fbs::PrePackedWeight>(weights) : 0;
+  return onnxruntime::experimental::fbs::CreatePrePackedWeightsData(
+      _fbb,
+      cpu_fingerprint__,
+      weights__);
 }
 
 struct InferenceSession FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -2160,7 +2951,8 @@ struct InferenceSession FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_ORT_VERSION = 4,
     VT_MODEL = 6,
-    VT_SESSION_STATE = 8
+    VT_SESSION_STATE = 8,
+    VT_PREPACKED_WEIGHTS = 10
   };
   const flatbuffers::String *ort_version() const {
     return GetPointer<const flatbuffers::String *>(VT_ORT_VERSION);
@@ -2171,6 +2963,9 @@ struct InferenceSession FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const onnxruntime::experimental::fbs::SessionState *session_state() const {
     return GetPointer<const onnxruntime::experimental::fbs::SessionState *>(VT_SESSION_STATE);
   }
+  const onnxruntime::experimental::fbs::PrePackedWeightsData *prepacked_weights() const {
+    return GetPointer<const onnxruntime::experimental::fbs::PrePackedWeightsData *>(VT_PREPACKED_WEIGHTS);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_ORT_VERSION) &&
@@ -2179,6 +2974,8 @@ struct InferenceSession FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(model()) &&
            VerifyOffset(verifier, VT_SESSION_STATE) &&
            verifier.VerifyTable(session_state()) &&
+           VerifyOffset(verifier, VT_PREPACKED_WEIGHTS) &&
+           verifier.VerifyTable(prepacked_weights()) &&
            verifier.EndTable();
   }
 };
@@ -2196,6 +2993,9 @@ struct InferenceSessionBuilder {
   void add_session_state(flatbuffers::Offset<onnxruntime::experimental::fbs::SessionState> session_state) {
     fbb_.AddOffset(InferenceSession::VT_SESSION_STATE, session_state);
   }
+  void add_prepacked_weights(flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeightsData> prepacked_weights) {
+    fbb_.AddOffset(InferenceSession::VT_PREPACKED_WEIGHTS, prepacked_weights);
+  }
   explicit InferenceSessionBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2212,8 +3012,10 @@ inline flatbuffers::Offset<InferenceSession> CreateInferenceSession(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<flatbuffers::String> ort_version = 0,
     flatbuffers::Offset<onnxruntime::experimental::fbs::Model> model = 0,
-    flatbuffers::Offset<onnxruntime::experimental::fbs::SessionState> session_state = 0) {
+    flatbuffers::Offset<onnxruntime::experimental::fbs::SessionState> session_state = 0,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeightsData> prepacked_weights = 0) {
   InferenceSessionBuilder builder_(_fbb);
+  builder_.add_prepacked_weights(prepacked_weights);
   builder_.add_session_state(session_state);
   builder_.add_model(model);
   builder_.add_ort_version(ort_version);
@@ -2224,13 +3026,15 @@ inline flatbuffers::Offset<InferenceSession> CreateInferenceSessionDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     const char *ort_version = nullptr,
     flatbuffers::Offset<onnxruntime::experimental::fbs::Model> model = 0,
-    flatbuffers::Offset<onnxruntime::experimental::fbs::SessionState> session_state = 0) {
+    flatbuffers::Offset<onnxruntime::experimental::fbs::SessionState> session_state = 0,
+    flatbuffers::Offset<onnxruntime::experimental::fbs::PrePackedWeightsData> prepacked_weights = 0) {
   auto ort_version__ = ort_version ? _fbb.CreateString(ort_version) : 0;
   return onnxruntime::experimental::fbs::CreateInferenceSession(
       _fbb,
       ort_version__,
       model,
-      session_state);
+      session_state,
+      prepacked_weights);
 }
 
 inline bool VerifyTypeInfoValue(flatbuffers::Verifier &verifier, const void *obj, TypeInfoValue type) {
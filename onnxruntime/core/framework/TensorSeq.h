@@ -35,6 +35,20 @@ class TensorSeq {
     tensors_ = std::move(tensors);
   }
 
+  // Reserves storage so repeated Add calls grow the sequence without
+  // reallocating.
+  void Reserve(size_t capacity) {
+    tensors_.reserve(capacity);
+  }
+
+  // Appends a tensor, taking ownership of its buffer.
+  // The caller of this method ensures that :
+  // (1) `elem_type` is set before invoking this method
+  // (2) the tensor contains elements of the same primitive data type
+  void Add(Tensor&& tensor) {
+    tensors_.push_back(std::move(tensor));
+  }
+
   MLDataType DataType() const noexcept { return elem_type_; }
 
   bool IsSameDataType(const TensorSeq& o) const noexcept {
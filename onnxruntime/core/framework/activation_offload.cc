@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/activation_offload.h"
+
+#include <unordered_set>
+
+#include "core/framework/ort_value_name_idx_map.h"
+
+namespace onnxruntime {
+
+namespace {
+// Minimum number of execution steps between two consecutive uses of a value before the gap is
+// worth an offload/reload round trip.
+constexpr size_t kMinStepsToOffload = 8;
+
+// Number of steps ahead of the consuming node at which a reload is issued, so a data transfer
+// that runs asynchronously on its copy queue can overlap with the preceding compute.
+constexpr size_t kPrefetchSteps = 2;
+
+static_assert(kMinStepsToOffload > kPrefetchSteps,
+              "The reload for a gap must be issued after the offload.");
+}  // namespace
+
+Status ActivationOffloadPlanner::CreatePlan(const GraphViewer& graph_viewer,
+                                            const OrtValueNameIdxMap& ort_value_name_idx_map,
+                                            const SequentialExecutionPlan& execution_plan,
+                                            std::unique_ptr<ActivationOffloadPlan>& offload_plan) {
+  offload_plan.reset();
+
+  const size_t num_steps = execution_plan.execution_plan.size();
+  const size_t num_values = execution_plan.allocation_plan.size();
+
+  // Steps at which each value is read, in execution order. The producing step is not recorded:
+  // a value only becomes a candidate once its first consumer has run.
+  std::vector<std::vector<size_t>> use_steps(num_values);
+
+  for (size_t step = 0; step < num_steps; ++step) {
+    const Node* node = graph_viewer.GetNode(execution_plan.execution_plan[step].node_index);
+    ORT_ENFORCE(node != nullptr, "Execution plan references a node that is not in the graph.");
+
+    auto record_use = [&](const NodeArg* node_arg) {
+      if (!node_arg->Exists())
+        return;
+
+      int ort_value_idx;
+      if (!ort_value_name_idx_map.GetIdx(node_arg->Name(), ort_value_idx).IsOK())
+        return;
+
+      auto& steps = use_steps[ort_value_idx];
+      if (steps.empty() || steps.back() != step)
+        steps.push_back(step);
+    };
+
+    for (const auto* node_arg : node->InputDefs())
+      record_use(node_arg);
+
+    // implicit inputs are read by the node's subgraphs for the duration of this step
+    for (const auto* node_arg : node->ImplicitInputDefs())
+      record_use(node_arg);
+  }
+
+  // values that provide the buffer for another value must stay resident for the reuser's sake
+  std::vector<bool> provides_reused_buffer(num_values, false);
+  for (const auto& per_value : execution_plan.allocation_plan) {
+    if (per_value.alloc_kind == AllocKind::kReuse || per_value.alloc_kind == AllocKind::kShare ||
+        per_value.alloc_kind == AllocKind::kSlicedView)
+      provides_reused_buffer[per_value.reused_buffer] = true;
+  }
+
+  std::unordered_set<OrtValueIndex> graph_outputs;
+  for (const auto* node_arg : graph_viewer.GetOutputs()) {
+    int ort_value_idx;
+    if (node_arg->Exists() && ort_value_name_idx_map.GetIdx(node_arg->Name(), ort_value_idx).IsOK())
+      graph_outputs.insert(ort_value_idx);
+  }
+
+  auto plan = onnxruntime::make_unique<ActivationOffloadPlan>();
+  plan->offloads_per_step.resize(num_steps);
+  plan->reloads_per_step.resize(num_steps);
+
+  for (size_t ort_value_idx = 0; ort_value_idx < num_values; ++ort_value_idx) {
+    const AllocPlanPerValue& per_value = execution_plan.allocation_plan[ort_value_idx];
+
+    if (per_value.alloc_kind != AllocKind::kAllocate ||
+        provides_reused_buffer[ort_value_idx] ||
+        per_value.create_fence_if_async ||
+        per_value.value_type == nullptr || !per_value.value_type->IsTensorType() ||
+        per_value.location.device.Type() == OrtDevice::CPU ||
+        graph_outputs.count(static_cast<OrtValueIndex>(ort_value_idx)) != 0) {
+      continue;
+    }
+
+    const auto& steps = use_steps[ort_value_idx];
+    for (size_t i = 0; i + 1 < steps.size(); ++i) {
+      const size_t gap_start = steps[i];
+      const size_t gap_end = steps[i + 1];
+      if (gap_end - gap_start < kMinStepsToOffload)
+        continue;
+
+      plan->offloads_per_step[gap_start].push_back(static_cast<OrtValueIndex>(ort_value_idx));
+      plan->reloads_per_step[gap_end - kPrefetchSteps].push_back(static_cast<OrtValueIndex>(ort_value_idx));
+      ++plan->num_scheduled_copies;
+    }
+  }
+
+  if (plan->num_scheduled_copies > 0)
+    offload_plan = std::move(plan);
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/sequential_execution_plan.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+
+class OrtValueNameIdxMap;
+
+// Static schedule for copying activations out to CPU memory during the gaps in their lifetimes.
+// Built once per session from the sequential execution plan; the SequentialExecutor copies the
+// listed values to CPU after the step that last touched them runs and copies them back to their
+// planned location a couple of steps before the next consumer executes, so large models can run
+// with less device memory than the sum of their live activations.
+struct ActivationOffloadPlan {
+  // Indexed by step in SequentialExecutionPlan::execution_plan.
+  // offloads_per_step[i] lists the ort_value indices to copy to CPU after step i completes.
+  // reloads_per_step[i] lists the ort_value indices to copy back before step i runs.
+  std::vector<std::vector<OrtValueIndex>> offloads_per_step;
+  std::vector<std::vector<OrtValueIndex>> reloads_per_step;
+
+  // Number of (offload, reload) pairs in the schedule.
+  size_t num_scheduled_copies{0};
+};
+
+class ActivationOffloadPlanner {
+ public:
+  // Builds an offload schedule for the given execution plan, or leaves offload_plan null if no
+  // value qualifies (e.g. everything lives on CPU already). A value qualifies when it is a
+  // planned tensor allocation on a non-CPU device that is not part of any buffer reuse and is
+  // not fenced, and there is a large enough gap between two of its consecutive uses in the
+  // execution order to make the round trip worthwhile.
+  static Status CreatePlan(const GraphViewer& graph_viewer,
+                           const OrtValueNameIdxMap& ort_value_name_idx_map,
+                           const SequentialExecutionPlan& execution_plan,
+                           std::unique_ptr<ActivationOffloadPlan>& offload_plan);
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace onnxruntime {
+
+/**
+Process-wide audit of allocations that reach the CPU allocator seam, i.e. direct CPUAllocator
+usage and arena extensions. Requests served from an arena's existing chunks do not count.
+Steady-state Runs over stable input shapes are expected to be served entirely from memory
+patterns and the arena, so a growing count flags a kernel or framework path that regressed to
+allocating per Run.
+
+Disabled by default; when enabled each counted allocation costs one relaxed atomic increment.
+Once enabled the audit stays on for the lifetime of the process since concurrently running
+sessions may rely on it. The counter is process wide, so enforcement (see
+kOrtSessionOptionsConfigAssertAllocationFreeRuns) is only meaningful while a single session is
+running, i.e. in tests.
+*/
+class AllocationAudit {
+ public:
+  static void Enable();
+  static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  static void OnAlloc() { count_.fetch_add(1, std::memory_order_relaxed); }
+
+  static uint64_t AllocationCount() { return count_.load(std::memory_order_relaxed); }
+
+ private:
+  AllocationAudit() = delete;
+
+  static std::atomic<bool> enabled_;
+  static std::atomic<uint64_t> count_;
+};
+
+}  // namespace onnxruntime
@@ -40,6 +40,9 @@ std::ostream& operator<<(std::ostream& out, AllocKind alloc_kind) {
     case AllocKind::kShare:
       out << "Share";
       break;
+    case AllocKind::kSlicedView:
+      out << "SlicedView";
+      break;
     case AllocKind::kNotSet:
       out << "NotSet";
       break;
@@ -65,7 +68,8 @@ std::ostream& operator<<(std::ostream& out, std::pair<const SequentialExecutionP
     if (0 <= index && static_cast<size_t>(index) < plan_size) {
       auto& elt_plan = plan.allocation_plan[index];
       out << elt_plan.alloc_kind;
-      if (elt_plan.alloc_kind == AllocKind::kReuse) out << " " << elt_plan.reused_buffer;
+      if (elt_plan.alloc_kind == AllocKind::kReuse || elt_plan.alloc_kind == AllocKind::kSlicedView)
+        out << " " << elt_plan.reused_buffer;
 
       auto& loc = elt_plan.location;
       out << ", " << loc.ToString();
@@ -103,6 +107,99 @@ std::ostream& operator<<(std::ostream& out, std::pair<const SequentialExecutionP
   return out;
 }
 
+static void AppendJsonEscaped(std::ostream& out, const std::string& text) {
+  for (char c : text) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        out << c;
+    }
+  }
+}
+
+void DumpAllocationPlanAsJson(const SequentialExecutionPlan& plan, const SessionState& session_state,
+                              std::ostream& out) {
+  const auto& graph = session_state.GetGraphViewer();
+
+  std::unordered_map<int, std::string> index_to_name;
+  for (const auto& name_index : session_state.GetOrtValueNameIdxMap()) {
+    index_to_name[name_index.second] = name_index.first;
+  }
+
+  out << "{\n  \"values\": [\n";
+  const size_t plan_size = plan.allocation_plan.size();
+  for (size_t i = 0; i < plan_size; ++i) {
+    const AllocPlanPerValue& value_plan = plan.allocation_plan[i];
+
+    out << "    {\"index\": " << i << ", \"name\": \"";
+    auto name_iter = index_to_name.find(static_cast<int>(i));
+    if (name_iter != index_to_name.end()) {
+      AppendJsonEscaped(out, name_iter->second);
+    }
+    out << "\", \"alloc_kind\": \"" << value_plan.alloc_kind << "\"";
+
+    if (value_plan.alloc_kind == AllocKind::kReuse || value_plan.alloc_kind == AllocKind::kSlicedView) {
+      out << ", \"reused_buffer\": " << value_plan.reused_buffer;
+    }
+
+    out << ", \"location\": \"";
+    AppendJsonEscaped(out, value_plan.location.ToString());
+    out << "\"";
+
+    if (value_plan.create_fence_if_async) {
+      out << ", \"fence\": true";
+    }
+
+    // lifetime intervals in execution-plan steps, as recorded by the planner
+    if (value_plan.program_counter.HasValidEntries()) {
+      const auto& starts = value_plan.program_counter.Starts();
+      const auto& ends = value_plan.program_counter.Ends();
+      out << ", \"lifetimes\": [";
+      for (size_t j = 0; j < starts.size(); ++j) {
+        out << (j == 0 ? "" : ", ") << "[" << starts[j] << ", " << ends[j] << "]";
+      }
+      out << "]";
+    }
+
+    out << "}" << (i + 1 < plan_size ? "," : "") << "\n";
+  }
+
+  out << "  ],\n  \"execution_plan\": [\n";
+  for (size_t i = 0; i < plan.execution_plan.size(); ++i) {
+    const auto& step = plan.execution_plan[i];
+    const auto* node = graph.GetNode(step.node_index);
+
+    out << "    {\"step\": " << i << ", \"node_index\": " << step.node_index << ", \"op_type\": \"";
+    if (node != nullptr) {
+      AppendJsonEscaped(out, node->OpType());
+    }
+    out << "\", \"name\": \"";
+    if (node != nullptr) {
+      AppendJsonEscaped(out, node->Name());
+    }
+    out << "\", \"freed_values\": [";
+    std::string sep;
+    for (int j = step.free_from_index; j <= step.free_to_index; ++j) {
+      out << sep << plan.to_be_freed[j];
+      sep = ", ";
+    }
+    out << "]}" << (i + 1 < plan.execution_plan.size() ? "," : "") << "\n";
+  }
+
+  out << "  ]\n}\n";
+}
+
 static const KernelCreateInfo& GetKernelCreateInfo(
     const std::unordered_map<NodeIndex, gsl::not_null<const KernelCreateInfo*>>& kernel_create_info_map,
     NodeIndex node_index) {
@@ -275,6 +372,34 @@ class PlannerImpl {
     return false;
   }
 
+  // Find an input that the output_arg_num-th output may be created over as a sliced view
+  // (see KernelDefBuilder::MaySliceView). The output does not take over the input's buffer the
+  // way in-place reuse does - the input may have other consumers - planning the output against
+  // that buffer just extends the buffer's lifetime to cover the view's consumers.
+  bool FindSliceViewInput(const onnxruntime::Node& node, int output_arg_num, OrtValueIndex* view_input) {
+    const KernelCreateInfo& ci = GetKernelCreateInfo(kernel_create_info_map_, node.Index());
+
+    if (ci.kernel_def == nullptr) {
+      return false;
+    }
+
+    const std::vector<std::pair<int, int>>& slice_view_map = ci.kernel_def->MaySliceView();
+    auto input_args = node.InputDefs();
+    for (auto pair : slice_view_map) {
+      // -1 marks all outputs (used by variadic kernels such as Split)
+      if (pair.second == output_arg_num || pair.second == -1) {
+        if ((0 <= pair.first) && (static_cast<size_t>(pair.first) < input_args.size())) {
+          auto p_input_arg = input_args[pair.first];
+          if (p_input_arg->Exists()) {
+            *view_input = Index(p_input_arg->Name());
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
   static bool SameShape(const TensorShapeProto& shape1, const TensorShapeProto& shape2) {
     // TODO: This should probably be defined to be the equality operator on TensorShapeProto.
     namespace on = ONNX_NAMESPACE;
@@ -396,10 +521,17 @@ class PlannerImpl {
       graph_inputs.insert(graph_input->Name());
     }
 
+    // When the caller has guaranteed exclusive ownership of the input buffers for the duration of Run,
+    // skip the extra use so inputs become eligible for in-place reuse like any intermediate value.
+    // Subgraph inputs are owned by the control flow kernel, so the guarantee never applies to them.
+    const bool reuse_graph_inputs = context_.AllowGraphInputReuse() && parent_node_ == nullptr;
+
     for (auto graph_input : graph_viewer_.GetInputs()) {
       OrtValueIndex index = Index(graph_input->Name());
       ProcessDef(index, graph_input);
-      UseCount(index)++;  // Models caller's usage post-inference; ensures it will not be reused.
+      if (!reuse_graph_inputs) {
+        UseCount(index)++;  // Models caller's usage post-inference; ensures it will not be reused.
+      }
     }
 
     for (auto node_arg : outer_scope_node_args_) {
@@ -487,8 +619,15 @@ class PlannerImpl {
 
       // if sync is needed, mark allocation plan as create_fence_if_async=true
       // note that the input arg may come from an execution provider (i.e. CPU) that does not support async,
-      // in which case create_fence_if_async would be ignored when creating MLValue
-      if (p_kernel_def->ExecQueueId() != 0) {
+      // in which case create_fence_if_async would be ignored when creating MLValue.
+      // Under the parallel executor, nodes of a non-CPU provider may run on different threads - and with
+      // per-thread device streams, on different streams - so every value such nodes touch needs a fence:
+      // the fence events order cross-stream reads after the producing stream's writes, and gate buffer
+      // release on device completion so freed memory is not handed to another stream while still in use.
+      bool non_cpu_device_provider =
+          exec_provider->GetAllocator(0, OrtMemTypeDefault)->Info().device.Type() != OrtDevice::CPU;
+      if (p_kernel_def->ExecQueueId() != 0 ||
+          (context_.IsParallelExecutionEnabled() && non_cpu_device_provider)) {
         pnode->ForEachDef([this](const onnxruntime::NodeArg& arg, bool /*is_input*/) {
           OrtValueIndex index = Index(arg.Name());
           AllocPlan(index).create_fence_if_async = true;
@@ -646,6 +785,12 @@ class PlannerImpl {
         } else if (FindReusableInput(*pnode, static_cast<int>(output_arg_def_index), &reused)) {
           // Reuse one of this node's input buffers as the output buffer (for in-place update)
           Reuse(reused, current, AllocKind::kReuse);
+        } else if (FindSliceViewInput(*pnode, static_cast<int>(output_arg_def_index), &reused)) {
+          // The kernel may create this output as a view over a slice of the input's buffer
+          // (OpKernelContext::TryOutputSliceView), so plan the output against that buffer to keep
+          // it alive while the view is consumed. If the kernel falls back to copying, the
+          // execution frame allocates a separate buffer for the output on demand.
+          Reuse(reused, current, AllocKind::kSlicedView);
         } else if (!context_.IsParallelExecutionEnabled() &&
                    FindReusableTensor(*node_output, &reused)) {
           // Reuse an available (dead) buffer for this output, this is only for sequential execution.
@@ -780,7 +925,8 @@ class PlannerImpl {
       AllocPlanPerValue& value_plan = AllocPlan(index);
 
       has_fence = value_plan.create_fence_if_async;
-      if (value_plan.alloc_kind == AllocKind::kReuse) {
+      if (value_plan.alloc_kind == AllocKind::kReuse ||
+          value_plan.alloc_kind == AllocKind::kSlicedView) {
         // Buffer reused, check original buffer to see if fence is shared.
         has_fence = has_fence || AllocPlan(value_plan.reused_buffer).create_fence_if_async;
       }
@@ -30,13 +30,20 @@ class ISequentialPlannerContext {
   virtual bool IsParallelExecutionEnabled() const { return false; }
 
   virtual ExecutionOrder GetExecutionOrder() const { return ExecutionOrder::DEFAULT; }
+
+  // If it returns true, the caller has guaranteed that graph input buffers are exclusively owned
+  // by the session for the duration of Run, so the planner may reuse them like intermediate values.
+  // Only honored for the main graph; subgraph inputs are owned by the control flow kernel.
+  virtual bool AllowGraphInputReuse() const { return false; }
 };
 
 class SequentialPlannerContext : public ISequentialPlannerContext {
  public:
-  SequentialPlannerContext(ExecutionMode execution_mode, ExecutionOrder execution_order)
+  SequentialPlannerContext(ExecutionMode execution_mode, ExecutionOrder execution_order,
+                           bool allow_graph_input_reuse)
       : execution_mode_(execution_mode),
-        exection_order_(execution_order) {
+        exection_order_(execution_order),
+        allow_graph_input_reuse_(allow_graph_input_reuse) {
   }
 
   const ONNX_NAMESPACE::TensorShapeProto* GetShape(const onnxruntime::NodeArg& arg) const override {
@@ -47,9 +54,12 @@ class SequentialPlannerContext : public ISequentialPlannerContext {
 
   ExecutionOrder GetExecutionOrder() const override { return exection_order_; }
 
+  bool AllowGraphInputReuse() const override { return allow_graph_input_reuse_; }
+
  private:
   ExecutionMode execution_mode_ = ExecutionMode::ORT_SEQUENTIAL;
   ExecutionOrder exection_order_ = ExecutionOrder::DEFAULT;
+  bool allow_graph_input_reuse_ = false;
 };
 
 class SequentialPlanner {
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/common/safeint.h"
+#include "core/framework/allocation_audit.h"
 #include "core/framework/allocator.h"
 #include "core/framework/allocatormgr.h"
 #include "core/framework/utils.h"
@@ -11,6 +12,13 @@
 
 namespace onnxruntime {
 
+std::atomic<bool> AllocationAudit::enabled_{false};
+std::atomic<uint64_t> AllocationAudit::count_{0};
+
+void AllocationAudit::Enable() {
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
 // private helper for calculation so SafeInt usage doesn't bleed into the public allocator.h header
 bool IAllocator::CalcMemSizeForArrayWithAlignment(size_t nmemb, size_t size, size_t alignment, size_t* out) noexcept {
   bool ok = true;
@@ -36,6 +44,8 @@ bool IAllocator::CalcMemSizeForArrayWithAlignment(size_t nmemb, size_t size, siz
 
 #if defined(USE_MIMALLOC_ARENA_ALLOCATOR)
 void* MiMallocAllocator::Alloc(size_t size) {
+  if (AllocationAudit::IsEnabled())
+    AllocationAudit::OnAlloc();
   return mi_malloc(size);
 }
 
@@ -47,6 +57,8 @@ const OrtMemoryInfo& MiMallocAllocator::Info() const { return *memory_info_; }
 #endif
 
 void* CPUAllocator::Alloc(size_t size) {
+  if (AllocationAudit::IsEnabled())
+    AllocationAudit::OnAlloc();
   return utils::DefaultAlloc(size);
 }
 
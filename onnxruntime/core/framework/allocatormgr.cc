@@ -38,17 +38,23 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
         return nullptr;
     }
 
-#ifdef USE_MIMALLOC
-    return std::shared_ptr<IArenaAllocator>(
-        onnxruntime::make_unique<MiMallocArena>(std::move(device_allocator), max_mem));
+    if (info.use_mimalloc) {
+#if defined(USE_MIMALLOC_ARENA_ALLOCATOR)
+      // runtime-selected so BFCArena and mimalloc sessions can be A/B tested in one binary
+      return std::shared_ptr<IArenaAllocator>(
+          onnxruntime::make_unique<MiMallocArena>(std::move(device_allocator), max_mem));
 #else
+      LOGS_DEFAULT(WARNING) << "mimalloc arena requested but this build does not include mimalloc. "
+                               "Falling back to BFCArena.";
+#endif
+    }
+
     return std::shared_ptr<IArenaAllocator>(
         onnxruntime::make_unique<BFCArena>(std::move(device_allocator),
                                            max_mem,
                                            arena_extend_str,
                                            initial_chunk_size_bytes,
                                            max_dead_bytes_per_chunk));
-#endif
   }
 
   return AllocatorPtr(std::move(device_allocator));
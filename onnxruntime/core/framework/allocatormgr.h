@@ -15,17 +15,22 @@ struct AllocatorCreationInfo {
   AllocatorCreationInfo(AllocatorFactory device_alloc_factory0,
                         OrtDevice::DeviceId device_id0 = 0,
                         bool use_arena0 = true,
-                        OrtArenaCfg arena_cfg0 = {0, -1, -1, -1})
+                        OrtArenaCfg arena_cfg0 = {0, -1, -1, -1},
+                        bool use_mimalloc0 = false)
       : device_alloc_factory(device_alloc_factory0),
         device_id(device_id0),
         use_arena(use_arena0),
-        arena_cfg(arena_cfg0) {
+        arena_cfg(arena_cfg0),
+        use_mimalloc(use_mimalloc0) {
   }
 
   AllocatorFactory device_alloc_factory;
   OrtDevice::DeviceId device_id;
   bool use_arena;
   OrtArenaCfg arena_cfg;
+  // back the arena with a private mimalloc heap instead of BFCArena. Only honored in builds
+  // compiled with USE_MIMALLOC_ARENA_ALLOCATOR; other builds fall back to BFCArena.
+  bool use_mimalloc;
 };
 
 // Returns an allocator based on the creation info provided.
@@ -3,16 +3,41 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "core/common/common.h"
 #include "core/framework/allocator.h"
 
 namespace onnxruntime {
+// Gates the reuse of freed arena memory behind asynchronously executing device work.
+// When a gate is attached to an arena, each free is tagged with the device work in
+// flight at that moment and the memory only returns to the free pool once that work
+// has completed. This lets an arena back a device that consumes memory asynchronously
+// (e.g. CUDA streams) without a device synchronization before buffers are reused.
+// The arena serializes all calls on a gate, including the shutdown ReleaseTag calls.
+class IArenaFreeGate {
+ public:
+  virtual ~IArenaFreeGate() = default;
+
+  // Tags the device work currently in flight. Returns an opaque tag to poll with
+  // IsTagComplete, or nullptr when the memory can be reused immediately.
+  virtual void* TagPendingWork() = 0;
+
+  // Returns true once the work captured by 'tag' has completed.
+  virtual bool IsTagComplete(void* tag) = 0;
+
+  // Returns 'tag' to the implementation. Called exactly once per non-null tag,
+  // either after IsTagComplete returned true or when the arena shuts down.
+  virtual void ReleaseTag(void* tag) = 0;
+};
+
 // The interface for arena which manage memory allocations
 // Arena will hold a pool of pre-allocate memories and manage their lifecycle.
 // Need an underline IResourceAllocator to allocate memories.
 // The setting like max_chunk_size is init by IDeviceDescriptor from resource allocator
+struct AllocatorStats;
+
 class IArenaAllocator : public IAllocator {
  public:
   IArenaAllocator(const OrtMemoryInfo& info) : IAllocator(info) {}
@@ -27,6 +52,16 @@ class IArenaAllocator : public IAllocator {
   void Free(void* p) override = 0;
   virtual size_t Used() const = 0;
   virtual size_t Max() const = 0;
+  // Fill stats with the arena's runtime statistics. Needs to be thread safe.
+  virtual void GetStats(AllocatorStats* stats) = 0;
+  // Cap the arena's total reserved bytes while a budgeted Run is in flight;
+  // 0 removes the cap. See RunOptions::run_memory_budget_bytes. Arenas that
+  // cannot enforce a cap may ignore it.
+  virtual void SetRunMemoryBudget(int64_t /*budget_bytes*/) {}
+  // Attach a gate that defers the reuse of freed memory until the device work in
+  // flight at free time has completed. Must be attached before the arena is shared
+  // across threads. Arenas that cannot defer reuse may ignore the gate.
+  virtual void SetFreeGate(std::unique_ptr<IArenaFreeGate> /*gate*/) {}
   // allocate host pinned memory?
 };
 
@@ -43,6 +78,12 @@ struct AllocatorStats {
                                   // is known. Certain allocator may return 0 to indicate the limit is
                                   // unknown.
   int64_t bytes_limit;
+  int64_t num_extensions;            // Number of times the arena grew by reserving a new region.
+                                     // Free-space fragmentation: total_free_bytes spread over many small
+                                     // chunks (small largest_free_block_bytes) means a large request will
+                                     // extend the arena even though enough bytes are nominally free.
+  int64_t total_free_bytes;          // Bytes held in free chunks.
+  int64_t largest_free_block_bytes;  // Size of the largest single free chunk.
 
   AllocatorStats() { Clear(); }
 
@@ -53,6 +94,9 @@ struct AllocatorStats {
     this->max_alloc_size = 0;
     this->bytes_limit = 0;
     this->total_allocated_bytes = 0;
+    this->num_extensions = 0;
+    this->total_free_bytes = 0;
+    this->largest_free_block_bytes = 0;
   }
 
   std::string DebugString() const {
@@ -62,7 +106,10 @@ struct AllocatorStats {
        << "TotalAllocated: " << this->total_allocated_bytes << "\n"
        << "MaxInUse:       " << this->max_bytes_in_use << "\n"
        << "NumAllocs:      " << this->num_allocs << "\n"
-       << "MaxAllocSize:   " << this->max_alloc_size << "\n";
+       << "MaxAllocSize:   " << this->max_alloc_size << "\n"
+       << "NumExtensions:  " << this->num_extensions << "\n"
+       << "TotalFree:      " << this->total_free_bytes << "\n"
+       << "LargestFree:    " << this->largest_free_block_bytes << "\n";
     return ss.str();
   }
 };
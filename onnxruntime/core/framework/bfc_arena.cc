@@ -3,8 +3,11 @@
 
 #include "core/framework/bfc_arena.h"
 #include <type_traits>
+#include "core/platform/env.h"
 
 namespace onnxruntime {
+thread_local const std::string* BFCArena::ScopedAllocationTag::current_tag_ = nullptr;
+
 BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
                    size_t total_memory,
                    ArenaExtendStrategy arena_extend_strategy,
@@ -33,6 +36,8 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
   stats_.bytes_limit = static_cast<int64_t>(total_memory);
 
   arena_extend_strategy_ = arena_extend_strategy;
+  enable_small_chunk_cache_ = device_allocator_->Info().device.Type() == OrtDevice::CPU;
+
   // Create a bunch of bins of various good sizes.
 
   // We create bins to fit all possible ranges that cover the
@@ -53,6 +58,13 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
 }
 
 BFCArena::~BFCArena() {
+  if (free_gate_ != nullptr) {
+    // the regions are freed wholesale below, so the parked chunks only need their tags back
+    for (const auto& gated : gated_frees_) {
+      free_gate_->ReleaseTag(gated.second);
+    }
+  }
+
   for (const auto& region : region_manager_.regions()) {
     device_allocator_->Free(region.ptr());
   }
@@ -72,7 +84,21 @@ BFCArena::Chunk* BFCArena::ChunkFromHandle(ChunkHandle h) {
 }
 
 Status BFCArena::Extend(size_t rounded_bytes) {
-  size_t available_bytes = memory_limit_ - static_cast<size_t>(stats_.total_allocated_bytes);
+  // A per-run budget acts as a temporary, lower memory limit so a single oversized
+  // request fails cleanly instead of growing the arena for everyone
+  // (see RunOptions::run_memory_budget_bytes).
+  size_t effective_limit = memory_limit_;
+  const int64_t run_budget = run_memory_budget_.load(std::memory_order_relaxed);
+  if (run_budget > 0 && static_cast<uint64_t>(run_budget) < effective_limit) {
+    if (stats_.total_allocated_bytes + static_cast<int64_t>(rounded_bytes) > run_budget) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Per-run memory budget of ", run_budget,
+                             " bytes exhausted: ", stats_.total_allocated_bytes,
+                             " bytes are already reserved and the request needs ", rounded_bytes, " more.");
+    }
+    effective_limit = static_cast<size_t>(run_budget);
+  }
+
+  size_t available_bytes = effective_limit - static_cast<size_t>(stats_.total_allocated_bytes);
   // Rounds available_bytes down to the nearest multiple of kMinAllocationSize.
   available_bytes = (available_bytes / kMinAllocationSize) * kMinAllocationSize;
 
@@ -158,9 +184,16 @@ Status BFCArena::Extend(size_t rounded_bytes) {
   LOGS_DEFAULT(INFO) << "Extended allocation by " << bytes << " bytes.";
 
   stats_.total_allocated_bytes += bytes;
+  ++stats_.num_extensions;
   LOGS_DEFAULT(INFO) << "Total allocated bytes: "
                      << stats_.total_allocated_bytes;
 
+  // surface arena growth to always-on trace listeners; sampling is applied by the
+  // telemetry implementation
+  Env::Default().GetTelemetryProvider().LogArenaExtension(device_allocator_->Info().name,
+                                                          static_cast<int64_t>(bytes),
+                                                          stats_.total_allocated_bytes);
+
   LOGS_DEFAULT(INFO) << "Allocated memory at " << mem_addr << " to "
                      << static_cast<void*>(static_cast<char*>(mem_addr) + bytes);
   region_manager_.AddAllocationRegion(mem_addr, bytes);
@@ -264,9 +297,21 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
   // The BFC allocator tries to find the best fit first.
   BinNum bin_num = BinNumForSize(rounded_bytes);
 
+  if (enable_small_chunk_cache_ && bin_num < kNumCachedBins) {
+    void* cached_ptr = TakeFromSmallChunkCache(bin_num, rounded_bytes);
+    if (cached_ptr != nullptr) {
+      return cached_ptr;
+    }
+  }
+
   std::lock_guard<OrtMutex> lock(lock_);
+  if (free_gate_ != nullptr) {
+    SweepGatedFrees();
+  }
+
   void* ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes);
   if (ptr != nullptr) {
+    RememberSmallChunk(ptr);
     return ptr;
   }
 
@@ -278,12 +323,31 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
   if (status.IsOK()) {
     ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes);
     if (ptr != nullptr) {
+      RememberSmallChunk(ptr);
       return ptr;
     } else {
       status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
                                "Failed to find a free memory block despite calling Extend. rounded_bytes=",
                                rounded_bytes);
     }
+  } else if (enable_small_chunk_cache_ && FlushSmallChunkCache() > 0) {
+    // returning the cached chunks to the bins may have allowed coalescing into a chunk that
+    // is large enough
+    ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes);
+    if (ptr != nullptr) {
+      RememberSmallChunk(ptr);
+      return ptr;
+    }
+  }
+
+  if (free_gate_ != nullptr && DrainGatedFrees() > 0) {
+    // waiting out the device work behind the gated frees may have released and
+    // coalesced enough memory to satisfy the request after all
+    ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes);
+    if (ptr != nullptr) {
+      RememberSmallChunk(ptr);
+      return ptr;
+    }
   }
 
   // We searched all bins for an existing free chunk to use and
@@ -298,9 +362,132 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
   ORT_THROW(status.ErrorMessage());
 }
 
+const std::string* BFCArena::InternCurrentTag() {
+  const std::string* tag = ScopedAllocationTag::Current();
+  if (tag == nullptr) {
+    return nullptr;
+  }
+  return &*allocation_tags_.insert(*tag).first;
+}
+
 void BFCArena::GetStats(AllocatorStats* stats) {
   std::lock_guard<OrtMutex> lock(lock_);
   *stats = stats_;
+  // chunks in the small-chunk cache are free from the caller's point of view, and cache hits
+  // are allocations that didn't go through the bins
+  stats->bytes_in_use -= cached_bytes_.load(std::memory_order_relaxed);
+  stats->num_allocs += num_cache_hits_.load(std::memory_order_relaxed);
+
+  // free-space fragmentation: compare the largest binned free chunk against the total.
+  // cached small chunks count as free bytes but stay out of the largest-block figure,
+  // since they cannot be coalesced or serve a large request while cached.
+  stats->total_free_bytes = cached_bytes_.load(std::memory_order_relaxed);
+  stats->largest_free_block_bytes = 0;
+  for (BinNum bin_num = 0; bin_num < kNumBins; ++bin_num) {
+    for (ChunkHandle handle : BinFromIndex(bin_num)->free_chunks) {
+      const Chunk* chunk = ChunkFromHandle(handle);
+      stats->total_free_bytes += static_cast<int64_t>(chunk->size);
+      stats->largest_free_block_bytes =
+          std::max(stats->largest_free_block_bytes, static_cast<int64_t>(chunk->size));
+    }
+  }
+}
+
+void* BFCArena::TakeFromSmallChunkCache(BinNum bin_num, size_t rounded_bytes) {
+  SmallChunkShard& shard = SmallChunkShardForThisThread();
+  std::lock_guard<OrtMutex> shard_lock(shard.mutex);
+  auto& entries = shard.free_chunks[bin_num];
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    if (it->second >= rounded_bytes) {
+      void* ptr = it->first;
+      cached_bytes_.fetch_sub(static_cast<int64_t>(it->second), std::memory_order_relaxed);
+      num_cache_hits_.fetch_add(1, std::memory_order_relaxed);
+      *it = entries.back();
+      entries.pop_back();
+      return ptr;
+    }
+  }
+
+  return nullptr;
+}
+
+bool BFCArena::ReturnToSmallChunkCache(void* p) {
+  size_t chunk_size = 0;
+  {
+    PtrToSizeShard& ptr_shard = PtrShardFor(p);
+    std::lock_guard<OrtMutex> ptr_lock(ptr_shard.mutex);
+    auto it = ptr_shard.sizes.find(p);
+    if (it == ptr_shard.sizes.end()) {
+      return false;
+    }
+    chunk_size = it->second;
+  }
+
+  // the chunk may be slightly larger than the original request, so bin by the chunk size.
+  // BinNumForSize(chunk size) is at most one bin above BinNumForSize(rounded request).
+  BinNum bin_num = BinNumForSize(chunk_size);
+  {
+    SmallChunkShard& shard = SmallChunkShardForThisThread();
+    std::lock_guard<OrtMutex> shard_lock(shard.mutex);
+    auto& entries = shard.free_chunks[bin_num];
+    if (entries.size() < kMaxCachedChunksPerBin) {
+      entries.emplace_back(p, chunk_size);
+      cached_bytes_.fetch_add(static_cast<int64_t>(chunk_size), std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  // this thread's shard is full, so return the chunk to the bins where it can be coalesced.
+  // the shard locks are never held while acquiring lock_.
+  {
+    PtrToSizeShard& ptr_shard = PtrShardFor(p);
+    std::lock_guard<OrtMutex> ptr_lock(ptr_shard.mutex);
+    ptr_shard.sizes.erase(p);
+  }
+
+  std::lock_guard<OrtMutex> lock(lock_);
+  DeallocateRawInternal(p);
+  return true;
+}
+
+void BFCArena::RememberSmallChunk(void* ptr) {
+  if (!enable_small_chunk_cache_) {
+    return;
+  }
+
+  ChunkHandle h = region_manager_.get_handle(ptr);
+  Chunk* c = ChunkFromHandle(h);
+  if (BinNumForSize(c->size) >= kNumCachedBins) {
+    return;
+  }
+
+  PtrToSizeShard& ptr_shard = PtrShardFor(ptr);
+  std::lock_guard<OrtMutex> ptr_lock(ptr_shard.mutex);
+  ptr_shard.sizes[ptr] = c->size;
+}
+
+size_t BFCArena::FlushSmallChunkCache() {
+  size_t num_flushed = 0;
+  for (auto& shard : small_chunk_shards_) {
+    std::lock_guard<OrtMutex> shard_lock(shard.mutex);
+    for (auto& entries : shard.free_chunks) {
+      for (auto& entry : entries) {
+        {
+          PtrToSizeShard& ptr_shard = PtrShardFor(entry.first);
+          std::lock_guard<OrtMutex> ptr_lock(ptr_shard.mutex);
+          ptr_shard.sizes.erase(entry.first);
+        }
+
+        cached_bytes_.fetch_sub(static_cast<int64_t>(entry.second), std::memory_order_relaxed);
+        DeallocateRawInternal(entry.first);
+        ++num_flushed;
+      }
+
+      entries.clear();
+    }
+  }
+
+  return num_flushed;
 }
 
 void* BFCArena::FindChunkPtr(BinNum bin_num, size_t rounded_bytes,
@@ -335,6 +522,7 @@ void* BFCArena::FindChunkPtr(BinNum bin_num, size_t rounded_bytes,
         // Assign a unique id and increment the id counter, marking the
         // chunk as being in use.
         chunk->allocation_id = next_allocation_id_++;
+        chunk->tag = InternCurrentTag();
         // Update stats.
         ++stats_.num_allocs;
         stats_.bytes_in_use += chunk->size;
@@ -388,6 +576,11 @@ void BFCArena::Free(void* p) {
   if (p == nullptr) {
     return;
   }
+
+  if (enable_small_chunk_cache_ && ReturnToSmallChunkCache(p)) {
+    return;
+  }
+
   std::lock_guard<OrtMutex> lock(lock_);
   auto it = reserved_chunks_.find(p);
   if (it != reserved_chunks_.end()) {
@@ -405,10 +598,51 @@ void BFCArena::DeallocateRawInternal(void* ptr) {
   BFCArena::ChunkHandle h = region_manager_.get_handle(ptr);
   ORT_ENFORCE(h != kInvalidChunkHandle);
 
+  if (free_gate_ != nullptr) {
+    SweepGatedFrees();
+    void* tag = free_gate_->TagPendingWork();
+    if (tag != nullptr) {
+      gated_frees_.emplace_back(h, tag);
+      return;
+    }
+  }
+
   // Consider coalescing it.
   FreeAndMaybeCoalesce(h);
 }
 
+void BFCArena::SetFreeGate(std::unique_ptr<IArenaFreeGate> gate) {
+  std::lock_guard<OrtMutex> lock(lock_);
+  ORT_ENFORCE(gated_frees_.empty(), "Cannot replace the free gate while gated frees are pending");
+  free_gate_ = std::move(gate);
+}
+
+void BFCArena::SweepGatedFrees() {
+  size_t kept = 0;
+  for (size_t i = 0; i < gated_frees_.size(); ++i) {
+    if (free_gate_->IsTagComplete(gated_frees_[i].second)) {
+      free_gate_->ReleaseTag(gated_frees_[i].second);
+      FreeAndMaybeCoalesce(gated_frees_[i].first);
+    } else {
+      gated_frees_[kept++] = gated_frees_[i];
+    }
+  }
+  gated_frees_.resize(kept);
+}
+
+size_t BFCArena::DrainGatedFrees() {
+  size_t drained = gated_frees_.size();
+  for (const auto& gated : gated_frees_) {
+    while (!free_gate_->IsTagComplete(gated.second)) {
+      std::this_thread::yield();
+    }
+    free_gate_->ReleaseTag(gated.second);
+    FreeAndMaybeCoalesce(gated.first);
+  }
+  gated_frees_.clear();
+  return drained;
+}
+
 // Merges h1 and h2 when Chunk(h1)->next is h2 and Chunk(h2)->prev is c1.
 // We merge Chunk(h2) into Chunk(h1).
 void BFCArena::Merge(BFCArena::ChunkHandle h1,
@@ -481,6 +715,7 @@ void BFCArena::FreeAndMaybeCoalesce(BFCArena::ChunkHandle h) {
 
   // Mark the chunk as no longer in use
   c->allocation_id = -1;
+  c->tag = nullptr;
 
   // Updates the stats.
   stats_.bytes_in_use -= c->size;
@@ -593,15 +828,18 @@ void BFCArena::DumpMemoryLog(size_t num_bytes) {
   // number by size.
   LOGS_DEFAULT(INFO) << "Overall chunks summary:";
   std::map<size_t, int> in_use_by_size;
+  std::map<std::string, size_t> in_use_by_tag;
   for (const auto& region : region_manager_.regions()) {
     ChunkHandle h = region_manager_.get_handle(region.ptr());
     while (h != kInvalidChunkHandle) {
       const Chunk* c = ChunkFromHandle(h);
       if (c->in_use()) {
         in_use_by_size[c->size]++;
+        in_use_by_tag[c->tag != nullptr ? *c->tag : "<untagged>"] += c->size;
       }
       LOGS_DEFAULT(INFO) << (c->in_use() ? "  Chunk" : "  Free ") << " at " << c->ptr
-                         << " of size " << c->size;
+                         << " of size " << c->size
+                         << (c->in_use() && c->tag != nullptr ? ", allocated by " + *c->tag : "");
       h = c->next;
     }
   }
@@ -615,6 +853,20 @@ void BFCArena::DumpMemoryLog(size_t num_bytes) {
   }
 
   LOGS_DEFAULT(INFO) << "Sum Total of in-use chunks: " << total_bytes;
+
+  // Attribute in-use memory to the nodes that allocated it, largest consumer first
+  // (see ScopedAllocationTag).
+  if (!in_use_by_tag.empty()) {
+    std::vector<std::pair<std::string, size_t>> by_tag(in_use_by_tag.begin(), in_use_by_tag.end());
+    std::sort(by_tag.begin(), by_tag.end(),
+              [](const std::pair<std::string, size_t>& a, const std::pair<std::string, size_t>& b) {
+                return a.second > b.second;
+              });
+    LOGS_DEFAULT(INFO) << "Summary of in-use chunks by node: ";
+    for (const auto& it : by_tag) {
+      LOGS_DEFAULT(INFO) << "  " << it.first << ": " << it.second << " bytes";
+    }
+  }
   LOGS_DEFAULT(INFO) << "Stats: \n"
                      << stats_.DebugString();
 }
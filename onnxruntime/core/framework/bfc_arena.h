@@ -16,9 +16,13 @@ limitations under the License.
 
 #pragma once
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
@@ -78,7 +82,8 @@ class BFCArena : public IArenaAllocator {
   void* Reserve(size_t size) override;
 
   size_t Used() const override {
-    return static_cast<size_t>(stats_.bytes_in_use);
+    // chunks sitting in the small-chunk cache are free from the caller's point of view
+    return static_cast<size_t>(stats_.bytes_in_use - cached_bytes_.load(std::memory_order_relaxed));
   }
 
   size_t Max() const override {
@@ -90,7 +95,35 @@ class BFCArena : public IArenaAllocator {
     return device_allocator_->CreateFence(session_state);
   }
 
-  void GetStats(AllocatorStats* stats);
+  void GetStats(AllocatorStats* stats) override;
+
+  void SetRunMemoryBudget(int64_t budget_bytes) override {
+    run_memory_budget_.store(budget_bytes, std::memory_order_relaxed);
+  }
+
+  void SetFreeGate(std::unique_ptr<IArenaFreeGate> gate) override;
+
+  // Names the graph node on whose behalf this thread is currently allocating.
+  // Chunks handed out while a tag is active record it, so the DumpMemoryLog output
+  // produced on an out-of-memory failure can attribute in-use memory to nodes.
+  // The tag is thread local: allocations a kernel makes from intra-op pool threads
+  // are not attributed. The referenced string must outlive the scope.
+  class ScopedAllocationTag {
+   public:
+    explicit ScopedAllocationTag(const std::string& tag) : previous_(current_tag_) {
+      current_tag_ = &tag;
+    }
+
+    ~ScopedAllocationTag() { current_tag_ = previous_; }
+
+    static const std::string* Current() { return current_tag_; }
+
+   private:
+    const std::string* previous_;
+    static thread_local const std::string* current_tag_;
+
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScopedAllocationTag);
+  };
 
   size_t RequestedSize(const void* ptr);
 
@@ -143,6 +176,13 @@ class BFCArena : public IArenaAllocator {
     // What bin are we in?
     BinNum bin_num = kInvalidBinNum;
 
+    // Interned name of the node that was executing when the chunk was handed out
+    // (see ScopedAllocationTag), nullptr when no tag was active. Only meaningful
+    // while the chunk is in use. Chunks reused through the small-chunk cache keep
+    // the tag from their first allocation; those are small enough not to matter
+    // for out-of-memory analysis.
+    const std::string* tag = nullptr;
+
     bool in_use() const { return allocation_id != -1; }
 
     std::string DebugString(BFCArena* a, bool recurse) {
@@ -356,6 +396,19 @@ class BFCArena : public IArenaAllocator {
   // Removes the chunk metadata represented by 'h'.
   void DeleteChunk(ChunkHandle h);
 
+  // Returns the gated frees whose tagged device work has completed to the bins.
+  // Must be called with lock_ held.
+  void SweepGatedFrees();
+
+  // Blocks until every gated free has completed and returns them all to the bins.
+  // Last resort before reporting out of memory. Returns the number of chunks
+  // drained. Must be called with lock_ held.
+  size_t DrainGatedFrees();
+
+  // Returns a stable pointer to the allocation tag active on this thread, or nullptr.
+  // Must be called with lock_ held.
+  const std::string* InternCurrentTag();
+
   void DumpMemoryLog(size_t num_bytes);
 
   ChunkHandle AllocateChunk();
@@ -375,6 +428,62 @@ class BFCArena : public IArenaAllocator {
   // Computes and returns a BinDebugInfo for each Bin.
   std::array<BinDebugInfo, kNumBins> get_bin_debug_info();
 
+  // Small allocations are served from a sharded cache of recently freed chunks so that
+  // concurrent Alloc/Free calls from many intra-op threads don't all serialize on lock_.
+  // A cached chunk stays marked as in-use in the chunk metadata; it is returned to the
+  // bins (and becomes eligible for coalescing) when its shard is full or when an
+  // allocation can't be satisfied otherwise.
+  static const int kNumSmallChunkShards = 8;
+  static const BinNum kNumCachedBins = 8;  // cache chunks from bins of max size < 256 << 8 bytes
+  static const size_t kMaxCachedChunksPerBin = 8;
+
+  struct SmallChunkShard {
+    OrtMutex mutex;
+    // free chunks per bin as (ptr, chunk size) pairs
+    std::vector<std::pair<void*, size_t>> free_chunks[kNumCachedBins];
+  };
+
+  // Map from pointer to the size of its chunk for cache-eligible allocations, sharded by
+  // pointer so Free can find the chunk size without taking lock_.
+  struct PtrToSizeShard {
+    OrtMutex mutex;
+    std::unordered_map<const void*, size_t> sizes;
+  };
+
+  SmallChunkShard& SmallChunkShardForThisThread() {
+    return small_chunk_shards_[std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                               kNumSmallChunkShards];
+  }
+
+  PtrToSizeShard& PtrShardFor(const void* p) {
+    return ptr_to_size_shards_[std::hash<const void*>()(p) % kNumSmallChunkShards];
+  }
+
+  // Take a chunk of at least 'rounded_bytes' from this thread's shard. Returns nullptr on a miss.
+  void* TakeFromSmallChunkCache(BinNum bin_num, size_t rounded_bytes);
+
+  // Put 'p' into this thread's shard if it is a cache-eligible chunk. Returns false if the
+  // caller should free 'p' through the bins instead.
+  bool ReturnToSmallChunkCache(void* p);
+
+  // Record the chunk size of a newly allocated cache-eligible pointer. Must be called with
+  // lock_ held.
+  void RememberSmallChunk(void* ptr);
+
+  // Return all cached chunks to the bins so they can be coalesced. Must be called with
+  // lock_ held. Returns the number of chunks that were flushed.
+  size_t FlushSmallChunkCache();
+
+  // Per-run cap on total reserved bytes, 0 when no budgeted Run is in flight.
+  // Set from the Run() thread while allocations happen on pool threads, hence atomic.
+  std::atomic<int64_t> run_memory_budget_{0};
+
+  // See IArenaFreeGate. Frees parked behind the gate stay marked in-use in the
+  // chunk metadata until their tag completes, so they can neither be handed out
+  // nor coalesced in the meantime. Both guarded by lock_.
+  std::unique_ptr<IArenaFreeGate> free_gate_;
+  std::vector<std::pair<ChunkHandle, void*>> gated_frees_;
+
   // Structures immutable after construction
   size_t memory_limit_ = 0;
   ArenaExtendStrategy arena_extend_strategy_ = ArenaExtendStrategy::kNextPowerOfTwo;
@@ -448,8 +557,22 @@ class BFCArena : public IArenaAllocator {
 
   AllocatorStats stats_;
 
+  // Distinct allocation tags seen so far, so chunks can refer to them by stable pointer.
+  // Bounded by the number of nodes in the sessions sharing the arena.
+  std::unordered_set<std::string> allocation_tags_;
+
   std::unordered_map<void*, size_t> reserved_chunks_;
 
+  // see SmallChunkShard. only enabled for CPU based memory as that's where high frequency
+  // small allocations from concurrent threads occur.
+  bool enable_small_chunk_cache_ = false;
+  std::array<SmallChunkShard, kNumSmallChunkShards> small_chunk_shards_;
+  std::array<PtrToSizeShard, kNumSmallChunkShards> ptr_to_size_shards_;
+  // total bytes sitting in the small-chunk cache. these remain counted in stats_.bytes_in_use.
+  std::atomic<int64_t> cached_bytes_{0};
+  // allocations served from the small-chunk cache. folded into stats_.num_allocs in GetStats.
+  std::atomic<int64_t> num_cache_hits_{0};
+
   const int initial_chunk_size_bytes_;
   const int max_dead_bytes_per_chunk_;
 
@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/calibration_collector.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/framework/tensor.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+
+void CalibrationCollector::Collect(const std::string& name, const Tensor& tensor) {
+  if (!tensor.IsDataType<float>()) {
+    return;
+  }
+
+  const size_t count = static_cast<size_t>(tensor.Shape().Size());
+  if (count == 0) {
+    return;
+  }
+
+  const float* data = tensor.Data<float>();
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  CollectValues(data, count, stats_[name]);
+}
+
+void CalibrationCollector::CollectValues(const float* data, size_t count, TensorStats& stats) const {
+  ConstEigenVectorArrayMap<float> values(data, count);
+
+  const float chunk_min = values.minCoeff();
+  const float chunk_max = values.maxCoeff();
+  stats.min = std::min(stats.min, chunk_min);
+  stats.max = std::max(stats.max, chunk_max);
+  stats.num_values += count;
+
+  const float abs_max = std::max(std::abs(chunk_min), std::abs(chunk_max));
+
+  if (stats.histogram.empty()) {
+    stats.histogram.assign(num_histogram_bins_, 0);
+    // an all-zero tensor gives no usable range yet; leave it at 0 and everything
+    // lands in the first bin until a later Run establishes one.
+    stats.histogram_range = abs_max;
+  }
+
+  // grow the range by doubling until the chunk fits, folding adjacent bin pairs so the
+  // counts collected at the finer granularity stay exact.
+  while (stats.histogram_range < abs_max) {
+    if (stats.histogram_range == 0.f) {
+      stats.histogram_range = abs_max;
+      break;
+    }
+
+    stats.histogram_range *= 2.f;
+    const size_t half = stats.histogram.size() / 2;
+    for (size_t i = 0; i < half; ++i) {
+      stats.histogram[i] = stats.histogram[2 * i] + stats.histogram[2 * i + 1];
+    }
+    std::fill(stats.histogram.begin() + half, stats.histogram.end(), static_cast<uint64_t>(0));
+  }
+
+  const size_t num_bins = stats.histogram.size();
+  if (stats.histogram_range == 0.f) {
+    stats.histogram[0] += count;
+    return;
+  }
+
+  const float scale = static_cast<float>(num_bins) / stats.histogram_range;
+  for (size_t i = 0; i < count; ++i) {
+    const size_t bin = std::min(num_bins - 1, static_cast<size_t>(std::abs(data[i]) * scale));
+    ++stats.histogram[bin];
+  }
+}
+
+std::map<std::string, CalibrationCollector::TensorStats> CalibrationCollector::GetTable() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace onnxruntime
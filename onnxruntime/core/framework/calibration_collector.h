@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+class Tensor;
+
+// Streams per-tensor activation statistics during representative Runs so int8 quantization
+// ranges can be derived in a single pass at native speed, instead of re-running the model
+// with extra graph outputs and collecting activations externally. The sequential executor
+// feeds every float tensor produced on CPU into Collect; statistics are merged across Runs.
+// Enabled via InferenceSession::EnableCalibrationCollection. Owned by the InferenceSession,
+// which must outlive the session state that references it.
+class CalibrationCollector {
+ public:
+  struct TensorStats {
+    float min = std::numeric_limits<float>::max();
+    float max = std::numeric_limits<float>::lowest();
+
+    // histogram of absolute values over [0, histogram_range) with equal-width bins; values
+    // at or above the range land in the last bin before the range is grown. the range only
+    // grows by doubling, which keeps re-binning of already collected counts exact (adjacent
+    // bin pairs merge).
+    std::vector<uint64_t> histogram;
+    float histogram_range = 0.f;
+
+    uint64_t num_values = 0;
+  };
+
+  explicit CalibrationCollector(int num_histogram_bins) : num_histogram_bins_(num_histogram_bins) {
+    ORT_ENFORCE(num_histogram_bins_ > 0, "num_histogram_bins must be positive");
+  }
+
+  // Accumulate statistics for one tensor produced during a Run. Tensors that are not float
+  // are ignored. Thread safe: nodes of one Run may produce tensors concurrently.
+  void Collect(const std::string& name, const Tensor& tensor);
+
+  // Snapshot of the statistics merged across all Runs so far.
+  std::map<std::string, TensorStats> GetTable() const;
+
+  int NumHistogramBins() const noexcept { return num_histogram_bins_; }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CalibrationCollector);
+
+  void CollectValues(const float* data, size_t count, TensorStats& stats) const;
+
+  const int num_histogram_bins_;
+
+  mutable OrtMutex mutex_;
+  std::map<std::string, TensorStats> stats_;
+};
+
+}  // namespace onnxruntime
@@ -73,6 +73,50 @@ Status IExecutionFrame::GetOrCreateNodeOutputMLValue(int index, const TensorShap
   return status;
 }
 
+Status IExecutionFrame::TryCreateSliceViewNodeOutputMLValue(int index, int input_index, ptrdiff_t byte_offset,
+                                                            const TensorShape& shape, OrtValue*& p_ort_value) {
+  p_ort_value = nullptr;
+
+  int ort_value_idx = GetNodeIdxToMLValueIdx(index);
+  int input_ort_value_idx = GetNodeIdxToMLValueIdx(input_index);
+  if (ort_value_idx == NodeIndexInfo::kInvalidEntry || input_ort_value_idx == NodeIndexInfo::kInvalidEntry) {
+    return Status::OK();
+  }
+
+  // only values the allocation plan marked as kSlicedView may be created as views - for anything
+  // else (e.g. graph outputs) the input's buffer is not guaranteed to outlive the output.
+  if (!IsPlannedAsSliceViewImpl(ort_value_idx)) {
+    return Status::OK();
+  }
+
+  OrtValue& ort_value = all_values_[ort_value_idx];
+  if (ort_value.IsAllocated()) {
+    // the kernel already created this output through another path. leave it as-is.
+    return Status::OK();
+  }
+
+  OrtValue& input_value = all_values_[input_ort_value_idx];
+  ORT_RETURN_IF_NOT(input_value.IsAllocated() && input_value.IsTensor(),
+                    "Slice view source must be an allocated tensor. ort_value_idx=", input_ort_value_idx);
+
+  Tensor* input_tensor = input_value.GetMutable<Tensor>();
+  const size_t view_bytes = static_cast<size_t>(shape.Size()) * input_tensor->DataType()->Size();
+  ORT_RETURN_IF_NOT(byte_offset >= 0 && static_cast<size_t>(byte_offset) + view_bytes <= input_tensor->SizeInBytes(),
+                    "Slice view exceeds the bounds of the source buffer. byte_offset=", byte_offset,
+                    " shape=", shape, " source bytes=", input_tensor->SizeInBytes());
+
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  auto p_tensor = onnxruntime::make_unique<Tensor>(input_tensor->DataType(), shape, input_tensor->MutableDataRaw(),
+                                                   input_tensor->Location(), byte_offset);
+  ort_value.Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+
+  // the view and the value it points into must be ordered by the same fence
+  ort_value.ShareFenceWith(input_value);
+
+  p_ort_value = &ort_value;
+  return Status::OK();
+}
+
 bool IExecutionFrame::TryGetInferredShape(int /*index*/, TensorShape& /*shape*/) const {
   // By default, there is not information about inferred shape, so this default
   // implementation always returns false. The derived class of IExecutionFrame
@@ -209,6 +253,11 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
       session_state_(session_state),
       mem_patterns_(nullptr),
       planner_(nullptr) {
+  // reuse the all_values_ storage of a previous frame over this session state, so per-Run frames
+  // (and the per-iteration frames control flow ops create over subgraph session states) don't
+  // each allocate the full vector of values
+  AdoptValuesStorage(session_state.CheckOutFrameValuesStorage());
+
   Init(feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(), fetches);
 
   // map the custom allocators to ort_value_idx entries
@@ -298,14 +347,117 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
       }
     }
   }
+
+  // Size the per-Run scratch arena from the cached pattern groups. The backing
+  // buffer itself is allocated lazily, on the first allocation that cannot be
+  // placed via a memory pattern.
+  if (session_state.GetEnablePerRunScratchArena()) {
+    scratch_capacity_ = session_state.GetCpuScratchArenaSizeEstimate();
+  }
+}
+
+ExecutionFrame::~ExecutionFrame() {
+  session_state_.ReturnFrameValuesStorage(ReleaseValuesStorage());
 }
 
-ExecutionFrame::~ExecutionFrame() = default;
+void* ExecutionFrame::AllocateFromScratchArena(const OrtMemoryInfo& location, size_t size) {
+  // Match the alignment used when computing tensor sizes.
+  constexpr size_t kScratchAlignment = 64;
+
+  std::unique_lock<std::mutex> lock(mtx_);
+  if (scratch_capacity_ == 0) {
+    return nullptr;
+  }
+
+  if (!scratch_buffer_) {
+    AllocatorPtr alloc = GetAllocator(location);
+    void* buffer = nullptr;
+    ORT_TRY {
+      buffer = alloc->Alloc(scratch_capacity_);
+    }
+    ORT_CATCH(const OnnxRuntimeException& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        LOGS(session_state_.Logger(), INFO) << "Allocation of per-Run scratch arena failed. Error:" << ex.what();
+      });
+    }
+
+    if (buffer == nullptr) {
+      // Disable the arena for the rest of this Run rather than retrying.
+      scratch_capacity_ = 0;
+      return nullptr;
+    }
+
+    scratch_buffer_ = BufferUniquePtr(buffer, alloc);
+  }
+
+  size_t aligned_size = size + (kScratchAlignment - (size % kScratchAlignment)) % kScratchAlignment;
+  if (scratch_used_ + aligned_size > scratch_capacity_) {
+    return nullptr;
+  }
+
+  void* p = static_cast<char*>(scratch_buffer_.get()) + scratch_used_;
+  scratch_used_ += aligned_size;
+  return p;
+}
 
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
 }
 
+Status ExecutionFrame::OffloadMLValue(int ort_value_idx) {
+  // Tensors below this size free too little device memory to pay for the copies.
+  constexpr size_t kMinBytesToOffload = 1024 * 1024;
+
+  OrtValue& ort_value = GetMutableMLValue(ort_value_idx);
+  if (!ort_value.IsAllocated() || !ort_value.IsTensor()) {
+    return Status::OK();
+  }
+
+  const Tensor& src = ort_value.Get<Tensor>();
+  // the copy round trip isn't worth it for small tensors, and a tensor already on CPU
+  // (e.g. after a kernel fell back to a CPU allocation) has nowhere to go
+  if (src.Location().device.Type() == OrtDevice::CPU || src.SizeInBytes() < kMinBytesToOffload) {
+    return Status::OK();
+  }
+
+  AllocatorPtr cpu_allocator = session_state_.GetAllocator(OrtDevice());
+  if (cpu_allocator == nullptr) {
+    return Status::OK();
+  }
+
+  auto host_tensor = onnxruntime::make_unique<Tensor>(src.DataType(), src.Shape(), cpu_allocator);
+  ORT_RETURN_IF_ERROR(CopyTensor(src, *host_tensor));
+
+  // replacing the OrtValue releases the device buffer
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  ort_value.Init(host_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+
+  return Status::OK();
+}
+
+Status ExecutionFrame::ReloadMLValue(int ort_value_idx) {
+  OrtValue& ort_value = GetMutableMLValue(ort_value_idx);
+  if (!ort_value.IsAllocated() || !ort_value.IsTensor()) {
+    return Status::OK();
+  }
+
+  const Tensor& src = ort_value.Get<Tensor>();
+  const OrtMemoryInfo& location = GetAllocationPlan(ort_value_idx).location;
+  // nothing to do if the value was never offloaded (e.g. it was below the size threshold)
+  if (src.Location().device == location.device) {
+    return Status::OK();
+  }
+
+  AllocatorPtr allocator = GetAllocator(location);
+  auto device_tensor = onnxruntime::make_unique<Tensor>(src.DataType(), src.Shape(), allocator);
+  ORT_RETURN_IF_ERROR(CopyTensor(src, *device_tensor));
+
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  ort_value.Init(device_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+
+  return Status::OK();
+}
+
 Status ExecutionFrame::AllocateMLValueTensorSelfOwnBuffer(OrtValue& ort_value, int ort_value_index,
                                                           MLDataType element_type, const OrtMemoryInfo& location,
                                                           const TensorShape& shape, bool create_fence) {
@@ -381,6 +533,22 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
     }
   }
 
+  // no memory pattern, or the pattern is not correct. try the per-Run scratch
+  // arena first so the activation doesn't pay for an individual allocation.
+  // outputs escape the frame so they must own their buffer, and string tensors
+  // need placement new which the raw arena cannot provide.
+  if (per_alloc_plan.alloc_kind != AllocKind::kAllocateOutput &&
+      location.device.Type() == OrtDevice::CPU &&
+      !utils::IsDataTypeString(element_type)) {
+    void* scratch = AllocateFromScratchArena(location, size);
+    if (scratch != nullptr) {
+      ORT_RETURN_IF_ERROR(
+          AllocateTensorWithPreAllocateBufferHelper(ort_value, scratch, element_type, location, shape));
+      TraceAllocate(ort_value_index, size);
+      return Status::OK();
+    }
+  }
+
   //no memory pattern, or the pattern is not correct.
   if (!alloc) alloc = GetAllocator(location);
   std::unique_ptr<Tensor> p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, alloc);
@@ -397,7 +565,10 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
     TraceAllocate(ort_value_index, size);
   }
 
-  {
+  // The accumulation is only consumed by the INFO-level memory summary logged after execution,
+  // but hashing the location name and taking the lock would cost every dynamically allocated
+  // value. Skip the bookkeeping when nothing will read it.
+  if (session_state_.Logger().OutputIsEnabled(logging::Severity::kINFO, logging::DataType::SYSTEM)) {
     // This code block is not thread-safe.
     // Dynamic activation size would be accessed by multiple threads
     // if parallel executor is used.
@@ -559,6 +730,14 @@ Status ExecutionFrame::AllocateAsPerAllocationPlan(OrtValue& ort_value, int ort_
         ort_value = GetMutableMLValue(reuse_mlvalue_index);
         break;
       }
+      case AllocKind::kSlicedView: {
+        // planned as a view over another value's buffer, but the kernel chose to copy instead
+        // (see OpKernelContext::TryOutputSliceView) - e.g. the slice was not contiguous - so give
+        // the output its own buffer. the viewed buffer just stays alive longer than needed.
+        ORT_RETURN_IF_ERROR(AllocateMLValueTensorSelfOwnBuffer(ort_value, ort_value_index, ml_data_type, alloc_info,
+                                                               *shape, per_alloc_plan.create_fence_if_async));
+        break;
+      }
       default: {
         std::ostringstream ostr;
         ostr << "Invalid allocation kind: " << static_cast<std::underlying_type<AllocKind>::type>(alloc_kind);
@@ -581,6 +760,13 @@ AllocatorPtr ExecutionFrame::GetAllocatorImpl(const OrtMemoryInfo& info) const {
   return session_state_.GetAllocator(info);
 }
 
+bool ExecutionFrame::IsPlannedAsSliceViewImpl(int ort_value_idx) const {
+  const SequentialExecutionPlan* p_seq_exec_plan = session_state_.GetExecutionPlan();
+  return p_seq_exec_plan != nullptr &&
+         ort_value_idx >= 0 && static_cast<size_t>(ort_value_idx) < p_seq_exec_plan->allocation_plan.size() &&
+         p_seq_exec_plan->allocation_plan[ort_value_idx].alloc_kind == AllocKind::kSlicedView;
+}
+
 // This method is not thread safe!
 // Return S_OK and nullptr if index map to an value that is an unused optional input/output
 Status ExecutionFrame::CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx,
@@ -589,8 +775,12 @@ Status ExecutionFrame::CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_
 }
 
 Status ExecutionFrame::ReleaseMLValueImpl(int ort_value_idx) {
+  // an input declared ConsumedAfterRead may have been dropped by the kernel mid-Compute.
+  // the scheduled release after the node then finds it gone and must not trace a second free.
+  const bool was_allocated = IsMLValueAllocated(ort_value_idx);
   ORT_RETURN_IF_ERROR(IExecutionFrame::ReleaseMLValueImpl(ort_value_idx));
-  TraceFree(ort_value_idx);
+  if (was_allocated)
+    TraceFree(ort_value_idx);
   return Status::OK();
 }
 
@@ -55,6 +55,14 @@ class IExecutionFrame {
   // Shape is required for tensors but not traditional ML values.
   Status GetOrCreateNodeOutputMLValue(int index, const TensorShape* shape, OrtValue*& p_ort_value, size_t nnz = 0);
 
+  // Try to create the output value at 'index' as a tensor view over a contiguous slice of the
+  // input value at 'input_index', starting 'byte_offset' bytes into the input's data.
+  // Sets p_ort_value to nullptr when the allocation plan did not assign AllocKind::kSlicedView
+  // to the output (e.g. it is a graph output, or the kernel did not declare the pair via
+  // KernelDefBuilder::MaySliceView) - the caller must then allocate the output and copy.
+  Status TryCreateSliceViewNodeOutputMLValue(int index, int input_index, ptrdiff_t byte_offset,
+                                             const TensorShape& shape, OrtValue*& p_ort_value);
+
   // This function try retrieve the inferred shapes for the given NodeArg index.
   // If the retrival is sucessful, this function returns true and false otherwise.
   virtual bool TryGetInferredShape(int index, TensorShape& shape) const;
@@ -69,14 +77,36 @@ class IExecutionFrame {
 
   Status ReleaseMLValue(int ort_value_idx);
 
- protected:
   // get the ort_value_idx from NodeIndexInfo
   int GetNodeIdxToMLValueIdx(int index) const;
 
+ protected:
+
   OrtValue& GetMutableMLValue(int ort_value_index) { return const_cast<OrtValue&>(GetMLValue(ort_value_index)); }
 
+  // Reuse a previous frame's storage (empty, capacity retained) for all_values_ so Init's resize
+  // does not allocate. Must be called before Init.
+  void AdoptValuesStorage(std::vector<OrtValue>&& storage) {
+    all_values_ = std::move(storage);
+  }
+
+  // Release the storage backing all_values_, cleared with capacity retained, so it can be pooled
+  // for a later frame. The frame must not be used afterwards.
+  std::vector<OrtValue> ReleaseValuesStorage() {
+    all_values_.clear();
+    return std::move(all_values_);
+  }
+
   virtual Status ReleaseMLValueImpl(int ort_value_idx);
 
+  // returns true if the ort_value_idx is valid and the value is currently allocated.
+  // false for values already released, e.g. early via OpKernelContext::ReleaseConsumedInput.
+  bool IsMLValueAllocated(int ort_value_idx) const {
+    return ort_value_idx != NodeIndexInfo::kInvalidEntry &&
+           static_cast<size_t>(ort_value_idx) < all_values_size_ &&
+           all_values_[ort_value_idx].IsAllocated();
+  }
+
   // returns true if the ort_value_idx is an output from the graph
   bool IsOutput(int ort_value_idx) const;
 
@@ -93,6 +123,10 @@ class IExecutionFrame {
   virtual Status CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx, const TensorShape* shape,
                                              size_t nnz) = 0;
 
+  // whether the allocation plan assigned AllocKind::kSlicedView to the value. the base class has
+  // no plan, so only frames that do (ExecutionFrame) can hand out slice views.
+  virtual bool IsPlannedAsSliceViewImpl(int /*ort_value_idx*/) const { return false; }
+
   virtual Status CopyTensor(const Tensor& src, Tensor& dest) const = 0;
 
   const NodeIndexInfo& node_index_info_;
@@ -128,6 +162,16 @@ class ExecutionFrame final : public IExecutionFrame {
                                                 const OrtMemoryInfo& location, const TensorShape& shape,
                                                 bool create_fence = false);
 
+  // Copy the tensor at the given index to CPU memory and release its device buffer.
+  // Called by the executor between two distant uses of the value, as scheduled by the
+  // session's ActivationOffloadPlan. No-op for values that are unallocated, already on
+  // CPU, or too small to be worth the copies.
+  Status OffloadMLValue(int ort_value_idx);
+
+  // Copy a previously offloaded tensor back to the location the allocation plan assigned
+  // to it. No-op if the value is already in place.
+  Status ReloadMLValue(int ort_value_idx);
+
   // thread-safe
   Status GeneratePatterns(MemoryPatternGroup* out) const;
 
@@ -135,6 +179,12 @@ class ExecutionFrame final : public IExecutionFrame {
     return planner_ != nullptr;
   }
 
+  // True when this frame places its intermediates at offsets from a cached memory
+  // pattern instead of allocating them individually.
+  bool IsMemPatternBased() const {
+    return mem_patterns_ != nullptr;
+  }
+
   // This function try retrieve the inferred shapes for the given NodeArg index.
   // If the retrival is sucessful, this function returns true and false otherwise.
   bool TryGetInferredShape(int index, TensorShape& shape) const override;
@@ -165,6 +215,7 @@ class ExecutionFrame final : public IExecutionFrame {
   AllocatorPtr GetAllocatorImpl(const OrtMemoryInfo& info) const override;
   Status ReleaseMLValueImpl(int ort_value_idx) override;
   Status CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx, const TensorShape* shape, size_t nnz) override;
+  bool IsPlannedAsSliceViewImpl(int ort_value_idx) const override;
   Status CopyTensor(const Tensor& src, Tensor& dest) const override;
 
   common::Status AllocateAsPerAllocationPlan(OrtValue& ort_value, int ort_value_index, const TensorShape* shape,
@@ -180,6 +231,12 @@ class ExecutionFrame final : public IExecutionFrame {
   void TraceAllocate(int ort_value_idx, size_t size);
   void TraceFree(int ort_value_idx);
 
+  // Carve 'size' bytes out of the per-Run scratch arena, lazily allocating the
+  // arena's backing buffer on first use. Returns nullptr if the arena is
+  // disabled, could not be allocated, or is exhausted, in which case the caller
+  // should fall back to an individual allocation.
+  void* AllocateFromScratchArena(const OrtMemoryInfo& location, size_t size);
+
   const AllocPlanPerValue& GetAllocationPlan(int ort_value_idx);
 
   const SessionState& session_state_;
@@ -216,6 +273,15 @@ class ExecutionFrame final : public IExecutionFrame {
   // dynamic_activation_memory_sizes_in_byte_[location] is the dynamic memory consumption on "location".
   std::unordered_map<std::string, size_t> dynamic_activation_memory_sizes_in_byte_;
 
+  // Per-Run bump-pointer scratch arena for CPU activations that cannot be
+  // placed via a memory pattern. The backing buffer is allocated once (sized
+  // from the cached memory pattern groups) and handed back wholesale when the
+  // frame is destroyed, so individual activations bypass the allocator lock.
+  // Guarded by mtx_ as the parallel executor may allocate concurrently.
+  BufferUniquePtr scratch_buffer_;
+  size_t scratch_capacity_{0};
+  size_t scratch_used_{0};
+
   // Mutex which should be acquired when executing non-thread-safe member functions.
   // A current example is the tracker of dynamic memory allocation.
   mutable std::mutex mtx_;
@@ -71,4 +71,24 @@ void FeedsFetchesManager::SetDeviceCopyChecks(DeviceCopyCheck input_copy_needed,
           ? DeviceCopyCheck::NoCopy
           : DeviceCopyCheck::Copy;
 }
+
+FeedsFetchesManager::DeviceCopyScratch FeedsFetchesManager::CheckOutDeviceCopyScratch() const {
+  DeviceCopyScratch scratch;
+
+  std::lock_guard<OrtMutex> lock(device_copy_scratch_mutex_);
+  scratch.feeds.swap(device_copy_scratch_.feeds);
+  scratch.fetches.swap(device_copy_scratch_.fetches);
+
+  return scratch;
+}
+
+void FeedsFetchesManager::ReturnDeviceCopyScratch(DeviceCopyScratch&& scratch) const {
+  // release the OrtValues outside the lock so only the vector capacity is kept between executions
+  scratch.feeds.clear();
+  scratch.fetches.clear();
+
+  std::lock_guard<OrtMutex> lock(device_copy_scratch_mutex_);
+  device_copy_scratch_.feeds.swap(scratch.feeds);
+  device_copy_scratch_.fetches.swap(scratch.fetches);
+}
 }  // namespace onnxruntime
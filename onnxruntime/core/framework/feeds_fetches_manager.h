@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/framework/ml_value.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 class ExecutionProviders;
@@ -73,6 +74,22 @@ class FeedsFetchesManager {
   const DeviceCopyChecks& GetDeviceCopyChecks() const { return device_copy_checks_; }
   void SetDeviceCopyChecks(DeviceCopyCheck input_copy_needed, DeviceCopyCheck output_copy_needed);
 
+  // Scratch vectors for the device-copy path in graph execution. A control flow kernel executes
+  // its subgraph with the same FeedsFetchesManager once per iteration, so recycling these lets
+  // steady-state iterations reuse the vector capacity instead of reallocating it. The OrtValues
+  // themselves are dropped when the scratch is returned so no tensor buffers are retained.
+  struct DeviceCopyScratch {
+    std::vector<OrtValue> feeds;
+    std::vector<OrtValue> fetches;
+  };
+
+  // Take the cached scratch for the duration of one execution. If another thread currently has
+  // it (concurrent Runs share the manager) the returned vectors are simply empty.
+  DeviceCopyScratch CheckOutDeviceCopyScratch() const;
+
+  // Return the scratch so the next execution can reuse its capacity.
+  void ReturnDeviceCopyScratch(DeviceCopyScratch&& scratch) const;
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(FeedsFetchesManager);
 
@@ -82,5 +99,8 @@ class FeedsFetchesManager {
 
   std::vector<MLValueCopyInfo> feeds_device_copy_info_;
   std::vector<MLValueCopyInfo> fetches_device_copy_info_;
+
+  mutable OrtMutex device_copy_scratch_mutex_;
+  mutable DeviceCopyScratch device_copy_scratch_;
 };
 }  // namespace onnxruntime
@@ -4,6 +4,9 @@
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
 #include "core/framework/graph_partitioner.h"
+
+#include <unordered_set>
+
 #include "core/framework/kernel_registry_manager.h"
 #include "core/graph/function.h"
 #include "core/graph/graph_viewer.h"
@@ -12,6 +15,7 @@
 #include "core/framework/execution_providers.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/func_kernel.h"
+#include "core/platform/env.h"
 
 // uncomment this line to count non-CUDA ops in ONNX domain
 //#define COUNT_NON_CUDA_OPS
@@ -53,6 +57,82 @@ static void BuildFusedKernelDef(KernelDefBuilder& builder, const IndexedSubGraph
 }
 
 #if !defined(ORT_MINIMAL_BUILD)
+
+// A node whose inputs are produced by DequantizeLinear nodes and whose outputs feed QuantizeLinear
+// nodes forms a QDQ group together with those nodes. If such a group is split across execution
+// providers the quantized region runs dequantized, with extra conversions at the boundary, so the
+// groups are treated as atomic units when handing out capabilities.
+static void GetQDQNodeGroups(const Graph& graph,
+                             std::vector<std::vector<NodeIndex>>& qdq_groups,
+                             std::unordered_map<NodeIndex, size_t>& node_to_qdq_group) {
+  auto is_qdq_node = [](const Node& node, const char* op_type) {
+    return node.OpType() == op_type &&
+           (node.Domain() == kOnnxDomain || node.Domain() == kOnnxDomainAlias);
+  };
+
+  for (const auto& node : graph.Nodes()) {
+    if (is_qdq_node(node, "QuantizeLinear") || is_qdq_node(node, "DequantizeLinear") ||
+        node_to_qdq_group.count(node.Index()) > 0) {
+      continue;
+    }
+
+    // a Q or DQ node that is already part of another group stays there. the remaining nodes still
+    // form a group so the quantized data flow between the two groups is preserved.
+    std::vector<NodeIndex> group;
+    for (auto it = node.InputNodesBegin(), end = node.InputNodesEnd(); it != end; ++it) {
+      if (is_qdq_node(*it, "DequantizeLinear") && node_to_qdq_group.count(it->Index()) == 0) {
+        group.push_back(it->Index());
+      }
+    }
+
+    if (group.empty()) {
+      continue;  // node does not consume quantized data
+    }
+
+    const size_t num_dq_nodes = group.size();
+    for (auto it = node.OutputNodesBegin(), end = node.OutputNodesEnd(); it != end; ++it) {
+      if (is_qdq_node(*it, "QuantizeLinear") && node_to_qdq_group.count(it->Index()) == 0) {
+        group.push_back(it->Index());
+      }
+    }
+
+    if (group.size() == num_dq_nodes) {
+      continue;  // output is not re-quantized so there is no group to keep together
+    }
+
+    group.push_back(node.Index());
+
+    const size_t group_id = qdq_groups.size();
+    for (NodeIndex index : group) {
+      node_to_qdq_group.insert({index, group_id});
+    }
+
+    qdq_groups.push_back(std::move(group));
+  }
+}
+
+// Check whether assigning <capability> would break a QDQ group apart because the EP did not offer
+// to take all the nodes in the group.
+static bool SplitsQDQGroup(const IndexedSubGraph& capability,
+                           const std::vector<std::vector<NodeIndex>>& qdq_groups,
+                           const std::unordered_map<NodeIndex, size_t>& node_to_qdq_group,
+                           const std::unordered_set<NodeIndex>& claimed_nodes) {
+  for (NodeIndex node_index : capability.nodes) {
+    auto it = node_to_qdq_group.find(node_index);
+    if (it == node_to_qdq_group.end()) {
+      continue;
+    }
+
+    for (NodeIndex group_node : qdq_groups[it->second]) {
+      if (claimed_nodes.count(group_node) == 0) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 static void BuildFusedKernelDef(KernelDefBuilder& builder, const onnxruntime::Node& node) {
   auto schema = node.Op();
   builder.SetName(schema->Name())
@@ -210,11 +290,36 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, bool export_dll, FuncMa
                                                          entry->sub_graph->GetMetaDef() != nullptr;
                                                 }));
 
+  // find the QDQ groups in the graph, and the full set of nodes this EP offered to take, so that a
+  // capability that would break a group apart can be rejected. a lower priority EP that can take
+  // the whole group (ultimately the CPU EP, which handles any node) runs it instead, keeping the
+  // quantized region on a single EP.
+  std::vector<std::vector<NodeIndex>> qdq_groups;
+  std::unordered_map<NodeIndex, size_t> node_to_qdq_group;
+  std::unordered_set<NodeIndex> claimed_nodes;
+
+  if (mode == GraphPartitioner::Mode::kNormal) {
+    GetQDQNodeGroups(graph, qdq_groups, node_to_qdq_group);
+
+    if (!qdq_groups.empty()) {
+      for (const auto& capability : capabilities) {
+        if (capability && capability->sub_graph) {
+          claimed_nodes.insert(capability->sub_graph->nodes.cbegin(), capability->sub_graph->nodes.cend());
+        }
+      }
+    }
+  }
+
   for (auto& capability : capabilities) {
     if (!capability || !capability->sub_graph) {  // in theory an EP could return an empty value...
       continue;
     }
 
+    if (!qdq_groups.empty() &&
+        SplitsQDQGroup(*capability->sub_graph, qdq_groups, node_to_qdq_group, claimed_nodes)) {
+      continue;
+    }
+
     Node* n = PlaceNode(graph, *capability->sub_graph, kernel_registry_mgr, type, fusion_style, mode, fused_node_unique_id);
     if (n != nullptr) {
       nodes_to_compile.push_back(n);
@@ -508,6 +613,21 @@ Status GraphPartitioner::PartitionOrtFormatModel(
   return Status::OK();
 }
 
+// Count the nodes assigned to each provider, covering nested subgraphs. A fused node
+// counts as one, so for providers that compile fused subgraphs this is the number of
+// partitions the provider ended up with.
+static void CountNodesPerProvider(Graph& graph, std::unordered_map<std::string, uint32_t>& nodes_per_provider) {
+  for (auto& node : graph.Nodes()) {
+    for (auto& entry : node.GetAttributeNameToMutableSubgraphMap()) {
+      CountNodesPerProvider(*entry.second, nodes_per_provider);
+    }
+
+    if (!node.GetExecutionProviderType().empty()) {
+      ++nodes_per_provider[node.GetExecutionProviderType()];
+    }
+  }
+}
+
 Status GraphPartitioner::Partition(Graph& graph, bool export_dll, FuncManager& func_mgr, Mode mode,
                                    std::unordered_map<std::string, uint64_t>* compiled_kernel_hashes) const {
   // It is a greedy partitioning algorithm per provider preferences user provided when calling ONNX RUNTIME right now.
@@ -548,6 +668,15 @@ Status GraphPartitioner::Partition(Graph& graph, bool export_dll, FuncManager& f
     kernel_registry_mgr_.RegisterKernelRegistry(fused_kernel_registry);
   }
 
+  // one event per provider that received nodes, so always-on trace listeners can see
+  // how the model was split without enabling the file-based profiler
+  std::unordered_map<std::string, uint32_t> nodes_per_provider;
+  CountNodesPerProvider(graph, nodes_per_provider);
+  const Telemetry& telemetry = Env::Default().GetTelemetryProvider();
+  for (const auto& entry : nodes_per_provider) {
+    telemetry.LogGraphPartitioning(entry.first, entry.second);
+  }
+
   return Status::OK();
 }
 }  // namespace onnxruntime
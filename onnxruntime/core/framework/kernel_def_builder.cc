@@ -63,6 +63,14 @@ void KernelDef::CalculateHash() {
   hash_ |= uint64_t(hash[1]) << 32;
 }
 
+bool KernelDef::IsInputConsumedAfterRead(int input_index) const {
+  // -1 marks all inputs (used by variadic kernels such as Concat)
+  return std::find(consumed_after_read_inputs_.begin(), consumed_after_read_inputs_.end(), input_index) !=
+             consumed_after_read_inputs_.end() ||
+         std::find(consumed_after_read_inputs_.begin(), consumed_after_read_inputs_.end(), -1) !=
+             consumed_after_read_inputs_.end();
+}
+
 // TODO: Tell user why it has conflicts
 // TODO: Investigate why IsConflict() was not triggered when there were duplicate Tile CUDA
 // kernels registered. Removing `InputMemoryType<OrtMemTypeCPUInput>(1)` in the kernel definition
@@ -117,6 +125,14 @@ bool KernelDef::IsConflict(const KernelDef& other) const {
   if (alias_map_.empty() && !other.Alias().empty())
     return false;
 
+  //check slice view
+  for (auto& it : slice_view_map_) {
+    if (std::find(other.MaySliceView().begin(), other.MaySliceView().end(), it) == other.MaySliceView().end())
+      return false;
+  }
+  if (slice_view_map_.empty() && !other.MaySliceView().empty())
+    return false;
+
   //check memory type
   auto& other_input_mem_types = other.input_memory_type_args_;
   for (auto it : input_memory_type_args_) {
@@ -207,4 +223,25 @@ KernelDefBuilder& KernelDefBuilder::Alias(int input_index, int output_index) {
   return *this;
 }
 
+KernelDefBuilder& KernelDefBuilder::MaySliceView(const std::vector<std::pair<int, int>>& slice_views) {
+  kernel_def_->slice_view_map_ = slice_views;
+  return *this;
+}
+
+KernelDefBuilder& KernelDefBuilder::MaySliceView(int input_index, int output_index) {
+  kernel_def_->slice_view_map_.emplace_back(input_index, output_index);
+  return *this;
+}
+
+KernelDefBuilder& KernelDefBuilder::ConsumedAfterRead(const std::vector<int>& input_indexes) {
+  auto& consumed = kernel_def_->consumed_after_read_inputs_;
+  consumed.insert(consumed.end(), input_indexes.begin(), input_indexes.end());
+  return *this;
+}
+
+KernelDefBuilder& KernelDefBuilder::ConsumedAfterRead(int input_index) {
+  kernel_def_->consumed_after_read_inputs_.push_back(input_index);
+  return *this;
+}
+
 }  // namespace onnxruntime
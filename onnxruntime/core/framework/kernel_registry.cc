@@ -246,16 +246,15 @@ Status KernelRegistry::TryFindKernel(const onnxruntime::Node& node,
   const auto& node_provider = node.GetExecutionProviderType();
   const auto& expected_provider = (node_provider.empty() ? exec_provider : node_provider);
 
-  auto range = kernel_creator_fn_map_.equal_range(GetMapKey(node.OpType(), node.Domain(), expected_provider));
   *out = nullptr;
 
-  // if we have a hash (ORT format model) use only that.
+  // if we have a hash (ORT format model) use only that. the hash uniquely identifies a kernel def,
+  // so a single probe of the hash index replaces the string-keyed lookup below.
   if (kernel_def_hash != 0) {
-    for (auto i = range.first; i != range.second; ++i) {
-      if (i->second.kernel_def->GetHash() == kernel_def_hash) {
-        *out = &i->second;
-        return Status::OK();
-      }
+    auto hash_entry = kernel_def_hash_map_.find(kernel_def_hash);
+    if (hash_entry != kernel_def_hash_map_.cend()) {
+      *out = hash_entry->second;
+      return Status::OK();
     }
 
     std::ostringstream oss;
@@ -268,6 +267,7 @@ Status KernelRegistry::TryFindKernel(const onnxruntime::Node& node,
   }
 #if !defined(ORT_MINIMAL_BUILD)
   else {
+    auto range = kernel_creator_fn_map_.equal_range(GetMapKey(node.OpType(), node.Domain(), expected_provider));
     std::vector<std::string> verify_kernel_def_error_strs;
 
     for (auto i = range.first; i != range.second; ++i) {
@@ -319,7 +319,12 @@ Status KernelRegistry::Register(KernelCreateInfo&& create_info) {
 
   // Register the kernel.
   // Ownership of the KernelDef is transferred to the map.
-  kernel_creator_fn_map_.emplace(key, std::move(create_info));
+  auto entry = kernel_creator_fn_map_.emplace(key, std::move(create_info));
+
+  // add to the hash index used for lookup by kernel def hash. references into kernel_creator_fn_map_
+  // are stable so storing a pointer to the entry is safe.
+  kernel_def_hash_map_.emplace(entry->second.kernel_def->GetHash(), &entry->second);
+
   return Status::OK();
 }
 
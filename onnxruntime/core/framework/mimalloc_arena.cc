@@ -5,15 +5,25 @@
 namespace onnxruntime {
 MiMallocArena::MiMallocArena(std::unique_ptr<IAllocator> resource_allocator,
                              size_t total_memory)
-    : info_(resource_allocator->Info().name, OrtAllocatorType::OrtArenaAllocator, resource_allocator->Info().device, resource_allocator->Info().id, resource_allocator->Info().mem_type) {
+    : IArenaAllocator(OrtMemoryInfo(resource_allocator->Info().name,
+                                    OrtAllocatorType::OrtArenaAllocator,
+                                    resource_allocator->Info().device,
+                                    resource_allocator->Info().id,
+                                    resource_allocator->Info().mem_type)),
+      heap_(mi_heap_new()) {
+  ORT_ENFORCE(heap_ != nullptr, "Failed to create mimalloc heap");
   stats_.bytes_limit = total_memory;
 }
 
+MiMallocArena::~MiMallocArena() {
+  // releases every block still owned by this arena in one sweep
+  mi_heap_destroy(heap_);
+}
+
 void* MiMallocArena::Alloc(size_t size) {
-#if (MI_STAT > 1)
+  std::lock_guard<OrtMutex> lock(heap_mutex_);
   stats_.num_allocs++;
-#endif
-  return mi_malloc(size);
+  return mi_heap_malloc(heap_, size);
 }
 
 void MiMallocArena::Free(void* p) {
@@ -21,10 +31,12 @@ void MiMallocArena::Free(void* p) {
 }
 
 void* MiMallocArena::Reserve(size_t size) {
-  return mi_malloc(size);
+  std::lock_guard<OrtMutex> lock(heap_mutex_);
+  stats_.num_allocs++;
+  return mi_heap_malloc(heap_, size);
 }
 
-// mimalloc only maintains stats when compiled under debug (which in turn sets MI_STAT)
+// mimalloc only maintains byte counters when compiled under debug (which in turn sets MI_STAT)
 void MiMallocArena::GetStats(AllocatorStats* stats) {
 #if (MI_STAT > 1)
   auto current_stats = mi_heap_get_default()->tld->stats;
@@ -32,6 +44,7 @@ void MiMallocArena::GetStats(AllocatorStats* stats) {
   stats_.total_allocated_bytes = current_stats.reserved.current;
   stats_.max_bytes_in_use = current_stats.reserved.peak;
 #endif
+  std::lock_guard<OrtMutex> lock(heap_mutex_);
   *stats = stats_;
 }
 
@@ -1,19 +1,30 @@
 #if defined(USE_MIMALLOC_ARENA_ALLOCATOR)
 #include "core/common/common.h"
 #include "core/framework/arena.h"
+#include "core/platform/ort_mutex.h"
 #include "onnxruntime_config.h"
 
+// avoid pulling mimalloc.h into every consumer of this header
+struct mi_heap_s;
+
 namespace onnxruntime {
+
+// Arena backed by a private mimalloc heap. Every arena instance owns its own heap, so sessions
+// using this arena and sessions using BFCArena can run side by side in one binary, and
+// destroying the arena returns every outstanding block to the OS at once instead of walking
+// and freeing chunks one by one.
 class MiMallocArena : public IArenaAllocator {
  public:
   MiMallocArena(std::unique_ptr<IAllocator> resource_allocator, size_t total_memory);
 
+  ~MiMallocArena() override;
+
   void* Alloc(size_t size) override;
 
   void Free(void* p) override;
 
   // mimalloc only maintains stats when compiled under debug, or when MI_STAT >= 2
-  void GetStats(AllocatorStats* stats);
+  void GetStats(AllocatorStats* stats) override;
 
   void* Reserve(size_t size) override;
 
@@ -23,14 +34,16 @@ class MiMallocArena : public IArenaAllocator {
     return stats_.bytes_limit;
   }
 
-  const OrtMemoryInfo& Info() const override {
-    return info_;
-  }
-
   size_t AllocatedSize(const void* ptr);
 
-  OrtMemoryInfo info_;
+ private:
+  // mimalloc heaps may only be allocated from by one thread at a time, so allocations from
+  // concurrent Run threads are serialized here, matching the lock BFCArena takes on its own
+  // Alloc path. mi_free is thread safe and needs no lock.
+  mutable OrtMutex heap_mutex_;
+  mi_heap_s* heap_{nullptr};
   AllocatorStats stats_;
 };
+
 }  // namespace onnxruntime
 #endif
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/node_clustering.h"
+
+#include <string>
+#include <unordered_set>
+
+#include "core/common/make_unique.h"
+#include "core/framework/ort_value_name_idx_map.h"
+#include "core/graph/constants.h"
+
+namespace onnxruntime {
+
+namespace {
+// Ops cheap enough that one of them alone cannot keep the pool busy. Kernels publish no
+// cost hints, so membership in this set stands in for a cost model: element-wise math and
+// tensor-manipulation ops whose runtime is dominated by dispatch at the tensor sizes where
+// clustering matters.
+bool IsLightweightOp(const std::string& op_type) {
+  static const std::unordered_set<std::string> lightweight_ops{
+      "Abs", "Add", "Cast", "Ceil", "Clip", "Div", "Equal", "Erf", "Exp", "Flatten",
+      "Floor", "Gather", "Greater", "Identity", "Less", "Log", "Max", "Min", "Mul", "Neg",
+      "Not", "Pow", "Reciprocal", "Relu", "Reshape", "Round", "Shape", "Sigmoid", "Size",
+      "Slice", "Sqrt", "Squeeze", "Sub", "Tanh", "Transpose", "Unsqueeze", "Where"};
+  return lightweight_ops.count(op_type) != 0;
+}
+}  // namespace
+
+Status NodeClusterPlanner::CreatePlan(const GraphViewer& graph_viewer,
+                                      const OrtValueNameIdxMap& ort_value_name_idx_map,
+                                      const SequentialExecutionPlan& execution_plan,
+                                      std::unique_ptr<NodeClusterPlan>& cluster_plan) {
+  cluster_plan.reset();
+
+  const size_t num_steps = execution_plan.execution_plan.size();
+  auto plan = onnxruntime::make_unique<NodeClusterPlan>();
+  plan->cluster_end_at_step.resize(num_steps, 0);
+
+  // Outputs produced by the members of the cluster being grown.
+  std::unordered_set<std::string> cluster_outputs;
+  size_t cluster_start = 0;
+
+  // Record the cluster [cluster_start, end) if it has at least two members; a single node
+  // gains nothing from a parallel region around it.
+  auto close_cluster = [&](size_t end) {
+    if (end > cluster_start && end - cluster_start >= 2) {
+      plan->cluster_end_at_step[cluster_start] = end;
+      ++plan->num_clusters;
+    }
+    cluster_outputs.clear();
+  };
+
+  for (size_t step = 0; step < num_steps; ++step) {
+    const Node* node = graph_viewer.GetNode(execution_plan.execution_plan[step].node_index);
+    ORT_ENFORCE(node != nullptr, "Execution plan references a node that is not in the graph.");
+
+    bool eligible = node->GetExecutionProviderType() == kCpuExecutionProvider &&
+                    !node->ContainsSubgraph() &&
+                    !execution_plan.NodeHasFence(node->Index()) &&
+                    IsLightweightOp(node->OpType());
+
+    // Every output must be a fresh buffer: a member whose output reuses another value's
+    // buffer could race with a sibling reading or writing that buffer.
+    if (eligible) {
+      for (const auto* node_arg : node->OutputDefs()) {
+        if (!node_arg->Exists())
+          continue;
+
+        int ort_value_idx;
+        if (!ort_value_name_idx_map.GetIdx(node_arg->Name(), ort_value_idx).IsOK()) {
+          eligible = false;
+          break;
+        }
+
+        const AllocKind alloc_kind = execution_plan.allocation_plan[ort_value_idx].alloc_kind;
+        if (alloc_kind != AllocKind::kAllocate && alloc_kind != AllocKind::kAllocateOutput) {
+          eligible = false;
+          break;
+        }
+      }
+    }
+
+    if (!eligible) {
+      close_cluster(step);
+      cluster_start = step + 1;
+      continue;
+    }
+
+    // A member must not consume the output of an earlier member. Subgraph-bearing nodes
+    // were excluded above, so there are no implicit inputs to check.
+    bool depends_on_cluster = false;
+    for (const auto* node_arg : node->InputDefs()) {
+      if (node_arg->Exists() && cluster_outputs.count(node_arg->Name()) != 0) {
+        depends_on_cluster = true;
+        break;
+      }
+    }
+
+    if (depends_on_cluster) {
+      close_cluster(step);
+      cluster_start = step;
+    }
+
+    for (const auto* node_arg : node->OutputDefs()) {
+      if (node_arg->Exists())
+        cluster_outputs.insert(node_arg->Name());
+    }
+  }
+  close_cluster(num_steps);
+
+  if (plan->num_clusters > 0)
+    cluster_plan = std::move(plan);
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/sequential_execution_plan.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+
+class OrtValueNameIdxMap;
+
+// Static grouping of consecutive execution-plan steps whose nodes are cheap, mutually
+// independent CPU kernels. Built once per session from the sequential execution plan; the
+// SequentialExecutor runs the members of a cluster as sibling tasks in a single parallel
+// region on the intra-op pool, paying one dispatch for the whole group instead of leaving
+// the pool idle between a series of microsecond-scale kernels.
+struct NodeClusterPlan {
+  // Indexed by step in SequentialExecutionPlan::execution_plan. A non-zero entry at step i
+  // marks the start of a cluster spanning steps [i, cluster_end_at_step[i]); entries for
+  // the remaining steps of a cluster and for unclustered steps are zero.
+  std::vector<size_t> cluster_end_at_step;
+
+  // Number of clusters in the schedule.
+  size_t num_clusters{0};
+};
+
+class NodeClusterPlanner {
+ public:
+  // Builds a cluster schedule for the given execution plan, or leaves cluster_plan null if
+  // no two consecutive steps qualify. A node qualifies when it runs a lightweight CPU
+  // kernel with no fences and no subgraphs, every output is a fresh buffer in the
+  // allocation plan (no reuse, so concurrent members cannot alias each other), and it does
+  // not consume the output of an earlier member of the same cluster.
+  static Status CreatePlan(const GraphViewer& graph_viewer,
+                           const OrtValueNameIdxMap& ort_value_name_idx_map,
+                           const SequentialExecutionPlan& execution_plan,
+                           std::unique_ptr<NodeClusterPlan>& cluster_plan);
+};
+
+}  // namespace onnxruntime
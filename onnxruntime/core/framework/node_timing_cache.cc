@@ -0,0 +1,186 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/node_timing_cache.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "core/framework/op_kernel_context_internal.h"
+#include "core/framework/tensor.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+
+std::string NodeTimingCache::MakeNodeKey(const std::string& node_name, const std::string& op_type,
+                                         size_t node_index) {
+  if (node_name.empty()) {
+    return MakeString(op_type, "_", node_index);
+  }
+
+  return MakeString(node_name, "|", op_type);
+}
+
+std::string NodeTimingCache::MakeShapeKey(const OpKernelContextInternal& context) {
+  std::ostringstream oss;
+  const int input_count = context.InputCount();
+  for (int i = 0; i < input_count; ++i) {
+    if (i > 0) {
+      oss << ';';
+    }
+
+    const OrtValue* p_input = context.GetInputMLValue(i);
+    if (p_input != nullptr && p_input->IsTensor()) {
+      oss << p_input->Get<Tensor>().Shape().ToString();
+    }
+  }
+
+  return oss.str();
+}
+
+void NodeTimingCache::Record(const std::string& node_key, const std::string& shape_key, int64_t duration_us) {
+  if (duration_us < 0) {
+    return;
+  }
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  TimingEntry& entry = entries_[node_key][shape_key];
+  entry.count += 1;
+  entry.total_us += static_cast<uint64_t>(duration_us);
+}
+
+bool NodeTimingCache::GetAverageDurationUs(const std::string& node_key, double& average_us) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto it = entries_.find(node_key);
+  if (it == entries_.end()) {
+    return false;
+  }
+
+  uint64_t count = 0;
+  uint64_t total_us = 0;
+  for (const auto& shape_entry : it->second) {
+    count += shape_entry.second.count;
+    total_us += shape_entry.second.total_us;
+  }
+
+  if (count == 0) {
+    return false;
+  }
+
+  average_us = static_cast<double>(total_us) / static_cast<double>(count);
+  return true;
+}
+
+std::vector<std::string> NodeTimingCache::GetShapeKeys(const std::string& node_key) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  std::vector<std::string> shape_keys;
+  auto it = entries_.find(node_key);
+  if (it != entries_.end()) {
+    shape_keys.reserve(it->second.size());
+    for (const auto& shape_entry : it->second) {
+      shape_keys.push_back(shape_entry.first);
+    }
+  }
+
+  return shape_keys;
+}
+
+bool NodeTimingCache::Empty() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  return entries_.empty();
+}
+
+// One entry per line, tab separated: node key, shape key, count, total microseconds.
+// Keys may not contain tabs; node and op names with tabs are not expected in practice.
+common::Status NodeTimingCache::Load(const std::string& path) {
+  std::ifstream file(path);
+  if (!file) {
+    // a cache path that does not exist yet simply starts empty and is written on save
+    return Status::OK();
+  }
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty()) {
+      continue;
+    }
+
+    const size_t first_tab = line.find('\t');
+    const size_t second_tab = first_tab == std::string::npos ? std::string::npos : line.find('\t', first_tab + 1);
+    const size_t third_tab = second_tab == std::string::npos ? std::string::npos : line.find('\t', second_tab + 1);
+    if (third_tab == std::string::npos) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Invalid node timing cache entry in ", path, ": ", line);
+    }
+
+    const std::string node_key = line.substr(0, first_tab);
+    const std::string shape_key = line.substr(first_tab + 1, second_tab - first_tab - 1);
+    uint64_t count = 0;
+    uint64_t total_us = 0;
+    ORT_TRY {
+      count = std::stoull(line.substr(second_tab + 1, third_tab - second_tab - 1));
+      total_us = std::stoull(line.substr(third_tab + 1));
+    }
+    ORT_CATCH(const std::exception&) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Invalid node timing cache entry in ", path, ": ", line);
+    }
+
+    TimingEntry& entry = entries_[node_key][shape_key];
+    entry.count += count;
+    entry.total_us += total_us;
+  }
+
+  return Status::OK();
+}
+
+common::Status NodeTimingCache::Save(const std::string& path) const {
+  std::ofstream file(path, std::ios::trunc);
+  if (!file) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to open node timing cache file for writing: ", path);
+  }
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  for (const auto& node_entry : entries_) {
+    for (const auto& shape_entry : node_entry.second) {
+      file << node_entry.first << '\t' << shape_entry.first << '\t'
+           << shape_entry.second.count << '\t' << shape_entry.second.total_us << '\n';
+    }
+  }
+
+  if (!file) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to write node timing cache file: ", path);
+  }
+
+  return Status::OK();
+}
+
+std::vector<double> ComputeCriticalPathCosts(const GraphViewer& graph_viewer, const NodeTimingCache& timing_cache) {
+  std::vector<double> costs(graph_viewer.MaxNodeIndex(), 0.0);
+
+  // walk the topological order backwards so every successor's cost is final when used
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+  for (auto it = order.rbegin(); it != order.rend(); ++it) {
+    const Node* node = graph_viewer.GetNode(*it);
+    if (node == nullptr) {
+      continue;
+    }
+
+    double own_cost = 1.0;  // nominal cost so untimed nodes still contribute path length
+    const std::string node_key = NodeTimingCache::MakeNodeKey(node->Name(), node->OpType(), node->Index());
+    double average_us = 0.0;
+    if (timing_cache.GetAverageDurationUs(node_key, average_us)) {
+      own_cost = average_us;
+    }
+
+    double max_successor_cost = 0.0;
+    for (auto successor = node->OutputNodesBegin(); successor != node->OutputNodesEnd(); ++successor) {
+      max_successor_cost = std::max(max_successor_cost, costs[successor->Index()]);
+    }
+
+    costs[node->Index()] = own_cost + max_successor_cost;
+  }
+
+  return costs;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/status.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+class GraphViewer;
+class OpKernelContextInternal;
+
+/**
+Persisted per-node kernel timing profile.
+
+Kernel durations are recorded per node and per input-shape combination as the session runs,
+and can be saved to / loaded from a file so a later session starts with the timings of a
+previous one. The loaded profile drives cost-based scheduling: ComputeCriticalPathCosts turns
+it into a per-node remaining-critical-path cost that the parallel executor uses to run the
+critical path first.
+
+See kOrtSessionOptionsConfigNodeTimingCachePath.
+*/
+class NodeTimingCache {
+ public:
+  NodeTimingCache() = default;
+
+  // key identifying a node across sessions. node names can be blank, so the op type and graph
+  // node index are included the same way the profiler derives names for blank nodes.
+  static std::string MakeNodeKey(const std::string& node_name, const std::string& op_type, size_t node_index);
+
+  // key for the input shapes of one execution of the node, e.g. "{3,4};{4,1}".
+  // non-tensor and missing optional inputs contribute an empty entry.
+  static std::string MakeShapeKey(const OpKernelContextInternal& context);
+
+  // accumulate one measured kernel duration. thread safe.
+  void Record(const std::string& node_key, const std::string& shape_key, int64_t duration_us);
+
+  // average duration over every recorded shape combination for the node.
+  // returns false if the node was never recorded.
+  bool GetAverageDurationUs(const std::string& node_key, double& average_us) const;
+
+  // the input-shape keys recorded for the node, in unspecified order.
+  // empty if the node was never recorded.
+  std::vector<std::string> GetShapeKeys(const std::string& node_key) const;
+
+  bool Empty() const;
+
+  // load entries from the given file, merging into what has been recorded already.
+  // a missing file is not an error: the first session with a fresh cache path starts empty.
+  common::Status Load(const std::string& path);
+
+  common::Status Save(const std::string& path) const;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(NodeTimingCache);
+
+  struct TimingEntry {
+    uint64_t count{0};
+    uint64_t total_us{0};
+  };
+
+  mutable OrtMutex mutex_;
+  // node key -> shape key -> accumulated timing
+  std::unordered_map<std::string, std::unordered_map<std::string, TimingEntry>> entries_;
+};
+
+/**
+Computes, for every node, the cost of the most expensive path from the node to a graph sink:
+the node's own average duration from the timing profile plus the maximum cost among its
+successors. Nodes without a recorded timing get a nominal cost of 1us so path length still
+counts for them. The result is indexed by node index (size GraphViewer::MaxNodeIndex).
+*/
+std::vector<double> ComputeCriticalPathCosts(const GraphViewer& graph_viewer, const NodeTimingCache& timing_cache);
+
+}  // namespace onnxruntime
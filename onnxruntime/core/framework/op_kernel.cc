@@ -33,6 +33,18 @@ Tensor* OpKernelContext::Output(int index, const std::initializer_list<int64_t>&
   return Output(index, TensorShape(shape));
 }
 
+Tensor* OpKernelContext::TryOutputSliceView(int output_index, int input_index, ptrdiff_t byte_offset,
+                                            const TensorShape& shape) {
+  if (output_index < 0 || output_index >= OutputCount() || input_index < 0 || input_index >= InputCount())
+    return nullptr;
+
+  OrtValue* p_ml_value = nullptr;
+  Status status = execution_frame_->TryCreateSliceViewNodeOutputMLValue(
+      GetOutputArgIndex(output_index), GetInputArgIndex(input_index), byte_offset, shape, p_ml_value);
+  ORT_ENFORCE(status.IsOK(), status.ErrorMessage());
+  return p_ml_value ? p_ml_value->GetMutable<Tensor>() : nullptr;
+}
+
 SparseTensor* OpKernelContext::Output(int index, size_t nnz, const TensorShape& shape) {
   auto p_ml_value = OutputMLValue(index, shape, nnz);
   return p_ml_value ? p_ml_value->GetMutable<SparseTensor>() : nullptr;
@@ -46,6 +58,34 @@ bool OpKernelContext::TryGetInferredOutputShape(int index, TensorShape& shape) c
   return execution_frame_->TryGetInferredShape(GetOutputArgIndex(index), shape);
 }
 
+Status OpKernelContext::ReleaseConsumedInput(int index) {
+  if (index < 0 || index >= InputCount())
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid input index: ", index);
+
+  // the kernel must opt in per input via KernelDefBuilder::ConsumedAfterRead
+  if (!kernel_->KernelDef().IsInputConsumedAfterRead(index))
+    return Status::OK();
+
+  int ort_value_idx = execution_frame_->GetNodeIdxToMLValueIdx(GetInputArgIndex(index));
+  if (ort_value_idx == NodeIndexInfo::kInvalidEntry)
+    return Status::OK();
+
+  // the same value may be fed to more than one slot of this node (e.g. Concat(X, X)), in which
+  // case the kernel may still read it through the other slot. keep it and let the scheduled
+  // release after the node handle it.
+  for (int i = 0; i < InputCount(); ++i) {
+    if (i != index && execution_frame_->GetNodeIdxToMLValueIdx(GetInputArgIndex(i)) == ort_value_idx)
+      return Status::OK();
+  }
+
+  // only drop the value if the executor confirmed this node is its last consumer. a value that is
+  // reused by a later node, fed by the caller or fetched as a graph output stays put.
+  if (!CanReleaseInput(ort_value_idx))
+    return Status::OK();
+
+  return execution_frame_->ReleaseMLValue(ort_value_idx);
+}
+
 OrtValue* OpKernelContext::OutputMLValue(int index, const TensorShape& shape, size_t nnz) {
   if (index < 0 || index >= OutputCount())
     return nullptr;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <functional>
+#include "core/common/inlined_vector.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/session_state.h"
 #include "core/session/onnxruntime_c_api.h"
@@ -17,14 +18,23 @@ class ExecutionFrame;
 
 class OpKernelContextInternal : public OpKernelContext {
  public:
+  // a context is constructed per node execution, so the implicit input pointers use
+  // inline storage sized for typical control flow bodies to keep construction off
+  // the heap. nodes in a Loop body get a fresh context every iteration.
+  using ImplicitInputValues = InlinedVector<const OrtValue*, 8>;
+
   explicit OpKernelContextInternal(const SessionState& session_state,
                                    IExecutionFrame& frame,
                                    const OpKernel& kernel,
                                    const logging::Logger& logger,
-                                   const bool& terminate_flag)
+                                   const bool& terminate_flag,
+                                   const SequentialExecutionPlan::NodeExecutionPlan* node_exec_plan = nullptr,
+                                   const OrtRunOptions* run_options = nullptr)
       : OpKernelContext(&frame, &kernel, session_state.GetThreadPool(), logger),
         session_state_(session_state),
-        terminate_flag_(terminate_flag) {
+        terminate_flag_(terminate_flag),
+        node_exec_plan_(node_exec_plan),
+        run_options_(run_options) {
     const auto& implicit_inputs = kernel.Node().ImplicitInputDefs();
     int num_implicit_inputs = static_cast<int>(implicit_inputs.size());
     implicit_input_values_.reserve(num_implicit_inputs);
@@ -45,6 +55,12 @@ class OpKernelContextInternal : public OpKernelContext {
     return session_state_.GetSubgraphSessionState(GetNodeIndex(), attribute_name);
   }
 
+  const SessionState& GetSessionState() const {
+    return session_state_;
+  }
+
+  using OpKernelContext::GetNodeIndex;
+
   const OrtValue* GetInputMLValue(int index) const {
     return OpKernelContext::GetInputMLValue(index);
   }
@@ -58,16 +74,39 @@ class OpKernelContextInternal : public OpKernelContext {
   }
 
   // Get the OrtValue's for all implicit inputs. Order is same as Node::ImplicitInputDefs(). No nullptr entries.
-  const std::vector<const OrtValue*>& GetImplicitInputs() const {
+  const ImplicitInputValues& GetImplicitInputs() const {
     return implicit_input_values_;
   }
 
   const bool& GetTerminateFlag() const noexcept { return terminate_flag_; }
 
+  // options of the Run this execution belongs to. nullptr for subgraph executions
+  // started by control flow kernels.
+  const OrtRunOptions* GetRunOptions() const noexcept { return run_options_; }
+
+ protected:
+  // a value may be released early (see OpKernelContext::ReleaseConsumedInput) only if the
+  // execution plan frees it right after this node anyway, i.e. this node is its last consumer
+  // and its buffer is not reused downstream.
+  bool CanReleaseInput(int ort_value_index) const override {
+    if (node_exec_plan_ == nullptr)
+      return false;
+
+    const auto* exec_plan = session_state_.GetExecutionPlan();
+    for (int i = node_exec_plan_->free_from_index; i <= node_exec_plan_->free_to_index; ++i) {
+      if (exec_plan->to_be_freed[i] == ort_value_index)
+        return true;
+    }
+
+    return false;
+  }
+
  private:
   const SessionState& session_state_;
   const bool& terminate_flag_;
-  std::vector<const OrtValue*> implicit_input_values_;
+  const SequentialExecutionPlan::NodeExecutionPlan* node_exec_plan_;
+  const OrtRunOptions* run_options_;
+  ImplicitInputValues implicit_input_values_;
 };
 
 }  // namespace onnxruntime
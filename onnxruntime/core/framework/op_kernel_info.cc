@@ -5,6 +5,7 @@
 #include "core/framework/fuse_nodes_funcs.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/op_kernel_info.h"
+#include "core/framework/tensorprotoutils.h"
 
 namespace onnxruntime {
 
@@ -79,6 +80,27 @@ bool OpKernelInfo::TryGetConstantInput(int input_index, const Tensor** constant_
   return true;
 }
 
+bool OpKernelInfo::TryGetStaticInputShape(int input_index, TensorShape& shape) const {
+  if (input_index < 0 || input_index >= gsl::narrow_cast<int>(node_.InputDefs().size())) {
+    return false;
+  }
+
+  const auto* node_arg = node_.InputDefs()[input_index];
+  const auto* shape_proto = node_arg->Shape();
+  if (shape_proto == nullptr) {
+    return false;
+  }
+
+  for (const auto& dim : shape_proto->dim()) {
+    if (!utils::HasDimValue(dim) || dim.dim_value() < 0) {
+      return false;
+    }
+  }
+
+  shape = utils::GetTensorShapeFromTensorShapeProto(*shape_proto);
+  return true;
+}
+
 common::Status OpKernelInfo::GetFusedFuncs(NodeComputeInfo*& compute_info) const {
   return funcs_mgr_.GetFuncs(node_.Name(), compute_info);
 }
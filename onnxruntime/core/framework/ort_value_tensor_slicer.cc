@@ -43,7 +43,7 @@ OrtValueTensorSlicer<T>::Iterator::Iterator(T& ort_value, size_t slice_dimension
   if (!IAllocator::CalcMemSizeForArray(static_cast<size_t>(per_iteration_shape_size), tensor.DataType()->Size(),
                                        &per_iteration_offset_))
     ORT_THROW("size overflow");
-  const int64_t slice_dimension_size = shape.Slice(slice_dimension).Size();
+  const int64_t slice_dimension_size = shape.SizeFromDimension(slice_dimension);
   assert(slice_dimension_size >= 0);
 
   size_t total_len;
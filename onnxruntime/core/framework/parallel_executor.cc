@@ -3,6 +3,7 @@
 
 #include "core/framework/parallel_executor.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <thread>
@@ -11,6 +12,7 @@
 #include "core/common/logging/logging.h"
 #include "core/framework/allocation_planner.h"
 #include "core/framework/execution_frame.h"
+#include "core/framework/node_timing_cache.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
@@ -18,12 +20,18 @@
 
 namespace onnxruntime {
 
-ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag)
-    : out_standings_(0), terminate_flag_(terminate_flag), executor_pool_(session_state.GetInterOpThreadPool()) {
+ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag,
+                                   const OrtRunOptions* run_options)
+    : out_standings_(0),
+      terminate_flag_(terminate_flag),
+      run_options_(run_options),
+      executor_pool_(session_state.GetInterOpThreadPool()) {
   const auto& graph_viewer = session_state.GetGraphViewer();
-  node_refs_.resize(graph_viewer.MaxNodeIndex());
+  // make_unique value-initializes the array, so nodes not present in the graph
+  // keep a zero count.
+  node_refs_ = onnxruntime::make_unique<std::atomic<size_t>[]>(graph_viewer.MaxNodeIndex());
   for (auto& node : graph_viewer.Nodes()) {
-    node_refs_[node.Index()] = node.GetInputEdgesCount();
+    node_refs_[node.Index()].store(node.GetInputEdgesCount(), std::memory_order_relaxed);
   }
 }
 
@@ -41,19 +49,49 @@ Status ParallelExecutor::Execute(const SessionState& session_state, const std::v
   root_frame_ = onnxruntime::make_unique<ExecutionFrame>(feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches,
                                                          fetch_allocators, session_state);
   //std::cout << "start nodes:" << std::endl;
+  std::vector<size_t> root_nodes;
   for (auto node_index : session_state.GetGraphViewer().GetRootNodes()) {
     auto p_op_kernel = session_state.GetKernel(node_index);
     if (!p_op_kernel)
       continue;
 
     //std::cout << "\t" << p_op_kernel->Node().Name() << std::endl;
+    root_nodes.push_back(node_index);
+  }
+
+  // when a timing profile provided per-node costs, queue the most critical roots first so the
+  // pool starts on the critical path instead of whatever graph order put in front
+  const auto& critical_path_costs = session_state.GetNodeCriticalPathCosts();
+  if (!critical_path_costs.empty()) {
+    std::stable_sort(root_nodes.begin(), root_nodes.end(),
+                     [&critical_path_costs](size_t lhs, size_t rhs) {
+                       return critical_path_costs[lhs] > critical_path_costs[rhs];
+                     });
+  }
+
+  for (auto node_index : root_nodes) {
     EnqueueNode(node_index, session_state, logger);
   }
 
-  // Wait for finish.
+  // Wait for finish.  Rather than just blocking, help run queued work while
+  // waiting.  When control-flow kernels execute nested subgraphs on the same
+  // inter-op pool, each nesting level parks one thread here, and a nest as
+  // deep as the pool would deadlock if those threads did not keep executing
+  // queued nodes.
   {
     std::unique_lock<OrtMutex> lock(complete_mutex_);
-    while (out_standings_ > 0) complete_cv_.wait(lock);
+    while (out_standings_.load(std::memory_order_acquire) > 0) {
+      lock.unlock();
+      bool ran_task = concurrency::ThreadPool::TryRunPendingTask(executor_pool_);
+      lock.lock();
+      if (!ran_task && out_standings_.load(std::memory_order_acquire) > 0) {
+        // Nothing to help with; the remaining nodes are running on other
+        // threads.  Only the drop to zero outstanding nodes signals the
+        // condition variable, so wake periodically to pick up work queued
+        // in the meantime.
+        complete_cv_.wait_for(lock, std::chrono::milliseconds(1));
+      }
+    }
   }
 
   Status status = Status::OK();
@@ -109,7 +147,8 @@ Status ParallelExecutor::Execute(const SessionState& session_state, const std::v
 
 Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
                                       const SessionState& session_state,
-                                      const logging::Logger& logger) {
+                                      const logging::Logger& logger,
+                                      uint64_t dispatch_flow_id) {
   LOGS(logger, INFO) << "Begin execution";
 
   Status status = Status::OK();
@@ -120,6 +159,7 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time;
   const bool f_profiler_enabled = session_state.Profiler().IsEnabled();
+  NodeTimingCache* const timing_cache = session_state.GetNodeTimingCache();
   const SequentialExecutionPlan& exec_plan = *session_state.GetExecutionPlan();
 
   // Avoid context switching if possible.
@@ -139,7 +179,8 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       ORT_THROW("Got nullptr from GetKernel for node: ", node.Name());
     }
 
-    OpKernelContextInternal op_kernel_context(session_state, *root_frame_, *p_op_kernel, logger, terminate_flag_);
+    OpKernelContextInternal op_kernel_context(session_state, *root_frame_, *p_op_kernel, logger, terminate_flag_,
+                                              nullptr, run_options_);
 
     if (f_profiler_enabled) {
       sync_time_begin = session_state.Profiler().StartTime();
@@ -178,14 +219,30 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
     }
 
     if (f_profiler_enabled) {
-      session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
-                                                     node.Name() + "_fence_before",
-                                                     sync_time_begin,
-                                                     {{"op_name", p_op_kernel->KernelDef().OpName()}});
+      if (dispatch_flow_id != 0) {
+        // Complete the flow started by the thread that enqueued this node. Only the
+        // first node of the chain crossed threads; the rest run inline below.
+        session_state.Profiler().EndTimeAndRecordEventWithFlow(profiling::NODE_EVENT,
+                                                               node.Name() + "_fence_before",
+                                                               sync_time_begin,
+                                                               dispatch_flow_id,
+                                                               /*is_flow_source=*/false,
+                                                               {{"op_name", p_op_kernel->KernelDef().OpName()}});
+        dispatch_flow_id = 0;
+      } else {
+        session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
+                                                       node.Name() + "_fence_before",
+                                                       sync_time_begin,
+                                                       {{"op_name", p_op_kernel->KernelDef().OpName()}});
+      }
 
       kernel_begin_time = session_state.Profiler().StartTime();
     }
 
+    if (!f_profiler_enabled && timing_cache != nullptr) {
+      kernel_begin_time = session_state.Profiler().StartTime();
+    }
+
     // call compute on the kernel
     VLOGS(logger, 1) << "Computing kernel: " << node.Name();
 
@@ -214,6 +271,12 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       break;
     }
 
+    if (timing_cache != nullptr) {
+      timing_cache->Record(NodeTimingCache::MakeNodeKey(node.Name(), node.OpType(), node_index),
+                           NodeTimingCache::MakeShapeKey(op_kernel_context),
+                           TimeDiffMicroSeconds(kernel_begin_time));
+    }
+
     if (f_profiler_enabled) {
       session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
                                                      node.Name() + "_kernel_time",
@@ -256,18 +319,25 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
 
     keep_running = false;
 
-    // Checking which output nodes ready for running.
+    // Checking which output nodes ready for running.  The last producer to
+    // decrement a node's remaining input-edge count owns scheduling it, so no
+    // lock is needed when fan-out from concurrent branches races here.
     {
+      // with a timing profile loaded, continue inline on the most critical ready successor
+      // and queue the others, so this thread keeps walking the critical path
+      const auto& critical_path_costs = session_state.GetNodeCriticalPathCosts();
       auto begin = node.OutputEdgesBegin();
       auto end = node.OutputEdgesEnd();
 
-      std::lock_guard<OrtMutex> lock(ref_mutex_);
       for (auto it = begin; it != end; it++) {
         auto idx = (*it).GetNode().Index();
-        if ((--node_refs_[idx]) == 0) {
+        if (node_refs_[idx].fetch_sub(1, std::memory_order_acq_rel) == 1) {
           if (!keep_running) {
             node_index = idx;
             keep_running = true;
+          } else if (!critical_path_costs.empty() && critical_path_costs[idx] > critical_path_costs[node_index]) {
+            EnqueueNode(node_index, session_state, logger);
+            node_index = idx;
           } else {
             EnqueueNode(idx, session_state, logger);
           }
@@ -284,16 +354,28 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
 }
 
 void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger) {
-  {
-    std::unique_lock<OrtMutex> lock(complete_mutex_);
-    // if there are errors there's no point queuing more work
-    if (!errors_.empty())
-      return;
-
-    out_standings_++;
+  // if there are errors there's no point queuing more work
+  if (have_errors_.load(std::memory_order_relaxed))
+    return;
+
+  out_standings_.fetch_add(1, std::memory_order_relaxed);
+
+  auto& profiler = session_state.Profiler();
+  uint64_t dispatch_flow_id = 0;
+  if (profiler.IsEnabled()) {
+    // Record the handoff to the pool thread as a flow source; RunNodeAsync completes
+    // the flow from the consuming thread so the trace viewer draws an arrow.
+    dispatch_flow_id = profiling::Profiler::NextFlowId();
+    const auto* node = session_state.GetGraphViewer().GetNode(p_node_index);
+    profiler.EndTimeAndRecordEventWithFlow(profiling::NODE_EVENT,
+                                           node->Name() + "_dispatch",
+                                           profiler.StartTime(),
+                                           dispatch_flow_id,
+                                           /*is_flow_source=*/true,
+                                           {{"op_name", node->OpType()}});
   }
 
-  onnxruntime::concurrency::ThreadPool::Schedule(executor_pool_, [this, p_node_index, &session_state, &logger]() {
+  onnxruntime::concurrency::ThreadPool::Schedule(executor_pool_, [this, p_node_index, dispatch_flow_id, &session_state, &logger]() {
     auto create_exception_message = [p_node_index, &session_state](const std::exception* ex) {
       const auto* node = session_state.GetGraphViewer().GetNode(p_node_index);
 
@@ -304,7 +386,8 @@ void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& sess
 
     Status status;
     ORT_TRY {
-      status = ParallelExecutor::RunNodeAsync(p_node_index, std::cref(session_state), std::cref(logger));
+      status = ParallelExecutor::RunNodeAsync(p_node_index, std::cref(session_state), std::cref(logger),
+                                              dispatch_flow_id);
     }
     ORT_CATCH(const std::exception& ex) {
       ORT_HANDLE_EXCEPTION([&]() {
@@ -317,6 +400,7 @@ void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& sess
     }
 
     FinishNodeRun(status);
-  });
+  },
+  session_state.GetInterOpTaskPriority());
 }
 }  // namespace onnxruntime
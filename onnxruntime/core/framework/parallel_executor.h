@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "core/common/common.h"
 #include "core/common/status.h"
@@ -20,7 +21,8 @@ class ExecutionFrame;
 
 class ParallelExecutor : public IExecutor {
  public:
-  ParallelExecutor(const SessionState& session_state, const bool& terminate_flag = false);
+  ParallelExecutor(const SessionState& session_state, const bool& terminate_flag = false,
+                   const OrtRunOptions* run_options = nullptr);
 
   common::Status Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                          const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
@@ -31,35 +33,44 @@ class ParallelExecutor : public IExecutor {
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ParallelExecutor);
 
-  Status RunNodeAsync(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger);
+  // dispatch_flow_id, when non-zero, is the profiler flow id recorded by the thread that
+  // enqueued this node; the first event recorded here completes the flow so the trace
+  // viewer draws an arrow across the thread handoff.
+  Status RunNodeAsync(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger,
+                      uint64_t dispatch_flow_id = 0);
 
   void EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger);
 
   void FinishNodeRun(const Status& status) {
-    bool finished = false;
-    {
-      //Because we have a mutex here, it's not possible another thread is doing the test("while (out_standings_ > 0)"
-      std::lock_guard<OrtMutex> lock(complete_mutex_);
-      finished = --out_standings_ == 0;
-      if (!status.IsOK())
-        errors_.push_back(status);
+    if (!status.IsOK()) {
+      std::lock_guard<OrtMutex> lock(errors_mutex_);
+      errors_.push_back(status);
+      have_errors_.store(true, std::memory_order_relaxed);
     }
 
-    if (finished) {
+    if (out_standings_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
       //std::cout << "all out standing nodes are completed." << std::endl;
+      // Taking the lock before notifying ensures the notification cannot fall
+      // between the waiter's check of out_standings_ and its call to wait().
+      { std::lock_guard<OrtMutex> lock(complete_mutex_); }
       complete_cv_.notify_all();
     }
   }
 
   std::unique_ptr<ExecutionFrame> root_frame_;
-  std::vector<size_t> node_refs_;
-  OrtMutex ref_mutex_;
-  int out_standings_;  //protected by complete_mutex_
+  // Remaining input-edge count per node.  Scheduling a node once its count
+  // reaches zero only needs an atomic decrement, so branch fan-out does not
+  // serialize on a shared scheduling lock.
+  std::unique_ptr<std::atomic<size_t>[]> node_refs_;
+  std::atomic<int> out_standings_;
   OrtMutex complete_mutex_;
   OrtCondVar complete_cv_;
-  std::vector<Status> errors_;
+  std::vector<Status> errors_;  // protected by errors_mutex_
+  OrtMutex errors_mutex_;
+  std::atomic<bool> have_errors_{false};
 
   const bool& terminate_flag_;
+  const OrtRunOptions* run_options_;
   // TODO: Temporary threadpool for the executor.  This is a costly way to handle the problem.
   onnxruntime::concurrency::ThreadPool* const executor_pool_{};
 };
@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/prepacked_weights_container.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#include "core/common/cpuid_info.h"
+#include "core/framework/murmurhash3.h"
+
+namespace onnxruntime {
+
+AllocatorPtr PrepackedWeightsContainer::GetAllocator() {
+  if (!allocator_) {
+    allocator_ = std::make_shared<CPUAllocator>();
+  }
+  return allocator_;
+}
+
+bool PrepackedWeightsContainer::HasWeight(const std::string& key) const {
+  return prepacked_weights_map_.find(key) != prepacked_weights_map_.end();
+}
+
+const PrePackedWeights& PrepackedWeightsContainer::GetWeight(const std::string& key) const {
+  auto it = prepacked_weights_map_.find(key);
+  ORT_ENFORCE(it != prepacked_weights_map_.end(), "No cached pre-packed weight for key: ", key);
+  return it->second;
+}
+
+void PrepackedWeightsContainer::WriteWeight(const std::string& key, PrePackedWeights&& packed_weight) {
+  prepacked_weights_map_.emplace(key, std::move(packed_weight));
+}
+
+std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type, const Tensor& weight) {
+  ORT_ENFORCE(!weight.IsDataTypeString(), "Cannot generate a pre-packed weight key for a string tensor");
+
+  std::ostringstream ss;
+  ss << op_type << '+' << weight.GetElementType();
+  for (auto dim : weight.Shape().GetDims()) {
+    ss << '_' << dim;
+  }
+
+  // hash the raw contents, chaining the hash through the seed for tensors larger than
+  // what a single MurmurHash3 call can consume
+  uint32_t hash[4] = {0, 0, 0, 0};
+  const auto* data = static_cast<const char*>(weight.DataRaw());
+  size_t bytes_remaining = weight.SizeInBytes();
+  while (bytes_remaining > 0) {
+    const int chunk = static_cast<int>(
+        std::min<size_t>(bytes_remaining, static_cast<size_t>(std::numeric_limits<int>::max())));
+    MurmurHash3::x86_128(data, chunk, hash[0], hash);
+    data += chunk;
+    bytes_remaining -= static_cast<size_t>(chunk);
+  }
+
+  ss << '+' << hash[0] << '_' << hash[1] << '_' << hash[2] << '_' << hash[3];
+
+  return ss.str();
+}
+
+std::string GenerateCpuFingerprintForPrepackedWeights() {
+  const auto& cpuid = CPUIDInfo::GetCPUIDInfo();
+
+  // every capability the CPU kernel dispatch selects on, so that a stored buffer is only
+  // reused on a machine that would pick the same packing kernel variant
+  std::ostringstream ss;
+  ss << "ptr" << sizeof(void*) * 8
+     << "+sse3_" << cpuid.HasSSE3()
+     << "+avx_" << cpuid.HasAVX()
+     << "+avx2_" << cpuid.HasAVX2()
+     << "+avx512f_" << cpuid.HasAVX512f()
+     << "+avx512sk_" << cpuid.HasAVX512Skylake()
+     << "+f16c_" << cpuid.HasF16C()
+     << "+sve_" << cpuid.HasArmSVE()
+     << "+sve2_" << cpuid.HasArmSVE2();
+
+  return ss.str();
+}
+
+}  // namespace onnxruntime
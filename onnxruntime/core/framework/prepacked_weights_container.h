@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+#include "core/framework/tensor.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+// Set of buffers (and their sizes) that one kernel produced while pre-packing one constant
+// initialized tensor. Most kernels produce a single buffer, but some pack one weight into
+// multiple buffers (e.g. data and row sums), hence the vectors.
+struct PrePackedWeights final {
+  std::vector<BufferUniquePtr> buffers_;
+  std::vector<size_t> buffer_sizes_;
+};
+
+// Cache of pre-packed weights keyed by op type + initializer contents. One instance is owned
+// by the Environment so that sessions created from the same environment can share a single
+// packed copy of identical weights (opt-in via kOrtSessionOptionsConfigUseEnvPrepackedWeightsCache).
+// Entries are never evicted; the buffers must outlive every session that references them.
+class PrepackedWeightsContainer final {
+ public:
+  PrepackedWeightsContainer() = default;
+
+  // Returns the allocator pre-packed buffers must be allocated with.
+  // It is deliberately not an arena based allocator as the buffers need to outlive
+  // any session (and hence any arena) that writes to or reads from this container.
+  AllocatorPtr GetAllocator();
+
+  bool HasWeight(const std::string& key) const;
+
+  // Returns the cached weight for 'key'. HasWeight(key) must be true.
+  const PrePackedWeights& GetWeight(const std::string& key) const;
+
+  void WriteWeight(const std::string& key, PrePackedWeights&& packed_weight);
+
+  // Read access to all cached weights, for serializing the container's contents.
+  const std::unordered_map<std::string, PrePackedWeights>& GetWeightsMap() const {
+    return prepacked_weights_map_;
+  }
+
+  // Serializes the pre-packing phases of sessions sharing this container so that lookups and
+  // insertions for the same weight cannot interleave. Held by the caller across a whole
+  // SessionState::PrepackConstantInitializedTensors call rather than per method as the
+  // check-then-pack-then-write sequence must be atomic.
+  OrtMutex mutex_;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PrepackedWeightsContainer);
+
+  AllocatorPtr allocator_;
+  std::unordered_map<std::string, PrePackedWeights> prepacked_weights_map_;
+};
+
+// Generates the key used to cache a pre-packed weight: the op type of the kernel doing the
+// packing combined with a hash of the weight's type, shape and contents. Must not be called
+// with a string tensor.
+std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type, const Tensor& weight);
+
+// Fingerprint of the CPU capabilities the packing kernels dispatch on. Pre-packed buffers
+// stored in an ORT format model are only reused when the fingerprint recorded at save time
+// matches the one of the running CPU, as the packed layout differs between kernel variants.
+std::string GenerateCpuFingerprintForPrepackedWeights();
+
+}  // namespace onnxruntime
@@ -483,6 +483,69 @@ struct ProviderHostImpl : ProviderHost {
   void Provider_Node__ToProto(const Provider_Node* p, Provider_NodeProto& proto, bool update_subgraphs = false) override { p->ToProto(proto, update_subgraphs); }
 
   const Provider_NodeAttributes& Provider_Node__GetAttributes(const Provider_Node* p) noexcept override { return p->GetAttributes(); }
+
+  void Provider_Node__GetSnapshot(const Provider_Node* p, Provider_NodeSnapshot& snapshot) override {
+    snapshot.name = p->Name();
+    snapshot.op_type = p->OpType();
+    snapshot.domain = p->Domain();
+    snapshot.index = p->Index();
+    snapshot.input_edges_count = p->GetInputEdgesCount();
+    snapshot.output_edges_count = p->GetOutputEdgesCount();
+
+    auto copy_defs = [](const ConstPointerContainer<std::vector<NodeArg*>>& defs,
+                        std::vector<Provider_NodeSnapshot::Def>& snapshot_defs) {
+      snapshot_defs.clear();
+      snapshot_defs.reserve(defs.size());
+      for (const NodeArg* def : defs) {
+        Provider_NodeSnapshot::Def snapshot_def;
+        snapshot_def.name = def->Name();
+        if (def->Type() != nullptr)
+          snapshot_def.type = *def->Type();
+        snapshot_def.exists = def->Exists();
+        snapshot_defs.push_back(std::move(snapshot_def));
+      }
+    };
+
+    copy_defs(p->InputDefs(), snapshot.input_defs);
+    copy_defs(p->ImplicitInputDefs(), snapshot.implicit_input_defs);
+    copy_defs(p->OutputDefs(), snapshot.output_defs);
+
+    const auto& attributes = p->GetAttributes();
+    snapshot.attributes.clear();
+    snapshot.attributes.reserve(attributes.size());
+    for (const auto& name_to_attribute : attributes) {
+      const auto& attribute = name_to_attribute.second;
+      Provider_NodeSnapshot::Attribute snapshot_attribute;
+      snapshot_attribute.name = name_to_attribute.first;
+      snapshot_attribute.type = attribute.type();
+      switch (attribute.type()) {
+        case ONNX_NAMESPACE::AttributeProto_AttributeType_FLOAT:
+          snapshot_attribute.f = attribute.f();
+          break;
+        case ONNX_NAMESPACE::AttributeProto_AttributeType_INT:
+          snapshot_attribute.i = attribute.i();
+          break;
+        case ONNX_NAMESPACE::AttributeProto_AttributeType_STRING:
+          snapshot_attribute.s = attribute.s();
+          break;
+        case ONNX_NAMESPACE::AttributeProto_AttributeType_FLOATS:
+          snapshot_attribute.floats.assign(attribute.floats().begin(), attribute.floats().end());
+          break;
+        case ONNX_NAMESPACE::AttributeProto_AttributeType_INTS:
+          snapshot_attribute.ints.assign(attribute.ints().begin(), attribute.ints().end());
+          break;
+        case ONNX_NAMESPACE::AttributeProto_AttributeType_STRINGS:
+          snapshot_attribute.strings.assign(attribute.strings().begin(), attribute.strings().end());
+          break;
+        default:
+          // Tensor and graph attribute values are not copied, they stay
+          // accessible through Provider_Node__GetAttributes
+          break;
+      }
+      snapshot.attributes.push_back(std::move(snapshot_attribute));
+    }
+  }
+
   size_t Provider_Node__GetInputEdgesCount(const Provider_Node* p) noexcept override { return p->GetInputEdgesCount(); }
   size_t Provider_Node__GetOutputEdgesCount(const Provider_Node* p) noexcept override { return p->GetOutputEdgesCount(); }
 
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/run_capture.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "core/common/make_unique.h"
+#include "core/framework/allocator.h"
+#include "core/framework/data_types.h"
+#include "core/framework/tensor.h"
+#include "core/graph/onnx_protobuf.h"
+
+namespace onnxruntime {
+namespace run_capture {
+
+namespace {
+
+constexpr char kMagic[8] = {'O', 'R', 'T', 'R', 'U', 'N', 'C', '1'};
+
+template <typename T>
+void WritePod(std::ofstream& file, T value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool ReadPod(std::ifstream& file, T& value) {
+  file.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return static_cast<bool>(file);
+}
+
+}  // namespace
+
+common::Status Save(const std::string& path, const std::vector<std::string>& feed_names,
+                    const std::vector<OrtValue>& feeds, int64_t random_seed) {
+  ORT_RETURN_IF_NOT(feed_names.size() == feeds.size(), "Mismatching feed name and value counts.");
+
+  // serialize everything first so a rejected feed never leaves a truncated file behind
+  std::vector<std::string> serialized_feeds;
+  serialized_feeds.reserve(feeds.size());
+  for (size_t i = 0; i < feeds.size(); ++i) {
+    ORT_RETURN_IF_NOT(feeds[i].IsTensor(), "Feed '", feed_names[i], "' is not a tensor.");
+    const Tensor& tensor = feeds[i].Get<Tensor>();
+    ORT_RETURN_IF_NOT(tensor.Location().device.Type() == OrtDevice::CPU,
+                      "Feed '", feed_names[i], "' is not in CPU memory.");
+    const auto* element_type = tensor.DataType()->AsPrimitiveDataType();
+    ORT_RETURN_IF_NOT(element_type != nullptr && !tensor.IsDataTypeString(),
+                      "Feed '", feed_names[i], "' has an unsupported element type.");
+
+    ONNX_NAMESPACE::TensorProto proto;
+    proto.set_name(feed_names[i]);
+    proto.set_data_type(element_type->GetDataType());
+    for (int64_t dim : tensor.Shape().GetDims()) {
+      proto.add_dims(dim);
+    }
+    proto.set_raw_data(tensor.DataRaw(), tensor.SizeInBytes());
+
+    serialized_feeds.emplace_back();
+    ORT_RETURN_IF_NOT(proto.SerializeToString(&serialized_feeds.back()),
+                      "Failed to serialize feed '", feed_names[i], "'.");
+  }
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  ORT_RETURN_IF_NOT(file, "Failed to open run capture file for writing: ", path);
+
+  file.write(kMagic, sizeof(kMagic));
+  WritePod(file, random_seed);
+  WritePod(file, static_cast<uint32_t>(serialized_feeds.size()));
+  for (const std::string& serialized : serialized_feeds) {
+    WritePod(file, static_cast<uint32_t>(serialized.size()));
+    file.write(serialized.data(), static_cast<std::streamsize>(serialized.size()));
+  }
+
+  ORT_RETURN_IF_NOT(file, "Failed to write run capture file: ", path);
+  return Status::OK();
+}
+
+common::Status Load(const std::string& path, std::vector<std::string>& feed_names,
+                    std::vector<OrtValue>& feeds, int64_t& random_seed) {
+  std::ifstream file(path, std::ios::binary);
+  ORT_RETURN_IF_NOT(file, "Failed to open run capture file: ", path);
+
+  char magic[sizeof(kMagic)];
+  file.read(magic, sizeof(magic));
+  ORT_RETURN_IF_NOT(file && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0,
+                    "Not a run capture file: ", path);
+
+  uint32_t num_feeds = 0;
+  ORT_RETURN_IF_NOT(ReadPod(file, random_seed) && ReadPod(file, num_feeds),
+                    "Truncated run capture file: ", path);
+
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  feed_names.clear();
+  feeds.clear();
+  for (uint32_t i = 0; i < num_feeds; ++i) {
+    uint32_t proto_size = 0;
+    ORT_RETURN_IF_NOT(ReadPod(file, proto_size), "Truncated run capture file: ", path);
+    std::string serialized(proto_size, '\0');
+    file.read(&serialized[0], static_cast<std::streamsize>(proto_size));
+    ORT_RETURN_IF_NOT(file, "Truncated run capture file: ", path);
+
+    ONNX_NAMESPACE::TensorProto proto;
+    ORT_RETURN_IF_NOT(proto.ParseFromString(serialized), "Invalid feed entry in run capture file: ", path);
+
+    ORT_RETURN_IF_NOT(ONNX_NAMESPACE::TensorProto_DataType_IsValid(proto.data_type()) &&
+                          proto.data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING,
+                      "Unsupported element type in run capture file: ", path);
+    const auto* tensor_type = DataTypeImpl::TensorTypeFromONNXEnum(proto.data_type());
+
+    std::vector<int64_t> dims(proto.dims().begin(), proto.dims().end());
+    auto tensor = onnxruntime::make_unique<Tensor>(tensor_type->GetElementType(), TensorShape(dims), allocator);
+    ORT_RETURN_IF_NOT(proto.raw_data().size() == tensor->SizeInBytes(),
+                      "Feed '", proto.name(), "' in run capture file has ", proto.raw_data().size(),
+                      " bytes of data but its shape needs ", tensor->SizeInBytes(), ".");
+    memcpy(tensor->MutableDataRaw(), proto.raw_data().data(), proto.raw_data().size());
+
+    OrtValue value;
+    value.Init(tensor.release(), DataTypeImpl::GetType<Tensor>(), DataTypeImpl::GetType<Tensor>()->GetDeleteFunc());
+    feed_names.push_back(proto.name());
+    feeds.push_back(std::move(value));
+  }
+
+  return Status::OK();
+}
+
+}  // namespace run_capture
+}  // namespace onnxruntime
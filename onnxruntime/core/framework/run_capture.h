@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/status.h"
+#include "core/framework/ml_value.h"
+
+namespace onnxruntime {
+namespace run_capture {
+
+/**
+Binary capture of one Run's exact inputs for deterministic offline replay.
+
+A capture is produced by setting OrtRunOptions::run_capture_path_prefix and can be
+re-executed with 'onnxruntime_perf_test -R <capture_file>', turning a sampled
+production Run into a local benchmark.
+
+File layout (native endianness, not portable across architectures):
+
+  char[8]  magic "ORTRUNC1"
+  int64    process random seed at the time of the run (utils::GetRandomSeed)
+  uint32   number of feeds
+  per feed:
+    uint32  size of the serialized TensorProto that follows
+    bytes   TensorProto carrying name, data type, dims and raw_data
+
+The replayer in test/perftest parses this layout directly (it cannot link against
+this translation unit in shared-library builds), so the layout must stay in sync
+with test/perftest/replay.cc.
+*/
+
+// Write the feeds and seed to 'path'. Every feed must be a CPU tensor of a
+// non-string primitive type; anything else fails without writing the file.
+common::Status Save(const std::string& path, const std::vector<std::string>& feed_names,
+                    const std::vector<OrtValue>& feeds, int64_t random_seed);
+
+// Read a capture back into CPU tensors, for in-process replay or inspection.
+common::Status Load(const std::string& path, std::vector<std::string>& feed_names,
+                    std::vector<OrtValue>& feeds, int64_t& random_seed);
+
+}  // namespace run_capture
+}  // namespace onnxruntime
@@ -53,3 +53,36 @@ ORT_API_STATUS_IMPL(OrtApis::RunOptionsUnsetTerminate, _Inout_ OrtRunOptions* op
   options->terminate = false;
   return nullptr;
 }
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetRunMemoryBudget, _Inout_ OrtRunOptions* options, size_t budget_bytes) {
+  options->run_memory_budget_bytes = budget_bytes;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetIntraOpThreadLimit, _Inout_ OrtRunOptions* options, int thread_limit) {
+  if (thread_limit < 0) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "thread_limit must be non-negative");
+  }
+  options->intra_op_thread_limit = thread_limit;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetSequenceId, _Inout_ OrtRunOptions* options,
+                    _In_opt_ const char* sequence_id, size_t max_length) {
+  options->run_sequence_id = sequence_id != nullptr ? sequence_id : "";
+  options->run_sequence_max_length = static_cast<int>(max_length);
+  options->run_sequence_reset = false;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsResetSequence, _Inout_ OrtRunOptions* options) {
+  options->run_sequence_reset = true;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsEnableRunCapture, _Inout_ OrtRunOptions* options,
+                    _In_opt_ const char* path_prefix, size_t sample_ratio) {
+  options->run_capture_path_prefix = path_prefix != nullptr ? path_prefix : "";
+  options->run_capture_sample_ratio = sample_ratio > 1 ? static_cast<int>(sample_ratio) : 1;
+  return nullptr;
+}
@@ -133,4 +133,11 @@ struct SequentialExecutionPlan : public ExecutionPlanBase {
 
 // Output details of an execution plan:
 std::ostream& operator<<(std::ostream& out, std::pair<const SequentialExecutionPlan*, const SessionState*> planinfo);
+
+// Write the allocation and execution plan as JSON: per-value allocation kind, buffer
+// reuse decisions, lifetime intervals and the node execution order. The output can be
+// rendered with tools/python/visualize_allocation_plan.py to verify a model change
+// didn't regress buffer reuse. See kOrtSessionOptionsConfigAllocationPlanDumpPath.
+void DumpAllocationPlanAsJson(const SequentialExecutionPlan& plan, const SessionState& session_state,
+                              std::ostream& out);
 }  // namespace onnxruntime
@@ -9,11 +9,17 @@
 #include <sstream>
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
+#include "core/framework/allocation_audit.h"
 #include "core/framework/allocation_planner.h"
+#include "core/framework/bfc_arena.h"
+#include "core/framework/calibration_collector.h"
 #include "core/framework/execution_frame.h"
+#include "core/framework/node_clustering.h"
+#include "core/framework/node_timing_cache.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
+#include "core/platform/threadpool.h"
 
 #if defined DEBUG_NODE_INPUTS_OUTPUTS
 #include "core/framework/debug_node_inputs_outputs_utils.h"
@@ -122,15 +128,162 @@ static Status ReleaseNodeMLValues(ExecutionFrame& frame,
                                   const SequentialExecutionPlan::NodeExecutionPlan& node_exec_plan,
                                   const logging::Logger& logger);
 
+// Feed the tensors a node just produced into the calibration collector. Only float tensors
+// on CPU participate; statistics are keyed by the output's name in the graph so they line
+// up with the tensor names a quantization tool works with.
+static void CollectCalibrationStats(CalibrationCollector& collector,
+                                    OpKernelContextInternal& op_kernel_context,
+                                    const onnxruntime::Node& node) {
+  const auto& output_defs = node.OutputDefs();
+  const int output_count = op_kernel_context.OutputCount();
+
+  for (int i = 0; i < output_count; ++i) {
+    const OrtValue* value = op_kernel_context.GetOutputMLValue(i);
+    if (value == nullptr || !value->IsAllocated() || !value->IsTensor()) {
+      continue;
+    }
+
+    const auto& tensor = value->Get<Tensor>();
+    if (tensor.Location().device.Type() != OrtDevice::CPU) {
+      continue;
+    }
+
+    collector.Collect(output_defs[static_cast<size_t>(i)]->Name(), tensor);
+  }
+}
+
+// Runs the execution-plan steps [cluster_begin, cluster_end) as sibling tasks in one
+// parallel region on the intra-op pool. The planner guarantees the members are mutually
+// independent CPU kernels with no fences and no aliasing through the allocation plan, so
+// they can share the execution frame the same way concurrently executing nodes do under
+// the parallel executor. Value frees run after the join, in plan order.
+static Status ExecuteNodeCluster(const SessionState& session_state, ExecutionFrame& frame,
+                                 const SequentialExecutionPlan& seq_exec_plan,
+                                 size_t cluster_begin, size_t cluster_end,
+                                 const bool& terminate_flag, const OrtRunOptions* run_options,
+                                 const logging::Logger& logger) {
+  const auto& exec_plan_vec = seq_exec_plan.execution_plan;
+  const auto& graph_viewer = session_state.GetGraphViewer();
+
+  const std::ptrdiff_t num_nodes = cluster_end - cluster_begin;
+  std::vector<Status> statuses(num_nodes);
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      session_state.GetThreadPool(), num_nodes, [&](std::ptrdiff_t i) {
+        const auto& node_exec_plan = exec_plan_vec[cluster_begin + i];
+        const auto node_index = node_exec_plan.node_index;
+        auto p_op_kernel = session_state.GetKernel(node_index);
+        if (p_op_kernel == nullptr) {
+          statuses[i] = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Got nullptr from GetKernel for node: ",
+                                        graph_viewer.GetNode(node_index)->Name());
+          return;
+        }
+
+        OpKernelContextInternal op_kernel_context(session_state, frame, *p_op_kernel, logger,
+                                                  terminate_flag, &node_exec_plan, run_options);
+
+        // The siblings provide the parallelism for this region; cap the kernel's own loops
+        // at one thread so it cannot open a nested region on the pool it is running on.
+        concurrency::ThreadPool::DegreeOfParallelismLimit dop_limit(1);
+
+        ORT_TRY {
+          statuses[i] = p_op_kernel->Compute(&op_kernel_context);
+        }
+        ORT_CATCH(const std::exception& ex) {
+          ORT_HANDLE_EXCEPTION([&]() {
+            statuses[i] = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+          });
+        }
+      });
+
+  for (std::ptrdiff_t i = 0; i < num_nodes; ++i) {
+    if (!statuses[i].IsOK()) {
+      const Node& node = *graph_viewer.GetNode(exec_plan_vec[cluster_begin + i].node_index);
+      std::ostringstream ss;
+      ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
+         << "' Status Message: " << statuses[i].ErrorMessage();
+      const auto msg_string = ss.str();
+      LOGS(logger, ERROR) << msg_string;
+      return Status(statuses[i].Category(), statuses[i].Code(), msg_string);
+    }
+  }
+
+  for (size_t step = cluster_begin; step < cluster_end; ++step) {
+    VLOGS(logger, 1) << "Releasing node ML values.";
+    ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, exec_plan_vec[step], logger));
+  }
+
+  return Status::OK();
+}
+
+// Slimmed dispatch loop for graphs that qualified at session initialization (single execution
+// provider, no fences, no subgraphs; see SessionState::IsLeanExecutionEligible) when no per-Run
+// instrumentation is active. Per-node overhead matters for large graphs of cheap kernels, so
+// this loop does only kernel dispatch and value release. The OpKernelContext still has to be
+// built per node as it binds the node's values in this Run's frame, but with no implicit inputs
+// its construction does not allocate.
+static Status ExecuteLean(const SessionState& session_state, ExecutionFrame& frame,
+                          const SequentialExecutionPlan& seq_exec_plan,
+                          const bool& terminate_flag, const OrtRunOptions* run_options,
+                          const logging::Logger& logger) {
+  const auto& exec_plan_vec = seq_exec_plan.execution_plan;
+
+  for (size_t program_counter = 0; program_counter < exec_plan_vec.size(); ++program_counter) {
+    const auto& node_exec_plan = exec_plan_vec[program_counter];
+    if (terminate_flag) {
+      LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
+    }
+
+    const auto node_index = node_exec_plan.node_index;
+    auto p_op_kernel = session_state.GetKernel(node_index);
+
+    // if a kernel has been added in the session state, it better be NON-null.
+    if (p_op_kernel == nullptr)
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Got nullptr from GetKernel for node: ",
+                             session_state.GetGraphViewer().GetNode(node_index)->Name());
+
+    OpKernelContextInternal op_kernel_context(session_state, frame, *p_op_kernel, logger, terminate_flag,
+                                              &node_exec_plan, run_options);
+
+    Status compute_status;
+    ORT_TRY {
+      compute_status = p_op_kernel->Compute(&op_kernel_context);
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        compute_status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+      });
+    }
+
+    if (!compute_status.IsOK()) {
+      const Node& node = p_op_kernel->Node();
+      std::ostringstream ss;
+      ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
+         << "' Status Message: " << compute_status.ErrorMessage();
+      const auto msg_string = ss.str();
+      LOGS(logger, ERROR) << msg_string;
+      return Status(compute_status.Category(), compute_status.Code(), msg_string);
+    }
+
+    ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan, logger));
+  }
+
+  return Status::OK();
+}
+
 Status SequentialExecutor::Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                                    const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
                                    std::vector<OrtValue>& fetches,
                                    const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                                    const logging::Logger& logger) {
   const bool is_profiler_enabled = session_state.Profiler().IsEnabled();
+  NodeTimingCache* const timing_cache = session_state.GetNodeTimingCache();
+  CalibrationCollector* const calibration_collector = session_state.GetCalibrationCollector();
   TimePoint tp;
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time;
+  concurrency::ThreadPoolStats tp_stats_before;
   size_t input_activation_sizes = 0;
   size_t input_parameter_sizes = 0;
   size_t total_output_sizes = 0;
@@ -166,6 +319,28 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 
   const auto& graph_viewer = session_state.GetGraphViewer();
 
+  // The offload schedule indexes into the full execution plan, so it cannot be applied when
+  // nodes are being skipped.
+  const ActivationOffloadPlan* offload_plan =
+      only_execute_path_to_fetches ? nullptr : session_state.GetActivationOffloadPlan();
+
+  // Clusters of independent lightweight nodes run as sibling tasks in one parallel region.
+  // The cluster path skips the per-node profiling machinery, so it is only taken when
+  // profiling is off, and it is not combined with the offload schedule, whose copies assume
+  // the steps around them run one at a time. A frame placed on a cached memory pattern is
+  // also excluded: the pattern's offsets come from sequential plan-order lifetimes, so a
+  // member's planned output can occupy the same bytes as a sibling's input that the plan
+  // frees mid-cluster, and running the members concurrently would race on that buffer.
+#if defined DEBUG_NODE_INPUTS_OUTPUTS
+  const NodeClusterPlan* cluster_plan = nullptr;
+#else
+  const NodeClusterPlan* cluster_plan =
+      (only_execute_path_to_fetches || is_profiler_enabled || offload_plan != nullptr ||
+       frame.IsMemPatternBased())
+          ? nullptr
+          : session_state.GetNodeClusterPlan();
+#endif
+
 #ifdef CONCURRENCY_VISUALIZER
   // need unique name for the series. number of nodes should be good enough for a subgraph
   char series_name[MaxSeriesNameLengthInChars] = "MainGraph";
@@ -188,12 +363,49 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       profile::Color::Black);
 #endif
 
-  for (const auto& node_exec_plan : exec_plan_vec) {
+  // Take the slimmed dispatch loop when the session qualified at initialization and nothing in
+  // this Run needs the per-node instrumentation of the full loop below, which is skipped entirely
+  // in that case. DEBUG_NODE_INPUTS_OUTPUTS dumping lives in the full loop only.
+#if defined(DEBUG_NODE_INPUTS_OUTPUTS)
+  const bool use_lean_loop = false;
+#else
+  const bool use_lean_loop = session_state.IsLeanExecutionEligible() &&
+                             !is_profiler_enabled && timing_cache == nullptr &&
+                             calibration_collector == nullptr &&
+                             !only_execute_path_to_fetches &&
+                             offload_plan == nullptr && cluster_plan == nullptr &&
+                             !AllocationAudit::IsEnabled();
+#endif
+  if (use_lean_loop) {
+    ORT_RETURN_IF_ERROR(ExecuteLean(session_state, frame, seq_exec_plan, terminate_flag_, run_options_, logger));
+  }
+
+  const size_t num_plan_steps = use_lean_loop ? 0 : exec_plan_vec.size();
+  for (size_t program_counter = 0; program_counter < num_plan_steps; ++program_counter) {
+    const auto& node_exec_plan = exec_plan_vec[program_counter];
     if (terminate_flag_) {
       LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
       return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
     }
 
+    if (cluster_plan != nullptr) {
+      const size_t cluster_end = cluster_plan->cluster_end_at_step[program_counter];
+      if (cluster_end != 0) {
+        ORT_RETURN_IF_ERROR(ExecuteNodeCluster(session_state, frame, seq_exec_plan,
+                                               program_counter, cluster_end, terminate_flag_, run_options_, logger));
+        // the loop increment moves execution past the last member of the cluster
+        program_counter = cluster_end - 1;
+        continue;
+      }
+    }
+
+    if (offload_plan != nullptr) {
+      // copy back any offloaded values that this or an upcoming step consumes
+      for (auto ort_value_idx : offload_plan->reloads_per_step[program_counter]) {
+        ORT_RETURN_IF_ERROR(frame.ReloadMLValue(ort_value_idx));
+      }
+    }
+
     auto node_index = node_exec_plan.node_index;
 
     // If it is not necessary to execute the node.
@@ -232,7 +444,10 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 #endif
     // construct OpKernelContext
     // TODO: log kernel inputs?
-    OpKernelContextInternal op_kernel_context(session_state, frame, *p_op_kernel, logger, terminate_flag_);
+    // pass the node's entry in the execution plan so kernels that declare inputs as
+    // consumed-after-read can release them incrementally during Compute
+    OpKernelContextInternal op_kernel_context(session_state, frame, *p_op_kernel, logger, terminate_flag_,
+                                              &node_exec_plan, run_options_);
     // TODO: log kernel outputs?
     if (is_profiler_enabled) {
       sync_time_begin = session_state.Profiler().StartTime();
@@ -274,11 +489,25 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     utils::DumpNodeInputs(op_kernel_context, p_op_kernel->Node(), session_state);
 #endif
 
-    const std::string node_name_for_profiling = [&]() -> std::string {
-      if (!is_profiler_enabled) return {};
-      // Derive something meaningful for profile traces and logs if node name field is blank in execution graph
-      return node.Name().empty() ? MakeString(node.OpType(), "_", node_index) : node.Name();
-    }();
+    // Pre-built at session state finalization (with a fallback derived from the op type when the
+    // model leaves the node name blank) so the per-node path constructs no strings.
+    const std::string& node_name_for_profiling = session_state.GetNodeNameForProfiling(node_index);
+
+    // Tag arena allocations made while this node runs, so the dump emitted when an
+    // allocation fails can attribute in-use chunks to nodes.
+    BFCArena::ScopedAllocationTag allocation_tag(node_name_for_profiling);
+
+    // The arena the kernel allocates from, for the per-node memory columns of the
+    // kernel profile event. Null when the provider's default allocator is not an arena.
+    IArenaAllocator* arena = nullptr;
+    AllocatorPtr arena_holder;
+    AllocatorStats arena_stats_before;
+    if (is_profiler_enabled) {
+      arena_holder = p_op_kernel->Info().GetAllocator(0, OrtMemTypeDefault);
+      if (arena_holder && arena_holder->Info().alloc_type == OrtArenaAllocator) {
+        arena = static_cast<IArenaAllocator*>(arena_holder.get());
+      }
+    }
 
     if (is_profiler_enabled) {
       session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
@@ -294,8 +523,25 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       // Calculate total input sizes for this operation.
       CalculateTotalInputSizes(&op_kernel_context, p_op_kernel,
                                input_activation_sizes, input_parameter_sizes, node_name_for_profiling);
+
+      // Snapshot the intra-op pool counters so the kernel event can report how
+      // the kernel used the pool (see the delta computation below).
+      concurrency::ThreadPool::GetStats(session_state.GetThreadPool(), tp_stats_before);
+
+      if (arena != nullptr) {
+        arena->GetStats(&arena_stats_before);
+      }
+    }
+
+    if (!is_profiler_enabled && timing_cache != nullptr) {
+      kernel_begin_time = session_state.Profiler().StartTime();
     }
 
+    // When the allocation audit is on, attribute allocator-seam allocations to the node whose
+    // kernel triggered them so a failing allocation-free assertion names the kernel to fix.
+    const bool audit_allocations = AllocationAudit::IsEnabled();
+    const uint64_t audit_allocs_before = audit_allocations ? AllocationAudit::AllocationCount() : 0;
+
     Status compute_status;
     {
 #ifdef CONCURRENCY_VISUALIZER
@@ -325,6 +571,14 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 #endif
     }
 
+    if (audit_allocations) {
+      const uint64_t audit_allocs = AllocationAudit::AllocationCount() - audit_allocs_before;
+      if (audit_allocs > 0) {
+        LOGS(logger, INFO) << "[AllocationAudit] " << node_name_for_profiling << " (" << node.OpType() << ") made "
+                           << audit_allocs << " allocation(s) through the CPU allocator seam";
+      }
+    }
+
     if (!compute_status.IsOK()) {
       std::ostringstream ss;
       ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
@@ -334,6 +588,16 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       return Status(compute_status.Category(), compute_status.Code(), msg_string);
     }
 
+    if (calibration_collector != nullptr) {
+      CollectCalibrationStats(*calibration_collector, op_kernel_context, node);
+    }
+
+    if (timing_cache != nullptr) {
+      timing_cache->Record(NodeTimingCache::MakeNodeKey(node.Name(), node.OpType(), node_index),
+                           NodeTimingCache::MakeShapeKey(op_kernel_context),
+                           TimeDiffMicroSeconds(kernel_begin_time));
+    }
+
     if (is_profiler_enabled) {
       // Calculate total output sizes for this operation.
       CalculateTotalOutputSizes(&op_kernel_context, total_output_sizes, node_name_for_profiling);
@@ -351,6 +615,24 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                 << "\n";
 #endif
 
+      // Report how the kernel used the intra-op pool: the number of parallel
+      // regions it dispatched, the average degree of parallelism it asked for
+      // (an average below the pool size identifies regions that underfill the
+      // pool), and how much work moved between workers or left them idle.
+      concurrency::ThreadPoolStats tp_stats_after;
+      concurrency::ThreadPool::GetStats(session_state.GetThreadPool(), tp_stats_after);
+      const uint64_t regions = tp_stats_after.num_parallel_regions - tp_stats_before.num_parallel_regions;
+      const uint64_t degree_sum = tp_stats_after.region_degree_sum - tp_stats_before.region_degree_sum;
+
+      // Sample the arena again so the event shows where the run's memory high-water
+      // mark stands after this node, and how much this node raised it. The node with
+      // a non-zero arena_peak_bytes_delta is the one pushing the peak. All three
+      // columns read 0 when the provider's default allocator is not an arena.
+      AllocatorStats arena_stats_after;
+      if (arena != nullptr) {
+        arena->GetStats(&arena_stats_after);
+      }
+
       session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
                                                      node_name_for_profiling + "_kernel_time",
                                                      kernel_begin_time,
@@ -363,6 +645,29 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                                          {"activation_size", std::to_string(input_activation_sizes)},
                                                          {"parameter_size", std::to_string(input_parameter_sizes)},
                                                          {"output_size", std::to_string(total_output_sizes)},
+                                                         {"thread_pool_size", std::to_string(tp_stats_after.num_threads)},
+                                                         {"parallel_regions", std::to_string(regions)},
+                                                         {"avg_region_degree",
+                                                          std::to_string(regions == 0 ? 0 : degree_sum / regions)},
+                                                         {"tasks_executed",
+                                                          std::to_string(tp_stats_after.num_tasks_executed -
+                                                                         tp_stats_before.num_tasks_executed)},
+                                                         {"tasks_stolen",
+                                                          std::to_string(tp_stats_after.num_tasks_stolen -
+                                                                         tp_stats_before.num_tasks_stolen)},
+                                                         {"worker_parks",
+                                                          std::to_string(tp_stats_after.num_parks -
+                                                                         tp_stats_before.num_parks)},
+                                                         {"worker_parked_us",
+                                                          std::to_string(tp_stats_after.parked_time_us -
+                                                                         tp_stats_before.parked_time_us)},
+                                                         {"arena_bytes_in_use",
+                                                          std::to_string(arena_stats_after.bytes_in_use)},
+                                                         {"arena_peak_bytes",
+                                                          std::to_string(arena_stats_after.max_bytes_in_use)},
+                                                         {"arena_peak_bytes_delta",
+                                                          std::to_string(arena_stats_after.max_bytes_in_use -
+                                                                         arena_stats_before.max_bytes_in_use)},
                                                      });
 
       sync_time_begin = session_state.Profiler().StartTime();
@@ -418,6 +723,13 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     // free ml-values corresponding to this node
     VLOGS(logger, 1) << "Releasing node ML values.";
     ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan, logger));
+
+    if (offload_plan != nullptr) {
+      // copy values whose next use is far away out to CPU and release their device buffers
+      for (auto ort_value_idx : offload_plan->offloads_per_step[program_counter]) {
+        ORT_RETURN_IF_ERROR(frame.OffloadMLValue(ort_value_idx));
+      }
+    }
   }
 
 #ifdef ENABLE_NVTX_PROFILE
@@ -9,9 +9,12 @@
 #include "core/common/safeint.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/framework/allocator.h"
+#include "core/framework/mem_pattern.h"
+#include "core/framework/mldata_type_utils.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/prepacked_weights_container.h"
 #include "core/framework/session_state_utils.h"
 #include "core/framework/utils.h"
 #include "core/providers/cpu/controlflow/utils.h"
@@ -120,6 +123,71 @@ void SessionState::CreateGraphInfo() {
   }
 
   LOGS(logger_, VERBOSE) << "Done saving OrtValue mappings.";
+
+  // pre-build the per-node names used in profile events, verbose logs and allocation tags so
+  // executing a node never has to construct one
+  node_names_for_profiling_.resize(graph_.MaxNodeIndex());
+  for (const auto& node : graph_viewer_->Nodes()) {
+    node_names_for_profiling_[node.Index()] =
+        node.Name().empty() ? MakeString(node.OpType(), "_", node.Index()) : node.Name();
+  }
+}
+
+std::unique_ptr<SessionState::PooledKernelState> SessionState::CheckOutKernelState(
+    NodeIndex node_index, const PooledKernelStateFactory& factory) const {
+  {
+    std::lock_guard<OrtMutex> lock(pooled_kernel_states_lock_);
+    auto it = pooled_kernel_states_.find(node_index);
+    if (it != pooled_kernel_states_.end() && !it->second.empty()) {
+      auto state = std::move(it->second.back());
+      it->second.pop_back();
+      return state;
+    }
+  }
+
+  // create outside the lock; concurrent first uses each build their own instance
+  return factory();
+}
+
+void SessionState::ReturnKernelState(NodeIndex node_index, std::unique_ptr<PooledKernelState> state) const {
+  if (state == nullptr) {
+    return;
+  }
+
+  std::lock_guard<OrtMutex> lock(pooled_kernel_states_lock_);
+  pooled_kernel_states_[node_index].push_back(std::move(state));
+}
+
+std::vector<OrtValue> SessionState::CheckOutFrameValuesStorage() const {
+  std::lock_guard<OrtMutex> lock(frame_values_pool_lock_);
+  if (!frame_values_pool_.empty()) {
+    auto storage = std::move(frame_values_pool_.back());
+    frame_values_pool_.pop_back();
+    return storage;
+  }
+
+  // first use, or every entry is checked out by a concurrent frame
+  return {};
+}
+
+void SessionState::ReturnFrameValuesStorage(std::vector<OrtValue>&& storage) const {
+  if (storage.capacity() == 0) {
+    return;
+  }
+
+  ORT_ENFORCE(storage.empty(), "Returned frame values storage must be cleared.");
+
+  std::lock_guard<OrtMutex> lock(frame_values_pool_lock_);
+  frame_values_pool_.push_back(std::move(storage));
+}
+
+const std::string& SessionState::GetNodeNameForProfiling(NodeIndex node_index) const {
+  static const std::string unknown{"unknown"};
+  if (node_index >= node_names_for_profiling_.size() || node_names_for_profiling_[node_index].empty()) {
+    return unknown;
+  }
+
+  return node_names_for_profiling_[node_index];
 }
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -252,6 +320,13 @@ void SessionState::CleanInitializedTensorsFromGraph() {
 }
 
 Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count) {
+  // serialize the pre-packing phases of the sessions sharing the container so that the
+  // lookup + pack + write sequence for each weight is atomic
+  std::unique_lock<OrtMutex> lock;
+  if (prepacked_weights_container_ != nullptr) {
+    lock = std::unique_lock<OrtMutex>(prepacked_weights_container_->mutex_);
+  }
+
   for (auto& node : GetGraphViewer().Nodes()) {
     auto kernel = GetMutableKernel(node.Index());
     int input_idx = 0;
@@ -268,7 +343,38 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
             if (constant_initialized_tensors.count(ort_value_idx)) {
               bool is_packed = false;
               const Tensor& const_initialized_tensor = constant_initialized_tensors[ort_value_idx].Get<Tensor>();
-              ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, is_packed));
+
+              if (prepacked_weights_container_ != nullptr && !const_initialized_tensor.IsDataTypeString()) {
+                const std::string key =
+                    GenerateKeyForPrepackedWeightsMap(node.OpType(), const_initialized_tensor);
+
+                if (prepacked_weights_container_->HasWeight(key)) {
+                  // hand the kernel non-owning references - the shared copies stay owned by the container
+                  const auto& cached_weight = prepacked_weights_container_->GetWeight(key);
+                  std::vector<BufferUniquePtr> shared_buffers;
+                  shared_buffers.reserve(cached_weight.buffers_.size());
+                  for (const auto& buffer : cached_weight.buffers_) {
+                    shared_buffers.emplace_back(buffer.get(), BufferDeleter(nullptr));
+                  }
+                  ORT_RETURN_IF_ERROR(kernel->UseSharedPrePackedBuffers(shared_buffers, input_idx,
+                                                                        const_initialized_tensor, is_packed));
+                }
+
+                if (!is_packed) {
+                  PrePackedWeights weights_for_container;
+                  ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx,
+                                                      prepacked_weights_container_->GetAllocator(),
+                                                      is_packed, &weights_for_container));
+                  // kernels that pack but do not support sharing leave 'weights_for_container' empty
+                  // and keep their privately packed copy
+                  if (is_packed && !weights_for_container.buffers_.empty()) {
+                    prepacked_weights_container_->WriteWeight(key, std::move(weights_for_container));
+                  }
+                }
+              } else {
+                ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, is_packed));
+              }
+
               if (is_packed && constant_initializers_use_count.count(input_name) && --constant_initializers_use_count[input_name] == 0) {
                 // release the constant initialized tensor
                 st->initialized_tensors_.erase(ort_value_idx);
@@ -300,7 +406,6 @@ static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapp
   return key;
 }
 
-#ifdef ENABLE_TRAINING
 namespace {
 Status ResolveDimParams(const GraphViewer& graph,
                         const std::map<std::string, TensorShape>& feeds,
@@ -396,7 +501,13 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
   ORT_RETURN_IF_ERROR(ResolveDimParams(*graph_viewer_, feeds, map));
   auto* exe_plan = GetExecutionPlan();
   ORT_ENFORCE(exe_plan);
+#ifdef ENABLE_TRAINING
   OrtValuePatternPlanner mem_planner(*exe_plan, /*using counters*/ true);
+#else
+  // Inference execution plans don't track program counters, so planned buffers are only re-used
+  // once the plan says the value is freed.
+  OrtValuePatternPlanner mem_planner(*exe_plan);
+#endif
 
   // Try to resolve shapes for activations.
   auto& node_index_info = GetNodeIndexInfo();
@@ -428,6 +539,7 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
     }
   }
 
+#ifdef ENABLE_TRAINING
   // Allocate activations that want to be laid out contiguously in memory.
   for (auto ml_value_idx : exe_plan->activation_allocation_order) {
     ORT_ENFORCE(ml_value_idx >= 0);
@@ -456,6 +568,7 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
       mem_planner.TraceAllocation(ml_value_idx, counter, size);
     }
   }
+#endif
 
   // Allocate all other activations.
   for (auto& node_plan : exe_plan->execution_plan) {
@@ -488,8 +601,12 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
 
         ORT_ENFORCE(exe_plan->allocation_plan[ml_value_idx].alloc_kind == AllocKind::kAllocate);
 
+#ifdef ENABLE_TRAINING
         const auto& counter = exe_plan->allocation_plan[ml_value_idx].program_counter;
         mem_planner.TraceAllocation(ml_value_idx, counter, aligned_size);
+#else
+        ORT_RETURN_IF_ERROR(mem_planner.TraceAllocation(ml_value_idx, aligned_size));
+#endif
       }
     }
 
@@ -511,7 +628,6 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
   }
   return Status::OK();
 }
-#endif
 
 const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
                                                               const std::vector<int>& feed_mlvalue_idxs,
@@ -521,7 +637,11 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
   auto it = mem_patterns_.find(key);
   if (it == mem_patterns_.end()) {
-#ifdef ENABLE_TRAINING
+    mem_pattern_misses_.fetch_add(1, std::memory_order_relaxed);
+    // We haven't seen this combination of input shapes before. Try to generate the pattern
+    // up-front by resolving the symbolic (free) dimensions in the model with the values from
+    // the feeds, so that a new batch size doesn't pay for a run with individual allocations
+    // before a traced pattern becomes available.
     auto mem_patterns = onnxruntime::make_unique<MemoryPatternGroup>();
     if (GeneratePatternGroupCache(input_shapes, feed_mlvalue_idxs, mem_patterns.get(), inferred_shapes).IsOK()) {
       key = CalculateMemoryPatternsKey(input_shapes);
@@ -531,12 +651,9 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<
       return ptr;
     }
     return nullptr;
-#else
-    ORT_UNUSED_PARAMETER(feed_mlvalue_idxs);
-    return nullptr;
-#endif
   }
 
+  mem_pattern_hits_.fetch_add(1, std::memory_order_relaxed);
   inferred_shapes = shape_patterns_[key];
   return it->second.get();
 }
@@ -567,6 +684,24 @@ Status SessionState::UpdateMemoryPatternGroupCache(const std::vector<std::refere
 
 bool SessionState::GetEnableMemoryPattern() const { return enable_mem_pattern_; }
 
+bool SessionState::GetEnablePerRunScratchArena() const { return enable_per_run_scratch_arena_; }
+
+size_t SessionState::GetCpuScratchArenaSizeEstimate() const {
+  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
+  size_t estimate = 0;
+  for (const auto& entry : mem_patterns_) {
+    const MemoryPatternGroup& group = *entry.second;
+    size_t cpu_peak = 0;
+    for (size_t i = 0; i < group.locations.size(); ++i) {
+      if (group.locations[i].device.Type() == OrtDevice::CPU) {
+        cpu_peak += group.patterns[i].PeakSize();
+      }
+    }
+    estimate = std::max(estimate, cpu_peak);
+  }
+  return estimate;
+}
+
 common::Status SessionState::AddInputNameToNodeInfoMapping(const std::string& input_name, const NodeInfo& node_info) {
   // Graph partitioning should ensure an input is only consumed from one device. Copy nodes should have been inserted
   // to handle a scenario where an input is required on different devices by different nodes. Validate that.
@@ -753,6 +888,57 @@ static Status GetSubGraphSessionStatesOrtFormat(
   return Status::OK();
 }
 
+static Status SaveExecutionPlanOrtFormat(flatbuffers::FlatBufferBuilder& builder,
+                                         const SequentialExecutionPlan& plan,
+                                         flatbuffers::Offset<fbs::ExecutionPlan>& fbs_execution_plan) {
+  std::vector<flatbuffers::Offset<fbs::AllocationPlan>> allocation_plan;
+  allocation_plan.reserve(plan.allocation_plan.size());
+  for (const auto& per_value_plan : plan.allocation_plan) {
+    const auto& device = per_value_plan.location.device;
+    auto location = fbs::CreateValueLocation(builder, device.Type(), device.MemType(), device.Id());
+
+    // the value type is not serialized as it is cheaply recomputed from the graph on load
+    flatbuffers::Offset<flatbuffers::Vector<uint64_t>> program_counter_starts = 0;
+    flatbuffers::Offset<flatbuffers::Vector<uint64_t>> program_counter_ends = 0;
+    const auto& program_counter = per_value_plan.program_counter;
+    if (!program_counter.Starts().empty()) {
+      std::vector<uint64_t> starts(program_counter.Starts().cbegin(), program_counter.Starts().cend());
+      std::vector<uint64_t> ends(program_counter.Ends().cbegin(), program_counter.Ends().cend());
+      program_counter_starts = builder.CreateVector(starts);
+      program_counter_ends = builder.CreateVector(ends);
+    }
+
+    allocation_plan.push_back(
+        fbs::CreateAllocationPlan(builder,
+                                  static_cast<fbs::AllocationKind>(per_value_plan.alloc_kind),
+                                  per_value_plan.reused_buffer,
+                                  per_value_plan.create_fence_if_async,
+                                  location,
+                                  program_counter_starts,
+                                  program_counter_ends));
+  }
+
+  std::vector<fbs::NodeExecutionPlan> execution_order;
+  execution_order.reserve(plan.execution_plan.size());
+  for (const auto& step : plan.execution_plan) {
+    execution_order.push_back(fbs::NodeExecutionPlan(gsl::narrow<uint32_t>(step.node_index),
+                                                     step.free_from_index, step.free_to_index));
+  }
+
+  std::vector<int32_t> initializer_allocation_order(plan.initializer_allocation_order.cbegin(),
+                                                    plan.initializer_allocation_order.cend());
+  std::vector<int32_t> activation_allocation_order(plan.activation_allocation_order.cbegin(),
+                                                   plan.activation_allocation_order.cend());
+  std::vector<int32_t> to_be_freed(plan.to_be_freed.cbegin(), plan.to_be_freed.cend());
+  std::vector<uint8_t> node_has_fence(plan.node_has_fence.cbegin(), plan.node_has_fence.cend());
+
+  fbs_execution_plan = fbs::CreateExecutionPlanDirect(builder, &allocation_plan, &execution_order,
+                                                      &initializer_allocation_order,
+                                                      &activation_allocation_order,
+                                                      &to_be_freed, &node_has_fence);
+  return Status::OK();
+}
+
 Status SessionState::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
                                      flatbuffers::Offset<fbs::SessionState>& fbs_session_state) const {
   size_t size = kernel_create_info_map_.size();
@@ -772,7 +958,14 @@ Status SessionState::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
   ORT_RETURN_IF_ERROR(
       GetSubGraphSessionStatesOrtFormat(builder, subgraph_session_states_, sub_graph_session_states));
 
-  fbs_session_state = fbs::CreateSessionStateDirect(builder, kernels, &sub_graph_session_states);
+  // Execution plan. SaveToOrtFormat is called after FinalizeSessionState so the plan is available.
+  flatbuffers::Offset<fbs::ExecutionPlan> execution_plan = 0;
+  if (p_seq_exec_plan_) {
+    ORT_RETURN_IF_ERROR(SaveExecutionPlanOrtFormat(builder, *p_seq_exec_plan_, execution_plan));
+  }
+
+  fbs_session_state = fbs::CreateSessionStateDirect(builder, kernels, &sub_graph_session_states,
+                                                    execution_plan);
   return Status::OK();
 }
 
@@ -800,6 +993,9 @@ Status SessionState::CreateSubgraphSessionState() {
       // Pass fused function manager to subgraph
       subgraph_session_state->fused_funcs_mgr_.SetFusedFuncs(fused_funcs_mgr_);
 
+      // Subgraphs share the pre-packed weights container (if any) with the main graph
+      subgraph_session_state->SetPrepackedWeightsContainer(prepacked_weights_container_);
+
       // recurse
       ORT_RETURN_IF_ERROR(subgraph_session_state->CreateSubgraphSessionState());
 
@@ -833,6 +1029,11 @@ Status SessionState::LoadFromOrtFormat(const fbs::SessionState& fbs_session_stat
         return Status::OK();
       };
 
+  // stash the serialized execution plan (if any) so FinalizeSessionStateImpl can use it instead of
+  // running the planner. the pointer is only valid while the serialized model bytes are alive,
+  // which InferenceSession guarantees until Initialize completes.
+  fbs_execution_plan_ = fbs_session_state.execution_plan();
+
   // kernel hashes for model are in top level SessionState
   const auto& compiled_kernel_hashes = GetCompiledKernelHashes();
 
@@ -894,6 +1095,102 @@ Status SessionState::LoadFromOrtFormat(const fbs::SessionState& fbs_session_stat
 
   return Status::OK();
 }
+
+Status SessionState::LoadExecutionPlanFromOrtFormat(const fbs::ExecutionPlan& fbs_execution_plan) {
+  auto plan = onnxruntime::make_unique<SequentialExecutionPlan>();
+
+  const auto* fbs_allocation_plan = fbs_execution_plan.allocation_plan();
+  ORT_RETURN_IF(nullptr == fbs_allocation_plan, "Serialized allocation plan is null. Invalid ORT format model.");
+
+  const auto num_ort_values = gsl::narrow<size_t>(ort_value_name_idx_map_.MaxIdx()) + 1;
+  ORT_RETURN_IF_NOT(fbs_allocation_plan->size() == num_ort_values,
+                    "Serialized allocation plan covers ", fbs_allocation_plan->size(), " values but the graph has ",
+                    num_ort_values, ". The model was optimized differently when the plan was saved.");
+
+  plan->allocation_plan.resize(num_ort_values);
+  for (flatbuffers::uoffset_t i = 0; i < fbs_allocation_plan->size(); ++i) {
+    const auto* fbs_per_value_plan = fbs_allocation_plan->Get(i);
+    ORT_RETURN_IF(nullptr == fbs_per_value_plan, "Serialized allocation plan entry is null. Invalid ORT format model.");
+
+    auto& per_value_plan = plan->allocation_plan[i];
+    per_value_plan.alloc_kind = static_cast<AllocKind>(fbs_per_value_plan->alloc_kind());
+    per_value_plan.reused_buffer = fbs_per_value_plan->reused_buffer();
+    per_value_plan.create_fence_if_async = fbs_per_value_plan->create_fence_if_async();
+
+    // resolve the saved device against the allocators registered with this session. a mismatch means the
+    // execution providers differ from when the plan was saved, so the plan cannot be used.
+    const auto* fbs_location = fbs_per_value_plan->location();
+    ORT_RETURN_IF(nullptr == fbs_location, "Serialized value location is null. Invalid ORT format model.");
+    OrtDevice device(gsl::narrow<OrtDevice::DeviceType>(fbs_location->device_type()),
+                     gsl::narrow<OrtDevice::MemoryType>(fbs_location->memory_type()),
+                     gsl::narrow<OrtDevice::DeviceId>(fbs_location->device_id()));
+    AllocatorPtr allocator = GetAllocator(device);
+    ORT_RETURN_IF(nullptr == allocator,
+                  "No allocator registered for the device a planned value was saved with. "
+                  "The execution providers differ from when the plan was saved.");
+    per_value_plan.location = allocator->Info();
+
+    // the value type is not serialized; recompute it from the graph
+    std::string ort_value_name;
+    ORT_RETURN_IF_ERROR(ort_value_name_idx_map_.GetName(gsl::narrow<int>(i), ort_value_name));
+    const auto* node_arg = graph_.GetNodeArg(ort_value_name);
+    if (node_arg != nullptr && node_arg->Type() != nullptr) {
+      per_value_plan.value_type = utils::GetMLDataType(*node_arg);
+    }
+
+    const auto* starts = fbs_per_value_plan->program_counter_starts();
+    const auto* ends = fbs_per_value_plan->program_counter_ends();
+    if (starts != nullptr || ends != nullptr) {
+      ORT_RETURN_IF(nullptr == starts || nullptr == ends || starts->size() != ends->size(),
+                    "Serialized program counter entries are inconsistent. Invalid ORT format model.");
+      for (flatbuffers::uoffset_t entry = 0; entry < starts->size(); ++entry) {
+        per_value_plan.program_counter.AddStart(gsl::narrow<size_t>(starts->Get(entry)));
+        per_value_plan.program_counter.AddEnd(gsl::narrow<size_t>(ends->Get(entry)));
+      }
+    }
+  }
+
+  const auto* fbs_to_be_freed = fbs_execution_plan.to_be_freed();
+  if (fbs_to_be_freed != nullptr) {
+    plan->to_be_freed.assign(fbs_to_be_freed->cbegin(), fbs_to_be_freed->cend());
+  }
+
+  const auto* fbs_execution_order = fbs_execution_plan.execution_order();
+  ORT_RETURN_IF(nullptr == fbs_execution_order, "Serialized execution order is null. Invalid ORT format model.");
+  plan->execution_plan.reserve(fbs_execution_order->size());
+  for (const auto* fbs_step : *fbs_execution_order) {
+    const auto node_index = gsl::narrow<NodeIndex>(fbs_step->node_index());
+    ORT_RETURN_IF(nullptr == graph_.GetNode(node_index),
+                  "Can't find node with index ", node_index, " from the serialized execution order. "
+                  "Invalid ORT format model.");
+    ORT_RETURN_IF(fbs_step->free_from_index() <= fbs_step->free_to_index() &&
+                      (fbs_step->free_from_index() < 0 ||
+                       gsl::narrow<size_t>(fbs_step->free_to_index()) >= plan->to_be_freed.size()),
+                  "Serialized free list indices are out of range. Invalid ORT format model.");
+
+    SequentialExecutionPlan::NodeExecutionPlan step(node_index);
+    step.free_from_index = fbs_step->free_from_index();
+    step.free_to_index = fbs_step->free_to_index();
+    plan->execution_plan.push_back(step);
+  }
+
+  const auto* fbs_initializer_order = fbs_execution_plan.initializer_allocation_order();
+  if (fbs_initializer_order != nullptr) {
+    plan->initializer_allocation_order.assign(fbs_initializer_order->cbegin(), fbs_initializer_order->cend());
+  }
+
+  const auto* fbs_activation_order = fbs_execution_plan.activation_allocation_order();
+  if (fbs_activation_order != nullptr) {
+    plan->activation_allocation_order.assign(fbs_activation_order->cbegin(), fbs_activation_order->cend());
+  }
+
+  const auto* fbs_node_has_fence = fbs_execution_plan.node_has_fence();
+  ORT_RETURN_IF(nullptr == fbs_node_has_fence, "Serialized fence info is null. Invalid ORT format model.");
+  plan->node_has_fence.assign(fbs_node_has_fence->cbegin(), fbs_node_has_fence->cend());
+
+  p_seq_exec_plan_ = std::move(plan);
+  return Status::OK();
+}
 #endif
 
 // Calculate the use count of a constant initialized tensor, including the use in subgraph.
@@ -952,8 +1249,31 @@ Status SessionState::FinalizeSessionState(const std::basic_string<PATH_CHAR_TYPE
 
   std::unordered_map<std::string, size_t> constant_initializers_use_count;
   ComputeConstantInitializerUseCount(graph_, constant_initializers_use_count);
+
+  // deserialized initializers are cached by content hash and shared across the main graph and all
+  // subgraph session states, so byte-identical copies (control flow models commonly export the
+  // same weight into every If/Loop branch) end up backed by a single buffer. when an env owned
+  // cache was attached the sharing additionally spans the other sessions using that cache.
+  session_state_utils::InitializerDedupCache session_initializer_dedup_cache;
+  const bool disable_initializer_dedup =
+      session_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisableInitializerDedup, "0") == "1";
+
+  session_state_utils::InitializerDedupCache* initializer_dedup_cache = nullptr;
+  std::unique_lock<OrtMutex> env_cache_lock;
+  if (!disable_initializer_dedup) {
+    if (env_initializer_dedup_cache_ != nullptr) {
+      initializer_dedup_cache = env_initializer_dedup_cache_;
+      // hold the cache lock across the whole finalization (main graph and subgraphs) so sessions
+      // initializing concurrently against the shared cache don't race on lookups and insertions
+      env_cache_lock = std::unique_lock<OrtMutex>(initializer_dedup_cache->mutex);
+    } else {
+      initializer_dedup_cache = &session_initializer_dedup_cache;
+    }
+  }
+
   return FinalizeSessionStateImpl(graph_location, kernel_registry_manager, nullptr, session_options,
-                                  remove_initializers, constant_initializers_use_count);
+                                  remove_initializers, constant_initializers_use_count,
+                                  initializer_dedup_cache);
 }
 
 Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_TYPE>& graph_location,
@@ -961,7 +1281,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                                               _In_opt_ const Node* parent_node,
                                               const SessionOptions& session_options,
                                               bool remove_initializers,
-                                              std::unordered_map<std::string, size_t>& constant_initializers_use_count) {
+                                              std::unordered_map<std::string, size_t>& constant_initializers_use_count,
+                                              session_state_utils::InitializerDedupCache* initializer_dedup_cache) {
   CreateGraphInfo();
 
   // ignore any outer scope args we don't know about. this can happen if a node contains multiple subgraphs.
@@ -979,14 +1300,55 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                   });
   }
 
-  SequentialPlannerContext context(session_options.execution_mode, session_options.execution_order);
-  ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
-                                                    execution_providers_, kernel_create_info_map_,
-                                                    ort_value_name_idx_map_, context, p_seq_exec_plan_));
+  bool loaded_serialized_plan = false;
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+  if (fbs_execution_plan_ != nullptr) {
+    // use the execution plan that was computed when the ORT format model was saved instead of
+    // running the planner again. if it can't be applied (e.g. the execution providers differ from
+    // when it was saved) fall back to computing a fresh plan.
+    const Status status = LoadExecutionPlanFromOrtFormat(*fbs_execution_plan_);
+    fbs_execution_plan_ = nullptr;  // pointer into the serialized model bytes; only valid during finalization
+    if (status.IsOK()) {
+      loaded_serialized_plan = true;
+    } else {
+      LOGS(logger_, WARNING) << "Unable to use serialized execution plan: " << status.ErrorMessage()
+                             << " Recomputing the plan.";
+      p_seq_exec_plan_.reset();
+    }
+  }
+#endif
+
+  if (!loaded_serialized_plan) {
+    const bool allow_input_buffer_reuse =
+        session_options.GetConfigOrDefault(kOrtSessionOptionsConfigAllowInputBufferReuse, "0") == "1";
+    SequentialPlannerContext context(session_options.execution_mode, session_options.execution_order,
+                                     allow_input_buffer_reuse);
+    ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
+                                                      execution_providers_, kernel_create_info_map_,
+                                                      ort_value_name_idx_map_, context, p_seq_exec_plan_));
+  }
 
   // Uncomment the below to dump the allocation plan to std::cout
   // LOGS(logger_, VERBOSE) << std::make_pair(p_seq_exec_plan_.get(), this);
 
+  if (session_options.GetConfigOrDefault(kOrtSessionOptionsConfigEnableActivationOffload, "0") == "1") {
+    ORT_RETURN_IF_ERROR(ActivationOffloadPlanner::CreatePlan(*graph_viewer_, ort_value_name_idx_map_,
+                                                             *p_seq_exec_plan_, activation_offload_plan_));
+    if (activation_offload_plan_) {
+      LOGS(logger_, INFO) << "Activation offload enabled: " << activation_offload_plan_->num_scheduled_copies
+                          << " lifetime gaps scheduled for offload to CPU.";
+    }
+  }
+
+  if (session_options.GetConfigOrDefault(kOrtSessionOptionsConfigEnableNodeClustering, "0") == "1") {
+    ORT_RETURN_IF_ERROR(NodeClusterPlanner::CreatePlan(*graph_viewer_, ort_value_name_idx_map_,
+                                                       *p_seq_exec_plan_, node_cluster_plan_));
+    if (node_cluster_plan_) {
+      LOGS(logger_, INFO) << "Node clustering enabled: " << node_cluster_plan_->num_clusters
+                          << " groups of independent lightweight nodes will run as parallel regions.";
+    }
+  }
+
   std::unique_ptr<ITensorAllocator> tensor_allocator(
       ITensorAllocator::Create(enable_mem_pattern_, *p_seq_exec_plan_, *this, weights_buffers_));
 
@@ -1001,7 +1363,7 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
           [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant) -> Status {
             return AddInitializedTensor(idx, value, &d, constant);
           },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options));
+          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options, initializer_dedup_cache));
 
   // remove weights from the graph now to save memory but in many cases it won't save memory, if the tensor was
   // preallocated with the some other tensors in a single 'allocate' call, which is very common.
@@ -1044,7 +1406,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
       // recurse
       ORT_RETURN_IF_ERROR(subgraph_session_state.FinalizeSessionStateImpl(
-          graph_location, kernel_registry_manager, &node, subgraph_session_options, remove_initializers, constant_initializers_use_count));
+          graph_location, kernel_registry_manager, &node, subgraph_session_options, remove_initializers,
+          constant_initializers_use_count, initializer_dedup_cache));
 
       // setup all the info for handling the feeds and fetches used in subgraph execution
       auto* p_op_kernel = GetMutableKernel(node.Index());
@@ -1057,6 +1420,19 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
     }
   }
 
+  // Decide once whether Runs may take the slimmed sequential dispatch loop: with a single
+  // execution provider, no fenced values and no subgraphs, the per-node fence and subgraph
+  // handling in the full loop can never fire. See SequentialExecutor::Execute.
+  lean_execution_eligible_ = execution_providers_.NumProviders() == 1 && subgraph_session_states_.empty();
+  if (lean_execution_eligible_) {
+    for (const auto& step : p_seq_exec_plan_->execution_plan) {
+      if (p_seq_exec_plan_->NodeHasFence(step.node_index)) {
+        lean_execution_eligible_ = false;
+        break;
+      }
+    }
+  }
+
   return Status::OK();
 }
 
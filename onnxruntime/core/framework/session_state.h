@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <map>
 #include <unordered_map>
@@ -13,6 +14,8 @@
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
 #include "core/common/profiler.h"
+#include "core/framework/activation_offload.h"
+#include "core/framework/node_clustering.h"
 #include "core/framework/allocation_planner.h"
 #include "core/framework/callback.h"
 #include "core/framework/data_transfer_manager.h"
@@ -42,17 +45,25 @@ namespace onnxruntime {
 
 namespace experimental {
 namespace fbs {
+struct ExecutionPlan;
 struct SessionState;
 }  // namespace fbs
 }  // namespace experimental
 
 class ExecutionProviders;
 class KernelDef;
+class CalibrationCollector;
+class NodeTimingCache;
+class PrepackedWeightsContainer;
 class OpKernel;
 class NodeIndexInfo;
 struct SequentialExecutionPlan;
 struct MemoryPatternGroup;
 
+namespace session_state_utils {
+struct InitializerDedupCache;
+}  // namespace session_state_utils
+
 /**
  * SessionState should be modified by the inference session class only.
  * It is supposed to be passed by const-ref only to all the executors.
@@ -80,12 +91,14 @@ class SessionState {
                const DataTransferManager& data_transfer_mgr,
                const logging::Logger& logger,
                profiling::Profiler& profiler,
-               bool use_deterministic_compute = false)
+               bool use_deterministic_compute = false,
+               bool enable_per_run_scratch_arena = false)
       : graph_(graph),
         execution_providers_(execution_providers),
         logger_(logger),
         profiler_(profiler),
         enable_mem_pattern_(enable_mem_pattern),
+        enable_per_run_scratch_arena_(enable_per_run_scratch_arena),
         thread_pool_(thread_pool),
         inter_op_thread_pool_(inter_op_thread_pool),
         data_transfer_mgr_(data_transfer_mgr),
@@ -172,6 +185,22 @@ class SessionState {
 
   // execution plan. nullptr until FinalizeSessionState is called
   const SequentialExecutionPlan* GetExecutionPlan() const;
+
+  // Activation offload schedule derived from the execution plan when
+  // kOrtSessionOptionsConfigEnableActivationOffload is set. nullptr when the option is off or
+  // when no value in this graph qualifies for offload.
+  const ActivationOffloadPlan* GetActivationOffloadPlan() const { return activation_offload_plan_.get(); }
+
+  // Cluster schedule for independent lightweight CPU nodes, derived from the execution plan
+  // when kOrtSessionOptionsConfigEnableNodeClustering is set. nullptr when the option is off
+  // or when no two consecutive steps in this graph qualify.
+  const NodeClusterPlan* GetNodeClusterPlan() const { return node_cluster_plan_.get(); }
+
+  // True when Runs may use the slimmed sequential dispatch loop: a single execution provider,
+  // no fenced values and no subgraphs, established once during finalization. The executor still
+  // falls back to the full loop when a per-Run feature (profiling, offload, clustering, ...)
+  // needs the per-node instrumentation.
+  bool IsLeanExecutionEligible() const { return lean_execution_eligible_; }
   /**
   Get the logger for this session.
   Falls back to returning Logging::LoggingManager::DefaultLogger if SetLogger has not been called.
@@ -206,6 +235,27 @@ class SessionState {
   */
   bool GetEnableMemoryPattern() const;
 
+  /**
+  Cumulative count of GetMemoryPatternGroup calls that found a cached pattern for the
+  input shapes (hits), and calls that did not and had to generate one or fall back to
+  individual allocation (misses). A growing miss share in a long-running process means
+  Runs are paying pattern generation or per-tensor allocation cost.
+  */
+  uint64_t GetMemoryPatternHitCount() const { return mem_pattern_hits_.load(std::memory_order_relaxed); }
+  uint64_t GetMemoryPatternMissCount() const { return mem_pattern_misses_.load(std::memory_order_relaxed); }
+
+  /**
+  Get enable per-Run scratch arena flag
+  */
+  bool GetEnablePerRunScratchArena() const;
+
+  /**
+  Estimate a size for the per-Run CPU scratch arena from the cached memory
+  pattern groups.  Returns the largest CPU peak size seen so far, or 0 if no
+  patterns have been cached yet.
+  */
+  size_t GetCpuScratchArenaSizeEstimate() const;
+
   /**
   Update enable_mem_pattern_ flag according to the presence of graph inputs' shape
   If any one of the graph input is shapeless, enable_mem_pattern_ will be set to false
@@ -249,6 +299,29 @@ class SessionState {
   concurrency::ThreadPool* GetThreadPool() const noexcept { return thread_pool_; }
   concurrency::ThreadPool* GetInterOpThreadPool() const noexcept { return inter_op_thread_pool_; }
 
+  // Priority at which this session's tasks are dispatched to the inter-op thread pool.
+  // See kOrtSessionOptionsConfigInterOpTaskPriority.
+  concurrency::TaskPriority GetInterOpTaskPriority() const noexcept { return inter_op_task_priority_; }
+  void SetInterOpTaskPriority(concurrency::TaskPriority priority) noexcept { inter_op_task_priority_ = priority; }
+
+  // Persisted per-node kernel timing profile. Owned by the InferenceSession, which must
+  // outlive this session state. Nullptr when timing capture is not enabled.
+  // See kOrtSessionOptionsConfigNodeTimingCachePath.
+  NodeTimingCache* GetNodeTimingCache() const noexcept { return node_timing_cache_; }
+  void SetNodeTimingCache(NodeTimingCache* cache) noexcept { node_timing_cache_ = cache; }
+
+  // Activation statistics collector for int8 calibration. Owned by the InferenceSession,
+  // which must outlive this session state. Nullptr unless calibration collection was
+  // enabled via InferenceSession::EnableCalibrationCollection.
+  CalibrationCollector* GetCalibrationCollector() const noexcept { return calibration_collector_; }
+  void SetCalibrationCollector(CalibrationCollector* collector) noexcept { calibration_collector_ = collector; }
+
+  // Remaining-critical-path cost per node, indexed by node index, computed from the loaded
+  // timing profile. Empty when no profile was available at session initialization; the
+  // parallel executor then keeps its cost-unaware scheduling.
+  const std::vector<double>& GetNodeCriticalPathCosts() const noexcept { return node_critical_path_costs_; }
+  void SetNodeCriticalPathCosts(std::vector<double>&& costs) { node_critical_path_costs_ = std::move(costs); }
+
   bool ExportDll() const noexcept { return export_fused_dll_; }
   void SetExportDllFlag(bool flag) noexcept { export_fused_dll_ = flag; }
 
@@ -261,6 +334,62 @@ class SessionState {
 
   const NodeIndexInfo& GetNodeIndexInfo() const;
 
+  // Name used for a node in profile events, verbose logs and arena allocation tags: the node
+  // name, or "<op type>_<node index>" when the model leaves the name blank. Built once when the
+  // graph info is created so the per-node execution path never constructs these strings.
+  const std::string& GetNodeNameForProfiling(NodeIndex node_index) const;
+
+  // Base class for kernel state that is pooled per concurrency level instead of being stored on
+  // the kernel. Kernels are created once per session, so state a kernel mutates during Compute
+  // (algorithm caches, scratch buffers) either forces serialization or is rebuilt on every Run.
+  // A pooled state instance is checked out for the duration of one Compute call and returned
+  // afterwards, so each concurrent Run works on its own instance and the pool never holds more
+  // instances than the peak concurrency reached.
+  struct PooledKernelState {
+    virtual ~PooledKernelState() = default;
+  };
+
+  using PooledKernelStateFactory = std::function<std::unique_ptr<PooledKernelState>()>;
+
+  // Check out a state instance for the given node. `factory` is invoked when the node's pool is
+  // empty: on first use, or when every instance is checked out by a concurrent Run.
+  std::unique_ptr<PooledKernelState> CheckOutKernelState(NodeIndex node_index,
+                                                         const PooledKernelStateFactory& factory) const;
+
+  // Return a checked-out instance so later Runs can reuse it.
+  void ReturnKernelState(NodeIndex node_index, std::unique_ptr<PooledKernelState> state) const;
+
+  // Checks state out for the current scope and returns it on destruction.
+  class PooledKernelStateHolder {
+   public:
+    PooledKernelStateHolder(const SessionState& session_state, NodeIndex node_index,
+                            const PooledKernelStateFactory& factory)
+        : session_state_(session_state),
+          node_index_(node_index),
+          state_(session_state.CheckOutKernelState(node_index, factory)) {}
+
+    ~PooledKernelStateHolder() {
+      session_state_.ReturnKernelState(node_index_, std::move(state_));
+    }
+
+    PooledKernelState* get() const { return state_.get(); }
+
+   private:
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PooledKernelStateHolder);
+
+    const SessionState& session_state_;
+    NodeIndex node_index_;
+    std::unique_ptr<PooledKernelState> state_;
+  };
+
+  // Storage for ExecutionFrame::all_values_, pooled so the frames created per Run — and per
+  // iteration when a control flow op executes over a subgraph session state — reuse a previous
+  // frame's allocation instead of growing a fresh vector each time. Checked-out storage is empty
+  // with capacity retained; returned storage must be cleared. Like the kernel state pools, the
+  // pool never holds more entries than the peak number of concurrent frames.
+  std::vector<OrtValue> CheckOutFrameValuesStorage() const;
+  void ReturnFrameValuesStorage(std::vector<OrtValue>&& storage) const;
+
 #if !defined(ORT_MINIMAL_BUILD)
   void UpdateToBeExecutedNodes(const std::vector<int>& fetch_mlvalue_idxs);
   const std::unordered_set<NodeIndex>* GetToBeExecutedNodes(const std::vector<int>& fetch_mlvalue_idxs) const;
@@ -275,6 +404,11 @@ class SessionState {
 
   Status LoadFromOrtFormat(const onnxruntime::experimental::fbs::SessionState& fbs_session_state,
                            const KernelRegistryManager& kernel_registry_manager);
+
+  // Reconstruct p_seq_exec_plan_ from a serialized execution plan instead of running the
+  // SequentialPlanner. Fails (without modifying the session state) if the plan cannot be applied
+  // to this session, e.g. if the execution providers differ from when the plan was saved.
+  Status LoadExecutionPlanFromOrtFormat(const onnxruntime::experimental::fbs::ExecutionPlan& fbs_execution_plan);
 #endif
 
   Status FinalizeSessionState(const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
@@ -309,6 +443,25 @@ class SessionState {
   */
   Status PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count);
 
+  /**
+  * Use the given env owned container to share pre-packed versions of the constant initialized tensors
+  * with the other sessions using the same container. Must be set before FinalizeSessionState is called
+  * so it propagates to any subgraph session states. The container must outlive this session state.
+  */
+  void SetPrepackedWeightsContainer(PrepackedWeightsContainer* prepacked_weights_container) {
+    prepacked_weights_container_ = prepacked_weights_container;
+  }
+
+  /**
+  * Use the given env owned cache to share deserialized constant initializers with the other
+  * sessions using the same cache, instead of deduplicating them within this session only.
+  * Must be set before FinalizeSessionState is called so it propagates to any subgraph session
+  * states. The cache must outlive this session state.
+  */
+  void SetEnvInitializerDedupCache(session_state_utils::InitializerDedupCache* initializer_dedup_cache) {
+    env_initializer_dedup_cache_ = initializer_dedup_cache;
+  }
+
   SessionState* GetMutableSubgraphSessionState(onnxruntime::NodeIndex index, const std::string& attribute_name);
 
   Status CreateSubgraphSessionState();
@@ -325,15 +478,18 @@ class SessionState {
                                   _In_opt_ const Node* parent_node,
                                   const SessionOptions& session_options,
                                   bool remove_initializers,
-                                  std::unordered_map<std::string, size_t>& constant_initializers_use_count);
+                                  std::unordered_map<std::string, size_t>& constant_initializers_use_count,
+                                  session_state_utils::InitializerDedupCache* initializer_dedup_cache);
 
-#ifdef ENABLE_TRAINING
+  // Generate a memory pattern for the given input shapes without running the model, by resolving
+  // the symbolic dimensions in the value shapes with the concrete values from the feeds.
+  // Values whose shapes cannot be fully resolved are left out of the pattern and are allocated
+  // individually at execution time.
   Status GeneratePatternGroupCache(
       const std::vector<std::reference_wrapper<const TensorShape>>& input_shape,
       const std::vector<int>& feed_mlvalue_idxs,
       MemoryPatternGroup* output,
       std::unordered_map<int, TensorShape>& inferred_shapes) const;
-#endif
 
   // the SessionState for the main Graph contains the compiled kernel hashes for the entire model
   const std::unordered_map<std::string, uint64_t>& GetCompiledKernelHashes() const {
@@ -347,11 +503,29 @@ class SessionState {
   // We populate this map when doing the kernel compilation in GraphPartitioner, and use it in LoadFromOrtFormat.
   std::unordered_map<std::string, uint64_t> compiled_kernel_hashes_;
 
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+  // Serialized execution plan from an ORT format model, if one was provided. Points into the model
+  // bytes which the owning InferenceSession keeps alive until the session state is finalized, so it
+  // must only be used (and is cleared) during FinalizeSessionStateImpl.
+  const onnxruntime::experimental::fbs::ExecutionPlan* fbs_execution_plan_{nullptr};
+#endif
+
   // cache of the constructed kernels to avoid spending construction time per executor
   std::vector<OpKernel*> session_kernels_;
   Graph& graph_;
   std::unique_ptr<GraphViewer> graph_viewer_;  // GraphViewer for const access to Graph
 
+  // indexed by NodeIndex; see GetNodeNameForProfiling
+  std::vector<std::string> node_names_for_profiling_;
+
+  // per-node pools of checked-in kernel state; see CheckOutKernelState
+  mutable OrtMutex pooled_kernel_states_lock_;
+  mutable std::unordered_map<NodeIndex, std::vector<std::unique_ptr<PooledKernelState>>> pooled_kernel_states_;
+
+  // pool of frame value storage; see CheckOutFrameValuesStorage
+  mutable OrtMutex frame_values_pool_lock_;
+  mutable std::vector<std::vector<OrtValue>> frame_values_pool_;
+
   const ExecutionProviders& execution_providers_;
 
   // currently the allocator type is an implementation detail and we don't make any  behavioral choices based on it,
@@ -401,12 +575,33 @@ class SessionState {
   std::vector<BufferUniquePtr> weights_buffers_;
   std::unique_ptr<SequentialExecutionPlan> p_seq_exec_plan_ = nullptr;
 
+  // offload schedule for activations with distant uses; see GetActivationOffloadPlan
+  std::unique_ptr<ActivationOffloadPlan> activation_offload_plan_ = nullptr;
+
+  // cluster schedule for independent lightweight nodes; see GetNodeClusterPlan
+  std::unique_ptr<NodeClusterPlan> node_cluster_plan_ = nullptr;
+
+  // see IsLeanExecutionEligible
+  bool lean_execution_eligible_ = false;
+
   const logging::Logger& logger_;
   profiling::Profiler& profiler_;
 
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
 
+  // switch for the per-Run bump-pointer scratch arena used for activations that
+  // cannot be placed via a memory pattern.
+  bool enable_per_run_scratch_arena_;
+
+  // env owned cache of pre-packed weights shared across sessions. nullptr (the default) keeps
+  // all pre-packed weights private to this session.
+  PrepackedWeightsContainer* prepacked_weights_container_{nullptr};
+
+  // env owned cache of deserialized constant initializers shared across sessions. nullptr (the
+  // default) keeps initializer deduplication local to this session.
+  session_state_utils::InitializerDedupCache* env_initializer_dedup_cache_{nullptr};
+
   // lock for the mem_patterns_
   mutable OrtMutex mem_patterns_lock_;
 
@@ -414,6 +609,10 @@ class SessionState {
   mutable std::map<int64_t, std::unique_ptr<MemoryPatternGroup>> mem_patterns_;
   mutable std::map<int64_t, std::unordered_map<int, TensorShape>> shape_patterns_;
 
+  // cache outcome counters for GetMemoryPatternGroup, see GetMemoryPatternHitCount.
+  mutable std::atomic<uint64_t> mem_pattern_hits_{0};
+  mutable std::atomic<uint64_t> mem_pattern_misses_{0};
+
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
 
@@ -427,6 +626,14 @@ class SessionState {
   concurrency::ThreadPool* const thread_pool_{};
   concurrency::ThreadPool* const inter_op_thread_pool_{};
 
+  concurrency::TaskPriority inter_op_task_priority_{concurrency::TaskPriority::kNormal};
+
+  // not owned. see SetNodeTimingCache.
+  NodeTimingCache* node_timing_cache_{nullptr};
+  // not owned. see SetCalibrationCollector.
+  CalibrationCollector* calibration_collector_{nullptr};
+  std::vector<double> node_critical_path_costs_;
+
   bool export_fused_dll_ = false;
   FuncManager fused_funcs_mgr_;
   const DataTransferManager& data_transfer_mgr_;
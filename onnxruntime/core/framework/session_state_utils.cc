@@ -4,8 +4,13 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/framework/session_state_utils.h"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <limits>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
 #include <core/common/status.h>
 
 #include "core/common/common.h"
@@ -22,38 +27,171 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 #include "core/framework/mem_buffer.h"
+#include "core/framework/murmurhash3.h"
 #include "core/framework/tensor_allocator.h"
+#include "core/framework/tensor_external_data_info.h"
+#include "core/platform/path_lib.h"
 
 namespace onnxruntime {
 namespace session_state_utils {
 
+namespace {
+
+// A (file, offset, length) range holding the external data of one initializer.
+struct ExternalDataSegment {
+  std::basic_string<PATH_CHAR_TYPE> path;
+  FileOffsetType offset;
+  size_t length;  // 0 means the rest of the file
+};
+
+// Reads the external-data segments of a graph on a few background threads while the
+// deserialization loop consumes them in the same order. The reads bring the ranges into the
+// OS file cache ahead of the consumer, so the mapped or copied access in GetFileContent hits
+// warm pages and the device sees several sequential streams instead of one latency-bound
+// tensor-at-a-time pattern. Read failures are ignored here; the deserialization loop will
+// surface them with the tensor name attached.
+// Number of reader threads and the size of each read request.
+constexpr size_t kNumPrefetchThreads = 4;
+constexpr size_t kReadChunkBytes = 4 * 1024 * 1024;
+
+class ExternalDataPrefetcher {
+ public:
+  ExternalDataPrefetcher(const Env& env, std::vector<ExternalDataSegment>&& segments)
+      : env_(env), segments_(std::move(segments)) {
+    const size_t num_threads = std::min(size_t{kNumPrefetchThreads}, segments_.size());
+    threads_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() { ReadSegments(); });
+    }
+  }
+
+  ~ExternalDataPrefetcher() {
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+ private:
+  void ReadSegments() {
+    std::vector<char> buffer(kReadChunkBytes);
+    for (size_t i = next_segment_.fetch_add(1); i < segments_.size(); i = next_segment_.fetch_add(1)) {
+      const ExternalDataSegment& segment = segments_[i];
+      size_t length = segment.length;
+      if (length == 0 && !env_.GetFileLength(segment.path.c_str(), length).IsOK()) {
+        continue;
+      }
+      for (size_t pos = 0; pos < length; pos += kReadChunkBytes) {
+        const size_t bytes = std::min(kReadChunkBytes, length - pos);
+        if (!env_.ReadFileIntoBuffer(segment.path.c_str(), segment.offset + static_cast<FileOffsetType>(pos),
+                                     bytes, gsl::make_span(buffer.data(), bytes))
+                 .IsOK()) {
+          break;
+        }
+      }
+    }
+  }
+
+  const Env& env_;
+  const std::vector<ExternalDataSegment> segments_;
+  std::atomic<size_t> next_segment_{0};
+  std::vector<std::thread> threads_;
+};
+
+// Resolves the external-data reference of tensor_proto against the model location, mirroring
+// the path handling in TensorProtoToMLValue. Returns false if the tensor has no external data
+// or the reference cannot be parsed.
+bool GetExternalDataSegment(const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                            const std::basic_string<PATH_CHAR_TYPE>& model_path,
+                            ExternalDataSegment& segment) {
+  if (tensor_proto.data_location() != ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL) {
+    return false;
+  }
+
+  std::unique_ptr<ExternalDataInfo> external_data_info;
+  if (!ExternalDataInfo::Create(tensor_proto.external_data(), external_data_info).IsOK()) {
+    return false;
+  }
+
+  if (!model_path.empty()) {
+    if (!GetDirNameFromFilePath(model_path, segment.path).IsOK()) {
+      return false;
+    }
+    segment.path = ConcatPathComponent<PATH_CHAR_TYPE>(segment.path, external_data_info->GetRelPath());
+  } else {
+    segment.path = external_data_info->GetRelPath();
+  }
+  segment.offset = static_cast<FileOffsetType>(external_data_info->GetOffset());
+  segment.length = external_data_info->GetLength();
+  return true;
+}
+
+}  // namespace
+
+// Build the InitializerDedupCache lookup key from the data type, shape, raw contents and planned
+// memory location of an initializer. Mirrors the content hashing done for the pre-packed weights
+// container: the hash is chained through the seed for tensors larger than what a single
+// MurmurHash3 call can consume.
+static std::string GenerateInitializerDedupKey(const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                               const OrtMemoryInfo& location) {
+  std::ostringstream ss;
+  ss << tensor_proto.data_type();
+  for (auto dim : tensor_proto.dims()) {
+    ss << '_' << dim;
+  }
+
+  uint32_t hash[4] = {0, 0, 0, 0};
+  const std::string& raw_data = tensor_proto.raw_data();
+  const char* data = raw_data.data();
+  size_t bytes_remaining = raw_data.size();
+  while (bytes_remaining > 0) {
+    const int chunk = static_cast<int>(
+        std::min<size_t>(bytes_remaining, static_cast<size_t>(std::numeric_limits<int>::max())));
+    MurmurHash3::x86_128(data, chunk, hash[0], hash);
+    data += chunk;
+    bytes_remaining -= static_cast<size_t>(chunk);
+  }
+
+  ss << '+' << hash[0] << '_' << hash[1] << '_' << hash[2] << '_' << hash[3]
+     << '@' << location.ToString();
+
+  return ss.str();
+}
+
+// Deserializes into the preallocated buffer m when it is provided, otherwise into a buffer freshly
+// allocated from (and owned via) alloc. Exactly one of m and alloc must be set. The owning variant
+// is used for the representative entries of a cross-session dedup cache, whose buffers must stay
+// valid after the session that deserialized them is released.
 static common::Status DeserializeTensorProto(const Env& env, const std::basic_string<PATH_CHAR_TYPE>& proto_path,
-                                             const ONNX_NAMESPACE::TensorProto& tensor_proto, const MemBuffer& m,
+                                             const ONNX_NAMESPACE::TensorProto& tensor_proto, const MemBuffer* m,
+                                             const AllocatorPtr& alloc,
                                              const OrtMemoryInfo& default_cpu_memory_info, OrtValue& ort_value,
                                              OrtCallback& deleter,
                                              const DataTransferManager& data_transfer_mgr) {
-  const OrtMemoryInfo& alloc_info = m.GetAllocInfo();
-  if (strcmp(alloc_info.name, CPU) == 0 || alloc_info.mem_type == OrtMemTypeCPUOutput) {
+  ORT_ENFORCE((m == nullptr) != (alloc == nullptr),
+              "Either a preallocated buffer or an allocator must be provided, but not both.");
+  const OrtMemoryInfo& alloc_info = m != nullptr ? m->GetAllocInfo() : alloc->Info();
+  if (m != nullptr && (strcmp(alloc_info.name, CPU) == 0 || alloc_info.mem_type == OrtMemTypeCPUOutput)) {
     // deserialize directly to CPU tensor
-    return utils::TensorProtoToMLValue(env, proto_path.c_str(), tensor_proto, m, ort_value, deleter);
+    return utils::TensorProtoToMLValue(env, proto_path.c_str(), tensor_proto, *m, ort_value, deleter);
   }
 
   // deserialize and copy. In the copy stage, it won't check if the buffer has enough room.
   // The result tensor won't need a deleter because:
   // 1. It mustn't be a string tensor
-  // 2. The memory is not memory-mapped.
+  // 2. The memory is not memory-mapped; it is either the preallocated buffer (not owned by the
+  //    tensor) or allocated by the tensor itself and released through its allocator.
   deleter.f = nullptr;
   deleter.param = nullptr;
   if (tensor_proto.data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "string tensor is not supported for copying between allocators");
   }
 
-  // deserialize to CPU first for non-CPU allocator, then alloc and copy
+  // deserialize to CPU first, then alloc and copy
   size_t cpu_tensor_length;
   ORT_RETURN_IF_ERROR(utils::GetSizeInBytesFromTensorProto<0>(tensor_proto, &cpu_tensor_length));
-  if (m.GetLen() < cpu_tensor_length) {
+  if (m != nullptr && m->GetLen() < cpu_tensor_length) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Internal error. The preallocated buffer is too small. Requires ",
-                           cpu_tensor_length, ", Got ", m.GetLen());
+                           cpu_tensor_length, ", Got ", m->GetLen());
   }
 
   std::unique_ptr<char[]> data(new char[cpu_tensor_length]);
@@ -66,8 +204,12 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
 
   const Tensor& p_deserialize_tensor = tmp_ort_value.Get<Tensor>();
 
-  p_tensor = onnxruntime::make_unique<Tensor>(p_deserialize_tensor.DataType(), p_deserialize_tensor.Shape(), m.GetBuffer(),
-                                              m.GetAllocInfo());
+  if (m != nullptr) {
+    p_tensor = onnxruntime::make_unique<Tensor>(p_deserialize_tensor.DataType(), p_deserialize_tensor.Shape(),
+                                                m->GetBuffer(), m->GetAllocInfo());
+  } else {
+    p_tensor = onnxruntime::make_unique<Tensor>(p_deserialize_tensor.DataType(), p_deserialize_tensor.Shape(), alloc);
+  }
   // TODO: does this function work for string tensor?
   Status copy_status = data_transfer_mgr.CopyTensor(p_deserialize_tensor, *p_tensor);
   if (d.f) d.f(d.param);
@@ -96,7 +238,8 @@ common::Status SaveInitializedTensors(
     const std::function<Status(int idx, const OrtValue& value, const OrtCallback& d, bool constant)>& save_tensor_func,
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options) {
+    const SessionOptions& session_options,
+    InitializerDedupCache* dedup_cache) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -142,12 +285,67 @@ common::Status SaveInitializedTensors(
     id_to_initialized_tensor[ort_value_index] = entry.second;
   }
 
+  // Identify byte-identical constant initializers so they can alias a single OrtValue.
+  // An initializer whose identical twin was already deserialized (in this graph or in a graph
+  // finalized earlier with the same cache) is neither traced by the planner nor deserialized
+  // again; it just receives a copy of the twin's OrtValue below.
+  std::unordered_map<int, OrtValue> aliased_initializers;     // twin available from the cache
+  std::unordered_map<int, std::string> deferred_aliases;      // twin is deserialized later in this graph
+  std::unordered_map<int, std::string> cache_keys_to_insert;  // first occurrence, populates the cache
+  if (dedup_cache != nullptr) {
+    std::unordered_set<std::string> keys_seen_in_graph;
+    for (const auto& entry : id_to_initialized_tensor) {
+      const int ort_value_index = entry.first;
+      const ONNX_NAMESPACE::TensorProto& tensor_proto = *entry.second;
+      // only raw_data backed, non-string tensors can be hashed without deserializing them first,
+      // and an initializer that can be overridden by a feed must keep its own buffer
+      if (user_supplied_initializer_ids.find(ort_value_index) != user_supplied_initializer_ids.end() ||
+          tensor_proto.data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING ||
+          !utils::HasRawData(tensor_proto) ||
+          !graph.IsConstantInitializer(tensor_proto.name(), /* check_outer_scope */ false)) {
+        continue;
+      }
+
+      const std::string key = GenerateInitializerDedupKey(tensor_proto, exec_plan.GetLocation(ort_value_index));
+
+      const auto cached = dedup_cache->values.find(key);
+      if (cached != dedup_cache->values.cend()) {
+        aliased_initializers.insert({ort_value_index, cached->second});
+        LOGS(logger, INFO) << "Aliasing initializer " << tensor_proto.name()
+                           << " to an identical previously loaded initializer.";
+      } else if (keys_seen_in_graph.insert(key).second) {
+        cache_keys_to_insert.insert({ort_value_index, key});
+      } else {
+        deferred_aliases.insert({ort_value_index, key});
+        LOGS(logger, INFO) << "Aliasing initializer " << tensor_proto.name()
+                           << " to an identical initializer in the same graph.";
+      }
+    }
+  }
+
+  auto is_aliased_initializer = [&aliased_initializers, &deferred_aliases](int ort_value_index) {
+    return aliased_initializers.find(ort_value_index) != aliased_initializers.cend() ||
+           deferred_aliases.find(ort_value_index) != deferred_aliases.cend();
+  };
+
+  // representatives of a cross-session cache own their buffers (allocated below, outside the
+  // planned weight memory, so they outlive this session) and must not be traced either
+  auto uses_planned_buffer = [&](int ort_value_index) {
+    if (is_aliased_initializer(ort_value_index)) {
+      return false;
+    }
+    return dedup_cache == nullptr || !dedup_cache->cross_session ||
+           cache_keys_to_insert.find(ort_value_index) == cache_keys_to_insert.cend();
+  };
+
   // tensors requiring a specific allocation order are traced first, to ensure they are allocated in order
   auto initialized_tensors_to_allocate = id_to_initialized_tensor;
   for (int ort_value_index : initializer_allocation_order) {
     const auto entry = initialized_tensors_to_allocate.find(ort_value_index);
     ORT_ENFORCE(entry != initialized_tensors_to_allocate.end());
-    ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
+    if (uses_planned_buffer(ort_value_index)) {
+      ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
+    }
     initialized_tensors_to_allocate.erase(entry);
   }
 
@@ -156,6 +354,11 @@ common::Status SaveInitializedTensors(
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       continue;
     }
+    // aliased initializers reuse the buffer of their identical twin, and cross-session cache
+    // representatives own their buffer; neither needs a planned allocation
+    if (!uses_planned_buffer(entry.first)) {
+      continue;
+    }
     ORT_RETURN_IF_ERROR(planner.Trace(entry.first, entry.second));
   }
 
@@ -173,6 +376,25 @@ common::Status SaveInitializedTensors(
 
   OrtCallback deleter{nullptr, nullptr};
 
+  // Kick off background read-ahead of any external weight files. The segments are listed in
+  // the order the loop below consumes them, so the readers stay ahead of the consumer and a
+  // sharded model is pulled in with several reads in flight instead of one tensor at a time.
+  std::vector<ExternalDataSegment> external_data_segments;
+  for (const auto& entry : id_to_initialized_tensor) {
+    if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end() ||
+        is_aliased_initializer(entry.first)) {
+      continue;
+    }
+    ExternalDataSegment segment;
+    if (GetExternalDataSegment(*entry.second, graph_loc, segment)) {
+      external_data_segments.push_back(std::move(segment));
+    }
+  }
+  std::unique_ptr<ExternalDataPrefetcher> prefetcher;
+  if (!external_data_segments.empty()) {
+    prefetcher = onnxruntime::make_unique<ExternalDataPrefetcher>(env, std::move(external_data_segments));
+  }
+
   //3. create weight tensors based on weights buffer
   for (const auto& entry : id_to_initialized_tensor) {
     int ort_value_index = entry.first;
@@ -182,23 +404,48 @@ common::Status SaveInitializedTensors(
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       ort_value = *(session_options.initializers_to_share_map.at(name));
       LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
+    } else if (aliased_initializers.find(ort_value_index) != aliased_initializers.cend()) {
+      // share the value of the identical twin. any cleanup is owned by the session state that
+      // deserialized the twin, so don't register a deleter for this entry
+      ort_value = aliased_initializers[ort_value_index];
+      deleter.f = nullptr;
+      deleter.param = nullptr;
+    } else if (deferred_aliases.find(ort_value_index) != deferred_aliases.cend()) {
+      // resolved below once the twin in this graph has been deserialized
+      continue;
     } else {
       const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
 
       std::unique_ptr<MemBuffer> m;
-      // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m));
+      AllocatorPtr alloc;
+      if (uses_planned_buffer(ort_value_index)) {
+        // TODO: if the tensor need be copied, does it have enough room?
+        ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m));
 #ifndef NDEBUG
-      ORT_ENFORCE(m != nullptr);
-      ORT_ENFORCE(m->GetBuffer() != nullptr || m->GetLen() == 0);
+        ORT_ENFORCE(m != nullptr);
+        ORT_ENFORCE(m->GetBuffer() != nullptr || m->GetLen() == 0);
 #endif
-      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, *m, default_cpu_memory_info, ort_value, deleter,
-                                         data_transfer_mgr);
+      } else {
+        // a cross-session cache representative allocates and owns its buffer so the cached value
+        // stays valid after this session's planned weight memory is released
+        alloc = planner.GetAllocator(exec_plan.GetLocation(ort_value_index));
+        if (alloc == nullptr) {
+          return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to get an allocator for initializer ", name,
+                                 " at location ", exec_plan.GetLocation(ort_value_index).ToString());
+        }
+      }
+      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, m.get(), alloc, default_cpu_memory_info,
+                                         ort_value, deleter, data_transfer_mgr);
       if (!st.IsOK()) {
         std::ostringstream oss;
         oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
         return Status(st.Category(), st.Code(), oss.str());
       }
+
+      const auto key_entry = cache_keys_to_insert.find(ort_value_index);
+      if (key_entry != cache_keys_to_insert.cend()) {
+        dedup_cache->values.insert({key_entry->second, ort_value});
+      }
     }
 
     // any outer scope value is shadowed by a local value and can't override it.
@@ -209,6 +456,20 @@ common::Status SaveInitializedTensors(
     VLOGS(logger, 1) << "Added weight with name : " << name << " with index: " << ort_value_index;
   }
 
+  // resolve initializers whose identical twin lives in the same graph now that the twin has been
+  // deserialized and added to the cache
+  for (const auto& deferred : deferred_aliases) {
+    const int ort_value_index = deferred.first;
+    const auto cached = dedup_cache->values.find(deferred.second);
+    ORT_ENFORCE(cached != dedup_cache->values.cend(),
+                "Initializer dedup cache is missing the representative for an aliased initializer.");
+    OrtCallback no_deleter{nullptr, nullptr};
+    // only constant initializers are deduplicated, so the constant flag is always true here
+    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, cached->second, no_deleter, /* constant */ true));
+
+    VLOGS(logger, 1) << "Added aliased weight with index: " << ort_value_index;
+  }
+
   LOGS(logger, INFO) << "Done saving initialized tensors";
   return common::Status::OK();
 }
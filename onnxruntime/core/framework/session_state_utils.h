@@ -3,13 +3,16 @@
 
 #pragma once
 #include <map>
+#include <unordered_map>
 
 #include "core/common/const_pointer_container.h"
 #include "core/framework/allocator.h"
+#include "core/framework/ml_value.h"
 #include "core/framework/tensor.h"
 #include "core/framework/tensor_allocator.h"
 #include "core/framework/session_options.h"
 #include "core/framework/sequential_execution_plan.h"
+#include "core/platform/ort_mutex.h"
 #include "core/platform/path_lib.h"
 
 namespace onnxruntime {
@@ -27,6 +30,31 @@ class Logger;
 }
 
 namespace session_state_utils {
+
+// Deserialized initializer values keyed by content hash, data type, shape and planned memory
+// location. Control flow models commonly export the same weight into every If/Loop branch; the
+// cache is created once per session and shared by the session states of the main graph and all
+// subgraphs while the session state is being finalized, so byte-identical copies end up aliasing
+// a single OrtValue instead of each owning a buffer.
+//
+// A cache can also be owned by the env and shared between sessions (see
+// kOrtSessionOptionsConfigUseEnvInitializerDedupCache), in which case cross_session is true.
+// Representative entries of a cross-session cache are deserialized into buffers they own rather
+// than into the creating session's planned weight memory, so they stay valid after that session
+// is released. The shared values are treated as read only and, like the entries of the env owned
+// PrepackedWeightsContainer, are never evicted: they live for the lifetime of the cache.
+struct InitializerDedupCache {
+  std::unordered_map<std::string, OrtValue> values;
+
+  // true if the cache outlives the session states populating it
+  bool cross_session{false};
+
+  // Serializes session state finalization against a cross-session cache. Held by the finalizing
+  // session across the main graph and all subgraphs so the entries it inserts for the main graph
+  // are visible when its subgraphs (and any concurrently initializing session) look them up.
+  OrtMutex mutex;
+};
+
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const OrtMemoryInfo& default_cpu_memory_info,
@@ -36,7 +64,8 @@ common::Status SaveInitializedTensors(
     const logging::Logger& logger,
     const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options);
+    const SessionOptions& session_options,
+    InitializerDedupCache* dedup_cache);
 
 common::Status SaveInputOutputNamesToNodeMapping(const GraphViewer& graph,
                                                  SessionState& session_state,
@@ -10,6 +10,17 @@
 
 namespace onnxruntime {
 
+static std::vector<int64_t> ComputeContiguousStrides(const TensorShape& shape) {
+  const auto& dims = shape.GetDims();
+  std::vector<int64_t> strides(dims.size());
+  int64_t running_size = 1;
+  for (size_t i = dims.size(); i > 0; --i) {
+    strides[i - 1] = running_size;
+    running_size *= dims[i - 1];
+  }
+  return strides;
+}
+
 Tensor::Tensor(MLDataType p_type, const TensorShape& shape, void* p_data, const OrtMemoryInfo& alloc,
                ptrdiff_t offset)
     : alloc_info_(alloc) {
@@ -17,6 +28,27 @@ Tensor::Tensor(MLDataType p_type, const TensorShape& shape, void* p_data, const
   Init(p_type, shape, p_data, nullptr, offset);
 }
 
+Tensor::Tensor(MLDataType p_type, const TensorShape& shape, void* p_data, const OrtMemoryInfo& alloc,
+               const std::vector<int64_t>& strides, ptrdiff_t offset)
+    : alloc_info_(alloc) {
+  ORT_ENFORCE(p_type != nullptr);
+  ORT_ENFORCE(strides.size() == shape.NumDimensions(),
+              "Number of strides (", strides.size(), ") does not match number of dimensions (",
+              shape.NumDimensions(), ").");
+  Init(p_type, shape, p_data, nullptr, offset);
+  if (strides != ComputeContiguousStrides(shape)) {
+    strides_ = strides;
+    is_contiguous_ = false;
+  }
+}
+
+std::vector<int64_t> Tensor::Strides() const {
+  if (is_contiguous_) {
+    return ComputeContiguousStrides(shape_);
+  }
+  return strides_;
+}
+
 Tensor::Tensor(MLDataType p_type, const TensorShape& shape, std::shared_ptr<IAllocator> allocator)
     : alloc_info_(allocator->Info()) {
   ORT_ENFORCE(p_type != nullptr);
@@ -70,11 +102,15 @@ Tensor::Tensor(Tensor&& other) noexcept
     : p_data_(other.p_data_),
       buffer_deleter_(other.buffer_deleter_),
       shape_(other.shape_),
+      strides_(std::move(other.strides_)),
+      is_contiguous_(other.is_contiguous_),
       dtype_(other.dtype_),
       alloc_info_(other.alloc_info_),
       byte_offset_(other.byte_offset_) {
   other.dtype_ = DataTypeImpl::GetType<float>()->AsPrimitiveDataType();
   other.shape_ = TensorShape(std::vector<int64_t>(1, 0));
+  other.strides_.clear();
+  other.is_contiguous_ = true;
   other.p_data_ = nullptr;
   other.buffer_deleter_ = nullptr;
   other.byte_offset_ = 0;
@@ -86,6 +122,8 @@ Tensor& Tensor::operator=(Tensor&& other) noexcept {
 
     dtype_ = other.dtype_;
     shape_ = other.shape_;
+    strides_ = std::move(other.strides_);
+    is_contiguous_ = other.is_contiguous_;
     alloc_info_ = other.alloc_info_;
     byte_offset_ = other.byte_offset_;
     p_data_ = other.p_data_;
@@ -93,6 +131,8 @@ Tensor& Tensor::operator=(Tensor&& other) noexcept {
 
     other.dtype_ = DataTypeImpl::GetType<float>()->AsPrimitiveDataType();
     other.shape_ = TensorShape(std::vector<int64_t>(1, 0));
+    other.strides_.clear();
+    other.is_contiguous_ = true;
     other.p_data_ = nullptr;
     other.byte_offset_ = 0;
     other.buffer_deleter_ = nullptr;
@@ -50,16 +50,29 @@ int64_t TensorShape::SizeFromDimension(size_t dimension) const {
   return size;
 }
 
-TensorShape TensorShape::Slice(size_t dimstart, size_t dimend) const {
+TensorShape TensorShape::Slice(size_t dimstart, size_t dimend) const& {
   ORT_ENFORCE(dimstart <= dimend && dimend <= size(),
               "Invalid tensor shape slice argument.");
   return TensorShape(*this, dimstart, dimend);
 }
 
-TensorShape TensorShape::Slice(size_t dimstart) const {
+TensorShape TensorShape::Slice(size_t dimstart) const& {
   return Slice(dimstart, size());
 }
 
+TensorShape TensorShape::Slice(size_t dimstart, size_t dimend) && {
+  ORT_ENFORCE(dimstart <= dimend && dimend <= size(),
+              "Invalid tensor shape slice argument.");
+  // trim in place so the expiring shape's heap storage carries over to the result
+  erase(begin() + dimend, end());
+  erase(begin(), begin() + dimstart);
+  return std::move(*this);
+}
+
+TensorShape TensorShape::Slice(size_t dimstart) && {
+  return std::move(*this).Slice(dimstart, size());
+}
+
 // output dimensions
 std::string TensorShape::ToString() const {
   std::string result;
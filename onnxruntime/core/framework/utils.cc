@@ -433,17 +433,21 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
                                        const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                                        const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
                                        ExecutionMode execution_mode, const bool& terminate_flag,
-                                       const logging::Logger& logger, const bool only_execute_path_to_fetches = false) {
-  std::unique_ptr<IExecutor> p_exec;
-  if (execution_mode == ExecutionMode::ORT_SEQUENTIAL) {
-    p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches));
-  } else if (execution_mode == ExecutionMode::ORT_PARALLEL) {
+                                       const logging::Logger& logger, const bool only_execute_path_to_fetches = false,
+                                       const OrtRunOptions* run_options = nullptr) {
+  // the sequential executor is stateless and cheap, so keep it on the stack. control flow kernels
+  // come through here once per subgraph iteration and shouldn't pay for a heap allocation each time.
+  SequentialExecutor sequential_executor(terminate_flag, only_execute_path_to_fetches, run_options);
+  std::unique_ptr<ParallelExecutor> parallel_executor;
+  IExecutor* p_exec = &sequential_executor;
+
+  if (execution_mode == ExecutionMode::ORT_PARALLEL) {
     auto* p_inter_op_thread_pool = session_state.GetInterOpThreadPool();
     if (!p_inter_op_thread_pool) {
       LOGS(logger, WARNING) << "Only one thread was configured for parallel execution. Hence will use sequential execution.";
-      p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches));
     } else {
-      p_exec = std::unique_ptr<IExecutor>(new ParallelExecutor(session_state, terminate_flag));
+      parallel_executor = onnxruntime::make_unique<ParallelExecutor>(session_state, terminate_flag, run_options);
+      p_exec = parallel_executor.get();
     }
   }
 
@@ -460,8 +464,13 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
   } else {
     const std::vector<OrtValue>* p_feeds = &feeds;
     std::vector<OrtValue>* p_fetches = &fetches;
-    std::vector<OrtValue> device_feeds;
-    std::vector<OrtValue> device_fetches;
+
+    // recycle the scratch vectors cached on the FeedsFetchesManager so repeated executions
+    // (e.g. each Loop/Scan iteration) reuse their capacity. on an error the scratch is simply
+    // dropped instead of being returned.
+    auto scratch = feeds_fetches_manager.CheckOutDeviceCopyScratch();
+    std::vector<OrtValue>& device_feeds = scratch.feeds;
+    std::vector<OrtValue>& device_fetches = scratch.fetches;
 
     if (device_copy_checks.input_copy_needed == DeviceCopyCheck::Copy) {
       const auto& feed_copy_info = feeds_fetches_manager.GetFeedsDeviceCopyInfo();
@@ -496,6 +505,8 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
     if (device_copy_checks.output_copy_needed == DeviceCopyCheck::Copy) {
       ORT_RETURN_IF_ERROR(CopyOutputsAcrossDevices(session_state, *p_fetches, fetches, fetch_copy_info));
     }
+
+    feeds_fetches_manager.ReturnDeviceCopyScratch(std::move(scratch));
   }
 
   return Status::OK();
@@ -505,14 +516,16 @@ common::Status ExecuteGraph(const SessionState& session_state,
                             FeedsFetchesManager& feeds_fetches_manager,
                             const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                             ExecutionMode execution_mode, const bool& terminate_flag,
-                            const logging::Logger& logger, bool only_execute_path_to_fetches) {
+                            const logging::Logger& logger, bool only_execute_path_to_fetches,
+                            const OrtRunOptions* run_options) {
   ORT_RETURN_IF_ERROR(utils::InitializeFeedFetchCopyInfo(session_state, feeds_fetches_manager));
 
   // finalize the copy info using the provided feeds and fetches. will update device_copy_checks in the background
   FinalizeFeedFetchCopyInfo(feeds_fetches_manager, feeds, fetches);
 
   auto status = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {},
-                                 execution_mode, terminate_flag, logger, only_execute_path_to_fetches);
+                                 execution_mode, terminate_flag, logger, only_execute_path_to_fetches,
+                                 run_options);
 
   return status;
 }
@@ -284,6 +284,9 @@ where value of each element is the end position, or valid length of actual seque
 left-side padding, mask_index has shape (2 * batch_size), where the values are the exclusive end positions followed by
 the inclusive start positions. When unidirectional is 1, and each token only attend to previous tokens. For GPT-2, both past
 and present state are optional. Present state could appear in output even when past state is not in input.
+The key_value input is optional. When present, key and value are projected from it instead of from input (cross attention,
+like the encoder-decoder attention of a translation decoder), and its sequence length may differ from that of input.
+The unidirectional attribute is not supported together with key_value.
 )DOC";
 
   ONNX_CONTRIB_OPERATOR_SCHEMA(Attention)
@@ -300,6 +303,7 @@ and present state are optional. Present state could appear in output even when p
       .Input(2, "bias", "1D input tensor with shape (3 * hidden_size)", "T")
       .Input(3, "mask_index", "Attention mask with shape (batch_size, past_sequence_length + sequence_length) or (batch_size, sequence_length, past_sequence_length + sequence_length), or index with shape (batch_size) or (2 * batch_size).", "M", OpSchema::Optional)
       .Input(4, "past", "past state for key and value with shape (2, batch_size, num_heads, past_sequence_length, head_size).", "T", OpSchema::Optional)
+      .Input(5, "key_value", "3D input tensor with shape (batch_size, kv_sequence_length, hidden_size). When present, key and value are projected from it instead of from input (cross attention).", "T", OpSchema::Optional)
       .Output(0, "output", "3D output tensor with shape (batch_size, append_length, hidden_size)", "T")
       .Output(1, "present", "present state for key and value with shape (2, batch_size, num_heads, past_sequence_length + sequence_length, head_size)", "T", OpSchema::Optional)
       .TypeConstraint("T", {"tensor(float)", "tensor(float16)"}, "Constrain input and output types to float tensors.")
@@ -375,7 +379,8 @@ and present state are optional. Present state could appear in output even when p
       .Input(
           4,
           "weight_scale",
-          "scale of weight scale. It's a scalar, which means a per-tensor/layer quantization.",
+          "scale of quantized weight tensor. It's a scalar for per-tensor/layer quantization, "
+          "or a 1D tensor of size 3 * hidden_size for per-column quantization.",
           "T3")
       .Input(
           5,
@@ -392,7 +397,8 @@ and present state are optional. Present state could appear in output even when p
       .Input(
           7,
           "weight_zero_point",
-          "zero point of quantized weight tensor. It's a scalar, which means a per-tensor/layer quantization.",
+          "zero point of quantized weight tensor. It's a scalar, or a 1D tensor of size 3 * hidden_size "
+          "whose values are all identical.",
           "T2",
           OpSchema::Optional)
       .Input(
@@ -1283,6 +1289,26 @@ activation.)DOC")
         ONNX_NAMESPACE::convPoolShapeInference(ctx, true, false, 0, 1);
       });
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(FusedElementWise)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(R"DOC(
+Applies a chain of two or more unary element-wise functions to the input in a single pass.
+The functions are listed in execution order in the 'activations' attribute; the attributes
+of the i-th function are carried with an 'activation_<i>_' prefix (e.g. 'activation_0_alpha').)DOC")
+      .AllowUncheckedAttributes()
+      .Attr(
+          "activations",
+          "Op types of the fused element-wise functions, in execution order.",
+          AttributeProto::STRINGS)
+      .Input(0, "X", "Input tensor", "T")
+      .Output(0, "Y", "Output tensor with the same shape as X", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float)"},
+          "Constrain input and output types to float tensors.")
+      .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(FusedGemm)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -1640,6 +1666,29 @@ Matrix product that behaves like numpy.matmul: https://docs.scipy.org/doc/numpy-
         FusedMatMulShapeInference(ctx);
       });
 
+  static const char* SparseMatMul_doc = R"DOC(
+Matrix product of a 2-D input with a 2-D weight that is mostly zeros. Numerically equivalent to
+MatMul restricted to rank 2 inputs; the CPU kernel pre-packs a constant B into compressed sparse
+column form and skips the zero entries. Inserted by the optimizer for qualifying MatMul nodes,
+so there is normally no need to use it directly.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(SparseMatMul)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .Input(0, "A", "2-dimensional matrix A", "T")
+      .Input(1, "B", "2-dimensional matrix B, expected to be mostly zeros", "T")
+      .Output(0, "Y", "Matrix multiply results", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float)"},
+          "Constrain input and output types to float tensors.")
+      .SetDoc(SparseMatMul_doc)
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        ONNX_NAMESPACE::matmulShapeInference(ctx, 0, 1);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(MurmurHash3)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -2361,6 +2410,63 @@ It's an extension of Gelu. It takes the sum of input A and bias input B as the i
           "Constrain input and output types to float tensors.")
       .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
 
+  static const char* BeamSearch_ver1_doc = R"DOC(
+Beam search decoding driven by a decoder-step subgraph. The op owns the decode loop so the
+per-step session overhead of driving generation from the host API is avoided.
+
+The 'body' subgraph computes one decode step. Its inputs are:
+  (tokens, state_0, ..., state_N-1)
+where 'tokens' has shape [batch_size * num_beams, 1] (int32) and each state tensor (e.g. a
+past key/value) has batch_size * num_beams as its first dimension. Its outputs are:
+  (logits, state_out_0, ..., state_out_N-1)
+where 'logits' has shape [batch_size * num_beams, vocab_size] (float) and each state output
+matches the corresponding state input apart from dimensions that grow with the decoded length.
+The initial state values are provided as op inputs, already expanded to num_beams copies per
+batch entry. Between steps the op reorders the state outputs along their first dimension
+according to the selected beams and feeds them back in.
+
+Decoding starts from the token in 'input_ids' for each batch entry and runs until max_length
+tokens (including the start token) have been produced, or every beam has emitted eos_token_id.
+Beams that emit eos_token_id keep their score and emit pad_token_id for the remaining steps.
+length_penalty is applied when ranking the finished beams: the reported score is the
+accumulated log probability divided by generated_length^length_penalty.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(BeamSearch)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(BeamSearch_ver1_doc)
+      .Attr("body", "The decoder-step subgraph to run each iteration.", AttributeProto::GRAPH)
+      .Attr("eos_token_id", "Token that marks a beam as finished.", AttributeProto::INT)
+      .Attr("pad_token_id", "Token emitted by finished beams and used to pad the output sequences.",
+            AttributeProto::INT)
+      .Input(0, "input_ids", "Start token per batch entry with shape (batch_size, 1).", "I")
+      .Input(1, "max_length", "Scalar total sequence length to generate, including the start token.", "I")
+      .Input(2, "num_beams", "Scalar number of beams.", "I")
+      .Input(3, "length_penalty",
+             "Scalar exponent applied to the generated length when ranking finished beams. "
+             "Defaults to 1.0 if not provided.",
+             "T", OpSchema::Optional)
+      .Input(4, "initial_states",
+             "Initial decoder state tensors, each with batch_size * num_beams as its first dimension.",
+             "V", OpSchema::Variadic, false, 0)
+      .Output(0, "sequences",
+              "Generated sequences with shape (batch_size, num_beams, max_length), padded with "
+              "pad_token_id and ordered by descending score within each batch entry.",
+              "I")
+      .Output(1, "sequence_scores", "Length-penalized scores with shape (batch_size, num_beams).",
+              "T", OpSchema::Optional)
+      .TypeConstraint("T", {"tensor(float)"}, "Constrain scores to float tensors.")
+      .TypeConstraint("I", {"tensor(int32)"}, "Constrain tokens and lengths to int32 tensors.")
+      .TypeConstraint("V", OpSchema::all_tensor_types(), "All tensor types for decoder state.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        // num_beams and max_length are runtime inputs so only the element types can be inferred
+        ONNX_NAMESPACE::updateOutputElemType(ctx, 0, ONNX_NAMESPACE::TensorProto::INT32);
+        if (ctx.getNumOutputs() > 1) {
+          ONNX_NAMESPACE::updateOutputElemType(ctx, 1, ONNX_NAMESPACE::TensorProto::FLOAT);
+        }
+      });
+
   // Register the NCHWc schemas if supported by the platform.
   if (MlasNchwcGetBlockSize() > 1) {
     RegisterNchwcSchemas();
@@ -147,6 +147,91 @@ void RegisterNchwcSchemas() {
   ONNX_CONTRIB_OPERATOR_SCHEMA(GlobalAveragePool)
       .FillUsing(NchwcGlobalPoolOpSchemaGenerator);
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(Pad)
+      .SetDomain(kMSNchwcDomain)
+      .SinceVersion(1)
+      .SetDoc(R"DOC(For internal use.)DOC")
+      .Attr("pads", "", AttributeProto::INTS)
+      .Attr("value", "", AttributeProto::FLOAT, 0.0f)
+      .Input(0, "X", "", "T")
+      .Output(0, "Y", "", "T")
+      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        ONNX_NAMESPACE::propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        if (!hasNInputShapes(ctx, 1)) {
+          return;
+        }
+
+        auto input_shape = ctx.getInputType(0)->tensor_type().shape();
+        auto output_shape = ctx.getOutputType(0)->mutable_tensor_type()->mutable_shape();
+
+        auto input_rank = input_shape.dim_size();
+
+        std::vector<int64_t> pads;
+        if (!getRepeatedAttribute(ctx, "pads", pads)) {
+          return;
+        }
+        if (static_cast<size_t>(input_rank) * 2 != pads.size()) {
+          fail_shape_inference("invalid pads dimension");
+        }
+
+        for (int i = 0; i < input_rank; i++) {
+          if (pads[i] < 0 || pads[input_rank + i] < 0) {
+            fail_shape_inference("invalid pads value");
+          }
+          const auto& input_dim = input_shape.dim(i);
+          auto* output_dim = output_shape->add_dim();
+          if (input_dim.has_dim_value()) {
+            output_dim->set_dim_value(input_dim.dim_value() + pads[i] + pads[input_rank + i]);
+          }
+        }
+      });
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(Slice)
+      .SetDomain(kMSNchwcDomain)
+      .SinceVersion(1)
+      .SetDoc(R"DOC(For internal use.)DOC")
+      .Attr("starts", "", AttributeProto::INTS)
+      .Attr("ends", "", AttributeProto::INTS)
+      .Input(0, "X", "", "T")
+      .Output(0, "Y", "", "T")
+      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        ONNX_NAMESPACE::propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        if (!hasNInputShapes(ctx, 1)) {
+          return;
+        }
+
+        auto input_shape = ctx.getInputType(0)->tensor_type().shape();
+        auto output_shape = ctx.getOutputType(0)->mutable_tensor_type()->mutable_shape();
+
+        auto input_rank = input_shape.dim_size();
+
+        std::vector<int64_t> starts;
+        std::vector<int64_t> ends;
+        if (!getRepeatedAttribute(ctx, "starts", starts) ||
+            !getRepeatedAttribute(ctx, "ends", ends)) {
+          return;
+        }
+        if (static_cast<size_t>(input_rank) != starts.size() ||
+            static_cast<size_t>(input_rank) != ends.size()) {
+          fail_shape_inference("invalid starts/ends dimension");
+        }
+
+        for (int i = 0; i < input_rank; i++) {
+          if (starts[i] < 0 || ends[i] < -1) {
+            fail_shape_inference("invalid starts/ends value");
+          }
+          const auto& input_dim = input_shape.dim(i);
+          auto* output_dim = output_shape->add_dim();
+          if (input_dim.has_dim_value()) {
+            // An end of -1 selects the full extent of this dimension.
+            auto end = (ends[i] < 0) ? input_dim.dim_value() : std::min(ends[i], input_dim.dim_value());
+            output_dim->set_dim_value(end - std::min(starts[i], end));
+          }
+        }
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(Upsample)
       .SetDomain(kMSNchwcDomain)
       .SinceVersion(1)
@@ -252,6 +252,65 @@ Scale and zero point must have same shape. They must be either scalar (per tenso
         updateOutputShape(ctx, 0, input_shape);
       });
 
+  static const char* RequantizeLinear_ver1_doc = R"DOC(
+The linear requantization operator. It consumes a quantized data, the quantization parameters of the input
+and the quantization parameters of the output, and maps the data to the output quantization range in a single pass.
+It is equivalent to DequantizeLinear followed by QuantizeLinear, and is produced by fusing such a pair.
+The requantization formula is y = saturate(round((x - x_zero_point) * x_scale / y_scale) + y_zero_point).
+Scale and zero point must be scalars (per tensor quantization).)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(RequantizeLinear)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .Input(
+          0,
+          "x",
+          "N-D quantized Input tensor to be re-quantized.",
+          "T1")
+      .Input(
+          1,
+          "x_scale",
+          "Scale for input 'x'. It must be a scalar, which means a per-tensor quantization.",
+          "tensor(float)")
+      .Input(
+          2,
+          "x_zero_point",
+          "Zero point for input 'x'. It must be a scalar, which means a per-tensor quantization.",
+          "T1")
+      .Input(
+          3,
+          "y_scale",
+          "Scale for output 'y'. It must be a scalar, which means a per-tensor quantization.",
+          "tensor(float)")
+      .Input(
+          4,
+          "y_zero_point",
+          "Zero point for output 'y'. It must be a scalar, which means a per-tensor quantization.",
+          "T2")
+      .Output(
+          0,
+          "y",
+          "N-D re-quantized output tensor. It has same shape as input 'x'.",
+          "T2")
+      .TypeConstraint(
+          "T1",
+          {"tensor(int8)", "tensor(uint8)"},
+          "Constrain 'x' and 'x_zero_point' to 8-bit integer tensors.")
+      .TypeConstraint(
+          "T2",
+          {"tensor(int8)", "tensor(uint8)"},
+          "Constrain 'y_zero_point' and 'y' to 8-bit integer tensors.")
+      .SetDoc(RequantizeLinear_ver1_doc)
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 4, 0);
+
+        if (!hasInputShape(ctx, 0))
+          return;
+
+        auto& input_shape = getInputShape(ctx, 0);
+        updateOutputShape(ctx, 0, input_shape);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(ReduceSumInteger)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -440,6 +499,24 @@ C (int32) = (A - A_zero_point) * (B - B_zero_point)
       .FillUsing(QLinearMathDocGenerator("multiplication",
                                          "C = ((A - A_zero_point) * (B - B_zero_point)) * (A_scale * B_scale)/C_scale + C_zero_point"));
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearSub)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .FillUsing(QLinearMathDocGenerator("subtraction",
+                                         "C = (A_scale * (A - A_zero_point) - B_scale * (B - B_zero_point))/C_scale + C_zero_point"));
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearMin)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .FillUsing(QLinearMathDocGenerator("minimum",
+                                         "C = min(A_scale * (A - A_zero_point), B_scale * (B - B_zero_point))/C_scale + C_zero_point"));
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearMax)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .FillUsing(QLinearMathDocGenerator("maximum",
+                                         "C = max(A_scale * (A - A_zero_point), B_scale * (B - B_zero_point))/C_scale + C_zero_point"));
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearReduceMean)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -751,6 +828,109 @@ Wwhere the function `Sigmoid(x) = 1 / (1 + exp(-x))` )DOC";
           "Constrain input and output types to 8 bit tensors.")
       .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
 
+  const char* MatMulInt4Doc_ver1 = R"DOC(
+MatMulInt4 is a MatMul with the weight matrix stored in block-wise quantized int4 form.
+The weight is stored transposed: input B holds N rows, one per output column, each row
+packing ceil(K / block_size) blocks of block_size 4-bit values (two per byte, lower
+nibble first), and input scales holds one float scale per block. A stored nibble q
+dequantizes to (q - 8) * scale. The activations stay float: the kernel dequantizes the
+weights and computes Y = A x dequantize(B), so only the int4 data and the scales are
+read from memory.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(MatMulInt4)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(MatMulInt4Doc_ver1)
+      .Attr("K", "Size of the shared dimension of the multiplication.", AttributeProto::INT)
+      .Attr("N", "Number of columns of the (K, N) logical weight matrix.", AttributeProto::INT)
+      .Attr("block_size",
+            "Number of weight values sharing one scale. Must be a power of two and at least 16.",
+            AttributeProto::INT,
+            static_cast<int64_t>(32))
+      .Input(0, "A", "N-dimensional input tensor with shape (..., K)", "T1")
+      .Input(1, "B",
+             "Block-wise quantized weight with shape (N, ceil(K / block_size) * block_size / 2), "
+             "two int4 values per byte.",
+             "T2")
+      .Input(2, "scales", "Quantization scales with shape (N, ceil(K / block_size)).", "T1")
+      .Output(0, "Y", "N-dimensional output tensor with shape (..., N)", "T1")
+      .TypeConstraint("T1", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+      .TypeConstraint("T2", {"tensor(uint8)"}, "Constrain quantized weight type to uint8 tensors.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        ONNX_NAMESPACE::propagateElemTypeFromInputToOutput(ctx, 0, 0);
+
+        auto N = ctx.getAttribute("N");
+        if (!hasInputShape(ctx, 0) || nullptr == N) {
+          return;
+        }
+
+        ONNX_NAMESPACE::TensorShapeProto output_shape(ctx.getInputType(0)->tensor_type().shape());
+        if (output_shape.dim_size() < 1) {
+          fail_shape_inference("Input A must be at least 1-dimensional.");
+        }
+        output_shape.mutable_dim(output_shape.dim_size() - 1)->set_dim_value(N->i());
+        updateOutputShape(ctx, 0, output_shape);
+      });
+
+  const char* QLinearTanhDoc_ver1 = R"DOC(
+QLinearTanh takes quantized input data (Tensor), and quantize parameter for output, and produces one output data
+(Tensor<T>) where the function `f(x) = quantize(Tanh(dequantize(x)))`, is applied to the data tensor elementwise.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearTanh)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(QLinearTanhDoc_ver1)
+      .Input(0, "X", "Input tensor", "T")
+      .Input(1, "X_scale",
+             "Input X's scale. It's a scalar, which means a per-tensor/layer quantization.",
+             "tensor(float)")
+      .Input(2, "X_zero_point",
+             "Input X's zero point. Default value is 0 if it's not specified. It's a scalar, which means a per-tensor/layer quantization.",
+             "T", OpSchema::Optional)
+      .Input(3, "Y_scale",
+             "Output Y's scale. It's a scalar, which means a per-tensor/layer quantization.",
+             "tensor(float)")
+      .Input(4, "Y_zero_point",
+             "Output Y's zero point. Default value is 0 if it's not specified. It's a scalar, which means a per-tensor/layer quantization.",
+             "T", OpSchema::Optional)
+      .Output(0, "Y", "Output tensor", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(uint8)", "tensor(int8)"},
+          "Constrain input and output types to 8 bit tensors.")
+      .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
+
+  const char* QLinearGeluDoc_ver1 = R"DOC(
+QLinearGelu takes quantized input data (Tensor), and quantize parameter for output, and produces one output data
+(Tensor<T>) where the function `f(x) = quantize(Gelu(dequantize(x)))`, is applied to the data tensor elementwise.
+Where the function `Gelu(x) = 0.5 * x * (1 + erf(x / sqrt(2)))` )DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearGelu)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(QLinearGeluDoc_ver1)
+      .Input(0, "X", "Input tensor", "T")
+      .Input(1, "X_scale",
+             "Input X's scale. It's a scalar, which means a per-tensor/layer quantization.",
+             "tensor(float)")
+      .Input(2, "X_zero_point",
+             "Input X's zero point. Default value is 0 if it's not specified. It's a scalar, which means a per-tensor/layer quantization.",
+             "T", OpSchema::Optional)
+      .Input(3, "Y_scale",
+             "Output Y's scale. It's a scalar, which means a per-tensor/layer quantization.",
+             "tensor(float)")
+      .Input(4, "Y_zero_point",
+             "Output Y's zero point. Default value is 0 if it's not specified. It's a scalar, which means a per-tensor/layer quantization.",
+             "T", OpSchema::Optional)
+      .Output(0, "Y", "Output tensor", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(uint8)", "tensor(int8)"},
+          "Constrain input and output types to 8 bit tensors.")
+      .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(DynamicQuantizeLSTM)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
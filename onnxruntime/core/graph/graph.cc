@@ -622,7 +622,7 @@ Status Node::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Node& fbs_n
         subgraphs_.push_back(std::move(subgraph));
       }
 
-      AddAttribute(attr_proto.name(), attr_proto);
+      AddAttribute(attr_proto.name(), std::move(attr_proto));
     }
   }
 
@@ -673,6 +673,17 @@ void Node::Init(const std::string& name,
                 const std::vector<NodeArg*>& output_args,
                 const NodeAttributes* attributes,
                 const std::string& domain) {
+  Init(name, op_type, description, input_args, output_args,
+       attributes != nullptr ? NodeAttributes{*attributes} : NodeAttributes{}, domain);
+}
+
+void Node::Init(const std::string& name,
+                const std::string& op_type,
+                const std::string& description,
+                const std::vector<NodeArg*>& input_args,
+                const std::vector<NodeArg*>& output_args,
+                NodeAttributes&& attributes,
+                const std::string& domain) {
   name_ = name;
   op_type_ = op_type;
   description_ = description;
@@ -689,8 +700,8 @@ void Node::Init(const std::string& name,
   // information.
   definitions_.input_arg_count.assign(input_args.size(), 1);
 
-  if (attributes) {
-    attributes_ = *attributes;
+  if (!attributes.empty()) {
+    attributes_ = std::move(attributes);
 
     for (auto& name_to_attr : attributes_) {
       if (utils::HasGraph(name_to_attr.second)) {
@@ -706,14 +717,14 @@ void Node::Init(const std::string& name,
 
 Node::Definitions& Node::MutableDefinitions() noexcept {
   // someone fetching these is going to change something
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   return definitions_;
 }
 
 Node::Relationships& Node::MutableRelationships() noexcept {
   // someone fetching these is going to change something
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   return relationships_;
 }
@@ -734,14 +745,20 @@ void Node::CreateSubgraph(const std::string& attr_name) {
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 void Node::AddAttribute(const std::string& attr_name, const AttributeProto& value) {
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   attributes_[attr_name] = value;
 }
 
+void Node::AddAttribute(const std::string& attr_name, AttributeProto&& value) {
+  graph_->SetGraphResolveNeeded(*this);
+  graph_->SetGraphProtoSyncNeeded();
+  attributes_[attr_name] = std::move(value);
+}
+
 #define ADD_BASIC_ATTR_IMPL(type, enumType, field)                           \
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
-    graph_->SetGraphResolveNeeded();                                         \
+    graph_->SetGraphResolveNeeded(*this);                                    \
     graph_->SetGraphProtoSyncNeeded();                                       \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
@@ -752,7 +769,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
 
 #define ADD_ATTR_IMPL(type, enumType, field)                                 \
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
-    graph_->SetGraphResolveNeeded();                                         \
+    graph_->SetGraphResolveNeeded(*this);                                    \
     graph_->SetGraphProtoSyncNeeded();                                       \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
@@ -764,7 +781,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
 #define ADD_LIST_ATTR_IMPL(type, enumType, field)            \
   void Node::AddAttribute(const std::string& attr_name,      \
                           const std::vector<type>& values) { \
-    graph_->SetGraphResolveNeeded();                         \
+    graph_->SetGraphResolveNeeded(*this);                    \
     graph_->SetGraphProtoSyncNeeded();                       \
     AttributeProto a;                                        \
     a.set_name(attr_name);                                   \
@@ -776,7 +793,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
   };
 
 void Node::AddAttribute(const std::string& attr_name, const GraphProto& value) {
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   AttributeProto a;
   a.set_name(attr_name);
@@ -804,7 +821,7 @@ ADD_LIST_ATTR_IMPL(SparseTensorProto, AttributeProto_AttributeType::AttributePro
 
 #if !defined(ORT_MINIMAL_BUILD)
 bool Node::ClearAttribute(const std::string& attr_name) {
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   return attributes_.erase(attr_name) > 0;
 }
@@ -858,7 +875,7 @@ Status Node::UpdateInputArgCount() {
     // of the operator.
     input_arg_count.push_back(arg_count_left);
 
-    graph_->SetGraphResolveNeeded();
+    graph_->SetGraphResolveNeeded(*this);
     graph_->SetGraphProtoSyncNeeded();
   }
 
@@ -2277,10 +2294,37 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
   // and need to call Resolve
   lsc.output_names.insert(outer_scope_node_arg_names_.cbegin(), outer_scope_node_arg_names_.cend());
 
+  // when limited to changed nodes, inference of a node may update its output NodeArgs, so any
+  // downstream consumer of those must be re-inferred as well.
+  const bool changed_nodes_only = options.reinfer_changed_nodes_only && !all_nodes_changed_snapshot_;
+  std::unordered_set<std::string> updated_node_args;
+
   for (auto node_index : nodes_in_topological_order_) {
     // Node verification.
     auto& node = *GetNode(node_index);
 
+    if (changed_nodes_only) {
+      // a node containing a subgraph is always processed, as inferencing recurses into the subgraph
+      // which may consume values from this level that changed.
+      bool needs_inference = node.ContainsSubgraph() || changed_nodes_snapshot_.count(node_index) != 0;
+      if (!needs_inference) {
+        for (const auto* input_def : node.InputDefs()) {
+          if (input_def->Exists() && updated_node_args.count(input_def->Name()) != 0) {
+            needs_inference = true;
+            break;
+          }
+        }
+      }
+
+      if (!needs_inference) {
+        // unchanged, and inputs unchanged. outputs keep their existing type/shape info.
+        for (const auto* output_def : node.OutputDefs()) {
+          lsc.output_names.insert(output_def->Name());
+        }
+        continue;
+      }
+    }
+
     NodeProto node_proto;
     node.ToProto(node_proto);
     auto& node_name = node.Name();
@@ -2352,6 +2396,9 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
     // Accumulate output names of the iterated Node
     for (auto& output_name : node_proto.output()) {
       lsc.output_names.insert(output_name);
+      if (changed_nodes_only) {
+        updated_node_args.insert(output_name);
+      }
     }
   }
 
@@ -2486,6 +2533,16 @@ Status Graph::Resolve(const ResolveOptions& options) {
     return Status::OK();
   }
 
+  // snapshot the per-node change tracking before anything else. resolving rebuilds the node
+  // relationships, which records every node as changed, so type/shape inferencing uses the
+  // snapshot to see only the changes made since the previous Resolve.
+  auto snapshot_func = [](Graph& graph) {
+    graph.changed_nodes_snapshot_ = graph.changed_nodes_;
+    graph.all_nodes_changed_snapshot_ = graph.all_nodes_changed_;
+    return Status::OK();
+  };
+  ORT_RETURN_IF_ERROR(ForThisAndAllSubgraphs(all_subgraphs, snapshot_func));
+
   // init all graph/subgraphs. non-recursive.
   auto init_func = [](Graph& graph) { return graph.InitInputsInitializersOutputs(); };
   ORT_RETURN_IF_ERROR(ForThisAndAllSubgraphs(all_subgraphs, init_func));
@@ -2514,6 +2571,12 @@ Status Graph::Resolve(const ResolveOptions& options) {
             graph.CleanUnusedInitializers(options.initializer_names_to_preserve);
             graph.GraphResolveNeeded(false);
 
+            // everything is consistent again, so restart the change tracking
+            graph.changed_nodes_.clear();
+            graph.all_nodes_changed_ = false;
+            graph.changed_nodes_snapshot_.clear();
+            graph.all_nodes_changed_snapshot_ = false;
+
             // if we are resolving immediately after loading from a GraphProto, we don't need to
             // do a proto sync
             if (options.no_proto_sync_required) {
@@ -2767,7 +2830,7 @@ Node& Graph::AddNode(const NodeProto& node_proto,
                  node_proto.doc_string(),
                  input_defs,
                  output_defs,
-                 &attributes,
+                 std::move(attributes),
                  node_proto.domain());
 }
 
@@ -2935,6 +2998,35 @@ Node& Graph::AddNode(const std::string& name,
   return *node;
 }
 
+Node& Graph::AddNode(const std::string& name,
+                     const std::string& op_type,
+                     const std::string& description,
+                     const std::vector<NodeArg*>& input_args,
+                     const std::vector<NodeArg*>& output_args,
+                     NodeAttributes&& attributes,
+                     const std::string& domain) {
+  std::vector<NodeArg*> inputs;
+  std::vector<NodeArg*> outputs;
+  inputs.resize(input_args.size());
+  outputs.resize(output_args.size());
+  int i = 0;
+  for (auto input_arg : input_args) {
+    inputs[i++] = &GetOrCreateNodeArg(input_arg->Name(), input_arg->TypeAsProto());
+  }
+  i = 0;
+  for (auto output_arg : output_args) {
+    outputs[i++] = &GetOrCreateNodeArg(output_arg->Name(), output_arg->TypeAsProto());
+  }
+
+  const gsl::not_null<Node*> node = AllocateNode();
+  node->Init(name, op_type, description, inputs, outputs, std::move(attributes), domain);
+  if (0 != op_type.compare(kNoOp)) {
+    GraphProtoSyncNeeded(true);
+  }
+
+  return *node;
+}
+
 bool Graph::RemoveNode(NodeIndex p_index) {
   auto node = GetNode(p_index);
   if (nullptr == node) {
@@ -3308,7 +3400,7 @@ gsl::not_null<Node*> Graph::AllocateNode() {
 
   nodes_.push_back(std::move(new_node));
   ++num_of_nodes_;
-  GraphResolveNeeded(true);
+  SetGraphResolveNeeded(*node);
 
   return gsl::not_null<Node*>{node};
 }
@@ -3324,7 +3416,9 @@ bool Graph::ReleaseNode(NodeIndex index) {
     nodes_[index] = nullptr;
     --num_of_nodes_;
     GraphProtoSyncNeeded(true);
-    GraphResolveNeeded(true);
+    // the caller must have disconnected the node first, which recorded any affected
+    // downstream nodes as changed, so this change needs no node level tracking
+    graph_resolve_needed_ = true;
   }
 
   return true;
@@ -8,6 +8,12 @@
 #include "graph_flatbuffers_utils.h"
 #include "flatbuffers/flatbuffers.h"
 
+#if defined(ORT_FORMAT_COMPRESSION)
+#include <atomic>
+#include <thread>
+#include <zlib.h>
+#endif
+
 using namespace ONNX_NAMESPACE;
 using namespace ::onnxruntime::common;
 using namespace ::onnxruntime::experimental;
@@ -26,6 +32,61 @@ SaveDims(flatbuffers::FlatBufferBuilder& builder, const DimsFieldType& dims) {
   return builder.CreateVector(dims_data);
 }
 
+#if defined(ORT_FORMAT_COMPRESSION)
+// Initializer data below this size is stored uncompressed. The per-block framing
+// and deflate overhead isn't worth it for small tensors.
+static constexpr size_t kCompressionMinBytes = 32 * 1024;
+
+// Uncompressed bytes per independently compressed block. Blocks bound the
+// scratch memory needed on both sides and let load decompress a large
+// initializer across several threads.
+static constexpr size_t kCompressionBlockBytes = 1024 * 1024;
+
+// Deflate the initializer data into independently decompressible blocks.
+// fbs_compressed_data is left untouched (null) when compression does not make
+// the data meaningfully smaller, in which case the caller should store the
+// data uncompressed.
+static Status CompressRawData(flatbuffers::FlatBufferBuilder& builder,
+                              const uint8_t* data, size_t size,
+                              flatbuffers::Offset<fbs::CompressedData>& fbs_compressed_data) {
+  const size_t num_blocks = (size + kCompressionBlockBytes - 1) / kCompressionBlockBytes;
+
+  // compress into scratch buffers first so nothing is written to the builder
+  // if we decide to keep the data uncompressed
+  std::vector<std::vector<uint8_t>> compressed_blocks(num_blocks);
+  size_t total_compressed_bytes = 0;
+  for (size_t i = 0; i < num_blocks; ++i) {
+    const size_t block_offset = i * kCompressionBlockBytes;
+    const auto block_bytes = static_cast<uLong>(std::min(kCompressionBlockBytes, size - block_offset));
+    uLongf compressed_bytes = compressBound(block_bytes);
+    auto& compressed = compressed_blocks[i];
+    compressed.resize(compressed_bytes);
+    const int zlib_error = compress2(compressed.data(), &compressed_bytes,
+                                     data + block_offset, block_bytes, Z_BEST_COMPRESSION);
+    ORT_RETURN_IF_NOT(zlib_error == Z_OK, "Failed to deflate initializer data. zlib error: ", zlib_error);
+    compressed.resize(compressed_bytes);
+    total_compressed_bytes += compressed_bytes;
+  }
+
+  // require at least a 10% saving so marginally compressible data doesn't pay
+  // the decompression cost on every load
+  if (total_compressed_bytes >= size - size / 10) {
+    return Status::OK();
+  }
+
+  std::vector<flatbuffers::Offset<fbs::CompressedBlock>> fbs_blocks;
+  fbs_blocks.reserve(num_blocks);
+  for (const auto& compressed : compressed_blocks) {
+    fbs_blocks.push_back(fbs::CreateCompressedBlockDirect(builder, &compressed));
+  }
+
+  fbs_compressed_data = fbs::CreateCompressedData(builder, fbs::CompressionType::DEFLATE,
+                                                  size, kCompressionBlockBytes,
+                                                  builder.CreateVector(fbs_blocks));
+  return Status::OK();
+}
+#endif  // defined(ORT_FORMAT_COMPRESSION)
+
 Status SaveInitializerOrtFormat(flatbuffers::FlatBufferBuilder& builder,
                                 const TensorProto& initializer,
                                 flatbuffers::Offset<fbs::Tensor>& fbs_tensor) {
@@ -35,6 +96,7 @@ Status SaveInitializerOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 
   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> string_data;
   flatbuffers::Offset<flatbuffers::Vector<uint8_t>> raw_data;
+  flatbuffers::Offset<fbs::CompressedData> compressed_raw_data;
 
   auto src_type = initializer.data_type();
   const bool has_string_data = src_type == ONNX_NAMESPACE::TensorProto_DataType_STRING;
@@ -47,7 +109,13 @@ Status SaveInitializerOrtFormat(flatbuffers::FlatBufferBuilder& builder,
     size_t tensor_byte_size = 0;
     ORT_RETURN_IF_ERROR(
         onnxruntime::utils::UnpackInitializerData(initializer, unpacked_tensor, tensor_byte_size));
-    raw_data = builder.CreateVector(unpacked_tensor.get(), tensor_byte_size);
+#if defined(ORT_FORMAT_COMPRESSION)
+    if (tensor_byte_size >= kCompressionMinBytes) {
+      ORT_RETURN_IF_ERROR(CompressRawData(builder, unpacked_tensor.get(), tensor_byte_size, compressed_raw_data));
+    }
+    if (compressed_raw_data.IsNull())
+#endif
+      raw_data = builder.CreateVector(unpacked_tensor.get(), tensor_byte_size);
   }
 
   fbs::TensorBuilder tb(builder);
@@ -57,6 +125,8 @@ Status SaveInitializerOrtFormat(flatbuffers::FlatBufferBuilder& builder,
   tb.add_data_type(static_cast<fbs::TensorDataType>(src_type));
   if (has_string_data)
     tb.add_string_data(string_data);
+  else if (!compressed_raw_data.IsNull())
+    tb.add_compressed_raw_data(compressed_raw_data);
   else
     tb.add_raw_data(raw_data);
   fbs_tensor = tb.Finish();
@@ -174,6 +244,89 @@ Status SaveAttributeOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 
+// Decompress block-framed initializer data into raw_data.
+// In builds without compression support this fails so that a compressed model
+// produces a clear error instead of a tensor with missing data.
+static Status DecompressRawData(const fbs::CompressedData& fbs_compressed_data, std::string& raw_data) {
+#if defined(ORT_FORMAT_COMPRESSION)
+  ORT_RETURN_IF(fbs_compressed_data.compression_type() != fbs::CompressionType::DEFLATE,
+                "Unsupported initializer compression type: ",
+                fbs::EnumNameCompressionType(fbs_compressed_data.compression_type()),
+                ". Invalid ORT format model.");
+
+  const auto* fbs_blocks = fbs_compressed_data.blocks();
+  ORT_RETURN_IF(nullptr == fbs_blocks, "Missing compressed data blocks for initializer. Invalid ORT format model.");
+
+  const auto uncompressed_length = static_cast<size_t>(fbs_compressed_data.uncompressed_length());
+  const auto block_length = static_cast<size_t>(fbs_compressed_data.block_length());
+  const size_t num_blocks = fbs_blocks->size();
+  ORT_RETURN_IF(block_length == 0 || num_blocks == 0 ||
+                    num_blocks != (uncompressed_length + block_length - 1) / block_length,
+                "Inconsistent compressed data framing for initializer. Invalid ORT format model.");
+
+  raw_data.resize(uncompressed_length);
+  auto* dst = reinterpret_cast<uint8_t*>(&raw_data[0]);
+
+  // the blocks are independent deflate streams, so a large initializer can be
+  // inflated across a few threads. The session thread pools don't exist while
+  // the model is being deserialized, so short-lived std::threads are used.
+  std::atomic<size_t> next_block{0};
+  auto inflate_blocks = [&](Status& status) {
+    while (true) {
+      const size_t i = next_block.fetch_add(1);
+      if (i >= num_blocks)
+        break;
+
+      const auto* fbs_block_data = fbs_blocks->Get(static_cast<flatbuffers::uoffset_t>(i))->data();
+      if (nullptr == fbs_block_data) {
+        status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                                 "Missing compressed data block for initializer. Invalid ORT format model.");
+        break;
+      }
+
+      const size_t block_offset = i * block_length;
+      const auto expected_bytes = static_cast<uLongf>(std::min(block_length, uncompressed_length - block_offset));
+      uLongf uncompressed_bytes = expected_bytes;
+      const int zlib_error = uncompress(dst + block_offset, &uncompressed_bytes,
+                                        fbs_block_data->Data(), fbs_block_data->size());
+      if (zlib_error != Z_OK || uncompressed_bytes != expected_bytes) {
+        status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                                 "Failed to inflate initializer data block. zlib error: ", zlib_error,
+                                 ". Invalid ORT format model.");
+        break;
+      }
+    }
+  };
+
+  const size_t num_threads = std::min(num_blocks, static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+  std::vector<Status> statuses(num_threads);
+  if (num_threads == 1) {
+    inflate_blocks(statuses[0]);
+  } else {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&, t]() { inflate_blocks(statuses[t]); });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  for (const auto& status : statuses) {
+    ORT_RETURN_IF_ERROR(status);
+  }
+
+  return Status::OK();
+#else
+  ORT_UNUSED_PARAMETER(fbs_compressed_data);
+  ORT_UNUSED_PARAMETER(raw_data);
+  return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                         "Initializer data is compressed but this build does not include "
+                         "compressed ORT format model support.");
+#endif  // defined(ORT_FORMAT_COMPRESSION)
+}
+
 Status LoadInitializerOrtFormat(const fbs::Tensor& fbs_tensor,
                                 TensorProto& initializer) {
   initializer.Clear();
@@ -197,10 +350,15 @@ Status LoadInitializerOrtFormat(const fbs::Tensor& fbs_tensor,
     }
   } else {
     const auto* fbs_raw_data = fbs_tensor.raw_data();
-    ORT_RETURN_IF(nullptr == fbs_raw_data, "Missing raw data for initializer. Invalid ORT format model.");
-
-    // fbs_raw_data is uint8_t vector, so the size is byte size
-    initializer.set_raw_data(fbs_raw_data->Data(), fbs_raw_data->size());
+    if (fbs_raw_data) {
+      // fbs_raw_data is uint8_t vector, so the size is byte size
+      initializer.set_raw_data(fbs_raw_data->Data(), fbs_raw_data->size());
+    } else {
+      const auto* fbs_compressed_raw_data = fbs_tensor.compressed_raw_data();
+      ORT_RETURN_IF(nullptr == fbs_compressed_raw_data,
+                    "Missing raw data for initializer. Invalid ORT format model.");
+      ORT_RETURN_IF_ERROR(DecompressRawData(*fbs_compressed_raw_data, *initializer.mutable_raw_data()));
+    }
   }
 
   return Status::OK();
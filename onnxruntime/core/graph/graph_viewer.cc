@@ -42,6 +42,54 @@ struct PriorityNodeCompare {
 };
 #endif
 
+// The cached orderings live on the Graph but are defined here so the comparators stay next to
+// the GraphViewer construction they were written for.
+const std::vector<NodeIndex>& Graph::GetCachedTopologicalOrder() const {
+  std::lock_guard<OrtMutex> lock(cached_topo_order_lock_);
+  if (cached_topo_order_epoch_ != mutation_epoch_) {
+    cached_topo_order_.clear();
+
+    std::vector<const Node*> leaf_nodes;
+    for (const auto& node : Nodes()) {
+      // This is a leaf node (without any output node)
+      if (node.OutputNodesBegin() == node.OutputNodesEnd()) {
+        leaf_nodes.push_back(&node);
+      }
+    }
+
+    ReverseDFSFrom(
+        leaf_nodes,
+        nullptr,
+        [this](const Node* n) {
+          cached_topo_order_.push_back(n->Index());
+        },
+        NodeCompare());
+
+    cached_topo_order_epoch_ = mutation_epoch_;
+  }
+
+  return cached_topo_order_;
+}
+
+#if !defined(ORT_MINIMAL_BUILD)
+const std::vector<NodeIndex>& Graph::GetCachedTopologicalOrderWithPriority() const {
+  std::lock_guard<OrtMutex> lock(cached_topo_order_lock_);
+  if (cached_topo_order_with_priority_epoch_ != mutation_epoch_) {
+    cached_topo_order_with_priority_.clear();
+
+    KahnsTopologicalSort(
+        [this](const Node* n) {
+          cached_topo_order_with_priority_.push_back(n->Index());
+        },
+        PriorityNodeCompare());
+
+    cached_topo_order_with_priority_epoch_ = mutation_epoch_;
+  }
+
+  return cached_topo_order_with_priority_;
+}
+#endif
+
 GraphViewer::GraphViewer(const Graph& graph)
     : GraphViewer(graph, nullptr) {
 }
@@ -57,32 +105,19 @@ GraphViewer::GraphViewer(const Graph& graph, const IndexedSubGraph* filter_info)
           filter_info ? [this](NodeIndex idx) { return filtered_node_indices_.count(idx) == 0; }
                       : ConstGraphNodes::NodeFilterFunc(nullptr))},
       filter_info_{filter_info} {
-  std::vector<const Node*> leaf_nodes;
   for (auto& node : graph_->Nodes()) {
-    // This is a leaf node (without any output node)
-    if (node.OutputNodesBegin() == node.OutputNodesEnd()) {
-      leaf_nodes.push_back(&node);
-    }
     // This is a root node (without any input node)
     if (node.InputEdgesBegin() == node.InputEdgesEnd()) {
       root_nodes_.push_back(node.Index());
     }
   }
 
-  graph.ReverseDFSFrom(
-      leaf_nodes,
-      nullptr,
-      [this](const Node* n) {
-        nodes_in_topological_order_.push_back(n->Index());
-      },
-      NodeCompare());
+  // both orderings are cached on the Graph, so constructing many viewers over an unchanged
+  // graph (e.g. one per GetCapability call during partitioning) sorts it once
+  nodes_in_topological_order_ = graph.GetCachedTopologicalOrder();
 
 #if !defined(ORT_MINIMAL_BUILD)
-  graph.KahnsTopologicalSort(
-      [this](const Node* n) {
-        nodes_in_topological_order_with_priority_.push_back(n->Index());
-      },
-      PriorityNodeCompare());
+  nodes_in_topological_order_with_priority_ = graph.GetCachedTopologicalOrderWithPriority();
 #endif
 
   if (filter_info_) {
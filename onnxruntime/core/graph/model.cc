@@ -14,6 +14,7 @@
 // 'type' : forcing value to bool 'true' or 'false' (performance warning)
 #pragma warning(disable : 4800)
 #endif
+#include <google/protobuf/arena.h>
 #include <google/protobuf/io/coded_stream.h>
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -48,11 +49,13 @@ Model::Model(const std::string& graph_name,
              const std::vector<ONNX_NAMESPACE::FunctionProto>&,
              const logging::Logger& logger)
     : model_path_(Path::Parse(model_path)) {
-  model_proto_.set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
-  model_proto_.mutable_graph()->set_name(graph_name);
+  model_proto_owned_ = onnxruntime::make_unique<ModelProto>();
+  model_proto_ = model_proto_owned_.get();
+  model_proto_->set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
+  model_proto_->mutable_graph()->set_name(graph_name);
   model_metadata_ = model_metadata;
   for (auto& metadata : model_metadata_) {
-    const gsl::not_null<StringStringEntryProto*> prop{model_proto_.add_metadata_props()};
+    const gsl::not_null<StringStringEntryProto*> prop{model_proto_->add_metadata_props()};
     prop->set_key(metadata.first);
     prop->set_value(metadata.second);
   }
@@ -77,14 +80,14 @@ Model::Model(const std::string& graph_name,
     model_load_utils::ValidateOpsetForDomain(
         domain_to_version_static, logger, allow_released_opsets_only,
         domain.first, domain.second);
-    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_.add_opset_import()};
+    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_->add_opset_import()};
     opset_id_proto->set_domain(domain.first);
     opset_id_proto->set_version(domain.second);
   }
 
   // need to call private ctor so can't use make_shared
   GSL_SUPPRESS(r .11)
-  graph_.reset(new Graph(*this, model_proto_.mutable_graph(), *p_domain_to_version, IrVersion(), schema_registry,
+  graph_.reset(new Graph(*this, model_proto_->mutable_graph(), *p_domain_to_version, IrVersion(), schema_registry,
                          logger));
 }
 
@@ -96,22 +99,37 @@ Model::Model(const ModelProto& model_proto, const PathString& model_path,
 Model::Model(ModelProto&& model_proto, const PathString& model_path, const IOnnxRuntimeOpSchemaRegistryList* local_registries,
              const logging::Logger& logger)
     : model_path_(Path::Parse(model_path)) {
-  if (!utils::HasGraph(model_proto)) {
+  model_proto_owned_ = onnxruntime::make_unique<ModelProto>(std::move(model_proto));
+  model_proto_ = model_proto_owned_.get();
+  Initialize(local_registries, logger);
+}
+
+Model::Model(std::unique_ptr<google::protobuf::Arena> proto_arena, ModelProto& model_proto,
+             const PathString& model_path, const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+             const logging::Logger& logger)
+    : model_path_(Path::Parse(model_path)) {
+  proto_arena_ = std::move(proto_arena);
+  model_proto_ = &model_proto;
+  Initialize(local_registries, logger);
+}
+
+void Model::Initialize(const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                       const logging::Logger& logger) {
+  if (!utils::HasGraph(*model_proto_)) {
     ORT_THROW("ModelProto does not have a graph.");
   }
 
-  if (model_proto.opset_import_size() == 0) {
+  if (model_proto_->opset_import_size() == 0) {
     ORT_THROW(
         "Missing opset in the model. All ModelProtos MUST have at least one entry that"
         " specifies which version of the ONNX OperatorSet is being imported.");
   }
 
-  if (!model_proto.has_ir_version() || model_proto.ir_version() > ONNX_NAMESPACE::Version::IR_VERSION) {
+  if (!model_proto_->has_ir_version() || model_proto_->ir_version() > ONNX_NAMESPACE::Version::IR_VERSION) {
     ORT_THROW("Unknown model file format version.");
   }
 
-  model_proto_ = std::move(model_proto);
-  for (auto& prop : model_proto_.metadata_props()) {
+  for (auto& prop : model_proto_->metadata_props()) {
     model_metadata_[prop.key()] = prop.value();
   }
 
@@ -128,7 +146,7 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path, const IOnnx
       schema_registry->GetLastReleasedOpsetVersions(false);
 
   std::unordered_map<std::string, int> domain_to_version;
-  for (auto& opSet : model_proto_.opset_import()) {
+  for (auto& opSet : model_proto_->opset_import()) {
     const auto& domain = opSet.domain();
     const auto version = gsl::narrow_cast<int>(opSet.version());
     // empty domain and 'ai.onnx' are equivalent
@@ -163,7 +181,7 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path, const IOnnx
   for (const auto& domain : domain_map) {
     if (domain_to_version.find(domain.first) == domain_to_version.end()) {
       domain_to_version[domain.first] = domain.second;
-      const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_.add_opset_import()};
+      const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_->add_opset_import()};
       opset_id_proto->set_domain(domain.first);
       opset_id_proto->set_version(domain.second);
     }
@@ -171,57 +189,57 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path, const IOnnx
 
   // create instance. need to call private ctor so can't use make_unique
   GSL_SUPPRESS(r .11)
-  graph_.reset(new Graph(*this, model_proto_.mutable_graph(), domain_to_version, IrVersion(), schema_registry, logger));
+  graph_.reset(new Graph(*this, model_proto_->mutable_graph(), domain_to_version, IrVersion(), schema_registry, logger));
 }
 
 Version Model::IrVersion() const {
-  if (utils::HasIrVersion(model_proto_)) {
-    return model_proto_.ir_version();
+  if (utils::HasIrVersion(*model_proto_)) {
+    return model_proto_->ir_version();
   }
   return kNoVersion;
 }
 
 const std::string& Model::ProducerName() const {
-  return model_proto_.producer_name();
+  return model_proto_->producer_name();
 }
 
 void Model::SetProducerName(const std::string& producer_name) {
-  model_proto_.set_producer_name(producer_name);
+  model_proto_->set_producer_name(producer_name);
 }
 
 const std::string& Model::ProducerVersion() const {
-  return model_proto_.producer_version();
+  return model_proto_->producer_version();
 }
 
 void Model::SetProducerVersion(const std::string& producer_version) {
-  model_proto_.set_producer_version(producer_version);
+  model_proto_->set_producer_version(producer_version);
 }
 
 const std::string& Model::Domain() const {
-  return model_proto_.domain();
+  return model_proto_->domain();
 }
 
 void Model::SetDomain(const std::string& domain) {
-  model_proto_.set_domain(domain);
+  model_proto_->set_domain(domain);
 }
 
 Version Model::ModelVersion() const {
-  if (utils::HasModelVersion(model_proto_)) {
-    return model_proto_.model_version();
+  if (utils::HasModelVersion(*model_proto_)) {
+    return model_proto_->model_version();
   }
   return kNoVersion;
 }
 
 void Model::SetModelVersion(onnxruntime::Version version) {
-  model_proto_.set_model_version(version);
+  model_proto_->set_model_version(version);
 }
 
 const std::string& Model::DocString() const {
-  return model_proto_.doc_string();
+  return model_proto_->doc_string();
 }
 
 void Model::SetDocString(const std::string& doc_string) {
-  model_proto_.set_doc_string(doc_string);
+  model_proto_->set_doc_string(doc_string);
 }
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
@@ -245,7 +263,7 @@ ModelProto Model::ToProto() {
   // that returns by value and, therefore, allows us to filter
   // out dense duplicates of sparse initializers and leave the original
   // proto intact.
-  ModelProto result(model_proto_);
+  ModelProto result(*model_proto_);
   const auto& graph = *graph_;
   *(result.mutable_graph()) = graph.ToGraphProto();
   return result;
@@ -459,14 +477,19 @@ Status Model::LoadFromBytes(int count, void* p_bytes, /*out*/ std::shared_ptr<Mo
 Status Model::LoadFromBytes(int count, void* p_bytes, const PathString& model_path,
                             std::shared_ptr<Model>& p_model, const IOnnxRuntimeOpSchemaRegistryList* local_registries,
                             const logging::Logger& logger) {
-  ModelProto model_proto;
+  // parse into an arena owned by the model so the many small proto objects of a large graph are
+  // placed in its blocks instead of being individually heap allocated and later individually freed
+  auto proto_arena = onnxruntime::make_unique<google::protobuf::Arena>();
+  ModelProto* model_proto = google::protobuf::Arena::CreateMessage<ModelProto>(proto_arena.get());
 
-  auto status = LoadFromBytes(count, p_bytes, model_proto);
+  auto status = LoadFromBytes(count, p_bytes, *model_proto);
   if (!status.IsOK()) {
     return status;
   }
 
-  p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger);
+  // need to call private ctor so can't use make_shared
+  GSL_SUPPRESS(r .11)
+  p_model.reset(new Model(std::move(proto_arena), *model_proto, model_path, local_registries, logger));
 
   Graph::ResolveOptions options;
   options.no_proto_sync_required = true;
@@ -520,11 +543,16 @@ Status Model::Load(int fd, std::shared_ptr<Model>& p_model, const IOnnxRuntimeOp
 
 Status Model::Load(int fd, const PathString& model_path, std::shared_ptr<Model>& p_model,
                    const IOnnxRuntimeOpSchemaRegistryList* local_registries, const logging::Logger& logger) {
-  ModelProto model_proto;
+  // parse into an arena owned by the model so the many small proto objects of a large graph are
+  // placed in its blocks instead of being individually heap allocated and later individually freed
+  auto proto_arena = onnxruntime::make_unique<google::protobuf::Arena>();
+  ModelProto* model_proto = google::protobuf::Arena::CreateMessage<ModelProto>(proto_arena.get());
 
-  ORT_RETURN_IF_ERROR(Load(fd, model_proto));
+  ORT_RETURN_IF_ERROR(Load(fd, *model_proto));
 
-  p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger);
+  // need to call private ctor so can't use make_shared
+  GSL_SUPPRESS(r .11)
+  p_model.reset(new Model(std::move(proto_arena), *model_proto, model_path, local_registries, logger));
 
   Graph::ResolveOptions options;
   options.no_proto_sync_required = true;
@@ -552,16 +580,16 @@ Status Model::Save(Model& model, int p_fd) {
 common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
                                       flatbuffers::Offset<fbs::Model>& fbs_model) const {
   auto producer_name = experimental::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_producer_name(), model_proto_.producer_name());
+      builder, model_proto_->has_producer_name(), model_proto_->producer_name());
   auto producer_version = experimental::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_producer_version(), model_proto_.producer_version());
-  auto domain = builder.CreateSharedString(model_proto_.domain());
+      builder, model_proto_->has_producer_version(), model_proto_->producer_version());
+  auto domain = builder.CreateSharedString(model_proto_->domain());
   auto doc_string = experimental::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_doc_string(), model_proto_.doc_string());
+      builder, model_proto_->has_doc_string(), model_proto_->doc_string());
 
   std::vector<flatbuffers::Offset<fbs::OperatorSetId>> op_set_ids_vec;
-  op_set_ids_vec.reserve(model_proto_.opset_import().size());
-  for (const auto& entry : model_proto_.opset_import()) {
+  op_set_ids_vec.reserve(model_proto_->opset_import().size());
+  for (const auto& entry : model_proto_->opset_import()) {
     auto op_set_domain = builder.CreateSharedString(entry.domain());
     fbs::OperatorSetIdBuilder ob(builder);
     ob.add_domain(op_set_domain);
@@ -574,12 +602,12 @@ common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
   ORT_RETURN_IF_ERROR(graph_->SaveToOrtFormat(builder, fbs_graph));
 
   fbs::ModelBuilder mb(builder);
-  mb.add_ir_version(model_proto_.ir_version());
+  mb.add_ir_version(model_proto_->ir_version());
   mb.add_opset_import(op_set_ids);
   mb.add_producer_name(producer_name);
   mb.add_producer_version(producer_version);
   mb.add_domain(domain);
-  mb.add_model_version(model_proto_.model_version());
+  mb.add_model_version(model_proto_->model_version());
   mb.add_doc_string(doc_string);
   mb.add_graph(fbs_graph);
 
@@ -592,8 +620,16 @@ common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 Model::Model() : model_path_{} {
+#if !defined(ORT_MINIMAL_BUILD)
+  model_proto_owned_ = onnxruntime::make_unique<ModelProto>();
+  model_proto_ = model_proto_owned_.get();
+#endif
 }
 
+// defined here so the unique_ptr members only need the google::protobuf::Arena definition
+// in this translation unit
+Model::~Model() = default;
+
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
                                         const logging::Logger& logger,
@@ -601,12 +637,12 @@ common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
   model.reset(new Model());
 
 #if !defined(ORT_MINIMAL_BUILD)
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, producer_name, fbs_model.producer_name());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, producer_version, fbs_model.producer_version());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, domain, fbs_model.domain());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, doc_string, fbs_model.doc_string());
-  model->model_proto_.set_model_version(fbs_model.model_version());
-  model->model_proto_.set_ir_version(fbs_model.ir_version());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), producer_name, fbs_model.producer_name());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), producer_version, fbs_model.producer_version());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), domain, fbs_model.domain());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), doc_string, fbs_model.doc_string());
+  model->model_proto_->set_model_version(fbs_model.model_version());
+  model->model_proto_->set_ir_version(fbs_model.ir_version());
 #else
   experimental::utils::LoadStringFromOrtFormat(model->producer_name_, fbs_model.producer_name());
   experimental::utils::LoadStringFromOrtFormat(model->producer_version_, fbs_model.producer_version());
@@ -18,6 +18,12 @@ template <typename T>
 struct Offset;
 }  // namespace flatbuffers
 
+namespace google {
+namespace protobuf {
+class Arena;
+}  // namespace protobuf
+}  // namespace google
+
 namespace onnxruntime {
 
 namespace experimental {
@@ -83,6 +89,8 @@ class Model {
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
+  ~Model();
+
 #if !defined(ORT_MINIMAL_BUILD)
   // Get model's IR version.
   // Return <kNoVersion> if not specified.
@@ -237,9 +245,34 @@ class Model {
  private:
   Model();
 
+#if !defined(ORT_MINIMAL_BUILD)
+  // Construct a model whose <model_proto> was allocated on <proto_arena>. Used by the static
+  // loaders so a model parsed from a file or byte buffer places its many small proto objects
+  // in one arena instead of performing (and later individually freeing) per-object heap
+  // allocations. <model_proto> must outlive the Graph, so the arena is owned by this model.
+  Model(std::unique_ptr<google::protobuf::Arena> proto_arena,
+        ONNX_NAMESPACE::ModelProto& model_proto,
+        const PathString& model_path,
+        const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+        const logging::Logger& logger);
+
+  // shared setup for the constructors taking an existing ModelProto.
+  // validates *model_proto_ and creates the main Graph over it.
+  void Initialize(const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                  const logging::Logger& logger);
+#endif
+
   // Model data.
 #if !defined(ORT_MINIMAL_BUILD)
-  ONNX_NAMESPACE::ModelProto model_proto_;
+  // Arena backing <model_proto_> when the model was parsed directly into an arena.
+  // Declared before <model_proto_> and <graph_> so it is destroyed after both.
+  std::unique_ptr<google::protobuf::Arena> proto_arena_;
+
+  // Owns <model_proto_> when the model was constructed from an existing ModelProto
+  // rather than parsed into <proto_arena_>. Exactly one of the two is set.
+  std::unique_ptr<ONNX_NAMESPACE::ModelProto> model_proto_owned_;
+
+  ONNX_NAMESPACE::ModelProto* model_proto_{nullptr};
 #else
   // properties that would normally come from ModelProto
   std::string producer_version_;
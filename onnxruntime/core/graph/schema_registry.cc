@@ -159,6 +159,10 @@ void OnnxRuntimeOpSchemaRegistry::GetSchemaAndHistory(
 
 void SchemaRegistryManager::RegisterRegistry(std::shared_ptr<IOnnxRuntimeOpSchemaCollection> registry) {
   registries.push_front(registry);
+
+  // the new registry takes priority over anything resolved so far
+  std::lock_guard<OrtMutex> lock(schema_cache_mutex_);
+  schema_lookup_cache_.clear();
 }
 
 void SchemaRegistryManager::GetDomainToVersionMapForRegistries(DomainToVersionMap& domain_version_map, bool is_onnx_only) const {
@@ -248,6 +252,34 @@ void SchemaRegistryManager::GetSchemaAndHistory(
     const std::string& domain,
     const ONNX_NAMESPACE::OpSchema** latest_schema,
     int* earliest_opset_where_unchanged) const {
+  const std::string cache_key = MakeString(domain, ":", key, ":", op_set_version);
+
+  {
+    std::lock_guard<OrtMutex> lock(schema_cache_mutex_);
+    auto it = schema_lookup_cache_.find(cache_key);
+    if (it != schema_lookup_cache_.end()) {
+      *latest_schema = it->second.first;
+      if (*latest_schema != nullptr) {
+        *earliest_opset_where_unchanged = it->second.second;
+      }
+      return;
+    }
+  }
+
+  GetSchemaAndHistoryImpl(key, op_set_version, domain, latest_schema, earliest_opset_where_unchanged);
+
+  std::lock_guard<OrtMutex> lock(schema_cache_mutex_);
+  schema_lookup_cache_.emplace(cache_key,
+                               std::make_pair(*latest_schema,
+                                              *latest_schema != nullptr ? *earliest_opset_where_unchanged : 0));
+}
+
+void SchemaRegistryManager::GetSchemaAndHistoryImpl(
+    const std::string& key,
+    const int op_set_version,
+    const std::string& domain,
+    const ONNX_NAMESPACE::OpSchema** latest_schema,
+    int* earliest_opset_where_unchanged) const {
   // A greedy algorithm is used to search for a schema registration in some registry,
   // while potentially inferring from other registries the allowed schema version
   // given the op-set version.  Each time a registry fails to locate the schema
@@ -148,6 +148,45 @@ MlasActivation(
 // Matrix/matrix multiply routines.
 //
 
+class MLAS_SGEMM_POSTPROCESSOR {
+public:
+    virtual
+    void
+    Process(
+        float*,         // Supplies the address of the block of matrix C to process
+        size_t,         // Supplies the start row index of the block within matrix C
+        size_t,         // Supplies the start col index of the block within matrix C
+        size_t,         // Supplies the element count per col of the block
+        size_t,         // Supplies the element count per row of the block
+        size_t          // Supplies the leading dimension of matrix C
+        ) const = 0;
+};
+
+class MLAS_SGEMM_ACTIVATION_PROCESSOR : public MLAS_SGEMM_POSTPROCESSOR {
+public:
+    MLAS_SGEMM_ACTIVATION_PROCESSOR(
+        const MLAS_ACTIVATION& Activation,
+        const float* Bias = nullptr) :
+            Activation_(Activation),
+            Bias_(Bias)
+    {
+    }
+
+    void
+    Process(
+        float* C,
+        size_t StartM,
+        size_t StartN,
+        size_t CountM,
+        size_t CountN,
+        size_t ldc
+        ) const override;
+
+private:
+    const MLAS_ACTIVATION& Activation_;
+    const float* Bias_;  // optional per-column bias vector spanning all N columns
+};
+
 void
 MLASCALL
 MlasGemm(
@@ -164,7 +203,8 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor = nullptr
     );
 
 void
@@ -181,6 +221,30 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor = nullptr
+    );
+
+void
+MLASCALL
+MlasGemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    size_t StrideA,
+    const float* B,
+    size_t ldb,
+    size_t StrideB,
+    float beta,
+    float* C,
+    size_t ldc,
+    size_t StrideC,
+    size_t BatchCount,
     MLAS_THREADPOOL* ThreadPool
     );
 
@@ -203,6 +267,27 @@ MlasGemm(
     MLAS_THREADPOOL* ThreadPool
     );
 
+//
+// Sparse matrix/matrix multiply routine: C = A * B, where B is supplied in
+// compressed sparse column form (values, row indices and per-column offsets).
+//
+
+void
+MLASCALL
+MlasSparseGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const float* A,
+    size_t lda,
+    const float* BValues,
+    const int32_t* BRowIndices,
+    const int32_t* BColumnOffsets,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 enum class MLAS_QUANTIZATION_GRANULARITY {
     PerMatrix,
     PerColumn,
@@ -363,6 +448,7 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
+    MlasConvAlgorithmDepthwise,
 };
 
 struct MLAS_CONV_PARAMETERS {
@@ -388,6 +474,9 @@ struct MLAS_CONV_PARAMETERS {
             CBLAS_TRANSPOSE TransB;
             size_t ldb;
         } GemmDirect;
+        struct {
+            size_t StrideK;
+        } ExpandThenGemm;
         struct {
             size_t ThreadStrideN;
         } ExpandThenGemmSegmented;
@@ -426,6 +515,53 @@ MlasConv(
     MLAS_THREADPOOL* ThreadPool
     );
 
+//
+// Winograd F(2x2,3x3) convolution routines. The filter tensor is transformed
+// ahead of time, typically when the kernel weights are prepacked.
+//
+
+bool
+MLASCALL
+MlasConvWinogradApplicable(
+    const MLAS_CONV_PARAMETERS* Parameters
+    );
+
+size_t
+MLASCALL
+MlasConvWinogradFilterBufferSize(
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels
+    );
+
+void
+MLASCALL
+MlasConvWinogradTransformFilter(
+    const float* Filter,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels,
+    float* TransformedFilter
+    );
+
+size_t
+MLASCALL
+MlasConvWinogradWorkingBufferSize(
+    const MLAS_CONV_PARAMETERS* Parameters
+    );
+
+void
+MLASCALL
+MlasConvWinograd(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* TransformedFilter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 template<typename FilterType>
 void
 MLASCALL
@@ -478,6 +614,14 @@ MlasComputeErf(
     size_t N
     );
 
+void
+MLASCALL
+MlasComputeGelu(
+    const float* Input,
+    float* Output,
+    size_t N
+    );
+
 void
 MLASCALL
 MlasComputeExp(
@@ -513,6 +657,70 @@ MlasComputeTanh(
     size_t N
     );
 
+//
+// Bfloat16 floating-point routines: C = A * B + beta * C, where matrix B has
+// been converted to bfloat16 ahead of time via MlasBf16GemmConvertPackB.
+// Matrix A is converted on the fly and products are accumulated in single
+// precision. MlasBf16AccelerationSupported() reports whether the processor
+// executes bfloat16 dot products natively; without it the emulated path is
+// correct but no faster than MlasGemm.
+//
+
+bool
+MLASCALL
+MlasBf16AccelerationSupported(
+    void
+    );
+
+void
+MLASCALL
+MlasConvertFloatToBf16Buffer(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    );
+
+void
+MLASCALL
+MlasConvertBf16ToFloatBuffer(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    );
+
+size_t
+MLASCALL
+MlasBf16GemmPackBSize(
+    size_t N,
+    size_t K
+    );
+
+void
+MLASCALL
+MlasBf16GemmConvertPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    uint16_t* PackedB
+    );
+
+void
+MLASCALL
+MlasBf16Gemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const float* A,
+    size_t lda,
+    const uint16_t* PackedB,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Half-precision floating-point routines.
 //
@@ -526,6 +734,15 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
 //
 // Transpose routines.
 //
@@ -660,6 +877,19 @@ MlasQuantizeLinear(
     OutputType ZeroPoint
     );
 
+template<typename InputType, typename OutputType>
+void
+MLASCALL
+MlasRequantizeLinear(
+    const InputType* Input,
+    OutputType* Output,
+    size_t N,
+    float InputScale,
+    InputType InputZeroPoint,
+    float OutputScale,
+    OutputType OutputZeroPoint
+    );
+
 void
 MLASCALL
 MlasRequantizeOutput(
@@ -682,6 +912,16 @@ MlasFindMinMaxElement(
     size_t N
     );
 
+void
+MLASCALL
+MlasDynamicQuantizeLinear(
+    const float* Input,
+    uint8_t* Output,
+    size_t N,
+    float* Scale,
+    uint8_t* ZeroPoint
+    );
+
 size_t
 MLASCALL
 MlasQLinearSafePaddingElementCount(
@@ -757,3 +997,60 @@ MlasQLinearMul(
     size_t N,
     bool IsScalarB
     );
+
+//
+// Subtract is not commutative, so either input may be the broadcast scalar.
+// Input A is of size 1 if IsScalarA == true, input B is of size 1 if
+// IsScalarB == true, otherwise both are of size N.
+//
+template<typename DataType>
+void
+MLASCALL
+MlasQLinearSub(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N,
+    bool IsScalarA,
+    bool IsScalarB
+    );
+
+template<typename DataType>
+void
+MLASCALL
+MlasQLinearMin(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N,
+    bool IsScalarB
+    );
+
+template<typename DataType>
+void
+MLASCALL
+MlasQLinearMax(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N,
+    bool IsScalarB
+    );
@@ -0,0 +1,224 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    SgemmKernelSve.cpp
+
+Abstract:
+
+    This module implements the kernels for the single precision matrix/matrix
+    multiply operation (SGEMM) using the ARM Scalable Vector Extension (SVE).
+
+    The kernels are vector length agnostic: matrix B is packed in panels of 16
+    columns by MlasSgemmCopyPackB, so a panel row spans an integral number of
+    vectors for the architectural vector lengths of 128, 256 and 512 bits, and
+    wider implementations are handled by the governing predicate. This module
+    is selected at runtime when the kernel reports SVE support through the
+    hardware capability bits.
+
+--*/
+
+#include "mlasi.h"
+
+#include <arm_sve.h>
+
+//
+// Define the number of columns produced by MlasSgemmCopyPackB for each row of
+// a packed panel.
+//
+
+#define MLAS_SGEMM_PACKED_STRIDEN 16
+
+template<unsigned RowCount>
+void
+MlasSgemmProcessCountMSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine computes RowCount rows of the output matrix for the supplied
+    span of columns using scalable vectors.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    B - Supplies the address of matrix B. The matrix data has been packed
+        using MlasSgemmCopyPackB or MlasSgemmTransposePackB.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number of
+        rows from matrix B to iterate over.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    lda - Supplies the first dimension of matrix A.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    ZeroMode - Supplies true if the output matrix must be zero initialized,
+        else false if the output matrix is accumulated into.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    do {
+
+        const size_t PanelN = (CountN >= MLAS_SGEMM_PACKED_STRIDEN) ?
+            MLAS_SGEMM_PACKED_STRIDEN : CountN;
+
+        for (size_t n = 0; n < PanelN; n += svcntw()) {
+
+            const svbool_t Pred = svwhilelt_b32(uint64_t(n), uint64_t(PanelN));
+
+            svfloat32_t Accumulator0 = svdup_n_f32(0.0f);
+            svfloat32_t Accumulator1 = svdup_n_f32(0.0f);
+            svfloat32_t Accumulator2 = svdup_n_f32(0.0f);
+            svfloat32_t Accumulator3 = svdup_n_f32(0.0f);
+
+            const float* a = A;
+            const float* b = B + n;
+
+            for (size_t k = 0; k < CountK; k++) {
+
+                svfloat32_t BElements = svld1_f32(Pred, b);
+
+                Accumulator0 = svmla_n_f32_x(Pred, Accumulator0, BElements, a[0]);
+
+                if (RowCount >= 2) {
+                    Accumulator1 = svmla_n_f32_x(Pred, Accumulator1, BElements, a[lda]);
+                }
+
+                if (RowCount >= 4) {
+                    Accumulator2 = svmla_n_f32_x(Pred, Accumulator2, BElements, a[lda * 2]);
+                    Accumulator3 = svmla_n_f32_x(Pred, Accumulator3, BElements, a[lda * 3]);
+                }
+
+                a += 1;
+                b += MLAS_SGEMM_PACKED_STRIDEN;
+            }
+
+            for (unsigned Row = 0; Row < RowCount; Row++) {
+
+                svfloat32_t Accumulator;
+
+                if (Row == 0) {
+                    Accumulator = Accumulator0;
+                } else if (Row == 1) {
+                    Accumulator = Accumulator1;
+                } else if (Row == 2) {
+                    Accumulator = Accumulator2;
+                } else {
+                    Accumulator = Accumulator3;
+                }
+
+                float* c = C + Row * ldc + n;
+
+                svfloat32_t Result = svmul_n_f32_x(Pred, Accumulator, alpha);
+
+                if (!ZeroMode) {
+                    Result = svadd_f32_x(Pred, Result, svld1_f32(Pred, c));
+                }
+
+                svst1_f32(Pred, c, Result);
+            }
+        }
+
+        B += CountK * MLAS_SGEMM_PACKED_STRIDEN;
+        C += MLAS_SGEMM_PACKED_STRIDEN;
+        CountN -= PanelN;
+
+    } while (CountN > 0);
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a set
+    of rows using scalable vectors.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    B - Supplies the address of matrix B. The matrix data has been packed
+        using MlasSgemmCopyPackB or MlasSgemmTransposePackB.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number of
+        rows from matrix B to iterate over.
+
+    CountM - Supplies the maximum number of rows that can be processed for
+        matrix A and matrix C. The actual number of rows handled for this
+        invocation depends on the kernel implementation.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    lda - Supplies the first dimension of matrix A.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    ZeroMode - Supplies true if the output matrix must be zero initialized,
+        else false if the output matrix is accumulated into.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    size_t RowsHandled;
+
+    if (CountM >= 4) {
+        MlasSgemmProcessCountMSve<4>(A, B, C, CountK, CountN, lda, ldc, alpha, ZeroMode);
+        RowsHandled = 4;
+    } else if (CountM >= 2) {
+        MlasSgemmProcessCountMSve<2>(A, B, C, CountK, CountN, lda, ldc, alpha, ZeroMode);
+        RowsHandled = 2;
+    } else {
+        MlasSgemmProcessCountMSve<1>(A, B, C, CountK, CountN, lda, ldc, alpha, ZeroMode);
+        RowsHandled = 1;
+    }
+
+    return RowsHandled;
+}
@@ -466,3 +466,72 @@ Return Value:
         }
     }
 }
+
+void
+MLAS_SGEMM_ACTIVATION_PROCESSOR::Process(
+    float* C,
+    size_t StartM,
+    size_t StartN,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc
+    ) const
+/*++
+
+Routine Description:
+
+    This routine applies the activation function to a block of the SGEMM
+    output matrix after optionally adding a per-column bias vector, while
+    the block is still resident in the cache.
+
+Arguments:
+
+    C - Supplies the address of the block of matrix C to process.
+
+    StartM - Supplies the start row index of the block within matrix C.
+
+    StartN - Supplies the start col index of the block within matrix C.
+
+    CountM - Supplies the number of rows of the block.
+
+    CountN - Supplies the number of columns of the block.
+
+    ldc - Supplies the leading dimension of matrix C.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_UNREFERENCED_PARAMETER(StartM);
+
+    if (Bias_ != nullptr) {
+
+        const float* Bias = Bias_ + StartN;
+        float* buffer = C;
+
+        for (size_t m = 0; m < CountM; m++) {
+
+            float* c = buffer;
+            const float* bias = Bias;
+            size_t n = CountN;
+
+            while (n >= 4) {
+                MlasStoreFloat32x4(c, MlasAddFloat32x4(MlasLoadFloat32x4(c), MlasLoadFloat32x4(bias)));
+                c += 4;
+                bias += 4;
+                n -= 4;
+            }
+
+            while (n > 0) {
+                *c++ += *bias++;
+                n -= 1;
+            }
+
+            buffer += ldc;
+        }
+    }
+
+    MlasActivation(&Activation_, C, nullptr, CountM, CountN, ldc);
+}
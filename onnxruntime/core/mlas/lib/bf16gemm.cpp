@@ -0,0 +1,448 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bf16gemm.cpp
+
+Abstract:
+
+    This module implements the bfloat16 matrix/matrix multiply operation with
+    single precision accumulation. Matrix B is converted to bfloat16 ahead of
+    time via MlasBf16GemmConvertPackB, matrix A is converted on the fly, and
+    processors with native bfloat16 dot product support execute the packed
+    panels with the platform kernel. Other processors fall back to widening
+    the bfloat16 values back to single precision, which is correct but has no
+    performance advantage over MlasGemm.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of columns the packed buffer is padded to, which matches
+// the number of single precision accumulators held in one vector register by
+// the platform kernel.
+//
+
+#define MLAS_BF16GEMM_PACKED_STRIDEN        16
+
+//
+// Define the number of elements of matrix A converted to bfloat16 in a local
+// buffer per iteration.
+//
+
+#define MLAS_BF16GEMM_STRIDEK               512
+
+MLAS_FORCEINLINE
+uint16_t
+MlasFloatToBf16(
+    float Value
+    )
+{
+    uint32_t Bits;
+
+    memcpy(&Bits, &Value, sizeof(Bits));
+
+    if ((Bits & 0x7F800000) == 0x7F800000 && (Bits & 0x007FFFFF) != 0) {
+
+        //
+        // Quiet any NaN whose payload would otherwise be truncated away.
+        //
+
+        return uint16_t((Bits >> 16) | 0x0040);
+    }
+
+    //
+    // Round to nearest even before dropping the low mantissa bits.
+    //
+
+    Bits += 0x7FFF + ((Bits >> 16) & 1);
+
+    return uint16_t(Bits >> 16);
+}
+
+MLAS_FORCEINLINE
+float
+MlasBf16ToFloat(
+    uint16_t Value
+    )
+{
+    uint32_t Bits = uint32_t(Value) << 16;
+    float FloatValue;
+
+    memcpy(&FloatValue, &Bits, sizeof(FloatValue));
+
+    return FloatValue;
+}
+
+bool
+MLASCALL
+MlasBf16AccelerationSupported(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine reports whether the processor executes bfloat16 dot products
+    natively.
+
+Return Value:
+
+    Returns true if a native bfloat16 kernel is available.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    return MlasPlatform.Bf16GemmKernel != nullptr;
+#else
+    return false;
+#endif
+}
+
+void
+MLASCALL
+MlasConvertFloatToBf16Buffer(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    )
+{
+    while (Count-- > 0) {
+        *Destination++ = MlasFloatToBf16(*Source++);
+    }
+}
+
+void
+MLASCALL
+MlasConvertBf16ToFloatBuffer(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    )
+{
+    while (Count-- > 0) {
+        *Destination++ = MlasBf16ToFloat(*Source++);
+    }
+}
+
+size_t
+MLASCALL
+MlasBf16GemmPackBSize(
+    size_t N,
+    size_t K
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in bytes of the packed bfloat16 matrix B
+    buffer.
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+Return Value:
+
+    Returns the size in bytes for the packed buffer.
+
+--*/
+{
+    const size_t AlignedN =
+        (N + MLAS_BF16GEMM_PACKED_STRIDEN - 1) & ~(MLAS_BF16GEMM_PACKED_STRIDEN - 1);
+    const size_t PairCountK = (K + 1) / 2;
+
+    return AlignedN * PairCountK * 2 * sizeof(uint16_t);
+}
+
+void
+MLASCALL
+MlasBf16GemmConvertPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    uint16_t* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the contents of matrix B to bfloat16 and packs the
+    result to the destination buffer. The destination buffer should be sized
+    based on MlasBf16GemmPackBSize().
+
+    Pairs of rows are interleaved per column so that the platform kernel can
+    consume two K elements per dot product instruction. Columns are padded
+    with zeroes to a multiple of the packing width and an odd trailing row is
+    padded with a zero partner.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    PackedB - Supplies the address of packed matrix B.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t AlignedN =
+        (N + MLAS_BF16GEMM_PACKED_STRIDEN - 1) & ~(MLAS_BF16GEMM_PACKED_STRIDEN - 1);
+    const size_t PairCountK = (K + 1) / 2;
+
+    for (size_t p = 0; p < PairCountK; p++) {
+
+        for (size_t n = 0; n < AlignedN; n++) {
+
+            for (size_t j = 0; j < 2; j++) {
+
+                const size_t k = 2 * p + j;
+                float Value = 0.0f;
+
+                if (n < N && k < K) {
+                    Value = (TransB == CblasNoTrans) ? B[k * ldb + n] : B[n * ldb + k];
+                }
+
+                PackedB[(p * AlignedN + n) * 2 + j] = MlasFloatToBf16(Value);
+            }
+        }
+    }
+}
+
+//
+// Define the parameters to execute segments of a bfloat16 GEMM operation on
+// worker threads.
+//
+
+struct MLAS_BF16GEMM_WORK_BLOCK {
+    int32_t ThreadCount;
+    size_t M;
+    size_t N;
+    size_t K;
+    const float* A;
+    size_t lda;
+    const uint16_t* PackedB;
+    float beta;
+    float* C;
+    size_t ldc;
+};
+
+void
+MlasBf16GemmThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    bfloat16 GEMM operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_BF16GEMM_WORK_BLOCK*)Context;
+
+    //
+    // Partition the rows of matrix A across the available threads. Each row
+    // of the output is computed independently by converting a slice of the
+    // row of matrix A to bfloat16 and accumulating against the packed panels
+    // of matrix B.
+    //
+
+    size_t RowIndex;
+    size_t RowsRemaining;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCount, WorkBlock->M, &RowIndex, &RowsRemaining);
+
+    const size_t N = WorkBlock->N;
+    const size_t K = WorkBlock->K;
+    const size_t AlignedN =
+        (N + MLAS_BF16GEMM_PACKED_STRIDEN - 1) & ~(MLAS_BF16GEMM_PACKED_STRIDEN - 1);
+    const float beta = WorkBlock->beta;
+
+#if defined(MLAS_TARGET_AMD64)
+    PMLAS_BF16GEMM_KERNEL Bf16GemmKernel = MlasPlatform.Bf16GemmKernel;
+#else
+    PMLAS_BF16GEMM_KERNEL Bf16GemmKernel = nullptr;
+#endif
+
+    MLAS_DECLSPEC_ALIGN(uint16_t ABuffer[MLAS_BF16GEMM_STRIDEK + 1], 64);
+
+    const float* a = WorkBlock->A + RowIndex * WorkBlock->lda;
+    float* c = WorkBlock->C + RowIndex * WorkBlock->ldc;
+
+    while (RowsRemaining-- > 0) {
+
+        //
+        // Apply the beta scalar to the output row before the panels of the
+        // product are accumulated.
+        //
+
+        if (beta == 0.0f) {
+            std::fill_n(c, N, 0.0f);
+        } else if (beta != 1.0f) {
+            for (size_t n = 0; n < N; n++) {
+                c[n] *= beta;
+            }
+        }
+
+        size_t CountK;
+
+        for (size_t k = 0; k < K; k += CountK) {
+
+            CountK = std::min(K - k, size_t(MLAS_BF16GEMM_STRIDEK));
+
+            //
+            // Convert a slice of the row of matrix A to bfloat16, padding an
+            // odd trailing element with a zero partner to complete the pair.
+            //
+
+            MlasConvertFloatToBf16Buffer(a + k, ABuffer, CountK);
+
+            if ((CountK & 1) != 0) {
+                ABuffer[CountK] = 0;
+            }
+
+            const size_t PairCountK = (CountK + 1) / 2;
+            const uint16_t* PackedB = WorkBlock->PackedB + (k / 2) * AlignedN * 2;
+
+            if (Bf16GemmKernel != nullptr) {
+
+                Bf16GemmKernel(ABuffer, PackedB, c, PairCountK, N, AlignedN);
+
+            } else {
+
+                //
+                // Widen the bfloat16 values back to single precision and
+                // accumulate the products directly.
+                //
+
+                for (size_t n = 0; n < N; n++) {
+
+                    float Accumulator = 0.0f;
+
+                    for (size_t p = 0; p < PairCountK; p++) {
+                        const uint16_t* b = &PackedB[(p * AlignedN + n) * 2];
+                        Accumulator += MlasBf16ToFloat(ABuffer[2 * p]) * MlasBf16ToFloat(b[0]);
+                        Accumulator += MlasBf16ToFloat(ABuffer[2 * p + 1]) * MlasBf16ToFloat(b[1]);
+                    }
+
+                    c[n] += Accumulator;
+                }
+            }
+        }
+
+        a += WorkBlock->lda;
+        c += WorkBlock->ldc;
+    }
+}
+
+void
+MLASCALL
+MlasBf16Gemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const float* A,
+    size_t lda,
+    const uint16_t* PackedB,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the bfloat16 matrix/matrix multiply operation
+    C = A * B + beta * C, where matrix B has been converted and packed by
+    MlasBf16GemmConvertPackB and products are accumulated in single
+    precision.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of packed matrix B.
+
+    beta - Supplies the scalar beta multiplier (see GEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    MLAS_BF16GEMM_WORK_BLOCK WorkBlock;
+
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.K = K;
+    WorkBlock.A = A;
+    WorkBlock.lda = lda;
+    WorkBlock.PackedB = PackedB;
+    WorkBlock.beta = beta;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+
+    int32_t ThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (size_t(ThreadCount) > M) {
+        ThreadCount = int32_t(M);
+    }
+
+    WorkBlock.ThreadCount = ThreadCount;
+
+    MlasExecuteThreaded(MlasBf16GemmThreaded, &WorkBlock, ThreadCount, ThreadPool);
+}
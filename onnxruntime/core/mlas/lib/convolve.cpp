@@ -736,6 +736,216 @@ Return Value:
     }
 }
 
+void
+MlasConvDepthwiseFloatOperation(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the convolution operation of a single channel of
+    a depthwise convolution. Each kernel tap is accumulated across the output
+    row, which vectorizes over the spatial dimension instead of performing a
+    degenerate single row GEMM per channel.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor of one channel.
+
+    Filter - Supplies the kernel taps of one channel.
+
+    Output - Supplies the output tensor of one channel.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+
+    const size_t KernelHeight = Parameters->KernelShape[0];
+    const size_t KernelWidth = Parameters->KernelShape[1];
+
+    const size_t DilationHeight = Parameters->DilationShape[0];
+    const size_t DilationWidth = Parameters->DilationShape[1];
+
+    const size_t StrideHeight = Parameters->StrideShape[0];
+    const size_t StrideWidth = Parameters->StrideShape[1];
+
+    const ptrdiff_t PaddingTop = ptrdiff_t(Parameters->Padding[0]);
+    const ptrdiff_t PaddingLeft = ptrdiff_t(Parameters->Padding[1]);
+
+    for (size_t oh = 0; oh < OutputHeight; oh++) {
+
+        float* output = Output + oh * OutputWidth;
+
+        std::fill_n(output, OutputWidth, 0.0f);
+
+        for (size_t kh = 0; kh < KernelHeight; kh++) {
+
+            //
+            // Skip kernel rows that fall inside the padding region or
+            // beyond the input image.
+            //
+
+            const size_t ih = size_t(ptrdiff_t(oh * StrideHeight + kh * DilationHeight) - PaddingTop);
+
+            if (ih >= InputHeight) {
+                continue;
+            }
+
+            const float* input = Input + ih * InputWidth;
+
+            for (size_t kw = 0; kw < KernelWidth; kw++) {
+
+                const float FilterValue = Filter[kh * KernelWidth + kw];
+
+                //
+                // Compute the range of output columns with the input element
+                // for this kernel tap inside the input image.
+                //
+
+                const ptrdiff_t InputBase = ptrdiff_t(kw * DilationWidth) - PaddingLeft;
+
+                size_t StartW = 0;
+
+                if (InputBase < 0) {
+                    StartW = size_t(-InputBase + ptrdiff_t(StrideWidth) - 1) / StrideWidth;
+                }
+
+                size_t CountW = 0;
+
+                if (ptrdiff_t(InputWidth) > InputBase) {
+                    CountW = (size_t(ptrdiff_t(InputWidth) - InputBase) + StrideWidth - 1) / StrideWidth;
+                }
+
+                CountW = (std::min)(CountW, OutputWidth);
+
+                if (StartW >= CountW) {
+                    continue;
+                }
+
+                const float* in = input + size_t(ptrdiff_t(StartW * StrideWidth) + InputBase);
+                float* out = output + StartW;
+                size_t n = CountW - StartW;
+
+                if (StrideWidth == 1) {
+
+                    MLAS_FLOAT32X4 FilterVector = MlasBroadcastFloat32x4(FilterValue);
+
+                    while (n >= 4) {
+                        MlasStoreFloat32x4(out, MlasMultiplyAddFloat32x4(FilterVector,
+                            MlasLoadFloat32x4(in), MlasLoadFloat32x4(out)));
+                        in += 4;
+                        out += 4;
+                        n -= 4;
+                    }
+
+                    while (n > 0) {
+                        *out++ += FilterValue * *in++;
+                        n -= 1;
+                    }
+
+                } else {
+
+                    while (n > 0) {
+                        *out++ += FilterValue * *in;
+                        in += StrideWidth;
+                        n -= 1;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void
+MlasConvDepthwiseThreaded(
+    void* Context,
+    int32_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of the
+    channels of a depthwise convolution.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_CONV_WORK_BLOCK* WorkBlock = (MLAS_CONV_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    //
+    // Compute the range of indices to use for this thread.
+    //
+
+    const size_t GroupCount = Parameters->GroupCount;
+    const size_t BatchGroupCount = Parameters->BatchCount * GroupCount;
+
+    const size_t TargetThreadCount = WorkBlock->TargetThreadCount;
+
+    size_t BatchGroupStart;
+    size_t BatchGroupRemaining;
+
+    MlasPartitionWork(Index, int32_t(TargetThreadCount), BatchGroupCount,
+        &BatchGroupStart, &BatchGroupRemaining);
+
+    const size_t BatchGroupEnd = BatchGroupStart + BatchGroupRemaining;
+
+    const size_t OutputSize = Parameters->OutputSize;
+    const size_t K = Parameters->K;
+
+    //
+    // Iterate over the batch and groups allocated to this thread.
+    //
+
+    for (size_t bg = BatchGroupStart; bg < BatchGroupEnd; bg++) {
+
+        size_t group = bg % GroupCount;
+
+        const float* input = WorkBlock->Input + bg * Parameters->InputSize;
+        const float* filter = WorkBlock->Filter + group * K;
+        float* output = WorkBlock->Output + bg * OutputSize;
+
+        MlasConvDepthwiseFloatOperation(Parameters, input, filter, output);
+
+        //
+        // Apply the activation with optional bias.
+        //
+
+        const float* bias = WorkBlock->Bias;
+
+        if (bias != nullptr) {
+            bias += group;
+        }
+
+        MlasActivation(Parameters->Activation, output, bias, 1, OutputSize, OutputSize);
+    }
+}
+
 inline
 bool
 MlasConvTryMultithread(
@@ -910,6 +1120,36 @@ Return Value:
         return;
     }
 
+    //
+    // Schedule the channels of a depthwise convolution across multiple
+    // threads.
+    //
+
+    if (Algorithm == MlasConvAlgorithmDepthwise) {
+
+        const size_t BatchGroupCount = BatchCount * GroupCount;
+
+        int32_t TargetThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+        if (size_t(TargetThreadCount) >= BatchGroupCount) {
+            TargetThreadCount = int32_t(BatchGroupCount);
+        }
+
+        MLAS_CONV_WORK_BLOCK WorkBlock;
+
+        WorkBlock.Parameters = Parameters;
+        WorkBlock.Input = Input;
+        WorkBlock.Filter = Filter;
+        WorkBlock.Bias = Bias;
+        WorkBlock.WorkingBuffer = nullptr;
+        WorkBlock.Output = Output;
+        WorkBlock.TargetThreadCount = TargetThreadCount;
+
+        MlasExecuteThreaded(MlasConvDepthwiseThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+
+        return;
+    }
+
     //
     // Iterate over each batch and group.
     //
@@ -950,18 +1190,37 @@ Return Value:
                 case MlasConvAlgorithmExpandThenGemm:
                 {
                     //
-                    // Expand the input tensor to the working buffer and then invoke the
-                    // threaded GEMM.
+                    // Expand panels of the input tensor to the working buffer and
+                    // accumulate each panel through the threaded GEMM. Stepping
+                    // through the K dimension in panels bounds the working buffer
+                    // without materializing the entire expanded matrix at once.
                     //
 
-                    if (Parameters->Dimensions == 2) {
-                        MlasConvIm2Col(Parameters, Input, WorkingBuffer, 0, K, 0, OutputSize);
-                    } else {
-                        MlasConvVol2Col(Parameters, Input, WorkingBuffer, 0, K, 0, OutputSize);
-                    }
+                    const size_t StrideK = Parameters->u.ExpandThenGemm.StrideK;
 
-                    MlasGemm(CblasNoTrans, CblasNoTrans, FilterCount, OutputSize, K, 1.0f, filter,
-                        K, WorkingBuffer, OutputSize, 0.0f, Output, OutputSize, ThreadPool);
+                    size_t CountK;
+                    float beta = 0.0f;
+
+                    for (size_t k = 0; k < K; k += CountK) {
+
+                        CountK = K - k;
+
+                        if (CountK > StrideK) {
+                            CountK = StrideK;
+                        }
+
+                        if (Parameters->Dimensions == 2) {
+                            MlasConvIm2Col(Parameters, Input, WorkingBuffer, k, CountK, 0, OutputSize);
+                        } else {
+                            MlasConvVol2Col(Parameters, Input, WorkingBuffer, k, CountK, 0, OutputSize);
+                        }
+
+                        MlasGemm(CblasNoTrans, CblasNoTrans, FilterCount, OutputSize, CountK, 1.0f,
+                            filter + k, K, WorkingBuffer, OutputSize, beta, Output, OutputSize,
+                            ThreadPool);
+
+                        beta = 1.0f;
+                    }
 
                     //
                     // Apply the activation with optional bias.
@@ -988,6 +1247,21 @@ Return Value:
 
                     break;
                 }
+
+                case MlasConvAlgorithmDepthwise:
+                {
+                    //
+                    // Invoke the depthwise kernel for the single channel of
+                    // this group.
+                    //
+
+                    MlasConvDepthwiseFloatOperation(Parameters, Input, filter, Output);
+
+                    MlasActivation(Parameters->Activation, Output, bias, FilterCount,
+                        OutputSize, OutputSize);
+
+                    break;
+                }
             }
 
             //
@@ -1191,16 +1465,50 @@ Return Value:
         }
     }
 
+    //
+    // Detect a depthwise convolution, where each channel forms its own group
+    // with a single filter. The specialized kernel vectorizes across the
+    // spatial dimension instead of performing a degenerate GEMM per channel.
+    //
+
+    if (Dimensions == 2 && GroupCount > 1 && InputChannels == 1 && FilterCount == 1) {
+
+        Parameters->Algorithm = MlasConvAlgorithmDepthwise;
+
+        return;
+    }
+
     if (FilterCount > OutputSize) {
 
         //
-        // The filter count is larger than the output dimensions, so perform the
-        // full matrix expansion and then invoke the threaded GEMM.
+        // The filter count is larger than the output dimensions, so expand the
+        // input tensor ahead of the threaded GEMM. The expansion is stepped
+        // through the K dimension in panels, so the working buffer remains
+        // bounded to a slice of the expanded matrix regardless of how large
+        // the convolution is.
         //
 
         Parameters->Algorithm = MlasConvAlgorithmExpandThenGemm;
 
-        *WorkingBufferSize = OutputSize * K;
+        size_t StrideK = K;
+
+        const size_t PanelElements =
+            MLAS_MAXIMUM_THREAD_COUNT * MLAS_CONV_WORKING_BUFFER_SIZE_PER_THREAD;
+
+        if (OutputSize * StrideK > PanelElements) {
+
+            StrideK = PanelElements / OutputSize;
+
+            if (StrideK >= MLAS_SGEMM_STRIDEK) {
+                StrideK &= ~size_t(MLAS_SGEMM_STRIDEK - 1);
+            } else if (StrideK == 0) {
+                StrideK = 1;
+            }
+        }
+
+        Parameters->u.ExpandThenGemm.StrideK = StrideK;
+
+        *WorkingBufferSize = OutputSize * StrideK;
 
     } else {
 
@@ -0,0 +1,277 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16.cpp
+
+Abstract:
+
+    This module implements routines to convert between half-precision and
+    single-precision buffers.
+
+    The portable kernels below operate on the IEEE 754 bit patterns directly,
+    so they produce identical results on every target. Platforms with
+    hardware conversion support override these kernels: AMD64 dispatches to
+    the F16C kernels through the platform function pointers and ARM64 uses
+    the NEON conversion instructions that are part of the baseline
+    architecture.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Converts a single half-precision value to single-precision.
+//
+
+MLAS_FORCEINLINE
+float
+MlasCvtFp16ToFp32(
+    unsigned short Value
+    )
+{
+    const uint32_t Sign = (uint32_t(Value) & 0x8000) << 16;
+    uint32_t Magnitude = uint32_t(Value) & 0x7FFF;
+    uint32_t Bits;
+
+    if (Magnitude >= 0x7C00) {
+
+        // Infinity or NaN: widen the exponent and keep the payload.
+
+        Bits = Sign | 0x7F800000 | ((Magnitude & 0x03FF) << 13);
+
+    } else if (Magnitude >= 0x0400) {
+
+        // Normal: rebias the exponent from 15 to 127.
+
+        Bits = Sign | ((Magnitude + 0x1C000) << 13);
+
+    } else if (Magnitude != 0) {
+
+        // Denormal: normalize the mantissa into the single-precision range.
+
+        uint32_t Shift = 0;
+
+        while ((Magnitude & 0x0400) == 0) {
+            Magnitude <<= 1;
+            Shift += 1;
+        }
+
+        Bits = Sign | ((113 - Shift) << 23) | ((Magnitude & 0x03FF) << 13);
+
+    } else {
+
+        Bits = Sign;
+    }
+
+    float Float32;
+    memcpy(&Float32, &Bits, sizeof(Float32));
+    return Float32;
+}
+
+//
+// Converts a single single-precision value to half-precision using
+// round-to-nearest-even.
+//
+
+MLAS_FORCEINLINE
+unsigned short
+MlasCvtFp32ToFp16(
+    float Value
+    )
+{
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+
+    const uint32_t Sign = (Bits >> 16) & 0x8000;
+    const uint32_t Magnitude = Bits & 0x7FFFFFFF;
+
+    if (Magnitude > 0x7F800000) {
+
+        // NaN: return a quiet NaN with the original sign.
+
+        return (unsigned short)(Sign | 0x7E00);
+    }
+
+    if (Magnitude >= 0x47800000) {
+
+        // Overflow (including infinity): return infinity.
+
+        return (unsigned short)(Sign | 0x7C00);
+    }
+
+    if (Magnitude < 0x38800000) {
+
+        // Denormal or zero in the half-precision range.
+
+        if (Magnitude < 0x33000000) {
+
+            // Smaller than half of the smallest denormal: round to zero.
+
+            return (unsigned short)Sign;
+        }
+
+        const uint32_t Shift = 126 - (Magnitude >> 23);
+        const uint32_t Mantissa = (Magnitude & 0x007FFFFF) | 0x00800000;
+        const uint32_t Midpoint = 1u << (Shift - 1);
+
+        uint32_t Half = Mantissa >> Shift;
+        const uint32_t Remainder = Mantissa & ((Midpoint << 1) - 1);
+
+        if (Remainder > Midpoint || (Remainder == Midpoint && (Half & 1))) {
+            Half += 1;
+        }
+
+        return (unsigned short)(Sign | Half);
+    }
+
+    // Normal: rebias the exponent from 127 to 15. A mantissa that rounds up
+    // carries into the exponent field, which also handles the values that
+    // round up to infinity.
+
+    uint32_t Half = (Magnitude - 0x38000000) >> 13;
+    const uint32_t Remainder = Magnitude & 0x1FFF;
+
+    if (Remainder > 0x1000 || (Remainder == 0x1000 && (Half & 1))) {
+        Half += 1;
+    }
+
+    return (unsigned short)(Sign | Half);
+}
+
+extern "C"
+void
+MLASCALL
+MlasConvertHalfToFloatKernel(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of half-precision values to
+    single-precision.
+
+Arguments:
+
+    Source - Supplies the buffer of half-precision values.
+
+    Destination - Supplies the buffer to receive the single-precision values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_NEON64_INTRINSICS)
+
+    while (Count >= 4) {
+        vst1q_f32(Destination, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(Source))));
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    while (Count > 0) {
+        *Destination++ = MlasCvtFp16ToFp32(*Source++);
+        Count -= 1;
+    }
+}
+
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfKernel(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of single-precision values to
+    half-precision.
+
+Arguments:
+
+    Source - Supplies the buffer of single-precision values.
+
+    Destination - Supplies the buffer to receive the half-precision values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_NEON64_INTRINSICS)
+
+    while (Count >= 4) {
+        vst1_u16(Destination, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(Source))));
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    while (Count > 0) {
+        *Destination++ = MlasCvtFp32ToFp16(*Source++);
+        Count -= 1;
+    }
+}
+
+#if !(defined(MLAS_TARGET_AMD64) && defined(_MSC_VER))
+
+//
+// N.B. MSVC AMD64 builds use the assembly implementation from
+// amd64/cvtfp16a.asm instead.
+//
+
+extern "C"
+void
+MLASCALL
+MlasConvertHalfToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+{
+#if defined(MLAS_TARGET_AMD64_IX86)
+    MlasPlatform.ConvertHalfToFloatKernel(Source, Destination, Count);
+#else
+    MlasConvertHalfToFloatKernel(Source, Destination, Count);
+#endif
+}
+
+#endif
+
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+{
+#if defined(MLAS_TARGET_AMD64_IX86)
+    MlasPlatform.ConvertFloatToHalfKernel(Source, Destination, Count);
+#else
+    MlasConvertFloatToHalfKernel(Source, Destination, Count);
+#endif
+}
@@ -267,3 +267,178 @@ Return Value:
     MlasErfKernel(Input, Output, N);
 #endif
 }
+
+//
+// Inline forms of the error function used to build fused kernels. The
+// polynomial evaluation matches MlasErfKernel above.
+//
+
+MLAS_FORCEINLINE
+MLAS_FLOAT32X4
+MlasErfFloat32x4(
+    MLAS_FLOAT32X4 Value
+    )
+{
+    MLAS_FLOAT32X4 NegZero = MlasBroadcastFloat32x4(MlasErfConstants.ErfNegZero);
+    MLAS_FLOAT32X4 SignMask = MlasAndFloat32x4(Value, NegZero);
+    MLAS_FLOAT32X4 AbsValue = MlasAndNotFloat32x4(NegZero, Value);
+    AbsValue = MlasMinimumFloat32x4(MlasBroadcastFloat32x4(MlasErfConstants.ErfUpperAbsRange), AbsValue);
+    MLAS_FLOAT32X4 SquareValue = MlasMultiplyFloat32x4(AbsValue, AbsValue);
+
+    MLAS_FLOAT32X4 r_small = MlasBroadcastFloat32x4(MlasErfConstants.ErfSMALL_P0);
+    r_small = MlasMultiplyAddFloat32x4(r_small, SquareValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfSMALL_P1));
+    r_small = MlasMultiplyAddFloat32x4(r_small, SquareValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfSMALL_P2));
+    r_small = MlasMultiplyAddFloat32x4(r_small, SquareValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfSMALL_P3));
+    r_small = MlasMultiplyAddFloat32x4(r_small, SquareValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfSMALL_P4));
+    r_small = MlasMultiplyAddFloat32x4(r_small, SquareValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfSMALL_P5_Minus_One));
+    r_small = MlasMultiplyAddFloat32x4(r_small, AbsValue, AbsValue);
+    MLAS_FLOAT32X4 split_mask = MlasGreaterThanFloat32x4(AbsValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfSplitBoundary));
+    r_small = MlasAndNotFloat32x4(split_mask, r_small);
+
+    AbsValue = MlasAndFloat32x4(split_mask, AbsValue); // clear smaller value into zero for bigger number calculation
+    MLAS_FLOAT32X4 r_big = MlasBroadcastFloat32x4(MlasErfConstants.ErfBIG_P0);
+    r_big = MlasMultiplyAddFloat32x4(r_big, AbsValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfBIG_P1));
+    r_big = MlasMultiplyAddFloat32x4(r_big, AbsValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfBIG_P2));
+    r_big = MlasMultiplyAddFloat32x4(r_big, AbsValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfBIG_P3));
+    r_big = MlasMultiplyAddFloat32x4(r_big, AbsValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfBIG_P4));
+    r_big = MlasMultiplyAddFloat32x4(r_big, AbsValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfBIG_P5));
+    r_big = MlasMultiplyAddFloat32x4(r_big, AbsValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfBIG_P6_Minus_One));
+    r_big = MlasMultiplyAddFloat32x4(r_big, AbsValue, AbsValue);
+
+    // 1.0 - exp(-r_big), no need to do min()
+    r_big = MlasXorFloat32x4(r_big, MlasBroadcastFloat32x4(MlasErfConstants.ErfNegZero)); // -r_big
+    r_big = MlasMaximumFloat32x4(MlasBroadcastFloat32x4(MlasErfConstants.Exp_LowerRange), r_big);
+    MLAS_FLOAT32X4 exp_c = MlasBroadcastFloat32x4(MlasErfConstants.Exp_C);
+    MLAS_FLOAT32X4 r = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(MlasErfConstants.Exp_Log2Reciprocal), r_big, exp_c);
+    r = MlasSubtractFloat32x4(r, exp_c);
+
+    MLAS_FLOAT32X4 fx = MlasMultiplyAddFloat32x4(r, MlasBroadcastFloat32x4(MlasErfConstants.Exp_log2_hi), r_big);
+    fx = MlasMultiplyAddFloat32x4(r, MlasBroadcastFloat32x4(MlasErfConstants.Exp_log2_lo), fx);
+    // y = exp(fx)
+    MLAS_FLOAT32X4 y = MlasBroadcastFloat32x4(MlasErfConstants.Exp_P0);
+    y = MlasMultiplyAddFloat32x4(y, fx, MlasBroadcastFloat32x4(MlasErfConstants.Exp_P1));
+    y = MlasMultiplyAddFloat32x4(y, fx, MlasBroadcastFloat32x4(MlasErfConstants.Exp_P2));
+    y = MlasMultiplyAddFloat32x4(y, fx, MlasBroadcastFloat32x4(MlasErfConstants.Exp_P3));
+    y = MlasMultiplyAddFloat32x4(y, fx, MlasBroadcastFloat32x4(MlasErfConstants.Exp_P4));
+    y = MlasMultiplyAddFloat32x4(y, fx, MlasBroadcastFloat32x4(MlasErfConstants.Exp_P5));
+    y = MlasMultiplyAddFloat32x4(y, fx, MlasBroadcastFloat32x4(MlasErfConstants.Exp_P6));
+    // 1.0 - exp(fx) * 2^INT(r)
+    y = MlasMultiplyFloat32x4(y, MlasPowerOf2Float32x4(r));
+    y = MlasSubtractFloat32x4(MlasBroadcastFloat32x4(MlasErfConstants.ErfOne), y);
+
+    // merge two splits results
+    y = MlasOrFloat32x4(r_small, y);
+    y = MlasOrFloat32x4(y, SignMask);
+
+    return y;
+}
+
+MLAS_FORCEINLINE
+float
+MlasErfScalar(
+    float Value
+    )
+{
+    float AbsValue = fabsf(Value);
+
+    float r;
+    if (AbsValue > MlasErfConstants.ErfSplitBoundary) {
+        AbsValue = std::min(MlasErfConstants.ErfUpperAbsRange, AbsValue);
+        float r_big = MlasErfConstants.ErfBIG_P0;
+        r_big = r_big * AbsValue + MlasErfConstants.ErfBIG_P1;
+        r_big = r_big * AbsValue + MlasErfConstants.ErfBIG_P2;
+        r_big = r_big * AbsValue + MlasErfConstants.ErfBIG_P3;
+        r_big = r_big * AbsValue + MlasErfConstants.ErfBIG_P4;
+        r_big = r_big * AbsValue + MlasErfConstants.ErfBIG_P5;
+        r_big = r_big * AbsValue + MlasErfConstants.ErfBIG_P6_Minus_One;
+        r_big = r_big * AbsValue + AbsValue;
+
+        r_big = std::max(-r_big, MlasErfConstants.Exp_LowerRange);
+        r = MlasErfConstants.Exp_Log2Reciprocal * r_big + MlasErfConstants.Exp_C;
+        r -= MlasErfConstants.Exp_C;
+        float fx = r * MlasErfConstants.Exp_log2_hi + r_big;
+        fx = r * MlasErfConstants.Exp_log2_lo + fx;
+
+        float y = MlasErfConstants.Exp_P0;
+        y = y * fx + MlasErfConstants.Exp_P1;
+        y = y * fx + MlasErfConstants.Exp_P2;
+        y = y * fx + MlasErfConstants.Exp_P3;
+        y = y * fx + MlasErfConstants.Exp_P4;
+        y = y * fx + MlasErfConstants.Exp_P5;
+        y = y * fx + MlasErfConstants.Exp_P6;
+
+        r = 1.0f - ldexpf(y, (int)r);
+        r = (Value <= -0.0f) ? -r : r;
+    }
+    else {
+        float SquareValue = AbsValue * AbsValue;
+        r = MlasErfConstants.ErfSMALL_P0;
+        r = r * SquareValue + MlasErfConstants.ErfSMALL_P1;
+        r = r * SquareValue + MlasErfConstants.ErfSMALL_P2;
+        r = r * SquareValue + MlasErfConstants.ErfSMALL_P3;
+        r = r * SquareValue + MlasErfConstants.ErfSMALL_P4;
+        r = r * SquareValue + MlasErfConstants.ErfSMALL_P5_Minus_One;
+        r = r * Value + Value;
+    }
+
+    return r;
+}
+
+//
+// Constants for the Gaussian error linear unit: 0.5 * x * (1 + erf(x / sqrt(2))).
+//
+
+static const float MlasGeluSqrtReciprocal2 = 0.70710678118654752440f;
+static const float MlasGeluHalf = 0.5f;
+
+void
+MLASCALL
+MlasComputeGelu(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the exact Gaussian error linear unit
+    0.5 * x * (1 + erf(x / sqrt(2))) in a single pass, with the error
+    function fused into the surrounding scale operations so the buffer is
+    not traversed once per stage.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (N >= 4) {
+        MLAS_FLOAT32X4 Value = MlasLoadFloat32x4(Input);
+        MLAS_FLOAT32X4 ErfValue = MlasErfFloat32x4(MlasMultiplyFloat32x4(Value,
+            MlasBroadcastFloat32x4(MlasGeluSqrtReciprocal2)));
+        MLAS_FLOAT32X4 y = MlasMultiplyFloat32x4(MlasMultiplyFloat32x4(Value,
+            MlasBroadcastFloat32x4(MlasGeluHalf)),
+            MlasAddFloat32x4(ErfValue, MlasBroadcastFloat32x4(MlasErfConstants.ErfOne)));
+
+        MlasStoreFloat32x4(Output, y);
+
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    while (N > 0) {
+        float Value = *Input++;
+        *Output++ = MlasGeluHalf * Value * (MlasErfScalar(Value * MlasGeluSqrtReciprocal2) + 1.0f);
+        N -= 1;
+    }
+}
@@ -0,0 +1,97 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    Bf16GemmKernelAvx512Bf16.cpp
+
+Abstract:
+
+    This module implements the bfloat16 GEMM kernel for processors supporting
+    the AVX512 BF16 instructions. A single row of matrix A, converted to pairs
+    of bfloat16 elements, is multiplied against the packed panels produced by
+    MlasBf16GemmConvertPackB and accumulated into the single precision output
+    row with VDPBF16PS.
+
+--*/
+
+#include "mlasi.h"
+
+void
+MLASCALL
+MlasBf16GemmKernelAvx512Bf16(
+    const uint16_t* A,
+    const uint16_t* PackedB,
+    float* C,
+    size_t PairCountK,
+    size_t CountN,
+    size_t PackedCountN
+    )
+/*++
+
+Routine Description:
+
+    This routine accumulates a single row of the bfloat16 matrix/matrix
+    multiply operation into the output row.
+
+Arguments:
+
+    A - Supplies the address of a row of matrix A converted to bfloat16
+        pairs. An odd trailing element is padded with a zero partner.
+
+    PackedB - Supplies the address of the packed panels of matrix B aligned
+        to the supplied pair of rows.
+
+    C - Supplies the address of the output row, which is accumulated to.
+
+    PairCountK - Supplies the number of row pairs to process.
+
+    CountN - Supplies the number of columns to produce.
+
+    PackedCountN - Supplies the aligned column count the packed buffer was
+        built with.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t n = 0; n < CountN; n += 16) {
+
+        const size_t Remaining = CountN - n;
+        const __mmask16 Mask =
+            (Remaining >= 16) ? __mmask16(0xFFFF) : __mmask16((1u << Remaining) - 1);
+
+        __m512 Accumulator = _mm512_maskz_loadu_ps(Mask, C + n);
+
+        const uint16_t* a = A;
+        const uint16_t* b = PackedB + n * 2;
+
+        for (size_t p = 0; p < PairCountK; p++) {
+
+            //
+            // Broadcast one pair of elements of matrix A across the vector
+            // and accumulate against sixteen interleaved column pairs of the
+            // packed panel. The packed buffer is padded to the aligned
+            // column count, so the full width load is always valid.
+            //
+
+            uint32_t APair;
+            memcpy(&APair, a, sizeof(APair));
+
+            __m512i ABroadcast = _mm512_set1_epi32(int32_t(APair));
+            __m512i BVector = _mm512_loadu_si512((const void*)b);
+
+            Accumulator = _mm512_dpbf16_ps(Accumulator, (__m512bh)BVector, (__m512bh)ABroadcast);
+
+            a += 2;
+            b += PackedCountN * 2;
+        }
+
+        _mm512_mask_storeu_ps(C + n, Mask, Accumulator);
+    }
+}
@@ -0,0 +1,140 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16_f16c.cpp
+
+Abstract:
+
+    This module implements routines to convert between half-precision and
+    single-precision buffers using F16C instructions.
+
+--*/
+
+#include "../../mlasi.h"
+
+extern "C"
+void
+MLASCALL
+MlasConvertHalfToFloatKernelF16c(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of half-precision values to
+    single-precision using F16C instructions.
+
+Arguments:
+
+    Source - Supplies the buffer of half-precision values.
+
+    Destination - Supplies the buffer to receive the single-precision values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 8) {
+
+        __m128i HalfVector = _mm_loadu_si128((const __m128i*)Source);
+        _mm256_storeu_ps(Destination, _mm256_cvtph_ps(HalfVector));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        //
+        // Stage the remaining elements through local buffers so the vector
+        // conversion never touches memory beyond the caller's buffers.
+        //
+
+        unsigned short HalfBuffer[8] = { 0 };
+        float FloatBuffer[8];
+
+        for (size_t i = 0; i < Count; i++) {
+            HalfBuffer[i] = Source[i];
+        }
+
+        _mm256_storeu_ps(FloatBuffer, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)HalfBuffer)));
+
+        for (size_t i = 0; i < Count; i++) {
+            Destination[i] = FloatBuffer[i];
+        }
+    }
+}
+
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfKernelF16c(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of single-precision values to
+    half-precision using F16C instructions.
+
+Arguments:
+
+    Source - Supplies the buffer of single-precision values.
+
+    Destination - Supplies the buffer to receive the half-precision values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 8) {
+
+        __m256 FloatVector = _mm256_loadu_ps(Source);
+        _mm_storeu_si128((__m128i*)Destination, _mm256_cvtps_ph(FloatVector, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        //
+        // Stage the remaining elements through local buffers so the vector
+        // conversion never touches memory beyond the caller's buffers.
+        //
+
+        float FloatBuffer[8] = { 0.0f };
+        unsigned short HalfBuffer[8];
+
+        for (size_t i = 0; i < Count; i++) {
+            FloatBuffer[i] = Source[i];
+        }
+
+        _mm_storeu_si128((__m128i*)HalfBuffer, _mm256_cvtps_ph(_mm256_loadu_ps(FloatBuffer), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+
+        for (size_t i = 0; i < Count; i++) {
+            Destination[i] = HalfBuffer[i];
+        }
+    }
+}
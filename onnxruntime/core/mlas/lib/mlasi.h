@@ -207,6 +207,33 @@ typedef MLAS_GEMM_FLOAT_KERNEL* PMLAS_GEMM_FLOAT_KERNEL;
 
 typedef MLAS_GEMM_DOUBLE_KERNEL* PMLAS_GEMM_DOUBLE_KERNEL;
 
+#if defined(MLAS_TARGET_ARM64)
+
+//
+// The scalable vector kernels fold the accumulate and non-accumulate stores
+// into a single entry point using a ZeroMode flag, unlike the NEON kernels
+// that use split Zero/Add entry points.
+//
+
+typedef
+size_t
+(MLASCALL MLAS_SVE_GEMM_FLOAT_KERNEL)(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha,
+    bool ZeroMode
+    );
+
+typedef MLAS_SVE_GEMM_FLOAT_KERNEL* PMLAS_SVE_GEMM_FLOAT_KERNEL;
+
+#endif
+
 typedef
 size_t
 (MLASCALL MLAS_GEMV_FLOAT_KERNEL)(
@@ -221,6 +248,19 @@ size_t
 
 typedef MLAS_GEMV_FLOAT_KERNEL* PMLAS_GEMV_FLOAT_KERNEL;
 
+typedef
+void
+(MLASCALL MLAS_BF16GEMM_KERNEL)(
+    const uint16_t* A,
+    const uint16_t* PackedB,
+    float* C,
+    size_t PairCountK,
+    size_t CountN,
+    size_t PackedCountN
+    );
+
+typedef MLAS_BF16GEMM_KERNEL* PMLAS_BF16GEMM_KERNEL;
+
 typedef
 void
 (MLASCALL MLAS_SGEMM_KERNEL_M1_ROUTINE)(
@@ -489,6 +529,26 @@ void
 
 typedef MLAS_QLINEAR_BINARY_OP_U8_KERNEL* PMLAS_QLINEAR_BINARY_OP_U8_KERNEL;
 
+typedef
+void
+(MLASCALL MLAS_HALF_TO_FLOAT_KERNEL)(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    );
+
+typedef MLAS_HALF_TO_FLOAT_KERNEL* PMLAS_HALF_TO_FLOAT_KERNEL;
+
+typedef
+void
+(MLASCALL MLAS_FLOAT_TO_HALF_KERNEL)(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+typedef MLAS_FLOAT_TO_HALF_KERNEL* PMLAS_FLOAT_TO_HALF_KERNEL;
+
 extern "C" {
 
 #if defined(MLAS_TARGET_AMD64_IX86)
@@ -518,6 +578,10 @@ extern "C" {
     MLAS_GEMV_FLOAT_KERNEL MlasGemvFloatKernel;
 #endif
 
+#if defined(MLAS_TARGET_ARM64) && defined(MLAS_SVE_SUPPORTED)
+    MLAS_SVE_GEMM_FLOAT_KERNEL MlasSgemmKernelSve;
+#endif
+
 #if defined(MLAS_TARGET_AMD64)
     MLAS_SGEMM_TRANSPOSE_PACKB_BLOCK_ROUTINE MlasSgemmTransposePackB16x4Sse;
     MLAS_SGEMM_TRANSPOSE_PACKB_BLOCK_ROUTINE MlasSgemmTransposePackB16x4Avx;
@@ -534,6 +598,9 @@ extern "C" {
     MLAS_GEMV_U8S8_KERNEL MlasGemvU8S8KernelAvxVnni;
     MLAS_GEMM_U8U8_KERNEL MlasGemmU8U8KernelAvx2;
     MLAS_GEMM_U8U8_KERNEL MlasGemmU8U8KernelAvx512Core;
+#if defined(MLAS_AVX512BF16_SUPPORTED)
+    MLAS_BF16GEMM_KERNEL MlasBf16GemmKernelAvx512Bf16;
+#endif
 #endif
 
 #if defined(MLAS_TARGET_AMD64)
@@ -602,6 +669,13 @@ extern "C" {
     MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL MlasReduceMinimumMaximumF32KernelAvx;
 #endif
 
+    MLAS_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernel;
+    MLAS_FLOAT_TO_HALF_KERNEL MlasConvertFloatToHalfKernel;
+#if defined(MLAS_TARGET_AMD64)
+    MLAS_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernelF16c;
+    MLAS_FLOAT_TO_HALF_KERNEL MlasConvertFloatToHalfKernelF16c;
+#endif
+
 }
 
 //
@@ -648,7 +722,10 @@ MlasSgemmOperation(
     size_t ldb,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor = nullptr,
+    size_t RangeStartM = 0,
+    size_t RangeStartN = 0
     );
 
 //
@@ -683,6 +760,8 @@ struct MLAS_PLATFORM {
 
 #if defined(MLAS_TARGET_AMD64_IX86)
     PMLAS_GEMM_FLOAT_KERNEL GemmFloatKernel;
+    PMLAS_HALF_TO_FLOAT_KERNEL ConvertHalfToFloatKernel;
+    PMLAS_FLOAT_TO_HALF_KERNEL ConvertFloatToHalfKernel;
 #endif
 
 #if defined(MLAS_TARGET_AMD64)
@@ -713,9 +792,14 @@ struct MLAS_PLATFORM {
     PMLAS_COMPUTE_LOGSOFTMAX_OUTPUT_FLOAT_KERNEL ComputeLogSoftmaxOutputF32Kernel;
     PMLAS_REDUCE_MAXIMUM_FLOAT_KERNEL ReduceMaximumF32Kernel;
     PMLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL ReduceMinimumMaximumF32Kernel;
+    PMLAS_BF16GEMM_KERNEL Bf16GemmKernel;
     uint32_t NchwcBlockSize;
     uint32_t PreferredBufferAlignment;
 #endif
+
+#if defined(MLAS_TARGET_ARM64)
+    PMLAS_SVE_GEMM_FLOAT_KERNEL SveGemmFloatKernel;
+#endif
 };
 
 extern MLAS_PLATFORM MlasPlatform;
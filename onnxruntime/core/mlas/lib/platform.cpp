@@ -17,6 +17,22 @@ Abstract:
 
 #include "mlasi.h"
 
+#if defined(MLAS_TARGET_ARM64) && defined(__linux__)
+
+#include <sys/auxv.h>
+
+//
+// Define the hardware capability bits for older toolchains that do not supply
+// them. The kernel unconditionally reports these bits when the features are
+// available.
+//
+
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+
+#endif
+
 //
 // Stores the platform information.
 //
@@ -115,6 +131,8 @@ Return Value:
     //
 
     this->GemmFloatKernel = MlasGemmFloatKernelSse;
+    this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernel;
+    this->ConvertFloatToHalfKernel = MlasConvertFloatToHalfKernel;
 
 #if defined(MLAS_TARGET_AMD64)
 
@@ -140,6 +158,7 @@ Return Value:
     this->ReduceMinimumMaximumF32Kernel = MlasReduceMinimumMaximumF32Kernel;
     this->QLinearAddS8Kernel = MlasQLinearAddS8Kernel;
     this->QLinearAddU8Kernel = MlasQLinearAddU8Kernel;
+    this->Bf16GemmKernel = nullptr;
 
     this->NchwcBlockSize = 8;
     this->PreferredBufferAlignment = MLAS_DEFAULT_PREFERRED_BUFFER_ALIGNMENT;
@@ -187,6 +206,16 @@ Return Value:
             this->ReduceMaximumF32Kernel = MlasReduceMaximumF32KernelAvx;
             this->ReduceMinimumMaximumF32Kernel = MlasReduceMinimumMaximumF32KernelAvx;
 
+            //
+            // Check if the processor supports the F16C conversion instructions.
+            //
+
+            if ((Cpuid1[2] & 0x20000000) != 0) {
+
+                this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernelF16c;
+                this->ConvertFloatToHalfKernel = MlasConvertFloatToHalfKernelF16c;
+            }
+
             //
             // Check if the processor supports AVX2/FMA3 features.
             //
@@ -288,6 +317,20 @@ Return Value:
                             this->GemmU8S8Kernel = MlasGemmU8S8KernelAvx512Vnni;
                             this->GemvU8S8Kernel = MlasGemvU8S8KernelAvx512Vnni;
                         }
+
+#if defined(MLAS_AVX512BF16_SUPPORTED)
+
+                        //
+                        // Check if the processor supports AVX512 BF16
+                        // instructions.
+                        //
+
+                        if ((Cpuid7_1[0] & 0x20) != 0) {
+                            this->Bf16GemmKernel = MlasBf16GemmKernelAvx512Bf16;
+                        }
+
+#endif // MLAS_AVX512BF16_SUPPORTED
+
                     }
 
 #endif // MLAS_AVX512CORE_UNSUPPORTED
@@ -305,6 +348,25 @@ Return Value:
 
 #endif // MLAS_TARGET_AMD64_IX86
 
+#if defined(MLAS_TARGET_ARM64)
+
+    //
+    // Default to the NEON kernels that are always available, then probe the
+    // kernel hardware capability bits for scalable vector support.
+    //
+
+    this->SveGemmFloatKernel = nullptr;
+
+#if defined(MLAS_SVE_SUPPORTED) && defined(__linux__)
+
+    if ((getauxval(AT_HWCAP) & HWCAP_SVE) != 0) {
+        this->SveGemmFloatKernel = MlasSgemmKernelSve;
+    }
+
+#endif
+
+#endif // MLAS_TARGET_ARM64
+
 }
 
 size_t
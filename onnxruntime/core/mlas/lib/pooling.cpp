@@ -315,6 +315,103 @@ Return Value:
     }
 }
 
+template<typename PoolingType>
+void
+MlasPool1DVectorKernel(
+    const MLAS_POOL_WORK_BLOCK* WorkBlock,
+    size_t ChannelCount,
+    const float* Input,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine implements an optimized 1D pooling operation using vector
+    instructions.
+
+    Each pooling window of a 1D operation is a contiguous span of the input
+    row, so the window is reduced with full vectors regardless of the kernel
+    size or stride. This keeps large windows efficient without the sliding
+    reduction buffer used by the higher dimension vectorized kernels.
+
+Arguments:
+
+    WorkBlock - Supplies the structure that contains the pooling parameters.
+
+    ChannelCount - Supplies the number of channels to process.
+
+    Input - Supplies the input tensor.
+
+    Output - Supplies the output tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr size_t WidthShapeIndex = 0;
+
+    const MLAS_POOLING_KIND PoolingKind = WorkBlock->PoolingKind;
+
+    const size_t InputWidth = WorkBlock->InputShape[WidthShapeIndex];
+    const size_t OutputWidth = WorkBlock->OutputShape[WidthShapeIndex];
+
+    const int64_t KernelWidth = WorkBlock->KernelShape[WidthShapeIndex];
+    const int64_t PaddingLeftWidth = WorkBlock->Padding[WidthShapeIndex];
+    const int64_t StrideWidth = WorkBlock->StrideShape[WidthShapeIndex];
+
+    for (size_t c = 0; c < ChannelCount; c++) {
+
+        for (size_t pw = 0; pw < OutputWidth; pw++) {
+
+            const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
+            const int64_t iwEnd64 = iwStart64 + KernelWidth;
+
+            const size_t iwStart = size_t(std::max(iwStart64, int64_t(0)));
+            const size_t iwEnd = size_t(std::min(iwEnd64, int64_t(InputWidth)));
+
+            const float* InputWindow = &Input[iwStart];
+            size_t WindowRemaining = iwEnd - iwStart;
+
+            //
+            // Iterate over the pooling window a vector at a time.
+            //
+
+            MLAS_FLOAT32X4 Reduction = PoolingType::InitialVector();
+
+            while (WindowRemaining >= 4) {
+                Reduction = PoolingType::Reduce(Reduction, MlasLoadFloat32x4(InputWindow));
+                InputWindow += 4;
+                WindowRemaining -= 4;
+            }
+
+            //
+            // Reduce the vector to a single float value and iterate over the
+            // remaining window an element at a time.
+            //
+
+            float ReductionValue = PoolingType::Reduce(Reduction);
+
+            while (WindowRemaining > 0) {
+                ReductionValue = PoolingType::Reduce(ReductionValue, *InputWindow++);
+                WindowRemaining -= 1;
+            }
+
+            if (PoolingKind == MlasAveragePoolingExcludePad) {
+                ReductionValue = PoolingType::AveragePool(ReductionValue, float(iwEnd - iwStart));
+            } else {
+                ReductionValue = PoolingType::AveragePool(ReductionValue, float(KernelWidth));
+            }
+
+            *Output++ = ReductionValue;
+        }
+
+        Input += InputWidth;
+    }
+}
+
 template<typename PoolingType>
 void
 MlasPool2DKernel(
@@ -1104,6 +1201,13 @@ static const PMLAS_POOL_KERNEL_ROUTINE MlasPoolGlobalKernels[] =
     MlasPoolGlobalKernel<MLAS_AVERAGE_POOLING>,
 };
 
+static const PMLAS_POOL_KERNEL_ROUTINE MlasPool1DVectorKernels[] =
+{
+    MlasPool1DVectorKernel<MLAS_MAXIMUM_POOLING>,
+    MlasPool1DVectorKernel<MLAS_AVERAGE_POOLING>,
+    MlasPool1DVectorKernel<MLAS_AVERAGE_POOLING>,
+};
+
 static const PMLAS_POOL_KERNEL_ROUTINE MlasPoolVectorKernels[][2] =
 {
     {
@@ -1255,6 +1359,15 @@ Return Value:
 
         PoolKernelRoutine = MlasPoolGlobalKernels[PoolingKind];
 
+    } else if (Dimensions == 1) {
+
+        //
+        // The pooling window of a 1D operation is contiguous in memory, so
+        // the vectorized kernel supports any kernel size or stride.
+        //
+
+        PoolKernelRoutine = MlasPool1DVectorKernels[PoolingKind];
+
     } else if (Dimensions >= 2 && WorkBlock.StrideShape[Dimensions - 1] <= 2 && AllKernelsAreSmall) {
 
         int64_t ReductionBufferRemaining = MLAS_POOL_REDUCTION_BUFFER_STACK - MLAS_POOL_REDUCTION_BUFFER_PADDING;
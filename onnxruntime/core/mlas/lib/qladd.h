@@ -264,6 +264,19 @@ public:
     }
 };
 
+template <typename SUI, bool IsLow>
+MLAS_FORCEINLINE
+static
+int16x8_t
+MlasExtendToS16Debias(
+    typename SUI::i8x16_t Int8Vector,
+    typename SUI::i8x8_t VectorBias
+    )
+{
+    auto HalfVector = IsLow ? SUI::vget_low_i8(Int8Vector) : SUI::vget_high_i8(Int8Vector);
+    return SUI::vreinterpretq_s16_i16(SUI::vsubl_i8(HalfVector, VectorBias));
+}
+
 #if defined(MLAS_NEON64_INTRINSICS)
 
 #define MlasMoveHighS16S32(s16x8) vmovl_high_s16(s16x8)
@@ -368,4 +381,72 @@ MlasPackS16_128<int8_t>(
     return _mm_packs_epi16(a, b);
 }
 
+template <class DataType, bool IsLow>
+MLAS_FORCEINLINE
+static
+__m128i
+MlasExtendToS16(
+    __m128i Int8Vector,
+    __m128i ZeroVector
+    );
+
+template <>
+MLAS_FORCEINLINE
+__m128i
+MlasExtendToS16<uint8_t, /* bool IsLow = */ true>(
+    __m128i Int8Vector,
+    __m128i ZeroVector
+    )
+{
+    return _mm_unpacklo_epi8(Int8Vector, ZeroVector);
+}
+
+template <>
+MLAS_FORCEINLINE
+__m128i
+MlasExtendToS16<uint8_t, /* bool IsLow = */ false>(
+    __m128i Int8Vector,
+    __m128i ZeroVector
+    )
+{
+    return _mm_unpackhi_epi8(Int8Vector, ZeroVector);
+}
+
+template <>
+MLAS_FORCEINLINE
+__m128i
+MlasExtendToS16<int8_t, /* bool IsLow = */ true>(
+    __m128i Int8Vector,
+    __m128i ZeroVector
+    )
+{
+    MLAS_UNREFERENCED_PARAMETER(ZeroVector);
+    return _mm_srai_epi16(_mm_unpacklo_epi8(Int8Vector, Int8Vector), 8);
+}
+
+template <>
+MLAS_FORCEINLINE
+__m128i
+MlasExtendToS16<int8_t, /* bool IsLow = */ false>(
+    __m128i Int8Vector,
+    __m128i ZeroVector
+    )
+{
+    MLAS_UNREFERENCED_PARAMETER(ZeroVector);
+    return _mm_srai_epi16(_mm_unpackhi_epi8(Int8Vector, Int8Vector), 8);
+}
+
+template <class DataType, bool IsLow>
+MLAS_FORCEINLINE
+static
+__m128i
+MlasExtendToS16Debias(
+    __m128i Int8Vector,
+    __m128i ZeroVector,
+    __m128i VectorBias
+    )
+{
+    return _mm_sub_epi16(MlasExtendToS16<DataType, IsLow>(Int8Vector, ZeroVector), VectorBias);
+}
+
 #endif
@@ -0,0 +1,555 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    qlbinary.cpp
+
+Abstract:
+
+    This module implements the requantizing binary operations beyond linear
+    add and mul: subtract, minimum and maximum.
+
+    The operations are computed in the dequantized domain. Both inputs are
+    debiased to int16, widened and converted to float, scaled, combined with
+    the requested operation, and requantized with the output scale and zero
+    point:
+
+        Output = Saturate(RoundToEven(Op(ScaleA * (A - ZeroPointA),
+                                         ScaleB * (B - ZeroPointB)) / ScaleC) + ZeroPointC)
+
+--*/
+
+#include "qladd.h"
+
+//
+// Each operation supplies the scalar fallback plus the vector combine step
+// for the active instruction set. Everything else is shared.
+//
+
+struct MLAS_QLINEAR_BINARY_OP_SUB
+{
+    static MLAS_FORCEINLINE float Combine(float a, float b)
+    {
+        return a - b;
+    }
+
+#if defined(MLAS_NEON64_INTRINSICS)
+    static MLAS_FORCEINLINE float32x4_t Combine(float32x4_t a, float32x4_t b)
+    {
+        return vsubq_f32(a, b);
+    }
+#elif defined(MLAS_SSE2_INTRINSICS)
+    static MLAS_FORCEINLINE __m128 Combine(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(a, b);
+    }
+#endif
+};
+
+struct MLAS_QLINEAR_BINARY_OP_MIN
+{
+    static MLAS_FORCEINLINE float Combine(float a, float b)
+    {
+        return std::min(a, b);
+    }
+
+#if defined(MLAS_NEON64_INTRINSICS)
+    static MLAS_FORCEINLINE float32x4_t Combine(float32x4_t a, float32x4_t b)
+    {
+        return vminq_f32(a, b);
+    }
+#elif defined(MLAS_SSE2_INTRINSICS)
+    static MLAS_FORCEINLINE __m128 Combine(__m128 a, __m128 b)
+    {
+        return _mm_min_ps(a, b);
+    }
+#endif
+};
+
+struct MLAS_QLINEAR_BINARY_OP_MAX
+{
+    static MLAS_FORCEINLINE float Combine(float a, float b)
+    {
+        return std::max(a, b);
+    }
+
+#if defined(MLAS_NEON64_INTRINSICS)
+    static MLAS_FORCEINLINE float32x4_t Combine(float32x4_t a, float32x4_t b)
+    {
+        return vmaxq_f32(a, b);
+    }
+#elif defined(MLAS_SSE2_INTRINSICS)
+    static MLAS_FORCEINLINE __m128 Combine(__m128 a, __m128 b)
+    {
+        return _mm_max_ps(a, b);
+    }
+#endif
+};
+
+#if defined(MLAS_NEON64_INTRINSICS)
+
+template <typename BinaryOp>
+MLAS_FORCEINLINE
+static
+int16x8_t
+MlasQLinearBinaryOpVectorS16(
+    int16x8_t va_s16x8,
+    int16x8_t vb_s16x8,
+    float32x4_t VectorScaleA,
+    float32x4_t VectorScaleB,
+    float32x4_t VectorScaleC,
+    float32x4_t VectorZeroPointC
+    )
+{
+    auto va_lo_f32 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(va_s16x8))), VectorScaleA);
+    auto va_hi_f32 = vmulq_f32(vcvtq_f32_s32(MlasMoveHighS16S32(va_s16x8)), VectorScaleA);
+    auto vb_lo_f32 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vb_s16x8))), VectorScaleB);
+    auto vb_hi_f32 = vmulq_f32(vcvtq_f32_s32(MlasMoveHighS16S32(vb_s16x8)), VectorScaleB);
+    auto vc_lo_f32 = vaddq_f32(vdivq_f32(BinaryOp::Combine(va_lo_f32, vb_lo_f32), VectorScaleC), VectorZeroPointC);
+    auto vc_hi_f32 = vaddq_f32(vdivq_f32(BinaryOp::Combine(va_hi_f32, vb_hi_f32), VectorScaleC), VectorZeroPointC);
+    // using rounding to nearest, ties to even
+    int32x4_t vc_lo = vcvtnq_s32_f32(vc_lo_f32);
+    int32x4_t vc_hi = vcvtnq_s32_f32(vc_hi_f32);
+    // Pack and saturate.
+    return MlasCombineS16S32(vc_lo, vc_hi);
+}
+
+template<typename DataType, typename BinaryOp, bool IsScalarA, bool IsScalarB>
+static
+void
+MlasQLinearBinaryOpKernel(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N
+    )
+{
+    typedef MLAS_SignedUnsignedIntOps<DataType> SUI;
+
+    const float32x4_t VectorScaleA = vmovq_n_f32(ScaleA);
+    const float32x4_t VectorScaleB = vmovq_n_f32(ScaleB);
+    const float32x4_t VectorScaleC = vmovq_n_f32(ScaleC);
+    const typename SUI::i8x8_t VectorZeroPointA = SUI::vmov_n_i8((DataType)ZeroPointA);
+    const typename SUI::i8x8_t VectorZeroPointB = SUI::vmov_n_i8((DataType)ZeroPointB);
+    const float32x4_t VectorZeroPointC = vmovq_n_f32((float)ZeroPointC);
+
+    typename SUI::T TailDataA[16] = { 0 };
+    typename SUI::T TailDataB[16] = { 0 };
+    int16x8_t va0_s16x8, va1_s16x8, vb0_s16x8, vb1_s16x8;
+
+    if (IsScalarA) {
+        const typename SUI::i8x8_t VectorA0 = SUI::vmov_n_i8(*InputA);
+        va0_s16x8 = SUI::vreinterpretq_s16_i16(SUI::vsubl_i8(VectorA0, VectorZeroPointA));
+        va1_s16x8 = va0_s16x8;
+    }
+
+    if (IsScalarB) {
+        const typename SUI::i8x8_t VectorB0 = SUI::vmov_n_i8(*InputB);
+        vb0_s16x8 = SUI::vreinterpretq_s16_i16(SUI::vsubl_i8(VectorB0, VectorZeroPointB));
+        vb1_s16x8 = vb0_s16x8;
+    }
+
+    while (N > 0) {
+        if (N < 16) {
+            if (!IsScalarA) {
+                MlasCopyTailBytes((uint8_t*)TailDataA, (const uint8_t*)InputA, N);
+                InputA = (const DataType*)TailDataA;
+            }
+            if (!IsScalarB) {
+                MlasCopyTailBytes((uint8_t*)TailDataB, (const uint8_t*)InputB, N);
+                InputB = (const DataType*)TailDataB;
+            }
+        }
+
+        if (!IsScalarA) {
+            const typename SUI::i8x16_t VectorA0 = SUI::vld1q_i8(InputA);
+            InputA += 16;
+            va0_s16x8 = MlasExtendToS16Debias<SUI, /* IsLow = */ true>(VectorA0, VectorZeroPointA);
+            va1_s16x8 = MlasExtendToS16Debias<SUI, /* IsLow = */ false>(VectorA0, VectorZeroPointA);
+        }
+
+        if (!IsScalarB) {
+            const typename SUI::i8x16_t VectorB0 = SUI::vld1q_i8(InputB);
+            InputB += 16;
+            vb0_s16x8 = MlasExtendToS16Debias<SUI, /* IsLow = */ true>(VectorB0, VectorZeroPointB);
+            vb1_s16x8 = MlasExtendToS16Debias<SUI, /* IsLow = */ false>(VectorB0, VectorZeroPointB);
+        }
+
+        const int16x8_t vacc0 = MlasQLinearBinaryOpVectorS16<BinaryOp>(
+            va0_s16x8, vb0_s16x8, VectorScaleA, VectorScaleB, VectorScaleC, VectorZeroPointC);
+        const int16x8_t vacc1 = MlasQLinearBinaryOpVectorS16<BinaryOp>(
+            va1_s16x8, vb1_s16x8, VectorScaleA, VectorScaleB, VectorScaleC, VectorZeroPointC);
+        typename SUI::i8x16_t vc = SUI::combine_i8_s16(vacc0, vacc1);
+
+        if (N >= 16) {
+            N -= 16;
+            SUI::vst1q_i8(OutputC, vc);
+            OutputC += 16;
+        } else {
+            SUI::vst1q_i8(TailDataA, vc);
+            MlasCopyTailBytes((uint8_t*)OutputC, (const uint8_t*)TailDataA, N);
+            N = 0;
+        }
+    }
+}
+
+#elif defined(MLAS_SSE2_INTRINSICS)
+
+template <typename BinaryOp>
+MLAS_FORCEINLINE
+static
+__m128i
+MlasQLinearBinaryOpVectorS16(
+    __m128i va_s16x8,
+    __m128i vb_s16x8,
+    __m128 VectorScaleA,
+    __m128 VectorScaleB,
+    __m128 VectorScaleC,
+    __m128 VectorZeroPointC
+    )
+{
+    const auto va_lo_f32 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(va_s16x8, va_s16x8), 16)), VectorScaleA);
+    const auto va_hi_f32 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(va_s16x8, va_s16x8), 16)), VectorScaleA);
+    const auto vb_lo_f32 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(vb_s16x8, vb_s16x8), 16)), VectorScaleB);
+    const auto vb_hi_f32 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(vb_s16x8, vb_s16x8), 16)), VectorScaleB);
+    const auto vc_lo_f32 = _mm_add_ps(_mm_div_ps(BinaryOp::Combine(va_lo_f32, vb_lo_f32), VectorScaleC), VectorZeroPointC);
+    const auto vc_hi_f32 = _mm_add_ps(_mm_div_ps(BinaryOp::Combine(va_hi_f32, vb_hi_f32), VectorScaleC), VectorZeroPointC);
+    // _mm_cvtps_epi32 rounds to nearest with ties to even, pack saturates.
+    return _mm_packs_epi32(_mm_cvtps_epi32(vc_lo_f32), _mm_cvtps_epi32(vc_hi_f32));
+}
+
+template<typename DataType, typename BinaryOp, bool IsScalarA, bool IsScalarB>
+static
+void
+MlasQLinearBinaryOpKernel(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N
+    )
+{
+    const auto VectorScaleA = MlasBroadcastFloat32x4(ScaleA);
+    const auto VectorScaleB = MlasBroadcastFloat32x4(ScaleB);
+    const auto VectorScaleC = MlasBroadcastFloat32x4(ScaleC);
+    const auto VectorZeroPointA = _mm_set1_epi16((int16_t)ZeroPointA);
+    const auto VectorZeroPointB = _mm_set1_epi16((int16_t)ZeroPointB);
+    const auto VectorZeroPointC = MlasBroadcastFloat32x4((float)ZeroPointC);
+    const auto ZeroVector = _mm_setzero_si128();
+
+    uint8_t TailDataA[16] = { 0 };
+    uint8_t TailDataB[16] = { 0 };
+    __m128i va_lo_s16x8, va_hi_s16x8, vb_lo_s16x8, vb_hi_s16x8;
+
+    if (IsScalarA) {
+        va_lo_s16x8 = _mm_sub_epi16(_mm_set1_epi16((int16_t)*InputA), VectorZeroPointA);
+        va_hi_s16x8 = va_lo_s16x8;
+    }
+
+    if (IsScalarB) {
+        vb_lo_s16x8 = _mm_sub_epi16(_mm_set1_epi16((int16_t)*InputB), VectorZeroPointB);
+        vb_hi_s16x8 = vb_lo_s16x8;
+    }
+
+    while (N > 0) {
+        if (N < 16) {
+            if (!IsScalarA) {
+                MlasCopyTailBytes(TailDataA, (const uint8_t*)InputA, N);
+                InputA = (const DataType*)TailDataA;
+            }
+            if (!IsScalarB) {
+                MlasCopyTailBytes(TailDataB, (const uint8_t*)InputB, N);
+                InputB = (const DataType*)TailDataB;
+            }
+        }
+
+        if (!IsScalarA) {
+            const auto va_i8x16 = _mm_loadu_si128((const MLAS_INT32X4*)InputA);
+            InputA += 16;
+            va_lo_s16x8 = MlasExtendToS16Debias<DataType, true>(va_i8x16, ZeroVector, VectorZeroPointA);
+            va_hi_s16x8 = MlasExtendToS16Debias<DataType, false>(va_i8x16, ZeroVector, VectorZeroPointA);
+        }
+
+        if (!IsScalarB) {
+            const auto vb_i8x16 = _mm_loadu_si128((const MLAS_INT32X4*)InputB);
+            InputB += 16;
+            vb_lo_s16x8 = MlasExtendToS16Debias<DataType, true>(vb_i8x16, ZeroVector, VectorZeroPointB);
+            vb_hi_s16x8 = MlasExtendToS16Debias<DataType, false>(vb_i8x16, ZeroVector, VectorZeroPointB);
+        }
+
+        const auto vc_lo_s16x8 = MlasQLinearBinaryOpVectorS16<BinaryOp>(
+            va_lo_s16x8, vb_lo_s16x8, VectorScaleA, VectorScaleB, VectorScaleC, VectorZeroPointC);
+        const auto vc_hi_s16x8 = MlasQLinearBinaryOpVectorS16<BinaryOp>(
+            va_hi_s16x8, vb_hi_s16x8, VectorScaleA, VectorScaleB, VectorScaleC, VectorZeroPointC);
+        auto vc = MlasPackS16_128<DataType>(vc_lo_s16x8, vc_hi_s16x8);
+
+        if (N >= 16) {
+            _mm_storeu_si128((__m128i*)OutputC, vc);
+            OutputC += 16;
+            N -= 16;
+        } else {
+            _mm_storeu_si128((__m128i*)TailDataA, vc);
+            MlasCopyTailBytes((uint8_t*)OutputC, TailDataA, N);
+            N = 0;
+        }
+    }
+}
+
+#else
+
+// Pure C++ implementation.
+template<typename DataType, typename BinaryOp, bool IsScalarA, bool IsScalarB>
+static
+void
+MlasQLinearBinaryOpKernel(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N
+    )
+{
+    const float MinimumValue = (float)((int)std::numeric_limits<DataType>::min() - ZeroPointC);
+    const float MaximumValue = (float)((int)std::numeric_limits<DataType>::max() - ZeroPointC);
+
+    float ValueA;
+    float ValueB;
+
+    if (IsScalarA) {
+        ValueA = ScaleA * (int32_t(InputA[0]) - ZeroPointA);
+    }
+
+    if (IsScalarB) {
+        ValueB = ScaleB * (int32_t(InputB[0]) - ZeroPointB);
+    }
+
+    for (size_t n = 0; n < N; n++) {
+        if (!IsScalarA) {
+            ValueA = ScaleA * (int32_t(InputA[n]) - ZeroPointA);
+        }
+        if (!IsScalarB) {
+            ValueB = ScaleB * (int32_t(InputB[n]) - ZeroPointB);
+        }
+        float ValueC = BinaryOp::Combine(ValueA, ValueB) / ScaleC;
+        ValueC = std::min(std::max(ValueC, MinimumValue), MaximumValue);
+        OutputC[n] = (DataType)(int32_t)std::nearbyintf(ValueC + ZeroPointC);
+    }
+}
+
+#endif
+
+template<typename DataType, typename BinaryOp>
+static
+void
+MlasQLinearBinaryOp(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N,
+    bool IsScalarA,
+    bool IsScalarB
+    )
+{
+    if (IsScalarA) {
+        MlasQLinearBinaryOpKernel<DataType, BinaryOp, true, false>(
+            InputA, ScaleA, ZeroPointA, InputB, ScaleB, ZeroPointB, ScaleC, ZeroPointC, OutputC, N);
+    } else if (IsScalarB) {
+        MlasQLinearBinaryOpKernel<DataType, BinaryOp, false, true>(
+            InputA, ScaleA, ZeroPointA, InputB, ScaleB, ZeroPointB, ScaleC, ZeroPointC, OutputC, N);
+    } else {
+        MlasQLinearBinaryOpKernel<DataType, BinaryOp, false, false>(
+            InputA, ScaleA, ZeroPointA, InputB, ScaleB, ZeroPointB, ScaleC, ZeroPointC, OutputC, N);
+    }
+}
+
+template <typename DataType>
+void
+MLASCALL
+MlasQLinearSub(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N,
+    bool IsScalarA,
+    bool IsScalarB
+    )
+{
+    MlasQLinearBinaryOp<DataType, MLAS_QLINEAR_BINARY_OP_SUB>(
+        InputA, ScaleA, ZeroPointA, InputB, ScaleB, ZeroPointB, ScaleC, ZeroPointC, OutputC, N,
+        IsScalarA, IsScalarB);
+}
+
+template <typename DataType>
+void
+MLASCALL
+MlasQLinearMin(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N,
+    bool IsScalarB
+    )
+{
+    MlasQLinearBinaryOp<DataType, MLAS_QLINEAR_BINARY_OP_MIN>(
+        InputA, ScaleA, ZeroPointA, InputB, ScaleB, ZeroPointB, ScaleC, ZeroPointC, OutputC, N,
+        false, IsScalarB);
+}
+
+template <typename DataType>
+void
+MLASCALL
+MlasQLinearMax(
+    const DataType* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const DataType* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    DataType* OutputC,
+    size_t N,
+    bool IsScalarB
+    )
+{
+    MlasQLinearBinaryOp<DataType, MLAS_QLINEAR_BINARY_OP_MAX>(
+        InputA, ScaleA, ZeroPointA, InputB, ScaleB, ZeroPointB, ScaleC, ZeroPointC, OutputC, N,
+        false, IsScalarB);
+}
+
+// Explicit instantiation
+template
+void
+MlasQLinearSub<uint8_t>(
+    const uint8_t* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const uint8_t* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    uint8_t* OutputC,
+    size_t N,
+    bool IsScalarA,
+    bool IsScalarB
+    );
+
+template
+void
+MlasQLinearSub<int8_t>(
+    const int8_t* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const int8_t* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    int8_t* OutputC,
+    size_t N,
+    bool IsScalarA,
+    bool IsScalarB
+    );
+
+template
+void
+MlasQLinearMin<uint8_t>(
+    const uint8_t* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const uint8_t* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    uint8_t* OutputC,
+    size_t N,
+    bool IsScalarB
+    );
+
+template
+void
+MlasQLinearMin<int8_t>(
+    const int8_t* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const int8_t* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    int8_t* OutputC,
+    size_t N,
+    bool IsScalarB
+    );
+
+template
+void
+MlasQLinearMax<uint8_t>(
+    const uint8_t* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const uint8_t* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    uint8_t* OutputC,
+    size_t N,
+    bool IsScalarB
+    );
+
+template
+void
+MlasQLinearMax<int8_t>(
+    const int8_t* InputA,
+    float ScaleA,
+    int32_t ZeroPointA,
+    const int8_t* InputB,
+    float ScaleB,
+    int32_t ZeroPointB,
+    float ScaleC,
+    int32_t ZeroPointC,
+    int8_t* OutputC,
+    size_t N,
+    bool IsScalarB
+    );
@@ -287,6 +287,341 @@ MlasQuantizeLinear<uint8_t>(
     uint8_t ZeroPoint
     );
 
+#if defined(MLAS_NEON64_INTRINSICS) || defined(MLAS_SSE2_INTRINSICS)
+
+//
+// RequantizeLinear implementation using NEON or SSE2 intrinsics.
+//
+
+template<typename InputType>
+MLAS_INT32X4
+MlasRequantizeLinearUnpackBytes(
+    MLAS_INT32X4 IntegerVector
+    );
+
+#if defined(MLAS_NEON64_INTRINSICS)
+
+template<>
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasRequantizeLinearUnpackBytes<uint8_t>(
+    MLAS_INT32X4 IntegerVector
+    )
+{
+    //
+    // Zero extend the least significant four bytes of the vector register to
+    // int32_t elements.
+    //
+
+    uint16x8_t WordVector = vmovl_u8(vget_low_u8(vreinterpretq_u8_s32(IntegerVector)));
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(WordVector)));
+}
+
+template<>
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasRequantizeLinearUnpackBytes<int8_t>(
+    MLAS_INT32X4 IntegerVector
+    )
+{
+    //
+    // Sign extend the least significant four bytes of the vector register to
+    // int32_t elements.
+    //
+
+    int16x8_t WordVector = vmovl_s8(vget_low_s8(vreinterpretq_s8_s32(IntegerVector)));
+    return vmovl_s16(vget_low_s16(WordVector));
+}
+
+#else
+
+template<>
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasRequantizeLinearUnpackBytes<uint8_t>(
+    MLAS_INT32X4 IntegerVector
+    )
+{
+    IntegerVector = _mm_unpacklo_epi8(IntegerVector, _mm_setzero_si128());
+    IntegerVector = _mm_unpacklo_epi16(IntegerVector, _mm_setzero_si128());
+
+    return IntegerVector;
+}
+
+template<>
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasRequantizeLinearUnpackBytes<int8_t>(
+    MLAS_INT32X4 IntegerVector
+    )
+{
+    IntegerVector = _mm_unpacklo_epi8(IntegerVector, IntegerVector);
+    IntegerVector = _mm_unpacklo_epi16(IntegerVector, IntegerVector);
+
+    return _mm_srai_epi32(IntegerVector, 24);
+}
+
+#endif
+
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasRequantizeLinearVector(
+    MLAS_INT32X4 IntegerVector,
+    MLAS_FLOAT32X4 ScaleRatioVector,
+    MLAS_FLOAT32X4 MinimumValueVector,
+    MLAS_FLOAT32X4 MaximumValueVector,
+    MLAS_INT32X4 InputZeroPointVector,
+    MLAS_INT32X4 OutputZeroPointVector
+    )
+{
+    //
+    // Shift the input range using the input zero point value, convert to
+    // float, and rescale the values using the ratio of the quantization
+    // scales. Clamp the values to the minimum and maximum range (adjusted by
+    // the output zero point value).
+    //
+
+#if defined(MLAS_NEON64_INTRINSICS)
+    IntegerVector = vsubq_s32(IntegerVector, InputZeroPointVector);
+    MLAS_FLOAT32X4 FloatVector = vcvtq_f32_s32(IntegerVector);
+    FloatVector = vmulq_f32(FloatVector, ScaleRatioVector);
+    FloatVector = vmaxnmq_f32(FloatVector, MinimumValueVector);
+    FloatVector = vminnmq_f32(FloatVector, MaximumValueVector);
+#else
+    IntegerVector = _mm_sub_epi32(IntegerVector, InputZeroPointVector);
+    MLAS_FLOAT32X4 FloatVector = _mm_cvtepi32_ps(IntegerVector);
+    FloatVector = _mm_mul_ps(FloatVector, ScaleRatioVector);
+    FloatVector = _mm_max_ps(FloatVector, MinimumValueVector);
+    FloatVector = _mm_min_ps(FloatVector, MaximumValueVector);
+#endif
+
+    //
+    // Convert the float values to integer using "round to nearest even" and
+    // then shift the output range using the output zero point value.
+    //
+
+#if defined(MLAS_NEON64_INTRINSICS)
+    IntegerVector = vcvtnq_s32_f32(FloatVector);
+    IntegerVector = vaddq_s32(IntegerVector, OutputZeroPointVector);
+#else
+    // N.B. Assumes MXCSR has been configured with the default rounding mode of
+    // "round to nearest even".
+    IntegerVector = _mm_cvtps_epi32(FloatVector);
+    IntegerVector = _mm_add_epi32(IntegerVector, OutputZeroPointVector);
+#endif
+
+    return IntegerVector;
+}
+
+template<typename InputType, typename OutputType>
+void
+MLASCALL
+MlasRequantizeLinear(
+    const InputType* Input,
+    OutputType* Output,
+    size_t N,
+    float InputScale,
+    InputType InputZeroPoint,
+    float OutputScale,
+    OutputType OutputZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine requantizes the input buffer to a new quantization scale and
+    zero point in a single pass, which is equivalent to dequantizing the input
+    buffer and quantizing the intermediate float values.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    InputScale - Supplies the quantization scale of the input buffer.
+
+    InputZeroPoint - Supplies the quantization zero point value of the input
+        buffer.
+
+    OutputScale - Supplies the quantization scale of the output buffer.
+
+    OutputZeroPoint - Supplies the quantization zero point value of the output
+        buffer.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr int32_t MinimumValue = std::numeric_limits<OutputType>::min();
+    constexpr int32_t MaximumValue = std::numeric_limits<OutputType>::max();
+
+    const float ScaleRatio = InputScale / OutputScale;
+
+    auto ScaleRatioVector = MlasBroadcastFloat32x4(ScaleRatio);
+    auto MinimumValueVector = MlasBroadcastFloat32x4(float(MinimumValue - OutputZeroPoint));
+    auto MaximumValueVector = MlasBroadcastFloat32x4(float(MaximumValue - OutputZeroPoint));
+    auto InputZeroPointVector = MlasBroadcastInt32x4(InputZeroPoint);
+    auto OutputZeroPointVector = MlasBroadcastInt32x4(OutputZeroPoint);
+
+    while (N >= 4) {
+
+#if defined(MLAS_NEON64_INTRINSICS)
+        auto ByteVector = vreinterpretq_s32_u32(vld1q_dup_u32((const uint32_t*)Input));
+#else
+        auto ByteVector = _mm_cvtsi32_si128(*((const int32_t*)Input));
+#endif
+
+        auto IntegerVector = MlasRequantizeLinearUnpackBytes<InputType>(ByteVector);
+        IntegerVector = MlasRequantizeLinearVector(IntegerVector, ScaleRatioVector,
+            MinimumValueVector, MaximumValueVector, InputZeroPointVector, OutputZeroPointVector);
+
+        IntegerVector = MlasQuantizeLinearPackBytes<OutputType>(IntegerVector);
+
+#if defined(MLAS_NEON64_INTRINSICS)
+        vst1q_lane_s32((int32_t*)Output, IntegerVector, 0);
+#else
+        *((int32_t*)Output) = _mm_cvtsi128_si32(IntegerVector);
+#endif
+
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    for (size_t n = 0; n < N; n++) {
+
+        float FloatValue = std::nearbyintf(float(int32_t(Input[n]) - InputZeroPoint) * ScaleRatio);
+        FloatValue += float(OutputZeroPoint);
+        FloatValue = std::max(FloatValue, float(MinimumValue));
+        FloatValue = std::min(FloatValue, float(MaximumValue));
+        Output[n] = (OutputType)(int32_t)FloatValue;
+    }
+}
+
+#else
+
+//
+// RequantizeLinear implementation using the C++ runtime.
+//
+
+template<typename InputType, typename OutputType>
+void
+MLASCALL
+MlasRequantizeLinear(
+    const InputType* Input,
+    OutputType* Output,
+    size_t N,
+    float InputScale,
+    InputType InputZeroPoint,
+    float OutputScale,
+    OutputType OutputZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine requantizes the input buffer to a new quantization scale and
+    zero point in a single pass, which is equivalent to dequantizing the input
+    buffer and quantizing the intermediate float values.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    InputScale - Supplies the quantization scale of the input buffer.
+
+    InputZeroPoint - Supplies the quantization zero point value of the input
+        buffer.
+
+    OutputScale - Supplies the quantization scale of the output buffer.
+
+    OutputZeroPoint - Supplies the quantization zero point value of the output
+        buffer.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr int32_t MinimumValue = std::numeric_limits<OutputType>::min();
+    constexpr int32_t MaximumValue = std::numeric_limits<OutputType>::max();
+
+    const float ScaleRatio = InputScale / OutputScale;
+
+    for (size_t n = 0; n < N; n++) {
+
+        float FloatValue = std::nearbyintf(float(int32_t(Input[n]) - InputZeroPoint) * ScaleRatio);
+        FloatValue += float(OutputZeroPoint);
+        FloatValue = std::max(FloatValue, float(MinimumValue));
+        FloatValue = std::min(FloatValue, float(MaximumValue));
+        Output[n] = (OutputType)(int32_t)FloatValue;
+    }
+}
+
+#endif
+
+template
+void
+MLASCALL
+MlasRequantizeLinear<int8_t, int8_t>(
+    const int8_t* Input,
+    int8_t* Output,
+    size_t N,
+    float InputScale,
+    int8_t InputZeroPoint,
+    float OutputScale,
+    int8_t OutputZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasRequantizeLinear<uint8_t, uint8_t>(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t N,
+    float InputScale,
+    uint8_t InputZeroPoint,
+    float OutputScale,
+    uint8_t OutputZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasRequantizeLinear<int8_t, uint8_t>(
+    const int8_t* Input,
+    uint8_t* Output,
+    size_t N,
+    float InputScale,
+    int8_t InputZeroPoint,
+    float OutputScale,
+    uint8_t OutputZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasRequantizeLinear<uint8_t, int8_t>(
+    const uint8_t* Input,
+    int8_t* Output,
+    size_t N,
+    float InputScale,
+    uint8_t InputZeroPoint,
+    float OutputScale,
+    int8_t OutputZeroPoint
+    );
+
 #if defined(MLAS_SSE2_INTRINSICS)
 
 void
@@ -902,3 +1237,71 @@ Return Value:
     MlasReduceMinimumMaximumF32Kernel(Input, Min, Max, N);
 #endif
 }
+
+void
+MLASCALL
+MlasDynamicQuantizeLinear(
+    const float* Input,
+    uint8_t* Output,
+    size_t N,
+    float* Scale,
+    uint8_t* ZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine quantizes the input buffer as uint8 using quantization
+    parameters computed from the range of the data, fusing the range
+    reduction, the parameter derivation and the quantization behind a single
+    call. The range is extended to include zero so that zero is exactly
+    representable, as required by the ONNX DynamicQuantizeLinear operator.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    Scale - Returns the computed quantization scale.
+
+    ZeroPoint - Returns the computed quantization zero point value.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr float QuantizedMinimum = float(std::numeric_limits<uint8_t>::min());
+    constexpr float QuantizedMaximum = float(std::numeric_limits<uint8_t>::max());
+
+    float Minimum;
+    float Maximum;
+    MlasFindMinMaxElement(Input, &Minimum, &Maximum, N);
+
+    //
+    // Extend the range to include zero and guard against a constant input
+    // buffer that would otherwise produce a zero scale.
+    //
+
+    Minimum = std::min(Minimum, 0.0f);
+    Maximum = std::max(Maximum, 0.0f);
+
+    const float ScaleValue = (Maximum == Minimum) ? 1.0f :
+        (Maximum - Minimum) / (QuantizedMaximum - QuantizedMinimum);
+
+    float InitialZeroPoint = QuantizedMinimum - Minimum / ScaleValue;
+    InitialZeroPoint = std::min(QuantizedMaximum, std::max(QuantizedMinimum, InitialZeroPoint));
+
+    // N.B. Assumes the rounding mode is "round to nearest even" to match the
+    // quantization kernels below.
+    const uint8_t ZeroPointValue = (uint8_t)(int32_t)std::nearbyintf(InitialZeroPoint);
+
+    *Scale = ScaleValue;
+    *ZeroPoint = ZeroPointValue;
+
+    MlasQuantizeLinear(Input, Output, N, ScaleValue, ZeroPointValue);
+}
@@ -41,13 +41,18 @@ struct MLAS_SGEMM_WORK_BLOCK {
     size_t K;
     const float* A;
     size_t lda;
+    size_t StrideA;
     const float* B;
     size_t ldb;
+    size_t StrideB;
     const void* PackedB;
     float* C;
     size_t ldc;
+    size_t StrideC;
+    size_t BatchCount;
     float alpha;
     float beta;
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor;
 };
 
 void
@@ -816,6 +821,11 @@ Return Value:
 #elif defined(MLAS_TARGET_POWER)
         RowsHandled = MlasSgemmKernel(A, B, C, CountK, CountM, CountN, lda, ldc, alpha, ZeroMode);
 #else
+#if defined(MLAS_TARGET_ARM64)
+        if (MlasPlatform.SveGemmFloatKernel != nullptr) {
+            RowsHandled = MlasPlatform.SveGemmFloatKernel(A, B, C, CountK, CountM, CountN, lda, ldc, alpha, ZeroMode);
+        } else
+#endif
         if (ZeroMode) {
             RowsHandled = MlasSgemmKernelZero(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
         } else {
@@ -846,7 +856,10 @@ MlasSgemmOperation(
     size_t ldb,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor,
+    size_t RangeStartM,
+    size_t RangeStartN
     )
 /*++
 
@@ -884,6 +897,15 @@ Arguments:
 
     ldc - Supplies the first dimension of matrix C.
 
+    PostProcessor - Optionally supplies a processor applied to each output
+        block while it is still cache resident, after its last accumulation.
+
+    RangeStartM - Supplies the row offset of matrix C within the full output
+        matrix, used by the post processor to index auxiliary vectors.
+
+    RangeStartN - Supplies the column offset of matrix C within the full
+        output matrix, used by the post processor to index auxiliary vectors.
+
 Return Value:
 
     None.
@@ -913,6 +935,9 @@ Return Value:
 
         if (SgemmKernelM1Routine != nullptr) {
             SgemmKernelM1Routine(A, B, C, K, N, ldb, beta);
+            if (PostProcessor != nullptr) {
+                PostProcessor->Process(C, RangeStartM, RangeStartN, 1, N, ldc);
+            }
             return;
         }
 
@@ -920,6 +945,9 @@ Return Value:
 
         if (TransB == CblasNoTrans) {
             MlasGemvFloatKernel(A, B, C, K, N, ldb, (beta == 0.0f));
+            if (PostProcessor != nullptr) {
+                PostProcessor->Process(C, RangeStartM, RangeStartN, 1, N, ldc);
+            }
             return;
         }
 
@@ -948,6 +976,9 @@ Return Value:
 
         if (SgemmKernelM1Routine != nullptr) {
             SgemmKernelM1Routine(B, A, C, K, M, lda, beta);
+            if (PostProcessor != nullptr) {
+                PostProcessor->Process(C, RangeStartM, RangeStartN, M, 1, ldc);
+            }
             return;
         }
 
@@ -1059,6 +1090,15 @@ Return Value:
 
             ZeroMode = false;
         }
+
+        //
+        // Apply the post processor to the block while it is still resident in
+        // the cache, now that the last K slice has been accumulated.
+        //
+
+        if (PostProcessor != nullptr) {
+            PostProcessor->Process(C + n, RangeStartM, RangeStartN + n, M, CountN, ldc);
+        }
     }
 }
 
@@ -1076,7 +1116,9 @@ MlasSgemmPackedOperation(
     size_t AlignedN,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor,
+    size_t RangeStartM
     )
 /*++
 
@@ -1116,6 +1158,12 @@ Arguments:
 
     ldc - Supplies the first dimension of matrix C.
 
+    PostProcessor - Optionally supplies a processor applied to each output
+        block while it is still cache resident, after its last accumulation.
+
+    RangeStartM - Supplies the row offset of matrix C within the full output
+        matrix, used by the post processor to index auxiliary vectors.
+
 Return Value:
 
     None.
@@ -1195,6 +1243,15 @@ Return Value:
 
             ZeroMode = false;
         }
+
+        //
+        // Apply the post processor to the block while it is still resident in
+        // the cache, now that the last K slice has been accumulated.
+        //
+
+        if (PostProcessor != nullptr) {
+            PostProcessor->Process(C + n, RangeStartM, SliceStartN, M, CountN, ldc);
+        }
     }
 }
 
@@ -1227,6 +1284,16 @@ Return Value:
     const int32_t ThreadCountM = WorkBlock->ThreadCountM;
     const int32_t ThreadCountN = WorkBlock->ThreadCountN;
 
+    //
+    // Extract the batch index from the thread index. Each matrix of a batched
+    // operation is partitioned by the same two dimensional grid of threads.
+    //
+
+    const int32_t ThreadsPerGemm = ThreadCountM * ThreadCountN;
+    const size_t BatchIndex = size_t(ThreadId) / size_t(ThreadsPerGemm);
+
+    ThreadId -= int32_t(BatchIndex) * ThreadsPerGemm;
+
     const int32_t ThreadIdM = ThreadId / ThreadCountN;
     const int32_t ThreadIdN = ThreadId % ThreadCountN;
 
@@ -1268,8 +1335,9 @@ Return Value:
     const size_t lda = WorkBlock->lda;
     const size_t ldc = WorkBlock->ldc;
 
-    const float* A = WorkBlock->A + RangeStartM * ((TransA == CblasNoTrans) ? lda : 1);
-    float* C = WorkBlock->C + RangeStartM * ldc + RangeStartN;
+    const float* A = WorkBlock->A + BatchIndex * WorkBlock->StrideA +
+        RangeStartM * ((TransA == CblasNoTrans) ? lda : 1);
+    float* C = WorkBlock->C + BatchIndex * WorkBlock->StrideC + RangeStartM * ldc + RangeStartN;
 
     if (WorkBlock->B != nullptr) {
 
@@ -1277,16 +1345,19 @@ Return Value:
 
         const size_t ldb = WorkBlock->ldb;
 
-        const float* B = WorkBlock->B + RangeStartN * ((TransB == CblasNoTrans) ? 1 : ldb);
+        const float* B = WorkBlock->B + BatchIndex * WorkBlock->StrideB +
+            RangeStartN * ((TransB == CblasNoTrans) ? 1 : ldb);
 
         MlasSgemmOperation(TransA, TransB, RangeCountM, RangeCountN, WorkBlock->K,
-            WorkBlock->alpha, A, lda, B, ldb, WorkBlock->beta, C, ldc);
+            WorkBlock->alpha, A, lda, B, ldb, WorkBlock->beta, C, ldc,
+            WorkBlock->PostProcessor, RangeStartM, RangeStartN);
 
     } else {
 
         MlasSgemmPackedOperation(TransA, RangeCountM, RangeStartN, RangeCountN,
             WorkBlock->K, WorkBlock->alpha, A, lda, WorkBlock->PackedB,
-            BlockedN * MLAS_SGEMM_STRIDEN_THREAD_ALIGN, WorkBlock->beta, C, ldc);
+            BlockedN * MLAS_SGEMM_STRIDEN_THREAD_ALIGN, WorkBlock->beta, C, ldc,
+            WorkBlock->PostProcessor, RangeStartM);
     }
 }
 
@@ -1318,13 +1389,14 @@ Return Value:
     const size_t M = WorkBlock->M;
     const size_t N = WorkBlock->N;
     const size_t K = WorkBlock->K;
+    const size_t BatchCount = WorkBlock->BatchCount;
 
     //
     // Compute the number of target threads given the complexity of the SGEMM
     // operation. Small requests should run using the single threaded path.
     //
 
-    const double Complexity = double(M) * double(N) * double(K);
+    const double Complexity = double(M) * double(N) * double(K) * double(BatchCount);
 
     int32_t TargetThreadCount;
 
@@ -1340,6 +1412,18 @@ Return Value:
         TargetThreadCount = MaximumThreadCount;
     }
 
+    //
+    // Distribute the target threads across the matrices of the batch. Small
+    // matrices are executed whole per thread, so a batch of such operations
+    // saturates the cores without per-matrix scheduling overhead.
+    //
+
+    int32_t ThreadsPerGemm = TargetThreadCount / int32_t(BatchCount);
+
+    if (ThreadsPerGemm < 1) {
+        ThreadsPerGemm = 1;
+    }
+
     //
     // Segment the operation across multiple threads.
     //
@@ -1352,24 +1436,25 @@ Return Value:
         const size_t BlockedN = (N + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) /
             MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
 
-        if (size_t(TargetThreadCount) > BlockedN) {
-            TargetThreadCount = int32_t(BlockedN);
+        if (size_t(ThreadsPerGemm) > BlockedN) {
+            ThreadsPerGemm = int32_t(BlockedN);
         }
 
         WorkBlock->ThreadCountM = 1;
-        WorkBlock->ThreadCountN = TargetThreadCount;
+        WorkBlock->ThreadCountN = ThreadsPerGemm;
 
     } else {
 
-        if (size_t(TargetThreadCount) > M) {
-            TargetThreadCount = int32_t(M);
+        if (size_t(ThreadsPerGemm) > M) {
+            ThreadsPerGemm = int32_t(M);
         }
 
-        WorkBlock->ThreadCountM = TargetThreadCount;
+        WorkBlock->ThreadCountM = ThreadsPerGemm;
         WorkBlock->ThreadCountN = 1;
     }
 
-    MlasExecuteThreaded(MlasSgemmThreaded, WorkBlock, TargetThreadCount, ThreadPool);
+    MlasExecuteThreaded(MlasSgemmThreaded, WorkBlock,
+        int32_t(ThreadsPerGemm * int32_t(BatchCount)), ThreadPool);
 }
 
 void
@@ -1388,7 +1473,8 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor
     )
 /*++
 
@@ -1429,6 +1515,10 @@ Arguments:
     ThreadPool - Supplies the thread pool object to use, else nullptr if the
         base library threading support should be used.
 
+    PostProcessor - Optionally supplies a processor applied to each output
+        block while it is still cache resident, saving a pass over the output
+        matrix after the multiply completes.
+
 Return Value:
 
     None.
@@ -1456,6 +1546,8 @@ Return Value:
     WorkBlock.ldc = ldc;
     WorkBlock.alpha = alpha;
     WorkBlock.beta = beta;
+    WorkBlock.BatchCount = 1;
+    WorkBlock.PostProcessor = PostProcessor;
 
     //
     // Schedule the operation across a set of worker threads.
@@ -1478,7 +1570,8 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_POSTPROCESSOR* PostProcessor
     )
 /*++
 
@@ -1515,6 +1608,10 @@ Arguments:
     ThreadPool - Supplies the thread pool object to use, else nullptr if the
         base library threading support should be used.
 
+    PostProcessor - Optionally supplies a processor applied to each output
+        block while it is still cache resident, saving a pass over the output
+        matrix after the multiply completes.
+
 Return Value:
 
     None.
@@ -1540,6 +1637,128 @@ Return Value:
     WorkBlock.ldc = ldc;
     WorkBlock.alpha = alpha;
     WorkBlock.beta = beta;
+    WorkBlock.BatchCount = 1;
+    WorkBlock.PostProcessor = PostProcessor;
+
+    //
+    // Schedule the operation across a set of worker threads.
+    //
+
+    MlasSgemmSchedule(&WorkBlock, ThreadPool);
+}
+
+void
+MLASCALL
+MlasGemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    size_t StrideA,
+    const float* B,
+    size_t ldb,
+    size_t StrideB,
+    float beta,
+    float* C,
+    size_t ldc,
+    size_t StrideC,
+    size_t BatchCount,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements a batch of single precision matrix/matrix
+    multiply operations (SGEMM) with identical dimensions and a constant
+    stride between the matrices of consecutive operations.
+
+    The batch is scheduled with a single work partition across all of the
+    operations, so many small multiplies occupy the available threads rather
+    than serializing behind per-operation scheduling.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for the matrices A.
+
+    TransB - Supplies the transpose operation for the matrices B.
+
+    M - Supplies the number of rows of the matrices A and the matrices C.
+
+    N - Supplies the number of columns of the matrices B and the matrices C.
+
+    K - Supplies the number of columns of the matrices A and the number of
+        rows of the matrices B.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of the first matrix A.
+
+    lda - Supplies the first dimension of the matrices A.
+
+    StrideA - Supplies the number of elements between the matrices A of
+        consecutive operations.
+
+    B - Supplies the address of the first matrix B.
+
+    ldb - Supplies the first dimension of the matrices B.
+
+    StrideB - Supplies the number of elements between the matrices B of
+        consecutive operations.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of the first matrix C.
+
+    ldc - Supplies the first dimension of the matrices C.
+
+    StrideC - Supplies the number of elements between the matrices C of
+        consecutive operations.
+
+    BatchCount - Supplies the number of operations to execute.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (BatchCount == 0) {
+        return;
+    }
+
+    MLAS_SGEMM_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the GEMM parameters to the work block.
+    //
+
+    memset(&WorkBlock, 0, sizeof(MLAS_SGEMM_WORK_BLOCK));
+
+    WorkBlock.TransA = TransA;
+    WorkBlock.TransB = TransB;
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.K = K;
+    WorkBlock.A = A;
+    WorkBlock.lda = lda;
+    WorkBlock.StrideA = StrideA;
+    WorkBlock.B = B;
+    WorkBlock.ldb = ldb;
+    WorkBlock.StrideB = StrideB;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+    WorkBlock.StrideC = StrideC;
+    WorkBlock.alpha = alpha;
+    WorkBlock.beta = beta;
+    WorkBlock.BatchCount = BatchCount;
 
     //
     // Schedule the operation across a set of worker threads.
@@ -1648,3 +1867,169 @@ Return Value:
         PackedB = (float*)PackedB + AlignedN * CountK;
     }
 }
+
+//
+// Define the parameters to execute segments of a sparse GEMM operation on
+// worker threads.
+//
+
+struct MLAS_SPARSE_GEMM_WORK_BLOCK {
+    int32_t ThreadCount;
+    size_t M;
+    size_t N;
+    const float* A;
+    size_t lda;
+    const float* BValues;
+    const int32_t* BRowIndices;
+    const int32_t* BColumnOffsets;
+    float* C;
+    size_t ldc;
+};
+
+void
+MlasSparseGemmThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    sparse GEMM operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_SPARSE_GEMM_WORK_BLOCK*)Context;
+
+    //
+    // Partition the rows of matrix A across the available threads. Each output
+    // row is computed independently by walking the nonzero entries of each
+    // column of matrix B.
+    //
+
+    size_t RowIndex;
+    size_t RowsRemaining;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCount, WorkBlock->M, &RowIndex, &RowsRemaining);
+
+    const size_t N = WorkBlock->N;
+    const float* BValues = WorkBlock->BValues;
+    const int32_t* BRowIndices = WorkBlock->BRowIndices;
+    const int32_t* BColumnOffsets = WorkBlock->BColumnOffsets;
+
+    const float* a = WorkBlock->A + RowIndex * WorkBlock->lda;
+    float* c = WorkBlock->C + RowIndex * WorkBlock->ldc;
+
+    while (RowsRemaining-- > 0) {
+
+        for (size_t n = 0; n < N; n++) {
+
+            float Accumulator = 0.0f;
+
+            for (int32_t i = BColumnOffsets[n]; i < BColumnOffsets[n + 1]; i++) {
+                Accumulator += a[BRowIndices[i]] * BValues[i];
+            }
+
+            c[n] = Accumulator;
+        }
+
+        a += WorkBlock->lda;
+        c += WorkBlock->ldc;
+    }
+}
+
+void
+MLASCALL
+MlasSparseGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const float* A,
+    size_t lda,
+    const float* BValues,
+    const int32_t* BRowIndices,
+    const int32_t* BColumnOffsets,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single precision matrix/matrix multiply
+    operation C = A * B, where matrix B is supplied in compressed sparse
+    column form and only its nonzero entries are visited.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    BValues - Supplies the nonzero values of matrix B in column major order.
+
+    BRowIndices - Supplies the row index of each entry of BValues.
+
+    BColumnOffsets - Supplies N+1 offsets into BValues bounding the entries
+        of each column of matrix B.
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_UNREFERENCED_PARAMETER(K);
+
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    MLAS_SPARSE_GEMM_WORK_BLOCK WorkBlock;
+
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.A = A;
+    WorkBlock.lda = lda;
+    WorkBlock.BValues = BValues;
+    WorkBlock.BRowIndices = BRowIndices;
+    WorkBlock.BColumnOffsets = BColumnOffsets;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+
+    int32_t ThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (size_t(ThreadCount) > M) {
+        ThreadCount = int32_t(M);
+    }
+
+    WorkBlock.ThreadCount = ThreadCount;
+
+    MlasExecuteThreaded(MlasSparseGemmThreaded, &WorkBlock, ThreadCount, ThreadPool);
+}
@@ -295,3 +295,238 @@ Return Value:
         n -= 1;
     }
 }
+
+#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
+
+MLAS_FORCEINLINE
+void
+MlasTranspose4x4Block(
+    const uint32_t* Input,
+    size_t InputStride,
+    uint32_t* Output,
+    size_t OutputStride
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes a four by four element block from the input
+    matrix to the output matrix.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    InputStride - Supplies the number of elements between rows of the input
+        matrix.
+
+    Output - Supplies the output buffer.
+
+    OutputStride - Supplies the number of elements between rows of the output
+        matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    __m128i a0 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 0]);
+    __m128i a1 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 1]);
+    __m128i a2 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 2]);
+    __m128i a3 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 3]);
+
+    __m128i b0 = _mm_unpacklo_epi32(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi32(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi32(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi32(a2, a3);
+
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 0], _mm_unpacklo_epi64(b0, b2));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 1], _mm_unpackhi_epi64(b0, b2));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 2], _mm_unpacklo_epi64(b1, b3));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 3], _mm_unpackhi_epi64(b1, b3));
+
+#elif defined(MLAS_NEON_INTRINSICS)
+
+    uint32x4_t a0 = vld1q_u32(&Input[InputStride * 0]);
+    uint32x4_t a1 = vld1q_u32(&Input[InputStride * 1]);
+    uint32x4x2_t b0 = vzipq_u32(a0, a1);
+
+    uint32x4_t a2 = vld1q_u32(&Input[InputStride * 2]);
+    uint32x4_t a3 = vld1q_u32(&Input[InputStride * 3]);
+    uint32x4x2_t b1 = vzipq_u32(a2, a3);
+
+    uint32x2x2_t c0 = { vget_low_u32(b0.val[0]), vget_low_u32(b1.val[0]) };
+    uint32x2x2_t c1 = { vget_high_u32(b0.val[0]), vget_high_u32(b1.val[0]) };
+    uint32x2x2_t c2 = { vget_low_u32(b0.val[1]), vget_low_u32(b1.val[1]) };
+    uint32x2x2_t c3 = { vget_high_u32(b0.val[1]), vget_high_u32(b1.val[1]) };
+
+    vst1_u32(&Output[OutputStride * 0], c0.val[0]);
+    vst1_u32(&Output[OutputStride * 0 + 2], c0.val[1]);
+    vst1_u32(&Output[OutputStride * 1], c1.val[0]);
+    vst1_u32(&Output[OutputStride * 1 + 2], c1.val[1]);
+    vst1_u32(&Output[OutputStride * 2], c2.val[0]);
+    vst1_u32(&Output[OutputStride * 2 + 2], c2.val[1]);
+    vst1_u32(&Output[OutputStride * 3], c3.val[0]);
+    vst1_u32(&Output[OutputStride * 3 + 2], c3.val[1]);
+
+#endif
+
+}
+
+#endif
+
+MLAS_FORCEINLINE
+void
+MlasTranspose4xNVector(
+    const uint32_t* Input,
+    size_t InputStride,
+    uint32_t* Output,
+    size_t OutputStride
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes a four element vector from the input matrix to
+    the output matrix.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    InputStride - Supplies the number of elements between rows of the input
+        matrix.
+
+    Output - Supplies the output buffer.
+
+    OutputStride - Supplies the number of elements between rows of the output
+        matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    uint32_t a0 = Input[InputStride * 0];
+    uint32_t a1 = Input[InputStride * 1];
+    uint32_t a2 = Input[InputStride * 2];
+    uint32_t a3 = Input[InputStride * 3];
+
+    Output[OutputStride * 0] = a0;
+    Output[OutputStride * 1] = a1;
+    Output[OutputStride * 2] = a2;
+    Output[OutputStride * 3] = a3;
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns).
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    size_t n = N;
+
+    //
+    // Transpose elements from the input matrix to the output matrix 4 columns
+    // at a time.
+    //
+
+    while (n >= 4) {
+
+        const uint32_t* s = Input;
+        uint32_t* d = Output;
+        size_t m = M;
+
+#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
+
+        while (m >= 4) {
+
+            MlasTranspose4x4Block(s, N, d, M);
+
+            s += N * 4;
+            d += 4;
+            m -= 4;
+        }
+
+#endif
+
+        while (m > 0) {
+
+            MlasTranspose4xNVector(s, 1, d, M);
+
+            s += N;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 4;
+        Output += M * 4;
+        n -= 4;
+    }
+
+    //
+    // Transpose elements from the input matrix to the output matrix for the
+    // remaining columns.
+    //
+
+    while (n > 0) {
+
+        const uint32_t* s = Input;
+        uint32_t* d = Output;
+        size_t m = M;
+
+        while (m >= 4) {
+
+            MlasTranspose4xNVector(s, N, d, 1);
+
+            s += N * 4;
+            d += 4;
+            m -= 4;
+        }
+
+        while (m > 0) {
+
+            d[0] = s[0];
+
+            s += N;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 1;
+        Output += M;
+        n -= 1;
+    }
+}
@@ -0,0 +1,547 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    winograd.cpp
+
+Abstract:
+
+    This module implements the Winograd F(2x2,3x3) convolution algorithm for
+    3x3 kernels with unit strides and dilations. The filter tensor is
+    transformed ahead of time with MlasConvWinogradTransformFilter, input
+    tiles are transformed on the fly, the sixteen transform taps are executed
+    as a batch of GEMM operations and the inverse transform produces 2x2
+    output tiles.
+
+    The algorithm replaces the 9 multiplications per output element of the
+    direct method with 16 multiplications per 2x2 output tile, a 2.25x
+    reduction, at the cost of the transform arithmetic.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of input tiles buffered and multiplied per iteration.
+// The working buffer holds the transformed input and output panels for this
+// many tiles.
+//
+
+#define MLAS_CONV_WINOGRAD_TILE_BLOCK       64
+
+//
+// Define the minimum channel and filter counts for the algorithm to be
+// profitable. Below these bounds the transform overhead and the skinny GEMM
+// shapes lose to the im2col path.
+//
+
+#define MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS 16
+#define MLAS_CONV_WINOGRAD_MINIMUM_FILTERS  16
+#define MLAS_CONV_WINOGRAD_MINIMUM_TILES    16
+
+bool
+MLASCALL
+MlasConvWinogradApplicable(
+    const MLAS_CONV_PARAMETERS* Parameters
+    )
+/*++
+
+Routine Description:
+
+    This routine determines if the convolution described by the supplied
+    parameters can profitably execute using the Winograd F(2x2,3x3)
+    algorithm.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+Return Value:
+
+    Returns true if MlasConvWinograd supports this convolution shape and is
+    expected to outperform the expand then GEMM path.
+
+--*/
+{
+    if (Parameters->Dimensions != 2) {
+        return false;
+    }
+
+    if (Parameters->KernelShape[0] != 3 || Parameters->KernelShape[1] != 3) {
+        return false;
+    }
+
+    if (Parameters->StrideShape[0] != 1 || Parameters->StrideShape[1] != 1) {
+        return false;
+    }
+
+    if (Parameters->DilationShape[0] != 1 || Parameters->DilationShape[1] != 1) {
+        return false;
+    }
+
+    if (Parameters->InputChannels < MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS ||
+        Parameters->FilterCount < MLAS_CONV_WINOGRAD_MINIMUM_FILTERS) {
+        return false;
+    }
+
+    const size_t TileCount =
+        ((Parameters->OutputShape[0] + 1) / 2) * ((Parameters->OutputShape[1] + 1) / 2);
+
+    if (TileCount < MLAS_CONV_WINOGRAD_MINIMUM_TILES) {
+        return false;
+    }
+
+    return true;
+}
+
+size_t
+MLASCALL
+MlasConvWinogradFilterBufferSize(
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in elements of the transformed filter
+    buffer produced by MlasConvWinogradTransformFilter.
+
+Arguments:
+
+    GroupCount - Supplies the number of channel groups.
+
+    FilterCount - Supplies the number of rows of the filter matrix per group.
+
+    InputChannels - Supplies the number of input channels per group.
+
+Return Value:
+
+    Returns the size in elements for the transformed filter buffer.
+
+--*/
+{
+    return GroupCount * 16 * FilterCount * InputChannels;
+}
+
+void
+MLASCALL
+MlasConvWinogradTransformFilter(
+    const float* Filter,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels,
+    float* TransformedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms a 3x3 filter tensor to the Winograd domain by
+    computing U = G*g*G' for each filter/channel pair, where G is the filter
+    transform matrix of F(2x2,3x3).
+
+    The transformed taps are stored as sixteen [FilterCount][InputChannels]
+    matrices per group, so each tap is directly usable as the A matrix of a
+    GEMM against the transformed input tiles.
+
+Arguments:
+
+    Filter - Supplies the filter tensor with logical dimensions
+        [GroupCount * FilterCount][InputChannels][3][3].
+
+    GroupCount - Supplies the number of channel groups.
+
+    FilterCount - Supplies the number of rows of the filter matrix per group.
+
+    InputChannels - Supplies the number of input channels per group.
+
+    TransformedFilter - Supplies the output buffer sized per
+        MlasConvWinogradFilterBufferSize().
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t group = 0; group < GroupCount; group++) {
+
+        for (size_t f = 0; f < FilterCount; f++) {
+
+            for (size_t c = 0; c < InputChannels; c++) {
+
+                const float* g = &Filter[((group * FilterCount + f) * InputChannels + c) * 9];
+
+                //
+                // Compute T = G*g, where G expands the three kernel rows to
+                // the four transform rows.
+                //
+
+                float T[4][3];
+
+                for (size_t j = 0; j < 3; j++) {
+                    T[0][j] = g[j];
+                    T[1][j] = 0.5f * (g[j] + g[3 + j] + g[6 + j]);
+                    T[2][j] = 0.5f * (g[j] - g[3 + j] + g[6 + j]);
+                    T[3][j] = g[6 + j];
+                }
+
+                //
+                // Compute U = T*G' and scatter the taps to the per-tap
+                // matrices.
+                //
+
+                float* u = &TransformedFilter[group * 16 * FilterCount * InputChannels +
+                    f * InputChannels + c];
+
+                for (size_t i = 0; i < 4; i++) {
+
+                    u[(i * 4 + 0) * FilterCount * InputChannels] = T[i][0];
+                    u[(i * 4 + 1) * FilterCount * InputChannels] =
+                        0.5f * (T[i][0] + T[i][1] + T[i][2]);
+                    u[(i * 4 + 2) * FilterCount * InputChannels] =
+                        0.5f * (T[i][0] - T[i][1] + T[i][2]);
+                    u[(i * 4 + 3) * FilterCount * InputChannels] = T[i][2];
+                }
+            }
+        }
+    }
+}
+
+size_t
+MLASCALL
+MlasConvWinogradWorkingBufferSize(
+    const MLAS_CONV_PARAMETERS* Parameters
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in elements of the working buffer used
+    by MlasConvWinograd to hold the transformed input and output panels of
+    one block of tiles.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+Return Value:
+
+    Returns the size in elements for the working buffer.
+
+--*/
+{
+    const size_t TileCount =
+        ((Parameters->OutputShape[0] + 1) / 2) * ((Parameters->OutputShape[1] + 1) / 2);
+    const size_t TileBlock = (std::min)(TileCount, size_t(MLAS_CONV_WINOGRAD_TILE_BLOCK));
+
+    return 16 * (Parameters->InputChannels + Parameters->FilterCount) * TileBlock;
+}
+
+void
+MlasConvWinogradTransformInput(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    size_t TileBase,
+    size_t TileCountThisBlock,
+    float* TransformedInput
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms a block of 4x4 input tiles to the Winograd
+    domain by computing V = B'*d*B per channel and tile. Elements read from
+    outside the input image supply the implicit zero padding.
+
+    The transformed taps are stored as sixteen [InputChannels][TileCount]
+    matrices, so each tap is directly usable as the B matrix of a GEMM
+    against the transformed filter taps.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor of one group.
+
+    TileBase - Supplies the index of the first tile of the block.
+
+    TileCountThisBlock - Supplies the number of tiles in the block.
+
+    TransformedInput - Supplies the output buffer for the transformed taps.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t TileColumns = (Parameters->OutputShape[1] + 1) / 2;
+
+    const ptrdiff_t PaddingTop = ptrdiff_t(Parameters->Padding[0]);
+    const ptrdiff_t PaddingLeft = ptrdiff_t(Parameters->Padding[1]);
+
+    for (size_t c = 0; c < Parameters->InputChannels; c++) {
+
+        const float* input = Input + c * Parameters->InputSize;
+
+        for (size_t Tile = 0; Tile < TileCountThisBlock; Tile++) {
+
+            const size_t TileIndex = TileBase + Tile;
+
+            const ptrdiff_t RowBase = ptrdiff_t((TileIndex / TileColumns) * 2) - PaddingTop;
+            const ptrdiff_t ColumnBase = ptrdiff_t((TileIndex % TileColumns) * 2) - PaddingLeft;
+
+            //
+            // Gather the 4x4 input tile, substituting zero for elements
+            // falling inside the padding region or beyond the image.
+            //
+
+            float d[4][4];
+
+            for (ptrdiff_t i = 0; i < 4; i++) {
+
+                const ptrdiff_t Row = RowBase + i;
+
+                for (ptrdiff_t j = 0; j < 4; j++) {
+
+                    const ptrdiff_t Column = ColumnBase + j;
+
+                    if (size_t(Row) < InputHeight && size_t(Column) < InputWidth) {
+                        d[i][j] = input[Row * ptrdiff_t(InputWidth) + Column];
+                    } else {
+                        d[i][j] = 0.0f;
+                    }
+                }
+            }
+
+            //
+            // Compute T = B'*d and then V = T*B, scattering the taps to the
+            // per-tap matrices.
+            //
+
+            float T[4][4];
+
+            for (size_t j = 0; j < 4; j++) {
+                T[0][j] = d[0][j] - d[2][j];
+                T[1][j] = d[1][j] + d[2][j];
+                T[2][j] = d[2][j] - d[1][j];
+                T[3][j] = d[1][j] - d[3][j];
+            }
+
+            float* v = &TransformedInput[c * TileCountThisBlock + Tile];
+
+            const size_t TapStride = Parameters->InputChannels * TileCountThisBlock;
+
+            for (size_t i = 0; i < 4; i++) {
+
+                v[(i * 4 + 0) * TapStride] = T[i][0] - T[i][2];
+                v[(i * 4 + 1) * TapStride] = T[i][1] + T[i][2];
+                v[(i * 4 + 2) * TapStride] = T[i][2] - T[i][1];
+                v[(i * 4 + 3) * TapStride] = T[i][1] - T[i][3];
+            }
+        }
+    }
+}
+
+void
+MlasConvWinogradTransformOutput(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* TransformedOutput,
+    size_t TileBase,
+    size_t TileCountThisBlock,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the inverse transform Y = A'*m*A for a block of
+    tiles and stores the resulting 2x2 output tiles. Tiles overhanging the
+    right or bottom edge of the output image are clipped.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    TransformedOutput - Supplies the multiplied taps as sixteen
+        [FilterCount][TileCount] matrices.
+
+    TileBase - Supplies the index of the first tile of the block.
+
+    TileCountThisBlock - Supplies the number of tiles in the block.
+
+    Output - Supplies the output tensor of one group.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t TileColumns = (OutputWidth + 1) / 2;
+
+    for (size_t f = 0; f < Parameters->FilterCount; f++) {
+
+        float* output = Output + f * Parameters->OutputSize;
+
+        for (size_t Tile = 0; Tile < TileCountThisBlock; Tile++) {
+
+            const size_t TileIndex = TileBase + Tile;
+
+            const size_t RowBase = (TileIndex / TileColumns) * 2;
+            const size_t ColumnBase = (TileIndex % TileColumns) * 2;
+
+            const float* m = &TransformedOutput[f * TileCountThisBlock + Tile];
+
+            const size_t TapStride = Parameters->FilterCount * TileCountThisBlock;
+
+            //
+            // Compute T = A'*m and then Y = T*A.
+            //
+
+            float T[2][4];
+
+            for (size_t j = 0; j < 4; j++) {
+                T[0][j] = m[j * TapStride] + m[(4 + j) * TapStride] + m[(8 + j) * TapStride];
+                T[1][j] = m[(4 + j) * TapStride] - m[(8 + j) * TapStride] - m[(12 + j) * TapStride];
+            }
+
+            for (size_t i = 0; i < 2; i++) {
+
+                const size_t Row = RowBase + i;
+
+                if (Row >= OutputHeight) {
+                    break;
+                }
+
+                output[Row * OutputWidth + ColumnBase] = T[i][0] + T[i][1] + T[i][2];
+
+                if (ColumnBase + 1 < OutputWidth) {
+                    output[Row * OutputWidth + ColumnBase + 1] = T[i][1] - T[i][2] - T[i][3];
+                }
+            }
+        }
+    }
+}
+
+void
+MLASCALL
+MlasConvWinograd(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* TransformedFilter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine executes a convolution using the Winograd F(2x2,3x3)
+    algorithm. The caller must verify the shape with
+    MlasConvWinogradApplicable and transform the filter tensor ahead of time
+    with MlasConvWinogradTransformFilter.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor.
+
+    TransformedFilter - Supplies the filter tensor transformed by
+        MlasConvWinogradTransformFilter.
+
+    Bias - Supplies the optional bias vector.
+
+    WorkingBuffer - Supplies a working buffer sized per
+        MlasConvWinogradWorkingBufferSize().
+
+    Output - Supplies the output tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+
+    const size_t TileCount =
+        ((Parameters->OutputShape[0] + 1) / 2) * ((Parameters->OutputShape[1] + 1) / 2);
+    const size_t TileBlock = (std::min)(TileCount, size_t(MLAS_CONV_WINOGRAD_TILE_BLOCK));
+
+    const size_t InputGroupSize = InputChannels * Parameters->InputSize;
+    const size_t OutputGroupSize = FilterCount * Parameters->OutputSize;
+    const size_t FilterGroupSize = 16 * FilterCount * InputChannels;
+
+    float* TransformedInput = WorkingBuffer;
+    float* TransformedOutput = WorkingBuffer + 16 * InputChannels * TileBlock;
+
+    for (size_t batch = 0; batch < Parameters->BatchCount; batch++) {
+
+        const float* filter = TransformedFilter;
+        const float* bias = Bias;
+
+        for (size_t group = 0; group < Parameters->GroupCount; group++) {
+
+            for (size_t TileBase = 0; TileBase < TileCount; TileBase += TileBlock) {
+
+                const size_t TileCountThisBlock = (std::min)(TileCount - TileBase, TileBlock);
+
+                MlasConvWinogradTransformInput(Parameters, Input, TileBase,
+                    TileCountThisBlock, TransformedInput);
+
+                //
+                // Multiply the sixteen transform taps as one batch of GEMM
+                // operations sharing a single work partition.
+                //
+
+                MlasGemmBatch(CblasNoTrans, CblasNoTrans, FilterCount, TileCountThisBlock,
+                    InputChannels, 1.0f, filter, InputChannels, FilterCount * InputChannels,
+                    TransformedInput, TileCountThisBlock, InputChannels * TileCountThisBlock,
+                    0.0f, TransformedOutput, TileCountThisBlock, FilterCount * TileCountThisBlock,
+                    16, ThreadPool);
+
+                MlasConvWinogradTransformOutput(Parameters, TransformedOutput, TileBase,
+                    TileCountThisBlock, Output);
+            }
+
+            //
+            // Apply the activation with optional bias.
+            //
+
+            MlasActivation(Parameters->Activation, Output, bias, FilterCount,
+                Parameters->OutputSize, Parameters->OutputSize);
+
+            if (bias != nullptr) {
+                bias += FilterCount;
+            }
+
+            filter += FilterGroupSize;
+            Input += InputGroupSize;
+            Output += OutputGroupSize;
+        }
+    }
+}
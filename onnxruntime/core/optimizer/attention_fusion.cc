@@ -242,6 +242,11 @@ Status AttentionFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
           fused_count++;
           modified = true;
         }
+      } else if (add_count == 1 && matmul_count == 1 && shape_count == node.GetOutputEdgesCount() - 2) {  // cross attention (K and V projected from another root)
+        if (AttentionFusion::FuseSubGraph(node, *add_node, graph, hidden_size, mask_int32_map, logger)) {
+          fused_count++;
+          modified = true;
+        }
       } else if (reshape_count == 1 && (shape_count == 1 || shape_count == 3) && (reshape_count + shape_count) == node.GetOutputEdgesCount()) {  // GPT
         if (AttentionFusionHelper::FuseGptAttention(node, graph, hidden_size, mask_int32_map, shape_count == 1, logger)) {
           fused_count++;
@@ -268,6 +273,8 @@ static bool FuseSubGraphQKImpl(Node& layer_norm,
                                int64_t hidden_size,
                                int64_t num_heads,
                                int64_t head_size,
+                               NodeIndex kv_root_index,  // root node of K and V paths; layer_norm itself for self attention
+                               NodeArg* key_value,       // K and V source for cross attention, nullptr for self attention
                                const logging::Logger& logger) {
   std::vector<std::reference_wrapper<const Node>> pivot_nodes;
   if (edges.size() == 2) {
@@ -328,8 +335,12 @@ static bool FuseSubGraphQKImpl(Node& layer_norm,
   const Node& k_add = edges[2]->GetNode();
   const Node& k_matmul = edges[3]->GetNode();
   const Node& k_root = edges[4]->GetNode();
-  if (k_root.Index() != layer_norm.Index()) {
-    DEBUG_LOG("k root is not layer norm");
+  if (k_root.Index() != kv_root_index) {
+    DEBUG_LOG("k root does not match v root");
+    return false;
+  }
+  if (key_value != nullptr && k_matmul.InputDefs()[0]->Name() != key_value->Name()) {
+    DEBUG_LOG("k_matmul does not read from the same value as v_matmul");
     return false;
   }
   if (!AttentionFusionHelper::CheckNodesInPathK(graph, k_reshape, k_transpose, num_heads, head_size, logger)) {
@@ -374,7 +385,12 @@ static bool FuseSubGraphQKImpl(Node& layer_norm,
   NodeArg& qkv_bias = MergeQkvWeights(graph, hidden_size, q_bias_tensor, k_bias_tensor, v_bias_tensor, false);
   // Create Attention Node.
   const Node& reshape = parent_path_nodes[0];
-  const std::vector<NodeArg*> input_defs{layer_norm.MutableOutputDefs()[0], &qkv_weights, &qkv_bias, mask_int32};
+  std::vector<NodeArg*> input_defs{layer_norm.MutableOutputDefs()[0], &qkv_weights, &qkv_bias, mask_int32};
+  if (key_value != nullptr) {
+    // key_value is input 5, so the optional past state (input 4) has to be filled with an empty arg.
+    input_defs.push_back(&graph.GetOrCreateNodeArg("", nullptr));
+    input_defs.push_back(key_value);
+  }
   const std::vector<NodeArg*> output_defs{graph.GetNode(reshape.Index())->MutableOutputDefs()[0]};
   Node& attention_node = graph.AddNode(
       graph.GenerateNodeName("Attention"),
@@ -422,6 +438,8 @@ static bool FuseSubGraphQK(Node& layer_norm,
                            int64_t hidden_size,
                            int64_t num_heads,
                            int64_t head_size,
+                           NodeIndex kv_root_index,
+                           NodeArg* key_value,
                            std::map<std::string, NodeArg*>& mask_int32_map,
                            const logging::Logger& logger) {
   // path to q
@@ -436,7 +454,7 @@ static bool FuseSubGraphQK(Node& layer_norm,
 
   std::vector<NodeIndex> nodes_to_remove;
   if (!FuseSubGraphQKImpl(layer_norm, graph, parent_path_nodes, mask_input, mask_int32_map, edges, nodes_to_remove, hidden_size,
-                          num_heads, head_size, logger)) {
+                          num_heads, head_size, kv_root_index, key_value, logger)) {
     return false;
   }
 
@@ -527,7 +545,7 @@ static bool FuseSubGraphQKDistilBert(Node& layer_norm,
 
   std::vector<NodeIndex> nodes_to_remove;
   if (!FuseSubGraphQKImpl(layer_norm, graph, parent_path_nodes, mask_input, mask_int32_map, edges, nodes_to_remove, hidden_size,
-                          num_heads, head_size, logger)) {
+                          num_heads, head_size, layer_norm.Index(), nullptr, logger)) {
     return false;
   }
 
@@ -641,8 +659,19 @@ bool AttentionFusion::FuseSubGraph(Node& layer_norm, const Node& add_after_layer
   const Node& v_add = edges[7]->GetNode();
   const Node& v_matmul = edges[8]->GetNode();
   const Node& v_root = edges[9]->GetNode();
-  if (v_root.Index() != layer_norm.Index()) {
-    return false;
+
+  // When K and V are rooted at another LayerNormalization node (e.g. the final encoder layer norm
+  // of a translation decoder), fuse as cross attention: Q keeps reading from layer_norm, and the
+  // K/V source is passed to the Attention node through the key_value input. The CUDA Attention
+  // kernel does not support the key_value input yet, so cross attention is fused for CPU only.
+  const bool is_cross_attention = (v_root.Index() != layer_norm.Index());
+  NodeArg* key_value = nullptr;
+  if (is_cross_attention) {
+    if (layer_norm.GetExecutionProviderType() != kCpuExecutionProvider) {
+      DEBUG_LOG("Cross attention fusion is only supported on CPU");
+      return false;
+    }
+    key_value = graph.GetNode(v_matmul.Index())->MutableInputDefs()[0];
   }
 
   if (!optimizer_utils::CheckOutputEdges(graph, v_add, 1) ||
@@ -678,8 +707,8 @@ bool AttentionFusion::FuseSubGraph(Node& layer_norm, const Node& add_after_layer
 
   if (AttentionFusionHelper::MatchInputMaskSubgraph(graph, qkv_matmul, mask_nodes, logger, false)) {
     NodeArg* mask_input = graph.GetNode(mask_nodes.unsqueeze_1->Index())->MutableInputDefs()[0];
-    return FuseSubGraphQK(layer_norm, graph, mask_nodes, mask_input, parent_path_nodes, hidden_size, num_heads, head_size, mask_int32_map, logger);
-  } else if (AttentionFusionHelper::MatchInputMaskSubgraph(graph, layer_norm, qkv_matmul, mask_nodes_distilbert, record_node_idx, logger)) {
+    return FuseSubGraphQK(layer_norm, graph, mask_nodes, mask_input, parent_path_nodes, hidden_size, num_heads, head_size, v_root.Index(), key_value, mask_int32_map, logger);
+  } else if (!is_cross_attention && AttentionFusionHelper::MatchInputMaskSubgraph(graph, layer_norm, qkv_matmul, mask_nodes_distilbert, record_node_idx, logger)) {
     NodeArg* mask_input = graph.GetNode(mask_nodes_distilbert.equal->Index())->MutableInputDefs()[0];
     return FuseSubGraphQKDistilBert(layer_norm, graph, mask_nodes_distilbert, mask_input, parent_path_nodes, hidden_size, num_heads, head_size, mask_int32_map, logger);
   } else {
@@ -18,6 +18,11 @@ class AttentionFusion : public GraphTransformer {
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
 
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"LayerNormalization"};
+    return &trigger_op_types;
+  }
+
 private:
   static bool FuseSubGraph(Node& layer_norm, const Node& add_after_layer_norm, Graph& graph, int64_t hidden_size, std::map<std::string, NodeArg*>& mask_index_map, const logging::Logger& logger);
 };
@@ -18,6 +18,11 @@ class BiasGeluFusion : public GraphTransformer {
   }
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"Gelu", "FastGelu"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
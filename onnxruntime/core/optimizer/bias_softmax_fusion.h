@@ -17,6 +17,11 @@ class BiasSoftmaxFusion : public GraphTransformer {
       : GraphTransformer("BiasSoftmaxFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"Softmax"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
@@ -316,6 +316,51 @@ struct NodeArgPtrEquality {
 bool IsNodeSupported(const Node& node) {
   return !node.ContainsSubgraph() && optimizer_utils::IsOperationDeterministic(node.Domain(), node.OpType());
 }
+
+// Maximum byte size of a constant initializer that is considered for content-based
+// deduplication. Duplicated constants are typically scalars and shape vectors; comparing
+// large weights would make the pass output-size dependent without finding duplicates.
+constexpr std::size_t kMaxDedupInitializerByteSize = 4096;
+
+// Resolves duplicated constant initializers to one canonical NodeArg per distinct content,
+// so that expressions that differ only in which copy of a constant they reference fall into
+// the same equivalence class. Non-constant and large values map to themselves.
+class CanonicalConstantMap {
+ public:
+  explicit CanonicalConstantMap(const Graph& graph) : graph_(graph) {}
+
+  const NodeArg* Resolve(const NodeArg* node_arg) {
+    if (node_arg == nullptr || !node_arg->Exists()) {
+      return node_arg;
+    }
+
+    auto it = canonical_of_.find(node_arg);
+    if (it != canonical_of_.end()) {
+      return it->second;
+    }
+
+    const NodeArg* canonical = node_arg;
+    const ONNX_NAMESPACE::TensorProto* initializer =
+        graph_utils::GetConstantInitializer(graph_, node_arg->Name(), /*check_outer_scope*/ false);
+    if (initializer != nullptr && initializer->ByteSizeLong() <= kMaxDedupInitializerByteSize) {
+      // The serialized tensor without its name is used as the content key; protobuf
+      // serialization of the same message type with equal fields is stable within one build.
+      ONNX_NAMESPACE::TensorProto content = *initializer;
+      content.clear_name();
+      content.clear_doc_string();
+      auto insertion = constant_by_content_.emplace(content.SerializeAsString(), node_arg);
+      canonical = insertion.first->second;
+    }
+
+    canonical_of_.emplace(node_arg, canonical);
+    return canonical;
+  }
+
+ private:
+  const Graph& graph_;
+  std::unordered_map<const NodeArg*, const NodeArg*> canonical_of_;
+  std::unordered_map<std::string, const NodeArg*> constant_by_content_;
+};
 }  // namespace
 
 }  // namespace onnxruntime
@@ -351,6 +396,12 @@ Status CommonSubexpressionElimination::ApplyImpl(Graph& graph, bool& modified, i
   // equivalence class. In that case these NodeArgs will be "merged" into one.
   std::unordered_map<const NodeArg*, const EquivalenceClass*, NodeArgPtrHash, NodeArgPtrEquality> equivalence_classes;
 
+  // Duplicated constant initializers are folded into one canonical NodeArg each, so that
+  // otherwise identical expressions reading different copies of a constant can still merge.
+  // Copies that lose all their consumers are swept by Graph::CleanUnusedInitializers
+  // on the next resolve.
+  CanonicalConstantMap canonical_constants(graph);
+
   int unique_discriminator = 1;
 
   for (NodeIndex node_index : node_topology_list) {
@@ -362,7 +413,8 @@ Status CommonSubexpressionElimination::ApplyImpl(Graph& graph, bool& modified, i
 
     std::vector<const EquivalenceClass*> input_values;
     input_values.reserve(node->InputDefs().size());
-    for (const NodeArg* input_def : node->InputDefs()) {
+    for (const NodeArg* original_input_def : node->InputDefs()) {
+      const NodeArg* input_def = canonical_constants.Resolve(original_input_def);
       auto it = equivalence_classes.find(input_def);
       if (it == equivalence_classes.end()) {
         // Because nodes are processed in topological order, this will always be
@@ -5,6 +5,7 @@
 #include "core/optimizer/utils.h"
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/optimizer_execution_frame.h"
+#include "core/framework/kernel_registry.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
 
@@ -60,6 +61,19 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
   GraphViewer graph_viewer(graph);
   auto& order = graph_viewer.GetNodesInTopologicalOrder();
 
+  // Foldable nodes are gathered into a group that shares a single
+  // OptimizerExecutionFrame::Info and execution frame, so the cost of
+  // building the value maps and loading the constant inputs is paid once per
+  // graph instead of once per folded node. A node whose inputs are produced
+  // by earlier nodes in the group can be folded in the same pass because the
+  // shared frame keeps the intermediate values alive between the kernel
+  // invocations.
+  std::vector<NodeIndex> group;
+  std::unordered_set<std::string> group_outputs;
+  InitializedTensorSet group_constant_inputs;
+
+  std::shared_ptr<KernelRegistry> cpu_kernel_registry = execution_provider_.GetKernelRegistry();
+
   for (NodeIndex i : order) {
     auto* node = graph.GetNode(i);
     if (!node) {
@@ -76,40 +90,100 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
       ORT_RETURN_IF_ERROR(graph.UpdateShapeInference(*node));
     }
 
-    bool converted_to_constant = false;
+    // Shape nodes are folded immediately as they only need the inferred input
+    // shape, and materializing the shape constant here allows downstream
+    // nodes to join the group in the same pass.
     if (node->OpType().compare("Shape") == 0) {
-      converted_to_constant = ConstantFoldShapeNode(graph, *node);
-    } else {
-      InitializedTensorSet constant_inputs;
-
-      // we currently constant fold using the CPU EP only.
-      // if the node is assigned to a different EP we can run it if it's an ONNX op as we have CPU based
-      // implementations for all ONNX ops. If the node/op is from a different op domain or if the CPU implementation
-      // does not support the specific input type(s) required by the node (currently we only support a subset of
-      // types in some CPU kernels) then we can't proceed with constant folding for the node.
-      auto ep_type = node->GetExecutionProviderType();
-      bool cpu_ep = ep_type == kCpuExecutionProvider;
-      if (!cpu_ep && node->Domain() != kOnnxDomain) {
-        continue;
+      if (ConstantFoldShapeNode(graph, *node)) {
+        graph_utils::RemoveNodeOutputEdges(graph, *node);
+        graph.RemoveNode(node->Index());
+        modified = true;
+        have_updated_nodes = true;
       }
+      continue;
+    }
+
+    // we currently constant fold using the CPU EP only.
+    // if the node is assigned to a different EP we can run it if it's an ONNX op as we have CPU based
+    // implementations for all ONNX ops. If the node/op is from a different op domain or if the CPU implementation
+    // does not support the specific input type(s) required by the node (currently we only support a subset of
+    // types in some CPU kernels) then we can't proceed with constant folding for the node.
+    auto ep_type = node->GetExecutionProviderType();
+    bool cpu_ep = ep_type == kCpuExecutionProvider;
+    if (!cpu_ep && node->Domain() != kOnnxDomain) {
+      continue;
+    }
+
+    // Check if constant folding can be applied on this node.
+    if (!graph_utils::IsSupportedProvider(*node, GetCompatibleExecutionProviders()) ||
+        !optimizer_utils::IsOperationDeterministic(node->Domain(), node->OpType()) ||
+        // constant folding does not support executing a node that includes subgraphs (control flow operators,
+        // such as If/Loop/Scan, fall into this category). individual nodes in the subgraph will be processed
+        // by the Recurse call above
+        node->ContainsSubgraph()) {
+      continue;
+    }
 
-      // Check if constant folding can be applied on this node.
-      if (!graph_utils::IsSupportedProvider(*node, GetCompatibleExecutionProviders()) ||
-          !optimizer_utils::IsOperationDeterministic(node->Domain(), node->OpType()) ||
-          // constant folding does not support executing a node that includes subgraphs (control flow operators,
-          // such as If/Loop/Scan, fall into this category). individual nodes in the subgraph will be processed
-          // by the Recurse call above
-          node->ContainsSubgraph() || !graph_utils::AllNodeInputsAreConstant(graph, *node, constant_inputs, excluded_initializers_)) {
-        continue;
+    // Check that every input is either an existing constant initializer or
+    // will become one when the nodes already gathered into the group are
+    // folded.
+    bool all_inputs_constant = true;
+    InitializedTensorSet constant_inputs;
+    for (const auto* input_def : node->InputDefs()) {
+      const ONNX_NAMESPACE::TensorProto* initializer =
+          graph_utils::GetConstantInitializer(graph, input_def->Name(), true);
+      if (initializer != nullptr &&
+          excluded_initializers_.find(input_def->Name()) == excluded_initializers_.cend()) {
+        constant_inputs.insert({input_def->Name(), initializer});
+      } else if (group_outputs.find(input_def->Name()) == group_outputs.cend()) {
+        all_inputs_constant = false;
+        break;
       }
+    }
+
+    if (!all_inputs_constant) {
+      continue;
+    }
 
-      // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_);
+    // Make sure a CPU kernel exists before committing the node to the group.
+    const KernelCreateInfo* kernel_create_info = nullptr;
+    if (!cpu_kernel_registry->TryFindKernel(*node, kCpuExecutionProvider, &kernel_create_info).IsOK()) {
+      LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
+                            << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
+      continue;
+    }
+
+    group.push_back(i);
+    for (const auto* node_out : node->OutputDefs()) {
+      group_outputs.insert(node_out->Name());
+    }
+    group_constant_inputs.insert(constant_inputs.begin(), constant_inputs.end());
+  }
 
-      std::vector<int> fetch_mlvalue_idxs;
-      for (const auto* node_out : node->OutputDefs()) {
+  if (!group.empty()) {
+    std::vector<const Node*> group_nodes;
+    group_nodes.reserve(group.size());
+    for (NodeIndex index : group) {
+      group_nodes.push_back(graph.GetNode(index));
+    }
+
+    // Create one execution frame info shared by all the nodes in the group.
+    OptimizerExecutionFrame::Info info(group_nodes, group_constant_inputs, graph.ModelPath(), execution_provider_);
+
+    std::vector<int> fetch_mlvalue_idxs;
+    for (const auto* group_node : group_nodes) {
+      for (const auto* node_out : group_node->OutputDefs()) {
         fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
       }
+    }
+
+    std::vector<std::unique_ptr<const OpKernel>> kernels;
+    kernels.reserve(group.size());
+    bool group_ok = true;
+    for (NodeIndex index : group) {
+      auto* node = graph.GetNode(index);
+      auto ep_type = node->GetExecutionProviderType();
+      const bool cpu_ep = ep_type == kCpuExecutionProvider;
 
       // override the EP assigned to the node so that it will use the CPU kernel for Compute.
       if (!cpu_ep) {
@@ -124,61 +198,73 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
       }
 
       if (kernel == nullptr) {
-        LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
+        // Should not be hit given the kernel registry was probed when the
+        // group was built, but don't execute a partially constructed group.
+        LOGS(logger, WARNING) << "Could not create a CPU kernel and hence "
                               << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
-
-        // Move on to the next candidate node
-        continue;
+        group_ok = false;
+        break;
       }
 
+      kernels.push_back(std::move(kernel));
+    }
+
+    if (group_ok) {
       OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
 
-      OpKernelContext op_kernel_context(&frame, kernel.get(), nullptr, logger);
-      ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+      for (const auto& kernel : kernels) {
+        OpKernelContext op_kernel_context(&frame, kernel.get(), nullptr, logger);
+        ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+      }
 
       std::vector<OrtValue> fetches;
       ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
+      ORT_ENFORCE(fetches.size() == fetch_mlvalue_idxs.size());
 
       // Go over all output node args and substitute them with the newly computed tensors, which will be
       // added to the graph as initializers.
-      ORT_ENFORCE(fetches.size() == node->OutputDefs().size());
-      converted_to_constant = true;
-      for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
-        OrtValue& ort_value = fetches[fetch_idx];
-
-        if (!ort_value.IsTensor()) {
-          LOGS(logger, WARNING) << "Unsupported output type of " << ort_value.Type()
-                                << ". Can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
-          converted_to_constant = false;
-          break;
+      size_t fetch_idx = 0;
+      for (NodeIndex index : group) {
+        auto* node = graph.GetNode(index);
+        const size_t num_outputs = node->OutputDefs().size();
+
+        bool converted_to_constant = true;
+        for (size_t out_idx = 0; out_idx < num_outputs; ++out_idx) {
+          OrtValue& ort_value = fetches[fetch_idx + out_idx];
+
+          if (!ort_value.IsTensor()) {
+            LOGS(logger, WARNING) << "Unsupported output type of " << ort_value.Type()
+                                  << ". Can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
+            converted_to_constant = false;
+            break;
+          }
         }
-      }
 
-      if (converted_to_constant) {
-        for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
-          OrtValue& ort_value = fetches[fetch_idx];
-          // Build the TensorProto that corresponds to the computed OrtValue and add it as initializer to the graph.
-          auto* constant_arg_out = node->MutableOutputDefs()[fetch_idx];
-          const Tensor& out_tensor = ort_value.Get<Tensor>();
-          ONNX_NAMESPACE::TensorProto out_tensorproto = utils::TensorToTensorProto(out_tensor, constant_arg_out->Name());
-
-          ONNX_NAMESPACE::TensorShapeProto result_shape;
-          for (auto& dim : out_tensor.Shape().GetDims()) {
-            result_shape.add_dim()->set_dim_value(dim);
+        if (converted_to_constant) {
+          for (size_t out_idx = 0; out_idx < num_outputs; ++out_idx) {
+            OrtValue& ort_value = fetches[fetch_idx + out_idx];
+            // Build the TensorProto that corresponds to the computed OrtValue and add it as initializer to the graph.
+            auto* constant_arg_out = node->MutableOutputDefs()[out_idx];
+            const Tensor& out_tensor = ort_value.Get<Tensor>();
+            ONNX_NAMESPACE::TensorProto out_tensorproto = utils::TensorToTensorProto(out_tensor, constant_arg_out->Name());
+
+            ONNX_NAMESPACE::TensorShapeProto result_shape;
+            for (auto& dim : out_tensor.Shape().GetDims()) {
+              result_shape.add_dim()->set_dim_value(dim);
+            }
+
+            constant_arg_out->SetShape(result_shape);
+            graph.AddInitializedTensor(out_tensorproto);
           }
 
-          constant_arg_out->SetShape(result_shape);
-          graph.AddInitializedTensor(out_tensorproto);
+          // Remove the output edges of the constant node and then remove the node itself.
+          graph_utils::RemoveNodeOutputEdges(graph, *node);
+          graph.RemoveNode(index);
+          modified = true;
         }
-      }
-    }
 
-    if (converted_to_constant) {
-      // Remove the output edges of the constant node and then remove the node itself.
-      graph_utils::RemoveNodeOutputEdges(graph, *node);
-      graph.RemoveNode(node->Index());
-      modified = true;
-      have_updated_nodes = true;
+        fetch_idx += num_outputs;
+      }
     }
   }
 
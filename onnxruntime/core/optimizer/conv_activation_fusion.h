@@ -14,6 +14,11 @@ class ConvActivationFusion : public GraphTransformer {
 
  private:
   Status ApplyImpl(onnxruntime::Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"Conv"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
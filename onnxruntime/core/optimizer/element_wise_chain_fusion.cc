@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/element_wise_chain_fusion.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+// If the op has multiple versions, here we require it must have a single implementation that can work across all the
+// versions. Because in the fusion, we discarded the op version information.
+bool IsFusableElementWise(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Elu", {6}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "HardSigmoid", {6}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "LeakyRelu", {6}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Selu", {6}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Softplus", {1}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Softsign", {1}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13}) ||
+#ifndef DISABLE_CONTRIB_OPS
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "ScaledTanh", {1}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "ParametricSoftplus", {1}) ||
+#endif
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "ThresholdedRelu", {1, 10});
+}
+
+// The fused kernel initializes each stage's functor from the attributes carried over from the original
+// node, and the functors require their parameters to be explicitly present (schema defaults are not
+// re-applied). Only fuse nodes that spell out all the parameters their op needs.
+bool HasRequiredAttributes(const Node& node) {
+  const auto& op_type = node.OpType();
+
+  std::vector<const char*> required;
+  if (op_type == "Elu" || op_type == "LeakyRelu" || op_type == "ThresholdedRelu") {
+    required = {"alpha"};
+  } else if (op_type == "HardSigmoid" || op_type == "ScaledTanh" || op_type == "ParametricSoftplus") {
+    required = {"alpha", "beta"};
+  } else if (op_type == "Selu") {
+    required = {"alpha", "gamma"};
+  }
+
+  for (const auto* name : required) {
+    const auto* attr = graph_utils::GetNodeAttribute(node, name);
+    if (attr == nullptr || attr->type() != AttributeProto::FLOAT) {
+      return false;
+    }
+  }
+
+  return true;
+}
+}  // namespace
+
+Status ElementWiseChainFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                         const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed as part of an earlier fusion
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!IsFusableElementWise(node) || !HasRequiredAttributes(node) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // Walk downstream collecting the longest run of fusable ops. A node can only be absorbed when its
+    // predecessor feeds it exclusively - an intermediate result that has another consumer or is a graph
+    // output must stay materialized.
+    std::vector<std::reference_wrapper<Node>> chain;
+    chain.push_back(node);
+    Node* tail = &node;
+    while (tail->GetOutputEdgesCount() == 1 && graph.GetNodeOutputsInGraphOutputs(*tail).empty()) {
+      Node& next = *graph.GetNode(tail->OutputNodesBegin()->Index());
+      if (!IsFusableElementWise(next) || !HasRequiredAttributes(next) ||
+          next.GetExecutionProviderType() != node.GetExecutionProviderType()) {
+        break;
+      }
+      chain.push_back(next);
+      tail = &next;
+    }
+
+    if (chain.size() < 2) {
+      continue;
+    }
+
+    Node& first_node = chain.front().get();
+
+    std::vector<std::string> activations;
+    activations.reserve(chain.size());
+    for (const Node& chain_node : chain) {
+      activations.push_back(chain_node.OpType());
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("fused " + first_node.Name()), "FusedElementWise",
+                                     "fused element-wise chain starting at " + first_node.Name(),
+                                     first_node.MutableInputDefs(), {}, nullptr, kMSDomain);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(first_node.GetExecutionProviderType());
+
+    // List the ops of the chain in execution order and carry each one's attributes over
+    // with a per-stage prefix (e.g. 'activation_0_alpha').
+    fused_node.AddAttribute("activations", activations);
+    for (size_t i = 0; i < chain.size(); ++i) {
+      const std::string prefix = "activation_" + std::to_string(i) + "_";
+      for (const auto& attr : chain[i].get().GetAttributes()) {
+        AttributeProto fused_attr(attr.second);
+        fused_attr.set_name(prefix + attr.first);
+        fused_node.AddAttribute(prefix + attr.first, fused_attr);
+      }
+    }
+
+    // move output definitions and edges from the tail of the chain to fused_node. delete the chain nodes.
+    graph_utils::FinalizeNodeFusion(graph, chain, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ElementWiseChainFusion
+
+Transformer that collapses a chain of two or more unary element-wise ops
+(activations and similar) into a single FusedElementWise node so the tensor
+is streamed through memory once for the whole chain instead of once per op.
+*/
+class ElementWiseChainFusion : public GraphTransformer {
+ public:
+  ElementWiseChainFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ElementWiseChainFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{
+        "Elu", "HardSigmoid", "LeakyRelu", "Relu", "Selu", "Sigmoid", "Softplus", "Softsign", "Tanh",
+        "ThresholdedRelu", "ScaledTanh", "ParametricSoftplus"};
+    return &trigger_op_types;
+  }
+};
+
+}  // namespace onnxruntime
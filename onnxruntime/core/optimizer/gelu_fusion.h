@@ -22,6 +22,11 @@ class GeluFusion : public GraphTransformer {
       : GraphTransformer("GeluFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"Erf"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
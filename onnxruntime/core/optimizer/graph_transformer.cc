@@ -18,7 +18,12 @@ Status GraphTransformer::Apply(Graph& graph, bool& modified, const logging::Logg
   // At least currently, some transformers (InsertCastTransformer and MemcpyTransformer) need this to be called
   // after they complete to put the graph back into a valid state for the next transformer.
   if (modified) {
-    status = graph.Resolve();
+    // transformers modify the graph via the Graph/Node APIs, which track the nodes affected,
+    // so type/shape inferencing can be limited to those nodes and their downstream nodes
+    // instead of re-running it for the whole graph after every transformer.
+    Graph::ResolveOptions options;
+    options.reinfer_changed_nodes_only = true;
+    status = graph.Resolve(options);
   }
 #else
   ORT_UNUSED_PARAMETER(graph);
@@ -9,6 +9,30 @@ using namespace ::onnxruntime::common;
 
 namespace onnxruntime {
 
+namespace {
+
+// Gather the op types used anywhere in the model, including inside control flow subgraphs.
+void CollectOpTypes(const Graph& graph, std::unordered_set<std::string>& op_types) {
+  for (const auto& node : graph.Nodes()) {
+    op_types.insert(node.OpType());
+    for (const auto& subgraph : node.GetSubgraphs()) {
+      CollectOpTypes(*subgraph, op_types);
+    }
+  }
+}
+
+bool ContainsAnyOpType(const std::unordered_set<std::string>& graph_op_types,
+                       const std::unordered_set<std::string>& op_types) {
+  for (const auto& op_type : op_types) {
+    if (graph_op_types.find(op_type) != graph_op_types.cend()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 common::Status GraphTransformerManager::SetSteps(unsigned steps) {
   steps_ = steps;
   return Status::OK();
@@ -25,12 +49,24 @@ common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, Transfor
     return Status::OK();
   }
 
+  // One cheap scan of the model per round decides which transformers can possibly match: a
+  // transformer whose trigger op types are all absent cannot modify the graph and its full
+  // traversal is skipped for that round.
+  std::unordered_set<std::string> graph_op_types;
+  CollectOpTypes(graph, graph_op_types);
+
   for (unsigned step = 0; step < steps_; ++step) {
     bool graph_changed = false;
     for (const auto& transformer : transformers->second) {
       if (step > 0 && transformer->ShouldOnlyApplyOnce())
         continue;
 
+      const auto* trigger_op_types = transformer->TriggerOpTypes();
+      if (trigger_op_types != nullptr && !ContainsAnyOpType(graph_op_types, *trigger_op_types)) {
+        VLOGS(logger, 1) << "Skipping " << transformer->Name() << ": none of its trigger op types are present.";
+        continue;
+      }
+
       bool modified = false;
       ORT_RETURN_IF_ERROR(transformer->Apply(graph, modified, logger));
       graph_changed = graph_changed || modified;
@@ -38,6 +74,9 @@ common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, Transfor
     if (!graph_changed) {
       break;
     }
+
+    graph_op_types.clear();
+    CollectOpTypes(graph, graph_op_types);
   }
 
   return Status::OK();
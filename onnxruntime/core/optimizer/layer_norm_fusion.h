@@ -22,6 +22,11 @@ class LayerNormFusion : public GraphTransformer {
       : GraphTransformer("LayerNormFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"ReduceMean"};
+    return &trigger_op_types;
+  }
 };
 
 /**
@@ -39,6 +44,11 @@ class SimplifiedLayerNormFusion : public GraphTransformer {
       : GraphTransformer("SimplifiedLayerNormFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"ReduceMean"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
@@ -0,0 +1,203 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/loop_invariant_code_motion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/graph/graph_viewer.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace onnxruntime::common;
+
+namespace onnxruntime {
+
+// Generate a name that is unique in the enclosing graph and does not collide with a value
+// defined in the body, as a body-local definition would shadow the hoisted value.
+static std::string GenerateHoistedName(Graph& graph, const Graph& subgraph, const std::string& base_name) {
+  std::string name = graph.GenerateNodeArgName(base_name);
+  while (subgraph.GetNodeArg(name) != nullptr) {
+    name = graph.GenerateNodeArgName(name);
+  }
+  return name;
+}
+
+Status LoopInvariantCodeMotion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                          const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+
+  for (auto index : graph_viewer.GetNodesInTopologicalOrder()) {
+    auto* node_ptr = graph.GetNode(index);
+    if (node_ptr == nullptr) {
+      continue;
+    }
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    // only Scan and Loop re-execute their body per iteration. an If body runs at most once, so
+    // hoisting from it would move work to a path that may not be taken.
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Scan", {8, 9, 11}) &&
+        !graph_utils::IsSupportedOptypeVersionAndDomain(node, "Loop", {1, 11})) {
+      continue;
+    }
+
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    Graph* subgraph = node.GetMutableGraphAttribute("body");
+    if (subgraph == nullptr) {
+      continue;
+    }
+
+    ORT_RETURN_IF_ERROR(HoistInvariantNodes(graph, node, *subgraph, modified, logger));
+  }
+
+  return Status::OK();
+}
+
+Status LoopInvariantCodeMotion::HoistInvariantNodes(Graph& graph, Node& control_flow_node, Graph& subgraph,
+                                                    bool& modified, const logging::Logger& logger) const {
+  // Names of values that are only available inside the body: the per-iteration subgraph inputs
+  // (loop state variables, scan input slices, iteration number and condition) and the outputs of
+  // every node that stays in the body.
+  std::unordered_set<std::string> values_in_body;
+  for (const auto* input : subgraph.GetInputsIncludingInitializers()) {
+    values_in_body.insert(input->Name());
+  }
+
+  std::unordered_set<std::string> subgraph_outputs;
+  for (const auto* output : subgraph.GetOutputs()) {
+    subgraph_outputs.insert(output->Name());
+  }
+
+  // Walk the body in topological order so that the consumer of an invariant node sees its
+  // producer classified first and can be hoisted along with it.
+  GraphViewer subgraph_viewer(subgraph);
+  std::vector<NodeIndex> hoistable;
+  for (auto index : subgraph_viewer.GetNodesInTopologicalOrder()) {
+    auto& body_node = *subgraph.GetNode(index);
+
+    bool invariant = true;
+    for (const auto* input_def : body_node.InputDefs()) {
+      if (input_def->Exists() && values_in_body.count(input_def->Name()) > 0) {
+        invariant = false;
+        break;
+      }
+    }
+
+    if (invariant) {
+      // a node producing a subgraph output must stay, as graph outputs cannot be provided by the
+      // outer scope. non-deterministic nodes must keep producing a fresh value per iteration.
+      invariant = !body_node.ContainsSubgraph() &&
+                  optimizer_utils::IsOperationDeterministic(body_node.Domain(), body_node.OpType());
+      if (invariant) {
+        for (const auto* output_def : body_node.OutputDefs()) {
+          if (subgraph_outputs.count(output_def->Name()) > 0) {
+            invariant = false;
+            break;
+          }
+        }
+      }
+    }
+
+    if (!invariant) {
+      for (const auto* output_def : body_node.OutputDefs()) {
+        values_in_body.insert(output_def->Name());
+      }
+      continue;
+    }
+
+    hoistable.push_back(index);
+  }
+
+  if (hoistable.empty()) {
+    return Status::OK();
+  }
+
+  // values that had to be renamed while hoisting, mapped to their name in the enclosing graph
+  std::unordered_map<std::string, std::string> renames;
+
+  for (auto index : hoistable) {
+    auto& body_node = *subgraph.GetNode(index);
+
+    std::vector<NodeArg*> hoisted_inputs;
+    hoisted_inputs.reserve(body_node.InputDefs().size());
+    for (auto* input_def : body_node.MutableInputDefs()) {
+      if (!input_def->Exists()) {
+        hoisted_inputs.push_back(&graph.GetOrCreateNodeArg("", nullptr));
+        continue;
+      }
+
+      const std::string& input_name = input_def->Name();
+      const auto rename = renames.find(input_name);
+      if (rename != renames.cend()) {
+        hoisted_inputs.push_back(graph.GetNodeArg(rename->second));
+        continue;
+      }
+
+      const TensorProto* initializer = nullptr;
+      if (subgraph.GetInitializedTensor(input_name, initializer)) {
+        // copy the initializer to the enclosing graph under a fresh name, as its name may be
+        // shadowing a different value in an outer scope
+        const std::string hoisted_name = GenerateHoistedName(graph, subgraph, input_name);
+        TensorProto initializer_copy(*initializer);
+        initializer_copy.set_name(hoisted_name);
+        graph.AddInitializedTensor(initializer_copy);
+        renames.insert({input_name, hoisted_name});
+        hoisted_inputs.push_back(&graph.GetOrCreateNodeArg(hoisted_name, input_def->TypeAsProto()));
+      } else {
+        // an outer scope value, or the output of a node hoisted earlier under its original name.
+        // either way the name resolves in the enclosing scope.
+        hoisted_inputs.push_back(&graph.GetOrCreateNodeArg(input_name, input_def->TypeAsProto()));
+      }
+    }
+
+    std::vector<NodeArg*> hoisted_outputs;
+    hoisted_outputs.reserve(body_node.OutputDefs().size());
+    for (auto* output_def : body_node.MutableOutputDefs()) {
+      if (!output_def->Exists()) {
+        hoisted_outputs.push_back(&graph.GetOrCreateNodeArg("", nullptr));
+        continue;
+      }
+
+      const std::string& output_name = output_def->Name();
+      std::string hoisted_name = output_name;
+      if (graph.GetNodeArg(output_name) != nullptr) {
+        // the name is taken in the enclosing graph. hoist under a fresh name and rewire the
+        // remaining consumers in the body to it.
+        hoisted_name = GenerateHoistedName(graph, subgraph, output_name);
+        renames.insert({output_name, hoisted_name});
+
+        auto& renamed_arg = subgraph.GetOrCreateNodeArg(hoisted_name, output_def->TypeAsProto());
+        for (auto& consumer : subgraph.Nodes()) {
+          for (auto*& consumer_input : consumer.MutableInputDefs()) {
+            if (consumer_input == output_def) {
+              consumer_input = &renamed_arg;
+            }
+          }
+        }
+      }
+
+      hoisted_outputs.push_back(&graph.GetOrCreateNodeArg(hoisted_name, output_def->TypeAsProto()));
+
+      // the body now consumes the hoisted value from the enclosing scope
+      subgraph.AddOuterScopeNodeArg(hoisted_name);
+    }
+
+    graph.AddNode(graph.GenerateNodeName(body_node.Name()), body_node.OpType(), body_node.Description(),
+                  hoisted_inputs, hoisted_outputs, &body_node.GetAttributes(), body_node.Domain());
+
+    graph_utils::RemoveNodeOutputEdges(subgraph, body_node);
+    subgraph.RemoveNode(body_node.Index());
+    modified = true;
+  }
+
+  LOGS(logger, INFO) << "Hoisted " << hoistable.size() << " loop-invariant node(s) out of the body of "
+                     << control_flow_node.OpType() << " node '" << control_flow_node.Name() << "'.";
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class LoopInvariantCodeMotion
+
+Transformer that hoists loop-invariant nodes out of Scan and Loop subgraphs into the enclosing
+graph. A node in the body is invariant if it only depends on outer scope values, local
+initializers, and other invariant nodes; such a node computes the same value on every iteration
+but is re-executed each time the body runs. Hoisted nodes execute once in the enclosing graph and
+their results flow back into the body as implicit inputs.
+*/
+class LoopInvariantCodeMotion : public GraphTransformer {
+ public:
+  LoopInvariantCodeMotion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("LoopInvariantCodeMotion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"Scan", "Loop"};
+    return &trigger_op_types;
+  }
+
+ private:
+  Status HoistInvariantNodes(Graph& graph, Node& control_flow_node, Graph& subgraph, bool& modified,
+                             const logging::Logger& logger) const;
+};
+
+}  // namespace onnxruntime
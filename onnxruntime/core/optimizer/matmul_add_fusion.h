@@ -13,6 +13,11 @@ class MatMulAddFusion : public GraphTransformer {
       : GraphTransformer("MatMulAddFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"MatMul"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
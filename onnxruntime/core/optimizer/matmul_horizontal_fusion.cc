@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/matmul_horizontal_fusion.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Minimum number of sibling MatMuls before merging pays for the extra Split. A pair already
+// halves the reads of the shared input, so fuse from two siblings up.
+constexpr size_t kMinSiblingsToFuse = 2;
+
+}  // namespace
+
+Status MatMulHorizontalFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  // Group fusable MatMuls by their shared first input and inner dimension K. Groups are keyed
+  // and ordered by first appearance in the topological order so the rewrite is deterministic.
+  std::vector<std::string> group_keys;
+  std::unordered_map<std::string, std::vector<Node*>> groups;
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (!node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "MatMul", {1, 9, 13}) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    const auto& input_defs = node.InputDefs();
+
+    // The merged weight is built at transform time, so the weight must be a constant 2-D float
+    // initializer. The shared input needs a known rank to place the Split axis.
+    if (input_defs[0]->Shape() == nullptr ||
+        *input_defs[0]->Type() != "tensor(float)") {
+      continue;
+    }
+
+    const auto* weight = graph_utils::GetConstantInitializer(graph, input_defs[1]->Name());
+    if (weight == nullptr ||
+        weight->dims_size() != 2 ||
+        weight->data_type() != TensorProto_DataType_FLOAT) {
+      continue;
+    }
+
+    const std::string key = input_defs[0]->Name() + ":" + std::to_string(weight->dims(0));
+    auto group = groups.find(key);
+    if (group == groups.end()) {
+      group_keys.push_back(key);
+      group = groups.insert({key, {}}).first;
+    } else if (group->second.front()->GetExecutionProviderType() != node.GetExecutionProviderType()) {
+      continue;
+    }
+
+    group->second.push_back(&node);
+  }
+
+  for (const auto& key : group_keys) {
+    const auto& siblings = groups[key];
+    if (siblings.size() < kMinSiblingsToFuse) {
+      continue;
+    }
+
+    Node& first = *siblings.front();
+    NodeArg& shared_input = *first.MutableInputDefs()[0];
+    const int64_t k_dim = graph_utils::GetConstantInitializer(graph, first.InputDefs()[1]->Name())->dims(0);
+
+    // Concatenate the weights column-wise into one [K, sum(N_i)] initializer.
+    std::vector<Initializer> weights;
+    weights.reserve(siblings.size());
+    std::vector<int64_t> split_sizes;
+    split_sizes.reserve(siblings.size());
+    int64_t total_n = 0;
+    for (const Node* sibling : siblings) {
+      const auto* weight = graph_utils::GetConstantInitializer(graph, sibling->InputDefs()[1]->Name());
+      weights.emplace_back(*weight, graph.ModelPath());
+      split_sizes.push_back(weight->dims(1));
+      total_n += weight->dims(1);
+    }
+
+    std::vector<float> fused_data(static_cast<size_t>(k_dim * total_n));
+    for (int64_t row = 0; row < k_dim; ++row) {
+      float* dst = fused_data.data() + row * total_n;
+      for (size_t i = 0; i < weights.size(); ++i) {
+        const int64_t n_i = split_sizes[i];
+        const float* src = weights[i].data<float>() + row * n_i;
+        dst = std::copy(src, src + n_i, dst);
+      }
+    }
+
+    TensorProto fused_weight;
+    fused_weight.set_name(graph.GenerateNodeArgName(first.InputDefs()[1]->Name() + "_fused"));
+    fused_weight.set_data_type(TensorProto_DataType_FLOAT);
+    fused_weight.add_dims(k_dim);
+    fused_weight.add_dims(total_n);
+    fused_weight.set_raw_data(fused_data.data(), fused_data.size() * sizeof(float));
+    NodeArg& fused_weight_arg = graph_utils::AddInitializer(graph, fused_weight);
+
+    TypeProto float_tensor;
+    float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    NodeArg& fused_output = graph.GetOrCreateNodeArg(graph.GenerateNodeArgName(first.Name() + "_fused_output"),
+                                                     &float_tensor);
+
+    Node& fused_matmul = graph.AddNode(graph.GenerateNodeName(first.Name() + "_fused"),
+                                       "MatMul",
+                                       "horizontally fused sibling MatMuls",
+                                       {&shared_input, &fused_weight_arg},
+                                       {&fused_output});
+    fused_matmul.SetExecutionProviderType(first.GetExecutionProviderType());
+
+    // The Split reuses the original output defs, so downstream consumers and graph outputs are
+    // untouched. The output has the rank of the shared input (or 1 for a vector input) and the
+    // merged columns live in its last dimension.
+    const int a_rank = shared_input.Shape()->dim_size();
+    const int64_t split_axis = (a_rank <= 1) ? 0 : a_rank - 1;
+
+    std::vector<NodeArg*> split_outputs;
+    split_outputs.reserve(siblings.size());
+    for (Node* sibling : siblings) {
+      split_outputs.push_back(sibling->MutableOutputDefs()[0]);
+    }
+
+    // Split's 'split' sizes moved from an attribute to an optional second input in opset 13,
+    // so pick the form the graph's ONNX opset import expects.
+    const int onnx_opset = graph.DomainToVersionMap().find(kOnnxDomain)->second;
+
+    std::vector<NodeArg*> split_inputs{&fused_output};
+    if (onnx_opset >= 13) {
+      TensorProto split_sizes_proto;
+      split_sizes_proto.set_name(graph.GenerateNodeArgName(first.Name() + "_split_sizes"));
+      split_sizes_proto.set_data_type(TensorProto_DataType_INT64);
+      split_sizes_proto.add_dims(static_cast<int64_t>(split_sizes.size()));
+      split_sizes_proto.set_raw_data(split_sizes.data(), split_sizes.size() * sizeof(int64_t));
+      split_inputs.push_back(&graph_utils::AddInitializer(graph, split_sizes_proto));
+    }
+
+    Node& split = graph.AddNode(graph.GenerateNodeName(first.Name() + "_split"),
+                                "Split",
+                                "splits the horizontally fused MatMul back into its sibling outputs",
+                                split_inputs,
+                                split_outputs);
+    split.AddAttribute("axis", split_axis);
+    if (onnx_opset < 13) {
+      split.AddAttribute("split", split_sizes);
+    }
+    split.SetExecutionProviderType(first.GetExecutionProviderType());
+
+    for (Node* sibling : siblings) {
+      graph_utils::RemoveNodeOutputEdges(graph, *sibling);
+      graph.RemoveNode(sibling->Index());
+    }
+
+    LOGS(logger, INFO) << "Fused " << siblings.size() << " sibling MatMuls sharing input '"
+                       << shared_input.Name() << "' into one MatMul + Split.";
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
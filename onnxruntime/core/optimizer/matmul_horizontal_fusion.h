@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@class MatMulHorizontalFusion
+
+Merges sibling MatMul nodes that share the same first input and have constant 2-D weights with a
+common inner dimension into a single wide MatMul followed by a Split. Many small GEMMs over the
+same activation (e.g. parallel task heads) are memory bound individually; the merged GEMM reads
+the shared input once and gives MLAS a matrix large enough to keep the cores busy.
+*/
+class MatMulHorizontalFusion : public GraphTransformer {
+ public:
+  MatMulHorizontalFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("MatMulHorizontalFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"MatMul"};
+    return &trigger_op_types;
+  }
+};
+
+}  // namespace onnxruntime
@@ -37,6 +37,11 @@ class MatMulScaleFusion : public GraphTransformer {
       Graph& graph, bool& modified,
       int graph_level, const logging::Logger& logger) const override;
 
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"MatMul", "FusedMatMul", "TransposeMatMul"};
+    return &trigger_op_types;
+  }
+
   const std::unordered_set<std::string> excluded_initializer_names_;
 };
 
@@ -14,6 +14,11 @@ class MatmulTransposeFusion : public GraphTransformer {
       : GraphTransformer("MatmulTransposeFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"MatMul", "FusedMatMul", "TransposeMatMul"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
@@ -121,6 +121,8 @@ class NchwcTransformerImpl {
   void TransformBatchNormalization(Node& node);
   void TransformTranspose(Node& node);
   void TransformResize(Node& node);
+  void TransformPad(Node& node);
+  void TransformSlice(Node& node);
 
   Graph& graph_;
 
@@ -926,6 +928,265 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
   removed_nodes_.push_front(node.Index());
 }
 
+// Padding of the spatial dimensions with a constant value can be applied to
+// each NCHWc channel block independently, so the operation can consume and
+// produce tensors in NCHWc format without reordering.
+void NchwcTransformerImpl::TransformPad(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+  auto& output_defs = node.MutableOutputDefs();
+
+  // Don't transform the node if the input is not already in NCHWc format.
+  auto it = nchwc_args_.find(input_defs[0]);
+  if (it == nchwc_args_.end()) {
+    return;
+  }
+  auto* nchwc_input = it->second.get();
+
+  // Only support the constant padding mode (the default value).
+  const auto* mode_attr = graph_utils::GetNodeAttribute(node, "mode");
+  if (mode_attr != nullptr && utils::HasString(*mode_attr) && mode_attr->s() != "constant") {
+    return;
+  }
+
+  std::vector<int64_t> pads;
+  float value = 0.f;
+
+  if (node.SinceVersion() >= 11) {
+    // Require that the pads tensor be static.
+    const auto* pads_tensor_proto = graph_utils::GetConstantInitializer(graph_, input_defs[1]->Name());
+    if ((pads_tensor_proto == nullptr) ||
+        (pads_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_INT64) ||
+        (pads_tensor_proto->dims_size() != 1) ||
+        (pads_tensor_proto->dims(0) != kNchwcDims * 2)) {
+      return;
+    }
+
+    Initializer pads_initializer{*pads_tensor_proto, graph_.ModelPath()};
+    const auto* pads_data = pads_initializer.data<int64_t>();
+    pads.assign(pads_data, pads_data + kNchwcDims * 2);
+
+    // Also require that the optional constant value tensor be static.
+    if ((input_defs.size() >= 3) && input_defs[2]->Exists()) {
+      const auto* value_tensor_proto = graph_utils::GetConstantInitializer(graph_, input_defs[2]->Name());
+      if ((value_tensor_proto == nullptr) ||
+          (value_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) ||
+          (value_tensor_proto->dims_size() != 0)) {
+        return;
+      }
+
+      Initializer value_initializer{*value_tensor_proto, graph_.ModelPath()};
+      value = *value_initializer.data<float>();
+    }
+  } else {
+    const auto* pads_attr = graph_utils::GetNodeAttribute(node, "pads");
+    if (pads_attr == nullptr || pads_attr->ints_size() != kNchwcDims * 2) {
+      return;
+    }
+    pads.assign(pads_attr->ints().begin(), pads_attr->ints().end());
+
+    const auto* value_attr = graph_utils::GetNodeAttribute(node, "value");
+    if (value_attr != nullptr && utils::HasFloat(*value_attr)) {
+      value = value_attr->f();
+    }
+  }
+
+  // Only support padding of the spatial dimensions. The batch and the
+  // block-aligned channel dimensions cannot be extended in NCHWc format.
+  for (int i = 0; i < kNchwcBatchChannelDims; i++) {
+    if (pads[i] != 0 || pads[kNchwcDims + i] != 0) {
+      return;
+    }
+  }
+  for (int i = kNchwcBatchChannelDims; i < kNchwcDims; i++) {
+    if (pads[i] < 0 || pads[kNchwcDims + i] < 0) {
+      return;
+    }
+  }
+
+  // Create the replacement node.
+  std::string nchwc_node_name = graph_.GenerateNodeName(output_defs[0]->Name() + "_nchwc");
+  Node& nchwc_node = graph_.AddNode(nchwc_node_name,
+                                    "Pad",
+                                    nchwc_node_name,
+                                    {nchwc_input->nchwc_arg_},
+                                    output_defs,
+                                    nullptr,
+                                    kMSNchwcDomain);
+  nchwc_node.SetExecutionProviderType(kCpuExecutionProvider);
+  nchwc_node.AddAttribute("pads", pads);
+  nchwc_node.AddAttribute("value", value);
+
+  nchwc_input->remaining_original_uses_--;
+
+  // Maintain the batch and channel dimensions from the NCHWc input. Spatial
+  // dimensions are unchanged when that dimension is not padded.
+  NchwcArgument::Shape output_shape(output_defs[0]);
+  output_shape.dims_[0] = nchwc_input->shape_.dims_[0];
+  output_shape.dims_[1] = nchwc_input->shape_.dims_[1];
+  for (int i = 0; i < kNchwcSpatialDims; i++) {
+    if (pads[kNchwcBatchChannelDims + i] == 0 && pads[kNchwcDims + kNchwcBatchChannelDims + i] == 0) {
+      output_shape.dims_[kNchwcBatchChannelDims + i] = nchwc_input->shape_.dims_[kNchwcBatchChannelDims + i];
+      output_shape.shifts_[i] = nchwc_input->shape_.shifts_[i];
+    }
+  }
+
+  CreateNchwcArgument(node, nchwc_node, nchwc_input->channels_, output_shape);
+  removed_nodes_.push_front(node.Index());
+}
+
+// Slicing of the batch and spatial dimensions copies whole NCHWc channel
+// blocks, so the operation can consume and produce tensors in NCHWc format
+// without reordering. Slicing of the channel dimension is not supported as
+// that would break the block alignment.
+void NchwcTransformerImpl::TransformSlice(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+  auto& output_defs = node.MutableOutputDefs();
+
+  // Don't transform the node if the input is not already in NCHWc format.
+  auto it = nchwc_args_.find(input_defs[0]);
+  if (it == nchwc_args_.end()) {
+    return;
+  }
+  auto* nchwc_input = it->second.get();
+
+  std::vector<int64_t> raw_starts;
+  std::vector<int64_t> raw_ends;
+  std::vector<int64_t> raw_axes;
+
+  if (node.SinceVersion() >= 10) {
+    // Require that the starts/ends/axes/steps tensors be static.
+    auto get_static_ints = [this](const NodeArg* arg, std::vector<int64_t>& ints) {
+      const auto* tensor_proto = graph_utils::GetConstantInitializer(graph_, arg->Name());
+      if ((tensor_proto == nullptr) ||
+          (tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_INT64) ||
+          (tensor_proto->dims_size() != 1)) {
+        return false;
+      }
+      Initializer initializer{*tensor_proto, graph_.ModelPath()};
+      const auto* ints_data = initializer.data<int64_t>();
+      ints.assign(ints_data, ints_data + initializer.size());
+      return true;
+    };
+
+    if (!get_static_ints(input_defs[1], raw_starts) ||
+        !get_static_ints(input_defs[2], raw_ends)) {
+      return;
+    }
+    if ((input_defs.size() >= 4) && input_defs[3]->Exists() &&
+        !get_static_ints(input_defs[3], raw_axes)) {
+      return;
+    }
+    if ((input_defs.size() >= 5) && input_defs[4]->Exists()) {
+      std::vector<int64_t> raw_steps;
+      if (!get_static_ints(input_defs[4], raw_steps)) {
+        return;
+      }
+      // Only support the unit step size (the default value).
+      for (auto step : raw_steps) {
+        if (step != 1) {
+          return;
+        }
+      }
+    }
+  } else {
+    const auto* starts_attr = graph_utils::GetNodeAttribute(node, "starts");
+    const auto* ends_attr = graph_utils::GetNodeAttribute(node, "ends");
+    if (starts_attr == nullptr || ends_attr == nullptr) {
+      return;
+    }
+    raw_starts.assign(starts_attr->ints().begin(), starts_attr->ints().end());
+    raw_ends.assign(ends_attr->ints().begin(), ends_attr->ints().end());
+
+    const auto* axes_attr = graph_utils::GetNodeAttribute(node, "axes");
+    if (axes_attr != nullptr) {
+      raw_axes.assign(axes_attr->ints().begin(), axes_attr->ints().end());
+    }
+  }
+
+  if (raw_starts.empty() ||
+      (raw_starts.size() != raw_ends.size()) ||
+      (!raw_axes.empty() && raw_axes.size() != raw_starts.size())) {
+    return;
+  }
+
+  // Normalize the slice extents to all of the NCHW dimensions. An end of -1
+  // selects the full extent of that dimension.
+  int64_t starts[kNchwcDims] = {0, 0, 0, 0};
+  int64_t ends[kNchwcDims] = {-1, -1, -1, -1};
+
+  const auto* input_shape = input_defs[0]->Shape();
+
+  for (size_t n = 0; n < raw_starts.size(); n++) {
+    int64_t axis = raw_axes.empty() ? static_cast<int64_t>(n) : raw_axes[n];
+    if (axis < 0) {
+      axis += kNchwcDims;
+    }
+    // Channel slicing would break the NCHWc block alignment.
+    if (axis < 0 || axis >= kNchwcDims || axis == 1) {
+      return;
+    }
+
+    int64_t start = raw_starts[n];
+    int64_t end = raw_ends[n];
+
+    // Resolve negative values using the actual dimension value when ONNX shape
+    // inferencing has computed one (an end of -1 would otherwise be confused
+    // with the full extent sentinel).
+    if (start < 0 || end < 0) {
+      if (input_shape == nullptr) {
+        return;
+      }
+      const auto& dim = input_shape->dim(static_cast<int>(axis));
+      if (!utils::HasDimValue(dim)) {
+        return;
+      }
+      if (start < 0) {
+        start += dim.dim_value();
+      }
+      if (end < 0) {
+        end += dim.dim_value();
+      }
+      if (start < 0 || end < 0) {
+        return;
+      }
+    }
+
+    starts[axis] = start;
+    ends[axis] = end;
+  }
+
+  // Create the replacement node.
+  std::string nchwc_node_name = graph_.GenerateNodeName(output_defs[0]->Name() + "_nchwc");
+  Node& nchwc_node = graph_.AddNode(nchwc_node_name,
+                                    "Slice",
+                                    nchwc_node_name,
+                                    {nchwc_input->nchwc_arg_},
+                                    output_defs,
+                                    nullptr,
+                                    kMSNchwcDomain);
+  nchwc_node.SetExecutionProviderType(kCpuExecutionProvider);
+  nchwc_node.AddAttribute("starts", std::vector<int64_t>(starts, starts + kNchwcDims));
+  nchwc_node.AddAttribute("ends", std::vector<int64_t>(ends, ends + kNchwcDims));
+
+  nchwc_input->remaining_original_uses_--;
+
+  // Maintain the channel dimension from the NCHWc input. The batch and
+  // spatial dimensions are unchanged when that dimension is not sliced.
+  NchwcArgument::Shape output_shape(output_defs[0]);
+  output_shape.dims_[1] = nchwc_input->shape_.dims_[1];
+  for (int i = 0; i < kNchwcDims; i++) {
+    if (i != 1 && starts[i] == 0 && ends[i] == -1) {
+      output_shape.dims_[i] = nchwc_input->shape_.dims_[i];
+      if (i >= kNchwcBatchChannelDims) {
+        output_shape.shifts_[i - kNchwcBatchChannelDims] = nchwc_input->shape_.shifts_[i - kNchwcBatchChannelDims];
+      }
+    }
+  }
+
+  CreateNchwcArgument(node, nchwc_node, nchwc_input->channels_, output_shape);
+  removed_nodes_.push_front(node.Index());
+}
+
 void NchwcTransformerImpl::Transform(Node& node) {
   if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Conv", {1, 11}) ||
       graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedConv", {1}, kMSDomain)) {
@@ -957,6 +1218,10 @@ void NchwcTransformerImpl::Transform(Node& node) {
     } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Upsample", {9, 13}) ||
                graph_utils::IsSupportedOptypeVersionAndDomain(node, "Resize", {10, 11, 13})) {
       TransformResize(node);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Pad", {2, 11, 13})) {
+      TransformPad(node);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Slice", {1, 10, 11, 13})) {
+      TransformSlice(node);
     } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "GlobalMaxPool", {1}) ||
                graph_utils::IsSupportedOptypeVersionAndDomain(node, "GlobalAveragePool", {1})) {
       // Convert these pooling types only if the input is already in NCHWc format.
@@ -3,6 +3,7 @@
 
 #include <deque>
 #include "core/graph/graph_utils.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/optimizer/initializer.h"
 #include "core/optimizer/nhwc_transformer.h"
 #include "core/optimizer/utils.h"
@@ -11,6 +12,12 @@ using namespace ONNX_NAMESPACE;
 using namespace ::onnxruntime::common;
 namespace onnxruntime {
 
+static bool IsNhwcFloatTensor(const NodeArg* node_arg) {
+  const auto* type = node_arg->TypeAsProto();
+  return type != nullptr && type->has_tensor_type() &&
+         type->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_FLOAT;
+}
+
 class NhwcTransformerImpl {
  public:
   NhwcTransformerImpl(Graph& graph) noexcept : graph_(graph) {}
@@ -45,8 +52,9 @@ class NhwcTransformerImpl {
   void InsertReorderInput(Node& node, int rank);
 
   void TransformQLinearConv(Node& node);
-  void TransformQLinearBinary(Node& node);
-  void TransformQLinearActivation(Node& node);
+  void TransformConv(Node& node);
+  void TransformBinary(Node& node, size_t b_input_index);
+  void TransformActivation(Node& node);
   void TransformQLinearGlobalAveragePool(Node& node);
 
   Graph& graph_;
@@ -166,11 +174,55 @@ void NhwcTransformerImpl::TransformQLinearConv(Node& node) {
   removed_nodes_.push_front(node.Index());
 }
 
-void NhwcTransformerImpl::TransformQLinearBinary(Node& node) {
+void NhwcTransformerImpl::TransformConv(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+  auto& output_defs = node.MutableOutputDefs();
+
+  if (!IsNhwcFloatTensor(input_defs[0])) {
+    return;
+  }
+
+  // Require that the weights tensor have a shape so that the necessary
+  // Transpose nodes can be inserted into the graph.
+  auto* weights_shape = input_defs[1]->Shape();
+  if (weights_shape == nullptr) {
+    return;
+  }
+
+  // Grouped convolutions are not supported by the NHWC kernel.
+  const auto* group_attr = graph_utils::GetNodeAttribute(node, "group");
+  if (group_attr != nullptr && utils::HasInt(*group_attr) && group_attr->i() != 1) {
+    return;
+  }
+
+  // Create the replacement node.
+  std::string nhwc_node_name = graph_.GenerateNodeName(output_defs[0]->Name() + "_nhwc");
+  Node& nhwc_node = graph_.AddNode(nhwc_node_name,
+                                   "NhwcConv",
+                                   nhwc_node_name,
+                                   input_defs,
+                                   output_defs,
+                                   &node.GetAttributes(),
+                                   kMSDomain);
+  nhwc_node.SetExecutionProviderType(kCpuExecutionProvider);
+
+  auto* nhwc_input = LookupNhwcArgument(input_defs[0]);
+  if (nhwc_input == nullptr) {
+    InsertReorderInput(nhwc_node, weights_shape->dim_size());
+  } else {
+    nhwc_node.MutableInputDefs()[0] = nhwc_input->nhwc_arg_;
+    nhwc_input->remaining_original_uses_--;
+  }
+
+  CreateNhwcArgument(node, nhwc_node, weights_shape->dim_size());
+  removed_nodes_.push_front(node.Index());
+}
+
+void NhwcTransformerImpl::TransformBinary(Node& node, size_t b_input_index) {
   auto& input_defs = node.MutableInputDefs();
 
   auto* input_def_a = input_defs[0];
-  auto* input_def_b = input_defs[3];
+  auto* input_def_b = input_defs[b_input_index];
 
   // For simplicity, require that both inputs have the same tensor rank.
   auto* input_shape_a = input_def_a->Shape();
@@ -192,13 +244,13 @@ void NhwcTransformerImpl::TransformQLinearBinary(Node& node) {
   // use counts of the NHWC inputs.
   input_defs[0] = nhwc_input_a->nhwc_arg_;
   nhwc_input_a->remaining_original_uses_--;
-  input_defs[3] = nhwc_input_b->nhwc_arg_;
+  input_defs[b_input_index] = nhwc_input_b->nhwc_arg_;
   nhwc_input_b->remaining_original_uses_--;
 
   CreateNhwcArgument(node, node, nhwc_input_a->rank_);
 }
 
-void NhwcTransformerImpl::TransformQLinearActivation(Node& node) {
+void NhwcTransformerImpl::TransformActivation(Node& node) {
   auto& input_defs = node.MutableInputDefs();
 
   auto* nhwc_input = LookupNhwcArgument(input_defs[0]);
@@ -242,12 +294,26 @@ void NhwcTransformerImpl::Transform(Node& node) {
     TransformQLinearConv(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearAdd", {1}, kMSDomain) ||
              graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearMul", {1}, kMSDomain)) {
-    TransformQLinearBinary(node);
+    TransformBinary(node, 3);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearLeakyRelu", {1}, kMSDomain) ||
              graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearSigmoid", {1}, kMSDomain)) {
-    TransformQLinearActivation(node);
+    TransformActivation(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearGlobalAveragePool", {1}, kMSDomain)) {
     TransformQLinearGlobalAveragePool(node);
+  } else if (MlasNchwcGetBlockSize() <= 1) {
+    // Platforms with a blocked layout kernel use the NCHWc transformer for
+    // float tensors instead.
+    if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Conv", {1, 11})) {
+      TransformConv(node);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13}) ||
+               graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13})) {
+      TransformBinary(node, 1);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13}) ||
+               graph_utils::IsSupportedOptypeVersionAndDomain(node, "LeakyRelu", {6}) ||
+               graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+               graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13})) {
+      TransformActivation(node);
+    }
   }
 }
 
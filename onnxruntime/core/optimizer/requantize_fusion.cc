@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/requantize_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Requantization is only supported per-tensor, so the quantization parameters
+// must be scalars (or 1 element vectors).
+bool IsScalarQuantizationParameter(const NodeArg* node_arg) {
+  if (node_arg == nullptr || !node_arg->Exists()) {
+    return false;
+  }
+
+  const auto* shape = node_arg->Shape();
+  if (shape == nullptr) {
+    return false;
+  }
+
+  if (shape->dim_size() == 0) {
+    return true;
+  }
+
+  return shape->dim_size() == 1 && shape->dim(0).has_dim_value() && shape->dim(0).dim_value() == 1;
+}
+
+bool Is8BitIntType(const NodeArg* node_arg) {
+  if (node_arg == nullptr || node_arg->TypeAsProto() == nullptr ||
+      !node_arg->TypeAsProto()->tensor_type().has_elem_type()) {
+    return false;
+  }
+
+  const auto elem_type = node_arg->TypeAsProto()->tensor_type().elem_type();
+  return elem_type == ONNX_NAMESPACE::TensorProto_DataType_INT8 ||
+         elem_type == ONNX_NAMESPACE::TensorProto_DataType_UINT8;
+}
+
+}  // namespace
+
+/**
+RequantizeFusion will fuse subgraph like below into RequantizeLinear:
+
+  (8-bit input), x_scale, x_zero_point        (8-bit input), x_scale, x_zero_point, y_scale, y_zero_point
+        |            |         |                    |             |         |          |          |
+        v            v         v                    v             v         v          v          v
+      DequantizeLinear <-------+                        RequantizeLinear <--+----------+----------+
+             |                              ---->                |
+             v                                                   v
+      QuantizeLinear <--- y_scale, y_zero_point              (output)
+             |
+             v
+         (output)
+
+QDQ format models alternate DequantizeLinear and QuantizeLinear around every
+quantized operator, so collapsing the adjacent pairs halves the memory traffic
+of the boundary and skips the intermediate float tensor.
+*/
+Status RequantizeFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+  std::vector<std::reference_wrapper<Node>> nodes_to_remove;
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& quantize_node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(quantize_node, modified, graph_level, logger));
+
+    if (!(graph_utils::IsSupportedOptypeVersionAndDomain(quantize_node, "QuantizeLinear", {10, 13}) ||
+          graph_utils::IsSupportedOptypeVersionAndDomain(quantize_node, "QuantizeLinear", {1}, kMSDomain)) ||
+        !graph_utils::IsSupportedProvider(quantize_node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // The fused operator requires an explicit output zero point.
+    if (quantize_node.InputDefs().size() < 3) {
+      continue;
+    }
+
+    const Node* p_dequantize_node = graph_utils::GetInputNode(quantize_node, 0 /*arg_index*/);
+    if (p_dequantize_node == nullptr) {
+      continue;
+    }
+
+    Node& dequantize_node = *graph.GetNode(p_dequantize_node->Index());
+    if (!(graph_utils::IsSupportedOptypeVersionAndDomain(dequantize_node, "DequantizeLinear", {10, 13}) ||
+          graph_utils::IsSupportedOptypeVersionAndDomain(dequantize_node, "DequantizeLinear", {1}, kMSDomain)) ||
+        dequantize_node.GetExecutionProviderType() != quantize_node.GetExecutionProviderType()) {
+      continue;
+    }
+
+    // The fused operator requires an explicit input zero point, and the float
+    // intermediate must have no other consumers.
+    if (dequantize_node.InputDefs().size() < 3 ||
+        !optimizer_utils::CheckOutputEdges(graph, dequantize_node, 1)) {
+      continue;
+    }
+
+    // Only per-tensor quantization over 8-bit integer data is supported.
+    if (!Is8BitIntType(dequantize_node.InputDefs()[0]) ||
+        !IsScalarQuantizationParameter(dequantize_node.InputDefs()[1]) ||
+        !IsScalarQuantizationParameter(dequantize_node.InputDefs()[2]) ||
+        !IsScalarQuantizationParameter(quantize_node.InputDefs()[1]) ||
+        !IsScalarQuantizationParameter(quantize_node.InputDefs()[2])) {
+      continue;
+    }
+
+    std::vector<NodeArg*> input_defs{
+        dequantize_node.MutableInputDefs()[0],
+        dequantize_node.MutableInputDefs()[1],
+        dequantize_node.MutableInputDefs()[2],
+        quantize_node.MutableInputDefs()[1],
+        quantize_node.MutableInputDefs()[2]};
+
+    Node* fused_node = &graph.AddNode(quantize_node.Name(),
+                                      "RequantizeLinear",
+                                      "",
+                                      input_defs,
+                                      quantize_node.MutableOutputDefs(),
+                                      nullptr,
+                                      kMSDomain);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node->SetExecutionProviderType(quantize_node.GetExecutionProviderType());
+
+    nodes_to_remove.push_back(dequantize_node);
+    nodes_to_remove.push_back(quantize_node);
+  }
+
+  modified = modified || !nodes_to_remove.empty();
+
+  for (const auto& node : nodes_to_remove) {
+    graph_utils::RemoveNodeOutputEdges(graph, node);
+    graph.RemoveNode(node.get().Index());
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class RequantizeFusion
+Fuse DequantizeLinear + QuantizeLinear pairs into RequantizeLinear, which maps
+the 8-bit data to the new quantization range in a single pass instead of
+materializing the intermediate float tensor.
+*/
+class RequantizeFusion : public GraphTransformer {
+ public:
+  RequantizeFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("RequantizeFusion", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"QuantizeLinear"};
+    return &trigger_op_types;
+  }
+};
+
+}  // namespace onnxruntime
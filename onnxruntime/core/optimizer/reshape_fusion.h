@@ -18,6 +18,11 @@ class ReshapeFusion : public GraphTransformer {
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
 
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"Reshape"};
+    return &trigger_op_types;
+  }
+
  private:
   static bool Fuse_Subgraph(Node& reshape, Graph& graph, const logging::Logger& logger);
   static bool Match_One_Element_Output_Subgraph_1(Graph& graph, const NodeArg& root_input, const Node& concat,
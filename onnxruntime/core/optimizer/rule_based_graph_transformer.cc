@@ -5,10 +5,27 @@
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/rewrite_rule.h"
 
+#include <algorithm>
+#include <thread>
+
 using namespace ::onnxruntime::common;
 
 namespace onnxruntime {
 
+namespace {
+
+// Minimum number of nodes before the condition matching phase is spread across
+// worker threads. Small graphs finish a serial pass faster than worker threads
+// can be launched.
+constexpr size_t kMinNodesForParallelMatch = 1024;
+
+// Upper bound on the number of matching threads. The matching phase is memory
+// bound, so wider fan-out stops paying off well before the core count on large
+// machines.
+constexpr size_t kMaxMatchThreads = 8;
+
+}  // namespace
+
 Status RuleBasedGraphTransformer::Register(std::unique_ptr<RewriteRule> rule) {
   auto op_types = rule->TargetOpTypes();
   // XXX: This function does not appear to be exception safe.
@@ -17,7 +34,10 @@ Status RuleBasedGraphTransformer::Register(std::unique_ptr<RewriteRule> rule) {
     any_op_type_rules_.push_back(*rule);
   } else {
     std::for_each(op_types.cbegin(), op_types.cend(),
-                  [&](const std::string& op_type) { op_type_to_rules_[op_type].push_back(*rule); });
+                  [&](const std::string& op_type) {
+                    op_type_to_rules_[op_type].push_back(*rule);
+                    trigger_op_types_.insert(op_type);
+                  });
   }
 
   // Save unique pointer at the rules_ list.
@@ -39,10 +59,110 @@ Status RuleBasedGraphTransformer::ApplyRulesOnNode(Graph& graph, Node& node,
   return Status::OK();
 }
 
+Status RuleBasedGraphTransformer::ApplyWithParallelMatch(Graph& graph, const std::vector<NodeIndex>& order,
+                                                         size_t thread_count, bool& modified, int graph_level,
+                                                         const logging::Logger& logger) const {
+  // Phase 1: evaluate the rule conditions over disjoint ranges of the
+  // topological order. Condition checks are read-only on the graph, so the
+  // ranges can be matched concurrently.
+  std::vector<std::vector<std::reference_wrapper<const RewriteRule>>> candidates(order.size());
+  std::vector<Status> match_statuses(thread_count, Status::OK());
+
+  auto match_range = [&](size_t thread_id) {
+    ORT_TRY {
+      const size_t stride = (order.size() + thread_count - 1) / thread_count;
+      const size_t begin = thread_id * stride;
+      const size_t end = std::min(order.size(), begin + stride);
+
+      for (size_t position = begin; position < end; ++position) {
+        const Node* node = graph.GetNode(order[position]);
+        if (node == nullptr || !graph_utils::IsSupportedProvider(*node, GetCompatibleExecutionProviders())) {
+          continue;
+        }
+
+        auto collect_matches = [&](const std::vector<std::reference_wrapper<const RewriteRule>>* rules) {
+          if (rules != nullptr) {
+            for (const RewriteRule& rule : *rules) {
+              if (rule.CheckCondition(graph, *node, logger)) {
+                candidates[position].push_back(std::cref(rule));
+              }
+            }
+          }
+        };
+
+        collect_matches(GetRewriteRulesForOpType(node->OpType()));
+        collect_matches(GetAnyOpRewriteRules());
+      }
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        match_statuses[thread_id] = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                                                    "Exception during rewrite rule condition matching: ", ex.what());
+      });
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(thread_count - 1);
+  for (size_t thread_id = 1; thread_id < thread_count; ++thread_id) {
+    workers.emplace_back(match_range, thread_id);
+  }
+  match_range(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  for (const auto& match_status : match_statuses) {
+    ORT_RETURN_IF_ERROR(match_status);
+  }
+
+  // Phase 2: apply the matched rules serially in topological order.
+  // CheckConditionAndApply re-evaluates the condition before applying the
+  // body, so matches that earlier rule applications invalidated are dropped
+  // here instead of being applied stale.
+  for (size_t position = 0; position < order.size(); ++position) {
+    auto* node = graph.GetNode(order[position]);
+    if (!node) {
+      continue;
+    }
+
+    if (!graph_utils::IsSupportedProvider(*node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    auto rule_effect = RuleEffect::kNone;
+
+    if (!candidates[position].empty()) {
+      ORT_RETURN_IF_ERROR(ApplyRulesOnNode(graph, *node, candidates[position], rule_effect, logger));
+    }
+
+    if (rule_effect != RuleEffect::kNone) {
+      modified = true;
+    }
+
+    if (rule_effect != RuleEffect::kRemovedCurrentNode) {
+      ORT_RETURN_IF_ERROR(Recurse(*node, modified, graph_level, logger));
+    }
+  }
+
+  return Status::OK();
+}
+
 Status RuleBasedGraphTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
   GraphViewer graph_viewer(graph);
   auto& order = graph_viewer.GetNodesInTopologicalOrder();
 
+  // On large graphs the condition matching dominates the pass, so evaluate the
+  // conditions concurrently and only apply the matches serially. Rules that a
+  // concurrent match cannot see (enabled by an application later in the same
+  // pass) are picked up by the next step of the fixed point loop in
+  // GraphTransformerManager.
+  const size_t hardware_threads = std::thread::hardware_concurrency();
+
+  if (order.size() >= kMinNodesForParallelMatch && RulesCount() > 0 && hardware_threads > 1) {
+    const size_t thread_count = std::min(hardware_threads, kMaxMatchThreads);
+    return ApplyWithParallelMatch(graph, order, thread_count, modified, graph_level, logger);
+  }
+
   for (NodeIndex i : order) {
     auto* node = graph.GetNode(i);
     // A node might not be found as it might have already been deleted from one of the rules.
@@ -19,6 +19,11 @@ class SkipLayerNormFusion : public GraphTransformer {
       : GraphTransformer("SkipLayerNormFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"LayerNormalization"};
+    return &trigger_op_types;
+  }
 };
 
 }  // namespace onnxruntime
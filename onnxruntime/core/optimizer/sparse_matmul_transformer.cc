@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/sparse_matmul_transformer.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+
+namespace onnxruntime {
+
+namespace {
+// Keep in sync with the SparseMatMul kernel: below this density the compressed sparse column
+// product beats the dense SGEMM despite the indirect loads.
+constexpr float kMaxDensityToRewrite = 0.15f;
+
+// Tiny weights aren't worth rewriting; the dense multiply is already cheap.
+constexpr int64_t kMinWeightElements = 256;
+}  // namespace
+
+Status SparseMatMulTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                          const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (!node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "MatMul", {1, 9, 13}) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // the contrib op is restricted to 2-D float inputs
+    auto input_defs = node.MutableInputDefs();
+    const auto* a_shape = input_defs[0]->Shape();
+    const auto* b_shape = input_defs[1]->Shape();
+    if (a_shape == nullptr || b_shape == nullptr || a_shape->dim_size() != 2 || b_shape->dim_size() != 2) {
+      continue;
+    }
+
+    const auto* a_type = input_defs[0]->Type();
+    if (a_type == nullptr || *a_type != "tensor(float)") {
+      continue;
+    }
+
+    // the weight must be a constant initializer for the kernel to pre-pack it
+    const auto* weight_proto = graph_utils::GetConstantInitializer(graph, input_defs[1]->Name());
+    if (weight_proto == nullptr ||
+        weight_proto->data_location() == ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL) {
+      continue;
+    }
+
+    Initializer weight{*weight_proto, graph.ModelPath()};
+    if (weight.size() < kMinWeightElements) {
+      continue;
+    }
+
+    const float* weight_data = weight.data<float>();
+    if (weight_data == nullptr) {
+      continue;
+    }
+
+    int64_t nnz = 0;
+    for (int64_t i = 0, size = weight.size(); i < size; ++i) {
+      if (weight_data[i] != 0.0f) {
+        ++nnz;
+      }
+    }
+
+    if (static_cast<float>(nnz) > kMaxDensityToRewrite * static_cast<float>(weight.size())) {
+      continue;
+    }
+
+    Node& sparse_matmul_node = graph.AddNode(graph.GenerateNodeName(node.Name() + "_sparse"),
+                                             "SparseMatMul",
+                                             "MatMul with mostly-zero constant weight",
+                                             input_defs,
+                                             node.MutableOutputDefs(), nullptr, kMSDomain);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    sparse_matmul_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    graph_utils::FinalizeNodeFusion(graph, {node}, sparse_matmul_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
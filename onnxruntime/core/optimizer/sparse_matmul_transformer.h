@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class SparseMatMulTransformer
+
+Rewrites MatMul nodes whose weight is a mostly-zero 2-D constant initializer to the
+com.microsoft.SparseMatMul contrib op, whose CPU kernel pre-packs the weight into compressed
+sparse column form and skips the zero entries.
+*/
+class SparseMatMulTransformer : public GraphTransformer {
+ public:
+  SparseMatMulTransformer(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("SparseMatMulTransformer", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    static const std::unordered_set<std::string> trigger_op_types{"MatMul"};
+    return &trigger_op_types;
+  }
+};
+
+}  // namespace onnxruntime
@@ -28,6 +28,7 @@ limitations under the License.
 #include "core/framework/callback.h"
 #include "core/platform/env_time.h"
 #include "core/platform/telemetry.h"
+#include "core/session/onnxruntime_c_api.h"
 
 #ifndef _WIN32
 #include <sys/types.h>
@@ -59,15 +60,43 @@ struct ThreadOptions {
   unsigned int stack_size = 0;
 
   // Thread affinity means a thread can only run on the logical processors that the thread is allowed to run on.
-  // If the vector is not empty, set the affinity of each thread to just one CPU.
-  // Index is thread index, value is CPU ID, starting from zero. For example, the first thread in the pool will be bound
-  // to the logical processor with id of affinity[0]. If the vector is empty, the thread can run on all the processors
-  // its process can run on. NOTE: When hyperthreading is enabled, for example, on a 4 cores 8 physical threads CPU,
-  // processor group [0,1,2,3] may only contain half of the physical cores.
+  // If the vector is not empty, entry i is a bitmask of the logical processors that the i-th thread in the pool
+  // may run on.  A mask with a single bit set pins the thread to one processor; a mask covering a physical core
+  // and its hyperthread sibling reserves the whole core for the thread.  An entry of zero leaves the
+  // corresponding thread unrestricted.  If the vector is empty, threads can run on all the processors the
+  // process can run on.  NOTE: a mask only covers the first 64 logical processors; on Windows machines with
+  // more than one processor group, threads are distributed round-robin across the active groups and the mask
+  // is applied within the thread's group.
   std::vector<size_t> affinity;
 
   // Set or unset denormal as zero.
   bool set_denormal_as_zero = false;
+
+  // Keep tasks submitted from outside the pool on the queue of a single
+  // preferred worker (instead of a randomly chosen one) so that streams of
+  // short tasks stay on one core and benefit from a warm cache.  Work
+  // stealing between the per-thread queues still rebalances large loops.
+  bool use_sticky_task_queues = false;
+
+  // Number of iterations a worker spins looking for work before blocking,
+  // expressed as a power of two.  A negative value selects the built-in
+  // default (2^20 pause iterations, roughly a millisecond).  Zero makes
+  // workers block as soon as their queues empty.
+  int spin_count_log2 = -1;
+
+  // Spin only while other workers have executed work since this worker last
+  // ran dry.  When the pool is quiescing, workers block immediately instead
+  // of burning a core on a full spin.
+  bool adaptive_spinning = false;
+
+  // When custom_create_thread_fn is set, pool threads are obtained from the
+  // application via this callback instead of being created by onnxruntime, and
+  // custom_join_thread_fn (which must be set as well) is called once per
+  // returned handle when the pool shuts down.  stack_size and affinity are not
+  // applied to application-provided threads.
+  OrtCustomCreateThreadFn custom_create_thread_fn = nullptr;
+  void* custom_thread_creation_options = nullptr;
+  OrtCustomJoinThreadFn custom_join_thread_fn = nullptr;
 };
 /// \brief An interface used by the onnxruntime implementation to
 /// access operating system functionality like the filesystem etc.
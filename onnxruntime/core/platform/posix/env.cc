@@ -119,6 +119,16 @@ class PosixThread : public EnvThread {
   PosixThread(const ORTCHAR_T* name_prefix, int index,
               unsigned (*start_address)(int id, Eigen::ThreadPoolInterface* param), Eigen::ThreadPoolInterface* param,
               const ThreadOptions& thread_options) {
+    if (thread_options.custom_create_thread_fn != nullptr) {
+      // The application supplies the thread; stack size and affinity stay under its control.
+      custom_join_thread_fn = thread_options.custom_join_thread_fn;
+      custom_thread_handle = thread_options.custom_create_thread_fn(
+          thread_options.custom_thread_creation_options, CustomThreadMain,
+          new Param{name_prefix, index, start_address, param, thread_options});
+      if (custom_thread_handle == nullptr)
+        ORT_THROW("custom_create_thread_fn returned a null handle");
+      return;
+    }
     pthread_attr_t attr;
     int s = pthread_attr_init(&attr);
     if (s != 0)
@@ -134,17 +144,30 @@ class PosixThread : public EnvThread {
       ORT_THROW("pthread_create failed");
 #if !defined(__APPLE__) && !defined(__ANDROID__)
     if (!thread_options.affinity.empty()) {
-      cpu_set_t cpuset;
-      CPU_ZERO(&cpuset);
-      CPU_SET(thread_options.affinity[index], &cpuset);
-      s = pthread_setaffinity_np(hThread, sizeof(cpu_set_t), &cpuset);
-      if (s != 0)
-        ORT_THROW("pthread_setaffinity_np failed");
+      // Each affinity entry is a bitmask of the logical processors the thread
+      // may run on.  A zero mask leaves the thread unrestricted.
+      size_t mask = thread_options.affinity[index];
+      if (mask != 0) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        for (unsigned cpu = 0; cpu < sizeof(size_t) * 8; ++cpu) {
+          if (mask & (size_t{1} << cpu)) {
+            CPU_SET(cpu, &cpuset);
+          }
+        }
+        s = pthread_setaffinity_np(hThread, sizeof(cpu_set_t), &cpuset);
+        if (s != 0)
+          ORT_THROW("pthread_setaffinity_np failed");
+      }
     }
 #endif
   }
 
   ~PosixThread() override {
+    if (custom_thread_handle != nullptr) {
+      custom_join_thread_fn(custom_thread_handle);
+      return;
+    }
     void* res;
 #ifdef NDEBUG
     pthread_join(hThread, &res);
@@ -171,9 +194,49 @@ class PosixThread : public EnvThread {
     }
     return nullptr;
   }
+
+  static void CustomThreadMain(void* param) {
+    ThreadMain(param);
+  }
+
   pthread_t hThread;
+  OrtCustomThreadHandle custom_thread_handle = nullptr;
+  OrtCustomJoinThreadFn custom_join_thread_fn = nullptr;
 };
 
+#if !defined(__APPLE__) && !defined(__ANDROID__)
+// Returns a mask of the logical processors sharing a physical core with the
+// given logical processor, derived from the kernel's topology information.
+// The sysfs file holds entries such as "0,16" or "0-1".  Returns 0 if the
+// topology cannot be read.
+static size_t GetCoreSiblingMask(unsigned cpu) {
+  char path[80];
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", cpu);
+  FILE* f = fopen(path, "r");
+  if (f == nullptr)
+    return 0;
+  char line[256];
+  size_t mask = 0;
+  if (fgets(line, sizeof(line), f) != nullptr) {
+    for (char* token = strtok(line, ","); token != nullptr; token = strtok(nullptr, ",")) {
+      unsigned lo, hi;
+      if (sscanf(token, "%u-%u", &lo, &hi) != 2) {
+        if (sscanf(token, "%u", &lo) != 1) {
+          mask = 0;
+          break;
+        }
+        hi = lo;
+      }
+      for (unsigned i = lo; i <= hi && i < sizeof(size_t) * 8; ++i) {
+        mask |= size_t{1} << i;
+      }
+    }
+  }
+  fclose(f);
+  return mask;
+}
+#endif
+
 class PosixEnv : public Env {
  public:
   static PosixEnv& Instance() {
@@ -195,8 +258,36 @@ class PosixEnv : public Env {
   }
 
   std::vector<size_t> GetThreadAffinityMasks() const override {
+#if !defined(__APPLE__) && !defined(__ANDROID__)
+    // Build one mask per physical core, covering the core and its hyperthread
+    // siblings.  A worker pinned to such a mask owns the whole core, so the OS
+    // neither migrates it across cores (which destroys cache locality) nor
+    // schedules two workers onto sibling hyperthreads of the same core.
+    std::vector<size_t> masks;
+    unsigned num_cpus = std::min<unsigned>(std::thread::hardware_concurrency(),
+                                           static_cast<unsigned>(sizeof(size_t) * 8));
+    for (unsigned cpu = 0; cpu < num_cpus; ++cpu) {
+      size_t mask = GetCoreSiblingMask(cpu);
+      if (mask == 0) {
+        // Topology information is unavailable; fall back below.
+        masks.clear();
+        break;
+      }
+      // Emit each core's mask once, for its lowest-numbered logical processor.
+      if ((mask & ((size_t{1} << cpu) - 1)) == 0) {
+        masks.push_back(mask);
+      }
+    }
+    if (!masks.empty())
+      return masks;
+#endif
+    // Without topology information, assume the second half of the logical
+    // processors are hyperthread siblings of the first half and pin one
+    // worker to each presumed physical core.
     std::vector<size_t> ret(std::thread::hardware_concurrency() / 2);
-    std::iota(ret.begin(), ret.end(), 0);
+    for (size_t i = 0; i < ret.size(); ++i) {
+      ret[i] = size_t{1} << i;
+    }
     return ret;
   }
 
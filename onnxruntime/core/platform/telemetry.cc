@@ -2,6 +2,10 @@
 // Licensed under the MIT License.
 
 #include "core/platform/telemetry.h"
+
+#include <atomic>
+#include <cstdlib>
+
 #include "core/platform/env.h"
 
 namespace onnxruntime {
@@ -74,5 +78,40 @@ void Telemetry::LogExecutionProviderEvent(LUID* adapterLuid) const {
   ORT_UNUSED_PARAMETER(adapterLuid);
 }
 
+void Telemetry::LogGraphPartitioning(const std::string& execution_provider_id,
+                                     uint32_t num_assigned_nodes) const {
+  ORT_UNUSED_PARAMETER(execution_provider_id);
+  ORT_UNUSED_PARAMETER(num_assigned_nodes);
+}
+
+void Telemetry::LogArenaExtension(const std::string& allocator_name, int64_t extension_bytes,
+                                  int64_t total_allocated_bytes) const {
+  ORT_UNUSED_PARAMETER(allocator_name);
+  ORT_UNUSED_PARAMETER(extension_bytes);
+  ORT_UNUSED_PARAMETER(total_allocated_bytes);
+}
+
+bool Telemetry::ShouldLogSampledEvent() {
+  static const uint64_t ratio = []() -> uint64_t {
+    const std::string value = Env::Default().GetEnvironmentVar("ORT_TELEMETRY_SAMPLING_RATIO");
+    if (value.empty()) {
+      return 1;
+    }
+    char* parse_end = nullptr;
+    const unsigned long parsed = std::strtoul(value.c_str(), &parse_end, 10);
+    if (parse_end == value.c_str() || parsed == 0) {
+      return 1;
+    }
+    return parsed;
+  }();
+
+  if (ratio <= 1) {
+    return true;
+  }
+
+  static std::atomic<uint64_t> counter{0};
+  return counter.fetch_add(1, std::memory_order_relaxed) % ratio == 0;
+}
+
 }  // namespace onnxruntime
 
@@ -61,6 +61,24 @@ class Telemetry {
 
   virtual void LogExecutionProviderEvent(LUID* adapterLuid) const;
 
+  // Logged once per execution provider that received nodes when graph partitioning
+  // completes, so always-on listeners can see how a model was split across providers
+  // without enabling the file-based profiler. For providers that compile fused
+  // subgraphs the node count is the number of partitions.
+  virtual void LogGraphPartitioning(const std::string& execution_provider_id,
+                                    uint32_t num_assigned_nodes) const;
+
+  // Logged when an arena grows by a new region from the device allocator. This sits
+  // on the allocation path, so implementations are expected to apply the sampling
+  // ratio (see ShouldLogSampledEvent).
+  virtual void LogArenaExtension(const std::string& allocator_name, int64_t extension_bytes,
+                                 int64_t total_allocated_bytes) const;
+
+  // 1-in-N decision for events that can fire at high rates. N is read once per process
+  // from the ORT_TELEMETRY_SAMPLING_RATIO environment variable; unset, 0 or 1 keep
+  // every event.
+  static bool ShouldLogSampledEvent();
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Telemetry);
 };
@@ -53,13 +53,27 @@ class WindowsThread : public EnvThread {
  public:
   WindowsThread(const ORTCHAR_T* name_prefix, int index,
                 unsigned (*start_address)(int id, Eigen::ThreadPoolInterface* param), Eigen::ThreadPoolInterface* param,
-                const ThreadOptions& thread_options)
-      : hThread((HANDLE)_beginthreadex(nullptr, thread_options.stack_size, ThreadMain,
-                                       new Param{name_prefix, index, start_address, param, thread_options}, 0,
-                                       &threadID)) {
+                const ThreadOptions& thread_options) {
+    if (thread_options.custom_create_thread_fn != nullptr) {
+      // The application supplies the thread; stack size and affinity stay under its control.
+      custom_join_thread_fn = thread_options.custom_join_thread_fn;
+      custom_thread_handle = thread_options.custom_create_thread_fn(
+          thread_options.custom_thread_creation_options, CustomThreadMain,
+          new Param{name_prefix, index, start_address, param, thread_options});
+      if (custom_thread_handle == nullptr)
+        ORT_THROW("custom_create_thread_fn returned a null handle");
+      return;
+    }
+    hThread.reset((HANDLE)_beginthreadex(nullptr, thread_options.stack_size, ThreadMain,
+                                         new Param{name_prefix, index, start_address, param, thread_options}, 0,
+                                         &threadID));
   }
 
   ~WindowsThread() {
+    if (custom_thread_handle != nullptr) {
+      custom_join_thread_fn(custom_thread_handle);
+      return;
+    }
     DWORD waitStatus = WaitForSingleObject(hThread.get(), INFINITE);
     FAIL_FAST_LAST_ERROR_IF(waitStatus == WAIT_FAILED);
   }
@@ -68,7 +82,9 @@ class WindowsThread : public EnvThread {
   // TODO: Find a way to avoid calling TerminateThread
   void OnCancel() {
 #if WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
-    TerminateThread(hThread.get(), 1);
+    // Application-provided threads are not ours to terminate.
+    if (custom_thread_handle == nullptr)
+      TerminateThread(hThread.get(), 1);
 #endif
   }
 
@@ -77,8 +93,32 @@ class WindowsThread : public EnvThread {
   static unsigned __stdcall ThreadMain(void* param) {
     std::unique_ptr<Param> p((Param*)param);
     // TODO: should I try to use SetThreadSelectedCpuSets?
-    if (!p->thread_options.affinity.empty())
-      SetThreadAffinityMask(GetCurrentThread(), p->thread_options.affinity[p->index]);
+    // Affinity is not applied to application-provided threads.
+    if (p->thread_options.custom_create_thread_fn == nullptr && !p->thread_options.affinity.empty()) {
+      // Each affinity entry is a bitmask of the logical processors the thread
+      // may run on.  A zero mask leaves the thread unrestricted.
+      KAFFINITY mask = static_cast<KAFFINITY>(p->thread_options.affinity[p->index]);
+      if (mask != 0) {
+#if WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
+        WORD group_count = GetActiveProcessorGroupCount();
+        if (group_count > 1) {
+          // On machines with more than 64 logical processors a mask alone does
+          // not name a processor.  Distribute the workers round-robin across
+          // the active processor groups and apply the mask within the assigned
+          // group, rather than implicitly confining every worker to the group
+          // the process started in.
+          GROUP_AFFINITY group_affinity = {};
+          group_affinity.Group = static_cast<WORD>(p->index % group_count);
+          group_affinity.Mask = mask;
+          SetThreadGroupAffinity(GetCurrentThread(), &group_affinity, nullptr);
+        } else {
+          SetThreadAffinityMask(GetCurrentThread(), mask);
+        }
+#else
+        SetThreadAffinityMask(GetCurrentThread(), mask);
+#endif
+      }
+    }
 #if WINVER >= _WIN32_WINNT_WIN10
     constexpr SetThreadDescriptionFunc pSetThrDesc = SetThreadDescription;
 #elif WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
@@ -107,10 +147,29 @@ class WindowsThread : public EnvThread {
     }
     return ret;
   }
+  static void CustomThreadMain(void* param) {
+    (void)ThreadMain(param);
+  }
+
   unsigned threadID = 0;
   wil::unique_handle hThread;
+  OrtCustomThreadHandle custom_thread_handle = nullptr;
+  OrtCustomJoinThreadFn custom_join_thread_fn = nullptr;
+};
+
+struct UnmapFileParam {
+  void* addr;
 };
 
+static void UnmapFile(void* param) noexcept {
+  UnmapFileParam* p = reinterpret_cast<UnmapFileParam*>(param);
+  if (!UnmapViewOfFile(p->addr)) {
+    const int err = GetLastError();
+    LOGS_DEFAULT(ERROR) << "UnmapViewOfFile failed. error code: " << err;
+  }
+  delete p;
+}
+
 class WindowsEnv : public Env {
  public:
   EnvThread* CreateThread(_In_opt_z_ const ORTCHAR_T* name_prefix, int index,
@@ -280,8 +339,61 @@ class WindowsEnv : public Env {
     return Status::OK();
   }
 
-  Status MapFileIntoMemory(_In_z_ const ORTCHAR_T*, FileOffsetType, size_t, MappedMemoryPtr&) const override {
-    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "MapFileIntoMemory is not implemented on Windows.");
+  Status MapFileIntoMemory(_In_z_ const ORTCHAR_T* file_path, FileOffsetType offset, size_t length,
+                           MappedMemoryPtr& mapped_memory) const override {
+    ORT_RETURN_IF_NOT(file_path);
+    ORT_RETURN_IF_NOT(offset >= 0);
+
+#if WINVER >= _WIN32_WINNT_WIN8
+    wil::unique_hfile file_handle{
+        CreateFile2(file_path, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, NULL)};
+#else
+    wil::unique_hfile file_handle{
+        CreateFileW(file_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)};
+#endif
+    if (file_handle.get() == INVALID_HANDLE_VALUE) {
+      const int err = GetLastError();
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "open file ", ToMBString(file_path), " fail, errcode = ", err);
+    }
+
+    if (length == 0) {
+      mapped_memory = MappedMemoryPtr{};
+      return Status::OK();
+    }
+
+    // use PAGE_WRITECOPY/FILE_MAP_COPY for parity with the copy-on-write
+    // (MAP_PRIVATE) mapping used on posix platforms.
+    wil::unique_handle file_mapping_handle{
+        CreateFileMappingW(file_handle.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr)};
+    if (file_mapping_handle.get() == nullptr) {
+      const int err = GetLastError();
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "CreateFileMapping ", ToMBString(file_path),
+                             " fail, errcode = ", err);
+    }
+
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    // the view offset must be a multiple of the allocation granularity
+    const FileOffsetType offset_to_granularity = offset % static_cast<FileOffsetType>(system_info.dwAllocationGranularity);
+    const size_t mapped_length = length + static_cast<size_t>(offset_to_granularity);
+    const FileOffsetType mapped_offset = offset - offset_to_granularity;
+
+    ULARGE_INTEGER mapped_offset_parts;
+    mapped_offset_parts.QuadPart = static_cast<ULONGLONG>(mapped_offset);
+    void* const mapped_base = MapViewOfFile(file_mapping_handle.get(), FILE_MAP_COPY,
+                                            mapped_offset_parts.HighPart, mapped_offset_parts.LowPart, mapped_length);
+    if (mapped_base == nullptr) {
+      const int err = GetLastError();
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "MapViewOfFile ", ToMBString(file_path),
+                             " fail, errcode = ", err);
+    }
+
+    mapped_memory =
+        MappedMemoryPtr{reinterpret_cast<char*>(mapped_base) + offset_to_granularity,
+                        OrtCallbackInvoker{OrtCallback{UnmapFile, new UnmapFileParam{mapped_base}}}};
+
+    return Status::OK();
   }
 
   bool FolderExists(const std::wstring& path) const override {
@@ -286,4 +286,41 @@ void WindowsTelemetry::LogExecutionProviderEvent(LUID* adapterLuid) const {
                     TraceLoggingUInt32(adapterLuid->HighPart, "adapterLuidHighPart"));
 }
 
+void WindowsTelemetry::LogGraphPartitioning(const std::string& execution_provider_id,
+                                            uint32_t num_assigned_nodes) const {
+  if (global_register_count_ == 0 || enabled_ == false)
+    return;
+
+  TraceLoggingWrite(telemetry_provider_handle,
+                    "GraphPartitioning",
+                    TraceLoggingBool(true, "UTCReplace_AppSessionGuid"),
+                    TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
+                    TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+                    // Telemetry info
+                    TraceLoggingUInt8(0, "schemaVersion"),
+                    TraceLoggingString(execution_provider_id.c_str(), "executionProviderId"),
+                    TraceLoggingUInt32(num_assigned_nodes, "numAssignedNodes"));
+}
+
+void WindowsTelemetry::LogArenaExtension(const std::string& allocator_name, int64_t extension_bytes,
+                                         int64_t total_allocated_bytes) const {
+  if (global_register_count_ == 0 || enabled_ == false)
+    return;
+
+  // arena growth sits on the allocation path, so only a sample of the events is emitted
+  if (!ShouldLogSampledEvent())
+    return;
+
+  TraceLoggingWrite(telemetry_provider_handle,
+                    "ArenaExtension",
+                    TraceLoggingBool(true, "UTCReplace_AppSessionGuid"),
+                    TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
+                    TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+                    // Telemetry info
+                    TraceLoggingUInt8(0, "schemaVersion"),
+                    TraceLoggingString(allocator_name.c_str(), "allocatorName"),
+                    TraceLoggingInt64(extension_bytes, "extensionBytes"),
+                    TraceLoggingInt64(total_allocated_bytes, "totalAllocatedBytes"));
+}
+
 }  // namespace onnxruntime
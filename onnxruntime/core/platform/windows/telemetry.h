@@ -45,6 +45,12 @@ class WindowsTelemetry : public Telemetry {
 
   void LogExecutionProviderEvent(LUID* adapterLuid) const override;
 
+  void LogGraphPartitioning(const std::string& execution_provider_id,
+                            uint32_t num_assigned_nodes) const override;
+
+  void LogArenaExtension(const std::string& allocator_name, int64_t extension_bytes,
+                         int64_t total_allocated_bytes) const override;
+
  private:
   static OrtMutex mutex_;
   static uint32_t global_register_count_;
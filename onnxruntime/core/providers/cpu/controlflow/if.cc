@@ -143,7 +143,7 @@ class IfImpl {
   const SessionState& session_state_;
   const If::Info& info_;
 
-  const std::vector<const OrtValue*>& implicit_inputs_;
+  const OpKernelContextInternal::ImplicitInputValues& implicit_inputs_;
 
   enum class AllocationType {
     Delayed,  // allocation of If output will be done by subgraph execution
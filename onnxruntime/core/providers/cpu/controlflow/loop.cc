@@ -191,6 +191,10 @@ class LoopImpl {
   void CreateInitialFeeds(std::vector<OrtValue>& feeds);
   void SaveOutputsAndUpdateFeeds(const std::vector<OrtValue>& last_outputs, std::vector<OrtValue>& next_inputs);
 
+  // seed the fetches for the given iteration with the preallocated loop carried
+  // value buffers where available. see the comment on carried_value_buffers_.
+  void PrepareFetches(std::vector<OrtValue>& fetches, int64_t iter_num);
+
   // create the single Loop output from a collection of per-iteration outputs
   Status ConcatenateLoopOutput(std::vector<OrtValue>& per_iteration_output, int output_index);
 
@@ -201,7 +205,7 @@ class LoopImpl {
   int64_t max_trip_count_;
   bool condition_;
 
-  const std::vector<const OrtValue*>& implicit_inputs_;
+  const OpKernelContextInternal::ImplicitInputValues& implicit_inputs_;
 
   OrtValue iter_num_mlvalue_;
   OrtValue condition_mlvalue_;
@@ -210,6 +214,13 @@ class LoopImpl {
   // the order from the subgraph matches the order from the loop output
   std::vector<std::vector<OrtValue>> loop_output_tensors_;
 
+  // double buffered tensors for loop carried values with fully static subgraph output shapes.
+  // the fetch slot for iteration N is seeded from one buffer set while the matching feed
+  // still references the other set, so steady state iterations swap pointers between the
+  // two sets instead of allocating new output tensors every iteration.
+  std::vector<OrtValue> carried_value_buffers_[2];
+  bool have_carried_value_buffers_{false};
+
   const Loop::ConcatOutput& concat_output_func_;
 };
 
@@ -405,9 +416,93 @@ Status LoopImpl::Initialize() {
 
   loop_output_tensors_.resize(info_.num_outputs - info_.num_loop_carried_vars);
 
+  // when the trip count is known up front, reserve the per-iteration output storage in one go so
+  // long-running loops (e.g. 10k iteration beam search decodes) don't reallocate it as they grow.
+  // cap the reservation so a huge trip count that terminates early via 'cond' doesn't over-commit.
+  constexpr int64_t kMaxReservedIterations = 32768;
+  if (max_trip_count_ > 0 && max_trip_count_ != INT64_MAX) {
+    auto reserve_size = static_cast<size_t>(std::min(max_trip_count_, kMaxReservedIterations));
+    for (auto& per_iteration_outputs : loop_output_tensors_) {
+      per_iteration_outputs.reserve(reserve_size);
+    }
+  }
+
+  // preallocate double buffers for loop carried values whose subgraph output shapes are
+  // fully static, so each iteration fetches into one buffer set while feeding from the
+  // other (see PrepareFetches). limited to CPU based values as the fetch location was
+  // setup to mirror the feed location, and to outputs that aren't a direct passthrough
+  // of a subgraph input as the executor returns the feed itself for those.
+  if (max_trip_count_ > 1 && condition_) {
+    auto& subgraph_outputs = info_.subgraph.GetOutputs();
+
+    for (int i = 0; i < info_.num_loop_carried_vars; ++i) {
+      const OrtValue* loop_input = context_.GetInputMLValue(i + 2);  // skip 'M' and 'cond'
+      if (loop_input == nullptr || !loop_input->IsTensor() ||
+          loop_input->Get<Tensor>().Location().device.Type() != OrtDevice::CPU) {
+        continue;
+      }
+
+      const auto* output_def = subgraph_outputs[i + 1];  // skip 'cond'
+      const auto* type_proto = output_def->TypeAsProto();
+      if (type_proto == nullptr || !utils::HasTensorType(*type_proto) ||
+          !utils::HasElemType(type_proto->tensor_type()) ||
+          !utils::HasShape(type_proto->tensor_type())) {
+        continue;
+      }
+
+      const auto& shape_proto = type_proto->tensor_type().shape();
+      bool shape_is_static = true;
+      for (const auto& dim : shape_proto.dim()) {
+        if (!utils::HasDimValue(dim) || dim.dim_value() < 0) {
+          shape_is_static = false;
+          break;
+        }
+      }
+
+      if (!shape_is_static ||
+          std::find(info_.subgraph_input_names.cbegin(), info_.subgraph_input_names.cend(),
+                    output_def->Name()) != info_.subgraph_input_names.cend()) {
+        continue;
+      }
+
+      if (carried_value_buffers_[0].empty()) {
+        carried_value_buffers_[0].resize(info_.num_loop_carried_vars);
+        carried_value_buffers_[1].resize(info_.num_loop_carried_vars);
+      }
+
+      TensorShape shape = utils::GetTensorShapeFromTensorShapeProto(shape_proto);
+      MLDataType element_type =
+          DataTypeImpl::TensorTypeFromONNXEnum(type_proto->tensor_type().elem_type())->GetElementType();
+      auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+
+      for (auto& buffers : carried_value_buffers_) {
+        auto p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, cpu_allocator);
+        buffers[i].Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+      }
+
+      have_carried_value_buffers_ = true;
+    }
+  }
+
   return status;
 }
 
+void LoopImpl::PrepareFetches(std::vector<OrtValue>& fetches, int64_t iter_num) {
+  if (!have_carried_value_buffers_)
+    return;
+
+  fetches.resize(info_.num_subgraph_outputs);
+
+  // 'cond' and the per-iteration scan outputs must be produced fresh each iteration,
+  // so only the loop carried value slots are seeded. +1 to skip 'cond'.
+  auto& buffers = carried_value_buffers_[iter_num & 1];
+  for (int i = 0; i < info_.num_loop_carried_vars; ++i) {
+    if (buffers[i].IsAllocated()) {
+      fetches[i + 1] = buffers[i];
+    }
+  }
+}
+
 void LoopImpl::CreateInitialFeeds(std::vector<OrtValue>& feeds) {
   feeds.reserve(info_.num_subgraph_inputs + info_.num_implicit_inputs);
 
@@ -478,6 +573,8 @@ Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
       fetches.clear();
     }
 
+    PrepareFetches(fetches, iter_num_value);
+
     status = utils::ExecuteSubgraph(session_state_, ffm, feeds, fetches, {},
                                     ExecutionMode::ORT_SEQUENTIAL, context_.GetTerminateFlag(), context_.Logger());
 
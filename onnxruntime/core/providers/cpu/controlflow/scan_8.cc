@@ -129,7 +129,7 @@ class Scan8Impl {
 
   std::vector<std::unique_ptr<OutputIterator>> output_iterators_;
 
-  const std::vector<const OrtValue*>& implicit_inputs_;
+  const OpKernelContextInternal::ImplicitInputValues& implicit_inputs_;
 
   const scan::detail::DeviceHelpers& device_helpers_;
 };
@@ -429,7 +429,7 @@ Status Scan8Impl::Execute(const FeedsFetchesManager& ffm) {
     // Call the subgraph for each item in the sequence
     status = IterateSequence(context_, session_state_, batch_loop_state_variables[b], scan_input_stream_iterators,
                              sequence_len, info_.num_loop_state_variables, info_.num_variadic_inputs, info_.num_outputs,
-                             implicit_inputs_, output_iterators_, ffm);
+                             gsl::make_span(implicit_inputs_.data(), implicit_inputs_.size()), output_iterators_, ffm);
 
     // zero out any remaining values in the sequence
     for (int64_t i = sequence_len; i < max_sequence_len_; ++i) {
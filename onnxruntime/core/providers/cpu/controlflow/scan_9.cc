@@ -153,7 +153,7 @@ class ScanImpl {
   // inputs for graph. either original input value or transposed input if an axis other than 0 was specified
   std::vector<OrtValue> inputs_;
   std::vector<std::unique_ptr<OutputIterator>> output_iterators_;
-  const std::vector<const OrtValue*>& implicit_inputs_;
+  const OpKernelContextInternal::ImplicitInputValues& implicit_inputs_;
 
   const scan::detail::DeviceHelpers& device_helpers_;
 };
@@ -459,7 +459,7 @@ Status ScanImpl::Execute(const FeedsFetchesManager& ffm) {
   // Call the subgraph for each item in the sequence
   status = IterateSequence(context_, session_state_, loop_state_variables, scan_input_stream_iterators,
                            sequence_len_, info_.num_loop_state_variables, info_.num_inputs, info_.num_outputs,
-                           implicit_inputs_, output_iterators_, ffm);
+                           gsl::make_span(implicit_inputs_.data(), implicit_inputs_.size()), output_iterators_, ffm);
 
   ORT_RETURN_IF_ERROR(status);
 
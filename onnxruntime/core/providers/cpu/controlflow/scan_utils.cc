@@ -186,7 +186,7 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
                        std::vector<LoopStateVariable>& loop_state_variables,
                        std::vector<OrtValueTensorSlicer<const OrtValue>::Iterator>& scan_input_stream_iterators,
                        int64_t seq_length, int num_loop_state_variables, int num_variadic_inputs,
-                       int num_variadic_outputs, const std::vector<const OrtValue*>& implicit_inputs,
+                       int num_variadic_outputs, gsl::span<const OrtValue* const> implicit_inputs,
                        std::vector<std::unique_ptr<OutputIterator>>& output_iterators,
                        const FeedsFetchesManager& ffm) {
   Status status = Status::OK();
@@ -433,7 +433,7 @@ OutputIterator::OutputIterator(OpKernelContextInternal& context,
   if (is_v8) {
     // there are one or two dimensions being iterated depending on whether it's a loop state variable or scan input.
     auto num_iteration_dims = is_loop_state_var_ ? 1 : 2;
-    num_iterations_ = final_shape_.Slice(0, num_iteration_dims).Size();
+    num_iterations_ = final_shape_.SizeToDimension(num_iteration_dims);
   } else {
     // batch dimension is not handled in v9 and later so for a loop state var there are no iterations, and for
     // the scan outputs we use dimension 0 which is the sequence length.
@@ -12,9 +12,12 @@ namespace onnxruntime {
 // Information needed to construct CPU execution providers.
 struct CPUExecutionProviderInfo {
   bool create_arena{true};
+  // back the arena with a per-provider mimalloc heap instead of BFCArena.
+  // Ignored in builds without USE_MIMALLOC_ARENA_ALLOCATOR.
+  bool use_mimalloc_arena{false};
 
-  explicit CPUExecutionProviderInfo(bool use_arena)
-      : create_arena(use_arena) {}
+  explicit CPUExecutionProviderInfo(bool use_arena, bool use_mimalloc = false)
+      : create_arena(use_arena), use_mimalloc_arena(use_mimalloc) {}
 
   CPUExecutionProviderInfo() = default;
 };
@@ -41,7 +44,7 @@ class CPUExecutionProvider : public IExecutionProvider {
 #endif
 
     AllocatorCreationInfo device_info{[](int) { return onnxruntime::make_unique<TAllocator>(); },
-                                      0, create_arena};
+                                      0, create_arena, {0, -1, -1, -1}, info.use_mimalloc_arena};
 
     InsertAllocator(CreateAllocator(device_info));
   }
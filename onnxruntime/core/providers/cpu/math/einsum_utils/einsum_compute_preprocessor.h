@@ -76,9 +76,9 @@ struct EinsumEquationPreprocessor {
   }
 
   // Holds the pre-processed equation string
-  // In theory, we could re-write the einsum equation to lower overall cost of intermediate arrays
-  // See numpy.einsum_path for details/examples
-  // These are very advanced optimizations that we don't require for the average use-case
+  // The equation string itself is left untouched, but the order in which the operands are
+  // contracted pair-wise is chosen at compute time to lower the overall cost of intermediate
+  // arrays (see EinsumTypedComputeProcessor::ChooseProcessingOrder and numpy.einsum_path)
   std::string einsum_preprocessed_equation_;
 
   // In explicit form, holds the left side of the einsum equation
@@ -138,6 +138,10 @@ class EinsumComputePreprocessor final {
   // For each subscript index, hold the index it corresponds to in the output's shape
   const std::vector<int64_t>& GetMappedSubscriptIndicesToOutputindices() const;
 
+  // For each input, hold the subscript indices corresponding to each of its dims
+  // (a subscript index may repeat within an input if a diagonal is to be parsed from it)
+  const std::vector<std::vector<int64_t>>& GetInputSubscriptIndices() const;
+
   // Get the number of subscript indices (subscript labels) in the einsum equation
   int64_t GetNumSubscriptIndices() const;
 
@@ -268,6 +268,91 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
   return output;
 }
 
+template <typename T>
+std::vector<int64_t> EinsumTypedComputeProcessor<T>::ChooseProcessingOrder(int64_t num_inputs,
+                                                                           int64_t num_subscript_labels) const {
+  const auto& input_subscript_indices = einsum_compute_preprocessor_.GetInputSubscriptIndices();
+  const auto& subscript_indices_to_output_indices = einsum_compute_preprocessor_.GetMappedSubscriptIndicesToOutputindices();
+  const auto& homogenized_input_dims = einsum_compute_preprocessor_.GetHomogenizedInputDims();
+
+  // For each input, the set of subscript labels it carries
+  // (a label may repeat within an input when a diagonal is to be parsed - count it once)
+  std::vector<std::vector<bool>> has_label(num_inputs, std::vector<bool>(num_subscript_labels, false));
+
+  // For each label, the number of inputs not yet consumed that carry it
+  std::vector<int64_t> occurrences_left(num_subscript_labels, 0);
+
+  // The (broadcast) dim value of each label
+  std::vector<int64_t> label_dims(num_subscript_labels, 1);
+
+  for (int64_t i = 0; i < num_inputs; ++i) {
+    for (auto label : input_subscript_indices[i]) {
+      if (!has_label[i][label]) {
+        has_label[i][label] = true;
+        ++occurrences_left[label];
+      }
+    }
+    for (int64_t label = 0; label < num_subscript_labels; ++label) {
+      label_dims[label] = std::max(label_dims[label], homogenized_input_dims[i][static_cast<size_t>(label)]);
+    }
+  }
+
+  std::vector<int64_t> processing_order;
+  processing_order.reserve(num_inputs);
+
+  std::vector<bool> consumed(num_inputs, false);
+
+  // Labels currently present in the accumulated intermediate result
+  std::vector<bool> in_result(num_subscript_labels, false);
+
+  for (int64_t step = 0; step < num_inputs; ++step) {
+    int64_t best_input = -1;
+    double best_size = 0;
+
+    for (int64_t candidate = 0; candidate < num_inputs; ++candidate) {
+      if (consumed[candidate]) {
+        continue;
+      }
+
+      // Size of the intermediate result if `candidate` were contracted next -
+      // a label survives the contraction only if it is needed by the op's output
+      // or by an input that is yet to be consumed
+      double size = 1.;
+      for (int64_t label = 0; label < num_subscript_labels; ++label) {
+        if (!in_result[label] && !has_label[candidate][label]) {
+          continue;
+        }
+        int64_t remaining = occurrences_left[label] - (has_label[candidate][label] ? 1 : 0);
+        if (subscript_indices_to_output_indices[label] != -1 || remaining > 0) {
+          size *= static_cast<double>(label_dims[label]);
+        }
+      }
+
+      if (best_input == -1 || size < best_size) {
+        best_input = candidate;
+        best_size = size;
+      }
+    }
+
+    consumed[best_input] = true;
+    processing_order.push_back(best_input);
+
+    for (int64_t label = 0; label < num_subscript_labels; ++label) {
+      if (has_label[best_input][label]) {
+        --occurrences_left[label];
+        in_result[label] = true;
+      }
+      // Labels seen by their last input and absent from the output get reduced right away
+      if (in_result[label] && occurrences_left[label] == 0 &&
+          subscript_indices_to_output_indices[label] == -1) {
+        in_result[label] = false;
+      }
+    }
+  }
+
+  return processing_order;
+}
+
 template <typename T>
 void EinsumTypedComputeProcessor<T>::SetDeviceHelpers(const EinsumOp::DeviceHelpers::Transpose& device_transpose_func,
                                                       const EinsumOp::DeviceHelpers::MatMul<T>& device_matmul_func,
@@ -293,6 +378,34 @@ Status EinsumTypedComputeProcessor<T>::Run() {
 
   auto num_inputs = context_->InputCount();
 
+  // With more than 2 inputs, the order in which the operands are contracted pair-wise
+  // can make a big difference to the size of the intermediate results - pick a cheap order.
+  // With 1 or 2 inputs there is nothing to re-order.
+  std::vector<int64_t> processing_order;
+  if (num_inputs > 2) {
+    processing_order = ChooseProcessingOrder(num_inputs, num_subscript_labels);
+  } else {
+    processing_order.reserve(num_inputs);
+    for (int i = 0; i < num_inputs; ++i) {
+      processing_order.push_back(i);
+    }
+  }
+
+  // For each subscript label that does not occur in the output, the position in the
+  // processing order of the last input the label is seen in - the label is to be
+  // reduced once the input holding that position has been processed
+  const auto& input_subscript_indices = einsum_compute_preprocessor_.GetInputSubscriptIndices();
+  std::vector<int64_t> subscript_indices_to_last_position(num_subscript_labels, -1);
+  for (int64_t position = 0; position < num_inputs; ++position) {
+    for (auto label : input_subscript_indices[processing_order[position]]) {
+      if (mapped_indices_to_last_input_index[label] != -1) {
+        subscript_indices_to_last_position[label] = position;
+      }
+    }
+  }
+
+  const auto first_input = processing_order[0];
+
   // Pre-process the first input so as to reduce any dims that only it has
   std::unique_ptr<const Tensor> result;
 
@@ -304,7 +417,7 @@ Status EinsumTypedComputeProcessor<T>::Run() {
     preserved_dims.reserve(num_subscript_labels);  // num_subscript_labels is the upper bound. No harm in over-reserving.
 
     for (int64_t i = 0; i < num_subscript_labels; ++i) {
-      if (mapped_indices_to_last_input_index[i] == 0) {
+      if (subscript_indices_to_last_position[i] == 0) {
         reduced_dims.push_back(i);
       } else {
         preserved_dims.push_back(i);
@@ -313,14 +426,14 @@ Status EinsumTypedComputeProcessor<T>::Run() {
 
     // Reduce the dims that are last seen in the first input alone
     if (reduced_dims.size() != 0) {
-      result = EinsumOp::ReduceSum<T>(preprocessed_inputs[0] ? *preprocessed_inputs[0] : *raw_inputs[0],
-                                      homogenized_input_dims[0].GetDims(), reduced_dims, allocator_, tp_,
+      result = EinsumOp::ReduceSum<T>(preprocessed_inputs[first_input] ? *preprocessed_inputs[first_input] : *raw_inputs[first_input],
+                                      homogenized_input_dims[first_input].GetDims(), reduced_dims, allocator_, tp_,
                                       einsum_ep_assets_, device_reduce_sum_func_);
     } else {
       // Check if there is a pre-processed version of this input
       // If so assign it to result
-      if (preprocessed_inputs[0]) {
-        result = std::move(preprocessed_inputs[0]);
+      if (preprocessed_inputs[first_input]) {
+        result = std::move(preprocessed_inputs[first_input]);
       }
     }
 
@@ -338,21 +451,22 @@ Status EinsumTypedComputeProcessor<T>::Run() {
   {
     bool is_final_pair = false;
     // Keep processing each input pair-wise
-    for (int input = 1; input < num_inputs; ++input) {
+    for (int position = 1; position < num_inputs; ++position) {
+      const auto input = processing_order[position];
       std::vector<int64_t> reduced_dims;
       reduced_dims.reserve(num_subscript_labels);  // num_subscript_labels is the upper bound. No harm in over-reserving by a small margin.
       for (int64_t dim = 0; dim < num_subscript_labels; ++dim) {
-        if (mapped_indices_to_last_input_index[dim] == input) {
+        if (subscript_indices_to_last_position[dim] == position) {
           // This is the last input we are seeing this dimension (and it doesn't occur in the output), so reduce along the dimension
           reduced_dims.push_back(dim);
         }
       }
-      if (input == num_inputs - 1) {
+      if (position == num_inputs - 1) {
         is_final_pair = true;
       }
       // Use either the preprocessed inputs (if it is available) or the corresponding raw inputs
-      result = PairwiseOperandProcess(result ? *result : *raw_inputs[0],
-                                      result ? result->Shape() : homogenized_input_dims[0],
+      result = PairwiseOperandProcess(result ? *result : *raw_inputs[first_input],
+                                      result ? result->Shape() : homogenized_input_dims[first_input],
                                       preprocessed_inputs[input] ? *preprocessed_inputs[input] : *raw_inputs[input],
                                       homogenized_input_dims[input],
                                       reduced_dims, is_final_pair);
@@ -54,6 +54,12 @@ class EinsumTypedComputeProcessor {
   void FinalizeOutput(const Tensor& candidate_output,
                       const std::vector<int64_t>& ordered_subscript_indices_in_candidate);
 
+  // Picks the order in which the operands are to be processed pair-wise.
+  // The inputs have all been homogenized to the same rank and axes ordering, so they
+  // can be consumed in any order. Greedily picks, at every step, the input that keeps
+  // the intermediate result smallest (in the spirit of numpy.einsum_path's 'greedy' mode)
+  std::vector<int64_t> ChooseProcessingOrder(int64_t num_inputs, int64_t num_subscript_labels) const;
+
   // Private members -
   OpKernelContext* context_;
   AllocatorPtr allocator_;
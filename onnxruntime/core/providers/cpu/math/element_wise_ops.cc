@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/framework/data_types_internal.h"
+#include "core/framework/op_kernel_context_internal.h"
 #include "core/providers/cpu/math/element_wise_ops.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include <unsupported/Eigen/SpecialFunctions>
@@ -1517,13 +1518,80 @@ Status Mod::Compute(OpKernelContext* context) const {
 // Type specific logic is plugged in via the functions in ProcessBroadcastSpanFuncs.
 // Optional user_data can be provided, and will be available to the ProcessSpanFunc implementations
 // via BroadcastHelper.GetUserData().
+namespace {
+// Per-node pooled state holding the Broadcaster built on a previous Run together with the input
+// shapes it was built for. Element-wise kernels almost always see the same input shapes from Run
+// to Run, so the shape classification and the iterator entries can be reused instead of being
+// rebuilt on every call.
+struct CachedBroadcastState : public SessionState::PooledKernelState {
+  std::vector<int64_t> input0_dims;
+  std::vector<int64_t> input1_dims;
+  std::unique_ptr<Broadcaster> broadcaster;
+};
+
+// Checks out the pooled broadcast state for the current node and offers the cached Broadcaster
+// when it was built for the same input shapes. Store moves the Broadcaster used by this call back
+// into the pool so the next Run with these shapes skips the setup entirely. Non-contiguous inputs
+// bypass the cache as their iterator entries also depend on the strides.
+class BroadcastStateCache {
+ public:
+  BroadcastStateCache(OpKernelContext& context, const Tensor& input0, const Tensor& input1)
+      : holder_(static_cast<OpKernelContextInternal&>(context).GetSessionState(),
+                static_cast<OpKernelContextInternal&>(context).GetNodeIndex(),
+                []() -> std::unique_ptr<SessionState::PooledKernelState> {
+                  return std::make_unique<CachedBroadcastState>();
+                }),
+        state_(*static_cast<CachedBroadcastState*>(holder_.get())),
+        cacheable_(input0.IsContiguous() && input1.IsContiguous()),
+        input0_shape_(input0.Shape()),
+        input1_shape_(input1.Shape()) {}
+
+  // Broadcaster built by a previous Run for these shapes, or nullptr if one isn't available.
+  Broadcaster* Prepared() {
+    if (cacheable_ && state_.broadcaster != nullptr &&
+        state_.input0_dims == input0_shape_.GetDims() &&
+        state_.input1_dims == input1_shape_.GetDims()) {
+      return state_.broadcaster.get();
+    }
+
+    return nullptr;
+  }
+
+  void Store(InputBroadcaster& input_broadcaster) {
+    if (!cacheable_)
+      return;
+
+    if (state_.broadcaster == nullptr) {
+      state_.broadcaster = std::make_unique<Broadcaster>(input_broadcaster.TakeBroadcaster());
+    } else {
+      *state_.broadcaster = input_broadcaster.TakeBroadcaster();
+    }
+
+    state_.input0_dims = input0_shape_.GetDims();
+    state_.input1_dims = input1_shape_.GetDims();
+  }
+
+ private:
+  SessionState::PooledKernelStateHolder holder_;
+  CachedBroadcastState& state_;
+  const bool cacheable_;
+  const TensorShape& input0_shape_;
+  const TensorShape& input1_shape_;
+};
+}  // namespace
+
 void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data) {
-  InputBroadcaster input_broadcaster(*context.Input<Tensor>(0), *context.Input<Tensor>(1));
+  const Tensor& input0_tensor = *context.Input<Tensor>(0);
+  const Tensor& input1_tensor = *context.Input<Tensor>(1);
+
+  BroadcastStateCache state_cache(context, input0_tensor, input1_tensor);
+  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor, state_cache.Prepared());
   OutputBroadcaster output_broadcaster(input_broadcaster.GetSpanSize(),
                                        *context.Output(0, input_broadcaster.GetOutputShape()));
   BroadcastHelper broadcast_helper(input_broadcaster, output_broadcaster, user_data);
 
   BroadcastLooper(broadcast_helper, funcs);
+  state_cache.Store(input_broadcaster);
 }
 
 // Variant of UntypedBroadcastTwo that will parallelize.
@@ -1533,7 +1601,9 @@ void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFun
                          void* user_data) {
   const Tensor& input0_tensor = *context.Input<Tensor>(0);
   const Tensor& input1_tensor = *context.Input<Tensor>(1);
-  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor);
+
+  BroadcastStateCache state_cache(context, input0_tensor, input1_tensor);
+  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor, state_cache.Prepared());
 
   Tensor& output_tensor = *context.Output(0, input_broadcaster.GetOutputShape());
 
@@ -1576,6 +1646,8 @@ void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFun
           BroadcastLooper(segment_helper, funcs);
         });
   }
+
+  state_cache.Store(input_broadcaster);
 }
 
 // allocate_tensor should allocate a tensor of the output type with the given shape
@@ -470,6 +470,13 @@ struct BroadcastIterator {
     return index;
   }
 
+  // Rewind to the start of iteration so the entries can be walked again. Used when a Broadcaster
+  // built by a previous calculation over the same shapes is reused.
+  void Reset() {
+    counters_.assign(counters_.size(), 0);
+    index_ = 0;
+  }
+
   void Reserve(int64_t max_dims) {
     deltas_.reserve(static_cast<size_t>(max_dims));
     counts_.reserve(static_cast<size_t>(max_dims));
@@ -621,17 +628,148 @@ struct Broadcaster {
     iterator2_.counters_.resize(iterator2_.counts_.size(), 0);
   }
 
+  // Variant taking explicit per-dimension strides (in elements) so non-contiguous inputs can be
+  // iterated in place. An empty stride vector means the dense row-major strides of the shape
+  // (used for Expand where input1 is only a shape). The innermost axis of a non-broadcast input
+  // must have stride 1 as spans hand out contiguous ranges of elements.
+  Broadcaster(const std::vector<int64_t>& shape1, const std::vector<int64_t>& strides1,
+              const std::vector<int64_t>& shape2, const std::vector<int64_t>& strides2) {
+    size_t dimension_count_max = std::max(shape1.size(), shape2.size());
+    output_shape_.resize(dimension_count_max);
+    iterator1_.Reserve(dimension_count_max);
+    iterator2_.Reserve(dimension_count_max);
+
+    // compute the output shape with the same validation as the contiguous constructor
+    for (size_t i = 0; i < dimension_count_max; i++) {
+      auto axis1 = i < shape1.size() ? shape1[shape1.size() - 1 - i] : 1;
+      auto axis2 = i < shape2.size() ? shape2[shape2.size() - 1 - i] : 1;
+
+      auto largest = std::max(axis1, axis2);
+      auto smallest = std::min(axis1, axis2);
+      auto dim_to_use = largest;
+
+      if (smallest == 0) {
+        ORT_ENFORCE(largest <= 1, "Can broadcast 0 by 0 or 1. ", largest, " is invalid.");
+        dim_to_use = smallest;
+      } else {
+        ORT_ENFORCE(smallest == 1 || smallest == largest,
+                    "Attempting to broadcast an axis by a dimension other than 1. ", smallest, " by ", largest);
+      }
+
+      output_shape_[dimension_count_max - 1 - i] = dim_to_use;
+    }
+
+    BuildStridedIterator(iterator1_, shape1, strides1, output_shape_);
+    BuildStridedIterator(iterator2_, shape2, strides2, output_shape_);
+  }
+
   size_t GetSpanSize() const { return std::min(iterator1_.counts_.front(), iterator2_.counts_.front()); }
 
+  // Rewind both iterators so this instance can drive another calculation over the same shapes.
+  void ResetIterators() {
+    iterator1_.Reset();
+    iterator2_.Reset();
+  }
+
   BroadcastIterator iterator1_, iterator2_;
   std::vector<int64_t> output_shape_;
+
+ private:
+  // Builds the iterator entries for one input directly from its physical strides. Axes are
+  // processed innermost first; 'cycle' tracks the net index advance over a full pass of the
+  // entries built so far, so each new entry's delta is the axis stride corrected by the
+  // advance the inner entries have already applied.
+  static void BuildStridedIterator(BroadcastIterator& iterator, const std::vector<int64_t>& dims,
+                                   const std::vector<int64_t>& strides, const std::vector<int64_t>& output_dims) {
+    ORT_ENFORCE(strides.empty() || strides.size() == dims.size(),
+                "Number of strides (", strides.size(), ") does not match number of dimensions (", dims.size(), ").");
+
+    const size_t rank = output_dims.size();
+    if (rank == 0) {  // both inputs are scalars
+      iterator.deltas_.push_back(0);
+      iterator.counts_.push_back(1);
+      iterator.counters_.resize(1, 0);
+      return;
+    }
+
+    // i counts from the innermost axis. Missing leading axes broadcast, so dim 1 / stride 0.
+    auto input_dim = [&dims](size_t i) {
+      return i < dims.size() ? dims[dims.size() - 1 - i] : 1;
+    };
+    auto input_stride = [&dims, &strides](size_t i) -> int64_t {
+      if (i >= dims.size())
+        return 0;
+      if (strides.empty()) {  // dense row-major
+        int64_t stride = 1;
+        for (size_t j = 0; j < i; j++)
+          stride *= dims[dims.size() - 1 - j];
+        return stride;
+      }
+      return strides[strides.size() - 1 - i];
+    };
+
+    ptrdiff_t cycle;   // net index advance over one full pass of the entries built so far
+    bool broadcasting;  // true while the last entry wraps back to where it started
+
+    if (input_dim(0) > 1) {
+      ORT_ENFORCE(input_stride(0) == 1,
+                  "Cannot broadcast a strided tensor whose innermost non-broadcast axis is not contiguous. Stride was ",
+                  input_stride(0));
+      iterator.deltas_.push_back(1);
+      broadcasting = false;
+    } else {
+      iterator.deltas_.push_back(0);
+      broadcasting = true;
+    }
+    iterator.counts_.push_back(output_dims[rank - 1]);
+    cycle = gsl::narrow_cast<ptrdiff_t>(iterator.deltas_.back() * output_dims[rank - 1]);
+
+    for (size_t i = 1; i < rank; i++) {
+      const int64_t output_dim = output_dims[rank - 1 - i];
+      if (output_dim == 1)  // nothing to do in this case
+        continue;
+
+      const int64_t dim = input_dim(i);
+      if (dim > 1) {
+        ORT_ENFORCE(dim == output_dim, "Attempting to broadcast an axis by a dimension other than 1. ",
+                    dim, " by ", output_dim);
+        const ptrdiff_t stride = gsl::narrow_cast<ptrdiff_t>(input_stride(i));
+        if (!broadcasting && iterator.deltas_.size() == 1 && stride == cycle) {
+          // the axis is packed directly on top of the innermost group, so its elements can be
+          // walked with the same per-element delta
+          iterator.counts_.back() *= output_dim;
+        } else {
+          iterator.deltas_.push_back(stride - cycle);
+          iterator.counts_.push_back(output_dim);
+          broadcasting = false;
+        }
+        cycle = gsl::narrow_cast<ptrdiff_t>(stride * output_dim);
+      } else {  // this input broadcasts along the axis
+        if (broadcasting) {
+          iterator.counts_.back() *= output_dim;
+        } else {
+          iterator.deltas_.push_back(-cycle);
+          iterator.counts_.push_back(output_dim);
+          broadcasting = true;
+        }
+        cycle = 0;
+      }
+    }
+
+    iterator.counters_.resize(iterator.counts_.size(), 0);
+  }
 };
 
 struct InputBroadcaster {
-  InputBroadcaster(const Tensor& input0, const Tensor& input1)
+  // 'prepared' optionally donates a Broadcaster built by a previous calculation for the same
+  // contiguous input shapes. Its storage is moved into this instance and rewound, skipping the
+  // per-call iterator setup. See BroadcastStateCache in element_wise_ops.cc.
+  InputBroadcaster(const Tensor& input0, const Tensor& input1, Broadcaster* prepared = nullptr)
       : input_tensor0_(input0),
         input_tensor1_(&input1),
-        input_tensor1_shape_(input1.Shape()) {
+        input_tensor1_shape_(input1.Shape()),
+        broadcaster_(prepared != nullptr ? TakePrepared(*prepared)
+                                         : CreateBroadcaster(input0, &input1, input1.Shape())) {
   }
 
   InputBroadcaster(const Tensor& input0, const TensorShape& input1_shape)
@@ -695,7 +833,30 @@ struct InputBroadcaster {
     AdvanceBy(span_size_);
   }
 
+  // Relinquish the Broadcaster so its storage can be donated to a later calculation over the same
+  // shapes. The instance must not be used afterwards.
+  Broadcaster&& TakeBroadcaster() { return std::move(broadcaster_); }
+
  private:
+  // use the stride based Broadcaster setup if either input is a non-contiguous view,
+  // so that strided inputs are iterated in place instead of requiring a packing copy
+  static Broadcaster CreateBroadcaster(const Tensor& input0, const Tensor* input1,
+                                       const TensorShape& input1_shape) {
+    if (!input0.IsContiguous() || (input1 != nullptr && !input1->IsContiguous())) {
+      return Broadcaster(input0.Shape().GetDims(), input0.Strides(),
+                         input1_shape.GetDims(),
+                         input1 != nullptr ? input1->Strides() : std::vector<int64_t>{});
+    }
+
+    return Broadcaster(input0.Shape().GetDims(), input1_shape.GetDims());
+  }
+
+  // rewinds and moves out a Broadcaster donated by a previous calculation
+  static Broadcaster TakePrepared(Broadcaster& prepared) {
+    prepared.ResetIterators();
+    return std::move(prepared);
+  }
+
   const Tensor& input_tensor0_;
   // need to support use case where input1 is just the shape for Expand op
   const Tensor* input_tensor1_{nullptr};
@@ -705,7 +866,7 @@ struct InputBroadcaster {
   const void* input0_bytes_{input_tensor0_.DataRaw()};
   const void* input1_bytes_{input_tensor1_ ? input_tensor1_->DataRaw() : nullptr};
 
-  Broadcaster broadcaster_{input_tensor0_.Shape().GetDims(), input_tensor1_shape_.GetDims()};
+  Broadcaster broadcaster_{CreateBroadcaster(input_tensor0_, input_tensor1_, input_tensor1_shape_)};
   size_t span_size_{broadcaster_.GetSpanSize()};
 };
 
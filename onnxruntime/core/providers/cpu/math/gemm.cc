@@ -44,6 +44,17 @@ bool GemmPackBFp32(const OpKernelInfo& info,
                    bool trans_b,
                    BufferUniquePtr& packed_b,
                    TensorShape& b_shape) {
+  size_t packed_b_size;
+  return GemmPackBFp32(info.GetAllocator(0, OrtMemTypeDefault), tensor_b, trans_b,
+                       packed_b, packed_b_size, b_shape);
+}
+
+bool GemmPackBFp32(AllocatorPtr alloc,
+                   const Tensor& tensor_b,
+                   bool trans_b,
+                   BufferUniquePtr& packed_b,
+                   size_t& packed_b_size,
+                   TensorShape& b_shape) {
   // Only handle the common case of a 2D weight matrix. Additional matrices
   // could be handled by stacking the packed buffers.
   if (tensor_b.Shape().NumDimensions() != 2) {
@@ -54,12 +65,11 @@ bool GemmPackBFp32(const OpKernelInfo& info,
   const size_t K = trans_b ? static_cast<size_t>(b_shape[1]) : static_cast<size_t>(b_shape[0]);
   const size_t N = trans_b ? static_cast<size_t>(b_shape[0]) : static_cast<size_t>(b_shape[1]);
 
-  const size_t packed_b_size = MlasGemmPackBSize(N, K);
+  packed_b_size = MlasGemmPackBSize(N, K);
   if (packed_b_size == 0) {
     return false;
   }
 
-  auto alloc = info.GetAllocator(0, OrtMemTypeDefault);
   auto* packed_b_data = alloc->Alloc(packed_b_size);
   packed_b = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
   MlasGemmPackB(trans_b ? CblasTrans : CblasNoTrans,
@@ -232,6 +242,61 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
   const float* c_data = C != nullptr ? C->Data<float>() : nullptr;
   const TensorShape* c_shape = C != nullptr ? &C->Shape() : nullptr;
 
+  // Fuse the bias add and any mapped activation into the MLAS output stage, so
+  // each output block is processed while it is still cache resident rather than
+  // in separate full-tensor passes after the multiply.
+  const bool fuse_bias = c_data != nullptr && beta_ == 1.0f && c_shape->Size() == N &&
+                         (c_shape->NumDimensions() == 1 || (*c_shape)[0] == 1);
+  const bool fuse_activation = mlas_activation_.ActivationKind != MlasIdentityActivation;
+
+  if (fuse_bias || fuse_activation) {
+    if (!fuse_bias) {
+      GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
+    }
+
+    const float beta = (c_data != nullptr && !fuse_bias) ? beta_ : 0.0f;
+    MLAS_SGEMM_ACTIVATION_PROCESSOR processor(mlas_activation_, fuse_bias ? c_data : nullptr);
+
+    if (B) {
+      MlasGemm(
+          trans_A_,
+          trans_B_,
+          static_cast<size_t>(M),
+          static_cast<size_t>(N),
+          static_cast<size_t>(K),
+          alpha_,
+          A->Data<float>(),
+          static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K),
+          B->Data<float>(),
+          static_cast<size_t>(trans_B_ != CblasNoTrans ? K : N),
+          beta,
+          y_data,
+          static_cast<size_t>(N),
+          thread_pool,
+          &processor);
+    } else {
+      MlasGemm(
+          trans_A_,
+          static_cast<size_t>(M),
+          static_cast<size_t>(N),
+          static_cast<size_t>(K),
+          alpha_,
+          A->Data<float>(),
+          static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K),
+          packed_b_.get(),
+          beta,
+          y_data,
+          static_cast<size_t>(N),
+          thread_pool,
+          &processor);
+    }
+
+    // an activation that could not be mapped onto MLAS still runs element-wise
+    ComputeActivation(y_data, M * N, thread_pool);
+
+    return Status::OK();
+  }
+
   if (B) {
     ComputeGemm(trans_A_, trans_B_, M, N, K, alpha_, A->Data<float>(), B->Data<float>(), beta_,
                 c_data, c_shape, y_data, thread_pool);
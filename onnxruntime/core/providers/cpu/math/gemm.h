@@ -6,6 +6,7 @@
 #include "core/framework/op_kernel.h"
 #include "core/common/common.h"
 #include "core/util/math.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/providers/cpu/activation/activations.h"
 
 namespace onnxruntime {
@@ -14,6 +15,8 @@ template <typename T>
 class Gemm : public OpKernel {
  public:
   Gemm(const OpKernelInfo& info) : OpKernel(info) {
+    mlas_activation_.ActivationKind = MlasIdentityActivation;
+
     int64_t temp;
     ORT_ENFORCE(info.GetAttr<int64_t>("transA", &temp).IsOK());
     trans_A_ = temp == 0 ? CblasNoTrans : CblasTrans;
@@ -51,6 +54,12 @@ class Gemm : public OpKernel {
   // For fused gemm + activation
   std::unique_ptr<functors::ElementWiseRangedTransform<T>> activation_;
 
+  // Activation applied inside the MLAS GEMM output stage while each output
+  // block is still cache resident. Stays MlasIdentityActivation unless
+  // FusedGemm mapped its activation attribute; unmapped activations run
+  // through the element-wise functor above instead.
+  MLAS_ACTIVATION mlas_activation_;
+
   void ComputeActivation(T* y_data, size_t y_size, concurrency::ThreadPool* thread_pool) const;
 };
 
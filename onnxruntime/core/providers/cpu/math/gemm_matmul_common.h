@@ -13,4 +13,13 @@ bool GemmPackBFp32(const OpKernelInfo& info,
                    BufferUniquePtr& packed_b,
                    TensorShape& b_shape);
 
+// Variant taking an explicit allocator and reporting the packed buffer size, for callers
+// that pack into memory with a longer lifetime than the kernel (shared pre-packed weights).
+bool GemmPackBFp32(AllocatorPtr alloc,
+                   const Tensor& tensor_b,
+                   bool trans_b,
+                   BufferUniquePtr& packed_b,
+                   size_t& packed_b_size,
+                   TensorShape& b_shape);
+
 };  // namespace onnxruntime
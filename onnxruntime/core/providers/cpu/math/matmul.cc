@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/math/matmul.h"
+#include "core/framework/prepacked_weights_container.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 #include "core/util/math.h"
@@ -136,6 +137,40 @@ Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_pack
   }
   return Status::OK();
 }
+
+Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                              bool& is_packed, PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  // only pack Matrix B
+  if (input_idx == 1) {
+    size_t packed_b_size;
+    is_packed = GemmPackBFp32(alloc, tensor, trans_b_attr_, packed_b_, packed_b_size, b_shape_);
+    // the cache key is derived from the weight contents only, so a copy packed with transB set
+    // must not be shared with (or by) a kernel packing the same weight without it
+    if (is_packed && prepacked_weights != nullptr && trans_b_attr_ == 0) {
+      prepacked_weights->buffers_.push_back(std::move(packed_b_));
+      prepacked_weights->buffer_sizes_.push_back(packed_b_size);
+      // keep a non-owning reference - the shared copy is owned by the container going forward
+      packed_b_ = BufferUniquePtr(prepacked_weights->buffers_.back().get(), BufferDeleter(nullptr));
+    }
+  }
+  return Status::OK();
+}
+
+Status MatMul<float>::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                                int input_idx, const Tensor& tensor,
+                                                bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  // only Matrix B is packed, and only copies packed without transB are shared
+  if (input_idx == 1 && trans_b_attr_ == 0) {
+    packed_b_ = std::move(prepacked_buffers[0]);
+    b_shape_ = tensor.Shape();
+    used_shared_buffers = true;
+  }
+  return Status::OK();
+}
 #endif
 
 Status MatMul<float>::Compute(OpKernelContext* ctx) const {
@@ -26,6 +26,13 @@ class MatMul<float> final : public OpKernel {
 
 #if !defined(USE_MKLML_FOR_BLAS)
   Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 bool& is_packed, PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx, const Tensor& tensor,
+                                   bool& used_shared_buffers) override;
 #endif
 
   Status Compute(OpKernelContext* context) const override;
@@ -41,33 +41,62 @@ Status QLinearMatMul::Compute(OpKernelContext* ctx) const {
   if (y->Shape().Size() == 0)
     return Status::OK();
 
+  const int64_t N = helper.N();
+
   // validate offsets
   const auto* a_offset = ctx->Input<Tensor>(2);
   const auto* b_offset = ctx->Input<Tensor>(5);
   const auto* y_offset = ctx->Input<Tensor>(7);
   ORT_ENFORCE(IsScalarOr1ElementVector(a_offset),
               "QLinearMatmul : input zero point must be a scalar or 1D tensor of size 1");
-  ORT_ENFORCE(IsScalarOr1ElementVector(b_offset),
-              "QLinearMatmul : weight zero point must be a scalar or 1D tensor of size 1");
   ORT_ENFORCE(IsScalarOr1ElementVector(y_offset),
               "QLinearMatmul : result zero point must be a scalar or 1D tensor of size 1");
 
+  // The weight zero point may be quantized per-column, but the GEMM only
+  // supports a single zero point, so require all values to be identical.
+  uint8_t b_offset_value;
+  const auto& b_offset_shape = b_offset->Shape();
+  if (b_offset_shape.NumDimensions() == 0 ||
+      (b_offset_shape.NumDimensions() == 1 && (b_offset_shape[0] == 1 || b_offset_shape[0] == N))) {
+    const int64_t b_offset_size = b_offset_shape.Size();
+    const auto* b_offset_data = static_cast<const uint8_t*>(b_offset->DataRaw());
+    b_offset_value = b_offset_data[0];
+    for (int64_t i = 1; i < b_offset_size; i++) {
+      if (b_offset_data[i] != b_offset_value) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "QLinearMatmul : weight zero point must be constant");
+      }
+    }
+  } else {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "QLinearMatmul : weight zero point shape invalid");
+  }
+
   // validate scale
   const auto* a_scale = ctx->Input<Tensor>(1);
   const auto* b_scale = ctx->Input<Tensor>(4);
   const auto* y_scale = ctx->Input<Tensor>(6);
   ORT_ENFORCE(IsScalarOr1ElementVector(a_scale),
               "QLinearMatmul : input scale must be a scalar or 1D tensor of size 1");
-  ORT_ENFORCE(IsScalarOr1ElementVector(b_scale),
-              "QLinearMatmul : weight scale must be a scalar or 1D tensor of size 1");
   ORT_ENFORCE(IsScalarOr1ElementVector(y_scale),
               "QLinearMatmul : result scale must be a scalar or 1D tensor of size 1");
 
   auto a_scale_data = *(a_scale->template Data<float>());
-  auto b_scale_data = *(b_scale->template Data<float>());
   auto y_scale_data = *(y_scale->template Data<float>());
 
-  const float real_multiplier = (a_scale_data * b_scale_data) / y_scale_data;
+  // The weight scale may be quantized per-column, which is handled by the
+  // per-column requantization epilogue below.
+  std::vector<float> output_scales;
+  const auto& b_scale_shape = b_scale->Shape();
+  if (b_scale_shape.NumDimensions() == 0 ||
+      (b_scale_shape.NumDimensions() == 1 && (b_scale_shape[0] == 1 || b_scale_shape[0] == N))) {
+    const int64_t b_scale_size = b_scale_shape.Size();
+    const auto* b_scale_data = b_scale->template Data<float>();
+    output_scales.resize(static_cast<size_t>(b_scale_size));
+    for (int64_t i = 0; i < b_scale_size; i++) {
+      output_scales[i] = (a_scale_data * b_scale_data[i] / y_scale_data);
+    }
+  } else {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "QLinearMatmul : weight scale shape invalid");
+  }
 
   AllocatorPtr alloc;
   ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&alloc));
@@ -85,7 +114,7 @@ Status QLinearMatMul::Compute(OpKernelContext* ctx) const {
           *a_offset->template Data<uint8_t>(),
           static_cast<const uint8_t*>(b->DataRaw()) + helper.RightOffsets()[i],
           static_cast<int>(helper.N()),
-          *static_cast<const uint8_t*>(b_offset->DataRaw()),
+          b_offset_value,
           b->IsDataType<int8_t>(),
           gemm_output,
           static_cast<int>(helper.N()),
@@ -96,8 +125,8 @@ Status QLinearMatMul::Compute(OpKernelContext* ctx) const {
                          nullptr,
                          static_cast<size_t>(helper.M()),
                          static_cast<size_t>(helper.N()),
-                         &real_multiplier,
-                         false,
+                         output_scales.data(),
+                         output_scales.size() > 1,
                          *y_offset->template Data<uint8_t>());
   }
 
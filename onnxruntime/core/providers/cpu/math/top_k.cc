@@ -173,6 +173,53 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
   int64_t threads_needed = static_cast<int64_t>(std::floor(input_shape.Size() * k / (128 * 1024)));
   num_threads = std::max(std::min(threads_needed, num_threads), static_cast<int64_t>(1));
 
+  // Splitting on rows can't help a huge reduction axis over few rows (e.g. retrieval models
+  // selecting k of millions of scores in one row). For that shape, partition the axis into
+  // chunks, select each chunk's local top k in parallel, then select the final top k from the
+  // num_chunks * k candidates - the global top k is always a subset of the chunk-local ones.
+  // Restricted to the contiguous case (block_slice == 1) where a chunk is a plain subrange.
+  if (k > 1 && block_slice == 1 && rows < tp_threads) {
+    const int64_t num_chunks = std::min(tp_threads, num_blocks / std::max(static_cast<int64_t>(4) * k,
+                                                                          static_cast<int64_t>(4096)));
+    if (num_chunks > 1) {
+      Comparator comparer(input_data);
+      std::vector<int64_t> candidates(num_chunks * k);
+
+      for (int64_t i = 0; i < rows; ++i) {
+        const int64_t row_offset = i * cols;
+
+        concurrency::ThreadPool::TrySimpleParallelFor(
+            threadpool, num_chunks,
+            [num_chunks, num_blocks, row_offset, k, &comparer, &candidates](std::ptrdiff_t chunk) {
+              auto work = concurrency::ThreadPool::PartitionWork(chunk, num_chunks, num_blocks);
+
+              // indices of this chunk's elements; nth_element moves its top k to the front
+              std::vector<int64_t> data_holder(work.end - work.start);
+              for (int64_t l = work.start; l < work.end; ++l) {
+                data_holder[l - work.start] = row_offset + l;
+              }
+
+              nth_element(data_holder.begin(), data_holder.begin() + (k - 1), data_holder.end(), comparer);
+              std::copy_n(data_holder.cbegin(), k, candidates.begin() + chunk * k);
+            });
+
+        // final selection over the chunk-local winners
+        nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), comparer);
+        if (sorted) {
+          std::sort(candidates.begin(), candidates.begin() + k, comparer);
+        }
+
+        for (int64_t l = 0; l < k; ++l) {
+          const int64_t idx = candidates[l];
+          values_map(i, l) = input_data[idx];
+          indices_map(i, l) = idx - row_offset;
+        }
+      }
+
+      return;
+    }
+  }
+
   // from testing various batch sizes relative to k, the following appears to work well as a selector.
   // tested with following combinations
   //   batch_size = [ 8, 16, 32, 64, 128, 256, 512, 1024, 2048 ]
@@ -87,9 +87,13 @@ common::Status ComputeByType(OpKernelContext* context,
 
   Tensor* Y = context->Output(0, x_shape);
   T* y_data = Y->template MutableData<T>();
+
+  // whether the replaced value is NaN doesn't change per element
+  const bool replaced_value_is_nan = std::isnan(static_cast<float>(replaced_value));
+
   if (imputed_values.size() == static_cast<size_t>(stride)) {
     for (size_t i = 0; i < x_size; i++) {
-      if (std::isnan(static_cast<float>(x_data[i])) && std::isnan(static_cast<float>(replaced_value))) {
+      if (replaced_value_is_nan && std::isnan(static_cast<float>(x_data[i]))) {
         y_data[i] = imputed_values[i % stride];
       } else if (x_data[i] == replaced_value) {
         y_data[i] = imputed_values[i % stride];
@@ -99,7 +103,7 @@ common::Status ComputeByType(OpKernelContext* context,
     }
   } else {
     for (size_t i = 0; i < x_size; i++) {
-      if (std::isnan(static_cast<float>(x_data[i])) && std::isnan(static_cast<float>(replaced_value))) {
+      if (replaced_value_is_nan && std::isnan(static_cast<float>(x_data[i]))) {
         y_data[i] = imputed_values[0];
       } else if (x_data[i] == replaced_value) {
         y_data[i] = imputed_values[0];
@@ -20,24 +20,18 @@ class LabelEncoder final : public OpKernel {
     ORT_ENFORCE(info.GetAttr<std::string>("default_string", &default_string_).IsOK());
     ORT_ENFORCE(info.GetAttr<int64_t>("default_int64", &default_int_).IsOK());
 
-    auto num_entries = string_classes.size();
-
-    string_to_int_map_.reserve(num_entries);
-    int_to_string_map_.reserve(num_entries);
-
-    for (size_t i = 0; i < num_entries; ++i) {
-      const std::string& str = string_classes[i];
-
-      string_to_int_map_[str] = i;
-      int_to_string_map_[i] = str;
-    }
+    // the position of a class is both its encoded integer and its decode
+    // index, so string to int is a hashed vocabulary lookup and int to
+    // string is a direct index into the attribute vector
+    string_to_int_ = StringVocabulary(string_classes);
+    int_to_string_ = std::move(string_classes);
   }
 
   Status Compute(OpKernelContext* context) const override;
 
  private:
-  std::unordered_map<std::string, int64_t> string_to_int_map_;
-  std::unordered_map<int64_t, std::string> int_to_string_map_;
+  StringVocabulary string_to_int_;
+  std::vector<std::string> int_to_string_;
 
   std::string default_string_;
   int64_t default_int_;
@@ -78,13 +72,18 @@ class LabelEncoder_2 final : public OpKernel {
     auto input = X.template DataAsSpan<TKey>();
     auto output = Y.template MutableDataAsSpan<TValue>();
 
-    for (int64_t i = 0; i < shape.Size(); ++i) {
-      const auto found = _map.find(input[i]);
-      if (found == _map.end())
-        output[i] = _default_value;
-      else
-        output[i] = found->second;
-    }
+    // each element maps independently through the read-only table, so the
+    // batch is distributed across the thread pool
+    concurrency::ThreadPool::TryBatchParallelFor(
+        context->GetOperatorThreadPool(), static_cast<int32_t>(shape.Size()),
+        [this, &input, &output](ptrdiff_t i) {
+          const auto found = _map.find(input[i]);
+          if (found == _map.end())
+            output[i] = _default_value;
+          else
+            output[i] = found->second;
+        },
+        0);
 
     return Status::OK();
   }
@@ -4,6 +4,7 @@
 #pragma once
 #include "core/common/common.h"
 #include "core/common/safeint.h"
+#include "core/framework/murmurhash3.h"
 #include "core/framework/op_kernel.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
@@ -529,5 +530,58 @@ void batched_update_scores_inplace(gsl::span<T> scores, int64_t num_batches_in,
     }
   }
 }
+
+// Flat open addressing table mapping a category string to its position in the
+// vocabulary, built once at kernel construction. Lookups hash with MurmurHash3
+// into a power of two probe table, so the steady state cost is one hash and
+// typically a single string comparison instead of the bucket indirection of
+// std::unordered_map. Duplicate keys keep the last position, matching the
+// operator[] insertion the kernels used before.
+class StringVocabulary {
+ public:
+  StringVocabulary() = default;
+
+  explicit StringVocabulary(const std::vector<std::string>& keys) : keys_(keys) {
+    size_t capacity = 4;
+    while (capacity < keys_.size() * 2) {
+      capacity <<= 1;
+    }
+    mask_ = capacity - 1;
+    slots_.assign(capacity, -1);
+
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      size_t slot = Hash(keys_[i]) & mask_;
+      while (slots_[slot] != -1 && keys_[slots_[slot]] != keys_[i]) {
+        slot = (slot + 1) & mask_;
+      }
+      slots_[slot] = static_cast<int64_t>(i);
+    }
+  }
+
+  size_t Size() const { return keys_.size(); }
+
+  // returns the position of 'key' in the vocabulary, or -1 when absent
+  int64_t Find(const std::string& key) const {
+    size_t slot = Hash(key) & mask_;
+    for (int64_t idx = slots_[slot]; idx != -1; idx = slots_[slot = (slot + 1) & mask_]) {
+      if (keys_[idx] == key) {
+        return idx;
+      }
+    }
+    return -1;
+  }
+
+ private:
+  static uint32_t Hash(const std::string& key) {
+    uint32_t hash;
+    MurmurHash3::x86_32(key.data(), static_cast<int>(key.size()), 0, &hash);
+    return hash;
+  }
+
+  std::vector<std::string> keys_;
+  std::vector<int64_t> slots_;
+  size_t mask_{0};
+};
+
 }  // namespace ml
 }  // namespace onnxruntime
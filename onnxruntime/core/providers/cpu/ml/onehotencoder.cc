@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/ml/onehotencoder.h"
+#include <algorithm>
 /**
 https://github.com/onnx/onnx/blob/master/onnx/defs/traditionalml/defs.cc
 ONNX_OPERATOR_SCHEMA(OneHotEncoder)
@@ -56,14 +57,26 @@ OneHotEncoderOp<T>::OneHotEncoderOp(const OpKernelInfo& info) : OpKernel(info),
               "One and only one of the 'cats_*' attributes must be defined");
   if (!tmp_cats_int64s.empty()) {
     num_categories_ = tmp_cats_int64s.size();
-    for (size_t idx = 0, end = tmp_cats_int64s.size(); idx < end; ++idx) {
-      cats_int64s_[tmp_cats_int64s[idx]] = idx;
+
+    // build the direct index table when the category range is compact
+    // (see the declaration of dense_categories_)
+    auto minmax = std::minmax_element(tmp_cats_int64s.cbegin(), tmp_cats_int64s.cend());
+    const uint64_t range = static_cast<uint64_t>(*minmax.second) - static_cast<uint64_t>(*minmax.first);
+    const uint64_t dense_limit = std::max<uint64_t>(1024, tmp_cats_int64s.size() * 4);
+    if (range < dense_limit) {
+      dense_min_ = *minmax.first;
+      dense_categories_.assign(range + 1, -1);
+      for (size_t idx = 0, end = tmp_cats_int64s.size(); idx < end; ++idx) {
+        dense_categories_[tmp_cats_int64s[idx] - dense_min_] = static_cast<int64_t>(idx);
+      }
+    } else {
+      for (size_t idx = 0, end = tmp_cats_int64s.size(); idx < end; ++idx) {
+        cats_int64s_[tmp_cats_int64s[idx]] = idx;
+      }
     }
   } else {
     num_categories_ = tmp_cats_strings.size();
-    for (size_t idx = 0, end = tmp_cats_strings.size(); idx < end; ++idx) {
-      cats_strings_[tmp_cats_strings[idx]] = idx;
-    }
+    cats_strings_ = StringVocabulary(tmp_cats_strings);
   }
   ORT_ENFORCE(num_categories_ > 0);
 }
@@ -82,13 +95,37 @@ common::Status OneHotEncoderOp<T>::Compute(OpKernelContext* context) const {
 
   const auto* x_data = X->template Data<T>();
   const auto x_size = input_shape.Size();
-  std::unordered_map<int64_t, size_t>::const_iterator idx;
-  for (int64_t i = 0; i < x_size; ++i) {
-    auto int_idx = cats_int64s_.find(static_cast<int64_t>(x_data[i]));
-    if (int_idx != cats_int64s_.cend())
-      y_data[i * num_categories_ + int_idx->second] = 1.0f;
-    else if (!zeros_)
-      return Status(ONNXRUNTIME, FAIL, "Unknown Category and zeros = 0.");
+
+  // each element writes its own row of the one hot output, so the batch is
+  // distributed across the thread pool. unknown categories are recorded per
+  // element and reported after the loop when 'zeros' is disabled.
+  std::vector<unsigned char> found(x_size, 1);
+  concurrency::ThreadPool::TryBatchParallelFor(
+      context->GetOperatorThreadPool(), static_cast<int32_t>(x_size),
+      [this, x_data, y_data, &found](ptrdiff_t i) {
+        const int64_t value = static_cast<int64_t>(x_data[i]);
+        int64_t cat = -1;
+        if (!dense_categories_.empty()) {
+          const uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(dense_min_);
+          if (offset < dense_categories_.size())
+            cat = dense_categories_[offset];
+        } else {
+          auto int_idx = cats_int64s_.find(value);
+          if (int_idx != cats_int64s_.cend())
+            cat = static_cast<int64_t>(int_idx->second);
+        }
+        if (cat >= 0)
+          y_data[i * num_categories_ + cat] = 1.0f;
+        else
+          found[i] = 0;
+      },
+      0);
+
+  if (!zeros_) {
+    for (int64_t i = 0; i < x_size; ++i) {
+      if (!found[i])
+        return Status(ONNXRUNTIME, FAIL, "Unknown Category and zeros = 0.");
+    }
   }
   return Status::OK();
 }
@@ -107,12 +144,24 @@ common::Status OneHotEncoderOp<std::string>::Compute(OpKernelContext* context) c
 
   const auto* x_data = X->template Data<std::string>();
   const auto x_size = input_shape.Size();
-  for (int64_t i = 0; i < x_size; ++i) {
-    auto str_idx = cats_strings_.find(x_data[i]);
-    if (str_idx != cats_strings_.cend())
-      y_data[i * num_categories_ + str_idx->second] = 1.0f;
-    else if (!zeros_)
-      return Status(ONNXRUNTIME, FAIL, "Unknown Category and zeros = 0.");
+
+  std::vector<unsigned char> found(x_size, 1);
+  concurrency::ThreadPool::TryBatchParallelFor(
+      context->GetOperatorThreadPool(), static_cast<int32_t>(x_size),
+      [this, x_data, y_data, &found](ptrdiff_t i) {
+        const int64_t cat = cats_strings_.Find(x_data[i]);
+        if (cat >= 0)
+          y_data[i * num_categories_ + cat] = 1.0f;
+        else
+          found[i] = 0;
+      },
+      0);
+
+  if (!zeros_) {
+    for (int64_t i = 0; i < x_size; ++i) {
+      if (!found[i])
+        return Status(ONNXRUNTIME, FAIL, "Unknown Category and zeros = 0.");
+    }
   }
   return Status::OK();
 }
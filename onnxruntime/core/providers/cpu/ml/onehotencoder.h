@@ -4,6 +4,7 @@
 #pragma once
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/providers/cpu/ml/ml_common.h"
 
 namespace onnxruntime {
 namespace ml {
@@ -14,8 +15,14 @@ class OneHotEncoderOp final : public OpKernel {
   common::Status Compute(OpKernelContext* context) const override;
 
  private:
+  // integer categories are usually small and contiguous, so lookups go through
+  // a direct index table when the attribute range is compact and fall back to
+  // the hash map for sparse ranges. dense_categories_ maps (value - dense_min_)
+  // to the category position, -1 when the value is not a category.
+  std::vector<int64_t> dense_categories_;
+  int64_t dense_min_{0};
   std::unordered_map<int64_t, size_t> cats_int64s_;
-  std::unordered_map<std::string, size_t> cats_strings_;
+  StringVocabulary cats_strings_;
   int64_t zeros_;
   int64_t num_categories_;
 };
@@ -39,28 +39,48 @@ class SVMCommon {
     assert(a.size() == size_t(m * k) && b.size() == size_t(k * n) && out.size() == size_t(m * n));
 
     if (kernel_type_ == KERNEL::RBF) {
-      T* cur_out = out.data();
-      const T* cur_batch = a.data();
-
-      // each batch has 'k' features
-      for (int64_t batch = 0; batch < m; ++batch) {
-        const T* cur_support_vector = b.data();
-
-        // broadcast the support vectors against the k features in each batch. output is one value per support vector
-        for (int64_t support_vector = 0; support_vector < n; ++support_vector) {
-          T sum = 0.f;
-          const T* cur_input = cur_batch;
-
-          for (int64_t feature = 0; feature < k; ++feature) {
-            T val = *cur_input++ - *cur_support_vector++;
-            sum += val * val;
-          }
-
-          *cur_out++ = std::exp(-gamma_ * sum);
+      // expand ||x - sv||^2 to ||x||^2 + ||sv||^2 - 2 x.sv so the pairwise
+      // distances reduce to one GEMM against the support vectors plus the
+      // squared norms of each side, and the exponential runs over whole rows
+      // with the vectorized MLAS routine. the norms of 'b' are O(n*k), cheap
+      // next to the O(m*n*k) product, so they are recomputed per call.
+      std::vector<T> b_terms(n);
+      const T* cur_support_vector = b.data();
+      for (int64_t support_vector = 0; support_vector < n; ++support_vector, cur_support_vector += k) {
+        T sum = 0.f;
+        for (int64_t feature = 0; feature < k; ++feature) {
+          sum += cur_support_vector[feature] * cur_support_vector[feature];
         }
-
-        cur_batch += k;  // move to start of next batch
+        b_terms[support_vector] = -gamma_ * sum;
       }
+
+      // out = 2 * gamma * a . b^T
+      onnxruntime::Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
+                                        m, n, k,
+                                        2.f * gamma_, a.data(), b.data(), 0.f,
+                                        nullptr, nullptr,
+                                        out.data(),
+                                        threadpool);
+
+      concurrency::ThreadPool::TryBatchParallelFor(
+          threadpool, static_cast<int32_t>(m),
+          [this, &a, &out, &b_terms, n, k](ptrdiff_t batch) {
+            const T* cur_batch = a.data() + batch * k;
+            T* cur_out = out.data() + batch * n;
+
+            T sum = 0.f;
+            for (int64_t feature = 0; feature < k; ++feature) {
+              sum += cur_batch[feature] * cur_batch[feature];
+            }
+
+            const T a_term = -gamma_ * sum;
+            for (int64_t support_vector = 0; support_vector < n; ++support_vector) {
+              cur_out[support_vector] += a_term + b_terms[support_vector];
+            }
+
+            MlasComputeExp(cur_out, cur_out, static_cast<size_t>(n));
+          },
+          0);
     } else {
       float alpha = 1.f;
       float beta = 1.f;
@@ -31,6 +31,24 @@ class TreeEnsembleCommon {
   int parallel_tree_;  // starts parallelizing the computing if n_tree >= parallel_tree_ and n_rows == 1
   int parallel_N_;     // starts parallelizing the computing if n_rows >= parallel_N_
 
+  // Compact traversal table built once at kernel construction when every branch node
+  // shares the same comparison mode and no missing value tracks are present (the usual
+  // shape of a boosted ensemble). Each entry packs the fields read while descending a
+  // tree into one small record with index based children, so a node visit touches a
+  // single cache line instead of chasing pointers through the full TreeNodeElement
+  // records. For leaves feature_id is -1 and truenode holds the index of the original
+  // node carrying the leaf weights.
+  struct TreeNodeCompact {
+    OTYPE value;
+    int32_t feature_id;
+    int32_t truenode;
+    int32_t falsenode;
+  };
+  std::vector<TreeNodeCompact> compact_nodes_;
+  std::vector<int32_t> compact_roots_;
+  NODE_MODE compact_mode_;
+  bool use_compact_nodes_;
+
  public:
   TreeEnsembleCommon(int parallel_tree,
                      int parallel_N,
@@ -58,6 +76,10 @@ class TreeEnsembleCommon {
   TreeNodeElement<OTYPE>* ProcessTreeNodeLeave(
       TreeNodeElement<OTYPE>* root, const ITYPE* x_data) const;
 
+  // routes through the compact traversal table when it was built,
+  // otherwise falls back to the pointer based walk above
+  const TreeNodeElement<OTYPE>& ProcessTreeNodeLeave(size_t tree, const ITYPE* x_data) const;
+
   template <typename AGG>
   void ComputeAgg(concurrency::ThreadPool* ttp, const Tensor* X, Tensor* Z, Tensor* label, const AGG& agg) const;
 };
@@ -213,6 +235,32 @@ TreeEnsembleCommon<ITYPE, OTYPE>::TreeEnsembleCommon(int parallel_tree, int para
       break;
     }
   }
+
+  // build the compact traversal table. see the declaration for details.
+  compact_mode_ = fpos >= 0 ? cmodes[fpos] : NODE_MODE::LEAF;
+  use_compact_nodes_ = same_mode_ && !has_missing_tracks_;
+  if (use_compact_nodes_) {
+    compact_nodes_.resize(nodes_.size());
+    compact_roots_.reserve(roots_.size());
+    for (i = 0; i < nodes_.size(); ++i) {
+      const TreeNodeElement<OTYPE>& node = nodes_[i];
+      TreeNodeCompact& compact = compact_nodes_[i];
+      compact.value = node.value;
+      if (node.is_not_leaf && node.truenode != nullptr && node.falsenode != nullptr) {
+        compact.feature_id = node.feature_id;
+        compact.truenode = static_cast<int32_t>(node.truenode - nodes_.data());
+        compact.falsenode = static_cast<int32_t>(node.falsenode - nodes_.data());
+      } else {
+        // traversal stops here; point back at the node carrying the leaf weights
+        compact.feature_id = -1;
+        compact.truenode = static_cast<int32_t>(i);
+        compact.falsenode = compact.truenode;
+      }
+    }
+    for (auto root : roots_) {
+      compact_roots_.push_back(static_cast<int32_t>(root - nodes_.data()));
+    }
+  }
 }
 
 template <typename ITYPE, typename OTYPE>
@@ -268,7 +316,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
       ScoreValue<OTYPE> score = {0, 0};
       if (n_trees_ <= parallel_tree_) {
         for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data));
+          agg.ProcessTreeNodePrediction1(score, ProcessTreeNodeLeave(j, x_data));
         }
       } else {
         std::vector<ScoreValue<OTYPE>> scores_t(n_trees_, {0, 0});
@@ -276,7 +324,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
             ttp,
             SafeInt<int32_t>(n_trees_),
             [this, &scores_t, &agg, x_data](ptrdiff_t j) {
-              agg.ProcessTreeNodePrediction1(scores_t[j], *ProcessTreeNodeLeave(roots_[j], x_data));
+              agg.ProcessTreeNodePrediction1(scores_t[j], ProcessTreeNodeLeave(j, x_data));
             },
             0);
 
@@ -287,32 +335,38 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
 
       agg.FinalizeScores1(z_data, score, label_data);
     } else {
-      if (N <= parallel_N_) {
-        ScoreValue<OTYPE> score;
-        size_t j;
-
-        for (int64_t i = 0; i < N; ++i) {
-          score = {0, 0};
-          for (j = 0; j < static_cast<size_t>(n_trees_); ++j) {
-            agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+      // score a block of rows against one tree at a time, so the upper levels of each
+      // tree are reused from cache across the whole block instead of streaming the
+      // entire ensemble through the cache for every row. accumulation still happens in
+      // tree order per row so the result matches the row at a time version exactly.
+      constexpr int64_t kRowBlock = 64;
+      auto score_block = [this, &agg, x_data, z_data, stride, label_data, N](int64_t base) {
+        const int64_t rows = std::min(static_cast<int64_t>(kRowBlock), N - base);
+        ScoreValue<OTYPE> scores[kRowBlock];
+        std::fill(scores, scores + rows, ScoreValue<OTYPE>({0, 0}));
+
+        for (size_t j = 0; j < static_cast<size_t>(n_trees_); ++j) {
+          for (int64_t r = 0; r < rows; ++r) {
+            agg.ProcessTreeNodePrediction1(scores[r], ProcessTreeNodeLeave(j, x_data + (base + r) * stride));
           }
+        }
 
-          agg.FinalizeScores1(z_data + i * n_targets_or_classes_, score,
-                              label_data == nullptr ? nullptr : (label_data + i));
+        for (int64_t r = 0; r < rows; ++r) {
+          agg.FinalizeScores1(z_data + (base + r) * n_targets_or_classes_, scores[r],
+                              label_data == nullptr ? nullptr : (label_data + base + r));
+        }
+      };
+
+      if (N <= parallel_N_) {
+        for (int64_t base = 0; base < N; base += kRowBlock) {
+          score_block(base);
         }
       } else {
+        const int64_t num_blocks = (N + kRowBlock - 1) / kRowBlock;
         concurrency::ThreadPool::TryBatchParallelFor(
             ttp,
-            SafeInt<int32_t>(N),
-            [this, &agg, x_data, z_data, stride, label_data](ptrdiff_t i) {
-              ScoreValue<OTYPE> score = {0, 0};
-              for (size_t j = 0; j < static_cast<size_t>(n_trees_); ++j) {
-                agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
-              }
-
-              agg.FinalizeScores1(z_data + i * n_targets_or_classes_, score,
-                                  label_data == nullptr ? nullptr : (label_data + i));
-            },
+            SafeInt<int32_t>(num_blocks),
+            [&score_block](ptrdiff_t block) { score_block(block * kRowBlock); },
             0);
       }
     }
@@ -321,7 +375,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
       std::vector<ScoreValue<OTYPE>> scores(n_targets_or_classes_, {0, 0});
       if (n_trees_ <= parallel_tree_) {
         for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data));
+          agg.ProcessTreeNodePrediction(scores, ProcessTreeNodeLeave(j, x_data));
         }
       } else {
         // split the work into one block per thread so we can re-use the 'private_scores' vector as much as possible
@@ -335,7 +389,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
               std::vector<ScoreValue<OTYPE>> private_scores(n_targets_or_classes_, {0, 0});
               auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, n_trees_);
               for (auto j = work.start; j < work.end; ++j) {
-                agg.ProcessTreeNodePrediction(private_scores, *ProcessTreeNodeLeave(roots_[j], x_data));
+                agg.ProcessTreeNodePrediction(private_scores, ProcessTreeNodeLeave(j, x_data));
               }
 
               std::lock_guard<OrtMutex> lock(merge_mutex);
@@ -352,7 +406,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
         for (int64_t i = 0; i < N; ++i) {
           std::fill(scores.begin(), scores.end(), ScoreValue<OTYPE>({0, 0}));
           for (j = 0; j < roots_.size(); ++j) {
-            agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+            agg.ProcessTreeNodePrediction(scores, ProcessTreeNodeLeave(j, x_data + i * stride));
           }
 
           agg.FinalizeScores(scores, z_data + i * n_targets_or_classes_, -1,
@@ -373,7 +427,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
               for (auto i = work.start; i < work.end; ++i) {
                 std::fill(scores.begin(), scores.end(), ScoreValue<OTYPE>({0, 0}));
                 for (j = 0; j < roots_.size(); ++j) {
-                  agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+                  agg.ProcessTreeNodePrediction(scores, ProcessTreeNodeLeave(j, x_data + i * stride));
                 }
 
                 agg.FinalizeScores(scores,
@@ -492,6 +546,49 @@ TreeEnsembleCommon<ITYPE, OTYPE>::ProcessTreeNodeLeave(
   return root;
 }
 
+#define TREE_FIND_VALUE_COMPACT(CMP)                         \
+  while (nodes[idx].feature_id >= 0) {                       \
+    idx = x_data[nodes[idx].feature_id] CMP nodes[idx].value \
+              ? nodes[idx].truenode                          \
+              : nodes[idx].falsenode;                        \
+  }
+
+template <typename ITYPE, typename OTYPE>
+const TreeNodeElement<OTYPE>&
+TreeEnsembleCommon<ITYPE, OTYPE>::ProcessTreeNodeLeave(size_t tree, const ITYPE* x_data) const {
+  if (!use_compact_nodes_) {
+    return *ProcessTreeNodeLeave(roots_[tree], x_data);
+  }
+
+  // the comparison mode is shared by every branch node, so it is dispatched
+  // once before the descent instead of per node
+  const TreeNodeCompact* nodes = compact_nodes_.data();
+  int32_t idx = compact_roots_[tree];
+  switch (compact_mode_) {
+    case NODE_MODE::BRANCH_LEQ:
+      TREE_FIND_VALUE_COMPACT(<=)
+      break;
+    case NODE_MODE::BRANCH_LT:
+      TREE_FIND_VALUE_COMPACT(<)
+      break;
+    case NODE_MODE::BRANCH_GTE:
+      TREE_FIND_VALUE_COMPACT(>=)
+      break;
+    case NODE_MODE::BRANCH_GT:
+      TREE_FIND_VALUE_COMPACT(>)
+      break;
+    case NODE_MODE::BRANCH_EQ:
+      TREE_FIND_VALUE_COMPACT(==)
+      break;
+    case NODE_MODE::BRANCH_NEQ:
+      TREE_FIND_VALUE_COMPACT(!=)
+      break;
+    case NODE_MODE::LEAF:
+      break;
+  }
+  return nodes_[nodes[idx].truenode];
+}
+
 template <typename ITYPE, typename OTYPE>
 class TreeEnsembleCommonClassifier : TreeEnsembleCommon<ITYPE, OTYPE> {
  private:
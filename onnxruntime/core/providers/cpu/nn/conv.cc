@@ -151,6 +151,109 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+Conv<float>::Conv(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
+  activation_.ActivationKind = MlasIdentityActivation;
+
+  // When graph resolve time shape inference produced fully static input
+  // shapes, precompute the shape-derived portion of the compute plan once
+  // instead of re-deriving it on every Compute call. Failures here are not
+  // errors: Compute derives and validates the plan per call as before.
+  TensorShape input_shape;
+  TensorShape weight_shape;
+
+  if (info.TryGetStaticInputShape(0, input_shape) && info.TryGetStaticInputShape(1, weight_shape) &&
+      input_shape.NumDimensions() >= 3 &&
+      conv_attrs_.ValidateInputShape(input_shape, weight_shape).IsOK()) {
+    auto plan = onnxruntime::make_unique<ShapePlan>();
+    if (BuildShapePlan(input_shape, weight_shape, *plan).IsOK()) {
+      shape_plan_ = std::move(plan);
+    }
+  }
+}
+
+Status Conv<float>::BuildShapePlan(const TensorShape& input_shape, const TensorShape& weight_shape,
+                                   ShapePlan& plan) const {
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(weight_shape, plan.kernel_shape));
+
+  plan.pads = conv_attrs_.pads;
+  if (plan.pads.empty()) {
+    plan.pads.resize(plan.kernel_shape.size() * 2, 0);
+  }
+  plan.dilations = conv_attrs_.dilations;
+  if (plan.dilations.empty()) {
+    plan.dilations.resize(plan.kernel_shape.size(), 1);
+  }
+  plan.strides = conv_attrs_.strides;
+  if (plan.strides.empty()) {
+    plan.strides.resize(plan.kernel_shape.size(), 1);
+  }
+
+  plan.output_dims.assign({input_shape[0], weight_shape[0]});
+  ORT_RETURN_IF_ERROR(conv_attrs_.InferOutputShape(input_shape.Slice(2), plan.kernel_shape, plan.strides,
+                                                   plan.dilations, plan.pads, plan.output_dims));
+
+  plan.input_shape = input_shape;
+  plan.weight_shape = weight_shape;
+
+  return Status::OK();
+}
+
+Status Conv<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // Only the filter tensor of a 3x3 convolution with unit strides and
+  // dilations is transformed to the Winograd domain. The channel bounds
+  // mirror the profitability heuristic in MlasConvWinogradApplicable.
+  if (input_idx != 1) {
+    return Status::OK();
+  }
+
+  const auto& shape = tensor.Shape();
+  if (shape.NumDimensions() != 4 || shape[2] != 3 || shape[3] != 3) {
+    return Status::OK();
+  }
+
+  for (auto stride : conv_attrs_.strides) {
+    if (stride != 1) {
+      return Status::OK();
+    }
+  }
+
+  for (auto dilation : conv_attrs_.dilations) {
+    if (dilation != 1) {
+      return Status::OK();
+    }
+  }
+
+  const int64_t group = conv_attrs_.group;
+  const int64_t filter_count = shape[0] / group;
+  const int64_t input_channels = shape[1];
+
+  if ((shape[0] % group) != 0 || filter_count < 16 || input_channels < 16) {
+    return Status::OK();
+  }
+
+  const size_t transformed_filter_size =
+      MlasConvWinogradFilterBufferSize(static_cast<size_t>(group),
+                                       static_cast<size_t>(filter_count),
+                                       static_cast<size_t>(input_channels));
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* transformed_filter_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * transformed_filter_size);
+  transformed_filter_ = BufferUniquePtr(transformed_filter_data, BufferDeleter(alloc));
+
+  MlasConvWinogradTransformFilter(tensor.Data<float>(),
+                                  static_cast<size_t>(group),
+                                  static_cast<size_t>(filter_count),
+                                  static_cast<size_t>(input_channels),
+                                  static_cast<float*>(transformed_filter_.get()));
+
+  // The original weights are still required when the runtime shapes fall
+  // back to the im2col or direct GEMM algorithms, so the initializer is
+  // deliberately not released.
+  return Status::OK();
+}
+
 Status Conv<float>::Compute(OpKernelContext* context) const {
   size_t num_inputs = OpKernel::Node().InputDefs().size();
   const auto* X = context->Input<Tensor>(0);
@@ -159,28 +262,26 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
   const int64_t N = X->Shape()[0];
   const int64_t C = X->Shape()[1];
   const int64_t M = W->Shape()[0];
-  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
 
-  std::vector<int64_t> kernel_shape;
-  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
+  // Reuse the shape plan precomputed at kernel creation time when the
+  // runtime shapes match the resolve time shapes, otherwise derive and
+  // validate the plan for this call.
+  ShapePlan derived_plan;
+  const ShapePlan* plan = shape_plan_.get();
 
-  std::vector<int64_t> pads(conv_attrs_.pads);
-  if (pads.empty()) {
-    pads.resize(kernel_shape.size() * 2, 0);
-  }
-  std::vector<int64_t> dilations(conv_attrs_.dilations);
-  if (dilations.empty()) {
-    dilations.resize(kernel_shape.size(), 1);
-  }
-  std::vector<int64_t> strides(conv_attrs_.strides);
-  if (strides.empty()) {
-    strides.resize(kernel_shape.size(), 1);
+  if (plan == nullptr || plan->input_shape != X->Shape() || plan->weight_shape != W->Shape()) {
+    ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+    ORT_RETURN_IF_ERROR(BuildShapePlan(X->Shape(), W->Shape(), derived_plan));
+    plan = &derived_plan;
   }
 
-  std::vector<int64_t> Y_dims({N, M});
+  const std::vector<int64_t>& kernel_shape = plan->kernel_shape;
+  const std::vector<int64_t>& pads = plan->pads;
+  const std::vector<int64_t>& dilations = plan->dilations;
+  const std::vector<int64_t>& strides = plan->strides;
+
+  Tensor* Y = context->Output(0, TensorShape(plan->output_dims));
   TensorShape input_shape = X->Shape().Slice(2);
-  ORT_RETURN_IF_ERROR(conv_attrs_.InferOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
-  Tensor* Y = context->Output(0, TensorShape(Y_dims));
   TensorShape output_shape = Y->Shape().Slice(2);
 
   // Bail out early if one of the dimensions is zero.
@@ -217,6 +318,25 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
                     &WorkingBufferSize,
                     thread_pool);
 
+    // Use the Winograd algorithm when the filter was transformed at prepack
+    // time and the runtime shapes qualify, otherwise fall through to the
+    // direct and im2col GEMM algorithms selected by MlasConvPrepare.
+    if (transformed_filter_ != nullptr && MlasConvWinogradApplicable(&Parameters)) {
+      const size_t winograd_buffer_size = MlasConvWinogradWorkingBufferSize(&Parameters);
+      auto* winograd_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * winograd_buffer_size);
+      BufferUniquePtr winograd_buffer(winograd_data, BufferDeleter(alloc));
+
+      MlasConvWinograd(&Parameters,
+                       Xdata,
+                       static_cast<const float*>(transformed_filter_.get()),
+                       Bdata,
+                       static_cast<float*>(winograd_buffer.get()),
+                       Ydata,
+                       thread_pool);
+
+      return Status::OK();
+    }
+
     auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(SafeInt<size_t>(sizeof(float)) * WorkingBufferSize)
                                                : nullptr;
     BufferUniquePtr working_buffer(working_data, BufferDeleter(alloc));
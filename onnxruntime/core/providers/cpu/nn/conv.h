@@ -24,9 +24,9 @@ class Conv : public OpKernel {
 template <>
 class Conv<float> : public OpKernel {
  public:
-  Conv<float>(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
-    activation_.ActivationKind = MlasIdentityActivation;
-  }
+  Conv<float>(const OpKernelInfo& info);
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
 
   Status Compute(OpKernelContext* context) const override;
 
@@ -34,6 +34,31 @@ class Conv<float> : public OpKernel {
   MLAS_ACTIVATION activation_;
 
   ConvAttributes conv_attrs_;
+
+  // Filter transformed to the Winograd domain, or nullptr if the kernel
+  // attributes rule out the Winograd path. The original weights are kept
+  // as well since the runtime shapes may still select another algorithm.
+  BufferUniquePtr transformed_filter_;
+
+ private:
+  // Shape-derived portion of the compute plan: the resolved kernel shape,
+  // the defaulted and auto-pad adjusted attribute vectors and the inferred
+  // output dimensions. Precomputed once at kernel creation time when graph
+  // resolve time shape inference produced fully static input shapes,
+  // otherwise derived per Compute call.
+  struct ShapePlan {
+    TensorShape input_shape;
+    TensorShape weight_shape;
+    std::vector<int64_t> kernel_shape;
+    std::vector<int64_t> pads;
+    std::vector<int64_t> dilations;
+    std::vector<int64_t> strides;
+    std::vector<int64_t> output_dims;
+  };
+
+  Status BuildShapePlan(const TensorShape& input_shape, const TensorShape& weight_shape, ShapePlan& plan) const;
+
+  std::unique_ptr<ShapePlan> shape_plan_;
 };
 
 }  // namespace onnxruntime
@@ -60,7 +60,7 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
   const int64_t W_offset = p.F->Shape().Size() / conv_transpose_attrs_.group;
   const int64_t kernel_size = TensorShape(p.kernel_shape).Size();
   const int64_t kernel_dim = p.num_output_channels / conv_transpose_attrs_.group * kernel_size;
-  const int64_t output_size = (p.Y->Shape().Slice(2)).Size();
+  const int64_t output_size = p.Y->Shape().SizeFromDimension(2);
 
   AllocatorPtr alloc;
   ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
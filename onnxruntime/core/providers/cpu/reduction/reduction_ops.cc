@@ -340,6 +340,66 @@ void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
   }
 }
 
+// Reduces a row-major (rows x red_size) contiguous block with a two-level
+// tree. First level: every (row, chunk) pair folds one slice of one row into
+// a raw partial with the aggregator's vectorised `fold`. Second level: the
+// partials of each row are merged and finalised. Splitting the reduced
+// dimension itself keeps every core busy when there are fewer rows than
+// threads, e.g. when reducing the last axis of a tensor whose leading
+// dimensions are small. When there are enough rows, the chunking degenerates
+// to one whole row per task and the partials table is skipped.
+template <typename T, typename AGG>
+static void ContiguousTreeReduce(const T* from_data, int64_t rows, int64_t red_size,
+                                 typename AGG::value_type* to_data, concurrency::ThreadPool* tp) {
+  // A chunk has to be large enough to amortise the scheduling of one task
+  // over the vectorised fold.
+  constexpr int64_t kMinChunkSize = 4096;
+  int64_t degree = concurrency::ThreadPool::DegreeOfParallelism(tp);
+  int64_t chunks_per_row = std::max<int64_t>(degree / rows, 1);
+  chunks_per_row = std::min(chunks_per_row, std::max<int64_t>(red_size / kMinChunkSize, 1));
+
+  if (chunks_per_row == 1) {
+    auto fn = [from_data, red_size, to_data](std::ptrdiff_t first, std::ptrdiff_t end) {
+      for (std::ptrdiff_t row = first; row < end; ++row) {
+        const T* row_data = from_data + row * red_size;
+        AGG accumulator(red_size, row_data[0]);
+        accumulator.fold(row_data, red_size);
+        to_data[row] = accumulator.get_value();
+      }
+    };
+    auto cost = TensorOpCost{(double)(red_size * sizeof(T)), (double)sizeof(T), (double)red_size};
+    concurrency::ThreadPool::TryParallelFor(tp, rows, cost, fn);
+    return;
+  }
+
+  int64_t chunk_size = red_size / chunks_per_row;
+  std::vector<T> partials(rows * chunks_per_row);
+  auto fold_fn = [&](std::ptrdiff_t first, std::ptrdiff_t end) {
+    for (std::ptrdiff_t i = first; i < end; ++i) {
+      int64_t row = i / chunks_per_row;
+      int64_t chunk = i % chunks_per_row;
+      int64_t begin = chunk * chunk_size;
+      int64_t length = chunk == chunks_per_row - 1 ? red_size - begin : chunk_size;
+      const T* chunk_data = from_data + row * red_size + begin;
+      AGG accumulator(red_size, chunk_data[0]);
+      accumulator.fold(chunk_data, length);
+      partials[i] = accumulator.partial();
+    }
+  };
+  auto cost = TensorOpCost{(double)(chunk_size * sizeof(T)), (double)sizeof(T), (double)chunk_size};
+  concurrency::ThreadPool::TryParallelFor(tp, rows * chunks_per_row, cost, fold_fn);
+
+  // The partials table is tiny compared to the input, the merge is sequential.
+  for (int64_t row = 0; row < rows; ++row) {
+    const T* row_partials = partials.data() + row * chunks_per_row;
+    AGG accumulator(red_size, row_partials[0]);
+    for (int64_t chunk = 0; chunk < chunks_per_row; ++chunk) {
+      accumulator.merge(row_partials[chunk]);
+    }
+    to_data[row] = accumulator.get_value();
+  }
+}
+
 template <typename T, typename AGG>
 void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const Tensor& input,
                        const std::vector<int64_t>& reduced_axes, concurrency::ThreadPool* tp,
@@ -352,7 +412,11 @@ void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const
   if (reduced_axes.size() == 0 || reduced_axes.size() == new_input_shape.NumDimensions()) {
     ORT_ENFORCE(count == 1, "Reduction on all axes, output size should be 1.");
     int64_t input_size = new_input_shape.Size();
-    to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
+    if (AGG::block_parallel()) {
+      ContiguousTreeReduce<T, AGG>(from_data, 1, input_size, to_data, tp);
+    } else {
+      to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
+    }
     return;
   }
 
@@ -363,6 +427,23 @@ void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const
   }
   int64_t denominator = last_results.last_loop_red_size * last_results.projected_index.size();
 
+  // When the reduced axes are the trailing axes of the input, every output is
+  // reduced over one contiguous run and the whole input can be seen as a
+  // row-major (count x last_loop_red_size) matrix.
+  if (AGG::block_parallel() && last_results.projected_index.size() == 1 &&
+      last_results.projected_index[0] == 0 && last_results.last_loop_red_inc == 1 &&
+      last_results.last_loop_inc == last_results.last_loop_red_size) {
+    int64_t row_stride = last_results.last_loop_size * last_results.last_loop_red_size;
+    bool contiguous = last_results.unprojected_index[0] == 0;
+    for (size_t i = 1; contiguous && i < last_results.unprojected_index.size(); ++i) {
+      contiguous = last_results.unprojected_index[i] == static_cast<int64_t>(i) * row_stride;
+    }
+    if (contiguous) {
+      ContiguousTreeReduce<T, AGG>(from_data, count, last_results.last_loop_red_size, to_data, tp);
+      return;
+    }
+  }
+
   if (AGG::two_loops()) {
     auto fn = [&](std::ptrdiff_t first, std::ptrdiff_t end) {
       int64_t loop;
@@ -114,6 +114,16 @@ class ReduceAggregator {
   inline TVAL get_value() { return accumulator_; }
   inline void enforce(const ResultsNoTransposePrepareForReduce&) {}
   static inline bool two_loops() { return false; }
+  // Block interface used by the contiguous tree reduction in NoTransposeReduce.
+  // `fold` folds a contiguous block into the accumulator with a vectorized
+  // Eigen kernel, `partial` exposes the raw (non finalised) accumulator and
+  // `merge` combines the raw partial of another instance computed over a
+  // disjoint block. Aggregators implementing the three of them return true
+  // from `block_parallel` and become eligible for the fast path.
+  inline void fold(const T*, int64_t) { ORT_ENFORCE(false, "must be overloaded."); }
+  inline void merge(const T&) { ORT_ENFORCE(false, "must be overloaded."); }
+  inline T partial() { return accumulator_; }
+  static inline bool block_parallel() { return false; }
 };
 
 template <typename T, typename TVAL = T>
@@ -124,6 +134,11 @@ class ReduceAggregatorSum : public ReduceAggregator<T, TVAL> {
   inline TVAL aggall(const T* from_data) {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).sum();
   }
+  inline void fold(const T* from_data, int64_t n) {
+    this->accumulator_ += Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).sum();
+  }
+  inline void merge(const T& partial) { this->accumulator_ += partial; }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = T>
@@ -134,6 +149,11 @@ class ReduceAggregatorSumSquare : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).squaredNorm();
   }
   inline void update(const T& v) { this->accumulator_ += v * v; }
+  inline void fold(const T* from_data, int64_t n) {
+    this->accumulator_ += Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).squaredNorm();
+  }
+  inline void merge(const T& partial) { this->accumulator_ += partial; }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = T>
@@ -154,6 +174,11 @@ class ReduceAggregatorMax : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).maxCoeff();
   }
   inline void update(const T& v) { this->accumulator_ = v > this->accumulator_ ? v : this->accumulator_; }
+  inline void fold(const T* from_data, int64_t n) {
+    update(Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).maxCoeff());
+  }
+  inline void merge(const T& partial) { update(partial); }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = int64_t>
@@ -253,6 +278,11 @@ class ReduceAggregatorMin : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).minCoeff();
   }
   inline void update(const T& v) { this->accumulator_ = v < this->accumulator_ ? v : this->accumulator_; }
+  inline void fold(const T* from_data, int64_t n) {
+    update(Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).minCoeff());
+  }
+  inline void merge(const T& partial) { update(partial); }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = T>
@@ -263,6 +293,11 @@ class ReduceAggregatorProd : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).prod();
   }
   inline void update(const T& v) { this->accumulator_ *= v; }
+  inline void fold(const T* from_data, int64_t n) {
+    this->accumulator_ *= Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).prod();
+  }
+  inline void merge(const T& partial) { this->accumulator_ *= partial; }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = T>
@@ -273,6 +308,11 @@ class ReduceAggregatorL1 : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).cwiseAbs().sum();
   }
   inline void update(const T& v) { this->accumulator_ += v > 0 ? v : -v; }
+  inline void fold(const T* from_data, int64_t n) {
+    this->accumulator_ += Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).cwiseAbs().sum();
+  }
+  inline void merge(const T& partial) { this->accumulator_ += partial; }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = T>
@@ -284,6 +324,11 @@ class ReduceAggregatorL2 : public ReduceAggregator<T, TVAL> {
   }
   inline void update(const T& v) { this->accumulator_ += v * v; }
   inline TVAL get_value() { return reduce_sqrt<T>(this->accumulator_); }
+  inline void fold(const T* from_data, int64_t n) {
+    this->accumulator_ += Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).squaredNorm();
+  }
+  inline void merge(const T& partial) { this->accumulator_ += partial; }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = T>
@@ -295,6 +340,11 @@ class ReduceAggregatorLogSum : public ReduceAggregator<T, TVAL> {
   }
   inline void update(const T& v) { this->accumulator_ += v; }
   inline TVAL get_value() { return reduce_log<T>(this->accumulator_); }
+  inline void fold(const T* from_data, int64_t n) {
+    this->accumulator_ += Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).sum();
+  }
+  inline void merge(const T& partial) { this->accumulator_ += partial; }
+  static inline bool block_parallel() { return true; }
 };
 
 template <typename T, typename TVAL = T>
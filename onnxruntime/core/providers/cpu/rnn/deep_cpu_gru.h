@@ -51,11 +51,17 @@ class DeepCpuGruOp final : public OpKernel {
                                                      activation_func_betas);
   }
 
+#if !defined(USE_MKLML_FOR_BLAS)
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+#endif
   Status Compute(OpKernelContext* context) const override;
 
   ~DeepCpuGruOp() override = default;
 
  private:
+  Status TryPackInputWeights(const Tensor& weights, bool& is_packed);
+  Status TryPackRecurrentWeights(const Tensor& weights, bool& is_packed);
+
   rnn::detail::Direction direction_;
   int num_directions_;
 
@@ -65,6 +71,12 @@ class DeepCpuGruOp final : public OpKernel {
 
   rnn::detail::ActivationFuncs activation_funcs_;
 
+  // the recurrence weights feed two separate GEMMs per step - one over the update/reset gate
+  // rows and one over the hidden gate rows - so they are packed as two separate matrices
+  rnn::detail::PackedWeights packed_W_;
+  rnn::detail::PackedWeights packed_R_ZR_;
+  rnn::detail::PackedWeights packed_R_H_;
+
   template <typename T>
   Status ComputeImpl(OpKernelContext& context) const;
 };
@@ -72,6 +72,10 @@ Status LSTMBase::ComputeImpl(OpKernelContext& context,
   status = context.GetTempSpaceAllocator(&alloc);
   ORT_RETURN_IF_ERROR(status);
 
+  // serve the per-Run state and gate buffers below from the kernel's scratch arena so their
+  // backing memory is reused across Runs. no early returns between here and the release.
+  alloc = AcquireScratchAllocator(alloc);
+
   gsl::span<const InputT> bias = B != nullptr ? B->DataAsSpan<InputT>() : gsl::span<const InputT>();
   gsl::span<const InputT> peephole_weights = P != nullptr ? P->DataAsSpan<InputT>() : gsl::span<const InputT>();
 
@@ -170,9 +174,33 @@ Status LSTMBase::ComputeImpl(OpKernelContext& context,
   DumpMatrix("Y_h", hidden_output.data(), num_directions_ * batch_size, hidden_size_);
   DumpMatrix("Y_c", last_cell.data(), num_directions_ * batch_size, hidden_size_);
 
+  ReleaseScratchAllocator(alloc);
+
   return Status::OK();
 }
 
+AllocatorPtr LSTMBase::AcquireScratchAllocator(const AllocatorPtr& base_allocator) const {
+  std::lock_guard<OrtMutex> lock(scratch_arena_lock_);
+  if (scratch_arena_in_use_) {
+    return base_allocator;
+  }
+
+  if (!scratch_arena_) {
+    scratch_arena_ = std::make_shared<rnn::detail::RnnScratchArena>(base_allocator);
+  }
+
+  scratch_arena_->Reset();
+  scratch_arena_in_use_ = true;
+  return scratch_arena_;
+}
+
+void LSTMBase::ReleaseScratchAllocator(const AllocatorPtr& allocator) const {
+  std::lock_guard<OrtMutex> lock(scratch_arena_lock_);
+  if (allocator == scratch_arena_) {
+    scratch_arena_in_use_ = false;
+  }
+}
+
 Status LSTMBase::ValidateInputs(const Tensor& X,
                                 const Tensor* B,
                                 const Tensor* sequence_lens,
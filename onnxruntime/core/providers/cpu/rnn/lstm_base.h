@@ -64,6 +64,12 @@ class LSTMBase {
                         const Tensor* initial_c,
                         const Tensor* P) const;
 
+  /// Hand the kernel's scratch arena to the calling Run so the per-Run state and gate buffers
+  /// reuse the block cached from earlier Runs. At most one Run uses the arena at a time; a
+  /// concurrent Run on the same kernel gets base_allocator back and allocates per-Run as before.
+  AllocatorPtr AcquireScratchAllocator(const AllocatorPtr& base_allocator) const;
+  void ReleaseScratchAllocator(const AllocatorPtr& allocator) const;
+
   rnn::detail::Direction direction_;
   int num_directions_;
 
@@ -72,6 +78,12 @@ class LSTMBase {
   bool input_forget_ = false;
 
   rnn::detail::ActivationFuncs activation_funcs_;
+
+ private:
+  // scratch block reused across Runs. mutable as Compute is const; guarded by scratch_arena_lock_
+  mutable std::shared_ptr<rnn::detail::RnnScratchArena> scratch_arena_;
+  mutable bool scratch_arena_in_use_ = false;
+  mutable OrtMutex scratch_arena_lock_;
 };
 
 }  // namespace onnxruntime
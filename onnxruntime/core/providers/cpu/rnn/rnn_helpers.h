@@ -7,9 +7,13 @@
 #pragma warning(disable : 4267)
 #endif
 
+#include <atomic>
+#include <vector>
+
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
 #include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 #include "core/util/qmath.h"
@@ -70,6 +74,54 @@ gsl::span<TAlloc> Allocate(std::shared_ptr<IAllocator> allocator,
   return span;
 }
 
+/** Bump allocator over a single block that an RNN kernel owns and reuses across Runs.
+
+The LSTM/GRU implementations allocate the same set of state and gate buffers on every Compute
+call, which a streaming model running the kernel once per frame pays for per frame. Routing those
+allocations through an instance of this class keeps the backing block alive in the kernel between
+Runs so steady-state Runs perform no allocator round trips.
+
+Runs whose requests outgrow the current block (including the first Run, which starts with no
+block) are served by the base allocator while the total request size is recorded; the next
+Reset() grows the block to that high-water mark. Free() is a no-op for pointers inside a block -
+that memory is reclaimed wholesale by a later Reset(). Outgrown blocks are retired rather than
+freed, as deleters from the Run that outgrew them may still return pointers into them; retirement
+only happens while the block is still growing so the overhead is transient.
+
+Alloc() may be called concurrently from the batch-parallel RNN lambdas, hence the atomic cursor.
+Reset() must only be called between Runs, i.e. when no Run is allocating from the arena.
+*/
+class RnnScratchArena final : public IAllocator {
+ public:
+  explicit RnnScratchArena(AllocatorPtr base_allocator)
+      : IAllocator(base_allocator->Info()), base_allocator_(std::move(base_allocator)) {}
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+
+  // grow the block to the previous Run's high-water mark and rewind the cursor
+  void Reset();
+
+ private:
+  // matches the alignment of the CPU allocators backing the arena
+  static constexpr size_t kScratchAlignment = 64;
+
+  bool InBlock(const void* block, size_t capacity, const void* p) const {
+    return block != nullptr && p >= block && p < static_cast<const uint8_t*>(block) + capacity;
+  }
+
+  AllocatorPtr base_allocator_;
+  IAllocatorUniquePtr<void> block_;
+  size_t capacity_ = 0;
+  std::atomic<size_t> cursor_{0};
+  std::atomic<size_t> requested_{0};
+
+  // outgrown blocks kept alive until the arena is destroyed. guarded by blocks_lock_ together
+  // with block_, as late Free() calls from the previous Run can overlap the next Run's Reset().
+  std::vector<std::pair<IAllocatorUniquePtr<void>, size_t>> retired_blocks_;
+  OrtMutex blocks_lock_;
+};
+
 // validate the common inputs to RNN, LSTM and GRU operators
 Status ValidateCommonRnnInputs(const Tensor& X,
                                const TensorShape& W_shape,
@@ -13,8 +13,9 @@ using namespace onnxruntime::common;
 
 namespace onnxruntime {
 
-// TODO: The current implementation of sequence ops relies on tensor copies. Ideally we should try to avoid
-// these copies. This has been postponed due to lack of time.
+// TODO: The sequence ops still copy the elements of input sequences because those are const values owned by
+// the execution frame and may have other consumers. Avoiding the copies needs the frame to transfer ownership
+// when the kernel is the last consumer. Tensors the kernel produces itself are moved into the output sequence.
 
 // SequenceLength
 ONNX_CPU_OPERATOR_KERNEL(
@@ -182,13 +183,12 @@ ONNX_CPU_OPERATOR_KERNEL(
                                  DataTypeImpl::GetTensorType<int64_t>()}),
     SequenceInsert);
 
-Status CreateCopyAndAppendCpuTensor(const Tensor& in_tensor, OpKernelContext* context, std::vector<Tensor>& tensors) {
-  AllocatorPtr alloc;
-  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+// the allocator is passed in so sequences can be built without a frame
+// lookup per element
+static Tensor CloneCpuTensor(const Tensor& in_tensor, const AllocatorPtr& alloc) {
   Tensor tmp(in_tensor.DataType(), onnxruntime::TensorShape(in_tensor.Shape()), alloc);
   CopyCpuTensor(&in_tensor, &tmp);
-  tensors.push_back(std::move(tmp));
-  return Status::OK();
+  return tmp;
 }
 
 Status SequenceInsert::Compute(OpKernelContext* context) const {
@@ -222,23 +222,22 @@ Status SequenceInsert::Compute(OpKernelContext* context) const {
 
   auto* Y = context->Output<TensorSeq>(0);
   ORT_ENFORCE(Y != nullptr, "SequenceInsert: Got nullptr for output sequence");
-  std::vector<Tensor> tensors;
-  tensors.reserve(num_tensors_input_seq + 1);
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+  Y->SetType(S->DataType());
+  Y->Reserve(num_tensors_input_seq + 1);
   for (int i = 0; i < num_tensors_input_seq; ++i) {
     if (i == input_seq_idx) {
-      CreateCopyAndAppendCpuTensor(*X, context, tensors);
-      CreateCopyAndAppendCpuTensor(S->Get(i), context, tensors);
+      Y->Add(CloneCpuTensor(*X, alloc));
+      Y->Add(CloneCpuTensor(S->Get(i), alloc));
     } else {
-      CreateCopyAndAppendCpuTensor(S->Get(i), context, tensors);
+      Y->Add(CloneCpuTensor(S->Get(i), alloc));
     }
   }
   if (input_seq_idx == num_tensors_input_seq + 1) {
-    CreateCopyAndAppendCpuTensor(*X, context, tensors);
+    Y->Add(CloneCpuTensor(*X, alloc));
   }
 
-  Y->SetType(S->DataType());
-  Y->SetElements(std::move(tensors));
-
   return Status::OK();
 }
 
@@ -274,16 +273,16 @@ Status SequenceErase::Compute(OpKernelContext* context) const {
 
   auto* Y = context->Output<TensorSeq>(0);
   ORT_ENFORCE(Y != nullptr, "SequenceErase: Got nullptr for output sequence");
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
   Y->SetType(S->DataType());
-  std::vector<Tensor> tensors;
-  tensors.reserve(num_tensors_input_seq - 1);
+  Y->Reserve(num_tensors_input_seq - 1);
   for (int i = 0; i < num_tensors_input_seq; ++i) {
     if (i == input_seq_idx) {
       continue;
     }
-    CreateCopyAndAppendCpuTensor(S->Get(i), context, tensors);
+    Y->Add(CloneCpuTensor(S->Get(i), alloc));
   }
-  Y->SetElements(std::move(tensors));
   return Status::OK();
 }
 
@@ -314,14 +313,14 @@ Status SequenceConstruct::Compute(OpKernelContext* context) const {
   }
 
   // now copy the tensors to the output sequence
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
   Y->SetType(first_dtype);
-  std::vector<Tensor> tensors;
-  tensors.reserve(num_inputs);
+  Y->Reserve(num_inputs);
   for (int input_idx = 0; input_idx < num_inputs; ++input_idx) {
     const auto* X = context->Input<Tensor>(input_idx);
-    CreateCopyAndAppendCpuTensor(*X, context, tensors);
+    Y->Add(CloneCpuTensor(*X, alloc));
   }
-  Y->SetElements(std::move(tensors));
   return Status::OK();
 }
 
@@ -499,7 +498,11 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
   // copy dimensions so we can update the selected axis in place
   auto& input_dims = input_shape.GetDims();
   std::vector<int64_t> output_dimensions{input_dims};
-  std::vector<Tensor> tensors;
+  auto& tseq = *context.Output<TensorSeq>(0);
+  tseq.SetType(input.DataType());
+  tseq.Reserve(num_outputs);
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context.GetTempSpaceAllocator(&alloc));
   int64_t input_offset = 0;
   const T* input_data = input.template Data<T>();
   for (int i = 0; i < num_outputs; ++i) {
@@ -512,8 +515,6 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
     }
     output_dimensions[axis] = split_size;
 
-    AllocatorPtr alloc;
-    ORT_RETURN_IF_ERROR(context.GetTempSpaceAllocator(&alloc));
     Tensor output_tensor(input.DataType(), onnxruntime::TensorShape(output_dimensions), alloc);
     T* output_data = output_tensor.template MutableData<T>();
 
@@ -543,13 +544,9 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
     }
 
     // finally move the resulting tensor to the output sequence
-    tensors.push_back(std::move(output_tensor));
+    tseq.Add(std::move(output_tensor));
   }
 
-  auto& tseq = *context.Output<TensorSeq>(0);
-  tseq.SetType(input.DataType());
-  tseq.SetElements(std::move(tensors));
-
   return Status::OK();
 }
 }  // namespace onnxruntime
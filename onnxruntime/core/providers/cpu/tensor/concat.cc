@@ -2,8 +2,12 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/tensor/concat.h"
+
+#include <algorithm>
+
 #include "core/providers/common.h"
 #include "core/framework/TensorSeq.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 
@@ -11,7 +15,7 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Concat,
     4,
     10,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()).ConsumedAfterRead(),
     Concat);
 
 // Opset 11 starts to support Neg Axis.
@@ -19,14 +23,14 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Concat,
     11,
     12,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()).ConsumedAfterRead(),
     Concat);
 
 // Opset 13 .
 ONNX_CPU_OPERATOR_KERNEL(
     Concat,
     13,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()).ConsumedAfterRead(),
     Concat);
 
 // this method will be shared between 'Concat' (CPU and GPU) and
@@ -160,50 +164,117 @@ Status ConcatBase::PrepareForCompute(OpKernelContext* ctx,
 }
 
 // This method computes the output tensor for Concat/ConcatFromSequence ops
-Status ConcatBase::ComputeImpl(Prepare& p) const {
+Status ConcatBase::ComputeImpl(Prepare& p, OpKernelContext* ctx) const {
   int input_count = static_cast<int>(p.inputs.size());
-  int64_t initial_output_offset = 0;  // initial offset for each input
   auto element_bytes = p.output_tensor->DataType()->Size();
-  for (int input_index = 0; input_index < input_count; input_index++) {
-    const auto& prep = p.inputs[input_index];
 
-    // no data in this tensor - so skip it
-    if (prep.num_elements == 0)
-      continue;
+  if (p.is_string_type) {
+    int64_t initial_output_offset = 0;  // initial offset for each input
+    uint8_t* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
+    for (int input_index = 0; input_index < input_count; input_index++) {
+      const auto& prep = p.inputs[input_index];
 
-    auto input_axis_pitch = prep.axis_pitch;
-    const uint8_t* input = static_cast<const uint8_t*>(prep.tensor->DataRaw());
+      // no data in this tensor - so skip it
+      if (prep.num_elements == 0)
+        continue;
 
-    auto input_size = prep.num_elements;
+      auto input_axis_pitch = prep.axis_pitch;
+      const uint8_t* input = static_cast<const uint8_t*>(prep.tensor->DataRaw());
 
-    // Copy the data across. For every 'input_axis_pitch' values copied, we move over by the 'output_axis_pitch'
-    // TODO: Optimization possibility: There are cases where we simply need to "merge" raw buffers and this
-    // could be done without the pointer house-keeping as below. Some scenarios whether this is possible are:
-    // 1) Concatenating on input axis = 0
-    // 2) Stacking on output axis = 0
-    // 3) Stacking scalars
-    uint8_t* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
-    int64_t cur_out_offset = 0;
-    int64_t cur_in_offset = 0;
-    for (size_t idx_copy = 0, end = input_size / input_axis_pitch; idx_copy < end; ++idx_copy) {
-      if (p.is_string_type) {
+      // Copy the data across. For every 'input_axis_pitch' values copied, we move over by the 'output_axis_pitch'
+      int64_t cur_out_offset = 0;
+      int64_t cur_in_offset = 0;
+      for (size_t idx_copy = 0, end = prep.num_elements / input_axis_pitch; idx_copy < end; ++idx_copy) {
         size_t out = initial_output_offset + cur_out_offset;
         for (int idx_item = 0; idx_item < input_axis_pitch; ++idx_item) {
           reinterpret_cast<std::string*>(output)[out + idx_item] =
               reinterpret_cast<const std::string*>(input)[cur_in_offset + idx_item];
         }
-      } else {
-        memcpy(
-            output + (initial_output_offset + cur_out_offset) * element_bytes,
-            input + cur_in_offset * element_bytes,
-            input_axis_pitch * element_bytes);
+
+        cur_out_offset += p.output_axis_pitch;
+        cur_in_offset += input_axis_pitch;
       }
 
-      cur_out_offset += p.output_axis_pitch;
-      cur_in_offset += input_axis_pitch;
+      // this input has been copied to the output in full. if we are its last consumer, hand its
+      // buffer back now instead of keeping every slice live until the whole concat is done.
+      // the tensor pointer in 'prep' must not be touched after this.
+      if (ctx != nullptr) {
+        ORT_RETURN_IF_ERROR(ctx->ReleaseConsumedInput(input_index));
+      }
+
+      initial_output_offset += input_axis_pitch;
+    }
+
+    return Status::OK();
+  }
+
+  // Flatten the work into one chunk per 'input_axis_pitch' run across all inputs and
+  // partition it over the intra-op pool, so the copy parallelizes both across the
+  // (possibly many small) inputs and across the chunks of large inputs. As a side effect
+  // each worker first-touches the output pages it writes, which places them on that
+  // worker's NUMA node for the downstream ops the pool runs with the same partitioning.
+  // TODO: Optimization possibility: There are cases where we simply need to "merge" raw buffers and this
+  // could be done without the pointer house-keeping as below. Some scenarios whether this is possible are:
+  // 1) Concatenating on input axis = 0
+  // 2) Stacking on output axis = 0
+  // 3) Stacking scalars
+  std::vector<int64_t> input_output_offsets(input_count);  // initial output offset for each input, in elements
+  std::vector<int64_t> chunk_count_prefix(input_count + 1, 0);
+  int64_t initial_output_offset = 0;
+  int64_t total_bytes = 0;
+  for (int input_index = 0; input_index < input_count; input_index++) {
+    const auto& prep = p.inputs[input_index];
+    input_output_offsets[input_index] = initial_output_offset;
+
+    int64_t num_chunks = 0;
+    if (prep.num_elements != 0) {
+      num_chunks = prep.num_elements / prep.axis_pitch;
+      total_bytes += prep.num_elements * element_bytes;
+      initial_output_offset += prep.axis_pitch;
     }
 
-    initial_output_offset += input_axis_pitch;
+    chunk_count_prefix[input_index + 1] = chunk_count_prefix[input_index] + num_chunks;
+  }
+
+  const int64_t total_chunks = chunk_count_prefix[input_count];
+  if (total_chunks > 0) {
+    uint8_t* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
+    concurrency::ThreadPool* tp = ctx != nullptr ? ctx->GetOperatorThreadPool() : nullptr;
+
+    auto copy_chunks = [&](ptrdiff_t first, ptrdiff_t last) {
+      // locate the input holding the first chunk of this partition, then walk forwards
+      int input_index = static_cast<int>(
+          std::upper_bound(chunk_count_prefix.cbegin(), chunk_count_prefix.cend(), first) -
+          chunk_count_prefix.cbegin() - 1);
+
+      for (int64_t chunk = first; chunk < last; ++chunk) {
+        while (chunk >= chunk_count_prefix[input_index + 1])
+          ++input_index;
+
+        const auto& prep = p.inputs[input_index];
+        const int64_t idx_copy = chunk - chunk_count_prefix[input_index];
+        const uint8_t* input = static_cast<const uint8_t*>(prep.tensor->DataRaw());
+
+        memcpy(output + (input_output_offsets[input_index] + idx_copy * p.output_axis_pitch) * element_bytes,
+               input + idx_copy * prep.axis_pitch * element_bytes,
+               prep.axis_pitch * element_bytes);
+      }
+    };
+
+    concurrency::ThreadPool::TryParallelFor(tp, total_chunks,
+                                            static_cast<double>(total_bytes) / total_chunks, copy_chunks);
+  }
+
+  // every input has been copied to the output in full. for each one where we are the last
+  // consumer, hand its buffer back now. the tensor pointers in 'p.inputs' must not be
+  // touched after this.
+  if (ctx != nullptr) {
+    for (int input_index = 0; input_index < input_count; input_index++) {
+      if (p.inputs[input_index].num_elements == 0)
+        continue;
+
+      ORT_RETURN_IF_ERROR(ctx->ReleaseConsumedInput(input_index));
+    }
   }
 
   return Status::OK();
@@ -232,7 +303,7 @@ Status Concat::Compute(OpKernelContext* ctx) const {
     return Status::OK();
 
   // Compute values to be placed in the output tensor
-  return ComputeImpl(p);
+  return ComputeImpl(p, ctx);
 }
 
 }  // namespace onnxruntime
@@ -44,7 +44,10 @@ class ConcatBase {
   Status PrepareForCompute(OpKernelContext* ctx, const std::vector<const Tensor*>& input_tensors,
                            Prepare& p) const;
 
-  Status ComputeImpl(Prepare& p) const;
+  // 'ctx' is optional. When provided, each input declared consumed-after-read is handed back to
+  // the execution frame as soon as its data has been copied to the output, so the inputs of a
+  // many-way concat are freed one by one instead of all staying live until the node completes.
+  Status ComputeImpl(Prepare& p, OpKernelContext* ctx = nullptr) const;
 
   int64_t axis_;
   bool is_stack_ = false;
@@ -32,35 +32,14 @@ Status DynamicQuantizeLinear<T>::Compute(OpKernelContext* ctx) const {
   auto& y_scale = *ctx->Output(1, shape);
   auto& y_zeropoint = *ctx->Output(2, shape);
 
-  // find quantization range min and max
-  float qmax = std::numeric_limits<T>::max();
-  float qmin = std::numeric_limits<T>::min();
-  // Adjust the int8 range to -127 to 127 so that zero point can be 0
-  if (qmin == -128) {
-    qmin = -127;
-  }
-
-  // find input range min and max
-  float min, max;
-  MlasFindMinMaxElement(x_data, &min, &max, num_of_elements);
-
-  // ensure the input range includes zero
-  min = std::min(min, 0.0f);
-  max = std::max(max, 0.0f);
-
-  // find scale and zero point
-  auto scale = (max - min) / (qmax - qmin);
-  auto* output_scale = y_scale.template MutableData<float>();
-  *output_scale = scale;
-
-  const auto initial_zero_point = qmin - min / scale;
-  auto zero_point = static_cast<T>(RoundHalfToEven(std::max(qmin, std::min(qmax, initial_zero_point))));
-  auto* output_zp = y_zeropoint.template MutableData<T>();
-  *output_zp = zero_point;
-
-  // quantize the data
+  // compute the quantization range and parameters and quantize in one call
+  float scale;
+  T zero_point;
   auto* output = y.template MutableData<T>();
-  MlasQuantizeLinear(x_data, output, num_of_elements, scale, zero_point);
+  MlasDynamicQuantizeLinear(x_data, output, num_of_elements, &scale, &zero_point);
+
+  *y_scale.template MutableData<float>() = scale;
+  *y_zeropoint.template MutableData<T>() = zero_point;
 
   return Status::OK();
 }
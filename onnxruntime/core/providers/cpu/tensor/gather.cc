@@ -3,6 +3,9 @@
 
 //https://github.com/onnx/onnx/blob/master/docs/Operators.md#Gather
 #include "core/providers/cpu/tensor/gather.h"
+
+#include <algorithm>
+
 #include "core/common/common.h"
 #include "core/platform/threadpool.h"
 
@@ -83,30 +86,71 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
     }
   }
 
-  auto lambda = [&](int64_t index) {
-    int64_t batch = index / N;
-    int64_t i = index % N;
+  if (is_string_type) {
+    auto lambda = [&](int64_t index) {
+      int64_t batch = index / N;
+      int64_t i = index % N;
 
-    const int64_t src_offset_batch = batch * data_batch_bytes;
-    const int64_t dst_offset_batch = batch * gathered_batch_bytes;
-    Tin idx = indices_data[i];
-    idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
-    const int64_t src_offset = src_offset_batch + idx * block_size;
-    const int64_t dst_offset = dst_offset_batch + i * block_size;
+      const int64_t src_offset_batch = batch * data_batch_bytes;
+      const int64_t dst_offset_batch = batch * gathered_batch_bytes;
+      Tin idx = indices_data[i];
+      idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
+      const int64_t src_offset = src_offset_batch + idx * block_size;
+      const int64_t dst_offset = dst_offset_batch + i * block_size;
 
-    if (is_string_type) {
       reinterpret_cast<std::string*>(dst_base)[dst_offset / element_bytes] =
           reinterpret_cast<const std::string*>(src_base)[src_offset / element_bytes];
-    } else {
-      memcpy(dst_base + dst_offset, src_base + src_offset, block_size);
+    };
+    concurrency::ThreadPool::TryParallelFor(tp, M * N, static_cast<double>(block_size),
+                                            [&lambda](ptrdiff_t first, ptrdiff_t last) {
+                                              for (int64_t index = first, end = last; index < end; ++index) {
+                                                lambda(index);
+                                              }
+                                            });
+
+    return Status::OK();
+  }
+
+  // The destination is contiguous in i, so a run of consecutive indices reads a contiguous
+  // source range as well and the whole run collapses into one memcpy. Embedding style lookups
+  // (sorted or range indices over large tables) then move data at memcpy bandwidth instead of
+  // paying the per-slice loop and call overhead.
+  auto copy_slices = [&](ptrdiff_t first, ptrdiff_t last) {
+    int64_t index = first;
+    while (index < last) {
+      const int64_t batch = index / N;
+      int64_t i = index % N;
+
+      // stay within both the partition and the current batch
+      const int64_t run_limit = std::min(static_cast<int64_t>(last), (batch + 1) * N);
+
+      const int64_t src_offset_batch = batch * data_batch_bytes;
+      const int64_t dst_offset_batch = batch * gathered_batch_bytes;
+
+      while (index < run_limit) {
+        Tin idx = indices_data[i];
+        idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
+
+        int64_t run_length = 1;
+        while (index + run_length < run_limit) {
+          Tin next_idx = indices_data[i + run_length];
+          next_idx = next_idx < 0 ? next_idx + static_cast<Tin>(axis_dim_limit) : next_idx;
+          if (static_cast<int64_t>(next_idx) != static_cast<int64_t>(idx) + run_length) {
+            break;
+          }
+          ++run_length;
+        }
+
+        memcpy(dst_base + dst_offset_batch + i * block_size,
+               src_base + src_offset_batch + idx * block_size,
+               run_length * block_size);
+
+        index += run_length;
+        i += run_length;
+      }
     }
   };
-  concurrency::ThreadPool::TryParallelFor(tp, M * N, static_cast<double>(block_size),
-                                          [&lambda](ptrdiff_t first, ptrdiff_t last) {
-                                            for (int index = static_cast<int>(first), end = static_cast<int>(last); index < end; ++index) {
-                                              lambda(index);
-                                            }
-                                          });
+  concurrency::ThreadPool::TryParallelFor(tp, M * N, static_cast<double>(block_size), copy_slices);
 
   return Status::OK();
 }
@@ -3,10 +3,11 @@
 
 #include "core/providers/cpu/tensor/nonzero_op.h"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
-#include "core/util/math_cpuonly.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 // kernel builder functions
@@ -59,59 +60,87 @@ Status NonZero<T>::Compute(OpKernelContext* context) const {
   const auto& X_shape = X->Shape();
   assert(X_shape.Size() >= 0);
 
-  const Eigen::Index coordinate_size = X_shape.IsScalar() ? 1 : X_shape.NumDimensions();
-  std::vector<int64_t> non_zero_indices_buffer{};
-  // reserve enough space for indices for every element of X
-  non_zero_indices_buffer.reserve(X_shape.Size() * coordinate_size);
-
+  const int64_t coordinate_size = X_shape.IsScalar() ? 1 : X_shape.NumDimensions();
   const T* data = X->Data<T>();
 
   if (X_shape.IsScalar()) {
-    const T& value = *data;
-    if (value != T{}) {
-      non_zero_indices_buffer.push_back(0);
-    }
-  } else {
-    std::vector<int64_t> coordinate(coordinate_size, 0);
-
-    // as we iterate the entries, increment the coordinate for the current entry
-    // e.g. if shape is {2,2}, we start with 0,0 increment to 0,1 increment to 1,0 and finally 1,1
-    auto increment_coordinate = [&coordinate, &coordinate_size, &X_shape]() {
-      for (int64_t idx = coordinate_size - 1; idx >= 0; --idx) {
-        int64_t& cur_coord = coordinate[idx];
-        if (cur_coord != X_shape[idx] - 1) {
-          ++cur_coord;
-          break;
-        }
-        cur_coord = 0;
-      }
-    };
-
-    for (size_t i = 0, end = X_shape.Size(); i < end; ++i) {
-      const T& value = *data++;
-      if (value != T{}) {
-        non_zero_indices_buffer.insert(non_zero_indices_buffer.end(),
-                                       coordinate.begin(), coordinate.end());
-      }
-
-      increment_coordinate();
+    const int64_t num_non_zero_values = (*data != T{}) ? 1 : 0;
+    Tensor* const Y = context->Output(0, {coordinate_size, num_non_zero_values});
+    ORT_ENFORCE(Y, "failed to get first output!");
+    if (num_non_zero_values == 1) {
+      *Y->MutableData<int64_t>() = 0;
     }
+    return Status::OK();
+  }
+
+  const int64_t total = X_shape.Size();
+  if (total == 0) {
+    ORT_ENFORCE(context->Output(0, {coordinate_size, 0}), "failed to get first output!");
+    return Status::OK();
   }
 
-  const Eigen::Index num_non_zero_values = non_zero_indices_buffer.size() / coordinate_size;
+  // Collect the flat indices of the non-zero values in one pass, chunked across the pool.
+  // Each chunk fills its own buffer, so the only coordination is the prefix sum over the
+  // chunk counts that places each chunk's slice in the output.
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+  constexpr int64_t kMinChunkSize = 16384;
+  const int64_t num_chunks = std::min<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(tp),
+                                               std::max<int64_t>(total / kMinChunkSize, 1));
+  const int64_t chunk_size = (total + num_chunks - 1) / num_chunks;
+
+  // Sizing the buffers from the previous Run's count means a steady-state caller
+  // (e.g. a mask with a stable density) never re-grows them.
+  const int64_t count_hint = non_zero_count_hint_.load(std::memory_order_relaxed);
+  const int64_t chunk_reserve = std::min(count_hint / num_chunks + 16, chunk_size);
+
+  std::vector<std::vector<int64_t>> chunk_flat_indices(num_chunks);
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_chunks),
+      [&](std::ptrdiff_t chunk) {
+        const int64_t begin = chunk * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, total);
+        auto& flat_indices = chunk_flat_indices[chunk];
+        flat_indices.reserve(chunk_reserve);
+        for (int64_t i = begin; i < end; ++i) {
+          if (data[i] != T{}) {
+            flat_indices.push_back(i);
+          }
+        }
+      });
+
+  // stitch the chunks together with a prefix sum over their counts
+  std::vector<int64_t> chunk_output_offsets(num_chunks, 0);
+  int64_t num_non_zero_values = 0;
+  for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    chunk_output_offsets[chunk] = num_non_zero_values;
+    num_non_zero_values += chunk_flat_indices[chunk].size();
+  }
 
-  // transpose result for output
-  ConstEigenMatrixMapRowMajor<int64_t> non_zero_indices_matrix{
-      non_zero_indices_buffer.data(),
-      num_non_zero_values, coordinate_size};
+  non_zero_count_hint_.store(num_non_zero_values, std::memory_order_relaxed);
 
   Tensor* const Y = context->Output(0, {coordinate_size, num_non_zero_values});
   ORT_ENFORCE(Y, "failed to get first output!");
+  int64_t* const y_data = Y->MutableData<int64_t>();
 
-  EigenMatrixMapRowMajor<int64_t> y_matrix{
-      Y->MutableData<int64_t>(),
-      coordinate_size, num_non_zero_values};
-  y_matrix = non_zero_indices_matrix.transpose();
+  // number of elements under each dimension, used to decode a flat index into coordinates
+  std::vector<int64_t> strides(coordinate_size);
+  for (int64_t dim = 0; dim < coordinate_size; ++dim) {
+    strides[dim] = X_shape.SizeFromDimension(dim + 1);
+  }
+
+  // decode each chunk's flat indices straight into the transposed output layout
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_chunks),
+      [&](std::ptrdiff_t chunk) {
+        int64_t column = chunk_output_offsets[chunk];
+        for (int64_t flat_index : chunk_flat_indices[chunk]) {
+          for (int64_t dim = 0; dim < coordinate_size; ++dim) {
+            y_data[dim * num_non_zero_values + column] = flat_index / strides[dim];
+            flat_index %= strides[dim];
+          }
+          ++column;
+        }
+      });
 
   return Status::OK();
 }
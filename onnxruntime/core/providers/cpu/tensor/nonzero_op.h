@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
 
@@ -13,5 +15,10 @@ class NonZero : public OpKernel {
   explicit NonZero(const OpKernelInfo& info) : OpKernel{info} {}
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  // Number of non-zero values found by the previous Run. Used to size the per-chunk
+  // index buffers so steady-state calls (same mask density every frame) don't re-grow them.
+  mutable std::atomic<int64_t> non_zero_count_hint_{0};
 };
 }  // namespace onnxruntime
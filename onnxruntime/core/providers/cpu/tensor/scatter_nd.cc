@@ -3,6 +3,8 @@
 
 #include "scatter_nd.h"
 #include "core/platform/threadpool.h"
+#include <algorithm>
+#include <atomic>
 
 namespace onnxruntime {
 
@@ -78,6 +80,8 @@ Status ScatterNDBase::PrepareForCompute(OpKernelContext* context, Prepare& p) co
   auto* dst_base = output_tensor->MutableDataRaw();
   const bool is_string_type = input_tensor->IsDataTypeString();
 
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+
   // Re-use input for output. If input/output Tensor* are the same, do not copy.
   if (src_base != dst_base) {
     if (is_string_type) {
@@ -86,7 +90,20 @@ Status ScatterNDBase::PrepareForCompute(OpKernelContext* context, Prepare& p) co
       auto* dst = output_tensor->template MutableData<std::string>();
       std::copy(str_begin, str_end, dst);
     } else {
-      memcpy(dst_base, src_base, input_tensor->SizeInBytes());
+      // Clone the input in independent blocks so a large initial copy also spreads across the pool
+      constexpr int64_t kCopyBlockSize = 1048576;
+      const int64_t total_bytes = static_cast<int64_t>(input_tensor->SizeInBytes());
+      const int64_t num_blocks = (total_bytes + kCopyBlockSize - 1) / kCopyBlockSize;
+      concurrency::ThreadPool::TryParallelFor(tp, static_cast<std::ptrdiff_t>(num_blocks),
+                                              static_cast<double>(kCopyBlockSize),
+                                              [&](ptrdiff_t first, ptrdiff_t last) {
+                                                for (int64_t b = first; b < last; ++b) {
+                                                  const int64_t offset = b * kCopyBlockSize;
+                                                  memcpy(static_cast<uint8_t*>(dst_base) + offset,
+                                                         static_cast<const uint8_t*>(src_base) + offset,
+                                                         std::min(kCopyBlockSize, total_bytes - offset));
+                                                }
+                                              });
     }
   }
 
@@ -112,15 +129,25 @@ Status ScatterNDBase::PrepareForCompute(OpKernelContext* context, Prepare& p) co
     p.output_base = static_cast<uint8_t*>(output_tensor->MutableDataRaw());
   }
 
-  for (int64_t i = 0; i < offset_count; ++i) {
-    for (int64_t j = 0; j < last_indice_dimension; ++j) {
-      auto indice = *(indice_offset + i * last_indice_dimension + j);
-      if (indice < 0 || indice >= input_shape[j]) {
-        err_indice = indice;
-      }
-      p.element_offsets[i] += indice * element_counts[j];
-    }
-  }
+  // Each update's destination offset only depends on its own indices, so flattening them is
+  // embarrassingly parallel - with millions of updates this loop dominates the preparation time.
+  std::atomic<int64_t> bad_indice{0};
+  concurrency::ThreadPool::TryParallelFor(tp, static_cast<std::ptrdiff_t>(offset_count),
+                                          static_cast<double>(last_indice_dimension) * 2.0,
+                                          [&](ptrdiff_t first, ptrdiff_t last) {
+                                            for (int64_t i = first; i < last; ++i) {
+                                              int64_t offset = 0;
+                                              for (int64_t j = 0; j < last_indice_dimension; ++j) {
+                                                auto indice = *(indice_offset + i * last_indice_dimension + j);
+                                                if (indice < 0 || indice >= input_shape[j]) {
+                                                  bad_indice.store(indice, std::memory_order_relaxed);
+                                                }
+                                                offset += indice * element_counts[j];
+                                              }
+                                              p.element_offsets[i] = offset;
+                                            }
+                                          });
+  err_indice = bad_indice.load();
   return err_indice == 0 ? Status::OK() : ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "invalid indice found, indice = ", err_indice);
 }
 
@@ -14,13 +14,16 @@ namespace onnxruntime {
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Slice,
     1, 9,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
+    KernelDefBuilder()
+        .MaySliceView(0, 0)
+        .TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
     Slice1);
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Slice,
     10, 10,
     KernelDefBuilder()
+        .MaySliceView(0, 0)
         .TypeConstraint("T", DataTypeImpl::AllTensorTypes())
         .TypeConstraint("Tind", {DataTypeImpl::GetTensorType<int32_t>(),
                                  DataTypeImpl::GetTensorType<int64_t>()}),
@@ -31,6 +34,7 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     11,
     12,
     KernelDefBuilder()
+        .MaySliceView(0, 0)
         .TypeConstraint("T", DataTypeImpl::AllTensorTypes())
         .TypeConstraint("Tind", {DataTypeImpl::GetTensorType<int32_t>(),
                                  DataTypeImpl::GetTensorType<int64_t>()}),
@@ -40,6 +44,7 @@ ONNX_CPU_OPERATOR_KERNEL(
     Slice,
     13,
     KernelDefBuilder()
+        .MaySliceView(0, 0)
         .TypeConstraint("T", DataTypeImpl::AllTensorTypes())
         .TypeConstraint("Tind", {DataTypeImpl::GetTensorType<int32_t>(),
                                  DataTypeImpl::GetTensorType<int64_t>()}),
@@ -94,6 +99,54 @@ static void FlattenOutputDims(const std::vector<int64_t>& input_dimensions,
   }
 }
 
+// Check whether the slice selects a single contiguous block of the input, so the output can be
+// handed out as a zero-copy view over the input's buffer. That holds when all steps are 1 and at
+// most one axis is restricted, with only size-1 dimensions before that axis. Sets the byte offset
+// of the block within the input on success.
+// Note that PrepareForCompute may have flattened trailing dims, shrinking starts_/steps_; the
+// dropped entries are always 0/1 so missing trailing entries are treated as unrestricted.
+static bool CanUseSliceView(const std::vector<int64_t>& input_dimensions,
+                            const SliceOp::PrepareForComputeMetadata& compute_metadata,
+                            size_t element_size,
+                            ptrdiff_t& byte_offset) {
+  for (int64_t step : compute_metadata.steps_) {
+    if (step != 1)
+      return false;
+  }
+
+  int64_t restricted_axis = -1;
+  for (size_t i = 0, end = input_dimensions.size(); i < end; ++i) {
+    const int64_t start = i < compute_metadata.starts_.size() ? compute_metadata.starts_[i] : 0;
+    if (start != 0 || compute_metadata.output_dims_[i] != input_dimensions[i]) {
+      if (restricted_axis != -1)
+        return false;  // more than one restricted axis - the selected elements are not contiguous
+      restricted_axis = static_cast<int64_t>(i);
+    }
+  }
+
+  if (restricted_axis == -1) {
+    // nothing is sliced away - the view covers the whole input
+    byte_offset = 0;
+    return true;
+  }
+
+  int64_t outer_size = 1;
+  for (int64_t i = 0; i < restricted_axis; ++i)
+    outer_size *= input_dimensions[i];
+
+  // with anything above the restricted axis the selected rows are scattered through the input
+  if (outer_size != 1)
+    return false;
+
+  int64_t inner_size = 1;
+  for (size_t i = static_cast<size_t>(restricted_axis) + 1; i < input_dimensions.size(); ++i)
+    inner_size *= input_dimensions[i];
+
+  byte_offset = static_cast<ptrdiff_t>(compute_metadata.starts_[restricted_axis] * inner_size *
+                                       static_cast<int64_t>(element_size));
+  return true;
+}
+
 // Slice V1-9 & DynamicSlice
 Status SliceBase::PrepareForCompute(const std::vector<int64_t>& raw_starts,
                                     const std::vector<int64_t>& raw_ends,
@@ -338,6 +391,15 @@ Status SliceBase::Compute(OpKernelContext* ctx) const {
     ORT_RETURN_IF_ERROR(PrepareForCompute(attr_starts_, attr_ends_, attr_axes_, compute_metadata));
   }
 
+  // zero-copy fast path: a contiguous slice can be returned as a view over the input's buffer
+  if (!input_tensor.IsDataTypeString()) {
+    ptrdiff_t view_byte_offset = 0;
+    if (CanUseSliceView(input_dimensions, compute_metadata, input_tensor.DataType()->Size(), view_byte_offset) &&
+        ctx->TryOutputSliceView(0, 0, view_byte_offset, TensorShape(compute_metadata.output_dims_)) != nullptr) {
+      return Status::OK();
+    }
+  }
+
   Status status = Status::OK();
 
   if (input_tensor.IsDataTypeString()) {
@@ -14,12 +14,14 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Split,
     2,
     10,
-    KernelDefBuilder().TypeConstraint("T",
-                                      std::vector<MLDataType>{
-                                          DataTypeImpl::GetTensorType<float>(),
-                                          DataTypeImpl::GetTensorType<int32_t>(),
-                                          DataTypeImpl::GetTensorType<int64_t>(),
-                                          DataTypeImpl::GetTensorType<std::string>()}),
+    KernelDefBuilder()
+        .MaySliceView(0, -1)
+        .TypeConstraint("T",
+                        std::vector<MLDataType>{
+                            DataTypeImpl::GetTensorType<float>(),
+                            DataTypeImpl::GetTensorType<int32_t>(),
+                            DataTypeImpl::GetTensorType<int64_t>(),
+                            DataTypeImpl::GetTensorType<std::string>()}),
     Split);
 
 // Opset 11 starts to support Neg Axis.
@@ -27,24 +29,28 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Split,
     11,
     12,
-    KernelDefBuilder().TypeConstraint("T",
-                                      std::vector<MLDataType>{
-                                          DataTypeImpl::GetTensorType<float>(),
-                                          DataTypeImpl::GetTensorType<int32_t>(),
-                                          DataTypeImpl::GetTensorType<int64_t>(),
-                                          DataTypeImpl::GetTensorType<std::string>()}),
+    KernelDefBuilder()
+        .MaySliceView(0, -1)
+        .TypeConstraint("T",
+                        std::vector<MLDataType>{
+                            DataTypeImpl::GetTensorType<float>(),
+                            DataTypeImpl::GetTensorType<int32_t>(),
+                            DataTypeImpl::GetTensorType<int64_t>(),
+                            DataTypeImpl::GetTensorType<std::string>()}),
     Split);
 
 // Opset 13 starts to supports 'split' as optional input.
 ONNX_CPU_OPERATOR_KERNEL(
     Split,
     13,
-    KernelDefBuilder().TypeConstraint("T",
-                                      std::vector<MLDataType>{
-                                          DataTypeImpl::GetTensorType<float>(),
-                                          DataTypeImpl::GetTensorType<int32_t>(),
-                                          DataTypeImpl::GetTensorType<int64_t>(),
-                                          DataTypeImpl::GetTensorType<std::string>()}),
+    KernelDefBuilder()
+        .MaySliceView(0, -1)
+        .TypeConstraint("T",
+                        std::vector<MLDataType>{
+                            DataTypeImpl::GetTensorType<float>(),
+                            DataTypeImpl::GetTensorType<int32_t>(),
+                            DataTypeImpl::GetTensorType<int64_t>(),
+                            DataTypeImpl::GetTensorType<std::string>()}),
     Split);
 
 Status SplitBase::PrepareForCompute(const TensorShape& input_shape, int num_outputs, int64_t& axis, int& before_dims,
@@ -153,11 +159,23 @@ Status Split::ComputeImpl(OpKernelContext& context, const Tensor& input) const {
   int64_t input_offset = 0;
   const T* input_data = input.template Data<T>();
 
+  // with no dimensions before the split axis each output is a contiguous slice of the input,
+  // so it can be handed out as a zero-copy view over the input's buffer
+  const bool can_use_slice_view = before_dims == 1 && !input.IsDataTypeString();
+
   for (int i = 0; i < num_outputs; ++i) {
     // update size of dimension for axis we're splitting on
     auto split_size = gsl::narrow<int>(split_sizes[i]);
     output_dimensions[axis] = split_size;
 
+    if (can_use_slice_view) {
+      const auto view_byte_offset = static_cast<ptrdiff_t>(input_offset) * static_cast<ptrdiff_t>(sizeof(T));
+      if (context.TryOutputSliceView(i, 0, view_byte_offset, TensorShape{output_dimensions}) != nullptr) {
+        input_offset += split_size * after_dims_excluding_split;
+        continue;
+      }
+    }
+
     Tensor* output = context.Output(i, TensorShape{output_dimensions});
     T* output_data = output->template MutableData<T>();
 
@@ -4,6 +4,7 @@
 #include "core/providers/cpu/tensor/transpose.h"
 #include "core/framework/utils.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
 #include "utils.h"
 
 namespace onnxruntime {
@@ -307,9 +308,23 @@ static void SimpleTransposeSingleAxisOutwards(const uint8_t* input_data, uint8_t
   }
 }
 
+static void SimpleTransposeSingleAxisOutwards(const uint32_t* input_data, uint32_t* output_data,
+                                              int64_t num_loops, int64_t num_writers,
+                                              int64_t writes_per_loop, int64_t writes_per_writer_per_loop) {
+  for (int64_t l = 0; l < num_loops; ++l) {
+    MlasTranspose(input_data,
+                  output_data,
+                  static_cast<size_t>(writes_per_writer_per_loop),
+                  static_cast<size_t>(num_writers));
+    input_data += writes_per_loop;
+    output_data += writes_per_loop;
+  }
+}
+
 //  `input_shape_override` overrides the shape of `input` for compute purposes.
 static void TransposeSingleAxisOutwards(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                                        int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr) {
+                                        int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr,
+                                        concurrency::ThreadPool* tp = nullptr) {
   ORT_UNUSED_PARAMETER(permutations);
 
   const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
@@ -327,51 +342,67 @@ static void TransposeSingleAxisOutwards(const std::vector<size_t>& permutations,
   auto writes_per_writer_per_loop = int64_t(writes_per_loop / num_writers);
   const int64_t bytes_per_write = block_size * element_size;
 
-  switch (bytes_per_write) {
-    case (sizeof(uint8_t)): {
-      SimpleTransposeSingleAxisOutwards(input_data, output_data,
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
-    }
-    case (sizeof(uint16_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint16_t*>(input_data),
-                                        reinterpret_cast<uint16_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
-    }
-    case (sizeof(uint32_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint32_t*>(input_data),
-                                        reinterpret_cast<uint32_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
-    }
-    case (sizeof(uint64_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint64_t*>(input_data),
-                                        reinterpret_cast<uint64_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
-    }
-    default: {
-      // we need to use memcpy for each block
-      for (int64_t l = 0; l < num_loops; ++l) {
-        uint8_t* output_for_first_writer = output_data;
-
-        for (auto wwpl = 0; wwpl < writes_per_writer_per_loop; ++wwpl) {
-          uint8_t* output_for_current_writer = output_for_first_writer;
-
-          for (int64_t w = 0; w < num_writers; ++w) {
-            memcpy(output_for_current_writer, input_data, bytes_per_write);
-            // skip to output position for next writer
-            output_for_current_writer += (writes_per_writer_per_loop * bytes_per_write);
-            input_data += bytes_per_write;
+  // The blocked 2D transpose of each outer loop iteration is independent, so
+  // a range of iterations can execute on each worker thread.
+  auto transpose_loops = [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+    const uint8_t* loop_input_data = input_data + first * writes_per_loop * element_size;
+    uint8_t* loop_output_data = output_data + first * writes_per_loop * element_size;
+    const int64_t loop_count = last - first;
+
+    switch (bytes_per_write) {
+      case (sizeof(uint8_t)): {
+        SimpleTransposeSingleAxisOutwards(loop_input_data, loop_output_data,
+                                          loop_count, num_writers, writes_per_loop, writes_per_writer_per_loop);
+        break;
+      }
+      case (sizeof(uint16_t)): {
+        SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint16_t*>(loop_input_data),
+                                          reinterpret_cast<uint16_t*>(loop_output_data),
+                                          loop_count, num_writers, writes_per_loop, writes_per_writer_per_loop);
+        break;
+      }
+      case (sizeof(uint32_t)): {
+        SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint32_t*>(loop_input_data),
+                                          reinterpret_cast<uint32_t*>(loop_output_data),
+                                          loop_count, num_writers, writes_per_loop, writes_per_writer_per_loop);
+        break;
+      }
+      case (sizeof(uint64_t)): {
+        SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint64_t*>(loop_input_data),
+                                          reinterpret_cast<uint64_t*>(loop_output_data),
+                                          loop_count, num_writers, writes_per_loop, writes_per_writer_per_loop);
+        break;
+      }
+      default: {
+        // we need to use memcpy for each block
+        for (int64_t l = 0; l < loop_count; ++l) {
+          uint8_t* output_for_first_writer = loop_output_data;
+
+          for (auto wwpl = 0; wwpl < writes_per_writer_per_loop; ++wwpl) {
+            uint8_t* output_for_current_writer = output_for_first_writer;
+
+            for (int64_t w = 0; w < num_writers; ++w) {
+              memcpy(output_for_current_writer, loop_input_data, bytes_per_write);
+              // skip to output position for next writer
+              output_for_current_writer += (writes_per_writer_per_loop * bytes_per_write);
+              loop_input_data += bytes_per_write;
+            }
+
+            output_for_first_writer += bytes_per_write;
           }
 
-          output_for_first_writer += bytes_per_write;
+          loop_output_data += writes_per_loop * bytes_per_write;
         }
-
-        output_data += writes_per_loop * bytes_per_write;
       }
     }
+  };
+
+  if (tp != nullptr && num_loops > 1) {
+    const double cost_per_loop = static_cast<double>(writes_per_loop) * element_size;
+    concurrency::ThreadPool::TryParallelFor(tp, static_cast<std::ptrdiff_t>(num_loops), cost_per_loop,
+                                            transpose_loops);
+  } else {
+    transpose_loops(0, static_cast<std::ptrdiff_t>(num_loops));
   }
 }
 
@@ -411,10 +442,24 @@ static void SimpleTransposeSingleAxisInwards(const uint8_t* input_data, uint8_t*
   }
 }
 
+static void SimpleTransposeSingleAxisInwards(const uint32_t* input_data, uint32_t* output_data,
+                                             int64_t num_loops, int64_t num_readers,
+                                             int64_t reads_per_loop, int64_t reads_per_reader_per_loop) {
+  for (int64_t l = 0; l < num_loops; ++l) {
+    MlasTranspose(input_data,
+                  output_data,
+                  static_cast<size_t>(num_readers),
+                  static_cast<size_t>(reads_per_reader_per_loop));
+    input_data += reads_per_loop;
+    output_data += reads_per_loop;
+  }
+}
+
 // moving a single axis inwards where the read/write size is a power of 2 and between 8 and 64 bits.
 //  `input_shape_override` overrides the shape of `input` for compute purposes.
 static void TransposeSingleAxisInwards(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                                       int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr) {
+                                       int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr,
+                                       concurrency::ThreadPool* tp = nullptr) {
   ORT_UNUSED_PARAMETER(permutations);
 
   const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
@@ -432,62 +477,79 @@ static void TransposeSingleAxisInwards(const std::vector<size_t>& permutations,
   auto reads_per_reader_per_loop = int64_t(reads_per_loop / num_readers);
   const int64_t bytes_per_read = block_size * element_size;
 
-  switch (bytes_per_read) {
-    case (sizeof(uint8_t)): {
-      SimpleTransposeSingleAxisInwards(input_data, output_data,
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint16_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint16_t*>(input_data),
-                                       reinterpret_cast<uint16_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint32_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint32_t*>(input_data),
-                                       reinterpret_cast<uint32_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint64_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint64_t*>(input_data),
-                                       reinterpret_cast<uint64_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    default: {
-      // we need to use memcpy for each block
-      for (int64_t l = 0; l < num_loops; ++l) {
-        const uint8_t* input_for_first_reader = input_data;
+  // The blocked 2D transpose of each outer loop iteration is independent, so
+  // a range of iterations can execute on each worker thread.
+  auto transpose_loops = [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+    const uint8_t* loop_input_data = input_data + first * reads_per_loop * element_size;
+    uint8_t* loop_output_data = output_data + first * reads_per_loop * element_size;
+    const int64_t loop_count = last - first;
+
+    switch (bytes_per_read) {
+      case (sizeof(uint8_t)): {
+        SimpleTransposeSingleAxisInwards(loop_input_data, loop_output_data,
+                                         loop_count, num_readers, reads_per_loop, reads_per_reader_per_loop);
+        break;
+      }
+      case (sizeof(uint16_t)): {
+        SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint16_t*>(loop_input_data),
+                                         reinterpret_cast<uint16_t*>(loop_output_data),
+                                         loop_count, num_readers, reads_per_loop, reads_per_reader_per_loop);
+        break;
+      }
+      case (sizeof(uint32_t)): {
+        SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint32_t*>(loop_input_data),
+                                         reinterpret_cast<uint32_t*>(loop_output_data),
+                                         loop_count, num_readers, reads_per_loop, reads_per_reader_per_loop);
+        break;
+      }
+      case (sizeof(uint64_t)): {
+        SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint64_t*>(loop_input_data),
+                                         reinterpret_cast<uint64_t*>(loop_output_data),
+                                         loop_count, num_readers, reads_per_loop, reads_per_reader_per_loop);
+        break;
+      }
+      default: {
+        // we need to use memcpy for each block
+        for (int64_t l = 0; l < loop_count; ++l) {
+          const uint8_t* input_for_first_reader = loop_input_data;
 
-        for (auto rrpl = 0; rrpl < reads_per_reader_per_loop; ++rrpl) {
-          const uint8_t* input_for_current_reader = input_for_first_reader;
+          for (auto rrpl = 0; rrpl < reads_per_reader_per_loop; ++rrpl) {
+            const uint8_t* input_for_current_reader = input_for_first_reader;
 
-          for (int64_t r = 0; r < num_readers; ++r) {
-            memcpy(output_data, input_for_current_reader, bytes_per_read);
-            output_data += bytes_per_read;
+            for (int64_t r = 0; r < num_readers; ++r) {
+              memcpy(loop_output_data, input_for_current_reader, bytes_per_read);
+              loop_output_data += bytes_per_read;
 
-            // skip to input position for next reader
-            input_for_current_reader += (reads_per_reader_per_loop * bytes_per_read);
+              // skip to input position for next reader
+              input_for_current_reader += (reads_per_reader_per_loop * bytes_per_read);
+            }
+
+            input_for_first_reader += bytes_per_read;
           }
 
-          input_for_first_reader += bytes_per_read;
+          loop_input_data += reads_per_loop * bytes_per_read;
         }
-
-        input_data += reads_per_loop * bytes_per_read;
       }
     }
+  };
+
+  if (tp != nullptr && num_loops > 1) {
+    const double cost_per_loop = static_cast<double>(reads_per_loop) * element_size;
+    concurrency::ThreadPool::TryParallelFor(tp, static_cast<std::ptrdiff_t>(num_loops), cost_per_loop,
+                                            transpose_loops);
+  } else {
+    transpose_loops(0, static_cast<std::ptrdiff_t>(num_loops));
   }
 }
 
 //  `input_shape_override` overrides the shape of `input` for compute purposes.
 static void SingleAxisTranspose(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                                size_t from, size_t to, const TensorShape* input_shape_override = nullptr) {
+                                size_t from, size_t to, const TensorShape* input_shape_override = nullptr,
+                                concurrency::ThreadPool* tp = nullptr) {
   if (from > to) {
-    TransposeSingleAxisOutwards(permutations, input, output, from, to, input_shape_override);
+    TransposeSingleAxisOutwards(permutations, input, output, from, to, input_shape_override, tp);
   } else {
-    TransposeSingleAxisInwards(permutations, input, output, from, to, input_shape_override);
+    TransposeSingleAxisInwards(permutations, input, output, from, to, input_shape_override, tp);
   }
 }
 
@@ -611,7 +673,7 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
   bool moving_single_axis = IsMovingSingleAxis(*p_perm, from, to);
 
   if (moving_single_axis && !X.IsDataTypeString()) {
-    SingleAxisTranspose(*p_perm, X, Y, from, to);
+    SingleAxisTranspose(*p_perm, X, Y, from, to, nullptr, ctx->GetOperatorThreadPool());
   } else {
     // fall back to default implementation
     status = DoUntypedTranspose(*p_perm, X, Y);
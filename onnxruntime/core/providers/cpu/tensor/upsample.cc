@@ -4,6 +4,7 @@
 #include "core/common/safeint.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/cpu/tensor/upsample.h"
+#include <algorithm>
 #include <sstream>
 
 using namespace onnxruntime::common;
@@ -297,69 +298,52 @@ Status UpsampleLinear(const T* input,
   return Status::OK();
 }
 
-// The following method supports a 4-D input in 'Linear mode'
-// that amounts to 'Bilinear' Upsampling/Resizing in the sense that it assumes
-// the scale values for the outermost 2 dimensions are 1.
-// This is the common use-case where the 4-D input (batched multi-channel images)
-// is usually of shape [N, C, H, W] and the scales are [1.0, 1.0, height_scale, width_scale]
-template <typename T>
-void UpsampleBilinear(int64_t batch_size,
-                      int64_t num_channels,
-                      int64_t input_height,
-                      int64_t input_width,
-                      int64_t output_height,
-                      int64_t output_width,
-                      float height_scale,
-                      float width_scale,
-                      const std::vector<float>& roi,
-                      bool use_extrapolation,
-                      float extrapolation_value,
-                      const T* XdataBase,
-                      T* YdataBase,
-                      AllocatorPtr& alloc,
-                      GetOriginalCoordinateFunc get_original_coordinate,
-                      concurrency::ThreadPool* tp) {
-  std::vector<float> y_original;
-  y_original.reserve(output_height);
-
-  std::vector<float> x_original;
-  x_original.reserve(output_width);
-
-  // For each index in the output height and output width, cache its corresponding indices in the input
-  // while multiplying it with the input stride for that dimension (cache because we don't have to re-compute
-  // each time we come across the output width/ output height value while iterating the output image tensor
-  SafeInt<size_t> idx_buffer_size = SafeInt<size_t>(2) * sizeof(int64_t) * (output_height + output_width);
-
-  // For each index in the output height and output width, cache its corresponding "weights/scales" for its
-  // corresponding indices in the input which proportionately indicates how much they will influence the final
-  // pixel value in the output
-  // (cache because we don't have to re-compute each time we come across the output width/ output height value while iterating the output image tensor
-  SafeInt<size_t> scale_buffer_size = SafeInt<size_t>(2) * sizeof(float_t) * (output_height + output_width);
-
-  // Limit number of allocations to just 1
-  auto inx_scale_data_buffer = alloc->Alloc(idx_buffer_size + scale_buffer_size);
-  BufferUniquePtr idx_scale_data_buffer_holder(inx_scale_data_buffer, BufferDeleter(alloc));
-
-  // Get pointers to appropriate memory locations in the scratch buffer
-  auto* idx_data = static_cast<int64_t*>(idx_scale_data_buffer_holder.get());
-
-  // input_width is the stride for the height dimension
-  int64_t* input_width_mul_y1 = idx_data;
-  int64_t* input_width_mul_y2 = input_width_mul_y1 + output_height;
-
-  // stride for width is 1 (no multiplication needed)
-  int64_t* in_x1 = input_width_mul_y1 + 2 * output_height;
-  int64_t* in_x2 = in_x1 + output_width;
-
-  auto* scale_data = reinterpret_cast<float*>(in_x2 + output_width);
+// Builds the per-axis interpolation tables for the 'bilinear' path.
+// For each index in the output height and output width, the tables hold its
+// corresponding indices in the input (pre-multiplied with the input stride for
+// that dimension) along with the "weights/scales" that proportionately indicate
+// how much the corresponding input pixels influence the final output pixel value
+static std::shared_ptr<const BilinearParams> BuildBilinearParams(int64_t input_height,
+                                                                 int64_t input_width,
+                                                                 int64_t output_height,
+                                                                 int64_t output_width,
+                                                                 float height_scale,
+                                                                 float width_scale,
+                                                                 const std::vector<float>& roi,
+                                                                 const GetOriginalCoordinateFunc& get_original_coordinate) {
+  auto params = std::make_shared<BilinearParams>();
+
+  params->input_height = input_height;
+  params->input_width = input_width;
+  params->output_height = output_height;
+  params->output_width = output_width;
+  params->height_scale = height_scale;
+  params->width_scale = width_scale;
+  params->roi = roi;
+
+  params->y_original.reserve(output_height);
+  params->x_original.reserve(output_width);
+
+  params->input_width_mul_y1.resize(output_height);
+  params->input_width_mul_y2.resize(output_height);
+  params->dy1.resize(output_height);
+  params->dy2.resize(output_height);
+
+  params->in_x1.resize(output_width);
+  params->in_x2.resize(output_width);
+  params->dx1.resize(output_width);
+  params->dx2.resize(output_width);
+
+  int64_t* input_width_mul_y1 = params->input_width_mul_y1.data();
+  int64_t* input_width_mul_y2 = params->input_width_mul_y2.data();
+  float* dy1 = params->dy1.data();
+  float* dy2 = params->dy2.data();
+
+  int64_t* in_x1 = params->in_x1.data();
+  int64_t* in_x2 = params->in_x2.data();
+  float* dx1 = params->dx1.data();
+  float* dx2 = params->dx2.data();
 
-  float* dy1 = scale_data;
-  float* dy2 = dy1 + output_height;
-
-  float* dx1 = dy1 + 2 * output_height;
-  float* dx2 = dx1 + output_width;
-
-  // Start processing
   auto roi_y_start = roi.size() / 2 - 2;
   auto roi_y_end = roi.size() - 2;
   for (int64_t y = 0; y < output_height; ++y) {
@@ -368,7 +352,7 @@ void UpsampleBilinear(int64_t batch_size,
                                                              static_cast<float>(output_height),
                                                              static_cast<float>(input_height),
                                                              roi[roi_y_start], roi[roi_y_end]);
-    y_original.emplace_back(in_y);
+    params->y_original.emplace_back(in_y);
     in_y = std::max(0.0f, std::min(in_y, static_cast<float>(input_height - 1)));
 
     const int64_t in_y1 = std::min(static_cast<int64_t>(in_y), input_height - 1);
@@ -394,7 +378,7 @@ void UpsampleBilinear(int64_t batch_size,
                                                             static_cast<float>(output_width),
                                                             static_cast<float>(input_width),
                                                             roi[roi_x_start], roi[roi_x_end]);
-    x_original.emplace_back(in_x);
+    params->x_original.emplace_back(in_x);
     in_x = std::max(0.0f, std::min(in_x, static_cast<float>(input_width - 1)));
 
     in_x1[x] = std::min(static_cast<int64_t>(in_x), input_width - 1);
@@ -407,40 +391,100 @@ void UpsampleBilinear(int64_t batch_size,
       dx2[x] = 0.5f;
     }
   }
-  
- for (int64_t n = 0; n < batch_size; ++n) {
-    concurrency::ThreadPool::TrySimpleParallelFor(tp, num_channels,
-                                                  [&](std::ptrdiff_t c) {
-                                                    const T* Xdata = XdataBase + (n * num_channels + c) * (input_height * input_width);
-                                                    T* Ydata = YdataBase + (n * num_channels + c) * (output_height * output_width);
-                                                    for (int64_t y = 0; y < output_height; ++y) {
-                                                      for (int64_t x = 0; x < output_width; ++x) {
-                                                        // when use_extrapolation is set and original index of x or y is out of the dim range
-                                                        // then use extrapolation_value as the output value.
-                                                        if (use_extrapolation &&
-                                                            ((y_original[y] < 0 || y_original[y] > static_cast<float>(input_height - 1)) ||
-                                                             (x_original[x] < 0 || x_original[x] > static_cast<float>(input_width - 1)))) {
-                                                          Ydata[output_width * y + x] = static_cast<T>(extrapolation_value);
-                                                          continue;
-                                                        }
 
-                                                        T X11 = Xdata[input_width_mul_y1[y] + in_x1[x]];
-                                                        T X21 = Xdata[input_width_mul_y1[y] + in_x2[x]];
-                                                        T X12 = Xdata[input_width_mul_y2[y] + in_x1[x]];
-                                                        T X22 = Xdata[input_width_mul_y2[y] + in_x2[x]];
+  return params;
+}
 
-                                                        Ydata[output_width * y + x] = static_cast<T>(dx2[x] * dy2[y] * X11 +
-                                                                                                     dx1[x] * dy2[y] * X21 +
-                                                                                                     dx2[x] * dy1[y] * X12 +
-                                                                                                     dx1[x] * dy1[y] * X22);
-                                                      }
-                                                    }
-                                                    Xdata += input_height * input_width;
-                                                    Ydata += output_width * output_height;
-                                                  });
+// The following method supports a 4-D input in 'Linear mode'
+// that amounts to 'Bilinear' Upsampling/Resizing in the sense that it assumes
+// the scale values for the outermost 2 dimensions are 1.
+// This is the common use-case where the 4-D input (batched multi-channel images)
+// is usually of shape [N, C, H, W] and the scales are [1.0, 1.0, height_scale, width_scale]
+template <typename T>
+void UpsampleBilinear(int64_t batch_size,
+                      int64_t num_channels,
+                      int64_t input_height,
+                      int64_t input_width,
+                      int64_t output_height,
+                      int64_t output_width,
+                      const BilinearParams& p,
+                      bool use_extrapolation,
+                      float extrapolation_value,
+                      const T* XdataBase,
+                      T* YdataBase,
+                      concurrency::ThreadPool* tp) {
+  // One task interpolates one output row of one channel - splitting the rows
+  // keeps all the cores busy even for 2-D inputs and 4-D inputs with few channels
+  for (int64_t n = 0; n < batch_size; ++n) {
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, num_channels * output_height,
+        [&](std::ptrdiff_t task) {
+          const int64_t c = task / output_height;
+          const int64_t y = task % output_height;
+
+          const T* Xdata = XdataBase + (n * num_channels + c) * (input_height * input_width);
+          T* Ydata = YdataBase + (n * num_channels + c) * (output_height * output_width) + output_width * y;
+
+          // when use_extrapolation is set and the original index of y is out of the dim range
+          // the whole output row takes extrapolation_value
+          if (use_extrapolation &&
+              (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1))) {
+            std::fill_n(Ydata, output_width, static_cast<T>(extrapolation_value));
+            return;
+          }
+
+          // Hoist the terms that are constant for the output row so the inner
+          // loop only indexes the x tables
+          const T* Xrow1 = Xdata + p.input_width_mul_y1[y];
+          const T* Xrow2 = Xdata + p.input_width_mul_y2[y];
+          const float dy1_y = p.dy1[y];
+          const float dy2_y = p.dy2[y];
+
+          for (int64_t x = 0; x < output_width; ++x) {
+            // when use_extrapolation is set and the original index of x is out of the dim range
+            // then use extrapolation_value as the output value.
+            if (use_extrapolation &&
+                (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1))) {
+              Ydata[x] = static_cast<T>(extrapolation_value);
+              continue;
+            }
+
+            T X11 = Xrow1[p.in_x1[x]];
+            T X21 = Xrow1[p.in_x2[x]];
+            T X12 = Xrow2[p.in_x1[x]];
+            T X22 = Xrow2[p.in_x2[x]];
+
+            Ydata[x] = static_cast<T>(p.dx2[x] * dy2_y * X11 +
+                                      p.dx1[x] * dy2_y * X21 +
+                                      p.dx2[x] * dy1_y * X12 +
+                                      p.dx1[x] * dy1_y * X22);
+          }
+        });
   }
 }
 
+// Returns the cached bilinear interpolation tables if they still apply to the given
+// shapes/scales/roi (the common case when the same image size is resized run after run),
+// re-building and re-caching them otherwise.
+// Scales and roi may be runtime inputs for Resize, hence they are part of the cache key.
+template <typename T>
+std::shared_ptr<const BilinearParams> Upsample<T>::GetBilinearParams(int64_t input_height,
+                                                                     int64_t input_width,
+                                                                     int64_t output_height,
+                                                                     int64_t output_width,
+                                                                     float height_scale,
+                                                                     float width_scale,
+                                                                     const std::vector<float>& roi) const {
+  std::lock_guard<OrtMutex> lock(bilinear_params_mutex_);
+  if (!bilinear_params_ ||
+      !bilinear_params_->Matches(input_height, input_width, output_height, output_width,
+                                 height_scale, width_scale, roi)) {
+    bilinear_params_ = BuildBilinearParams(input_height, input_width, output_height, output_width,
+                                           height_scale, width_scale, roi, get_original_coordinate_);
+  }
+  return bilinear_params_;
+}
+
 // The following method supports a 5-D input in 'Linear mode'
 // that amounts to 'Trilinear' Upsampling/Resizing in the sense that it assumes
 // the scale values for the outermost 2 dimensions are 1.
@@ -898,13 +942,12 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
         const int64_t output_height = is_2D ? output_dims[0] : output_dims[2];
         const int64_t output_width = is_2D ? output_dims[1] : output_dims[3];
 
-        AllocatorPtr alloc;
-        ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+        auto bilinear_params = GetBilinearParams(input_height, input_width, output_height, output_width,
+                                                 is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], roi);
         UpsampleBilinear(batch_size, num_channels, input_height, input_width, output_height, output_width,
-                         is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], roi,
-                         use_extrapolation_, extrapolation_value_, X->template Data<T>(),
-                         Y->template MutableData<T>(), alloc, get_original_coordinate_, 
-                         output_height*output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
+                         *bilinear_params, use_extrapolation_, extrapolation_value_, X->template Data<T>(),
+                         Y->template MutableData<T>(),
+                         output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
         return Status::OK();
       } else if (dims.size() == 3 || dims.size() == 5) {
         //'trilinear' == 3-D input or 5-D input with outermost 2 scales as 1
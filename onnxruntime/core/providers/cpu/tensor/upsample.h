@@ -4,7 +4,9 @@
 #pragma once
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include <cmath>
+#include <memory>
 
 namespace onnxruntime {
 
@@ -44,6 +46,47 @@ enum ResizeNearestMode {
   NearestModeCount = 5,
 };
 
+// Pre-computed per-axis interpolation tables for the 'bilinear' path.
+// The source offsets and weights only depend on the shapes, scales and roi -
+// not on the input data - so they are built once and cached on the kernel
+// until one of those changes (see Upsample::GetBilinearParams).
+struct BilinearParams {
+  std::vector<float> y_original;
+  std::vector<float> x_original;
+
+  // Input offsets of the two source rows contributing to each output row
+  // (the offsets are pre-multiplied by the input row stride)
+  std::vector<int64_t> input_width_mul_y1;
+  std::vector<int64_t> input_width_mul_y2;
+
+  // Input offsets of the two source columns contributing to each output column
+  std::vector<int64_t> in_x1;
+  std::vector<int64_t> in_x2;
+
+  // Interpolation weights of the source rows/columns above
+  std::vector<float> dy1;
+  std::vector<float> dy2;
+  std::vector<float> dx1;
+  std::vector<float> dx2;
+
+  // The inputs the tables were built from - used to decide whether a cached
+  // instance can be re-used for the current Run
+  int64_t input_height;
+  int64_t input_width;
+  int64_t output_height;
+  int64_t output_width;
+  float height_scale;
+  float width_scale;
+  std::vector<float> roi;
+
+  bool Matches(int64_t in_height, int64_t in_width, int64_t out_height, int64_t out_width,
+               float h_scale, float w_scale, const std::vector<float>& roi_in) const {
+    return input_height == in_height && input_width == in_width &&
+           output_height == out_height && output_width == out_width &&
+           height_scale == h_scale && width_scale == w_scale && roi == roi_in;
+  }
+};
+
 class UpsampleBase {
  protected:
   UpsampleBase(OpKernelInfo info) : scales_cached_(false), roi_cached_(false), use_extrapolation_(false) {
@@ -361,6 +404,17 @@ class Upsample : public UpsampleBase, public OpKernel {
 
   Status BaseCompute(OpKernelContext* context, const std::vector<float>& roi, const std::vector<float>& scales,
                      const std::vector<int64_t>& output_dims) const;
+
+ private:
+  // Returns the cached interpolation tables for the 'bilinear' path, rebuilding
+  // them if the shapes, scales or roi changed since the previous Run
+  std::shared_ptr<const BilinearParams> GetBilinearParams(int64_t input_height, int64_t input_width,
+                                                          int64_t output_height, int64_t output_width,
+                                                          float height_scale, float width_scale,
+                                                          const std::vector<float>& roi) const;
+
+  mutable std::shared_ptr<const BilinearParams> bilinear_params_;
+  mutable OrtMutex bilinear_params_mutex_;
 };
 
 }  // namespace onnxruntime
@@ -48,6 +48,9 @@ void CUDAAllocator::Free(void* p) {
 }
 
 FencePtr CUDAAllocator::CreateFence(const SessionState* session_state) {
+  // The fence makes buffer reuse stream-safe: the execution frame only returns a fenced buffer
+  // to the arena once the fence events have passed, so memory written on one stream is never
+  // handed to another stream while the device is still using it.
   return std::make_shared<CUDAFence>(GetGPUDataTransfer(session_state));
 }
 
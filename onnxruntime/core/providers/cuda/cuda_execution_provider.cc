@@ -57,11 +57,69 @@ ONNX_OPERATOR_KERNEL_EX(
 
 }  // namespace cuda
 
+namespace {
+// Lets the arena recycle freed device memory in stream order. Each free records a
+// pooled event on the legacy default stream, which is ordered after work submitted
+// to all other blocking streams, so a chunk only returns to the free pool once every
+// kernel that may still be reading it has completed. The arena serializes all calls
+// under its own lock, so the event pool needs no locking of its own.
+class CUDAArenaFreeGate : public IArenaFreeGate {
+ public:
+  CUDAArenaFreeGate() = default;
+
+  ~CUDAArenaFreeGate() override {
+    for (cudaEvent_t event : event_pool_) {
+      cudaEventDestroy(event);  // don't throw during shutdown
+    }
+  }
+
+  void* TagPendingWork() override {
+    cudaEvent_t event;
+    if (!event_pool_.empty()) {
+      event = event_pool_.back();
+      event_pool_.pop_back();
+    } else if (cudaEventCreateWithFlags(&event, cudaEventDisableTiming) != cudaSuccess) {
+      // fall back to recycling the chunk immediately rather than failing the free
+      return nullptr;
+    }
+
+    if (cudaEventRecord(event, nullptr) != cudaSuccess) {
+      event_pool_.push_back(event);
+      return nullptr;
+    }
+
+    return event;
+  }
+
+  bool IsTagComplete(void* tag) override {
+    // anything other than not-ready (including errors) counts as complete so a
+    // broken event cannot pin arena memory forever
+    return cudaEventQuery(static_cast<cudaEvent_t>(tag)) != cudaErrorNotReady;
+  }
+
+  void ReleaseTag(void* tag) override {
+    event_pool_.push_back(static_cast<cudaEvent_t>(tag));
+  }
+
+ private:
+  std::vector<cudaEvent_t> event_pool_;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CUDAArenaFreeGate);
+};
+}  // namespace
+
 CUDAExecutionProvider::PerThreadContext::PerThreadContext(OrtDevice::DeviceId device_id, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy) {
   CUDA_CALL_THROW(cudaSetDevice(device_id));
   CUBLAS_CALL_THROW(cublasCreate(&cublas_handle_));
   CUDNN_CALL_THROW(cudnnCreate(&cudnn_handle_));
 
+#ifdef CUDA_API_PER_THREAD_DEFAULT_STREAM
+  // the kernels are compiled for the per-thread default stream; keep the library handles on the
+  // same stream so their launches stay ordered with ours and are visible to CUDA graph capture
+  CUBLAS_CALL_THROW(cublasSetStream(cublas_handle_, cudaStreamPerThread));
+  CUDNN_CALL_THROW(cudnnSetStream(cudnn_handle_, cudaStreamPerThread));
+#endif
+
   AllocatorCreationInfo default_memory_info(
       [](OrtDevice::DeviceId id) {
         return onnxruntime::make_unique<CUDAAllocator>(id, CUDA);
@@ -74,6 +132,12 @@ CUDAExecutionProvider::PerThreadContext::PerThreadContext(OrtDevice::DeviceId de
 
   // CUDA malloc/free is expensive so always use an arena
   allocator_ = CreateAllocator(default_memory_info);
+
+  if (allocator_ && allocator_->Info().alloc_type == OrtArenaAllocator) {
+    // recycle freed chunks once the device work in flight at free time has drained,
+    // instead of relying on end-of-run synchronization to make reuse safe
+    static_cast<IArenaAllocator*>(allocator_.get())->SetFreeGate(onnxruntime::make_unique<CUDAArenaFreeGate>());
+  }
 }
 
 CUDAExecutionProvider::PerThreadContext::~PerThreadContext() {
@@ -116,6 +180,33 @@ void CUDAExecutionProvider::UpdateProviderOptionsInfo() {
   IExecutionProvider::SetProviderOptions(options);
 }
 
+// Enable peer-to-peer access from 'device_id' to every other visible device that supports
+// it (e.g. over NVLink), so cross-device copies between sessions pinned to different GPUs
+// go direct instead of staging through host memory. Enabling an already enabled pair
+// returns cudaErrorPeerAccessAlreadyEnabled, which is cleared and ignored.
+static void EnablePeerAccess(int device_id) {
+  int device_count = 0;
+  if (cudaGetDeviceCount(&device_count) != cudaSuccess) {
+    return;
+  }
+
+  for (int peer = 0; peer < device_count; ++peer) {
+    if (peer == device_id) {
+      continue;
+    }
+    int can_access_peer = 0;
+    if (cudaDeviceCanAccessPeer(&can_access_peer, device_id, peer) == cudaSuccess && can_access_peer) {
+      cudaError_t err = cudaDeviceEnablePeerAccess(peer, 0);
+      if (err == cudaErrorPeerAccessAlreadyEnabled) {
+        cudaGetLastError();  // clear the sticky error
+      } else if (err != cudaSuccess) {
+        LOGS_DEFAULT(WARNING) << "Failed to enable peer access from CUDA device " << device_id
+                              << " to device " << peer << ": " << cudaGetErrorString(err);
+      }
+    }
+  }
+}
+
 CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& info)
     : IExecutionProvider{onnxruntime::kCudaExecutionProvider},
       device_id_(info.device_id),
@@ -129,6 +220,8 @@ CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& in
   CUDA_CALL_THROW(cudaDeviceSynchronize());
   CUDA_CALL_THROW(cudaGetDeviceProperties(&device_prop_, device_id_));
 
+  EnablePeerAccess(device_id_);
+
   size_t free = 0;
   size_t total = 0;
   CUDA_CALL_THROW(cudaMemGetInfo(&free, &total));
@@ -172,6 +265,11 @@ CUDAExecutionProvider::~CUDAExecutionProvider() {
   auto cpu_alloc = GetAllocator(CPU_ALLOCATOR_DEVICE_ID, OrtMemTypeCPU);
   {
     std::lock_guard<OrtMutex> lock(deferred_release_cpu_ptr_mutex_);
+    for (auto p : captured_graph_cpu_ptrs_) {
+      cpu_alloc->Free(p);
+    }
+    captured_graph_cpu_ptrs_.clear();
+
     auto it = deferred_release_cpu_ptr_.begin();
     while (it != deferred_release_cpu_ptr_.end()) {
       auto& e = it->first;
@@ -186,6 +284,14 @@ CUDAExecutionProvider::~CUDAExecutionProvider() {
     }
   }
 
+  {
+    std::lock_guard<OrtMutex> lock(run_completion_event_mutex_);
+    if (nullptr != run_completion_event_) {
+      CUDA_CALL_THROW(cudaEventDestroy(run_completion_event_));
+      run_completion_event_ = nullptr;
+    }
+  }
+
   // clean up thread local context caches
   {
     std::lock_guard<OrtMutex> lock(context_state_.mutex);
@@ -267,7 +373,56 @@ Status CUDAExecutionProvider::Sync() const {
   return Status::OK();
 }
 
+Status CUDAExecutionProvider::RecordRunCompletion() {
+  std::lock_guard<OrtMutex> lock(run_completion_event_mutex_);
+  if (nullptr == run_completion_event_) {
+    CUDA_RETURN_IF_ERROR(cudaEventCreateWithFlags(&run_completion_event_, cudaEventDisableTiming));
+  }
+  // record on the legacy default stream: it is ordered after work submitted to all other
+  // blocking streams of this device, so the event covers the compute and copy streams
+  CUDA_RETURN_IF_ERROR(cudaEventRecord(run_completion_event_, nullptr));
+  return Status::OK();
+}
+
+Status CUDAExecutionProvider::PollRunCompletion(bool& completed) const {
+  std::lock_guard<OrtMutex> lock(run_completion_event_mutex_);
+  if (nullptr == run_completion_event_) {
+    // nothing recorded yet
+    completed = true;
+    return Status::OK();
+  }
+  cudaError_t query_status = cudaEventQuery(run_completion_event_);
+  if (cudaErrorNotReady == query_status) {
+    completed = false;
+    return Status::OK();
+  }
+  CUDA_RETURN_IF_ERROR(query_status);
+  completed = true;
+  return Status::OK();
+}
+
+Status CUDAExecutionProvider::WaitRunCompletion() const {
+  cudaEvent_t event = nullptr;
+  {
+    std::lock_guard<OrtMutex> lock(run_completion_event_mutex_);
+    event = run_completion_event_;
+  }
+  if (nullptr == event) {
+    return Status::OK();
+  }
+  CUDA_RETURN_IF_ERROR(cudaEventSynchronize(event));
+  return Status::OK();
+}
+
 void CUDAExecutionProvider::AddDeferredReleaseCPUPtr(void* p) {
+  if (graph_capture_enabled_) {
+    // a captured memcpy node references its staging buffer on every replay, so the buffer must
+    // outlive the captured graph rather than being released when this Run's event passes
+    std::lock_guard<OrtMutex> lock(deferred_release_cpu_ptr_mutex_);
+    captured_graph_cpu_ptrs_.push_back(p);
+    return;
+  }
+
   // when not running in InferenceSession (e.g. Test)
   // it's OK to not remember the deferred release ptr
   // as the actual memory will be cleaned in arena allocator dtor
@@ -307,10 +462,29 @@ Status CUDAExecutionProvider::OnRunStart() {
   auto& current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
   CUDA_RETURN_IF_ERROR(cudaEventCreate(&current_deferred_release_event, cudaEventDisableTiming));
   deferred_release_cpu_ptr_.emplace(current_deferred_release_event, DeferredReleaseCPUPtrs());
+
+  if (graph_capture_enabled_ && !is_graph_captured_ &&
+      regular_run_count_before_graph_capture_ >= kMinNumRegularRunsBeforeGraphCapture) {
+    LOGS_DEFAULT(INFO) << "Capturing this Run into a CUDA graph.";
+    cuda_graph_.SetStream(cudaStreamPerThread);
+    cuda_graph_.CaptureBegin();
+  }
+
   return Status::OK();
 }
 
 Status CUDAExecutionProvider::OnRunEnd() {
+  // end the capture before touching events: event record is not allowed on a capturing stream
+  if (cuda_graph_.IsCapturing()) {
+    cuda_graph_.CaptureEnd();
+    is_graph_captured_ = true;
+    // the capture run only recorded the work without executing it, so replay once now to
+    // produce this Run's actual results
+    ORT_RETURN_IF_ERROR(cuda_graph_.Replay());
+  } else if (graph_capture_enabled_ && !is_graph_captured_) {
+    ++regular_run_count_before_graph_capture_;
+  }
+
   // record deferred release event on default stream, and release per_thread_context
   auto current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
   CUDA_RETURN_IF_ERROR(cudaEventRecord(current_deferred_release_event, nullptr));
@@ -320,6 +494,29 @@ Status CUDAExecutionProvider::OnRunEnd() {
   return Status::OK();
 }
 
+Status CUDAExecutionProvider::EnableGraphCapture() {
+#ifndef CUDA_API_PER_THREAD_DEFAULT_STREAM
+  return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                         "CUDA graph capture requires a build using the per-thread default stream; "
+                         "the legacy default stream cannot be captured.");
+#else
+  if (!do_copy_in_default_stream_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "CUDA graph capture requires do_copy_in_default_stream=true so that the "
+                           "input/output copies are recorded on the capture stream.");
+  }
+
+  graph_capture_enabled_ = true;
+  return Status::OK();
+#endif
+}
+
+Status CUDAExecutionProvider::ReplayGraph() {
+  ORT_ENFORCE(is_graph_captured_, "ReplayGraph() called before a graph was captured.");
+  CUDA_RETURN_IF_ERROR(cudaSetDevice(GetDeviceId()));
+  return cuda_graph_.Replay();
+}
+
 namespace cuda {
 // opset 1 to 9
 class ONNX_OPERATOR_KERNEL_CLASS_NAME(kCudaExecutionProvider, kOnnxDomain, 1, MemcpyFromHost);
@@ -1854,7 +2051,10 @@ static bool CastNeedFallbackToCPU(const onnxruntime::Node& node) {
 }
 
 std::unique_ptr<onnxruntime::IDataTransfer> CUDAExecutionProvider::GetDataTransfer() const {
-  return onnxruntime::make_unique<onnxruntime::GPUDataTransfer>(do_copy_in_default_stream_);
+  // hand over the arena-backed pinned allocator so pageable feeds/fetches are staged through
+  // pooled pinned buffers instead of falling back to synchronous pageable copies
+  return onnxruntime::make_unique<onnxruntime::GPUDataTransfer>(do_copy_in_default_stream_,
+                                                                GetAllocator(CPU_ALLOCATOR_DEVICE_ID, OrtMemTypeCPUOutput));
 }
 
 std::vector<std::unique_ptr<ComputeCapability>>
@@ -11,6 +11,7 @@
 #include "core/framework/bfc_arena.h"
 #include "core/framework/execution_provider.h"
 #include "core/platform/ort_mutex.h"
+#include "core/providers/cuda/cuda_graph.h"
 #include "core/providers/cuda/cuda_pch.h"
 #include "core/providers/cuda/gpu_data_transfer.h"
 #include "core/providers/cuda/shared_inc/cuda_utils.h"
@@ -42,6 +43,20 @@ class CUDAExecutionProvider : public IExecutionProvider {
 
   Status OnRunEnd() override;
 
+  Status RecordRunCompletion() override;
+
+  Status PollRunCompletion(bool& completed) const override;
+
+  Status WaitRunCompletion() const override;
+
+  Status EnableGraphCapture() override;
+
+  bool IsGraphCaptureEnabled() const override { return graph_capture_enabled_; }
+
+  bool IsGraphCaptured() const override { return is_graph_captured_; }
+
+  Status ReplayGraph() override;
+
   const void* GetExecutionHandle() const noexcept override {
     // The CUDA interface does not return anything interesting.
     return nullptr;
@@ -98,6 +113,22 @@ private:
   std::unordered_map<cudaEvent_t, DeferredReleaseCPUPtrs> deferred_release_cpu_ptr_;
   OrtMutex deferred_release_cpu_ptr_mutex_;
 
+  // completion marker for RecordRunCompletion(); recreated lazily and re-recorded each call
+  cudaEvent_t run_completion_event_ = nullptr;
+  mutable OrtMutex run_completion_event_mutex_;
+
+  // CUDA graph capture-and-replay state. The first kMinNumRegularRunsBeforeGraphCapture Runs
+  // execute per-node so allocations and cudnn algo selection settle; the next Run is captured
+  // into cuda_graph_ and later Runs replay it (see EnableGraphCapture).
+  static constexpr int kMinNumRegularRunsBeforeGraphCapture = 1;
+  CUDAGraph cuda_graph_;
+  bool graph_capture_enabled_ = false;
+  bool is_graph_captured_ = false;
+  int regular_run_count_before_graph_capture_ = 0;
+  // pinned staging buffers whose addresses are baked into the captured graph; retained until
+  // provider destruction instead of being released through the deferred-release events
+  std::vector<void*> captured_graph_cpu_ptrs_;
+
   class PerThreadContext final {
    public:
     PerThreadContext(OrtDevice::DeviceId device_id, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy);
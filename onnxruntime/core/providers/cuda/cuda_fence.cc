@@ -22,7 +22,9 @@ CUDAFence::~CUDAFence() {
 
 void CUDAFence::BeforeUsingAsInput(onnxruntime::ProviderType provider_type, int async_queue_id) {
   if (provider_type == onnxruntime::kCudaExecutionProvider) {
-    // sync in GPU, the call is non-blocking on CPU
+    // sync in GPU, the call is non-blocking on CPU.
+    // queue 0 resolves to the per-thread default stream, so under the parallel executor this
+    // enqueues the wait on the consuming thread's stream against the producing stream's event
     CUDA_CALL_THROW(cudaStreamWaitEvent(data_transfer_->GetStream(async_queue_id), write_event_, 0));
   } else {
     // sync on CPU for all other providers, this is blocking
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cuda/cuda_graph.h"
+
+#include "core/common/logging/logging.h"
+#include "core/providers/cuda/shared_inc/cuda_call.h"
+
+namespace onnxruntime {
+
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10010
+
+void CUDAGraph::CaptureBegin() {
+  ORT_ENFORCE(!has_graph_exec_, "This CUDAGraph has already captured a graph; call Reset() before capturing again.");
+  ORT_ENFORCE(stream_ != nullptr, "A capture stream must be set before CaptureBegin().");
+  // Global mode fails the capture if any thread submits uncaptured work that could interact with
+  // the capture stream, instead of silently recording an incomplete graph.
+  CUDA_CALL_THROW(cudaStreamBeginCapture(stream_, cudaStreamCaptureModeGlobal));
+  is_capturing_ = true;
+}
+
+void CUDAGraph::CaptureEnd() {
+  ORT_ENFORCE(is_capturing_, "CaptureEnd() called without a matching CaptureBegin().");
+  is_capturing_ = false;
+  CUDA_CALL_THROW(cudaStreamEndCapture(stream_, &graph_));
+  ORT_ENFORCE(graph_ != nullptr, "cudaStreamEndCapture returned an empty graph.");
+  has_graph_ = true;
+  CUDA_CALL_THROW(cudaGraphInstantiate(&graph_exec_, graph_, nullptr, nullptr, 0));
+  has_graph_exec_ = true;
+  // the executable graph keeps what it needs; the capture graph itself is no longer required
+  CUDA_CALL_THROW(cudaGraphDestroy(graph_));
+  has_graph_ = false;
+}
+
+common::Status CUDAGraph::Replay() {
+  ORT_RETURN_IF_NOT(has_graph_exec_, "No captured graph to replay.");
+  CUDA_RETURN_IF_ERROR(cudaGraphLaunch(graph_exec_, stream_));
+  // make the replayed results visible to the host on return, matching the synchronization the
+  // per-node execution path provides through the output copies
+  CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(stream_));
+  return Status::OK();
+}
+
+void CUDAGraph::Reset() {
+  if (has_graph_) {
+    CUDA_CALL_THROW(cudaGraphDestroy(graph_));
+    has_graph_ = false;
+  }
+  if (has_graph_exec_) {
+    CUDA_CALL_THROW(cudaGraphExecDestroy(graph_exec_));
+    has_graph_exec_ = false;
+  }
+}
+
+CUDAGraph::~CUDAGraph() {
+  try {
+    Reset();
+  } catch (const std::exception& ex) {
+    LOGS_DEFAULT(ERROR) << "CUDAGraph::Reset threw:" << ex.what();
+  }
+}
+
+#else  // CUDA < 10.1
+
+void CUDAGraph::CaptureBegin() {
+  ORT_THROW("CUDA graph capture requires CUDA 10.1 or later.");
+}
+
+void CUDAGraph::CaptureEnd() {
+  ORT_THROW("CUDA graph capture requires CUDA 10.1 or later.");
+}
+
+common::Status CUDAGraph::Replay() {
+  return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "CUDA graph capture requires CUDA 10.1 or later.");
+}
+
+void CUDAGraph::Reset() {
+}
+
+CUDAGraph::~CUDAGraph() = default;
+
+#endif
+
+}  // namespace onnxruntime
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/providers/cuda/cuda_pch.h"
+
+namespace onnxruntime {
+
+// Captures the work submitted to a stream between CaptureBegin() and CaptureEnd() into a CUDA
+// graph, and replays the instantiated graph with a single launch. Requires CUDA 10.1 or later;
+// the legacy default stream cannot be captured, so the kernels must run on a capturable stream
+// (this build uses the per-thread default stream, see cmake/CMakeLists.txt).
+class CUDAGraph {
+ public:
+  CUDAGraph() = default;
+  ~CUDAGraph();
+
+  void SetStream(cudaStream_t stream) { stream_ = stream; }
+  void CaptureBegin();
+  void CaptureEnd();
+  bool IsCapturing() const { return is_capturing_; }
+  common::Status Replay();
+  void Reset();
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CUDAGraph);
+
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10010
+  cudaGraph_t graph_ = nullptr;
+  cudaGraphExec_t graph_exec_ = nullptr;
+#endif
+  bool has_graph_ = false;
+  bool has_graph_exec_ = false;
+  bool is_capturing_ = false;
+  cudaStream_t stream_ = nullptr;
+};
+
+}  // namespace onnxruntime
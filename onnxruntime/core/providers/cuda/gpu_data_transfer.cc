@@ -9,7 +9,8 @@
 // so we leave it as optional, in case user need the previous behavior
 // a full fix to BFC arena is being looked at, and once it's in, we can revert this change
 namespace onnxruntime {
-GPUDataTransfer::GPUDataTransfer(bool do_copy_in_default_stream) {
+GPUDataTransfer::GPUDataTransfer(bool do_copy_in_default_stream, AllocatorPtr pinned_allocator)
+    : pinned_allocator_(std::move(pinned_allocator)) {
   // create streams, default is nullptr
   streams_[kCudaStreamDefault] = nullptr;
   if (do_copy_in_default_stream) {
@@ -22,6 +23,12 @@ GPUDataTransfer::GPUDataTransfer(bool do_copy_in_default_stream) {
 }
 
 GPUDataTransfer::~GPUDataTransfer() {
+  for (auto& staging : in_flight_staging_buffers_) {
+    CUDA_CALL(cudaEventSynchronize(staging.done_event));
+    pinned_allocator_->Free(staging.ptr);
+    CUDA_CALL(cudaEventDestroy(staging.done_event));
+  }
+
   if (streams_[kCudaStreamCopyIn] != nullptr) {
     CUDA_CALL(cudaStreamDestroy(streams_[kCudaStreamCopyIn]));
   }
@@ -35,6 +42,33 @@ bool GPUDataTransfer::CanCopy(const OrtDevice& src_device, const OrtDevice& dst_
          dst_device.Type() == OrtDevice::GPU || dst_device.MemType() == OrtDevice::MemType::CUDA_PINNED;
 }
 
+void* GPUDataTransfer::AcquireStagingBuffer(size_t bytes) const {
+  {
+    std::lock_guard<OrtMutex> lock(staging_mutex_);
+    auto it = in_flight_staging_buffers_.begin();
+    while (it != in_flight_staging_buffers_.end()) {
+      if (cudaEventQuery(it->done_event) == cudaSuccess) {
+        pinned_allocator_->Free(it->ptr);
+        CUDA_CALL(cudaEventDestroy(it->done_event));
+        it = in_flight_staging_buffers_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  return pinned_allocator_->Alloc(bytes);
+}
+
+void GPUDataTransfer::ReleaseStagingBufferWhenDone(void* buffer, cudaStream_t stream) const {
+  cudaEvent_t done_event = nullptr;
+  CUDA_CALL_THROW(cudaEventCreate(&done_event, cudaEventDisableTiming));
+  CUDA_CALL_THROW(cudaEventRecord(done_event, stream));
+
+  std::lock_guard<OrtMutex> lock(staging_mutex_);
+  in_flight_staging_buffers_.push_back({buffer, done_event});
+}
+
 common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int exec_queue_id) const {
   size_t bytes = src.SizeInBytes();
   const void* src_data = src.DataRaw();
@@ -48,11 +82,22 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int e
       // copy from pinned memory to GPU, this is non-blocking
       CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyHostToDevice, streams_[exec_queue_id]));
     } else if (src_device.Type() == OrtDevice::GPU) {
-      // copying between GPU, this is non-blocking
-      // Copy only if the two addresses are different.
-      if (dst_data != src_data) {
+      if (src_device.Id() != dst_device.Id()) {
+        // cross-device copy; goes direct over NVLink/PCIe when peer access is enabled
+        // (see EnablePeerAccess in the CUDA EP), otherwise the driver stages through host
+        CUDA_RETURN_IF_ERROR(cudaMemcpyPeerAsync(dst_data, dst_device.Id(), src_data, src_device.Id(), bytes, streams_[kCudaStreamDefault]));
+      } else if (dst_data != src_data) {
+        // copying between GPU, this is non-blocking
+        // Copy only if the two addresses are different.
         CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToDevice, streams_[kCudaStreamDefault]));
       }
+    } else if (pinned_allocator_ != nullptr) {
+      // stage the pageable buffer through pooled pinned memory: the host-side memcpy is paid once
+      // and the device copy runs async at pinned bandwidth instead of blocking at pageable speed
+      void* staging = AcquireStagingBuffer(bytes);
+      memcpy(staging, src_data, bytes);
+      CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, staging, bytes, cudaMemcpyHostToDevice, streams_[exec_queue_id]));
+      ReleaseStagingBufferWhenDone(staging, streams_[exec_queue_id]);
     } else {
       // copy from other CPU memory to GPU, this is blocking
       CUDA_RETURN_IF_ERROR(cudaMemcpy(dst_data, src_data, bytes, cudaMemcpyHostToDevice));
@@ -61,6 +106,15 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int e
     if (dst_device.Type() == OrtDevice::CPU && dst_device.MemType() == OrtDevice::MemType::CUDA_PINNED) {
       // copying from GPU to pinned memory, this is non-blocking
       CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToHost, streams_[exec_queue_id]));
+    } else if (pinned_allocator_ != nullptr) {
+      // the caller needs the data on return, so the copy cannot be made async, but staging it
+      // through pinned memory transfers at full bandwidth and only waits on the copy stream
+      // instead of the whole device
+      void* staging = AcquireStagingBuffer(bytes);
+      CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(staging, src_data, bytes, cudaMemcpyDeviceToHost, streams_[exec_queue_id]));
+      CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(streams_[exec_queue_id]));
+      memcpy(dst_data, staging, bytes);
+      pinned_allocator_->Free(staging);
     } else {
       // copying from GPU to CPU memory, this is blocking
       CUDA_RETURN_IF_ERROR(cudaMemcpy(dst_data, src_data, bytes, cudaMemcpyDeviceToHost));
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "cuda_pch.h"
+#include "core/framework/allocator.h"
 #include "core/framework/data_transfer.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 
@@ -17,7 +21,7 @@ enum CUDAStreamType : int {
 
 class GPUDataTransfer : public IDataTransfer {
  public:
-  GPUDataTransfer(bool do_copy_in_default_stream = true);
+  GPUDataTransfer(bool do_copy_in_default_stream = true, AllocatorPtr pinned_allocator = nullptr);
   ~GPUDataTransfer();
 
   bool CanCopy(const OrtDevice& src_device, const OrtDevice& dst_device) const override;
@@ -32,7 +36,26 @@ class GPUDataTransfer : public IDataTransfer {
   }
 
  private:
+  // Takes a staging buffer from the pinned allocator, first returning to it any buffer whose
+  // in-flight copy has completed so the arena can recycle the memory by size class.
+  void* AcquireStagingBuffer(size_t bytes) const;
+  // Hands the staging buffer back once the async copies enqueued on 'stream' have completed.
+  void ReleaseStagingBufferWhenDone(void* buffer, cudaStream_t stream) const;
+
   cudaStream_t streams_[kTotalCudaStreams];
+
+  // Pageable host buffers cannot be copied asynchronously, so feeds/fetches in pageable memory
+  // are staged through pooled pinned buffers from this allocator (the provider's arena-backed
+  // pinned allocator). When null, pageable copies fall back to synchronous cudaMemcpy.
+  AllocatorPtr pinned_allocator_;
+
+  struct StagingBuffer {
+    void* ptr;
+    cudaEvent_t done_event;
+  };
+
+  mutable OrtMutex staging_mutex_;
+  mutable std::vector<StagingBuffer> in_flight_staging_buffers_;
 };
 
 }  // namespace onnxruntime
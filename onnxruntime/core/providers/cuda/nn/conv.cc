@@ -4,6 +4,7 @@
 #include "core/providers/common.h"
 #include "core/providers/cuda/cuda_common.h"
 #include "core/providers/cuda/nn/conv.h"
+#include "core/providers/cuda/nn/conv_algo_cache.h"
 #include "core/providers/cuda/shared_inc/fpgeneric.h"
 #include "core/providers/cuda/tensor/slice.h"
 
@@ -202,6 +203,23 @@ Status Conv<T>::ComputeInternal(OpKernelContext* context) const {
         ORT_RETURN_IF_ERROR(s_.b_tensor.Set(b_dims, CudnnTensor::GetDataType<CudaT>()));
       }
 
+      // consult the file-backed cache (if enabled) before searching, so restarts
+      // of the process do not repeat the algo search for known convolutions
+      auto& algo_cache = CudnnConvAlgoCache::Instance();
+      std::string algo_cache_key;
+      if (algo_cache.Enabled() && !s_.cached_benchmark_results.contains(x_dims_cudnn)) {
+        algo_cache_key = CudnnConvAlgoCache::BuildKey("Conv", CudnnTensor::GetDataType<CudaT>(),
+                                                      x_dims_cudnn, w_dims, pads, strides, dilations,
+                                                      conv_attrs_.group, GetDeviceProp());
+        CudnnConvAlgoCache::Entry entry;
+        if (algo_cache.Lookup(algo_cache_key, entry)) {
+          s_.cached_benchmark_results.insert(x_dims_cudnn,
+                                             {static_cast<cudnnConvolutionFwdAlgo_t>(entry.algo),
+                                              entry.memory,
+                                              static_cast<cudnnMathType_t>(entry.math_type)});
+        }
+      }
+
       if (!s_.cached_benchmark_results.contains(x_dims_cudnn)) {
         IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
 
@@ -263,6 +281,11 @@ Status Conv<T>::ComputeInternal(OpKernelContext* context) const {
         }
         
         s_.cached_benchmark_results.insert(x_dims_cudnn, {perf.algo, perf.memory, perf.mathType});
+
+        if (algo_cache.Enabled()) {
+          algo_cache.Insert(algo_cache_key, {static_cast<int>(perf.algo), perf.memory,
+                                             static_cast<int>(perf.mathType)});
+        }
       }
 
       const auto& perf = s_.cached_benchmark_results.at(x_dims_cudnn);
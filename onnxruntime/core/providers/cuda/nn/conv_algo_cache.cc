@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cuda/nn/conv_algo_cache.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "core/common/logging/logging.h"
+#include "core/platform/env.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+static const char* const kCudaConvAlgoCachePathEnvVar = "ORT_CUDA_CONV_ALGO_CACHE_PATH";
+
+CudnnConvAlgoCache& CudnnConvAlgoCache::Instance() {
+  static CudnnConvAlgoCache instance;
+  return instance;
+}
+
+CudnnConvAlgoCache::CudnnConvAlgoCache() {
+  cache_path_ = Env::Default().GetEnvironmentVar(kCudaConvAlgoCachePathEnvVar);
+  if (cache_path_.empty())
+    return;
+
+  // each line holds one entry: <key> <algo> <workspace bytes> <math type>
+  std::ifstream file(cache_path_);
+  std::string line;
+  size_t loaded = 0;
+  while (std::getline(file, line)) {
+    std::istringstream line_stream(line);
+    std::string key;
+    Entry entry;
+    if (line_stream >> key >> entry.algo >> entry.memory >> entry.math_type) {
+      entries_[key] = entry;
+      ++loaded;
+    } else if (!line.empty()) {
+      LOGS_DEFAULT(WARNING) << "Skipping malformed line in cuDNN conv algo cache " << cache_path_
+                            << ": " << line;
+    }
+  }
+
+  LOGS_DEFAULT(INFO) << "Loaded " << loaded << " cuDNN conv algo cache entries from " << cache_path_;
+}
+
+std::string CudnnConvAlgoCache::BuildKey(const char* op,
+                                         cudnnDataType_t data_type,
+                                         const std::vector<int64_t>& x_dims,
+                                         const std::vector<int64_t>& w_dims,
+                                         const std::vector<int64_t>& pads,
+                                         const std::vector<int64_t>& strides,
+                                         const std::vector<int64_t>& dilations,
+                                         int64_t group,
+                                         const cudaDeviceProp& device_prop) {
+  // keys must not contain whitespace - the cache file is parsed with stream extraction
+  std::ostringstream key;
+  key << op << ",dt" << static_cast<int>(data_type);
+  auto append_dims = [&key](const char* tag, const std::vector<int64_t>& dims) {
+    key << ',' << tag;
+    for (size_t i = 0; i < dims.size(); ++i)
+      key << (i == 0 ? "" : "x") << dims[i];
+  };
+  append_dims("x", x_dims);
+  append_dims("w", w_dims);
+  append_dims("p", pads);
+  append_dims("s", strides);
+  append_dims("d", dilations);
+  key << ",g" << group
+      << ",sm" << device_prop.major << device_prop.minor
+      << ",cudnn" << CUDNN_VERSION;
+  return key.str();
+}
+
+bool CudnnConvAlgoCache::Lookup(const std::string& key, Entry& entry) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end())
+    return false;
+
+  entry = it->second;
+  return true;
+}
+
+void CudnnConvAlgoCache::Insert(const std::string& key, const Entry& entry) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (!entries_.emplace(key, entry).second)
+    return;
+
+  std::ofstream file(cache_path_, std::ios::app);
+  if (!file) {
+    LOGS_DEFAULT(WARNING) << "Failed to open cuDNN conv algo cache " << cache_path_ << " for append";
+    return;
+  }
+  file << key << ' ' << entry.algo << ' ' << entry.memory << ' ' << entry.math_type << '\n';
+}
+
+}  // namespace cuda
+}  // namespace onnxruntime
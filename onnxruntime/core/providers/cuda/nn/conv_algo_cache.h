@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+#include "core/providers/cuda/cuda_pch.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+// Process-wide, file-backed cache of cuDNN convolution algorithm choices.
+// cudnnFindConvolutionForwardAlgorithmEx can take seconds per layer, and the in-memory
+// cached_benchmark_results in CudnnConvState only lives as long as the kernel instance,
+// so every process restart repeats the search. Pointing ORT_CUDA_CONV_ALGO_CACHE_PATH
+// at a writable file makes the results survive restarts: entries are loaded on first
+// use and each new search result is appended as it is found, mirroring how the
+// TensorRT EP persists engines via ORT_TENSORRT_CACHE_PATH.
+//
+// Keys include the GPU compute capability and cuDNN version, so a cache file can be
+// shared between machines; entries that do not match the current environment are
+// simply never looked up.
+class CudnnConvAlgoCache {
+ public:
+  // algo and math_type hold the cudnn enum values of the AlgoPerfType used by the
+  // caller (forward vs backward-data algos have distinct enums, but the op tag in
+  // the key keeps them from ever being mixed up).
+  struct Entry {
+    int algo;
+    size_t memory;
+    int math_type;
+  };
+
+  static CudnnConvAlgoCache& Instance();
+
+  bool Enabled() const { return !cache_path_.empty(); }
+
+  // Builds a key unique to the convolution problem and the environment the search
+  // runs in. 'op' distinguishes algo spaces (e.g. "Conv" vs "ConvTranspose").
+  static std::string BuildKey(const char* op,
+                              cudnnDataType_t data_type,
+                              const std::vector<int64_t>& x_dims,
+                              const std::vector<int64_t>& w_dims,
+                              const std::vector<int64_t>& pads,
+                              const std::vector<int64_t>& strides,
+                              const std::vector<int64_t>& dilations,
+                              int64_t group,
+                              const cudaDeviceProp& device_prop);
+
+  bool Lookup(const std::string& key, Entry& entry) const;
+
+  // Adds the entry to the in-memory map and appends it to the cache file so a
+  // crash or hard exit does not lose the results found so far.
+  void Insert(const std::string& key, const Entry& entry);
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CudnnConvAlgoCache);
+
+ private:
+  CudnnConvAlgoCache();
+
+  std::string cache_path_;
+  mutable OrtMutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace cuda
+}  // namespace onnxruntime
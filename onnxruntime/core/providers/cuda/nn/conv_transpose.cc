@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "conv_transpose.h"
+#include "core/providers/cuda/nn/conv_algo_cache.h"
 
 namespace onnxruntime {
 namespace cuda {
@@ -127,6 +128,23 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
 
       y_data = reinterpret_cast<CudaT*>(p.Y->template MutableData<T>());
 
+      // consult the file-backed cache (if enabled) before searching, so restarts
+      // of the process do not repeat the algo search for known convolutions
+      auto& algo_cache = CudnnConvAlgoCache::Instance();
+      std::string algo_cache_key;
+      if (algo_cache.Enabled() && !s_.cached_benchmark_results.contains(x_dims)) {
+        algo_cache_key = CudnnConvAlgoCache::BuildKey("ConvTranspose", CudnnTensor::GetDataType<CudaT>(),
+                                                      x_dims, w_dims, p.pads, p.strides, p.dilations,
+                                                      conv_transpose_attrs_.group, GetDeviceProp());
+        CudnnConvAlgoCache::Entry entry;
+        if (algo_cache.Lookup(algo_cache_key, entry)) {
+          s_.cached_benchmark_results.insert(x_dims,
+                                             {static_cast<cudnnConvolutionBwdDataAlgo_t>(entry.algo),
+                                              entry.memory,
+                                              static_cast<cudnnMathType_t>(entry.math_type)});
+        }
+      }
+
       if (!s_.cached_benchmark_results.contains(x_dims)) {
         IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
 
@@ -151,6 +169,11 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
             algo_search_workspace.get(),
             AlgoSearchWorkspaceSize));
         s_.cached_benchmark_results.insert(x_dims, {perf.algo, perf.memory, perf.mathType});
+
+        if (algo_cache.Enabled()) {
+          algo_cache.Insert(algo_cache_key, {static_cast<int>(perf.algo), perf.memory,
+                                             static_cast<int>(perf.mathType)});
+        }
       }
 
       const auto& perf = s_.cached_benchmark_results.at(x_dims);
@@ -87,29 +87,53 @@ class PrimitivePool {
   ~PrimitivePool() = default;
 
   void SetPrimitive(const std::string& key, std::unique_ptr<PrimitiveBase> primitive) {
-    auto& map = PrimitivePool<T>::GetMap();
-    auto iter = map.find(key);
+    auto& pool = PrimitivePool<T>::GetPool();
+    auto iter = pool.map.find(key);
     // We should not find a primitive already using this key.
-    ORT_ENFORCE(iter == map.end(), "duplicate key: " + key);
-    map.insert(std::make_pair(key, std::move(primitive)));
+    ORT_ENFORCE(iter == pool.map.end(), "duplicate key: " + key);
+    // Keys contain the input dims, so dynamic input shapes produce one entry
+    // per distinct shape. Evict the least recently used primitive when the
+    // pool is full to keep long-running variable-shape workloads from growing
+    // it indefinitely.
+    if (pool.map.size() >= kCapacity) {
+      pool.map.erase(pool.lru_keys.back());
+      pool.lru_keys.pop_back();
+    }
+    pool.lru_keys.push_front(key);
+    pool.map.insert(std::make_pair(key, Entry{std::move(primitive), pool.lru_keys.begin()}));
   }
 
   PrimitiveBase* GetPrimitive(const std::string& key) {
-    const auto& map = PrimitivePool<T>::GetMap();
-    auto iter = map.find(key);
-    if (iter != map.end()) {
-      return iter->second.get();
+    auto& pool = PrimitivePool<T>::GetPool();
+    auto iter = pool.map.find(key);
+    if (iter != pool.map.end()) {
+      // Mark as most recently used.
+      pool.lru_keys.splice(pool.lru_keys.begin(), pool.lru_keys, iter->second.lru_position);
+      return iter->second.primitive.get();
     } else {
       return nullptr;
     }
   }
 
  private:
-  // For thread safety, the map needs to be kept in thread local storage.
-  static inline std::unordered_map<std::string, std::unique_ptr<PrimitiveBase>>& GetMap() {
-    using MapType = std::unordered_map<std::string, std::unique_ptr<PrimitiveBase>>;
-    static thread_local DeleteOnUnloadPtr<MapType> map(new MapType());
-    return *map;
+  struct Entry {
+    std::unique_ptr<PrimitiveBase> primitive;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  struct Pool {
+    std::unordered_map<std::string, Entry> map;
+    // Keys ordered from most to least recently used.
+    std::list<std::string> lru_keys;
+  };
+
+  // Maximum number of cached primitives per thread.
+  static constexpr size_t kCapacity = 1024;
+
+  // For thread safety, the pool needs to be kept in thread local storage.
+  static inline Pool& GetPool() {
+    static thread_local DeleteOnUnloadPtr<Pool> pool(new Pool());
+    return *pool;
   }
 };
 
@@ -76,31 +76,31 @@ bool DNNLExecutionProvider::UseSubgraph(const onnxruntime::Provider_GraphViewer&
   bool use_subgraph = true;
 
   bool FP16_graph = false;
+  bool FP16_resolved = false;
   bool dnnl_nodes_in_the_graph = false;
   int max_node_index = graph_viewer.MaxNodeIndex();
 
+  // One snapshot per node instead of a bridge crossing per accessor
+  Provider_NodeSnapshot snapshot;
   for (auto node_index = 0; node_index < max_node_index; node_index++) {
     auto node = graph_viewer.GetNode(node_index);
-    if (node == NULL)
+    if (node == nullptr)
       continue;
 
-    if (!node->InputDefs().empty() && node->InputDefs()[0]->Type() != nullptr) {
-      FP16_graph = node->InputDefs()[0]->Type()->find("16") != std::string::npos;
-      break;
-    }
-  }
+    node->GetSnapshot(snapshot);
 
-  for (auto node_index = 0; node_index < max_node_index; node_index++) {
-    auto node = graph_viewer.GetNode(node_index);
-    if (node == nullptr) {
-      continue;
+    // The graph precision is decided by the first node with a typed input
+    if (!FP16_resolved && !snapshot.input_defs.empty() && !snapshot.input_defs[0].type.empty()) {
+      FP16_graph = snapshot.input_defs[0].type.find("16") != std::string::npos;
+      FP16_resolved = true;
     }
 
-    auto op_it = dnnl_ops_.find(node->OpType());
-    if (op_it != dnnl_ops_.end()) {
+    if (!dnnl_nodes_in_the_graph && dnnl_ops_.find(snapshot.op_type) != dnnl_ops_.end()) {
       dnnl_nodes_in_the_graph = true;
-      break;
     }
+
+    if (FP16_resolved && dnnl_nodes_in_the_graph)
+      break;
   }
 
   if (FP16_graph || !dnnl_nodes_in_the_graph) {
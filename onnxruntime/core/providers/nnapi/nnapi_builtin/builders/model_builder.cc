@@ -23,6 +23,59 @@ int32_t ModelBuilder::GetAndroidSdkVer() const {
   return nnapi_ ? nnapi_->android_sdk_version : 0;
 }
 
+// Must match ANEURALNETWORKS_BYTE_SIZE_OF_CACHE_TOKEN of the NNAPI runtime
+constexpr size_t kByteSizeOfCacheToken = 32;
+
+std::vector<uint8_t> ModelBuilder::GetCompilationCacheToken() const {
+  // The NNAPI runtime does not detect token collisions, so everything which
+  // changes the compiled model has to contribute to the token, the graph
+  // structure, the initializer data and the build flags
+  std::string model_desc;
+  model_desc.append(use_nchw_ ? "nchw;" : "nhwc;");
+  model_desc.append(use_fp16_ ? "fp16;" : "fp32;");
+
+  for (const auto* input : graph_viewer_.GetInputs()) {
+    model_desc.append(input->Name());
+    if (const auto* shape = input->Shape())
+      model_desc.append(shape->SerializeAsString());
+  }
+
+  for (const auto node_idx : graph_viewer_.GetNodesInTopologicalOrder()) {
+    const auto* node = graph_viewer_.GetNode(node_idx);
+    model_desc.append(node->OpType());
+    for (const auto& attr : node->GetAttributes())
+      model_desc.append(attr.second.SerializeAsString());
+    for (const auto* def : node->InputDefs())
+      model_desc.append(def->Name());
+    for (const auto* def : node->OutputDefs())
+      model_desc.append(def->Name());
+  }
+
+  // Initializers are kept in an unordered map, sort the names to make the
+  // token stable across sessions
+  const auto& initializers = GetInitializerTensors();
+  std::vector<std::string> initializer_names;
+  initializer_names.reserve(initializers.size());
+  for (const auto& pair : initializers)
+    initializer_names.push_back(pair.first);
+  std::sort(initializer_names.begin(), initializer_names.end());
+  for (const auto& name : initializer_names)
+    model_desc.append(initializers.at(name)->SerializeAsString());
+
+  // Stretch the string hash over the whole token by re-hashing with a
+  // growing salt for each size_t sized chunk
+  std::vector<uint8_t> token(kByteSizeOfCacheToken, 0);
+  std::hash<std::string> hasher;
+  for (size_t offset = 0; offset < token.size(); offset += sizeof(size_t)) {
+    const size_t chunk_hash = hasher(model_desc);
+    for (size_t i = 0; i < sizeof(size_t) && offset + i < token.size(); i++)
+      token[offset + i] = static_cast<uint8_t>(chunk_hash >> (i * 8));
+    model_desc.push_back('#');
+  }
+
+  return token;
+}
+
 // Scalar operand is copied into the model, no need to persist
 #define DEFINE_ADD_OPERAND_FROM_SCALAR(scalar_type, op_type)                      \
   Status ModelBuilder::AddOperandFromScalar(scalar_type value, uint32_t& index) { \
@@ -512,10 +565,33 @@ Status ModelBuilder::Compile(std::unique_ptr<Model>& model) {
           nnapi_model_->compilation_, static_cast<int32_t>(exe_pref_)),
       "on setPreference");
 
+  // Compilation caching lets the driver skip recompiling the model on repeated
+  // session creations, it is only available on API 29+
+  // Failing to set up caching is not fatal, compile without the cache
+  if (!compilation_cache_dir_.empty() && GetAndroidSdkVer() >= 29) {
+    const auto token = GetCompilationCacheToken();
+    if (nnapi_->ANeuralNetworksCompilation_setCaching(
+            nnapi_model_->compilation_, compilation_cache_dir_.c_str(), token.data()) != ANEURALNETWORKS_NO_ERROR) {
+      LOGS_DEFAULT(WARNING) << "Unable to set up NNAPI compilation caching in ["
+                            << compilation_cache_dir_ << "]";
+    }
+  }
+
   RETURN_STATUS_ON_ERROR_WITH_NOTE(
       nnapi_->ANeuralNetworksCompilation_finish(nnapi_model_->compilation_),
       "on compilation finish");
 
+  // Burst executions reuse driver resources across Runs of this model,
+  // they are only available on API 29+
+  // Failing to create the burst is not fatal, executions fall back to startCompute
+  if (GetAndroidSdkVer() >= 29) {
+    if (nnapi_->ANeuralNetworksBurst_create(
+            nnapi_model_->compilation_, &nnapi_model_->burst_) != ANEURALNETWORKS_NO_ERROR) {
+      LOGS_DEFAULT(WARNING) << "Unable to create NNAPI burst, falling back to regular executions";
+      nnapi_model_->burst_ = nullptr;
+    }
+  }
+
   model.reset(nnapi_model_.release());
   return Status::OK();
 }
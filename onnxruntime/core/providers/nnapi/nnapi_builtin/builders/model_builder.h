@@ -74,6 +74,12 @@ class ModelBuilder {
   // It is off by default
   void SetUseFp16(bool use_fp16) { use_fp16_ = use_fp16; }
 
+  // Set the directory NNAPI uses to cache the compiled model
+  // Caching is off if the directory is empty (default), and needs Android API level 29+
+  void SetCompilationCacheDir(const std::string& compilation_cache_dir) {
+    compilation_cache_dir_ = compilation_cache_dir;
+  }
+
   // Set NNAPI execution preference
   // Default preference is PREFER_SUSTAINED_SPEED
   void ExecutePreference(
@@ -116,6 +122,7 @@ class ModelBuilder {
 
   bool use_nchw_{false};
   bool use_fp16_{false};
+  std::string compilation_cache_dir_;
   android::nn::wrapper::ExecutePreference exe_pref_{
       android::nn::wrapper::ExecutePreference::PREFER_FAST_SINGLE_ANSWER};
 
@@ -156,6 +163,11 @@ class ModelBuilder {
 
   Status GetTargetDevices() ORT_MUST_USE_RESULT;
 
+  // Compute the caching token identifying this model for
+  // ANeuralNetworksCompilation_setCaching, covering everything which affects
+  // the compiled model (graph structure, initializer data and build flags)
+  std::vector<uint8_t> GetCompilationCacheToken() const;
+
   // If a NNAPI operation will use initializers directly, we will add the initializers to the skip list
   void PreprocessInitializers();
   // Preprocess all the activation nodes (Relu/Relu1/Relu6) for easy query later
@@ -20,6 +20,7 @@ namespace nnapi {
 Model::Model() : nnapi_(NnApiImplementation()) {}
 
 Model::~Model() {
+  nnapi_->ANeuralNetworksBurst_free(burst_);
   nnapi_->ANeuralNetworksCompilation_free(compilation_);
   nnapi_->ANeuralNetworksModel_free(model_);
 }
@@ -98,7 +99,7 @@ Status Model::PrepareForExecution(std::unique_ptr<Execution>& execution) {
   RETURN_STATUS_ON_ERROR(
       nnapi_->ANeuralNetworksExecution_create(compilation_, &nnapi_execution));
 
-  execution.reset(new Execution(*nnapi_execution, shaper_));
+  execution.reset(new Execution(*nnapi_execution, shaper_, burst_));
   return Status::OK();
 }
 
@@ -145,9 +146,10 @@ Model::NNMemory::NNMemory(const NnApi* /*nnapi*/, const char* name, size_t size)
 
 #pragma region Execution
 
-Execution::Execution(ANeuralNetworksExecution& execution, const Shaper& shaper)
+Execution::Execution(ANeuralNetworksExecution& execution, const Shaper& shaper, ANeuralNetworksBurst* burst)
     : nnapi_(NnApiImplementation()),
       execution_(&execution),
+      burst_(burst),
       shaper_(shaper) {
 }
 
@@ -192,10 +194,16 @@ Status Execution::SetOutputBuffer(const int32_t index, const OutputBuffer& outpu
 }
 
 Status Execution::Predict(const std::vector<int32_t>& dynamic_outputs, std::vector<Shaper::Shape>& dynamic_output_shapes) {
-  ANeuralNetworksEvent* event = nullptr;
-  RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_startCompute(execution_, &event));
-  RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksEvent_wait(event));
-  nnapi_->ANeuralNetworksEvent_free(event);
+  if (burst_ != nullptr) {
+    // A burst only allows one live execution at a time, which is guaranteed here
+    // since the caller holds the exclusive lock on the model during Predict
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_burstCompute(execution_, burst_));
+  } else {
+    ANeuralNetworksEvent* event = nullptr;
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_startCompute(execution_, &event));
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksEvent_wait(event));
+    nnapi_->ANeuralNetworksEvent_free(event);
+  }
 
   dynamic_output_shapes.clear();
   dynamic_output_shapes.reserve(dynamic_outputs.size());
@@ -111,6 +111,10 @@ class Model {
   ANeuralNetworksModel* model_{nullptr};
   ANeuralNetworksCompilation* compilation_{nullptr};
 
+  // Burst object reused by all executions of this model to cut the per-inference
+  // driver IPC overhead. May be null if bursts are not available (API level < 29)
+  ANeuralNetworksBurst* burst_{nullptr};
+
   size_t dynamic_output_buffer_size_{1024};
 
   std::unique_ptr<NNMemory> mem_initializers_;
@@ -163,7 +167,7 @@ class Execution {
   };
 
  public:
-  explicit Execution(ANeuralNetworksExecution& execution, const Shaper& shaper);
+  Execution(ANeuralNetworksExecution& execution, const Shaper& shaper, ANeuralNetworksBurst* burst);
   ~Execution();
   Execution(const Execution&) = delete;
   Execution& operator=(const Execution&) = delete;
@@ -186,6 +190,8 @@ class Execution {
 
   const NnApi* nnapi_{nullptr};
   ANeuralNetworksExecution* execution_;
+  // The burst of the model this execution belongs to. Not owned by this object, may be null
+  ANeuralNetworksBurst* burst_{nullptr};
   Shaper shaper_;
 };
 
@@ -8,6 +8,7 @@
 #include "core/framework/allocatormgr.h"
 #include "core/framework/compute_capability.h"
 #include "core/graph/graph_viewer.h"
+#include "core/platform/env.h"
 #include "core/session/onnxruntime_cxx_api.h"
 #include "nnapi_lib/nnapi_implementation.h"
 
@@ -256,6 +257,8 @@ common::Status NnapiExecutionProvider::Compile(const std::vector<FusedNodeAndGra
     nnapi::ModelBuilder builder(graph_viewer);
     builder.SetUseNCHW(nnapi_flags_ & NNAPI_FLAG_USE_NCHW);
     builder.SetUseFp16(nnapi_flags_ & NNAPI_FLAG_USE_FP16);
+    builder.SetCompilationCacheDir(
+        Env::Default().GetEnvironmentVar(nnapi_env_vars::kCompilationCacheDir));
     std::unique_ptr<nnapi::Model> nnapi_model;
     ORT_RETURN_IF_ERROR(builder.Compile(nnapi_model));
 
@@ -11,6 +11,13 @@ namespace nnapi {
 class Model;
 }
 
+namespace nnapi_env_vars {
+// Directory used for NNAPI compilation caching, caching is disabled if not set
+// It is recommended to use the code_cache directory provided by the Android
+// runtime, otherwise the application is responsible for cleaning the entries
+static const std::string kCompilationCacheDir = "ORT_NNAPI_CACHE_PATH";
+}  // namespace nnapi_env_vars
+
 class NnapiExecutionProvider : public IExecutionProvider {
  public:
   NnapiExecutionProvider(uint32_t nnapi_flags);
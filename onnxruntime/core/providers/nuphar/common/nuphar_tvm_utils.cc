@@ -69,7 +69,14 @@ static bool GetCacheSoFilePath(std::string& so_path) {
 
 static void* GetFuncFromLibrary(const std::string& so_path, const std::string& func_name, bool throw_if_not_found = true) {
   void* so_handle;
-  ORT_ENFORCE(Env::Default().LoadDynamicLibrary(so_path, &so_handle).IsOK());
+  Status load_status = Env::Default().LoadDynamicLibrary(so_path, &so_handle);
+  if (!load_status.IsOK()) {
+    // A cached dll that cannot be loaded (corrupt, or built for another target)
+    // must not fail the session, callers fall back to JIT compilation
+    LOGS_DEFAULT(CODEGEN_SETTINGS_LOG_LEVEL) << "Cannot load cached dll " << so_path
+                                             << ": " << load_status.ErrorMessage() << ", using JIT...";
+    return nullptr;
+  }
   void* func = nullptr;
   Status s = Env::Default().GetSymbolFromLibrary(so_handle, func_name, &func);
   if (throw_if_not_found && !s.IsOK())
@@ -103,10 +110,14 @@ static void ParseVersion(const char* version, int* major, int* minor, int* patch
 }
 
 static bool VerifyCacheVersion(const std::string& so_path) {
-  // ensure we have _ORTInternal_GetCacheVersion_ function
-  void* f = GetFuncFromLibrary(so_path, "_ORTInternal_GetCacheVersion", /*throw_if_not_found*/ true);
-  if (f == nullptr)
+  // a cached dll without the _ORTInternal_GetCacheVersion function (or one that
+  // failed to load at all) is treated as a version mismatch and ignored
+  void* f = GetFuncFromLibrary(so_path, "_ORTInternal_GetCacheVersion", /*throw_if_not_found*/ false);
+  if (f == nullptr) {
+    LOGS_DEFAULT(CODEGEN_SETTINGS_LOG_LEVEL) << "Cannot find _ORTInternal_GetCacheVersion in " << so_path
+                                             << ", using JIT...";
     return false;
+  }
 
   typedef const char* (*GetVersionFunc)();
   GetVersionFunc func = reinterpret_cast<GetVersionFunc>(f);
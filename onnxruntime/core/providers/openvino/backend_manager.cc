@@ -72,9 +72,17 @@ BackendManager::BackendManager(const Provider_Node* fused_node, const logging::L
   subgraph_context_.subgraph_name = fused_node->Name();
   model_proto_ = GetModelProtoFromFusedNode(fused_node, logger);
 
+  // Batched inference compiles the network once for batch size 1 and slices the
+  // incoming batch over it at Compute time, so a single compilation serves every
+  // batch size. MYRIAD is excluded since it needs the VPU batch detection config.
+  const auto& device_type = GetGlobalContext().device_type;
+  const bool device_supports_batching =
+      device_type.find("HDDL") != std::string::npos ||
+      device_type == "CPU" || device_type == "GPU";
+
   if (ModelHasBatchedInputs(*model_proto_) &&
       GetGlobalContext().is_wholly_supported_graph &&
-      GetGlobalContext().device_type.find("HDDL") != std::string::npos) {
+      device_supports_batching) {
     subgraph_context_.enable_batching = true;
     LOGS_DEFAULT(INFO) << "[OpenVINO-EP] Model can be Batch inferenced \n";
     auto model_copy = ReWriteBatchDimWithOne(*model_proto_);
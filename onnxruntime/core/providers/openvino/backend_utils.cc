@@ -249,6 +249,23 @@ int GetFirstAvailableDevice(GlobalContext& global_context) {
   return i;
 }
 
+size_t DeduceBatchSize(Ort::CustomOpApi ort, const OrtValue* input_tensor,
+                       InferenceEngine::SizeVector graph_dims) {
+  size_t batch_size = 1;
+
+  // All the inputs and outputs are batched the same way.
+  // So it is sufficient to use any one of these tensors to deduce the batch size.
+  const auto& input_shape = ort.GetTensorShape(ort.GetTensorTypeAndShape(input_tensor));
+
+  if ((input_shape.size() == graph_dims.size() && input_shape[0] > 1 && graph_dims[0] == 1) || (input_shape.size() == graph_dims.size() + 1)) {
+    batch_size = input_shape[0];
+  }
+
+  LOGS_DEFAULT(INFO) << log_tag << "Deduced batch size: " << batch_size;
+
+  return batch_size;
+}
+
 #if (defined OPENVINO_2020_4) || (defined OPENVINO_2021_1)
 void FillOutputsWithConstantData(Ort::CustomOpApi& ort, std::shared_ptr<ngraph::Node> node, OrtValue* out_tensor) {
   switch (node->get_element_type()) {
@@ -52,6 +52,9 @@ GetOutputTensor(Ort::CustomOpApi& ort, OrtKernelContext* context, size_t batch_s
                 std::string output_name,
                 std::unordered_map<std::string, int> output_names);
 
+size_t DeduceBatchSize(Ort::CustomOpApi ort, const OrtValue* input_tensor,
+                       InferenceEngine::SizeVector graph_dims);
+
 void FillInputBlob(InferenceEngine::Blob::Ptr& inputBlob, size_t request_id, size_t batch_slice_idx,
                    std::string input_name, Ort::CustomOpApi& ort, OrtKernelContext* context,
                    InferenceEngine::Precision precision, const SubGraphContext& subgraph_context);
@@ -1,6 +1,7 @@
 // Copyright(C) 2019 Intel Corporation
 // Licensed under the MIT License
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <memory>
@@ -86,11 +87,13 @@ BasicBackend::BasicBackend(const Provider_ModelProto& model_proto,
   }
 #endif
   inferRequestsQueue_ = std::unique_ptr<InferRequestsQueue>(new InferRequestsQueue(exe_network, nireq));
+  nireq_ = nireq;
 }
 
 // Starts an asynchronous inference request for data in slice indexed by batch_slice_idx on
 // an Infer Request indexed by infer_req_idx
-void BasicBackend::StartAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* context, std::shared_ptr<InferenceEngine::InferRequest> infer_request) {
+void BasicBackend::StartAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* context, std::shared_ptr<InferenceEngine::InferRequest> infer_request,
+                                       size_t batch_slice_idx) {
   auto graph_input_info = ie_cnn_network_->getInputsInfo();
 
   size_t index = 0;
@@ -108,8 +111,7 @@ void BasicBackend::StartAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext*
       ORT_THROW(log_tag + " Cannot access IE Blob for input: " + input_name);
     }
     auto precision = input_info_iter->second->getPrecision();
-    size_t batch_slice = 0;
-    FillInputBlob(graph_input_blob, index, batch_slice, input_name, ort, context, precision, subgraph_context_);
+    FillInputBlob(graph_input_blob, index, batch_slice_idx, input_name, ort, context, precision, subgraph_context_);
   }
   // Start Async inference
   try {
@@ -123,7 +125,8 @@ void BasicBackend::StartAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext*
 
 // Wait for asynchronous inference completion on an Infer Request object indexed by infer_req_idx
 // and copy the results into a slice location within the batched output buffer indexed by batch_slice_idx
-void BasicBackend::CompleteAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* context, std::shared_ptr<InferenceEngine::InferRequest> infer_request) {
+void BasicBackend::CompleteAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* context, std::shared_ptr<InferenceEngine::InferRequest> infer_request,
+                                          size_t batch_slice_idx, size_t batch_size) {
   // Wait for Async inference completion
   try {
     infer_request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
@@ -146,12 +149,10 @@ void BasicBackend::CompleteAsyncInference(Ort::CustomOpApi& ort, OrtKernelContex
     } catch (...) {
       ORT_THROW(log_tag + " Cannot access IE Blob for output: " + output_name);
     }
-    size_t batch_size = 1;
     auto output_tensor = GetOutputTensor(ort, context, batch_size, infer_request, output_name, subgraph_context_.output_names);
     auto precision = output_info_iter->second->getPrecision();
 
-    size_t batch_slice = 0;
-    FillOutputBlob(graph_output_blob, output_tensor, ort, precision, batch_slice);
+    FillOutputBlob(graph_output_blob, output_tensor, ort, precision, batch_slice_idx);
   }
 #if defined(OPENVINO_2020_4) || defined(OPENVINO_2021_1)
   if (!const_outputs_map_.empty()) {
@@ -183,6 +184,38 @@ void BasicBackend::Infer(Ort::CustomOpApi& ort, OrtKernelContext* context) {
 #endif
     // Get Output tensors
     LOGS_DEFAULT(INFO) << log_tag << "Inference successful";
+  } else if (subgraph_context_.enable_batching) {
+      // The network was compiled once for batch size 1. Slice the incoming batch
+      // over the infer request pool like the VAD-M backend does, so no batch size
+      // ever triggers a re-import or recompilation of the network.
+
+      // Calculate the batch_size from the input tensor shape.
+      const OrtValue* tensor = ort.KernelContext_GetInput(context, subgraph_context_.input_indexes[0]);
+      size_t batch_size = DeduceBatchSize(ort, tensor,
+                                          ie_cnn_network_->getInputsInfo().begin()->second->getTensorDesc().getDims());
+
+      // Run the batch slices as sets of up to nireq_ parallel asynchronous inferences
+      for (size_t first_slice = 0; first_slice < batch_size; first_slice += nireq_) {
+        size_t set_size = std::min(nireq_, batch_size - first_slice);
+        std::vector<std::shared_ptr<InferenceEngine::InferRequest>> set_requests;
+        set_requests.reserve(set_size);
+        for (size_t i = 0; i < set_size; i++) {
+          auto infer_request = inferRequestsQueue_->getIdleRequest();
+          if (!infer_request) {
+            LOGS_DEFAULT(INFO) << "No idle Infer Requests found from the infer_requests_ pool!";
+            THROW_IE_EXCEPTION << "No idle Infer Requests!";
+          }
+          StartAsyncInference(ort, context, infer_request, first_slice + i);
+          set_requests.push_back(infer_request);
+        }
+        for (size_t i = 0; i < set_size; i++) {
+          CompleteAsyncInference(ort, context, set_requests[i], first_slice + i, batch_size);
+          inferRequestsQueue_->putIdleRequest(set_requests[i]);
+        }
+      }
+
+      // Get Output tensors
+      LOGS_DEFAULT(INFO) << log_tag << "Inference successful";
   } else {
       //Requesting for an idle infer_request from a pool of infer_requests_
       std::shared_ptr<InferenceEngine::InferRequest> infer_request = inferRequestsQueue_->getIdleRequest();
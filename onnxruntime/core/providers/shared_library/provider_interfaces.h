@@ -112,6 +112,43 @@ struct Provider_Node__EdgeIterator {
   virtual int GetDstArgIndex() const = 0;
 };
 
+// Caller-owned copy of the per-node data GetCapability typically reads.
+// Filling the whole snapshot is a single bridge crossing, where reading the
+// same data through the individual Provider_Node accessors is one virtual
+// call per field, which adds up to millions of cross library calls when
+// partitioning a large graph.
+struct Provider_NodeSnapshot {
+  struct Def {
+    std::string name;
+    std::string type;  // empty if the NodeArg has no type info
+    bool exists{false};
+  };
+
+  // Tensor and graph attribute values are not copied (their types are only
+  // accessible through the bridge anyway), use Provider_Node::GetAttributes for those
+  struct Attribute {
+    std::string name;
+    ONNX_NAMESPACE::AttributeProto_AttributeType type{};
+    int64_t i{0};
+    float f{0.f};
+    std::string s;
+    std::vector<int64_t> ints;
+    std::vector<float> floats;
+    std::vector<std::string> strings;
+  };
+
+  std::string name;
+  std::string op_type;
+  std::string domain;
+  NodeIndex index{0};
+  size_t input_edges_count{0};
+  size_t output_edges_count{0};
+  std::vector<Def> input_defs;
+  std::vector<Def> implicit_input_defs;
+  std::vector<Def> output_defs;
+  std::vector<Attribute> attributes;
+};
+
 #ifndef PROVIDER_BRIDGE_ORT
 // TODO: These are from execution_provider.h and should be factored out in the future into a common header
 using CreateFunctionStateFunc = std::function<int(ComputeContext*, FunctionState*)>;
@@ -428,6 +465,7 @@ struct ProviderHost {
   virtual void Provider_Node__ToProto(const Provider_Node* p, Provider_NodeProto& proto, bool update_subgraphs = false) = 0;
 
   virtual const Provider_NodeAttributes& Provider_Node__GetAttributes(const Provider_Node* p) noexcept = 0;
+  virtual void Provider_Node__GetSnapshot(const Provider_Node* p, Provider_NodeSnapshot& snapshot) = 0;
   virtual size_t Provider_Node__GetInputEdgesCount(const Provider_Node* p) noexcept = 0;
   virtual size_t Provider_Node__GetOutputEdgesCount(const Provider_Node* p) noexcept = 0;
 
@@ -918,6 +956,11 @@ struct Provider_Node {
   void ToProto(Provider_NodeProto& proto, bool update_subgraphs = false) const { return g_host->Provider_Node__ToProto(this, proto, update_subgraphs); }
 
   const Provider_NodeAttributes& GetAttributes() const noexcept { return g_host->Provider_Node__GetAttributes(this); }
+
+  // Copy everything GetCapability typically reads into a caller-owned snapshot
+  // in one bridge crossing, instead of one virtual call per accessor
+  void GetSnapshot(Provider_NodeSnapshot& snapshot) const { g_host->Provider_Node__GetSnapshot(this, snapshot); }
+
   size_t GetInputEdgesCount() const noexcept { return g_host->Provider_Node__GetInputEdgesCount(this); }
   size_t GetOutputEdgesCount() const noexcept { return g_host->Provider_Node__GetOutputEdgesCount(this); }
 
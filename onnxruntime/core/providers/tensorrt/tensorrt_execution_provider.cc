@@ -49,6 +49,35 @@ std::string GetVecHash(const std::string& vec) {
   return std::to_string(ret);
 }
 
+/*
+* Round a dynamic dimension down/up to the nearest power-of-two bucket boundary.
+* When shape range buckets are enabled, an out-of-range shape widens the optimization
+* profile to the whole bucket instead of just the observed value, so the engine built
+* for it also covers every other shape in the bucket and the next unseen production
+* shape hits a warm engine instead of triggering another multi-second rebuild.
+*/
+int64_t RoundDownToShapeBucket(int64_t value) {
+  if (value <= 1) {
+    return value;
+  }
+  int64_t bucket = 1;
+  while (bucket * 2 <= value) {
+    bucket *= 2;
+  }
+  return bucket;
+}
+
+int64_t RoundUpToShapeBucket(int64_t value) {
+  if (value <= 1) {
+    return value;
+  }
+  int64_t bucket = 1;
+  while (bucket < value) {
+    bucket *= 2;
+  }
+  return bucket;
+}
+
 float ConvertSinglePrecisionIEEE754ToFloat(unsigned long input) {
   int s = (input >> 31) & 0x01;
   int e = ((input & 0x7f800000) >> 23) - 127;
@@ -442,6 +471,11 @@ TensorrtExecutionProvider::TensorrtExecutionProvider(const TensorrtExecutionProv
     engine_cache_enable_ = (std::stoi(engine_cache_enable_env) == 0 ? false : true);
   }
 
+  const std::string shape_range_buckets_env = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kShapeRangeBuckets);
+  if (!shape_range_buckets_env.empty()) {
+    shape_range_buckets_enable_ = (std::stoi(shape_range_buckets_env) == 0 ? false : true);
+  }
+
   if (engine_cache_enable_ || int8_enable_) {
     const std::string engine_cache_path = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kEngineCachePath);
     cache_path_ = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kCachePath);
@@ -1134,7 +1168,7 @@ common::Status TensorrtExecutionProvider::Provider_Compile(const std::vector<onn
             &networks_[context->node_name], input_info_[context->node_name], output_info_[context->node_name],
             input_shape_ranges_[context->node_name], &tensorrt_mu_, &fp16_enable_, &int8_enable_, &max_workspace_size_,
             trt_node_name_with_precision, engine_cache_enable_, cache_path_, runtime_,
-            allocator_, dynamic_range_map};
+            allocator_, dynamic_range_map, shape_range_buckets_enable_};
       *state = p.release();
       return 0;
     };
@@ -1261,29 +1295,42 @@ common::Status TensorrtExecutionProvider::Provider_Compile(const std::vector<onn
                 shapes_max[j] = shape_range[j].second;
 
                 const auto& tensor_shape_value = tensor_shape_values[input_name][j];
-                // Update shape range lower bound
+                // Update shape range lower bound, widened to the bucket boundary if buckets are enabled
                 if (tensor_shape_value < shape_range[j].first) {
-                  shape_range[j].first = tensor_shape_value;
-                  shapes_min[j] = tensor_shape_value;
+                  const int32_t range_min = trt_state->shape_range_buckets_enable
+                                                ? static_cast<int32_t>(RoundDownToShapeBucket(tensor_shape_value))
+                                                : tensor_shape_value;
+                  shape_range[j].first = range_min;
+                  shapes_min[j] = range_min;
                   dimension_update[input_name] = true;
                 }
-                // Update shape range upper bound
+                // Update shape range upper bound; the opt shape stays at the observed value
                 if (tensor_shape_value > shape_range[j].second) {
-                  shape_range[j].second = tensor_shape_value;
-                  shapes_max[j] = tensor_shape_value;
+                  const int32_t range_max = trt_state->shape_range_buckets_enable
+                                                ? static_cast<int32_t>(RoundUpToShapeBucket(tensor_shape_value))
+                                                : tensor_shape_value;
+                  shape_range[j].second = range_max;
+                  shapes_max[j] = range_max;
                   shapes_opt[j] = tensor_shape_value;
                   dimension_update[input_name] = true;
                 }
               }
             } else {
               // If shape size doesn't match, initialize shape_range with the new shape value
+              // (widened to its bucket when buckets are enabled)
               shape_range.clear();
               for (int j = 0; j < shape_size; ++j) {
                 const auto& tensor_shape_value = tensor_shape_values[input_name][j];
-                shape_range[j] = std::make_pair(tensor_shape_value, tensor_shape_value);
-                shapes_min[j] = tensor_shape_value;
+                const int32_t range_min = trt_state->shape_range_buckets_enable
+                                              ? static_cast<int32_t>(RoundDownToShapeBucket(tensor_shape_value))
+                                              : tensor_shape_value;
+                const int32_t range_max = trt_state->shape_range_buckets_enable
+                                              ? static_cast<int32_t>(RoundUpToShapeBucket(tensor_shape_value))
+                                              : tensor_shape_value;
+                shape_range[j] = std::make_pair(range_min, range_max);
+                shapes_min[j] = range_min;
                 shapes_opt[j] = tensor_shape_value;
-                shapes_max[j] = tensor_shape_value;
+                shapes_max[j] = range_max;
               }
               dimension_update[input_name] = true;
             }
@@ -1303,16 +1350,22 @@ common::Status TensorrtExecutionProvider::Provider_Compile(const std::vector<onn
                 dims_opt.d[j] = shape_range[j].second;
                 dims_max.d[j] = shape_range[j].second;
 
-                // Update minimum dimension
+                // Update minimum dimension, widened to the bucket boundary if buckets are enabled
                 if (tensor_shape < shape_range[j].first) {
-                  shape_range[j].first = tensor_shape;
-                  dims_min.d[j] = tensor_shape;
+                  const int64_t range_min = trt_state->shape_range_buckets_enable
+                                                ? RoundDownToShapeBucket(tensor_shape)
+                                                : tensor_shape;
+                  shape_range[j].first = range_min;
+                  dims_min.d[j] = range_min;
                   dimension_update[input_name] = true;
                 }
-                // Update maximum dimension
+                // Update maximum dimension; the opt shape stays at the observed value
                 if (tensor_shape > shape_range[j].second) {
-                  shape_range[j].second = tensor_shape;
-                  dims_max.d[j] = tensor_shape;
+                  const int64_t range_max = trt_state->shape_range_buckets_enable
+                                                ? RoundUpToShapeBucket(tensor_shape)
+                                                : tensor_shape;
+                  shape_range[j].second = range_max;
+                  dims_max.d[j] = range_max;
                   dims_opt.d[j] = tensor_shape;
                   dimension_update[input_name] = true;
                 }
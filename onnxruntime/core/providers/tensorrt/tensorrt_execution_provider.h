@@ -20,6 +20,7 @@ static const std::string kINT8UseNativeTensorrtCalibrationTable = "ORT_TENSORRT_
 static const std::string kDumpSubgraphs = "ORT_TENSORRT_DUMP_SUBGRAPHS";
 static const std::string kEngineCacheEnable = "ORT_TENSORRT_ENGINE_CACHE_ENABLE";
 static const std::string kCachePath = "ORT_TENSORRT_CACHE_PATH";
+static const std::string kShapeRangeBuckets = "ORT_TENSORRT_SHAPE_RANGE_BUCKETS";
 // Old env variable for backward compatibility
 static const std::string kEngineCachePath = "ORT_TENSORRT_ENGINE_CACHE_PATH";
 }  // namespace tensorrt_env_vars
@@ -92,6 +93,7 @@ struct TensorrtFuncState {
   nvinfer1::IRuntime* runtime = nullptr;
   AllocatorPtr scratch_allocator;
   std::unordered_map<std::string, float> dynamic_range_map;
+  bool shape_range_buckets_enable;
 };
 
 // Logical device representation.
@@ -125,6 +127,7 @@ class TensorrtExecutionProvider : public Provider_IExecutionProvider {
   bool dump_subgraphs_ = false;
   bool engine_cache_enable_ = false;
   std::string cache_path_;
+  bool shape_range_buckets_enable_ = false;
   nvinfer1::IRuntime* runtime_ = nullptr;
 
   OrtMutex tensorrt_mu_;
@@ -19,26 +19,51 @@ static std::pair<bool, size_t> Contains(const std::vector<std::string>& names, c
   return {true, it - std::begin(names)};
 }
 
-common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_value) {
-  auto rc = Contains(feed_names_, name);
+common::Status IOBinding::BindInputImpl(const std::string& name, const OrtValue& ml_value,
+                                        std::vector<std::string>& names, std::vector<OrtValue>& values) {
+  auto rc = Contains(names, name);
 
-  auto add_or_replace = [this, &name](const bool exists, size_t index, const OrtValue& value) {
+  auto add_or_replace = [&names, &name](const bool exists, size_t index, const OrtValue& value,
+                                        std::vector<OrtValue>& values) {
     if (exists) {
-      feeds_[index] = value;
+      values[index] = value;
     } else {
-      feed_names_.push_back(name);
-      feeds_.push_back(value);
+      names.push_back(name);
+      values.push_back(value);
     }
   };
 
   if (ml_value.IsTensor()) {
     OrtValue new_mlvalue;
     ORT_RETURN_IF_ERROR(utils::CopyOneInputAcrossDevices(session_state_, name, ml_value, new_mlvalue));
-    add_or_replace(rc.first, rc.second, new_mlvalue);
+    add_or_replace(rc.first, rc.second, new_mlvalue, values);
   } else {
-    add_or_replace(rc.first, rc.second, ml_value);
+    add_or_replace(rc.first, rc.second, ml_value, values);
+  }
+
+  return Status::OK();
+}
+
+common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_value) {
+  return BindInputImpl(name, ml_value, feed_names_, feeds_);
+}
+
+common::Status IOBinding::StageInput(const std::string& name, const OrtValue& ml_value) {
+  return BindInputImpl(name, ml_value, staged_feed_names_, staged_feeds_);
+}
+
+common::Status IOBinding::PromoteStagedInputs() {
+  for (size_t i = 0, end = staged_feed_names_.size(); i < end; ++i) {
+    auto rc = Contains(feed_names_, staged_feed_names_[i]);
+    if (rc.first) {
+      feeds_[rc.second] = std::move(staged_feeds_[i]);
+    } else {
+      feed_names_.push_back(std::move(staged_feed_names_[i]));
+      feeds_.push_back(std::move(staged_feeds_[i]));
+    }
   }
 
+  ClearStagedInputs();
   return Status::OK();
 }
 
@@ -47,8 +72,14 @@ void IOBinding::ClearInputs() {
   feeds_.clear();
 }
 
-static common::Status SyncProviders(const SessionState::NameNodeInfoMapType& node_info_map,
-                                    const SessionState& session_state) {
+void IOBinding::ClearStagedInputs() {
+  staged_feed_names_.clear();
+  staged_feeds_.clear();
+}
+
+template <typename TProviderFunc>
+static common::Status ForEachProvider(const SessionState::NameNodeInfoMapType& node_info_map,
+                                      const SessionState& session_state, TProviderFunc func) {
   std::set<std::string> providers;
   for (auto& pair : node_info_map) {
     for (auto& node_info : pair.second) {
@@ -63,21 +94,54 @@ static common::Status SyncProviders(const SessionState::NameNodeInfoMapType& nod
       continue;
     }
 
-    ORT_RETURN_IF_ERROR(p_provider->Sync());
+    ORT_RETURN_IF_ERROR(func(*p_provider));
   }
   return Status::OK();
 }
 
+static common::Status SyncProviders(const SessionState::NameNodeInfoMapType& node_info_map,
+                                    const SessionState& session_state) {
+  return ForEachProvider(node_info_map, session_state,
+                         [](IExecutionProvider& provider) { return provider.Sync(); });
+}
+
 common::Status IOBinding::SynchronizeInputs() {
   ORT_RETURN_IF_ERROR(SyncProviders(session_state_.GetInputNodeInfoMap(), session_state_));
   return Status::OK();
 }
 
+common::Status IOBinding::SynchronizeStagedInputs() {
+  // staged copies go through the same providers as bound ones, so the same barrier applies
+  ORT_RETURN_IF_ERROR(SyncProviders(session_state_.GetInputNodeInfoMap(), session_state_));
+  return Status::OK();
+}
+
 common::Status IOBinding::SynchronizeOutputs() {
   ORT_RETURN_IF_ERROR(SyncProviders(session_state_.GetOutputNodeInfoMap(), session_state_));
   return Status::OK();
 }
 
+common::Status IOBinding::RecordOutputsCompletion() {
+  return ForEachProvider(session_state_.GetOutputNodeInfoMap(), session_state_,
+                         [](IExecutionProvider& provider) { return provider.RecordRunCompletion(); });
+}
+
+common::Status IOBinding::PollOutputsCompletion(bool& completed) {
+  completed = true;
+  return ForEachProvider(session_state_.GetOutputNodeInfoMap(), session_state_,
+                         [&completed](IExecutionProvider& provider) {
+                           bool provider_completed = false;
+                           ORT_RETURN_IF_ERROR(provider.PollRunCompletion(provider_completed));
+                           completed = completed && provider_completed;
+                           return Status::OK();
+                         });
+}
+
+common::Status IOBinding::WaitOutputsCompletion() {
+  return ForEachProvider(session_state_.GetOutputNodeInfoMap(), session_state_,
+                         [](IExecutionProvider& provider) { return provider.WaitRunCompletion(); });
+}
+
 common::Status IOBinding::BindOutput(const std::string& name, const OrtValue& ml_value) {
   // device value is ignored when ml_value is pre-allocated
   return BindOutputImpl(name, ml_value, {});
@@ -59,6 +59,49 @@ class IOBinding {
   common::Status SynchronizeInputs();
   common::Status SynchronizeOutputs();
 
+  /**
+    * Double-buffered variant of BindInput. The value is copied/converted to the desired device
+    * like BindInput, but into a staging slot that is invisible to Run(), so the next request's
+    * feeds can be prepared (including async H2D copies) while the current Run is still
+    * executing against the bound inputs. Call from a single staging thread only; IOBinding
+    * itself is not thread safe.
+    */
+  common::Status StageInput(const std::string& name, const OrtValue& ml_value);
+
+  /**
+    * Barrier for copies issued by StageInput, analogous to SynchronizeInputs().
+    */
+  common::Status SynchronizeStagedInputs();
+
+  /**
+    * Makes the staged feeds the bound inputs for the next Run, replacing bound inputs with the
+    * same name, and clears the staging slots. Call between Run() calls, after the previous Run
+    * has returned.
+    */
+  common::Status PromoteStagedInputs();
+
+  /**
+    * Event-style completion tracking for a Run whose outputs are bound to device memory.
+    * Run() returns once the device work has been submitted; call RecordOutputsCompletion()
+    * right after Run() to mark the end of that work, then poll or wait on the marker. Unlike
+    * SynchronizeOutputs() this does not block on work submitted to the device afterwards,
+    * so the caller can already be feeding the next request (e.g. its H2D input copies)
+    * while waiting for the previous Run to drain.
+    */
+  common::Status RecordOutputsCompletion();
+
+  /**
+    * Non-blocking check of the marker recorded by RecordOutputsCompletion().
+    * Sets completed to true once all providers producing bound outputs have finished
+    * the work covered by the marker.
+    */
+  common::Status PollOutputsCompletion(bool& completed);
+
+  /**
+    * Blocks until the work covered by RecordOutputsCompletion() has finished.
+    */
+  common::Status WaitOutputsCompletion();
+
   /**
     * Bind an output name to a provided pre-allocated OrtValue. 
     */
@@ -92,6 +135,7 @@ class IOBinding {
     */
   void ClearOutputs();
   void ClearInputs();
+  void ClearStagedInputs();
 
  private:
   friend InferenceSession;
@@ -100,6 +144,9 @@ class IOBinding {
   const SessionState& session_state_;
   std::vector<std::string> feed_names_;
   std::vector<OrtValue> feeds_;
+  // staging slots for the next request's feeds; promoted into feed_names_/feeds_ between Runs
+  std::vector<std::string> staged_feed_names_;
+  std::vector<OrtValue> staged_feeds_;
   std::vector<std::string> output_names_;
   std::vector<OrtValue> outputs_;
   std::vector<OrtDevice> outputs_device_info_;
@@ -111,5 +158,10 @@ class IOBinding {
 
   // The implementation for the BindOutput() overloads
   common::Status BindOutputImpl(const std::string& name, const OrtValue& ml_value, OrtDevice device);
+
+  // The implementation for BindInput()/StageInput(); copies the value across devices into the
+  // given name/value vectors
+  common::Status BindInputImpl(const std::string& name, const OrtValue& ml_value,
+                               std::vector<std::string>& names, std::vector<OrtValue>& values);
 };
 }  // namespace onnxruntime
@@ -3,6 +3,8 @@
 
 #include "core/session/environment.h"
 #include "core/framework/allocatormgr.h"
+#include "core/framework/prepacked_weights_container.h"
+#include "core/framework/session_state_utils.h"
 #include "core/graph/constants.h"
 #include "core/graph/op.h"
 #if !defined(ORT_MINIMAL_BUILD)
@@ -44,6 +46,9 @@ using namespace ONNX_NAMESPACE;
 
 std::once_flag schemaRegistrationOnceFlag;
 
+// out of line as PrepackedWeightsContainer and InitializerDedupCache are only forward declared in the header
+Environment::~Environment() = default;
+
 Status Environment::Create(std::unique_ptr<logging::LoggingManager> logging_manager,
                            std::unique_ptr<Environment>& environment,
                            const OrtThreadingOptions* tp_options,
@@ -53,6 +58,25 @@ Status Environment::Create(std::unique_ptr<logging::LoggingManager> logging_mana
   return status;
 }
 
+session_state_utils::InitializerDedupCache& Environment::GetInitializerDedupCache(
+    const std::string& group_name) const {
+  std::lock_guard<OrtMutex> lock(dedup_groups_mutex_);
+  auto& cache = initializer_dedup_groups_[group_name];
+  if (!cache) {
+    cache = onnxruntime::make_unique<session_state_utils::InitializerDedupCache>();
+    // same ownership rules as the default env owned cache
+    cache->cross_session = true;
+  }
+  return *cache;
+}
+
+void Environment::ReleaseInitializerDedupCacheGroup(const std::string& group_name) {
+  std::lock_guard<OrtMutex> lock(dedup_groups_mutex_);
+  // safe to drop while sessions from the group are still alive: their OrtValue copies
+  // keep the shared buffers reference counted
+  initializer_dedup_groups_.erase(group_name);
+}
+
 Status Environment::RegisterAllocator(AllocatorPtr allocator) {
   const auto& mem_info = allocator->Info();
   // We don't expect millions of allocators getting registered. Hence linear search should be fine.
@@ -133,6 +157,10 @@ Status Environment::Initialize(std::unique_ptr<logging::LoggingManager> logging_
   auto status = Status::OK();
 
   logging_manager_ = std::move(logging_manager);
+  prepacked_weights_container_ = onnxruntime::make_unique<PrepackedWeightsContainer>();
+  initializer_dedup_cache_ = onnxruntime::make_unique<session_state_utils::InitializerDedupCache>();
+  // entries of the env owned cache must own their buffers and outlive the sessions populating it
+  initializer_dedup_cache_->cross_session = true;
 
   // create thread pools
   if (create_global_thread_pools) {
@@ -13,7 +13,9 @@
 
 #include "core/common/denormal.h"
 #include "core/common/logging/logging.h"
+#include "core/framework/allocation_audit.h"
 #include "core/framework/allocatormgr.h"
+#include "core/framework/arena.h"
 #include "core/framework/error_code_helper.h"
 #include "core/framework/execution_frame.h"
 #include "core/framework/feeds_fetches_manager.h"
@@ -21,11 +23,16 @@
 #include "core/framework/kernel_def_builder.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/mldata_type_utils.h"
+#include "core/framework/node_timing_cache.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/tensor_type_and_shape.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/prepacked_weights_container.h"
+#include "core/framework/random_seed.h"
+#include "core/framework/run_capture.h"
+#include "core/framework/sequential_execution_plan.h"
 #include "core/framework/utils.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
@@ -106,7 +113,9 @@ std::atomic<uint32_t> InferenceSession::global_session_id_{1};
 // See onnxruntime/core/session/flatbuffers/schema/README.md for more details on versioning.
 // Version 1 - history begins
 // Version 2 - add serailization/deserialization of sparse_initializer
-static constexpr const char* kOrtModelVersion = "2";
+// Version 3 - add serialization/deserialization of the execution plan
+// Version 4 - add optional zlib compressed initializer data
+static constexpr const char* kOrtModelVersion = "4";
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 // Check if the given ort model version is supported in this build
@@ -116,6 +125,8 @@ static bool IsOrtModelVersionSupported(const std::string& ort_model_version) {
   static const std::unordered_set<std::string> kSupportedOrtModelVersions{
       std::string("1.4.0"),  // This is a special model version for existing converted model
       std::string("1"),
+      std::string("2"),
+      std::string("3"),
       std::string(kOrtModelVersion),
   };
 
@@ -193,6 +204,24 @@ static Status FinalizeSessionOptions(const SessionOptions& user_provided_session
   return Status::OK();
 }
 
+// Parses a comma separated list of logical processor ids, e.g. "0,1,8,9".
+// Returns false if the value is empty or any entry is not a non-negative integer.
+static bool ParseThreadAffinityList(const std::string& value, std::vector<size_t>& affinities) {
+  affinities.clear();
+  std::istringstream stream(value);
+  std::string token;
+  while (std::getline(stream, token, ',')) {
+    std::istringstream token_stream(token);
+    size_t processor_id = 0;
+    if (!(token_stream >> processor_id) || !(token_stream >> std::ws).eof()) {
+      return false;
+    }
+    affinities.push_back(processor_id);
+  }
+
+  return !affinities.empty();
+}
+
 void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
                                          const Environment& session_env) {
   auto status = FinalizeSessionOptions(session_options, model_proto_, is_model_proto_parsed_, session_options_);
@@ -230,10 +259,32 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
     LOGS(*session_logger_, INFO) << "Creating and using per session threadpools since use_per_session_threads_ is true";
     {
       OrtThreadPoolParams to = session_options_.intra_op_param;
+      std::vector<size_t> intra_op_thread_affinities;
       if (to.name == nullptr) {
         to.name = ORT_TSTR("intra-op");
       }
       to.set_denormal_as_zero = set_denormal_as_zero;
+
+      // An explicit processor list pins each intra-op thread to one processor. With the processors
+      // of a single NUMA node listed, the threads and the arena memory they touch first stay on
+      // that node under the OS first-touch page placement policy.
+      const std::string affinity_config =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpThreadAffinities, "");
+      if (!affinity_config.empty() && to.affinity_vec_len == 0) {
+        if (ParseThreadAffinityList(affinity_config, intra_op_thread_affinities) &&
+            (to.thread_pool_size == 0 ||
+             static_cast<size_t>(to.thread_pool_size) == intra_op_thread_affinities.size())) {
+          to.thread_pool_size = static_cast<int>(intra_op_thread_affinities.size());
+          to.affinity_vec = intra_op_thread_affinities.data();
+          to.affinity_vec_len = intra_op_thread_affinities.size();
+        } else {
+          LOGS(*session_logger_, WARNING) << "Ignoring " << kOrtSessionOptionsConfigIntraOpThreadAffinities
+                                          << " value of '" << affinity_config
+                                          << "'. It must be a comma separated list of processor ids whose "
+                                             "length matches the configured intra-op thread count.";
+        }
+      }
+
       // If the thread pool can use all the processors, then
       // we set affinity of each thread to each processor.
       to.auto_set_affinity = to.thread_pool_size == 0 &&
@@ -371,6 +422,13 @@ InferenceSession::~InferenceSession() {
     }
   }
 
+  if (node_timing_cache_ != nullptr && !node_timing_cache_->Empty()) {
+    auto status = node_timing_cache_->Save(node_timing_cache_path_);
+    if (!status.IsOK()) {
+      LOGS(*session_logger_, ERROR) << "Failed to save node timing cache: " << status.ErrorMessage();
+    }
+  }
+
 #ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
   if (session_activity_started_)
     TraceLoggingWriteStop(session_activity, "OrtInferenceSessionActivity");
@@ -416,12 +474,13 @@ common::Status InferenceSession::RegisterExecutionProvider(std::unique_ptr<IExec
   }
 
   if (provider_type == onnxruntime::kCudaExecutionProvider) {
-    // Parallel execution mode does not support the CUDA EP
     if (session_options_.execution_mode != ExecutionMode::ORT_SEQUENTIAL) {
-      LOGS(*session_logger_, WARNING)
-          << "Parallel execution mode does not support the CUDA Execution Provider. "
-          << "So making the execution mode sequential for this session since it uses the CUDA Execution Provider.";
-      session_options_.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+      // each inter-op worker thread launches on its own per-thread default stream, and the
+      // allocation planner fences every value CUDA nodes touch so cross-stream reads wait on the
+      // producing stream's event and buffers are only released once the device is done with them
+      LOGS(*session_logger_, INFO)
+          << "Parallel execution with the CUDA Execution Provider runs independent branches "
+          << "on separate streams with event-based synchronization at the join points.";
     }
   }
 
@@ -505,10 +564,19 @@ common::Status InferenceSession::SaveToOrtFormat(const std::basic_string<ORTCHAR
   ORT_RETURN_IF_ERROR(
       session_state_->SaveToOrtFormat(builder, session_state));
 
+  flatbuffers::Offset<fbs::PrePackedWeightsData> prepacked_weights;
+  if (session_prepacked_weights_container_ != nullptr &&
+      !session_prepacked_weights_container_->GetWeightsMap().empty()) {
+    ORT_RETURN_IF_ERROR(SavePrepackedWeightsToOrtFormat(builder, prepacked_weights));
+  }
+
   fbs::InferenceSessionBuilder sb(builder);
   sb.add_ort_version(ort_model_version);
   sb.add_model(model);
   sb.add_session_state(session_state);
+  if (!prepacked_weights.IsNull()) {
+    sb.add_prepacked_weights(prepacked_weights);
+  }
   auto session = sb.Finish();
   builder.Finish(session, fbs::InferenceSessionIdentifier());
 
@@ -525,6 +593,38 @@ common::Status InferenceSession::SaveToOrtFormat(const std::basic_string<ORTCHAR
   return Status::OK();
 }
 
+common::Status InferenceSession::SavePrepackedWeightsToOrtFormat(
+    flatbuffers::FlatBufferBuilder& builder,
+    flatbuffers::Offset<fbs::PrePackedWeightsData>& fbs_prepacked_weights) const {
+  const auto& weights_map = session_prepacked_weights_container_->GetWeightsMap();
+
+  std::vector<flatbuffers::Offset<fbs::PrePackedWeight>> fbs_weights;
+  fbs_weights.reserve(weights_map.size());
+
+  for (const auto& entry : weights_map) {
+    const PrePackedWeights& packed_weight = entry.second;
+
+    std::vector<flatbuffers::Offset<fbs::PrePackedBuffer>> fbs_buffers;
+    fbs_buffers.reserve(packed_weight.buffers_.size());
+    for (size_t i = 0; i < packed_weight.buffers_.size(); ++i) {
+      auto data = builder.CreateVector(static_cast<const uint8_t*>(packed_weight.buffers_[i].get()),
+                                       packed_weight.buffer_sizes_[i]);
+      fbs_buffers.push_back(fbs::CreatePrePackedBuffer(builder, data));
+    }
+
+    fbs_weights.push_back(fbs::CreatePrePackedWeight(builder,
+                                                     builder.CreateString(entry.first),
+                                                     builder.CreateVector(fbs_buffers)));
+  }
+
+  fbs_prepacked_weights = fbs::CreatePrePackedWeightsData(
+      builder,
+      builder.CreateString(GenerateCpuFingerprintForPrepackedWeights()),
+      builder.CreateVectorOfSortedTables(&fbs_weights));
+
+  return Status::OK();
+}
+
 common::Status InferenceSession::Load(std::function<common::Status(std::shared_ptr<Model>&)> loader,
                                       const std::string& event_name) {
   Status status = Status::OK();
@@ -887,6 +987,19 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
 
   std::vector<std::string> provider_types;
   for (auto& provider_ptr : providers) {
+    // A provider advertises where its tensors live through its default allocator. If that memory
+    // is plain host memory (device-mapped or unified addressing), CPU kernels can touch the
+    // provider's tensors directly and no Memcpy nodes are needed for it, regardless of whether
+    // the provider is on the by-name CPU-based list.
+    if (!utils::ProviderIsCpuBased(provider_ptr->Type())) {
+      const auto& allocator = provider_ptr->GetAllocator(0, OrtMemTypeDefault);
+      if (allocator != nullptr && allocator->Info().device.Type() == OrtDevice::CPU) {
+        LOGS(*session_logger_, VERBOSE) << "Provider [" << provider_ptr->Type()
+                                        << "] uses host-accessible memory; skipping Memcpy node insertion for it.";
+        continue;
+      }
+    }
+
     provider_types.push_back(provider_ptr->Type());
   }
 
@@ -923,21 +1036,18 @@ Status InferenceSession::PartitionOrtFormatModel(onnxruntime::Graph& graph,
 template <typename T>
 static Status LoadOrtModelBytes(const std::basic_string<T>& model_uri,
                                 std::basic_string<ORTCHAR_T>& model_location,
-                                std::vector<uint8_t>& bytes) {
+                                Env::MappedMemoryPtr& mapped_bytes,
+                                gsl::span<const uint8_t>& bytes) {
   size_t num_bytes = 0;
   model_location = ToWideString(model_uri);
   ORT_RETURN_IF_ERROR(Env::Default().GetFileLength(model_location.c_str(), num_bytes));
 
-  bytes.resize(num_bytes);
-
-  std::ifstream bytes_stream(model_uri, std::ifstream::in | std::ifstream::binary);
-  bytes_stream.read(reinterpret_cast<char*>(bytes.data()), num_bytes);
+  // map the file instead of reading it into a buffer. the flatbuffer is accessed in place,
+  // so for a large model this avoids paying for a full read + copy of the file during session
+  // creation, and pages are only faulted in as the corresponding parts of the model are used.
+  ORT_RETURN_IF_ERROR(Env::Default().MapFileIntoMemory(model_location.c_str(), 0, num_bytes, mapped_bytes));
 
-  if (!bytes_stream) {
-    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
-                           "Load model from ", ToMBString(model_uri), " failed. Only ",
-                           bytes_stream.gcount(), "/", num_bytes, " bytes were able to be read.");
-  }
+  bytes = gsl::make_span(reinterpret_cast<const uint8_t*>(mapped_bytes.get()), num_bytes);
 
   return Status::OK();
 }
@@ -945,7 +1055,8 @@ static Status LoadOrtModelBytes(const std::basic_string<T>& model_uri,
 Status InferenceSession::LoadOrtModel(const std::string& model_uri) {
   return LoadOrtModel(
       [&]() {
-        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_, ort_format_model_bytes_));
+        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_,
+                                              ort_format_model_mapped_bytes_, ort_format_model_bytes_span_));
         return Status::OK();
       });
 }
@@ -954,7 +1065,8 @@ Status InferenceSession::LoadOrtModel(const std::string& model_uri) {
 Status InferenceSession::LoadOrtModel(const std::wstring& model_uri) {
   return LoadOrtModel(
       [&]() {
-        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_, ort_format_model_bytes_));
+        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_,
+                                              ort_format_model_mapped_bytes_, ort_format_model_bytes_span_));
         return Status::OK();
       });
 }
@@ -968,6 +1080,7 @@ Status InferenceSession::LoadOrtModel(const void* model_data, int model_data_len
     // and/or a combined Load+Initialize where we don't need this temporary copy.
     ort_format_model_bytes_.resize(model_data_len);
     std::copy_n(reinterpret_cast<const uint8_t*>(model_data), model_data_len, ort_format_model_bytes_.data());
+    ort_format_model_bytes_span_ = gsl::make_span(ort_format_model_bytes_.data(), ort_format_model_bytes_.size());
 
     return Status::OK();
   });
@@ -992,11 +1105,11 @@ Status InferenceSession::LoadOrtModel(std::function<Status()> load_ort_format_mo
 
   ORT_RETURN_IF_ERROR(load_ort_format_model_bytes());
 
-  // Verify the ort_format_model_bytes_ is a valid InferenceSessionBuffer before we access the data
-  flatbuffers::Verifier verifier(ort_format_model_bytes_.data(), ort_format_model_bytes_.size());
+  // Verify the ort_format_model_bytes_span_ is a valid InferenceSessionBuffer before we access the data
+  flatbuffers::Verifier verifier(ort_format_model_bytes_span_.data(), ort_format_model_bytes_span_.size());
   ORT_RETURN_IF_NOT(fbs::VerifyInferenceSessionBuffer(verifier));
 
-  const auto* fbs_session = fbs::GetInferenceSession(ort_format_model_bytes_.data());
+  const auto* fbs_session = fbs::GetInferenceSession(ort_format_model_bytes_span_.data());
   ORT_RETURN_IF(nullptr == fbs_session, "InferenceSession is null. Invalid ORT format model.");
 
   // Check version mismatch, for now we will only proceed when runtime version matches the model's ort version
@@ -1023,6 +1136,63 @@ Status InferenceSession::LoadOrtModel(std::function<Status()> load_ort_format_mo
 
   return Status::OK();
 }
+
+common::Status InferenceSession::LoadPrepackedWeightsFromOrtFormat(
+    const fbs::PrePackedWeightsData& fbs_prepacked_weights) {
+  const auto* fbs_cpu_fingerprint = fbs_prepacked_weights.cpu_fingerprint();
+  ORT_RETURN_IF(nullptr == fbs_cpu_fingerprint,
+                "CPU fingerprint for pre-packed weights is null. Invalid ORT format model.");
+
+  if (fbs_cpu_fingerprint->str() != GenerateCpuFingerprintForPrepackedWeights()) {
+    // packed for a different CPU. ignore the stored buffers and let the kernels re-pack as usual.
+    LOGS(*session_logger_, INFO) << "Ignoring pre-packed weights in the ORT format model as they were packed for a "
+                                    "CPU with different capabilities.";
+    return Status::OK();
+  }
+
+  const auto* fbs_weights = fbs_prepacked_weights.weights();
+  if (fbs_weights == nullptr || fbs_weights->size() == 0) {
+    return Status::OK();
+  }
+
+  auto container = onnxruntime::make_unique<PrepackedWeightsContainer>();
+  AllocatorPtr allocator = container->GetAllocator();
+
+  for (const auto* fbs_weight : *fbs_weights) {
+    ORT_RETURN_IF(nullptr == fbs_weight, "Pre-packed weight is null. Invalid ORT format model.");
+
+    const auto* fbs_key = fbs_weight->key();
+    const auto* fbs_buffers = fbs_weight->buffers();
+    ORT_RETURN_IF(nullptr == fbs_key || nullptr == fbs_buffers,
+                  "Pre-packed weight is missing key or buffers. Invalid ORT format model.");
+
+    PrePackedWeights packed_weight;
+    packed_weight.buffers_.reserve(fbs_buffers->size());
+    packed_weight.buffer_sizes_.reserve(fbs_buffers->size());
+
+    for (const auto* fbs_buffer : *fbs_buffers) {
+      ORT_RETURN_IF(nullptr == fbs_buffer || nullptr == fbs_buffer->data(),
+                    "Pre-packed buffer is null. Invalid ORT format model.");
+
+      const auto* fbs_buffer_data = fbs_buffer->data();
+      const size_t size = fbs_buffer_data->size();
+      void* data = allocator->Alloc(size);
+      memcpy(data, fbs_buffer_data->Data(), size);
+      packed_weight.buffers_.emplace_back(data, BufferDeleter(allocator));
+      packed_weight.buffer_sizes_.push_back(size);
+    }
+
+    container->WriteWeight(fbs_key->str(), std::move(packed_weight));
+  }
+
+  LOGS(*session_logger_, INFO) << "Loaded " << fbs_weights->size()
+                               << " pre-packed weights from the ORT format model.";
+
+  session_prepacked_weights_container_ = std::move(container);
+  session_state_->SetPrepackedWeightsContainer(session_prepacked_weights_container_.get());
+
+  return Status::OK();
+}
 #endif  // defined(ENABLE_ORT_FORMAT_LOAD)
 
 bool InferenceSession::IsInitialized() const {
@@ -1104,7 +1274,9 @@ common::Status InferenceSession::Initialize() {
     // RegisterExecutionProvider locks the session_mutex_ so we can't be holding it when we call that
     if (!have_cpu_ep) {
       LOGS(*session_logger_, INFO) << "Adding default CPU execution provider.";
-      CPUExecutionProviderInfo epi{session_options_.enable_cpu_mem_arena};
+      const bool use_mimalloc_arena =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigUseMimallocArena, "0") == "1";
+      CPUExecutionProviderInfo epi{session_options_.enable_cpu_mem_arena, use_mimalloc_arena};
       auto p_cpu_exec_provider = onnxruntime::make_unique<CPUExecutionProvider>(epi);
       ORT_RETURN_IF_ERROR_SESSIONID_(RegisterExecutionProvider(std::move(p_cpu_exec_provider)));
     }
@@ -1146,7 +1318,37 @@ common::Status InferenceSession::Initialize() {
         data_transfer_mgr_,
         *session_logger_,
         session_profiler_,
-        session_options_.use_deterministic_compute);
+        session_options_.use_deterministic_compute,
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigUsePerRunScratchArena, "0") == "1");
+
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigUseEnvPrepackedWeightsCache, "0") == "1") {
+      LOGS(*session_logger_, INFO) << "This session will share pre-packed weights via the environment.";
+      session_state_->SetPrepackedWeightsContainer(&environment_.GetPrepackedWeightsContainer());
+    }
+
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigUseEnvInitializerDedupCache, "0") == "1") {
+      std::string dedup_group = session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigInitializerDedupGroup, "");
+      if (dedup_group.empty()) {
+        LOGS(*session_logger_, INFO) << "This session will share deserialized initializers via the environment.";
+        session_state_->SetEnvInitializerDedupCache(&environment_.GetInitializerDedupCache());
+      } else {
+        LOGS(*session_logger_, INFO) << "This session will share deserialized initializers with model group '"
+                                     << dedup_group << "'.";
+        session_state_->SetEnvInitializerDedupCache(&environment_.GetInitializerDedupCache(dedup_group));
+      }
+    }
+
+    {
+      std::string inter_op_priority =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigInterOpTaskPriority, "normal");
+      if (inter_op_priority == "high") {
+        LOGS(*session_logger_, INFO) << "Inter-op tasks from this session will be dispatched at high priority.";
+        session_state_->SetInterOpTaskPriority(concurrency::TaskPriority::kHigh);
+      } else if (inter_op_priority != "normal") {
+        LOGS(*session_logger_, WARNING) << "Ignoring invalid " << kOrtSessionOptionsConfigInterOpTaskPriority
+                                        << " value '" << inter_op_priority << "'. Valid values are 'normal' and 'high'.";
+      }
+    }
 
     onnxruntime::Graph& graph = model_->MainGraph();
 
@@ -1160,7 +1362,7 @@ common::Status InferenceSession::Initialize() {
     // Register 2nd registries into KernelRegistryManager.
     ORT_RETURN_IF_ERROR_SESSIONID_(kernel_registry_manager_.RegisterKernels(execution_providers_));
 
-    bool loading_ort_format = !ort_format_model_bytes_.empty();
+    bool loading_ort_format = !ort_format_model_bytes_span_.empty();
     bool saving_model = !session_options_.optimized_model_filepath.empty();
     bool saving_ort_format = false;
     if (saving_model) {
@@ -1171,6 +1373,33 @@ common::Status InferenceSession::Initialize() {
                             experimental::utils::IsOrtFormatModel(session_options_.optimized_model_filepath)));
     }
 
+    // Pre-packed weights stored in ORT format models. A session sharing the environment's pre-packed
+    // weights cache doesn't participate: seeding that cache from a file would pollute what other
+    // sessions share, and its contents aren't specific to this model.
+    const bool use_env_prepacked_cache =
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigUseEnvPrepackedWeightsCache, "0") == "1";
+    ORT_UNUSED_PARAMETER(use_env_prepacked_cache);
+
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+    if (loading_ort_format && !use_env_prepacked_cache) {
+      const auto* fbs_prepacked_weights =
+          fbs::GetInferenceSession(ort_format_model_bytes_span_.data())->prepacked_weights();
+      if (fbs_prepacked_weights != nullptr) {
+        ORT_RETURN_IF_ERROR_SESSIONID_(LoadPrepackedWeightsFromOrtFormat(*fbs_prepacked_weights));
+      }
+    }
+#endif
+
+#if !defined(ORT_MINIMAL_BUILD)
+    if (saving_ort_format && !use_env_prepacked_cache &&
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigSavePrepackedWeights, "0") == "1" &&
+        session_prepacked_weights_container_ == nullptr) {
+      // capture whatever the kernels pack during FinalizeSessionState so SaveToOrtFormat can store it
+      session_prepacked_weights_container_ = onnxruntime::make_unique<PrepackedWeightsContainer>();
+      session_state_->SetPrepackedWeightsContainer(session_prepacked_weights_container_.get());
+    }
+#endif
+
 #if !defined(ORT_MINIMAL_BUILD)
     if (!loading_ort_format) {
       // add predefined transformers
@@ -1206,7 +1435,7 @@ common::Status InferenceSession::Initialize() {
 
     const experimental::fbs::SessionState* serialized_session_state =
         loading_ort_format
-            ? fbs::GetInferenceSession(ort_format_model_bytes_.data())->session_state()
+            ? fbs::GetInferenceSession(ort_format_model_bytes_span_.data())->session_state()
             : nullptr;
 
     ORT_RETURN_IF_ERROR_SESSIONID_(
@@ -1242,10 +1471,79 @@ common::Status InferenceSession::Initialize() {
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
     session_state_->ResolveMemoryPatternFlag();
+
+    retain_outputs_ =
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigRetainOutputs, "0") == "1";
+
+    assert_allocation_free_runs_ =
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigAssertAllocationFreeRuns, "0") == "1";
+    if (assert_allocation_free_runs_) {
+      AllocationAudit::Enable();
+    }
+
+    {
+      const std::string timing_cache_path =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigNodeTimingCachePath, "");
+      if (!timing_cache_path.empty()) {
+        node_timing_cache_ = onnxruntime::make_unique<NodeTimingCache>();
+        ORT_RETURN_IF_ERROR_SESSIONID_(node_timing_cache_->Load(timing_cache_path));
+        node_timing_cache_path_ = timing_cache_path;
+        session_state_->SetNodeTimingCache(node_timing_cache_.get());
+        if (!node_timing_cache_->Empty()) {
+          session_state_->SetNodeCriticalPathCosts(
+              ComputeCriticalPathCosts(session_state_->GetGraphViewer(), *node_timing_cache_));
+          LOGS(*session_logger_, INFO) << "Loaded node timing cache from '" << timing_cache_path
+                                       << "'; parallel execution will schedule the critical path first.";
+        } else {
+          LOGS(*session_logger_, INFO) << "Node timing cache '" << timing_cache_path
+                                       << "' is empty; kernel timings will be recorded and saved when the "
+                                          "session is destroyed.";
+        }
+      }
+    }
+
+    {
+      const std::string plan_dump_path =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigAllocationPlanDumpPath, "");
+      if (!plan_dump_path.empty()) {
+        const SequentialExecutionPlan* exec_plan = session_state_->GetExecutionPlan();
+        if (exec_plan != nullptr) {
+          std::ofstream plan_dump(plan_dump_path, std::ios::out | std::ios::trunc);
+          if (plan_dump) {
+            DumpAllocationPlanAsJson(*exec_plan, *session_state_, plan_dump);
+            LOGS(*session_logger_, INFO) << "Saved allocation plan to '" << plan_dump_path << "'.";
+          } else {
+            LOGS(*session_logger_, WARNING) << "Could not open '" << plan_dump_path
+                                            << "' to save the allocation plan.";
+          }
+        }
+      }
+    }
+
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigEnableCudaGraphCapture, "0") == "1") {
+      auto* cuda_ep = execution_providers_.Get(onnxruntime::kCudaExecutionProvider);
+      if (cuda_ep == nullptr) {
+        ORT_RETURN_IF_ERROR_SESSIONID_(
+            ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                            "CUDA graph capture was requested but the CUDA execution provider is not registered."));
+      }
+      if (session_options_.execution_mode != ExecutionMode::ORT_SEQUENTIAL) {
+        ORT_RETURN_IF_ERROR_SESSIONID_(
+            ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                            "CUDA graph capture requires sequential execution mode."));
+      }
+      ORT_RETURN_IF_ERROR_SESSIONID_(cuda_ep->EnableGraphCapture());
+      cached_execution_provider_for_graph_replay_ = cuda_ep;
+      LOGS(*session_logger_, INFO) << "CUDA graph capture is enabled: the first Run executes per node, "
+                                      "the next Run is captured, and later Runs replay the captured graph.";
+    }
+
     is_inited_ = true;
 
-    // we don't directly use the ORT format bytes currently, so free those now
+    // we don't directly use the ORT format bytes currently, so release the buffer/mapping now
+    ort_format_model_bytes_span_ = gsl::span<const uint8_t>();
     std::vector<uint8_t>().swap(ort_format_model_bytes_);
+    ort_format_model_mapped_bytes_.reset();
 
     // and log telemetry
     bool model_has_fp16_inputs = ModelHasFP16Inputs(graph);
@@ -1462,6 +1760,119 @@ common::Status InferenceSession::ValidateOutputs(const std::vector<std::string>&
   return common::Status::OK();
 }
 
+IArenaAllocator* InferenceSession::GetCpuArena() const {
+  const auto* cpu_ep = execution_providers_.Get(onnxruntime::kCpuExecutionProvider);
+  if (cpu_ep == nullptr) {
+    return nullptr;
+  }
+
+  AllocatorPtr alloc = cpu_ep->GetAllocator(0, OrtMemTypeDefault);
+  if (alloc && alloc->Info().alloc_type == OrtArenaAllocator) {
+    return static_cast<IArenaAllocator*>(alloc.get());
+  }
+
+  return nullptr;
+}
+
+common::Status InferenceSession::CheckRunMemoryBudget(const RunOptions& run_options,
+                                                      const std::vector<OrtValue>& feeds,
+                                                      const std::vector<int>& feeds_mlvalue_idxs) const {
+  // The memory pattern cache records the peak allocation planned for a set of input
+  // shapes once that shape combination has executed, so a repeat of an oversized
+  // request can be rejected before anything runs. Shapes without a cached pattern
+  // fall through to the arena-level budget enforced during execution.
+  if (!session_state_->GetEnableMemoryPattern()) {
+    return common::Status::OK();
+  }
+
+  std::vector<std::reference_wrapper<const TensorShape>> input_shapes;
+  input_shapes.reserve(feeds.size());
+  for (const auto& feed : feeds) {
+    if (!feed.IsTensor()) {
+      return common::Status::OK();
+    }
+    input_shapes.push_back(std::cref(feed.Get<Tensor>().Shape()));
+  }
+
+  std::unordered_map<int, TensorShape> inferred_shapes;
+  const MemoryPatternGroup* mem_patterns =
+      session_state_->GetMemoryPatternGroup(input_shapes, feeds_mlvalue_idxs, inferred_shapes);
+  if (mem_patterns == nullptr) {
+    return common::Status::OK();
+  }
+
+  size_t planned_peak_bytes = 0;
+  for (const auto& pattern : mem_patterns->patterns) {
+    planned_peak_bytes += pattern.PeakSize();
+  }
+
+  if (planned_peak_bytes > run_options.run_memory_budget_bytes) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Run rejected: planned peak allocation of ", planned_peak_bytes,
+                           " bytes for the given input shapes exceeds the per-run memory budget of ",
+                           run_options.run_memory_budget_bytes, " bytes.");
+  }
+
+  return common::Status::OK();
+}
+
+// Key for the retained-outputs cache: the feed names and shapes plus the requested output names.
+// Output shapes are assumed to be a function of the input shapes, the same assumption memory
+// patterns make, so fetches retained under the same key fit a later Run with that key.
+static std::string MakeRetainedOutputsKey(const std::vector<std::string>& feed_names,
+                                          const std::vector<OrtValue>& feeds,
+                                          const std::vector<std::string>& output_names) {
+  std::ostringstream key;
+  for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+    key << feed_names[i] << '=';
+    if (feeds[i].IsAllocated() && feeds[i].IsTensor()) {
+      key << feeds[i].Get<Tensor>().Shape().ToString();
+    }
+    key << ';';
+  }
+  key << '#';
+  for (const auto& name : output_names) {
+    key << name << ';';
+  }
+  return key.str();
+}
+
+FeedsFetchesInfo InferenceSession::ResolveFeedsFetchesInfo(const std::vector<std::string>& feed_names,
+                                                           const std::vector<std::string>& output_names) {
+  // keep the cache bounded for clients that run with ever-changing name subsets; beyond the
+  // cap resolutions still work, they just aren't remembered
+  constexpr size_t kMaxCachedResolutions = 64;
+
+  std::string key;
+  for (const auto& name : feed_names) {
+    key.append(name);
+    key.push_back('\0');
+  }
+  key.push_back('\1');
+  for (const auto& name : output_names) {
+    key.append(name);
+    key.push_back('\0');
+  }
+
+  {
+    std::lock_guard<onnxruntime::OrtMutex> lock(feeds_fetches_info_cache_lock_);
+    auto it = feeds_fetches_info_cache_.find(key);
+    if (it != feeds_fetches_info_cache_.end()) {
+      return it->second;
+    }
+  }
+
+  // resolve outside the lock; the name→index map is frozen once the session is initialized,
+  // so a concurrent resolution of the same names produces the same result
+  FeedsFetchesInfo info(feed_names, output_names, session_state_->GetOrtValueNameIdxMap());
+
+  std::lock_guard<onnxruntime::OrtMutex> lock(feeds_fetches_info_cache_lock_);
+  if (feeds_fetches_info_cache_.size() < kMaxCachedResolutions) {
+    feeds_fetches_info_cache_.emplace(std::move(key), info);
+  }
+
+  return info;
+}
+
 Status InferenceSession::Run(const RunOptions& run_options,
                              const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
                              const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
@@ -1482,6 +1893,18 @@ Status InferenceSession::Run(const RunOptions& run_options,
   std::vector<IExecutionProvider*> exec_providers_to_stop;
   exec_providers_to_stop.reserve(execution_providers_.NumProviders());
 
+  IArenaAllocator* budgeted_arena = nullptr;
+
+  std::string retained_outputs_key;
+  bool retained_outputs_seeded = false;
+
+  // enforcement only applies from the third Run on; earlier Runs legitimately grow the arena
+  // and establish the memory patterns that make later Runs allocation free
+  const bool enforce_allocation_free_run =
+      assert_allocation_free_runs_ && run_metrics_.total_runs.load(std::memory_order_relaxed) >= 2;
+  const uint64_t audit_allocs_before_run =
+      enforce_allocation_free_run ? AllocationAudit::AllocationCount() : 0;
+
   ORT_TRY {
     if (!is_inited_) {
       LOGS(*session_logger_, ERROR) << "Session was not initialized";
@@ -1494,8 +1917,24 @@ Status InferenceSession::Run(const RunOptions& run_options,
     ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(feed_names, feeds));
     ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, p_fetches));
 
-    FeedsFetchesInfo info(feed_names, output_names, session_state_->GetOrtValueNameIdxMap());
-    FeedsFetchesManager feeds_fetches_manager{std::move(info)};
+    // when retained outputs are enabled and the caller did not pre-allocate the fetches, seed them
+    // with the output tensors of the previous Run that used the same input shapes so their
+    // allocations are reused. Taking the entry out of the map means a concurrent Run with the same
+    // shapes simply misses and allocates fresh rather than sharing buffers.
+    if (retain_outputs_ && p_fetches != nullptr && p_fetches->empty()) {
+      retained_outputs_key = MakeRetainedOutputsKey(feed_names, feeds, output_names);
+      std::lock_guard<onnxruntime::OrtMutex> lock(retained_outputs_lock_);
+      auto it = retained_outputs_.find(retained_outputs_key);
+      if (it != retained_outputs_.end()) {
+        *p_fetches = std::move(it->second);
+        retained_outputs_.erase(it);
+        retained_outputs_seeded = true;
+      }
+    }
+
+    // feed/fetch names are resolved to ort_value indexes through a cache, so steady-state
+    // Runs do no per-name hash lookups
+    FeedsFetchesManager feeds_fetches_manager{ResolveFeedsFetchesInfo(feed_names, output_names)};
 
     if (p_fetches_device_info) {
       // populate the target device info. ignored if pre-allocated fetches are provided
@@ -1511,6 +1950,39 @@ Status InferenceSession::Run(const RunOptions& run_options,
       LOGS(*session_logger_, INFO) << "Running with tag: " << run_options.run_tag;
     }
 
+    if (!run_options.run_capture_path_prefix.empty()) {
+      const uint64_t run_ordinal = run_capture_counter_.fetch_add(1, std::memory_order_relaxed);
+      const uint64_t sample_ratio = static_cast<uint64_t>(std::max(1, run_options.run_capture_sample_ratio));
+      if (run_ordinal % sample_ratio == 0) {
+        const std::string capture_path =
+            MakeString(run_options.run_capture_path_prefix, ".", run_ordinal / sample_ratio);
+        auto capture_status = run_capture::Save(capture_path, feed_names, feeds, utils::GetRandomSeed());
+        if (capture_status.IsOK()) {
+          LOGS(*session_logger_, INFO) << "Recorded run capture to '" << capture_path << "'.";
+        } else {
+          LOGS(*session_logger_, WARNING) << "Could not record run capture: "
+                                          << capture_status.ErrorMessage();
+        }
+      }
+    }
+
+    if (run_options.run_memory_budget_bytes > 0) {
+      // reject upfront when the planned peak allocation for these shapes is known to
+      // be over budget, then cap arena growth for the duration of the run
+      ORT_RETURN_IF_ERROR_SESSIONID_(CheckRunMemoryBudget(
+          run_options, feeds, feeds_fetches_manager.GetFeedsFetchesInfo().feeds_mlvalue_idxs));
+
+      budgeted_arena = GetCpuArena();
+      if (budgeted_arena != nullptr) {
+        budgeted_arena->SetRunMemoryBudget(static_cast<int64_t>(run_options.run_memory_budget_bytes));
+      }
+    }
+
+    // Cap the degree of parallelism of intra-op loops started by this Run so
+    // that one large request cannot monopolize a shared pool.  The limit is
+    // thread-local, so concurrent Runs can carry different limits.
+    concurrency::ThreadPool::DegreeOfParallelismLimit dop_limit(run_options.intra_op_thread_limit);
+
     ++current_num_runs_;
 
     // TODO should we add this exec to the list of executors? i guess its not needed now?
@@ -1541,10 +2013,17 @@ Status InferenceSession::Run(const RunOptions& run_options,
     }
 #endif
 
-    // execute the graph
-    ORT_CHECK_AND_SET_RETVAL(utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
-                                                 session_options_.execution_mode, run_options.terminate, run_logger,
-                                                 run_options.only_execute_path_to_fetches));
+    // execute the graph, or replay a previously captured device graph with a single launch
+    // (see kOrtSessionOptionsConfigEnableCudaGraphCapture)
+    if (cached_execution_provider_for_graph_replay_ != nullptr &&
+        cached_execution_provider_for_graph_replay_->IsGraphCaptured()) {
+      LOGS(run_logger, INFO) << "Replaying the captured CUDA graph for this Run.";
+      ORT_CHECK_AND_SET_RETVAL(cached_execution_provider_for_graph_replay_->ReplayGraph());
+    } else {
+      ORT_CHECK_AND_SET_RETVAL(utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
+                                                   session_options_.execution_mode, run_options.terminate, run_logger,
+                                                   run_options.only_execute_path_to_fetches, &run_options));
+    }
   }
   ORT_CATCH(const std::exception& e) {
     ORT_HANDLE_EXCEPTION([&]() {
@@ -1555,6 +2034,10 @@ Status InferenceSession::Run(const RunOptions& run_options,
     retval = Status(common::ONNXRUNTIME, common::RUNTIME_EXCEPTION, "Encountered unknown exception in Run()");
   }
 
+  if (budgeted_arena != nullptr) {
+    budgeted_arena->SetRunMemoryBudget(0);
+  }
+
   // info all execution providers InferenceSession:Run ended
   for (auto* xp : exec_providers_to_stop) {
     auto status = xp->OnRunEnd();
@@ -1563,9 +2046,57 @@ Status InferenceSession::Run(const RunOptions& run_options,
 
   --current_num_runs_;
 
+  if (retained_outputs_seeded && !retval.IsOK()) {
+    // the retained allocations did not fit this Run's output shapes (the model's output shapes
+    // are not a pure function of its input shapes). Drop them and fall back to fresh allocation;
+    // the cache entry is already erased so the retry cannot seed again.
+    LOGS(*session_logger_, WARNING) << "Retained outputs did not match this Run's output shapes; "
+                                       "re-running with freshly allocated outputs.";
+    p_fetches->clear();
+    return Run(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info);
+  }
+
+  if (retval.IsOK() && enforce_allocation_free_run) {
+    const uint64_t run_allocs = AllocationAudit::AllocationCount() - audit_allocs_before_run;
+    if (run_allocs > 0) {
+      retval = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Run performed ", run_allocs,
+                               " allocation(s) through the CPU allocator seam but ",
+                               kOrtSessionOptionsConfigAssertAllocationFreeRuns,
+                               " is set. Enable INFO logging to attribute the allocations to nodes.");
+    }
+  }
+
+  if (retval.IsOK() && !retained_outputs_key.empty()) {
+    // retain the fetches for the next Run with these input shapes. OrtValue copies share buffer
+    // ownership, so the caller's fetches stay valid regardless of what happens to the cache.
+    bool all_tensors = true;
+    for (const auto& fetch : *p_fetches) {
+      if (!fetch.IsAllocated() || !fetch.IsTensor()) {
+        all_tensors = false;
+        break;
+      }
+    }
+    if (all_tensors) {
+      std::lock_guard<onnxruntime::OrtMutex> lock(retained_outputs_lock_);
+      retained_outputs_[retained_outputs_key] = *p_fetches;
+    }
+  }
+
+  const long long run_duration_us = TimeDiffMicroSeconds(tp);
+
+  // always-on lightweight metrics; relaxed updates keep this off the critical path
+  run_metrics_.total_runs.fetch_add(1, std::memory_order_relaxed);
+  run_metrics_.total_run_duration_us.fetch_add(static_cast<uint64_t>(run_duration_us),
+                                               std::memory_order_relaxed);
+  size_t bucket = 0;
+  while (bucket + 1 < RunMetrics::kNumLatencyBuckets && (1LL << bucket) <= run_duration_us) {
+    ++bucket;
+  }
+  run_metrics_.latency_hist[bucket].fetch_add(1, std::memory_order_relaxed);
+
   // keep track of telemetry
   ++telemetry_.total_runs_since_last_;
-  telemetry_.total_run_duration_since_last_ += TimeDiffMicroSeconds(tp);
+  telemetry_.total_run_duration_since_last_ += run_duration_us;
 
   // time to send telemetry?
   if (TimeDiffMicroSeconds(telemetry_.time_sent_last_) > telemetry_.kDurationBetweenSending) {
@@ -1613,6 +2144,73 @@ common::Status InferenceSession::Run(const RunOptions& run_options, const NameML
   return Run(run_options, feed_names, feeds, output_names, p_fetches, nullptr);
 }
 
+common::Status InferenceSession::RunAsync(const RunOptions* run_options,
+                                          const char* const* input_names, const OrtValue* const* input,
+                                          size_t input_len, const char* const* output_names,
+                                          size_t output_names_len, OrtValue** output,
+                                          RunAsyncCallbackFn run_async_callback, void* user_data) {
+  ORT_RETURN_IF(run_async_callback == nullptr, "run_async_callback must be provided.");
+
+  // prefer the inter-op pool as that is intended for running independent pieces of work. fall back to the
+  // intra-op pool, which needs a spare thread as the Run call we schedule will use it for kernel execution.
+  auto* tp = GetInterOpThreadPoolToUse();
+  if (tp == nullptr) {
+    tp = GetIntraOpThreadPoolToUse();
+    if (tp == nullptr || concurrency::ThreadPool::DegreeOfParallelism(tp) < 2) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                             "RunAsync requires an inter-op thread pool, or an intra-op thread pool "
+                             "with more than one thread.");
+    }
+  }
+
+  constexpr int queue_id = 0;
+
+  // validate and copy the feeds/fetches up front so any input error is reported synchronously.
+  // the OrtValue copies are cheap (shared buffers).
+  std::vector<std::string> feed_names(input_len);
+  std::vector<OrtValue> feeds(input_len);
+  for (size_t i = 0; i != input_len; ++i) {
+    ORT_RETURN_IF(input_names[i] == nullptr || input_names[i][0] == '\0', "input name cannot be empty");
+    feed_names[i] = input_names[i];
+    auto& ort_value = feeds[i] = *input[i];
+    if (ort_value.Fence()) ort_value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, queue_id);
+  }
+
+  std::vector<std::string> fetch_names(output_names_len);
+  std::vector<OrtValue> fetches(output_names_len);
+  for (size_t i = 0; i != output_names_len; ++i) {
+    ORT_RETURN_IF(output_names[i] == nullptr || output_names[i][0] == '\0', "output name cannot be empty");
+    fetch_names[i] = output_names[i];
+    if (output[i] != nullptr) {
+      OrtValue& value = *output[i];
+      if (value.Fence()) value.Fence()->BeforeUsingAsOutput(onnxruntime::kCpuExecutionProvider, queue_id);
+      fetches[i] = value;
+    }
+  }
+
+  RunOptions run_options_copy = run_options != nullptr ? *run_options : RunOptions{};
+
+  std::function<void()> run_fn =
+      [this, run_options_copy, feed_names, feeds, fetch_names, fetches, output, output_names_len,
+       run_async_callback, user_data]() mutable {
+        Status status = Run(run_options_copy, feed_names, feeds, fetch_names, &fetches, nullptr);
+        if (status.IsOK()) {
+          for (size_t i = 0; i != output_names_len; ++i) {
+            OrtValue& value = fetches[i];
+            if (value.Fence()) value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, queue_id);
+            if (output[i] == nullptr) {
+              output[i] = new OrtValue(value);
+            }
+          }
+        }
+
+        run_async_callback(user_data, output, output_names_len, onnxruntime::ToOrtStatus(status));
+      };
+
+  concurrency::ThreadPool::Schedule(tp, std::move(run_fn));
+  return Status::OK();
+}
+
 std::pair<common::Status, const ModelMetadata*> InferenceSession::GetModelMetadata() const {
   {
     std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
@@ -1689,6 +2287,93 @@ common::Status InferenceSession::Run(IOBinding& io_binding) {
   return Run(run_options, io_binding);
 }
 
+common::Status InferenceSession::Warmup(size_t num_runs) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  auto inputs = GetModelInputs();
+  ORT_RETURN_IF_ERROR(inputs.first);
+
+  auto cpu_allocator = execution_providers_.Get(onnxruntime::kCpuExecutionProvider)
+                           ->GetAllocator(0, OrtMemTypeDefault);
+
+  NameMLValMap feeds;
+  for (const auto* input_def : *inputs.second) {
+    const auto* type_proto = input_def->TypeAsProto();
+    if (type_proto == nullptr || !utils::HasTensorType(*type_proto)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "Warmup supports tensor inputs only. Input: ", input_def->Name());
+    }
+
+    const auto& tensor_type = type_proto->tensor_type();
+    int32_t elem_type = tensor_type.elem_type();
+    if (elem_type == ONNX_NAMESPACE::TensorProto_DataType_STRING ||
+        elem_type == ONNX_NAMESPACE::TensorProto_DataType_UNDEFINED) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "Warmup cannot synthesize input: ", input_def->Name());
+    }
+
+    // Resolve each dimension: concrete values are used as-is, free dimensions honor the
+    // session's free dimension overrides and fall back to 1 so the run stays cheap.
+    std::vector<int64_t> dims;
+    if (utils::HasShape(tensor_type)) {
+      for (const auto& dim : tensor_type.shape().dim()) {
+        int64_t dim_value = utils::HasDimValue(dim) && dim.dim_value() > 0 ? dim.dim_value() : -1;
+        if (dim_value < 0) {
+          for (const auto& dim_override : session_options_.free_dimension_overrides) {
+            bool matched = dim_override.dim_identifer_type == FreeDimensionOverrideType::Denotation
+                               ? dim.denotation() == dim_override.dim_identifier
+                               : utils::HasDimParam(dim) && dim.dim_param() == dim_override.dim_identifier;
+            if (matched) {
+              dim_value = dim_override.dim_value;
+              break;
+            }
+          }
+        }
+        dims.push_back(dim_value < 0 ? 1 : dim_value);
+      }
+    }
+
+    auto element_type = DataTypeImpl::TensorTypeFromONNXEnum(elem_type)->GetElementType();
+    auto p_tensor = onnxruntime::make_unique<Tensor>(element_type, TensorShape(dims), cpu_allocator);
+    memset(p_tensor->MutableDataRaw(), 0, p_tensor->SizeInBytes());
+
+    OrtValue ort_value;
+    ort_value.Init(p_tensor.release(), DataTypeImpl::GetType<Tensor>(),
+                   DataTypeImpl::GetType<Tensor>()->GetDeleteFunc());
+    feeds.insert(std::make_pair(input_def->Name(), ort_value));
+  }
+
+  auto outputs = GetModelOutputs();
+  ORT_RETURN_IF_ERROR(outputs.first);
+
+  std::vector<std::string> output_names;
+  output_names.reserve(outputs.second->size());
+  for (const auto* output_def : *outputs.second) {
+    output_names.push_back(output_def->Name());
+  }
+
+  RunOptions run_options;
+  run_options.run_tag = "warmup";
+
+  // The first run grows the allocator arenas and captures the memory patterns; later runs
+  // execute with the captured patterns so the steady-state path is exercised as well.
+  num_runs = std::max<size_t>(num_runs, 1);
+  for (size_t i = 0; i < num_runs; ++i) {
+    std::vector<OrtValue> fetches;
+    ORT_RETURN_IF_ERROR(Run(run_options, feeds, output_names, &fetches));
+  }
+
+  LOGS(*session_logger_, INFO) << "Session warm-up completed after " << num_runs
+                               << " run(s); allocator arenas, memory patterns and kernel setup are primed.";
+  return common::Status::OK();
+}
+
 template <typename T>
 void InferenceSession::StartProfiling(const std::basic_string<T>& file_prefix) {
   std::basic_ostringstream<T> ss;
@@ -1727,6 +2412,77 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+common::Status InferenceSession::EnableCalibrationCollection(int num_histogram_bins) {
+  if (num_histogram_bins < 1) {
+    return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "num_histogram_bins must be positive.");
+  }
+
+  std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  if (calibration_collector_ == nullptr) {
+    calibration_collector_ = onnxruntime::make_unique<CalibrationCollector>(num_histogram_bins);
+    session_state_->SetCalibrationCollector(calibration_collector_.get());
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetCalibrationTable(
+    std::map<std::string, CalibrationCollector::TensorStats>& table) const {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (calibration_collector_ == nullptr) {
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Calibration collection was not enabled.");
+    }
+  }
+
+  table = calibration_collector_->GetTable();
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetMetrics(OrtSessionMetrics& metrics) const {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  metrics.total_runs = run_metrics_.total_runs.load(std::memory_order_relaxed);
+  metrics.total_run_duration_us = run_metrics_.total_run_duration_us.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < RunMetrics::kNumLatencyBuckets; ++i) {
+    metrics.run_latency_hist[i] = run_metrics_.latency_hist[i].load(std::memory_order_relaxed);
+  }
+  metrics.current_num_runs = current_num_runs_.load();
+  metrics.num_queued_tasks = concurrency::ThreadPool::NumQueuedTasks(GetIntraOpThreadPoolToUse());
+
+  metrics.arena_bytes_in_use = -1;
+  metrics.arena_total_allocated_bytes = -1;
+  metrics.arena_total_free_bytes = -1;
+  metrics.arena_largest_free_block_bytes = -1;
+  metrics.arena_num_extensions = -1;
+  IArenaAllocator* arena = GetCpuArena();
+  if (arena != nullptr) {
+    AllocatorStats stats;
+    arena->GetStats(&stats);
+    metrics.arena_bytes_in_use = stats.bytes_in_use;
+    metrics.arena_total_allocated_bytes = stats.total_allocated_bytes;
+    metrics.arena_total_free_bytes = stats.total_free_bytes;
+    metrics.arena_largest_free_block_bytes = stats.largest_free_block_bytes;
+    metrics.arena_num_extensions = stats.num_extensions;
+  }
+
+  metrics.mem_pattern_hits = session_state_->GetMemoryPatternHitCount();
+  metrics.mem_pattern_misses = session_state_->GetMemoryPatternMissCount();
+
+  return common::Status::OK();
+}
+
 AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const {
   return session_state_->GetAllocator(mem_info);
 }
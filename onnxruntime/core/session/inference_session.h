@@ -10,7 +10,9 @@
 #include "core/common/logging/logging.h"
 #include "core/common/profiler.h"
 #include "core/common/status.h"
+#include "core/framework/calibration_collector.h"
 #include "core/framework/execution_providers.h"
+#include "core/framework/feeds_fetches_manager.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/iexecutor.h"
 #include "core/framework/kernel_registry_manager.h"
@@ -19,6 +21,7 @@
 #include "core/optimizer/graph_transformer_level.h"
 #include "core/optimizer/graph_transformer_mgr.h"
 #include "core/optimizer/insert_cast_transformer.h"
+#include "core/platform/env.h"
 #include "core/framework/session_options.h"
 #ifdef ENABLE_LANGUAGE_INTEROP_OPS
 #include "core/language_interop_ops/language_interop_ops.h"
@@ -31,6 +34,14 @@
 namespace onnxruntime {  // forward declarations
 class GraphTransformer;
 class Environment;
+class NodeTimingCache;
+class PrepackedWeightsContainer;
+
+namespace experimental {
+namespace fbs {
+struct PrePackedWeightsData;
+}  // namespace fbs
+}  // namespace experimental
 }  // namespace onnxruntime
 
 namespace ONNX_NAMESPACE {
@@ -43,6 +54,7 @@ struct OrtCustomOpDomain {
 };
 
 namespace onnxruntime {
+class IArenaAllocator;  // forward decl
 class IExecutionProvider;  // forward decl
 class IOBinding;
 class CustomRegistry;
@@ -283,6 +295,24 @@ class InferenceSession {
                      const std::vector<std::string>& output_names,
                      std::vector<OrtValue>* p_fetches) ORT_MUST_USE_RESULT;
 
+  /**
+    * Run a pre-loaded and pre-initialized model asynchronously. The run is scheduled on the inter-op
+    * thread pool when the session has one, otherwise on the intra-op thread pool, and run_async_callback
+    * is invoked when it completes. The caller must keep all of the arrays passed in (including the name
+    * and value entries they point to) valid until the callback is invoked.
+    * An error is returned (and nothing is scheduled) if no suitable thread pool is available.
+    * @param run_options use this to tune the Run call to your needs. nullptr to use the defaults.
+    * @param output output_names_len entries. Non-null entries are used as pre-allocated outputs;
+    *        null entries are populated with newly allocated values the caller takes ownership of.
+    * @param run_async_callback callback invoked with the outputs, or with a failure status.
+    * @param user_data opaque value passed through to run_async_callback.
+    */
+  common::Status RunAsync(const RunOptions* run_options,
+                          const char* const* input_names, const OrtValue* const* input, size_t input_len,
+                          const char* const* output_names, size_t output_names_len,
+                          OrtValue** output,
+                          RunAsyncCallbackFn run_async_callback, void* user_data) ORT_MUST_USE_RESULT;
+
   /**
   * Creates a new binding object for binding inputs and outputs.
   * @param provider_type specifies the location where the inputs need to be potentially copied.
@@ -293,6 +323,21 @@ class InferenceSession {
   virtual common::Status Run(const RunOptions& run_options, IOBinding& io_binding) ORT_MUST_USE_RESULT;
   common::Status Run(IOBinding& io_binding) ORT_MUST_USE_RESULT;
 
+  /**
+    * Warm the session up with synthesized inputs so first-Run costs (allocator arena growth,
+    * memory pattern capture, kernel setup such as convolution algorithm searches) are not paid
+    * by live traffic. Inputs are zero-filled CPU tensors shaped from the model's input
+    * definitions; free dimensions honor the session's free dimension overrides and default to 1.
+    * The first run grows the arenas and captures the memory patterns and the remaining runs
+    * execute with the captured patterns, so an OK status means the steady-state path has been
+    * exercised end to end and the session is ready to serve.
+    * Only models whose inputs are all non-string tensors can be warmed up this way.
+    * @param num_runs how often to run the model. Values below 2 leave the memory pattern
+    *        replay path unexercised.
+    * @return OK if all warm-up runs succeeded.
+    */
+  common::Status Warmup(size_t num_runs = 2) ORT_MUST_USE_RESULT;
+
   /**
     * @return pair.first = OK; FAIL otherwise. pair.second is non-NULL when pair.first = OK.
     * @note lifetime of the returned pointer is valid as long as the Session object is live.
@@ -376,6 +421,36 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+    * Snapshot the session's always-on lightweight metrics: run counts, a log2-scaled
+    * latency histogram, CPU arena usage and intra-op thread pool queue depth. Unlike
+    * profiling, these counters are maintained unconditionally with relaxed atomic
+    * updates so a monitoring thread can poll them in production without measurable
+    * overhead on Run().
+    * @param metrics filled in by the call.
+    * @return OK if the session has been initialized.
+    */
+  common::Status GetMetrics(OrtSessionMetrics& metrics) const ORT_MUST_USE_RESULT;
+
+  /**
+    * Start streaming per-tensor activation statistics (min/max and a histogram of
+    * absolute values, merged across Runs) while representative Runs execute, so int8
+    * quantization ranges can be derived in a single native pass instead of re-running
+    * the model with extra graph outputs. Only float tensors produced on CPU are
+    * observed. Must be called after Initialize(); idempotent.
+    * @param num_histogram_bins bins per tensor histogram.
+    * @return OK if the session has been initialized.
+    */
+  common::Status EnableCalibrationCollection(int num_histogram_bins = 2048) ORT_MUST_USE_RESULT;
+
+  /**
+    * Snapshot the calibration statistics collected so far, keyed by tensor name.
+    * @param table filled in by the call.
+    * @return OK if EnableCalibrationCollection was called.
+    */
+  common::Status GetCalibrationTable(std::map<std::string, CalibrationCollector::TensorStats>& table) const
+      ORT_MUST_USE_RESULT;
+
   /**
     * Search registered execution providers for an allocator that has characteristics
     * specified within mem_info
@@ -466,6 +541,13 @@ class InferenceSession {
   }
 
   common::Status SaveToOrtFormat(const std::basic_string<ORTCHAR_T>& filepath) const;
+
+  // Serialize the pre-packed weights the session captured while initializing so that
+  // loading the saved model can skip re-packing them.
+  common::Status SavePrepackedWeightsToOrtFormat(
+      flatbuffers::FlatBufferBuilder& builder,
+      flatbuffers::Offset<experimental::fbs::PrePackedWeightsData>& fbs_prepacked_weights) const
+      ORT_MUST_USE_RESULT;
 #endif
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
@@ -491,6 +573,11 @@ class InferenceSession {
 
   common::Status LoadOrtModel(std::function<Status()> load_ort_format_model_bytes) ORT_MUST_USE_RESULT;
 
+  // Populate a PrepackedWeightsContainer from pre-packed weights stored in the ORT format model,
+  // provided they were packed for a CPU with the same capabilities as the one we are running on.
+  common::Status LoadPrepackedWeightsFromOrtFormat(
+      const experimental::fbs::PrePackedWeightsData& fbs_prepacked_weights) ORT_MUST_USE_RESULT;
+
 #endif  // defined(ENABLE_ORT_FORMAT_LOAD)
 
   // Create a Logger for a single execution if possible. Otherwise use the default logger.
@@ -512,6 +599,21 @@ class InferenceSession {
   common::Status ValidateOutputs(const std::vector<std::string>& output_names,
                                  const std::vector<OrtValue>* p_fetches) const ORT_MUST_USE_RESULT;
 
+  // Rejects a budgeted Run upfront when the cached memory pattern for the feed shapes
+  // already plans a peak allocation above run_options.run_memory_budget_bytes.
+  common::Status CheckRunMemoryBudget(const RunOptions& run_options, const std::vector<OrtValue>& feeds,
+                                      const std::vector<int>& feeds_mlvalue_idxs) const ORT_MUST_USE_RESULT;
+
+  // Returns the CPU execution provider's arena allocator, or nullptr when the CPU
+  // allocator is not arena based.
+  IArenaAllocator* GetCpuArena() const;
+
+  // Returns the feed and fetch names resolved to ort_value indexes. The name→index map is
+  // frozen once the session is initialized, so resolutions are cached and repeat Runs with
+  // the same names skip the per-name hash lookups entirely.
+  FeedsFetchesInfo ResolveFeedsFetchesInfo(const std::vector<std::string>& feed_names,
+                                           const std::vector<std::string>& output_names);
+
   common::Status WaitForNotification(Notification* p_executor_done, int64_t timeout_in_ms) ORT_MUST_USE_RESULT;
 
   template <typename T>
@@ -562,6 +664,32 @@ class InferenceSession {
   // It has a dependency on execution_providers_.
   std::unique_ptr<SessionState> session_state_;
 
+  // Persisted per-node kernel timings, loaded at initialization and saved on destruction.
+  // See kOrtSessionOptionsConfigNodeTimingCachePath. Nullptr when not configured.
+  std::unique_ptr<NodeTimingCache> node_timing_cache_;
+  std::string node_timing_cache_path_;
+
+  // Activation statistics for int8 calibration. Nullptr until
+  // EnableCalibrationCollection is called; referenced by the session state.
+  std::unique_ptr<CalibrationCollector> calibration_collector_;
+
+  // Output tensors retained from previous Runs so their allocations can be reused when a later
+  // Run has the same input shapes. Keyed by the feed names and shapes plus the requested output
+  // names. An entry is removed from the map while a Run is using it, so concurrent Runs never
+  // write into the same buffers. See kOrtSessionOptionsConfigRetainOutputs.
+  bool retain_outputs_ = false;
+  onnxruntime::OrtMutex retained_outputs_lock_;
+  std::unordered_map<std::string, std::vector<OrtValue>> retained_outputs_;
+
+  // Fail steady-state Runs that allocate through the CPU allocator seam.
+  // See kOrtSessionOptionsConfigAssertAllocationFreeRuns.
+  bool assert_allocation_free_runs_ = false;
+
+  // Feed and fetch names resolved to ort_value indexes, keyed by the name lists.
+  // See ResolveFeedsFetchesInfo.
+  onnxruntime::OrtMutex feeds_fetches_info_cache_lock_;
+  std::unordered_map<std::string, FeedsFetchesInfo> feeds_fetches_info_cache_;
+
   // Threadpools per session. These are initialized and used for the entire duration of the session
   // when use_per_session_threads is true.
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> thread_pool_;
@@ -608,6 +736,25 @@ class InferenceSession {
   // Number of concurrently running executors
   std::atomic<int> current_num_runs_;
 
+  // Always-on lightweight metrics, maintained with relaxed atomic updates at the end of
+  // each Run() and snapshotted by GetMetrics().  Unlike telemetry_ these are never reset.
+  struct RunMetrics {
+    static constexpr size_t kNumLatencyBuckets = ORT_SESSION_METRICS_NUM_LATENCY_BUCKETS;
+    std::atomic<uint64_t> total_runs{0};
+    std::atomic<uint64_t> total_run_duration_us{0};
+    // latency_hist[i] counts completed runs with duration below 2^i microseconds (the
+    // last bucket also counts everything larger).
+    std::atomic<uint64_t> latency_hist[kNumLatencyBuckets]{};
+  } run_metrics_;
+
+  // Counts Run() calls that requested input capture, to apply the 1-in-N sampling and
+  // number the capture files. See OrtRunOptions::run_capture_path_prefix.
+  std::atomic<uint64_t> run_capture_counter_{0};
+
+  // The execution provider that captures Runs into a device graph and replays them when
+  // kOrtSessionOptionsConfigEnableCudaGraphCapture is set. Owned by execution_providers_.
+  IExecutionProvider* cached_execution_provider_for_graph_replay_ = nullptr;
+
   mutable onnxruntime::OrtMutex session_mutex_;  // to ensure only one thread can invoke Load/Initialize
   bool is_model_loaded_ = false;                 // GUARDED_BY(session_mutex_)
   bool is_inited_ = false;                       // GUARDED_BY(session_mutex_)
@@ -645,10 +792,21 @@ class InferenceSession {
   // Bytes from an ORT format model.
   // We store them currently to make the Load + Initialize behave the same way as for an ONNX model
   // as we need some of the bytes for the Load (create the Model) and some for the Initialize (create SessionState).
+  // When loading from a file the bytes are memory mapped so the OS pages the model in on demand and session
+  // creation does not pay for reading/copying the whole file; when loading from a user provided buffer we copy
+  // into ort_format_model_bytes_. Exactly one of the two below is populated, and ort_format_model_bytes_span_
+  // provides a uniform view over whichever it is.
   // Short term we free them after Initialize.
   // Longer term we may want to directly refer to offsets in this buffer for initializers so we don't need to copy
   // those into new OrtValue instances, at which point we won't free them until the InferenceSession goes away.
+  Env::MappedMemoryPtr ort_format_model_mapped_bytes_;
   std::vector<uint8_t> ort_format_model_bytes_;
+  gsl::span<const uint8_t> ort_format_model_bytes_span_;
+
+  // Pre-packed weights this session owns. Populated from an ORT format model that stores them, or
+  // created empty to capture what the kernels pack when saving such a model. Not used when the
+  // session shares the environment's pre-packed weights cache instead.
+  std::unique_ptr<PrepackedWeightsContainer> session_prepacked_weights_container_;
 };
 
 struct SessionIOBinding {
@@ -8,6 +8,7 @@
 #include "core/framework/allocator.h"
 #include "core/framework/error_code_helper.h"
 #include "core/framework/execution_provider.h"
+#include "core/framework/random_seed.h"
 #include "core/framework/utils.h"
 #include <cassert>
 #include <cstring>
@@ -597,6 +598,20 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  return ToOrtStatus(session->RunAsync(run_options, input_names, input, input_len,
+                                       output_names1, output_names_len, output,
+                                       run_async_callback, user_data));
+  API_IMPL_END
+}
+
 struct OrtIoBinding {
   std::unique_ptr<::onnxruntime::IOBinding> binding_;
   explicit OrtIoBinding(std::unique_ptr<::onnxruntime::IOBinding>&& binding) : binding_(std::move(binding)) {}
@@ -1804,6 +1819,20 @@ ORT_API_STATUS_IMPL(OrtApis::SessionGetProfilingStartTimeNs, _In_ const OrtSessi
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetMetrics, _In_ const OrtSession* sess, _Out_ OrtSessionMetrics* metrics) {
+  API_IMPL_BEGIN
+  const auto* session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  return ToOrtStatus(session->GetMetrics(*metrics));
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SetGlobalRandomSeed, int64_t seed) {
+  API_IMPL_BEGIN
+  onnxruntime::utils::SetRandomSeed(seed);
+  return nullptr;
+  API_IMPL_END
+}
+
 // End support for non-tensor types
 
 #ifndef USE_CUDA
@@ -2071,6 +2100,18 @@ static constexpr OrtApi ort_api_1_to_6 = {
     &OrtApis::SetGlobalDenormalAsZero,
     &OrtApis::CreateArenaCfg,
     &OrtApis::ReleaseArenaCfg,
+    &OrtApis::RunAsync,
+    &OrtApis::SessionGetMetrics,
+    &OrtApis::RunOptionsSetRunMemoryBudget,
+    &OrtApis::SetGlobalIntraOpThreadAffinity,
+    &OrtApis::RunOptionsSetIntraOpThreadLimit,
+    &OrtApis::SetGlobalCustomCreateThreadFn,
+    &OrtApis::SetGlobalCustomThreadCreationOptions,
+    &OrtApis::SetGlobalCustomJoinThreadFn,
+    &OrtApis::RunOptionsEnableRunCapture,
+    &OrtApis::SetGlobalRandomSeed,
+    &OrtApis::RunOptionsSetSequenceId,
+    &OrtApis::RunOptionsResetSequence,
 };
 
 // Assert to do a limited check to ensure Version 1 of OrtApi never changes (will detect an addition or deletion but not if they cancel out each other)
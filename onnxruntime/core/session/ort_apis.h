@@ -51,6 +51,13 @@ ORT_API_STATUS_IMPL(Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions*
                     _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
                     _Inout_updates_all_(output_names_len) OrtValue** output);
 
+ORT_API_STATUS_IMPL(RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
+
 ORT_API_STATUS_IMPL(CreateSessionOptions, OrtSessionOptions** out);
 ORT_API_STATUS_IMPL(CloneSessionOptions, const OrtSessionOptions* input, OrtSessionOptions** out);
 ORT_API_STATUS_IMPL(SetSessionExecutionMode, _In_ OrtSessionOptions* options, ExecutionMode execution_mode);
@@ -237,6 +244,23 @@ ORT_API_STATUS_IMPL(CreateAndRegisterAllocator, _Inout_ OrtEnv* env, _In_ const
 
 ORT_API_STATUS_IMPL(SetLanguageProjection, _In_ const OrtEnv* ort_env, _In_ OrtLanguageProjection projection);
 ORT_API_STATUS_IMPL(SessionGetProfilingStartTimeNs, _In_ const OrtSession* sess, _Outptr_ uint64_t* out);
+ORT_API_STATUS_IMPL(SessionGetMetrics, _In_ const OrtSession* sess, _Out_ OrtSessionMetrics* metrics);
+ORT_API_STATUS_IMPL(RunOptionsSetRunMemoryBudget, _Inout_ OrtRunOptions* options, size_t budget_bytes);
+ORT_API_STATUS_IMPL(SetGlobalIntraOpThreadAffinity, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_reads_opt_(num_masks) size_t* affinity_masks, size_t num_masks);
+ORT_API_STATUS_IMPL(RunOptionsSetIntraOpThreadLimit, _Inout_ OrtRunOptions* options, int thread_limit);
+ORT_API_STATUS_IMPL(SetGlobalCustomCreateThreadFn, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_ OrtCustomCreateThreadFn ort_custom_create_thread_fn);
+ORT_API_STATUS_IMPL(SetGlobalCustomThreadCreationOptions, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_opt_ void* ort_custom_thread_creation_options);
+ORT_API_STATUS_IMPL(SetGlobalCustomJoinThreadFn, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_ OrtCustomJoinThreadFn ort_custom_join_thread_fn);
+ORT_API_STATUS_IMPL(RunOptionsEnableRunCapture, _Inout_ OrtRunOptions* options,
+                    _In_opt_ const char* path_prefix, size_t sample_ratio);
+ORT_API_STATUS_IMPL(SetGlobalRandomSeed, int64_t seed);
+ORT_API_STATUS_IMPL(RunOptionsSetSequenceId, _Inout_ OrtRunOptions* options,
+                    _In_opt_ const char* sequence_id, size_t max_length);
+ORT_API_STATUS_IMPL(RunOptionsResetSequence, _Inout_ OrtRunOptions* options);
 
 ORT_API_STATUS_IMPL(SetGlobalIntraOpNumThreads, _Inout_ OrtThreadingOptions* tp_options, int intra_op_num_threads);
 ORT_API_STATUS_IMPL(SetGlobalInterOpNumThreads, _Inout_ OrtThreadingOptions* tp_options, int inter_op_num_threads);
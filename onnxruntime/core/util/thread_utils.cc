@@ -24,10 +24,19 @@ CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
     if (cpu_list.empty() || cpu_list.size() == 1)
       return nullptr;
     options.thread_pool_size = static_cast<int>(cpu_list.size());
-    if (options.auto_set_affinity)
+    if (options.auto_set_affinity && options.custom_create_thread_fn == nullptr)
       to.affinity = cpu_list;
   }
+  if ((options.custom_create_thread_fn != nullptr) != (options.custom_join_thread_fn != nullptr)) {
+    ORT_THROW("custom_create_thread_fn and custom_join_thread_fn must be set together");
+  }
+  to.custom_create_thread_fn = options.custom_create_thread_fn;
+  to.custom_thread_creation_options = options.custom_thread_creation_options;
+  to.custom_join_thread_fn = options.custom_join_thread_fn;
   to.set_denormal_as_zero = options.set_denormal_as_zero;
+  to.use_sticky_task_queues = options.use_sticky_task_queues;
+  to.spin_count_log2 = options.spin_count_log2;
+  to.adaptive_spinning = options.adaptive_spinning;
 
   return onnxruntime::make_unique<ThreadPool>(env, to, options.name, options.thread_pool_size,
                                               options.allow_spinning);
@@ -91,6 +100,50 @@ ORT_API_STATUS_IMPL(SetGlobalSpinControl, _Inout_ OrtThreadingOptions* tp_option
   return nullptr;
 }
 
+ORT_API_STATUS_IMPL(SetGlobalIntraOpThreadAffinity, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_reads_opt_(num_masks) size_t* affinity_masks, size_t num_masks) {
+  if (!tp_options) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Received null OrtThreadingOptions");
+  }
+  if ((affinity_masks == nullptr) != (num_masks == 0)) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT,
+                                 "Received inconsistent affinity mask array and length");
+  }
+  tp_options->intra_op_thread_pool_params.affinity_vec = affinity_masks;
+  tp_options->intra_op_thread_pool_params.affinity_vec_len = num_masks;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(SetGlobalCustomCreateThreadFn, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_ OrtCustomCreateThreadFn ort_custom_create_thread_fn) {
+  if (!tp_options) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Received null OrtThreadingOptions");
+  }
+  tp_options->intra_op_thread_pool_params.custom_create_thread_fn = ort_custom_create_thread_fn;
+  tp_options->inter_op_thread_pool_params.custom_create_thread_fn = ort_custom_create_thread_fn;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(SetGlobalCustomThreadCreationOptions, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_opt_ void* ort_custom_thread_creation_options) {
+  if (!tp_options) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Received null OrtThreadingOptions");
+  }
+  tp_options->intra_op_thread_pool_params.custom_thread_creation_options = ort_custom_thread_creation_options;
+  tp_options->inter_op_thread_pool_params.custom_thread_creation_options = ort_custom_thread_creation_options;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(SetGlobalCustomJoinThreadFn, _Inout_ OrtThreadingOptions* tp_options,
+                    _In_ OrtCustomJoinThreadFn ort_custom_join_thread_fn) {
+  if (!tp_options) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Received null OrtThreadingOptions");
+  }
+  tp_options->intra_op_thread_pool_params.custom_join_thread_fn = ort_custom_join_thread_fn;
+  tp_options->inter_op_thread_pool_params.custom_join_thread_fn = ort_custom_join_thread_fn;
+  return nullptr;
+}
+
 ORT_API_STATUS_IMPL(SetGlobalDenormalAsZero, _Inout_ OrtThreadingOptions* tp_options) {
   if (!tp_options) {
     return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Received null OrtThreadingOptions");
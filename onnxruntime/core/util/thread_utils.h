@@ -20,7 +20,8 @@ struct OrtThreadPoolParams {
   bool allow_spinning = true;
 
   unsigned int stack_size = 0;
-  //Index is thread id, value is processor ID
+  //Index is thread id, value is a bitmask of the logical processors the thread
+  //may run on (see ThreadOptions::affinity for the full semantics).
   //If the vector is empty, no explict affinity binding
   size_t* affinity_vec = nullptr;
   size_t affinity_vec_len = 0;
@@ -28,6 +29,33 @@ struct OrtThreadPoolParams {
 
   // Set or unset denormal as zero
   bool set_denormal_as_zero = false;
+
+  // If it is true, tasks submitted from threads outside the pool are pushed to a
+  // per-submitter preferred worker rather than to a random worker.  Short tasks
+  // then stay close to the submitting core while the work-stealing queues keep
+  // large loops balanced.
+  bool use_sticky_task_queues = false;
+
+  // Number of iterations a worker spins looking for work before blocking,
+  // expressed as a power of two. A negative value selects the built-in
+  // default (2^20 pause iterations, roughly a millisecond). Zero makes
+  // workers block as soon as their queues empty. Ignored if allow_spinning
+  // is false.
+  int spin_count_log2 = -1;
+
+  // If it is true, workers spin only while other workers have executed work
+  // since they last ran out of it, so an idle pool stops burning cores on
+  // full-length spins.
+  bool adaptive_spinning = false;
+
+  // If custom_create_thread_fn is set, pool threads are obtained from the
+  // application through it instead of being created by onnxruntime, and
+  // custom_join_thread_fn (which must be set as well) releases them when the
+  // pool shuts down. custom_thread_creation_options is passed through to the
+  // creation callback.
+  OrtCustomCreateThreadFn custom_create_thread_fn = nullptr;
+  void* custom_thread_creation_options = nullptr;
+  OrtCustomJoinThreadFn custom_join_thread_fn = nullptr;
 };
 
 struct OrtThreadingOptions {
@@ -133,6 +133,33 @@ class Session:
             else:
                 raise
 
+    def run_batch(self, output_names, input_feeds, run_options=None):
+        """
+        Compute the predictions for a batch of independent feeds in one call.
+
+        All feeds are converted up front, the GIL is released once for the whole batch and the
+        runs execute concurrently on a shared thread pool, so per-call binding overhead is paid
+        once per batch instead of once per run.
+
+        :param output_names: name of the outputs
+        :param input_feeds: list of dictionaries ``{ input_name: input_value }``
+        :param run_options: See :class:`onnxruntime.RunOptions`.
+        :return: list with one result list per input feed, in order
+
+        ::
+
+            results = sess.run_batch([output_name], [{input_name: x} for x in batch])
+        """
+        num_required_inputs = len(self._inputs_meta)
+        for input_feed in input_feeds:
+            # the graph may have optional inputs used to override initializers. allow for that.
+            if len(input_feed) < num_required_inputs:
+                raise ValueError("Model requires {} inputs. Input Feed contains {}".format(
+                    num_required_inputs, len(input_feed)))
+        if not output_names:
+            output_names = [output.name for output in self._outputs_meta]
+        return self._sess.run_batch(output_names, input_feeds, run_options)
+
     def end_profiling(self):
         """
         End profiling and return results in a file.
@@ -351,6 +378,23 @@ class IOBinding:
         '''Copy output contents to CPU (if on another device). No-op if already on the CPU.'''
         return self._iobinding.copy_outputs_to_cpu()
 
+    def record_outputs_completion(self):
+        '''
+        Record a completion marker covering the device work submitted so far.
+        Call right after run_with_iobinding() returns, then use poll_outputs_completion()
+        or wait_outputs_completion() to observe when the bound outputs are ready, without
+        blocking on work submitted to the device afterwards.
+        '''
+        self._iobinding.record_outputs_completion()
+
+    def poll_outputs_completion(self):
+        '''Returns True once the work covered by record_outputs_completion() has finished. Non-blocking.'''
+        return self._iobinding.poll_outputs_completion()
+
+    def wait_outputs_completion(self):
+        '''Blocks until the work covered by record_outputs_completion() has finished.'''
+        self._iobinding.wait_outputs_completion()
+
     def clear_binding_inputs(self):
         self._iobinding.clear_binding_inputs()
 
@@ -22,6 +22,7 @@
 #include "core/session/IOBinding.h"
 #include "core/session/abi_session_options_impl.h"
 #include "core/platform/env.h"
+#include "core/util/thread_utils.h"
 
 struct OrtStatus {
   OrtErrorCode code;
@@ -424,6 +425,89 @@ static void AddTensorAsPyObj(const OrtValue& val, std::vector<py::object>& pyobj
   pyobjs.push_back(obj);
 }
 
+// Tries to build a numpy array that aliases the tensor's memory instead of copying it. The array
+// takes shared ownership of the OrtValue through its base object, so the buffer stays valid for
+// the life of the array. Returns false (leaving obj untouched) for tensors that cannot be aliased:
+// non-CPU tensors and string tensors.
+static bool GetPyObjFromTensorNoCopy(const OrtValue& val, py::object& obj) {
+  const Tensor& rtensor = val.Get<Tensor>();
+  if (rtensor.Location().device.Type() != OrtDevice::CPU) {
+    return false;
+  }
+  MLDataType dtype = rtensor.DataType();
+  const int numpy_type = OnnxRuntimeTensorToNumpyType(dtype);
+  if (numpy_type == NPY_OBJECT) {
+    return false;
+  }
+
+  std::vector<npy_intp> npy_dims;
+  const TensorShape& shape = rtensor.Shape();
+  for (size_t n = 0; n < shape.NumDimensions(); ++n) {
+    npy_dims.push_back(shape[n]);
+  }
+
+  obj = py::reinterpret_steal<py::object>(PyArray_SimpleNewFromData(
+      static_cast<int>(shape.NumDimensions()), npy_dims.data(), numpy_type,
+      const_cast<void*>(rtensor.DataRaw(dtype))));
+  if (!obj) {
+    throw std::runtime_error("Failed to create a numpy array view over the output tensor");
+  }
+
+  // OrtValue copies share ownership of the tensor buffer, so the capsule keeps the memory
+  // alive until the numpy array is garbage collected.
+  std::unique_ptr<OrtValue> holder(new OrtValue(val));
+  PyObject* capsule = PyCapsule_New(holder.get(), nullptr, [](PyObject* cap) {
+    delete static_cast<OrtValue*>(PyCapsule_GetPointer(cap, nullptr));
+  });
+  if (!capsule) {
+    throw std::runtime_error("Failed to create the capsule holding the output tensor");
+  }
+  holder.release();
+  if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(obj.ptr()), capsule) != 0) {
+    Py_DECREF(capsule);
+    throw std::runtime_error("Failed to attach the output tensor lifetime to the numpy array");
+  }
+  return true;
+}
+
+// Output conversion for Run()/run_batch(): CPU tensors alias the OrtValue memory, anything
+// else falls back to the copying conversion.
+static void AddTensorAsPyObjNoCopy(const OrtValue& val, std::vector<py::object>& pyobjs) {
+  py::object obj;
+  if (!GetPyObjFromTensorNoCopy(val, obj)) {
+    GetPyObjFromTensor(val.Get<Tensor>(), obj, nullptr, nullptr);
+  }
+  pyobjs.push_back(obj);
+}
+
+// Converts a python feed dict to OrtValues. Must be called with the GIL held; used by both
+// run() and run_batch() so the batched path shares the single-run conversion semantics.
+static void ConvertPyFeeds(PyInferenceSession* sess, std::map<std::string, py::object>& pyfeeds,
+                           NameMLValMap& feeds) {
+  auto px = sess->GetSessionHandle()->GetModelInputs();
+  if (!px.first.IsOK() || !px.second) {
+    throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
+  }
+  for (auto _ : pyfeeds) {
+    OrtValue ml_value;
+    CreateGenericMLValue(px.second, GetAllocator(), _.first, _.second, &ml_value);
+    if (PyErr_Occurred()) {
+      PyObject *ptype, *pvalue, *ptraceback;
+      PyErr_Fetch(&ptype, &pvalue, &ptraceback);
+
+      PyObject* pStr = PyObject_Str(ptype);
+      std::string sType = py::reinterpret_borrow<py::str>(pStr);
+      Py_XDECREF(pStr);
+      pStr = PyObject_Str(pvalue);
+      sType += ": ";
+      sType += py::reinterpret_borrow<py::str>(pStr);
+      Py_XDECREF(pStr);
+      throw std::runtime_error(sType);
+    }
+    feeds.insert(std::make_pair(_.first, ml_value));
+  }
+}
+
 static inline void RegisterExecutionProvider(InferenceSession* sess, onnxruntime::IExecutionProviderFactory& f) {
   auto p = f.CreateProvider();
   OrtPybindThrowIfError(sess->RegisterExecutionProvider(std::move(p)));
@@ -1414,6 +1498,26 @@ void addObjectMethods(py::module& m, Environment& env) {
           throw std::runtime_error("Error when binding output: " + status.ErrorMessage());
         }
       })
+      .def("record_outputs_completion", [](SessionIOBinding* io_binding) -> void {
+        auto status = io_binding->Get()->RecordOutputsCompletion();
+        if (!status.IsOK()) {
+          throw std::runtime_error("Error when recording outputs completion: " + status.ErrorMessage());
+        }
+      })
+      .def("poll_outputs_completion", [](SessionIOBinding* io_binding) -> bool {
+        bool completed = false;
+        auto status = io_binding->Get()->PollOutputsCompletion(completed);
+        if (!status.IsOK()) {
+          throw std::runtime_error("Error when polling outputs completion: " + status.ErrorMessage());
+        }
+        return completed;
+      })
+      .def("wait_outputs_completion", [](SessionIOBinding* io_binding) -> void {
+        auto status = io_binding->Get()->WaitOutputsCompletion();
+        if (!status.IsOK()) {
+          throw std::runtime_error("Error when waiting for outputs completion: " + status.ErrorMessage());
+        }
+      })
       .def("clear_binding_inputs", [](SessionIOBinding* io_binding) -> void {
         io_binding->Get()->ClearInputs();
       })
@@ -1733,28 +1837,7 @@ including arg name, arg type (contains both type and shape).)pbdoc")
               std::map<std::string, py::object> pyfeeds, RunOptions* run_options = nullptr)
                -> std::vector<py::object> {
              NameMLValMap feeds;
-             for (auto _ : pyfeeds) {
-               OrtValue ml_value;
-               auto px = sess->GetSessionHandle()->GetModelInputs();
-               if (!px.first.IsOK() || !px.second) {
-                 throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
-               }
-               CreateGenericMLValue(px.second, GetAllocator(), _.first, _.second, &ml_value);
-               if (PyErr_Occurred()) {
-                 PyObject *ptype, *pvalue, *ptraceback;
-                 PyErr_Fetch(&ptype, &pvalue, &ptraceback);
-
-                 PyObject* pStr = PyObject_Str(ptype);
-                 std::string sType = py::reinterpret_borrow<py::str>(pStr);
-                 Py_XDECREF(pStr);
-                 pStr = PyObject_Str(pvalue);
-                 sType += ": ";
-                 sType += py::reinterpret_borrow<py::str>(pStr);
-                 Py_XDECREF(pStr);
-                 throw std::runtime_error(sType);
-               }
-               feeds.insert(std::make_pair(_.first, ml_value));
-             }
+             ConvertPyFeeds(sess, pyfeeds, feeds);
 
              std::vector<OrtValue> fetches;
              common::Status status;
@@ -1773,13 +1856,80 @@ including arg name, arg type (contains both type and shape).)pbdoc")
              rfetch.reserve(fetches.size());
              for (auto _ : fetches) {
                if (_.IsTensor()) {
-                 AddTensorAsPyObj(_, rfetch, nullptr, nullptr);
+                 AddTensorAsPyObjNoCopy(_, rfetch);
                } else {
                  AddNonTensorAsPyObj(_, rfetch, nullptr, nullptr);
                }
              }
              return rfetch;
            })
+      .def("run_batch",
+           [](PyInferenceSession* sess, std::vector<std::string> output_names,
+              std::vector<std::map<std::string, py::object>> pyfeeds_batch, RunOptions* run_options = nullptr)
+               -> std::vector<std::vector<py::object>> {
+             // convert every feed dict while the GIL is still held
+             std::vector<NameMLValMap> feeds_batch(pyfeeds_batch.size());
+             for (size_t i = 0; i < pyfeeds_batch.size(); ++i) {
+               ConvertPyFeeds(sess, pyfeeds_batch[i], feeds_batch[i]);
+             }
+
+             std::vector<std::vector<OrtValue>> fetches_batch(feeds_batch.size());
+             std::vector<common::Status> statuses(feeds_batch.size());
+
+             {
+               // release the GIL once for the whole batch and fan the runs out over a shared
+               // pool; InferenceSession::Run is thread safe so the batch executes concurrently.
+               py::gil_scoped_release release;
+               static std::unique_ptr<onnxruntime::concurrency::ThreadPool> batch_pool = []() {
+                 OrtThreadPoolParams tpo;
+                 tpo.name = ORT_TSTR("ort-run-batch");
+                 return onnxruntime::concurrency::CreateThreadPool(
+                     &onnxruntime::Env::Default(), tpo, onnxruntime::concurrency::ThreadPoolType::INTER_OP);
+               }();
+               onnxruntime::concurrency::ThreadPool::TrySimpleParallelFor(
+                   batch_pool.get(), static_cast<std::ptrdiff_t>(feeds_batch.size()),
+                   [&](std::ptrdiff_t i) {
+                     if (run_options != nullptr) {
+                       statuses[i] = sess->GetSessionHandle()->Run(*run_options, feeds_batch[i], output_names,
+                                                                   &fetches_batch[i]);
+                     } else {
+                       statuses[i] = sess->GetSessionHandle()->Run(feeds_batch[i], output_names, &fetches_batch[i]);
+                     }
+                   });
+             }
+
+             for (auto& status : statuses) {
+               OrtPybindThrowIfError(status);
+             }
+
+             std::vector<std::vector<py::object>> rfetch_batch;
+             rfetch_batch.reserve(fetches_batch.size());
+             for (auto& fetches : fetches_batch) {
+               std::vector<py::object> rfetch;
+               rfetch.reserve(fetches.size());
+               for (auto _ : fetches) {
+                 if (_.IsTensor()) {
+                   AddTensorAsPyObjNoCopy(_, rfetch);
+                 } else {
+                   AddNonTensorAsPyObj(_, rfetch, nullptr, nullptr);
+                 }
+               }
+               rfetch_batch.push_back(std::move(rfetch));
+             }
+             return rfetch_batch;
+           },
+           R"pbdoc(Score a list of feed dicts in one call: all feeds are converted up front, the GIL is
+released once, and the runs execute concurrently on a shared thread pool. Returns one fetch
+list per feed dict, in order.)pbdoc")
+      .def("warmup",
+           [](PyInferenceSession* sess, size_t num_runs) -> void {
+             // release GIL since the warm-up runs can take a while on first use.
+             py::gil_scoped_release release;
+             OrtPybindThrowIfError(sess->GetSessionHandle()->Warmup(num_runs));
+           },
+           py::arg("num_runs") = static_cast<size_t>(2),
+           R"pbdoc(Run the model with synthesized zero-filled inputs so first-run costs
+(arena growth, memory pattern capture, kernel setup) are paid before serving real requests.)pbdoc")
       .def("end_profiling", [](PyInferenceSession* sess) -> std::string {
         return sess->GetSessionHandle()->EndProfiling();
       })
@@ -41,5 +41,29 @@ TEST(Utf8UtilTest, Validate) {
   }
 }
 
+// Inputs longer than a word exercise the chunked ASCII fast path, including
+// multi-byte sequences and invalid bytes that follow a long ASCII run.
+TEST(Utf8UtilTest, ValidateLongAsciiRun) {
+  using namespace utf8_util;
+
+  const std::string ascii(20, 'a');
+  size_t utf8_len = 0;
+  ASSERT_TRUE(utf8_validate(reinterpret_cast<const unsigned char*>(ascii.data()), ascii.size(), utf8_len));
+  ASSERT_EQ(ascii.size(), utf8_len);
+
+  const std::string mixed = ascii + "\xe2\x82\xa1" + ascii;
+  utf8_len = 0;
+  ASSERT_TRUE(utf8_validate(reinterpret_cast<const unsigned char*>(mixed.data()), mixed.size(), utf8_len));
+  ASSERT_EQ(ascii.size() * 2 + 1, utf8_len);
+
+  utf8_len = 0;
+  ASSERT_TRUE(utf8_util::utf8_len(reinterpret_cast<const unsigned char*>(mixed.data()), mixed.size(), utf8_len));
+  ASSERT_EQ(ascii.size() * 2 + 1, utf8_len);
+
+  const std::string invalid = ascii + "\xe2\x28\xa1";
+  utf8_len = 0;
+  ASSERT_FALSE(utf8_validate(reinterpret_cast<const unsigned char*>(invalid.data()), invalid.size(), utf8_len));
+}
+
 }  // namespace test
 }  // namespace onnxruntime
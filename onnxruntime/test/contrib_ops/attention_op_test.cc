@@ -1429,5 +1429,93 @@ TEST(AttentionTest, AttentionPastState_dynamic) {
   test.Run();
 }
 
+TEST(AttentionTest, AttentionCrossAttention) {
+  // Q is projected from input, K and V from the key_value input whose sequence length differs.
+  int batch_size = 1;
+  int sequence_length = 2;
+  int kv_sequence_length = 3;
+  int hidden_size = 4;
+  int number_of_heads = 2;
+
+  std::vector<float> input_data = {
+      -0.52f, 0.09f, -0.26f, 0.21f,
+      0.25f, -0.87f, -0.97f, 0.67f};
+
+  std::vector<float> key_value_data = {
+      -0.48f, -0.53f, 0.99f, -0.06f,
+      0.67f, -0.05f, 0.28f, -0.70f,
+      0.27f, 0.74f, 0.05f, 0.48f};
+
+  std::vector<float> weight_data = {
+      0.34f, -0.87f, 0.52f, 0.18f, -0.40f, -0.94f, 0.73f, -0.05f, 0.44f, 0.76f, 0.43f, 0.84f,
+      -0.21f, 0.60f, -0.11f, 0.87f, 0.76f, -0.81f, -0.73f, -0.57f, 0.93f, -0.13f, 0.25f, -0.40f,
+      0.01f, -0.23f, -0.30f, 0.17f, 0.17f, 0.81f, 0.36f, 0.86f, 0.71f, 0.98f, 0.34f, -0.67f,
+      0.72f, 0.93f, 0.81f, 0.14f, 0.43f, -0.58f, 0.66f, 0.15f, -0.43f, -0.87f, 0.71f, 0.98f};
+
+  std::vector<float> bias_data = {
+      -0.82f, 0.60f, -0.18f, -0.70f, -0.41f, 0.54f, 0.75f, -0.91f, 0.23f, -0.91f, 0.44f, -0.34f};
+
+  std::vector<float> output_data = {
+      0.423170f, -0.077253f, 0.685011f, -0.456630f,
+      0.532046f, -0.143594f, 0.725989f, -0.377851f};
+
+  OpTester tester("Attention", 1, onnxruntime::kMSDomain);
+  tester.AddAttribute<int64_t>("num_heads", static_cast<int64_t>(number_of_heads));
+  tester.AddInput<float>("input", {batch_size, sequence_length, hidden_size}, input_data);
+  tester.AddInput<float>("weight", {hidden_size, 3 * hidden_size}, weight_data);
+  tester.AddInput<float>("bias", {3 * hidden_size}, bias_data);
+  tester.AddMissingOptionalInput<int32_t>();  // mask_index
+  tester.AddMissingOptionalInput<float>();    // past
+  tester.AddInput<float>("key_value", {batch_size, kv_sequence_length, hidden_size}, key_value_data);
+  tester.AddOutput<float>("output", {batch_size, sequence_length, hidden_size}, output_data);
+
+  // The CUDA Attention kernel does not support the key_value input.
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(AttentionTest, AttentionCrossAttentionWithMask) {
+  // Raw attention mask over the key_value positions: the second position is masked out,
+  // so the result matches attending to the first key_value row only.
+  int batch_size = 1;
+  int sequence_length = 1;
+  int kv_sequence_length = 2;
+  int hidden_size = 2;
+  int number_of_heads = 1;
+
+  std::vector<float> input_data = {0.5f, -0.25f};
+
+  std::vector<float> key_value_data = {
+      1.0f, 0.0f,
+      0.0f, 1.0f};
+
+  // Identity projections for Q, K and V.
+  std::vector<float> weight_data = {
+      1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f};
+
+  std::vector<float> bias_data = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+  std::vector<int32_t> mask_index_data = {1, 0};  // only the first key_value position is attended
+
+  // With the second position masked out, softmax collapses to the first V row.
+  std::vector<float> output_data = {1.0f, 0.0f};
+
+  OpTester tester("Attention", 1, onnxruntime::kMSDomain);
+  tester.AddAttribute<int64_t>("num_heads", static_cast<int64_t>(number_of_heads));
+  tester.AddInput<float>("input", {batch_size, sequence_length, hidden_size}, input_data);
+  tester.AddInput<float>("weight", {hidden_size, 3 * hidden_size}, weight_data);
+  tester.AddInput<float>("bias", {3 * hidden_size}, bias_data);
+  tester.AddInput<int32_t>("mask_index", {batch_size, kv_sequence_length}, mask_index_data);
+  tester.AddMissingOptionalInput<float>();  // past
+  tester.AddInput<float>("key_value", {batch_size, kv_sequence_length, hidden_size}, key_value_data);
+  tester.AddOutput<float>("output", {batch_size, sequence_length, hidden_size}, output_data);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -0,0 +1,273 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "test/framework/test_utils.h"
+#include "test/providers/provider_test_utils.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+// Tests for the session-managed Attention KV cache enabled through
+// RunOptions::run_sequence_id (RunOptionsSetSequenceId/RunOptionsResetSequence in the
+// C API). OpTester builds a fresh session per Run, so these tests drive an
+// InferenceSession directly to keep kernel state alive across decode steps.
+
+namespace {
+
+constexpr int kBatchSize = 1;
+constexpr int kHiddenSize = 8;
+constexpr int kNumHeads = 2;
+constexpr int kHeadSize = kHiddenSize / kNumHeads;
+
+// deterministic, non-symmetric fillers so every head and position gets distinct values
+float WeightValue(size_t i) { return 0.05f * static_cast<float>(static_cast<int>(i * 3 % 11) - 5); }
+float BiasValue(size_t i) { return 0.1f * static_cast<float>(static_cast<int>(i * 5 % 7) - 3); }
+float InputValue(size_t i) { return 0.25f * static_cast<float>(static_cast<int>(i * 7 % 13) - 6); }
+
+// Builds a single-node unidirectional Attention model. With 'with_past' the model takes
+// a past state input and returns the present state, i.e. the stateless incremental
+// decoding path the KV cache replaces. The sequence length dims are symbolic so one
+// session can run steps of different lengths.
+void CreateAttentionModel(std::unique_ptr<Model>& model, bool with_past) {
+  model = onnxruntime::make_unique<Model>(
+      "AttentionSequenceCacheTest", false, ModelMetaData(), PathString(),
+      IOnnxRuntimeOpSchemaRegistryList(), std::unordered_map<std::string, int>{{kOnnxDomain, 12}, {kMSDomain, 1}},
+      std::vector<ONNX_NAMESPACE::FunctionProto>{}, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model->MainGraph();
+
+  TypeProto input_type;
+  input_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kBatchSize);
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("seq");
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kHiddenSize);
+
+  TypeProto weights_type;
+  weights_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  weights_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kHiddenSize);
+  weights_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3 * kHiddenSize);
+
+  TypeProto bias_type;
+  bias_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  bias_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3 * kHiddenSize);
+
+  auto& input = graph.GetOrCreateNodeArg("input", &input_type);
+  auto& weights = graph.GetOrCreateNodeArg("weights", &weights_type);
+  auto& bias = graph.GetOrCreateNodeArg("bias", &bias_type);
+  auto& output = graph.GetOrCreateNodeArg("output", &input_type);
+
+  TensorProto weights_proto;
+  weights_proto.set_name("weights");
+  weights_proto.set_data_type(TensorProto_DataType_FLOAT);
+  weights_proto.add_dims(kHiddenSize);
+  weights_proto.add_dims(3 * kHiddenSize);
+  for (size_t i = 0; i < static_cast<size_t>(kHiddenSize) * 3 * kHiddenSize; ++i) {
+    weights_proto.add_float_data(WeightValue(i));
+  }
+  graph.AddInitializedTensor(weights_proto);
+
+  TensorProto bias_proto;
+  bias_proto.set_name("bias");
+  bias_proto.set_data_type(TensorProto_DataType_FLOAT);
+  bias_proto.add_dims(3 * kHiddenSize);
+  for (size_t i = 0; i < static_cast<size_t>(3) * kHiddenSize; ++i) {
+    bias_proto.add_float_data(BiasValue(i));
+  }
+  graph.AddInitializedTensor(bias_proto);
+
+  std::vector<NodeArg*> node_inputs{&input, &weights, &bias};
+  std::vector<NodeArg*> node_outputs{&output};
+
+  if (with_past) {
+    TypeProto past_type;
+    past_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    past_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+    past_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kBatchSize);
+    past_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kNumHeads);
+    past_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("past_seq");
+    past_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kHeadSize);
+
+    TypeProto present_type;
+    present_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    present_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+    present_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kBatchSize);
+    present_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kNumHeads);
+    present_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("total_seq");
+    present_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kHeadSize);
+
+    auto& past = graph.GetOrCreateNodeArg("past", &past_type);
+    auto& present = graph.GetOrCreateNodeArg("present", &present_type);
+    auto& empty_mask = graph.GetOrCreateNodeArg("", nullptr);
+
+    node_inputs.push_back(&empty_mask);  // mask_index is not used
+    node_inputs.push_back(&past);
+    node_outputs.push_back(&present);
+  }
+
+  auto& attention = graph.AddNode("attention", "Attention", "unidirectional self attention",
+                                  node_inputs, node_outputs, nullptr, kMSDomain);
+  attention.AddAttribute("num_heads", static_cast<int64_t>(kNumHeads));
+  attention.AddAttribute("unidirectional", static_cast<int64_t>(1));
+
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+void CreateAttentionSession(std::unique_ptr<InferenceSession>& session, bool with_past) {
+  std::unique_ptr<Model> model;
+  CreateAttentionModel(model, with_past);
+  if (!model) return;  // CreateAttentionModel already failed the test
+
+  std::string model_data;
+  model->ToProto().SerializeToString(&model_data);
+  std::stringstream sstr(model_data);
+
+  SessionOptions so;
+  so.session_logid = "AttentionSequenceCacheTest";
+  session = onnxruntime::make_unique<InferenceSession>(so, GetEnvironment());
+  ASSERT_STATUS_OK(session->Load(sstr));
+  ASSERT_STATUS_OK(session->Initialize());
+}
+
+OrtValue MakeInput(int sequence_length, size_t first_token) {
+  std::vector<float> values;
+  values.reserve(static_cast<size_t>(sequence_length) * kHiddenSize);
+  for (size_t i = 0; i < static_cast<size_t>(sequence_length) * kHiddenSize; ++i) {
+    values.push_back(InputValue(first_token * kHiddenSize + i));
+  }
+
+  OrtValue value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault),
+                       {kBatchSize, sequence_length, kHiddenSize}, values, &value);
+  return value;
+}
+
+std::vector<float> GetOutput(const OrtValue& value) {
+  const auto& tensor = value.Get<Tensor>();
+  const float* data = tensor.Data<float>();
+  return std::vector<float>(data, data + tensor.Shape().Size());
+}
+
+void ExpectOutputsNear(const std::vector<float>& expected, const std::vector<float>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(expected[i], actual[i], 1e-5f) << "at element " << i;
+  }
+}
+
+}  // namespace
+
+// Decodes the same token stream twice: once through the past/present inputs and once
+// through the session-managed cache. Every step's output must match.
+TEST(AttentionSequenceCacheTest, CachedRunsMatchPastPresentPath) {
+  std::unique_ptr<InferenceSession> cached_session;
+  CreateAttentionSession(cached_session, false);
+  std::unique_ptr<InferenceSession> reference_session;
+  CreateAttentionSession(reference_session, true);
+  ASSERT_TRUE(cached_session && reference_session);
+
+  RunOptions cached_options;
+  cached_options.run_sequence_id = "CachedRunsMatchPastPresentPath";
+  cached_options.run_sequence_max_length = 4;
+
+  RunOptions reference_options;
+
+  // start with an empty past state
+  OrtValue past;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault),
+                       {2, kBatchSize, kNumHeads, 0, kHeadSize}, std::vector<float>{}, &past);
+
+  const std::vector<int> step_lengths{2, 1, 1};
+  size_t next_token = 0;
+  for (int step_length : step_lengths) {
+    OrtValue input = MakeInput(step_length, next_token);
+    next_token += step_length;
+
+    std::vector<OrtValue> cached_fetches;
+    ASSERT_STATUS_OK(cached_session->Run(cached_options, {{"input", input}}, {"output"}, &cached_fetches));
+
+    std::vector<OrtValue> reference_fetches;
+    ASSERT_STATUS_OK(reference_session->Run(reference_options, {{"input", input}, {"past", past}},
+                                            {"output", "present"}, &reference_fetches));
+    past = reference_fetches[1];
+
+    ExpectOutputsNear(GetOutput(reference_fetches[0]), GetOutput(cached_fetches[0]));
+  }
+}
+
+// The cache capacity is fixed on the first Run: exceeding it must fail cleanly, the
+// accumulated state must change the result of re-running an earlier input, and a reset
+// must restore the fresh-sequence behavior so the handle can be reused.
+TEST(AttentionSequenceCacheTest, ResetAndCapacity) {
+  std::unique_ptr<InferenceSession> session;
+  CreateAttentionSession(session, false);
+  ASSERT_TRUE(session);
+
+  RunOptions run_options;
+  run_options.run_sequence_id = "ResetAndCapacity";
+  run_options.run_sequence_max_length = 5;
+
+  OrtValue first_input = MakeInput(2, 0);
+
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session->Run(run_options, {{"input", first_input}}, {"output"}, &fetches));
+  const std::vector<float> fresh_output = GetOutput(fetches[0]);
+
+  ASSERT_STATUS_OK(session->Run(run_options, {{"input", MakeInput(1, 2)}}, {"output"}, &fetches));
+
+  // 3 of 5 tokens used: re-running the first input attends over the cached state as
+  // well, so its output must differ from the fresh run
+  ASSERT_STATUS_OK(session->Run(run_options, {{"input", first_input}}, {"output"}, &fetches));
+  const std::vector<float> stateful_output = GetOutput(fetches[0]);
+  ASSERT_EQ(fresh_output.size(), stateful_output.size());
+  bool any_difference = false;
+  for (size_t i = 0; i < fresh_output.size(); ++i) {
+    any_difference |= std::abs(fresh_output[i] - stateful_output[i]) > 1e-5f;
+  }
+  EXPECT_TRUE(any_difference) << "cached state had no effect on a repeated input";
+
+  // the cache is full now, so one more token must be rejected
+  auto status = session->Run(run_options, {{"input", MakeInput(1, 4)}}, {"output"}, &fetches);
+  ASSERT_FALSE(status.IsOK());
+  EXPECT_NE(status.ErrorMessage().find("exceeds its max_length"), std::string::npos) << status.ErrorMessage();
+
+  // after a reset the handle behaves like a brand new sequence
+  run_options.run_sequence_reset = true;
+  ASSERT_STATUS_OK(session->Run(run_options, {{"input", first_input}}, {"output"}, &fetches));
+  ExpectOutputsNear(fresh_output, GetOutput(fetches[0]));
+}
+
+// The cache replaces the past/present state, so combining a sequence id with a past
+// input has no sensible semantics and must be rejected.
+TEST(AttentionSequenceCacheTest, PastInputRejectedWithSequenceId) {
+  std::unique_ptr<InferenceSession> session;
+  CreateAttentionSession(session, true);
+  ASSERT_TRUE(session);
+
+  RunOptions run_options;
+  run_options.run_sequence_id = "PastInputRejectedWithSequenceId";
+  run_options.run_sequence_max_length = 4;
+
+  OrtValue past;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault),
+                       {2, kBatchSize, kNumHeads, 0, kHeadSize}, std::vector<float>{}, &past);
+
+  std::vector<OrtValue> fetches;
+  auto status = session->Run(run_options, {{"input", MakeInput(1, 0)}, {"past", past}},
+                             {"output", "present"}, &fetches);
+  ASSERT_FALSE(status.IsOK());
+  EXPECT_NE(status.ErrorMessage().find("cannot be combined with a RunOptions sequence id"), std::string::npos)
+      << status.ErrorMessage();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
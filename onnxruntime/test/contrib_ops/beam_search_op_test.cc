@@ -0,0 +1,309 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/graph/model.h"
+#include "test/providers/provider_test_utils.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+constexpr const char* kBeamSearchDomain = onnxruntime::kMSDomain;
+
+// Builds a deterministic one-step decoder: the logits for the next token are the row of
+// a fixed [vocab_size, vocab_size] table selected by the current token. With a state
+// variable, a per-slot [num_slots, vocab_size] bias is added to the logits and carried
+// forward unchanged, so the tokens a slot produces reveal which state row it was fed.
+GraphProto CreateDecoderSubgraph(int64_t num_slots, int64_t vocab_size,
+                                 const std::vector<float>& table, bool with_state) {
+  Model model("BeamSearch subgraph", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{"", 12}}, {}, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto tokens_type;
+  tokens_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT32);
+  tokens_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(num_slots);
+  tokens_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  TypeProto logits_type;
+  logits_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  logits_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(num_slots);
+  logits_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(vocab_size);
+
+  TypeProto gathered_type;
+  gathered_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  gathered_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(num_slots);
+  gathered_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+  gathered_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(vocab_size);
+
+  TypeProto table_type;
+  table_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  table_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(vocab_size);
+  table_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(vocab_size);
+
+  auto& tokens = graph.GetOrCreateNodeArg("tokens", &tokens_type);
+  auto& logits = graph.GetOrCreateNodeArg("logits", &logits_type);
+  auto& gathered = graph.GetOrCreateNodeArg("gathered", &gathered_type);
+  auto& table_arg = graph.GetOrCreateNodeArg("table", &table_type);
+
+  TensorProto table_proto;
+  table_proto.set_name("table");
+  table_proto.set_data_type(TensorProto_DataType_FLOAT);
+  table_proto.add_dims(vocab_size);
+  table_proto.add_dims(vocab_size);
+  for (auto value : table) {
+    table_proto.add_float_data(value);
+  }
+  graph.AddInitializedTensor(table_proto);
+
+  graph.AddNode("gather", "Gather", "Next-token logits for the current tokens",
+                {&table_arg, &tokens}, {&gathered});
+
+  if (!with_state) {
+    auto& squeeze = graph.AddNode("squeeze", "Squeeze", "Drop the tokens column dimension",
+                                  {&gathered}, {&logits});
+    squeeze.AddAttribute("axes", std::vector<int64_t>{1});
+
+    graph.SetInputs({&tokens});
+    graph.SetOutputs({&logits});
+  } else {
+    TypeProto state_type;
+    state_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    state_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(num_slots);
+    state_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(vocab_size);
+
+    auto& state = graph.GetOrCreateNodeArg("state", &state_type);
+    auto& state_out = graph.GetOrCreateNodeArg("state_out", &state_type);
+    auto& squeezed = graph.GetOrCreateNodeArg("squeezed", &logits_type);
+
+    auto& squeeze = graph.AddNode("squeeze", "Squeeze", "Drop the tokens column dimension",
+                                  {&gathered}, {&squeezed});
+    squeeze.AddAttribute("axes", std::vector<int64_t>{1});
+
+    graph.AddNode("add_state", "Add", "Bias the logits by the per-slot state",
+                  {&squeezed, &state}, {&logits});
+    graph.AddNode("state_identity", "Identity", "Carry the state forward",
+                  {&state}, {&state_out});
+
+    graph.SetInputs({&tokens, &state});
+    graph.SetOutputs({&logits, &state_out});
+  }
+
+  auto status = graph.Resolve();
+  EXPECT_EQ(status, Status::OK());
+
+  return graph.ToGraphProto();
+}
+
+// Reference log-softmax in double precision for computing expected beam scores.
+std::vector<float> LogSoftmax(const std::vector<float>& logits) {
+  const double max_value = *std::max_element(logits.cbegin(), logits.cend());
+  double sum = 0.0;
+  for (auto value : logits) {
+    sum += std::exp(value - max_value);
+  }
+  const double log_sum = max_value + std::log(sum);
+
+  std::vector<float> result;
+  result.reserve(logits.size());
+  for (auto value : logits) {
+    result.push_back(static_cast<float>(value - log_sum));
+  }
+  return result;
+}
+
+}  // namespace
+
+// Two beams over a table-driven decoder. The first step must seed from beam 0 only so
+// the two beams take the two best tokens of the start row instead of duplicating the
+// best one. Batch entry 1 starts from the same token as entry 0 and must produce the
+// same rows.
+TEST(BeamSearchTest, BasicTopK) {
+  const int64_t batch_size = 2;
+  const int64_t num_beams = 2;
+  const int64_t vocab_size = 4;
+  const int64_t max_length = 3;
+
+  // row per current token: starting from 0 the best continuations are 2 then 1.
+  // from 2 the decoder strongly prefers EOS (3); from 1 it prefers 0.
+  const std::vector<float> table{
+      0.f, 1.f, 2.f, -10.f,   // token 0
+      5.f, 0.f, 0.f, 0.f,     // token 1
+      0.f, 0.f, 0.f, 5.f,     // token 2
+      0.f, 0.f, 0.f, 0.f};    // token 3 (EOS, unused)
+
+  auto ls0 = LogSoftmax({0.f, 1.f, 2.f, -10.f});
+  auto ls1 = LogSoftmax({5.f, 0.f, 0.f, 0.f});
+  auto ls2 = LogSoftmax({0.f, 0.f, 0.f, 5.f});
+
+  // beam 0: 0 -> 2 -> EOS. beam 1: 0 -> 1 -> 0. both have 3 generated tokens.
+  const float score_beam0 = (ls0[2] + ls2[3]) / 3.f;
+  const float score_beam1 = (ls0[1] + ls1[0]) / 3.f;
+
+  OpTester test("BeamSearch", 1, kBeamSearchDomain);
+  test.AddAttribute<GraphProto>("body",
+                                CreateDecoderSubgraph(batch_size * num_beams, vocab_size, table, false));
+  test.AddAttribute<int64_t>("eos_token_id", 3);
+  test.AddAttribute<int64_t>("pad_token_id", 0);
+
+  test.AddInput<int32_t>("input_ids", {batch_size, 1}, {0, 0});
+  test.AddInput<int32_t>("max_length", {}, {static_cast<int32_t>(max_length)});
+  test.AddInput<int32_t>("num_beams", {}, {static_cast<int32_t>(num_beams)});
+  test.AddInput<float>("length_penalty", {}, {1.f});
+
+  test.AddOutput<int32_t>("sequences", {batch_size, num_beams, max_length},
+                          {0, 2, 3, 0, 1, 0,
+                           0, 2, 3, 0, 1, 0});
+  test.AddOutput<float>("sequence_scores", {batch_size, num_beams},
+                        {score_beam0, score_beam1, score_beam0, score_beam1});
+
+  test.Run();
+}
+
+// Every beam reaches EOS two steps in, well before max_length. Decoding must stop early
+// and the remaining positions must be filled with the pad token.
+TEST(BeamSearchTest, EarlyStopOnEos) {
+  const int64_t batch_size = 1;
+  const int64_t num_beams = 2;
+  const int64_t vocab_size = 4;
+  const int64_t max_length = 5;
+
+  // from both 1 and 2 the decoder strongly prefers EOS.
+  const std::vector<float> table{
+      0.f, 1.f, 2.f, -10.f,   // token 0
+      0.f, 0.f, 0.f, 5.f,     // token 1
+      0.f, 0.f, 0.f, 5.f,     // token 2
+      0.f, 0.f, 0.f, 0.f};    // token 3 (EOS, unused)
+
+  auto ls0 = LogSoftmax({0.f, 1.f, 2.f, -10.f});
+  auto ls_eos = LogSoftmax({0.f, 0.f, 0.f, 5.f});
+
+  const float score_beam0 = (ls0[2] + ls_eos[3]) / 3.f;
+  const float score_beam1 = (ls0[1] + ls_eos[3]) / 3.f;
+
+  OpTester test("BeamSearch", 1, kBeamSearchDomain);
+  test.AddAttribute<GraphProto>("body",
+                                CreateDecoderSubgraph(batch_size * num_beams, vocab_size, table, false));
+  test.AddAttribute<int64_t>("eos_token_id", 3);
+  test.AddAttribute<int64_t>("pad_token_id", 0);
+
+  test.AddInput<int32_t>("input_ids", {batch_size, 1}, {0});
+  test.AddInput<int32_t>("max_length", {}, {static_cast<int32_t>(max_length)});
+  test.AddInput<int32_t>("num_beams", {}, {static_cast<int32_t>(num_beams)});
+  test.AddInput<float>("length_penalty", {}, {1.f});
+
+  test.AddOutput<int32_t>("sequences", {batch_size, num_beams, max_length},
+                          {0, 2, 3, 0, 0,
+                           0, 1, 3, 0, 0});
+  test.AddOutput<float>("sequence_scores", {batch_size, num_beams},
+                        {score_beam0, score_beam1});
+
+  test.Run();
+}
+
+// One beam finishes at the first step with the better raw score while the other keeps
+// generating. A large length penalty divides by length^penalty, so the longer beam must
+// be ranked first there while a penalty of 1 keeps the finished beam first.
+TEST(BeamSearchTest, LengthPenaltyOrdering) {
+  const int64_t batch_size = 1;
+  const int64_t num_beams = 2;
+  const int64_t vocab_size = 4;
+  const int64_t max_length = 3;
+
+  // starting from 0 the best continuations are EOS then 1; from 1 the decoder prefers 0.
+  const std::vector<float> table{
+      -10.f, 1.5f, -10.f, 2.f,  // token 0
+      5.f, 0.f, 0.f, -10.f,     // token 1
+      0.f, 0.f, 0.f, 0.f,       // token 2 (unused)
+      0.f, 0.f, 0.f, 0.f};      // token 3 (EOS, unused)
+
+  auto ls0 = LogSoftmax({-10.f, 1.5f, -10.f, 2.f});
+  auto ls1 = LogSoftmax({5.f, 0.f, 0.f, -10.f});
+
+  // the finished beam generated 2 tokens (0 -> EOS), the unfinished one 3 (0 -> 1 -> 0)
+  const float finished_score = ls0[3];
+  const float unfinished_score = ls0[1] + ls1[0];
+
+  auto run_test = [&](float length_penalty, const std::vector<int32_t>& sequences,
+                      const std::vector<float>& scores) {
+    OpTester test("BeamSearch", 1, kBeamSearchDomain);
+    test.AddAttribute<GraphProto>("body",
+                                  CreateDecoderSubgraph(batch_size * num_beams, vocab_size, table, false));
+    test.AddAttribute<int64_t>("eos_token_id", 3);
+    test.AddAttribute<int64_t>("pad_token_id", 0);
+
+    test.AddInput<int32_t>("input_ids", {batch_size, 1}, {0});
+    test.AddInput<int32_t>("max_length", {}, {static_cast<int32_t>(max_length)});
+    test.AddInput<int32_t>("num_beams", {}, {static_cast<int32_t>(num_beams)});
+    test.AddInput<float>("length_penalty", {}, {length_penalty});
+
+    test.AddOutput<int32_t>("sequences", {batch_size, num_beams, max_length}, sequences);
+    test.AddOutput<float>("sequence_scores", {batch_size, num_beams}, scores);
+
+    test.Run();
+  };
+
+  run_test(1.f,
+           {0, 3, 0, 0, 1, 0},
+           {finished_score / 2.f, unfinished_score / 3.f});
+
+  run_test(3.f,
+           {0, 1, 0, 0, 3, 0},
+           {unfinished_score / 27.f, finished_score / 8.f});
+}
+
+// After the first step both surviving beams continue from slot 0, so both must be fed
+// slot 0's state. Slot 1's initial state strongly pushes towards EOS; if the state were
+// fed back without the origin gather the second beam would emit EOS instead of 1.
+TEST(BeamSearchTest, StateFollowsSelectedBeams) {
+  const int64_t batch_size = 1;
+  const int64_t num_beams = 2;
+  const int64_t vocab_size = 4;
+  const int64_t max_length = 3;
+
+  const std::vector<float> table{
+      0.f, 1.f, 2.f, -10.f,   // token 0
+      0.f, 6.f, 0.f, -10.f,   // token 1
+      6.f, 0.f, 0.f, -10.f,   // token 2
+      0.f, 0.f, 0.f, 0.f};    // token 3 (EOS, unused)
+
+  auto ls0 = LogSoftmax({0.f, 1.f, 2.f, -10.f});
+  auto ls1 = LogSoftmax({0.f, 6.f, 0.f, -10.f});
+  auto ls2 = LogSoftmax({6.f, 0.f, 0.f, -10.f});
+
+  // beam 0: 0 -> 2 -> 0. beam 1: 0 -> 1 -> 1, scored with slot 0's zero state bias.
+  const float score_beam0 = (ls0[2] + ls2[0]) / 3.f;
+  const float score_beam1 = (ls0[1] + ls1[1]) / 3.f;
+
+  OpTester test("BeamSearch", 1, kBeamSearchDomain);
+  test.AddAttribute<GraphProto>("body",
+                                CreateDecoderSubgraph(batch_size * num_beams, vocab_size, table, true));
+  test.AddAttribute<int64_t>("eos_token_id", 3);
+  test.AddAttribute<int64_t>("pad_token_id", 0);
+
+  test.AddInput<int32_t>("input_ids", {batch_size, 1}, {0});
+  test.AddInput<int32_t>("max_length", {}, {static_cast<int32_t>(max_length)});
+  test.AddInput<int32_t>("num_beams", {}, {static_cast<int32_t>(num_beams)});
+  test.AddInput<float>("length_penalty", {}, {1.f});
+  test.AddInput<float>("state", {batch_size * num_beams, vocab_size},
+                       {0.f, 0.f, 0.f, 0.f,
+                        0.f, 0.f, 0.f, 100.f});
+
+  test.AddOutput<int32_t>("sequences", {batch_size, num_beams, max_length},
+                          {0, 2, 0, 0, 1, 1});
+  test.AddOutput<float>("sequence_scores", {batch_size, num_beams},
+                        {score_beam0, score_beam1});
+
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
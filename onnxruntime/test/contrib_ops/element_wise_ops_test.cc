@@ -218,5 +218,26 @@ TEST(MathOpTest, ComplexMulConj_fp16) {
   tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
 }
 
+TEST(MathOpTest, FusedElementWise_LeakyReluSigmoid) {
+  OpTester test("FusedElementWise", 1, kMSDomain);
+  test.AddAttribute("activations", std::vector<std::string>{"LeakyRelu", "Sigmoid"});
+  // LeakyRelu's alpha is carried with a per-stage prefix by the fusion transformer
+  test.AddAttribute("activation_0_alpha", 0.1f);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<float>("X", dims, {-2.0f, -1.0f, 0.0f, 1.0f, 2.0f, 4.0f});
+  test.AddOutput<float>("Y", dims,
+                        {0.450166f, 0.4750208f, 0.5f, 0.7310586f, 0.8807971f, 0.9820138f});
+  test.Run();
+}
+
+TEST(MathOpTest, FusedElementWise_ThreeStageChain) {
+  OpTester test("FusedElementWise", 1, kMSDomain);
+  test.AddAttribute("activations", std::vector<std::string>{"Relu", "Tanh", "Sigmoid"});
+  std::vector<int64_t> dims{3};
+  test.AddInput<float>("X", dims, {-1.0f, 0.0f, 2.0f});
+  test.AddOutput<float>("Y", dims, {0.5f, 0.5f, 0.7239293f});
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Builds the packed weight in the MatMulInt4 layout: one row per output
+// column, holding ceil(K / block_size) blocks of int4 nibbles (lower nibble
+// first), with one scale per block. The expected output is computed from the
+// dequantized weights.
+static void RunMatMulInt4Test(int64_t M, int64_t N, int64_t K, int64_t block_size) {
+  const int64_t blocks_per_col = (K + block_size - 1) / block_size;
+  const int64_t bytes_per_col = blocks_per_col * block_size / 2;
+
+  std::vector<float> a_data(M * K);
+  for (int64_t i = 0; i < M * K; ++i) {
+    a_data[i] = 0.1f * static_cast<float>((i * 7) % 11 - 5);
+  }
+
+  // nibble values, padded with 8 (which dequantizes to zero) past K
+  std::vector<uint8_t> nibbles(N * blocks_per_col * block_size, 8);
+  std::vector<float> scales(N * blocks_per_col);
+  for (int64_t n = 0; n < N; ++n) {
+    for (int64_t block = 0; block < blocks_per_col; ++block) {
+      scales[n * blocks_per_col + block] = 0.01f * static_cast<float>(n + 1) +
+                                           0.002f * static_cast<float>(block);
+    }
+    for (int64_t k = 0; k < K; ++k) {
+      nibbles[n * blocks_per_col * block_size + k] = static_cast<uint8_t>((k * 5 + n * 3) % 16);
+    }
+  }
+
+  std::vector<uint8_t> packed(N * bytes_per_col);
+  for (int64_t n = 0; n < N; ++n) {
+    const uint8_t* col_nibbles = nibbles.data() + n * blocks_per_col * block_size;
+    for (int64_t i = 0; i < blocks_per_col * block_size; i += 2) {
+      packed[n * bytes_per_col + i / 2] = static_cast<uint8_t>(col_nibbles[i] | (col_nibbles[i + 1] << 4));
+    }
+  }
+
+  std::vector<float> expected(M * N);
+  for (int64_t m = 0; m < M; ++m) {
+    for (int64_t n = 0; n < N; ++n) {
+      float sum = 0.0f;
+      for (int64_t k = 0; k < K; ++k) {
+        const float weight = static_cast<float>(nibbles[n * blocks_per_col * block_size + k] - 8) *
+                             scales[n * blocks_per_col + k / block_size];
+        sum += a_data[m * K + k] * weight;
+      }
+      expected[m * N + n] = sum;
+    }
+  }
+
+  OpTester test("MatMulInt4", 1, kMSDomain);
+  test.AddAttribute<int64_t>("K", K);
+  test.AddAttribute<int64_t>("N", N);
+  test.AddAttribute<int64_t>("block_size", block_size);
+  test.AddInput<float>("A", {M, K}, a_data);
+  test.AddInput<uint8_t>("B", {N, bytes_per_col}, packed);
+  test.AddInput<float>("scales", {N, blocks_per_col}, scales);
+  test.AddOutput<float>("Y", {M, N}, expected);
+  test.Run();
+}
+
+TEST(MatMulInt4ContribOpTest, BlockAligned) {
+  RunMatMulInt4Test(2, 4, 64, 32);
+}
+
+TEST(MatMulInt4ContribOpTest, PartialFinalBlock) {
+  RunMatMulInt4Test(3, 3, 70, 32);
+}
+
+TEST(MatMulInt4ContribOpTest, LargerBlockSize) {
+  RunMatMulInt4Test(1, 5, 100, 64);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -551,5 +551,261 @@ TEST(QLinearBinaryOpTest, MulS8VectorScalarBroadcast) {
     A, {3, 7, 3}, A_scale, A_zero_point, B, {1, 1, 3}, B_scale, B_zero_point, C_scale, C_zero_point);
 }
 
+static auto sub_function = [](float a_dequantized, float b_dequantized) {
+  return a_dequantized - b_dequantized;
+};
+
+static auto min_function = [](float a_dequantized, float b_dequantized) {
+  return std::min(a_dequantized, b_dequantized);
+};
+
+static auto max_function = [](float a_dequantized, float b_dequantized) {
+  return std::max(a_dequantized, b_dequantized);
+};
+
+//
+// Tests for QLinearSub
+//
+TEST(QLinearBinaryOpTest, SubU8VectorVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  const std::vector<float>& B(B4Add);
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 128;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 128;
+
+  RunQLinearMathTestFromFloat("QLinearSub", sub_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {63}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, SubU8VectorVectorBroadcast) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  std::vector<float> B = {
+      4.00f, 0.25f, 0.00f, -0.25f, 0.50f, -0.25f, -0.00f, 0.25f,
+      -1.50f, -2.25f, 2.50f, 3.75f, -3.75f, -4.00f, 5.00f, 5.50f,
+      -0.50f, -1.25f, 0.75f, 1.25f, 2.25f};
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 128;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 128;
+
+  RunQLinearMathTestFromFloat("QLinearSub", sub_function,
+                              A, {3, 3, 7}, A_scale, A_zero_point,
+                              B, {3, 1, 7}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+// the scalar A - vector B broadcast exercises the IsScalarA path that
+// QLinearAdd and QLinearMul can handle by swapping the commutative operands
+TEST(QLinearBinaryOpTest, SubU8ScalarVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  std::vector<float> B = {0.25f};
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 96;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 100;
+
+  RunQLinearMathTestFromFloat("QLinearSub", sub_function,
+                              B, {1}, B_scale, B_zero_point,
+                              A, {63}, A_scale, A_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, SubU8VectorScalarFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  std::vector<float> B = {0.25f};
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 96;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 128;
+
+  RunQLinearMathTestFromFloat("QLinearSub", sub_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {1}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, SubS8VectorVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  int8_t A_zero_point = 0;
+  const std::vector<float>& B(B4Add);
+  float B_scale = 8.0f / 256.0f;
+  int8_t B_zero_point = 0;
+  float C_scale = 8.0f / 256.0f;
+  int8_t C_zero_point = -16;
+
+  RunQLinearMathTestFromFloat("QLinearSub", sub_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {63}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, SubS8ScalarVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  int8_t A_zero_point = 0;
+  std::vector<float> B = {0.25f};
+  float B_scale = 8.0f / 256.0f;
+  int8_t B_zero_point = 16;
+  float C_scale = 8.0f / 256.0f;
+  int8_t C_zero_point = 10;
+
+  RunQLinearMathTestFromFloat("QLinearSub", sub_function,
+                              B, {1}, B_scale, B_zero_point,
+                              A, {63}, A_scale, A_zero_point,
+                              C_scale, C_zero_point);
+}
+
+//
+// Tests for QLinearMin
+//
+TEST(QLinearBinaryOpTest, MinU8VectorVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  const std::vector<float>& B(B4Add);
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 128;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 128;
+
+  RunQLinearMathTestFromFloat("QLinearMin", min_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {63}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, MinU8VectorScalarFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  std::vector<float> B = {0.25f};
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 96;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 100;
+
+  RunQLinearMathTestFromFloat("QLinearMin", min_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {1}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, MinU8VectorVectorBroadcast) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  std::vector<float> B = {
+      4.00f, 0.25f, 0.00f, -0.25f, 0.50f, -0.25f, -0.00f, 0.25f,
+      -1.50f, -2.25f, 2.50f, 3.75f, -3.75f, -4.00f, 5.00f, 5.50f,
+      -0.50f, -1.25f, 0.75f, 1.25f, 2.25f};
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 128;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 128;
+
+  RunQLinearMathTestFromFloat("QLinearMin", min_function,
+                              A, {3, 3, 7}, A_scale, A_zero_point,
+                              B, {3, 1, 7}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, MinS8VectorVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  int8_t A_zero_point = 0;
+  const std::vector<float>& B(B4Add);
+  float B_scale = 8.0f / 256.0f;
+  int8_t B_zero_point = 0;
+  float C_scale = 8.0f / 256.0f;
+  int8_t C_zero_point = -16;
+
+  RunQLinearMathTestFromFloat("QLinearMin", min_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {63}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+//
+// Tests for QLinearMax
+//
+TEST(QLinearBinaryOpTest, MaxU8VectorVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  const std::vector<float>& B(B4Add);
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 128;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 128;
+
+  RunQLinearMathTestFromFloat("QLinearMax", max_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {63}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, MaxU8VectorScalarFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  std::vector<float> B = {0.25f};
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 96;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 100;
+
+  RunQLinearMathTestFromFloat("QLinearMax", max_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {1}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, MaxU8VectorVectorBroadcast) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  uint8_t A_zero_point = 128;
+  std::vector<float> B = {
+      4.00f, 0.25f, 0.00f, -0.25f, 0.50f, -0.25f, -0.00f, 0.25f,
+      -1.50f, -2.25f, 2.50f, 3.75f, -3.75f, -4.00f, 5.00f, 5.50f,
+      -0.50f, -1.25f, 0.75f, 1.25f, 2.25f};
+  float B_scale = 8.0f / 256.0f;
+  uint8_t B_zero_point = 128;
+  float C_scale = 8.0f / 256.0f;
+  uint8_t C_zero_point = 128;
+
+  RunQLinearMathTestFromFloat("QLinearMax", max_function,
+                              A, {3, 3, 7}, A_scale, A_zero_point,
+                              B, {3, 1, 7}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
+TEST(QLinearBinaryOpTest, MaxS8VectorVectorFull) {
+  const std::vector<float>& A(A4Add);
+  float A_scale = 8.0f / 256.0f;
+  int8_t A_zero_point = 0;
+  const std::vector<float>& B(B4Add);
+  float B_scale = 8.0f / 256.0f;
+  int8_t B_zero_point = 0;
+  float C_scale = 8.0f / 256.0f;
+  int8_t C_zero_point = -16;
+
+  RunQLinearMathTestFromFloat("QLinearMax", max_function,
+                              A, {63}, A_scale, A_zero_point,
+                              B, {63}, B_scale, B_zero_point,
+                              C_scale, C_zero_point);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -781,5 +781,67 @@ TEST(QAttentionTest, QAttentionPastState_u8s8) {
                                                     true /*is_weight_constant*/);
 }
 
+TEST(QAttentionTest, QAttentionPerColumnScale) {
+  constexpr int batch_size = 1;
+  constexpr int sequence_length = 2;
+  constexpr int hidden_size = 4;
+  constexpr int number_of_heads = 2;
+
+  // Same data as QAttentionBatch1, but the weights are quantized with one
+  // scale per column of the (hidden_size, 3 * hidden_size) weight matrix.
+  std::vector<float> input_data = {
+      0.8f, -0.5f, 0.0f, 1.f,
+      0.5f, 0.2f, 0.3f, -0.6f};
+
+  std::vector<float> weight_data = {
+      0.1f, -0.2f, 0.3f, 1.0f, 1.1f, 0.3f, 0.5f, 0.2f, 0.3f, -0.6f, 1.5f, 2.0f,
+      0.5f, 0.1f, 0.4f, 1.6f, 1.0f, 2.0f, 0.4f, 0.8f, 0.9f, 0.1f, -1.3f, 0.7f,
+      0.3f, 0.2f, 4.0f, 2.2f, 1.6f, 1.1f, 0.7f, 0.2f, 0.4f, 1.0f, 1.2f, 0.5f,
+      0.2f, 0.1f, 0.4f, 1.6f, 2.4f, 3.3f, 2.1f, 4.2f, 8.4f, 0.0f, 2.1f, 3.2f};
+
+  std::vector<float> bias_data = {
+      -0.5f, 0.6f, 1.2f, 2.1f, 0.5f, 0.7f, 0.2f, 1.2f, 0.5f, 0.4f, 0.3f, 1.2f};
+
+  std::vector<int32_t> mask_index_data = {2L};
+
+  std::vector<float> output_data = {
+      3.1495983600616455f, 0.10843668878078461f, 4.25f, 5.6499996185302734f,
+      3.9696791172027588f, 0.073143675923347473f, 4.2499995231628418f, 5.6499991416931152f};
+
+  constexpr float input_scale = 0.1f;
+  constexpr uint8_t input_zero_point = 128;
+
+  // Every weight is a multiple of 0.05, and column 8 holds the largest
+  // magnitude (8.4), so use a wider scale there to stay inside int8 range.
+  std::vector<float> weight_scales(3 * hidden_size, 0.05f);
+  weight_scales[8] = 0.1f;
+
+  std::vector<int8_t> quantized_weights;
+  quantized_weights.reserve(weight_data.size());
+  for (size_t i = 0; i < weight_data.size(); i++) {
+    const float scale = weight_scales[i % (3 * hidden_size)];
+    quantized_weights.push_back(static_cast<int8_t>(std::round(weight_data[i] / scale)));
+  }
+
+  OpTester tester("QAttention", 1, onnxruntime::kMSDomain);
+  tester.AddAttribute<int64_t>("num_heads", static_cast<int64_t>(number_of_heads));
+
+  tester.AddInput<uint8_t>("input", {batch_size, sequence_length, hidden_size},
+                           ToInteger<uint8_t>(input_data, input_scale, input_zero_point));
+  tester.AddInput<int8_t>("weight", {hidden_size, 3 * hidden_size}, quantized_weights);
+  tester.AddInput<float>("bias", {3 * hidden_size}, bias_data);
+  tester.AddInput<float>("input_scale", {1}, {input_scale});
+  tester.AddInput<float>("weight_scale", {3 * hidden_size}, weight_scales);
+  tester.AddInput<int32_t>("mask_index", {batch_size}, mask_index_data);
+  tester.AddInput<uint8_t>("input_zero_point", {1}, {input_zero_point});
+  tester.AddInput<int8_t>("weight_zero_point", {3 * hidden_size},
+                          std::vector<int8_t>(3 * hidden_size, 0));
+  tester.AddOutput<float>("output", {batch_size, sequence_length, hidden_size}, output_data);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
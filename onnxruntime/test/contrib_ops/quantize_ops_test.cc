@@ -331,5 +331,44 @@ TEST(QuantizeLinearContribOpTest, QuantizeLinear_per_channel_negative_axis) {
                            0, 0, 1, 250});
   test.Run();
 }
+
+// requantize to a wider scale with uint8
+TEST(RequantizeLinearOpTest, RequantizeLinear_per_tensor_uint8_uint8) {
+  OpTester test("RequantizeLinear", 1, onnxruntime::kMSDomain);
+  std::vector<int64_t> dims{4};
+  test.AddInput<uint8_t>("x", dims, {0, 3, 128, 255});
+  test.AddInput<float>("x_scale", {}, {2.0f});
+  test.AddInput<uint8_t>("x_zero_point", {}, {128});
+  test.AddInput<float>("y_scale", {}, {4.0f});
+  test.AddInput<uint8_t>("y_zero_point", {}, {1});
+  test.AddOutput<uint8_t>("y", dims, {0, 0, 1, 65});
+  test.Run();
+}
+
+// requantize to a narrower scale with int8 and saturation
+TEST(RequantizeLinearOpTest, RequantizeLinear_per_tensor_int8_int8) {
+  OpTester test("RequantizeLinear", 1, onnxruntime::kMSDomain);
+  std::vector<int64_t> dims{4};
+  test.AddInput<int8_t>("x", dims, {-30, -3, 100, 127});
+  test.AddInput<float>("x_scale", {}, {2.0f});
+  test.AddInput<int8_t>("x_zero_point", {}, {-10});
+  test.AddInput<float>("y_scale", {}, {1.0f});
+  test.AddInput<int8_t>("y_zero_point", {}, {10});
+  test.AddOutput<int8_t>("y", dims, {-30, 24, 127, 127});
+  test.Run();
+}
+
+// requantize between the signed and unsigned 8-bit ranges
+TEST(RequantizeLinearOpTest, RequantizeLinear_per_tensor_int8_uint8) {
+  OpTester test("RequantizeLinear", 1, onnxruntime::kMSDomain);
+  std::vector<int64_t> dims{4};
+  test.AddInput<int8_t>("x", dims, {-30, -3, 100, 127});
+  test.AddInput<float>("x_scale", {}, {1.0f});
+  test.AddInput<int8_t>("x_zero_point", {}, {0});
+  test.AddInput<float>("y_scale", {}, {1.0f});
+  test.AddInput<uint8_t>("y_zero_point", {}, {128});
+  test.AddOutput<uint8_t>("y", dims, {98, 125, 228, 255});
+  test.Run();
+}
 }  // namespace test
 }  // namespace onnxruntime
\ No newline at end of file
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/common/tensor_op_test_utils.h"
+#include "test/providers/provider_test_utils.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// Reference dense product for validating the sparse kernel.
+std::vector<float> DenseMatMul(const std::vector<float>& a, const std::vector<float>& b,
+                               int64_t M, int64_t K, int64_t N) {
+  std::vector<float> y(M * N, 0.0f);
+  for (int64_t m = 0; m < M; ++m) {
+    for (int64_t k = 0; k < K; ++k) {
+      for (int64_t n = 0; n < N; ++n) {
+        y[m * N + n] += a[m * K + k] * b[k * N + n];
+      }
+    }
+  }
+  return y;
+}
+
+// Generates a weight with roughly the requested density of nonzeros.
+std::vector<float> SparseWeight(const std::vector<int64_t>& dims, float density) {
+  RandomValueGenerator random{};
+  std::vector<float> values = random.Uniform<float>(dims, 0.5f, 1.5f);
+  std::vector<float> mask = random.Uniform<float>(dims, 0.0f, 1.0f);
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (mask[i] > density) {
+      values[i] = 0.0f;
+    }
+  }
+  return values;
+}
+
+void TestSparseMatMul(int64_t M, int64_t K, int64_t N, float density, bool is_matrix_b_constant) {
+  RandomValueGenerator random{};
+  std::vector<float> A_data = random.Uniform<float>({M, K}, -1.0f, 1.0f);
+  std::vector<float> B_data = SparseWeight({K, N}, density);
+
+  OpTester test("SparseMatMul", 1, kMSDomain);
+  test.AddInput<float>("A", {M, K}, A_data);
+  test.AddInput<float>("B", {K, N}, B_data, is_matrix_b_constant);
+  test.AddOutput<float>("Y", {M, N}, DenseMatMul(A_data, B_data, M, K, N));
+  test.Run();
+}
+
+}  // namespace
+
+// Constant sparse weight takes the pre-packed CSC path.
+TEST(SparseMatMulOpTest, SparseWeightPrePacked) {
+  TestSparseMatMul(4, 32, 24, 0.1f, true /*is_matrix_b_constant*/);
+}
+
+// Non-constant weight can't be pre-packed and falls back to the dense multiply.
+TEST(SparseMatMulOpTest, SparseWeightNotConstant) {
+  TestSparseMatMul(4, 32, 24, 0.1f, false /*is_matrix_b_constant*/);
+}
+
+// A dense constant weight stays on the dense path even through PrePack.
+TEST(SparseMatMulOpTest, DenseWeightFallsBackToGemm) {
+  TestSparseMatMul(4, 32, 24, 1.0f, true /*is_matrix_b_constant*/);
+}
+
+// A weight below the packing size threshold is not packed.
+TEST(SparseMatMulOpTest, TinyWeightNotPacked) {
+  TestSparseMatMul(3, 5, 7, 0.1f, true /*is_matrix_b_constant*/);
+}
+
+// An all-zero constant weight packs to an empty value list.
+TEST(SparseMatMulOpTest, AllZeroWeight) {
+  RandomValueGenerator random{};
+  std::vector<float> A_data = random.Uniform<float>({2, 16}, -1.0f, 1.0f);
+
+  OpTester test("SparseMatMul", 1, kMSDomain);
+  test.AddInput<float>("A", {2, 16}, A_data);
+  test.AddInput<float>("B", {16, 16}, std::vector<float>(16 * 16, 0.0f), true /*is_initializer*/);
+  test.AddOutput<float>("Y", {2, 16}, std::vector<float>(2 * 16, 0.0f));
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/activation_offload.h"
+
+#include "core/framework/data_types.h"
+#include "core/framework/ort_value_name_idx_map.h"
+#include "core/graph/model.h"
+#include "test/test_environment.h"
+#include "asserts.h"
+#include "gtest/gtest.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+// Build a graph where T0 is consumed right after it is produced and again 10 steps later:
+//   X -> Relu(n0) -> T0 -> Relu(n1) -> T1 -> ... -> Relu(n10) -> T10
+//   Add(T0, T10) -> Y
+// With the activations placed on a GPU device, T0's lifetime gap should be scheduled for offload.
+TEST(ActivationOffloadTest, SchedulesValueWithDistantUses) {
+  onnxruntime::Model model("activation_offload_test", false, ModelMetaData(), PathString(),
+                           IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {},
+                           DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1024);
+
+  constexpr int kChainLength = 11;  // T0..T10
+
+  onnxruntime::NodeArg& x_def = graph.GetOrCreateNodeArg("X", &tensor_float);
+  onnxruntime::NodeArg& y_def = graph.GetOrCreateNodeArg("Y", &tensor_float);
+  std::vector<onnxruntime::NodeArg*> chain_defs;
+  for (int i = 0; i < kChainLength; ++i) {
+    chain_defs.push_back(&graph.GetOrCreateNodeArg("T" + std::to_string(i), &tensor_float));
+  }
+
+  graph.AddNode("n0", "Relu", "produce T0", {&x_def}, {chain_defs[0]});
+  for (int i = 1; i < kChainLength; ++i) {
+    graph.AddNode("n" + std::to_string(i), "Relu", "chain", {chain_defs[i - 1]}, {chain_defs[i]});
+  }
+  graph.AddNode("add", "Add", "distant second use of T0", {chain_defs[0], chain_defs.back()}, {&y_def});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  GraphViewer viewer(graph);
+
+  OrtValueNameIdxMap name_idx_map;
+  name_idx_map.Add("X");
+  for (int i = 0; i < kChainLength; ++i) {
+    name_idx_map.Add("T" + std::to_string(i));
+  }
+  name_idx_map.Add("Y");
+
+  SequentialExecutionPlan plan;
+  plan.allocation_plan.resize(static_cast<size_t>(name_idx_map.MaxIdx()) + 1);
+  for (auto node_index : viewer.GetNodesInTopologicalOrder()) {
+    plan.execution_plan.emplace_back(node_index);
+  }
+
+  int x_idx = -1;
+  ASSERT_STATUS_OK(name_idx_map.GetIdx("X", x_idx));
+  plan.allocation_plan[x_idx].alloc_kind = AllocKind::kPreExisting;
+
+  // with everything left at the default CPU location nothing qualifies
+  std::unique_ptr<ActivationOffloadPlan> offload_plan;
+  ASSERT_STATUS_OK(ActivationOffloadPlanner::CreatePlan(viewer, name_idx_map, plan, offload_plan));
+  ASSERT_TRUE(offload_plan == nullptr);
+
+  const OrtMemoryInfo gpu_info("Cuda", OrtAllocatorType::OrtDeviceAllocator,
+                               OrtDevice(OrtDevice::GPU, OrtDevice::MemType::DEFAULT, 0));
+  for (int i = 0; i < kChainLength; ++i) {
+    int idx = -1;
+    ASSERT_STATUS_OK(name_idx_map.GetIdx("T" + std::to_string(i), idx));
+    plan.allocation_plan[idx].alloc_kind = AllocKind::kAllocate;
+    plan.allocation_plan[idx].location = gpu_info;
+    plan.allocation_plan[idx].value_type = DataTypeImpl::GetTensorType<float>();
+  }
+
+  ASSERT_STATUS_OK(ActivationOffloadPlanner::CreatePlan(viewer, name_idx_map, plan, offload_plan));
+  ASSERT_TRUE(offload_plan != nullptr);
+  ASSERT_EQ(offload_plan->num_scheduled_copies, 1u);
+
+  int t0_idx = -1;
+  ASSERT_STATUS_OK(name_idx_map.GetIdx("T0", t0_idx));
+
+  // T0 is read at steps 1 and 11: offloaded after its first consumer, reloaded 2 steps ahead
+  // of its second one. Nothing else has a large enough gap between uses.
+  ASSERT_EQ(offload_plan->offloads_per_step[1], std::vector<OrtValueIndex>{t0_idx});
+  ASSERT_EQ(offload_plan->reloads_per_step[9], std::vector<OrtValueIndex>{t0_idx});
+}
+
+}  // namespace test
+}  // namespace onnxruntime
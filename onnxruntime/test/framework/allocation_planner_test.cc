@@ -131,15 +131,19 @@ typedef std::unordered_map<const onnxruntime::NodeArg*, TensorShapeProto*> Shape
 
 class SequentialPlannerTestContext : public ISequentialPlannerContext {
  public:
-  SequentialPlannerTestContext(ShapeMap* shape_map) : shape_map_(shape_map) {}
+  SequentialPlannerTestContext(ShapeMap* shape_map, bool allow_graph_input_reuse = false)
+      : shape_map_(shape_map), allow_graph_input_reuse_(allow_graph_input_reuse) {}
 
   TensorShapeProto* GetShape(const onnxruntime::NodeArg& arg) const override {
     auto iter = shape_map_->find(&arg);
     return (shape_map_->end() != iter) ? iter->second : nullptr;
   }
 
+  bool AllowGraphInputReuse() const override { return allow_graph_input_reuse_; }
+
  private:
   ShapeMap* shape_map_;
+  bool allow_graph_input_reuse_ = false;
 };
 
 class PlannerTest : public ::testing::Test {
@@ -154,8 +158,9 @@ class PlannerTest : public ::testing::Test {
   // some standard components used to build test-cases:
   Type float_type_;
 
-  std::unique_ptr<::onnxruntime::KernelDef> std_kernel_;       // a unary kernel with no-aliasing and no-in-place
-  std::unique_ptr<::onnxruntime::KernelDef> in_place_kernel_;  // a unary kernel with in-place
+  std::unique_ptr<::onnxruntime::KernelDef> std_kernel_;         // a unary kernel with no-aliasing and no-in-place
+  std::unique_ptr<::onnxruntime::KernelDef> in_place_kernel_;    // a unary kernel with in-place
+  std::unique_ptr<::onnxruntime::KernelDef> slice_view_kernel_;  // a unary kernel that may output a slice view
 
   std::unordered_map<std::string, onnxruntime::NodeArg*> name_to_arg_;
   std::vector<std::unique_ptr<UnaryNode>> nodes_;
@@ -178,6 +183,9 @@ class PlannerTest : public ::testing::Test {
     std_kernel_ = KernelDefBuilder().SetName("Transpose").Provider(kCpuExecutionProvider).SinceVersion(1, 10).Build();
     in_place_kernel_ =
         KernelDefBuilder().SetName("Relu").Provider(kCpuExecutionProvider).SinceVersion(1, 10).MayInplace(0, 0).Build();
+    // use the -1 wildcard for the output index, as a variadic kernel such as Split would
+    slice_view_kernel_ =
+        KernelDefBuilder().SetName("Exp").Provider(kCpuExecutionProvider).SinceVersion(1, 10).MaySliceView(0, -1).Build();
     CPUExecutionProviderInfo epi;
     auto execution_provider = onnxruntime::make_unique<CPUExecutionProvider>(epi);
     execution_providers_.Add("CPUExecutionProvider", std::move(execution_provider));
@@ -209,6 +217,10 @@ class PlannerTest : public ::testing::Test {
     return AddNode(*in_place_kernel_, input, output);
   }
 
+  onnxruntime::Node* AddSliceViewNode(std::string& input, std::string& output) {
+    return AddNode(*slice_view_kernel_, input, output);
+  }
+
   void BindKernel(onnxruntime::Node* p_node, ::onnxruntime::KernelDef& kernel_def, KernelRegistry* reg,
                   std::unordered_map<NodeIndex, gsl::not_null<const KernelCreateInfo*>>& kernel_create_info_map) {
     const IExecutionProvider* ep = execution_providers_.Get(*p_node);
@@ -238,7 +250,8 @@ class PlannerTest : public ::testing::Test {
     }
   }
 
-  void CreatePlan(const std::vector<const NodeArg*>& outer_scope_node_args = {}) {
+  void CreatePlan(const std::vector<const NodeArg*>& outer_scope_node_args = {},
+                  bool allow_graph_input_reuse = false) {
     EXPECT_EQ(graph_.Resolve(), Status::OK());
 
     std::shared_ptr<KernelRegistry> reg = std::make_shared<KernelRegistry>();
@@ -260,7 +273,7 @@ class PlannerTest : public ::testing::Test {
     status = state_->FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager, {}, nullptr, remove_initializers);
 
     EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
-    SequentialPlannerTestContext test_context(&shape_map_);
+    SequentialPlannerTestContext test_context(&shape_map_, allow_graph_input_reuse);
 
     status = SequentialPlanner::CreatePlan(nullptr, GraphViewer(graph_), outer_scope_node_args, execution_providers_,
                                            kernel_create_info_map, state_->GetOrtValueNameIdxMap(), test_context,
@@ -403,6 +416,59 @@ TEST_F(PlannerTest, InPlaceTest) {
   CheckFreed(2, {X2});
 }
 
+// SlicedViewTest: a kernel declaring MaySliceView gets its output planned against the input's
+// buffer, which must stay alive until the view's consumers are done.
+TEST_F(PlannerTest, SlicedViewTest) {
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3"), X4("X4");
+
+  // graph structure:
+  AddNormalNode(X1, X2);     // no in-place operator; X1: input; X2: temporary
+  AddSliceViewNode(X2, X3);  // may-slice-view operator; X3: temporary
+  AddNormalNode(X3, X4);     // no in-place operator; X4: output
+
+  // simulate shape-inference results:
+  Shape shape1{"M", "N"};
+  auto shape = &shape1.value;
+  SetShape({{X1, shape}, {X2, shape}, {X3, shape}, {X4, shape}});
+
+  CreatePlan();
+
+  // check allocation kind:
+  CheckAllocKind(X1, AllocKind::kPreExisting);
+  CheckAllocKind(X2, AllocKind::kAllocate);
+  CheckAllocKind(X3, AllocKind::kSlicedView);
+  CheckAllocKind(X4, AllocKind::kAllocateOutput);
+
+  // the viewed buffer (X2) must not be freed before the view's consumer has run
+  CheckFreed(0, {});
+  CheckFreed(1, {});
+  CheckFreed(2, {X2});
+}
+
+// GraphInputReuseTest: when the planner context allows graph input reuse, an in-place kernel that
+// is the sole consumer of an input writes its output straight into the caller's buffer.
+TEST_F(PlannerTest, GraphInputReuseTest) {
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3");
+
+  // graph structure:
+  AddInplaceNode(X1, X2);  // may-in-place operator; X1: input; X2: temporary
+  AddNormalNode(X2, X3);   // no in-place operator; X3: output
+
+  // simulate shape-inference results:
+  Shape shape1{"M", "N"};
+  auto shape = &shape1.value;
+  SetShape({{X1, shape}, {X2, shape}, {X3, shape}});
+
+  CreatePlan({}, true /*allow_graph_input_reuse*/);
+
+  // check allocation kind: X2 reuses the caller's buffer for X1 in-place
+  CheckAllocKind(X1, AllocKind::kPreExisting);
+  CheckAllocKind(X2, AllocKind::kReuse);
+  CheckAllocKind(X3, AllocKind::kAllocateOutput);
+}
+
 // InPlaceSizeMismatchTest: Check that Inplace reuse is not allowed when sizes don't match.
 // Also tests reuse of disjoint lifetime tensors.
 TEST_F(PlannerTest, InPlaceSizeMismatchTest) {
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include "core/framework/allocation_audit.h"
 #include "core/framework/allocatormgr.h"
 #include "core/framework/allocator.h"
 
@@ -101,5 +102,25 @@ TEST(AllocatorTest, TestOverflowChecks) {
   EXPECT_TRUE(IAllocator::CalcMemSizeForArrayWithAlignment<64>(num_elements, element_size - (64 / num_elements), &size));
   EXPECT_FALSE(IAllocator::CalcMemSizeForArrayWithAlignment<64>(num_elements, element_size, &size));
 }
+
+TEST(AllocatorTest, AllocationAudit) {
+  CPUAllocator cpu_allocator;
+
+  // allocations made before the audit is enabled are not counted
+  const uint64_t count_before_enable = AllocationAudit::AllocationCount();
+  void* p = cpu_allocator.Alloc(64);
+  cpu_allocator.Free(p);
+  EXPECT_EQ(AllocationAudit::AllocationCount(), count_before_enable);
+
+  // note: enabling is process wide and permanent, so this must not assert an exact total;
+  // other tests running in parallel may also allocate
+  AllocationAudit::Enable();
+  EXPECT_TRUE(AllocationAudit::IsEnabled());
+
+  const uint64_t count_before_alloc = AllocationAudit::AllocationCount();
+  p = cpu_allocator.Alloc(64);
+  cpu_allocator.Free(p);
+  EXPECT_GE(AllocationAudit::AllocationCount(), count_before_alloc + 1);
+}
 }  // namespace test
 }  // namespace onnxruntime
@@ -5,6 +5,8 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include <cstdlib>
+#include <cstring>
+#include <thread>
 
 namespace onnxruntime {
 namespace test {
@@ -213,6 +215,37 @@ TEST(BFCArenaTest, TestCustomMemoryLimit) {
   }
 }
 
+TEST(BFCArenaTest, RunMemoryBudget) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
+
+  // allocations within the budget succeed
+  a.SetRunMemoryBudget(4 * 1024 * 1024);
+  void* first_ptr = a.Alloc(1024 * 1024);
+  EXPECT_NE(nullptr, first_ptr);
+
+  // an allocation that would grow the arena past the budget throws cleanly
+  ORT_TRY {
+    a.Alloc(16 * 1024 * 1024);
+    FAIL() << "Allocation should have thrown";
+  }
+  ORT_CATCH(const OnnxRuntimeException& ex) {
+    ORT_HANDLE_EXCEPTION([&ex]() {
+      EXPECT_THAT(ex.what(), testing::HasSubstr("Per-run memory budget"));
+    });
+  }
+  ORT_CATCH(...) {
+    FAIL() << "Allocation should have thrown OnnxRuntimeException";
+  }
+
+  // clearing the budget restores growth up to the arena's memory limit
+  a.SetRunMemoryBudget(0);
+  void* second_ptr = a.Alloc(16 * 1024 * 1024);
+  EXPECT_NE(nullptr, second_ptr);
+
+  a.Free(first_ptr);
+  a.Free(second_ptr);
+}
+
 TEST(BFCArenaTest, AllocationsAndDeallocationsWithGrowth) {
   // Max of 2GiB, but starts out small.
   BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1LL << 31);
@@ -271,6 +304,46 @@ TEST(BFCArenaTest, AllocationsAndDeallocationsWithGrowth) {
   }
 }
 
+TEST(BFCArenaTest, SmallChunkCache) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
+
+  // a small allocation that is freed and re-requested is served from the free-chunk cache,
+  // so the same chunk comes back and the stats stay consistent
+  void* p = a.Alloc(1024);
+  a.Free(p);
+  void* p2 = a.Alloc(1024);
+  EXPECT_EQ(p, p2);
+  a.Free(p2);
+  CheckStats(&a, 2, 0, 1024, 1024);
+
+  // hammer the arena with small allocations from several threads. each thread writes a
+  // marker into its buffer to catch chunks being handed out twice.
+  constexpr int num_threads = 4;
+  constexpr int iterations = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&a, t]() {
+      for (int i = 0; i < iterations; ++i) {
+        size_t size = 256 + (i % 16) * 256;
+        void* ptr = a.Alloc(size);
+        ASSERT_NE(ptr, nullptr);
+        memset(ptr, t, size);
+        ASSERT_EQ(static_cast<char*>(ptr)[size - 1], static_cast<char>(t));
+        a.Free(ptr);
+      }
+    });
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_EQ(stats.num_allocs, 2 + num_threads * iterations);
+}
+
 TEST(BFCArenaTest, TestReserve) {
   // Configure a 1MiB byte limit
   BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
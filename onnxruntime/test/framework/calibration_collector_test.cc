@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/calibration_collector.h"
+
+#include <sstream>
+
+#include "core/framework/tensor.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "test_utils.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+#include "gtest/gtest.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// non-owning CPU tensor over caller-held values for driving Collect directly
+Tensor MakeTensor(std::vector<float>& values) {
+  static const OrtMemoryInfo cpu_info(CPU, OrtAllocatorType::OrtDeviceAllocator);
+  return Tensor(DataTypeImpl::GetType<float>(),
+                TensorShape({static_cast<int64_t>(values.size())}), values.data(), cpu_info);
+}
+
+}  // namespace
+
+TEST(CalibrationCollectorTest, MinMaxAndHistogram) {
+  CalibrationCollector collector(4);
+
+  std::vector<float> values{-1.f, 0.5f, 2.f, -3.f};
+  collector.Collect("act", MakeTensor(values));
+
+  auto table = collector.GetTable();
+  ASSERT_EQ(table.size(), 1u);
+  const auto& stats = table["act"];
+
+  EXPECT_EQ(stats.min, -3.f);
+  EXPECT_EQ(stats.max, 2.f);
+  EXPECT_EQ(stats.num_values, 4u);
+
+  // range 3 with 4 bins: |-1| -> bin 1, 0.5 -> bin 0, 2 -> bin 2, |-3| clamps to bin 3
+  EXPECT_EQ(stats.histogram_range, 3.f);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{1, 1, 1, 1}));
+}
+
+TEST(CalibrationCollectorTest, RangeGrowthRebinsExactly) {
+  CalibrationCollector collector(4);
+
+  // range 1 with 4 bins: 0.5 -> bin 2, 1.0 clamps to bin 3
+  std::vector<float> first{0.5f, 1.f};
+  collector.Collect("act", MakeTensor(first));
+
+  // 3.5 forces two doublings (range 1 -> 2 -> 4). {0, 0, 1, 1} folds to {0, 2, 0, 0}
+  // and then to {2, 0, 0, 0}; 3.5 lands in bin 3 of the grown range.
+  std::vector<float> second{3.5f};
+  collector.Collect("act", MakeTensor(second));
+
+  auto table = collector.GetTable();
+  const auto& stats = table["act"];
+
+  EXPECT_EQ(stats.min, 0.5f);
+  EXPECT_EQ(stats.max, 3.5f);
+  EXPECT_EQ(stats.num_values, 3u);
+  EXPECT_EQ(stats.histogram_range, 4.f);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{2, 0, 0, 1}));
+}
+
+TEST(CalibrationCollectorTest, AllZeroTensorEstablishesRangeLater) {
+  CalibrationCollector collector(4);
+
+  // no usable range yet: both zeros stay in the first bin
+  std::vector<float> zeros{0.f, 0.f};
+  collector.Collect("act", MakeTensor(zeros));
+
+  std::vector<float> later{1.f};
+  collector.Collect("act", MakeTensor(later));
+
+  auto table = collector.GetTable();
+  const auto& stats = table["act"];
+
+  EXPECT_EQ(stats.min, 0.f);
+  EXPECT_EQ(stats.max, 1.f);
+  EXPECT_EQ(stats.num_values, 3u);
+  EXPECT_EQ(stats.histogram_range, 1.f);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{2, 0, 0, 1}));
+}
+
+namespace {
+
+// X -> Mul(X, X) -> "squared" -> Add(squared, X) -> "output", so a Run produces two
+// activations with easily predicted statistics.
+void CreateCalibrationSession(std::unique_ptr<InferenceSession>& session) {
+  Model model("CalibrationCollectorTest", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_2x2;
+  float_2x2.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_2x2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  float_2x2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& x = graph.GetOrCreateNodeArg("X", &float_2x2);
+  auto& squared = graph.GetOrCreateNodeArg("squared", &float_2x2);
+  auto& output = graph.GetOrCreateNodeArg("output", &float_2x2);
+
+  graph.AddNode("mul", "Mul", "square the input", {&x, &x}, {&squared});
+  graph.AddNode("add", "Add", "add the input back", {&squared, &x}, {&output});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+  std::stringstream sstr(model_data);
+
+  SessionOptions so;
+  so.session_logid = "CalibrationCollectorTest";
+  session = onnxruntime::make_unique<InferenceSession>(so, GetEnvironment());
+  ASSERT_STATUS_OK(session->Load(sstr));
+  ASSERT_STATUS_OK(session->Initialize());
+}
+
+void RunCalibrationSession(InferenceSession& session, const std::vector<float>& x_values) {
+  OrtValue x;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {2, 2}, x_values, &x);
+
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session.Run(RunOptions(), {{"X", x}}, {"output"}, &fetches));
+}
+
+}  // namespace
+
+TEST(CalibrationCollectorTest, SessionCollectsAndMergesAcrossRuns) {
+  std::unique_ptr<InferenceSession> session;
+  CreateCalibrationSession(session);
+  ASSERT_TRUE(session);
+
+  std::map<std::string, CalibrationCollector::TensorStats> table;
+  ASSERT_FALSE(session->GetCalibrationTable(table).IsOK()) << "table available before collection was enabled";
+
+  ASSERT_STATUS_OK(session->EnableCalibrationCollection(4));
+
+  // squared = {1, 4, 9, 16}, output = {2, 2, 12, 12}
+  RunCalibrationSession(*session, {1.f, -2.f, 3.f, -4.f});
+
+  ASSERT_STATUS_OK(session->GetCalibrationTable(table));
+  ASSERT_TRUE(table.count("squared"));
+  ASSERT_TRUE(table.count("output"));
+
+  EXPECT_EQ(table["squared"].min, 1.f);
+  EXPECT_EQ(table["squared"].max, 16.f);
+  EXPECT_EQ(table["squared"].num_values, 4u);
+  // range 16 with 4 bins: 1 -> bin 0, 4 -> bin 1, 9 -> bin 2, 16 clamps to bin 3
+  EXPECT_EQ(table["squared"].histogram_range, 16.f);
+  EXPECT_EQ(table["squared"].histogram, (std::vector<uint64_t>{1, 1, 1, 1}));
+
+  EXPECT_EQ(table["output"].min, 2.f);
+  EXPECT_EQ(table["output"].max, 12.f);
+  EXPECT_EQ(table["output"].num_values, 4u);
+
+  // a second Run merges into the same entries. squared = {400, 0.25, 1, 4}
+  RunCalibrationSession(*session, {-20.f, 0.5f, 1.f, 2.f});
+
+  ASSERT_STATUS_OK(session->GetCalibrationTable(table));
+  EXPECT_EQ(table["squared"].min, 0.25f);
+  EXPECT_EQ(table["squared"].max, 400.f);
+  EXPECT_EQ(table["squared"].num_values, 8u);
+  EXPECT_EQ(table["output"].num_values, 8u);
+}
+
+TEST(CalibrationCollectorTest, EnableRequiresInitializedSession) {
+  SessionOptions so;
+  so.session_logid = "CalibrationCollectorTest.Uninitialized";
+  InferenceSession session(so, GetEnvironment());
+  ASSERT_FALSE(session.EnableCalibrationCollection().IsOK());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -101,6 +101,56 @@ TEST_F(ExecutionFrameTest, TensorAllocationTest) {
   ASSERT_EQ(tensor2->template Data<float>(), p_tensor->template Data<float>());
 }
 
+// a kernel may hand an input back early via OpKernelContext::ReleaseConsumedInput, after which
+// the release scheduled at the end of the node hits the same index again. the second release
+// must be a harmless no-op.
+TEST_F(ExecutionFrameTest, ReleaseMLValueIdempotentTest) {
+  onnxruntime::Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  onnxruntime::NodeArg input_def("X", &tensor_float), output_def("Y", &tensor_float);
+
+  onnxruntime::Node* node = &graph.AddNode("node1", "Relu", "Relu operator", ArgMap{&input_def}, ArgMap{&output_def});
+  node->SetExecutionProviderType(kCpuExecutionProvider);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  auto cpu_xp = CreateCPUExecutionProvider();
+  auto xp_typ = cpu_xp->Type();
+  ExecutionProviders execution_providers;
+  execution_providers.Add(xp_typ, std::move(cpu_xp));
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState state(graph, execution_providers, true, &tp_, nullptr, dtm,
+                     DefaultLoggingManager().DefaultLogger(), profiler);
+
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager));
+
+  vector<OrtValue> outputs;
+  ExecutionFrame frame({}, {}, {}, outputs, {}, state);
+
+  int start_index = frame.GetNodeOffset(node->Index());
+  int x_ort_value_idx = frame.GetNodeIdxToMLValueIdx(start_index);
+
+  TensorShape shape(std::vector<int64_t>{2, 3});
+  OrtValue& mlvalue0 = *frame.GetMutableNodeInputOrOutputMLValue(start_index);
+  const auto& memory_info = execution_providers.Get(xp_typ)->GetAllocator(0, OrtMemTypeDefault)->Info();
+  ASSERT_STATUS_OK(frame.AllocateMLValueTensorSelfOwnBuffer(mlvalue0, start_index, DataTypeImpl::GetType<float>(),
+                                                            memory_info, shape));
+  ASSERT_TRUE(frame.GetNodeInputOrOutputMLValue(start_index)->IsAllocated());
+
+  // early release followed by the scheduled release of the same value
+  ASSERT_STATUS_OK(frame.ReleaseMLValue(x_ort_value_idx));
+  ASSERT_FALSE(frame.GetNodeInputOrOutputMLValue(start_index)->IsAllocated());
+  ASSERT_STATUS_OK(frame.ReleaseMLValue(x_ort_value_idx));
+
+  // an out of range index is still rejected
+  ASSERT_FALSE(frame.ReleaseMLValue(12345).IsOK());
+}
+
 TEST_F(ExecutionFrameTest, FeedInDataTest) {
   onnxruntime::Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
                            std::unordered_map<std::string, int>{{"", 10}}, {},
@@ -254,6 +304,72 @@ TEST_F(ExecutionFrameTest, MemPatternTest) {
   ASSERT_EQ(p->GetBlock(4)->offset_, 64u);
 }
 
+TEST_F(ExecutionFrameTest, MemPatternWithSymbolicBatchDimTest) {
+  auto cpu_xp = CreateCPUExecutionProvider();
+  auto xp_type = cpu_xp->Type();
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[onnxruntime::kOnnxDomain] = 7;
+  onnxruntime::Model model("test", true, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                           domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto* input_shape = tensor_float.mutable_tensor_type()->mutable_shape();
+  input_shape->add_dim()->set_dim_param("batch");
+  input_shape->add_dim()->set_dim_value(2);
+
+  onnxruntime::NodeArg input_def("X", &tensor_float),
+      relu1_out_def("T1", &tensor_float),
+      relu2_out_def("Y", &tensor_float);
+
+  graph.AddNode("node1", "Relu", "relu1", ArgMap{&input_def}, ArgMap{&relu1_out_def})
+      .SetExecutionProviderType(xp_type);
+  graph.AddNode("node2", "Relu", "relu2", ArgMap{&relu1_out_def}, ArgMap{&relu2_out_def})
+      .SetExecutionProviderType(xp_type);
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  KernelRegistryManager kernel_registry_manager;
+  ExecutionProviders execution_providers;
+  execution_providers.Add(xp_type, std::move(cpu_xp));
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState state(graph, execution_providers, true, &tp_, nullptr, dtm,
+                     DefaultLoggingManager().DefaultLogger(), profiler);
+
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager));
+
+  int x_idx = -1, t1_idx = -1;
+  ASSERT_STATUS_OK(state.GetOrtValueNameIdxMap().GetIdx("X", x_idx));
+  ASSERT_STATUS_OK(state.GetOrtValueNameIdxMap().GetIdx("T1", t1_idx));
+
+  auto cpu_allocator = execution_providers.Get(xp_type)->GetAllocator(0, OrtMemTypeDefault);
+
+  // a batch size that has never been run should still get a pattern, with the sizes computed
+  // from the resolved value of the 'batch' dimension instead of a previously traced execution
+  TensorShape x_shape(std::vector<int64_t>{4, 2});
+  std::unordered_map<int, TensorShape> inferred_shapes;
+  const MemoryPatternGroup* pattern = state.GetMemoryPatternGroup({std::cref(x_shape)}, {x_idx}, inferred_shapes);
+  ASSERT_TRUE(pattern != nullptr);
+  auto* p = pattern->GetPatterns(cpu_allocator->Info());
+  ASSERT_TRUE(p != nullptr);
+  ASSERT_EQ(p->PeakSize(), 64u);  // T1 is 4 * 2 floats, 64-byte aligned
+  ASSERT_TRUE(p->GetBlock(t1_idx) != nullptr);
+  ASSERT_NE(inferred_shapes.find(t1_idx), inferred_shapes.end());
+  ASSERT_EQ(inferred_shapes[t1_idx], TensorShape(std::vector<int64_t>{4, 2}));
+
+  // a different batch size gets its own pattern with scaled sizes
+  TensorShape x_shape2(std::vector<int64_t>{64, 2});
+  inferred_shapes.clear();
+  pattern = state.GetMemoryPatternGroup({std::cref(x_shape2)}, {x_idx}, inferred_shapes);
+  ASSERT_TRUE(pattern != nullptr);
+  p = pattern->GetPatterns(cpu_allocator->Info());
+  ASSERT_TRUE(p != nullptr);
+  ASSERT_EQ(p->PeakSize(), 512u);  // T1 is 64 * 2 floats
+}
+
 TEST(ExecutionFrameTestWithoutSessionState, BadModelInvalidDimParamUsage) {
   // load model with 2 Scan ops that both incorrectly use shapes of { 'None', 'None' } for their outputs.
   // as 'None' is not a special value it's treated as a variable name, leading to a runtime error when we
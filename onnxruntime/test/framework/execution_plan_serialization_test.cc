@@ -0,0 +1,221 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// saving needs the full build, loading the ORT format load path
+#if defined(ENABLE_ORT_FORMAT_LOAD) && !defined(ORT_MINIMAL_BUILD)
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "core/framework/sequential_execution_plan.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "core/flatbuffers/schema/ort.fbs.h"
+#include "test/test_environment.h"
+#include "test_utils.h"
+#include "test/util/include/asserts.h"
+#include "test/util/include/inference_session_wrapper.h"
+
+#include "gtest/gtest.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+// Tests for the SequentialExecutionPlan stored in ORT format models (format version 3).
+// Whether the stored plan was adopted or silently recomputed is not directly visible, so
+// the adoption and fallback tests tamper with the stored plan before loading: a marker
+// the planner would never produce shows up in the loaded plan only if the stored plan was
+// used, and an unresolvable entry must force the recompute fallback.
+
+namespace {
+
+// X -> Mul(X, X) -> squared -> Add(squared, X) -> Y, so the plan has an intermediate
+// value to allocate and free in addition to the graph inputs and outputs
+void BuildTwoNodeModelBytes(std::string& model_bytes) {
+  Model model("ExecutionPlanSerializationTest", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_2x2;
+  float_2x2.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_2x2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  float_2x2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& x = graph.GetOrCreateNodeArg("X", &float_2x2);
+  auto& squared = graph.GetOrCreateNodeArg("squared", &float_2x2);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_2x2);
+
+  graph.AddNode("mul", "Mul", "square the input", {&x, &x}, {&squared});
+  graph.AddNode("add", "Add", "add the input back", {&squared, &x}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  model.ToProto().SerializeToString(&model_bytes);
+}
+
+void SaveToOrtFile(const std::basic_string<ORTCHAR_T>& ort_file) {
+  std::string model_bytes;
+  BuildTwoNodeModelBytes(model_bytes);
+  if (model_bytes.empty()) return;  // BuildTwoNodeModelBytes already failed the test
+
+  std::stringstream sstr(model_bytes);
+
+  SessionOptions so;
+  so.session_logid = "ExecutionPlanSerializationTest.Save";
+  so.optimized_model_filepath = ort_file;
+  so.AddConfigEntry(kOrtSessionOptionsConfigSaveModelFormat, "ORT");
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(sstr));
+  ASSERT_STATUS_OK(session.Initialize());
+}
+
+void ReadFileBytes(const std::basic_string<ORTCHAR_T>& path, std::vector<char>& bytes) {
+  size_t num_bytes = 0;
+  ASSERT_STATUS_OK(Env::Default().GetFileLength(path.c_str(), num_bytes));
+  bytes.resize(num_bytes);
+  std::ifstream stream(path, std::ifstream::in | std::ifstream::binary);
+  stream.read(bytes.data(), num_bytes);
+  stream.close();
+}
+
+const experimental::fbs::ExecutionPlan* GetStoredExecutionPlan(const std::vector<char>& model_bytes) {
+  const auto* fbs_session = experimental::fbs::GetInferenceSession(model_bytes.data());
+  if (fbs_session == nullptr || fbs_session->session_state() == nullptr) {
+    return nullptr;
+  }
+  return fbs_session->session_state()->execution_plan();
+}
+
+// load the tampered or untampered bytes, run, and check Y = X * X + X for a fixed X
+void LoadAndVerifyRun(const std::vector<char>& model_bytes, InferenceSessionWrapper& session) {
+  ASSERT_STATUS_OK(session.Load(model_bytes.data(), static_cast<int>(model_bytes.size())));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  OrtValue x;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {2, 2},
+                       {1.f, -2.f, 3.f, -4.f}, &x);
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session.Run({{"X", x}}, {"Y"}, &fetches));
+
+  const auto& output = fetches[0].Get<Tensor>();
+  ASSERT_EQ(output.Shape().Size(), 4);
+  const std::vector<float> expected{2.f, 2.f, 12.f, 12.f};
+  EXPECT_EQ(std::memcmp(output.Data<float>(), expected.data(), sizeof(float) * 4), 0);
+}
+
+SessionOptions MakeLoadOptions(const std::string& logid) {
+  SessionOptions so;
+  so.session_logid = logid;
+  so.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT");
+  return so;
+}
+
+}  // namespace
+
+// The stored plan must line up with the plan the loaded session ends up using.
+TEST(ExecutionPlanSerializationTests, RoundTrip) {
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("execution_plan_roundtrip.onnx.ort");
+  SaveToOrtFile(ort_file);
+
+  std::vector<char> model_bytes;
+  ReadFileBytes(ort_file, model_bytes);
+
+  const auto* stored_plan = GetStoredExecutionPlan(model_bytes);
+  ASSERT_NE(stored_plan, nullptr);
+
+  SessionOptions so = MakeLoadOptions("ExecutionPlanSerializationTest.RoundTrip");
+  InferenceSessionWrapper session{so, GetEnvironment()};
+  LoadAndVerifyRun(model_bytes, session);
+
+  const auto* loaded_plan = session.GetSessionState().GetExecutionPlan();
+  ASSERT_NE(loaded_plan, nullptr);
+
+  ASSERT_NE(stored_plan->execution_order(), nullptr);
+  ASSERT_EQ(stored_plan->execution_order()->size(), loaded_plan->execution_plan.size());
+  for (flatbuffers::uoffset_t i = 0; i < stored_plan->execution_order()->size(); ++i) {
+    const auto* stored_step = stored_plan->execution_order()->Get(i);
+    const auto& loaded_step = loaded_plan->execution_plan[i];
+    EXPECT_EQ(stored_step->node_index(), loaded_step.node_index);
+    EXPECT_EQ(stored_step->free_from_index(), loaded_step.free_from_index);
+    EXPECT_EQ(stored_step->free_to_index(), loaded_step.free_to_index);
+  }
+
+  ASSERT_NE(stored_plan->allocation_plan(), nullptr);
+  ASSERT_EQ(stored_plan->allocation_plan()->size(), loaded_plan->allocation_plan.size());
+  for (flatbuffers::uoffset_t i = 0; i < stored_plan->allocation_plan()->size(); ++i) {
+    EXPECT_EQ(static_cast<int>(stored_plan->allocation_plan()->Get(i)->alloc_kind()),
+              static_cast<int>(loaded_plan->allocation_plan[i].alloc_kind));
+  }
+}
+
+// Rewriting a step's free list to an empty range the planner would never emit shows up in
+// the loaded session's plan, proving the stored plan was adopted rather than recomputed.
+TEST(ExecutionPlanSerializationTests, StoredPlanIsAdopted) {
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("execution_plan_adopted.onnx.ort");
+  SaveToOrtFile(ort_file);
+
+  std::vector<char> model_bytes;
+  ReadFileBytes(ort_file, model_bytes);
+
+  const auto* stored_plan = GetStoredExecutionPlan(model_bytes);
+  ASSERT_NE(stored_plan, nullptr);
+  ASSERT_GT(stored_plan->execution_order()->size(), 0u);
+
+  // from > to frees nothing, so the plan stays valid; the exact values are the marker
+  const auto* fbs_step = stored_plan->execution_order()->Get(0);
+  const experimental::fbs::NodeExecutionPlan tampered_step(fbs_step->node_index(), 7, 3);
+  std::memcpy(const_cast<experimental::fbs::NodeExecutionPlan*>(fbs_step), &tampered_step, sizeof(tampered_step));
+
+  SessionOptions so = MakeLoadOptions("ExecutionPlanSerializationTest.Adopted");
+  InferenceSessionWrapper session{so, GetEnvironment()};
+  LoadAndVerifyRun(model_bytes, session);
+
+  const auto* loaded_plan = session.GetSessionState().GetExecutionPlan();
+  ASSERT_NE(loaded_plan, nullptr);
+  ASSERT_GT(loaded_plan->execution_plan.size(), 0u);
+  EXPECT_EQ(loaded_plan->execution_plan[0].free_from_index, 7) << "stored execution plan was not adopted";
+  EXPECT_EQ(loaded_plan->execution_plan[0].free_to_index, 3);
+}
+
+// A stored plan that cannot be resolved against this session must be dropped with a
+// warning and the plan recomputed. The planned device locations of a CPU-only model are
+// all default values that are not materialized in the flatbuffer, so the unresolvable
+// entry is an execution order step referencing a node the graph does not have.
+TEST(ExecutionPlanSerializationTests, UnresolvablePlanFallsBackToRecompute) {
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("execution_plan_fallback.onnx.ort");
+  SaveToOrtFile(ort_file);
+
+  std::vector<char> model_bytes;
+  ReadFileBytes(ort_file, model_bytes);
+
+  const auto* stored_plan = GetStoredExecutionPlan(model_bytes);
+  ASSERT_NE(stored_plan, nullptr);
+  ASSERT_GT(stored_plan->execution_order()->size(), 0u);
+
+  // poison the free list as well: if the unusable plan were kept anyway, the marker
+  // below would be visible in the loaded plan
+  const auto* fbs_step = stored_plan->execution_order()->Get(0);
+  const experimental::fbs::NodeExecutionPlan tampered_step(123456789u, 7, 3);
+  std::memcpy(const_cast<experimental::fbs::NodeExecutionPlan*>(fbs_step), &tampered_step, sizeof(tampered_step));
+
+  SessionOptions so = MakeLoadOptions("ExecutionPlanSerializationTest.Fallback");
+  InferenceSessionWrapper session{so, GetEnvironment()};
+  LoadAndVerifyRun(model_bytes, session);
+
+  const auto* loaded_plan = session.GetSessionState().GetExecutionPlan();
+  ASSERT_NE(loaded_plan, nullptr);
+  ASSERT_GT(loaded_plan->execution_plan.size(), 0u);
+  EXPECT_NE(loaded_plan->execution_plan[0].node_index, static_cast<NodeIndex>(123456789u));
+  EXPECT_FALSE(loaded_plan->execution_plan[0].free_from_index == 7 &&
+               loaded_plan->execution_plan[0].free_to_index == 3)
+      << "unusable stored plan was not recomputed";
+}
+
+}  // namespace test
+}  // namespace onnxruntime
+
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD) && !defined(ORT_MINIMAL_BUILD)
@@ -363,6 +363,126 @@ TEST(InferenceSessionTests, NoTimeout) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, Warmup) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.Warmup";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // warming up before Initialize must fail
+  ASSERT_FALSE(session_object.Warmup().IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+  ASSERT_STATUS_OK(session_object.Warmup());
+
+  // the session must still produce correct results after warm-up
+  RunOptions run_options;
+  run_options.run_tag = "after warmup";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, GetMetrics) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.GetMetrics";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // requesting metrics before Initialize must fail
+  OrtSessionMetrics metrics;
+  ASSERT_FALSE(session_object.GetMetrics(metrics).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one";
+  RunModel(session_object, run_options);
+  run_options.run_tag = "two";
+  RunModel(session_object, run_options);
+
+  ASSERT_STATUS_OK(session_object.GetMetrics(metrics));
+  ASSERT_EQ(metrics.total_runs, 2u);
+  ASSERT_EQ(metrics.current_num_runs, 0);
+
+  // every completed run lands in exactly one latency bucket
+  uint64_t histogram_total = 0;
+  for (size_t i = 0; i < ORT_SESSION_METRICS_NUM_LATENCY_BUCKETS; ++i) {
+    histogram_total += metrics.run_latency_hist[i];
+  }
+  ASSERT_EQ(histogram_total, metrics.total_runs);
+
+  // the default session uses an arena-backed CPU allocator, so usage must be reported
+  ASSERT_GE(metrics.arena_bytes_in_use, 0);
+  ASSERT_GE(metrics.arena_total_allocated_bytes, metrics.arena_bytes_in_use);
+
+  // fragmentation figures: the largest free block is one of the free chunks counted in
+  // the total, and the arena that served the runs grew at least once
+  ASSERT_GE(metrics.arena_total_free_bytes, metrics.arena_largest_free_block_bytes);
+  ASSERT_GE(metrics.arena_largest_free_block_bytes, 0);
+  ASSERT_GE(metrics.arena_num_extensions, 1);
+
+  // both runs used the same input shapes: the first one misses the pattern cache, the
+  // second one hits it
+  ASSERT_GE(metrics.mem_pattern_misses, 1u);
+  ASSERT_GE(metrics.mem_pattern_hits, 1u);
+}
+
+TEST(InferenceSessionTests, RetainOutputs) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.RetainOutputs";
+  ASSERT_STATUS_OK(so.AddConfigEntry(kOrtSessionOptionsConfigRetainOutputs, "1"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &ml_value);
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("X", ml_value));
+
+  std::vector<std::string> output_names{"Y"};
+  RunOptions run_options;
+
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims_mul_x, {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f});
+  const void* first_output_buffer = fetches.front().Get<Tensor>().DataRaw();
+
+  // a second Run with the same input shapes must reuse the retained allocation and still
+  // compute the new values into it
+  std::vector<float> values_mul_x2 = {2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+  OrtValue ml_value2;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x2,
+                       &ml_value2);
+  feeds["X"] = ml_value2;
+
+  std::vector<OrtValue> fetches2;
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches2));
+  VerifyOutputs(fetches2, dims_mul_x, {4.0f, 9.0f, 16.0f, 25.0f, 36.0f, 49.0f});
+  ASSERT_EQ(first_output_buffer, fetches2.front().Get<Tensor>().DataRaw());
+
+  // the first Run's fetch shares that buffer, so by the retained-outputs contract it now
+  // holds the values of the second Run
+  VerifyOutputs(fetches, dims_mul_x, {4.0f, 9.0f, 16.0f, 25.0f, 36.0f, 49.0f});
+
+  // pre-allocated fetches bypass the retained-outputs cache
+  std::vector<OrtValue> preallocated(1);
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &preallocated.front());
+  const void* preallocated_buffer = preallocated.front().Get<Tensor>().DataRaw();
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &preallocated));
+  ASSERT_EQ(preallocated_buffer, preallocated.front().Get<Tensor>().DataRaw());
+  VerifyOutputs(preallocated, dims_mul_x, {4.0f, 9.0f, 16.0f, 25.0f, 36.0f, 49.0f});
+}
+
 TEST(InferenceSessionTests, OnlyExecutePathToFetches) {
   SessionOptions so;
 
@@ -394,6 +514,36 @@ TEST(InferenceSessionTests, DisableCPUArena) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, IntraOpThreadAffinities) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.IntraOpThreadAffinities";
+  // processor 0 always exists, so pin both intra-op threads to it
+  ASSERT_STATUS_OK(so.AddConfigEntry(kOrtSessionOptionsConfigIntraOpThreadAffinities, "0,0"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, CudaGraphCaptureRequiresCudaProvider) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.CudaGraphCaptureRequiresCudaProvider";
+  ASSERT_STATUS_OK(so.AddConfigEntry(kOrtSessionOptionsConfigEnableCudaGraphCapture, "1"));
+
+  // without the CUDA execution provider there is nothing to capture, so initialization must fail
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  auto status = session_object.Initialize();
+  ASSERT_FALSE(status.IsOK());
+  ASSERT_NE(status.ErrorMessage().find("CUDA execution provider is not registered"), std::string::npos);
+}
+
 TEST(InferenceSessionTests, TestModelSerialization) {
   // Load model with level 0 transform level
   // and assert that the model has Identity nodes.
@@ -661,6 +811,47 @@ TEST(InferenceSessionTests, CheckRunProfilerWithStartProfile) {
   }
 }
 
+TEST(InferenceSessionTests, CheckRunProfilerWithParallelExecutorFlowEvents) {
+  SessionOptions so;
+
+  so.session_logid = "CheckRunProfiler";
+  so.enable_profiling = true;
+  so.profile_file_prefix = ORT_TSTR("onnxprofile_profile_flow_test");
+  so.execution_mode = ExecutionMode::ORT_PARALLEL;
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "RunTag";
+
+  RunModel(session_object, run_options);
+  std::string profile_file = session_object.EndProfiling();
+
+  std::ifstream profile(profile_file);
+  ASSERT_TRUE(profile);
+  std::string line;
+
+  // The parallel executor hands nodes off to the inter-op pool; the dispatch side
+  // records a flow source and the pool thread completes it, giving an arrow in the
+  // trace viewer between the two threads.
+  bool has_flow_out = false;
+  bool has_flow_in = false;
+  while (std::getline(profile, line)) {
+    if (line.find("_dispatch") != string::npos && line.find("flow_out") != string::npos &&
+        line.find("bind_id") != string::npos) {
+      has_flow_out = true;
+    }
+    if (line.find("_fence_before") != string::npos && line.find("flow_in") != string::npos &&
+        line.find("bind_id") != string::npos) {
+      has_flow_in = true;
+    }
+  }
+  ASSERT_TRUE(has_flow_out);
+  ASSERT_TRUE(has_flow_in);
+}
+
 TEST(InferenceSessionTests, CheckRunProfilerStartTime) {
   // Test whether the InferenceSession can access the profiler's start time
   SessionOptions so;
@@ -897,6 +1088,61 @@ TEST(InferenceSessionTests, TestIOBindingReuse) {
   }
 }
 
+TEST(InferenceSessionTests, TestIOBindingStagedInputs) {
+  SessionOptions so;
+  InferenceSession session_object(so, GetEnvironment());
+  std::unique_ptr<Model> p_model;
+  CreateMatMulModel(p_model, kCpuExecutionProvider);
+
+  std::string s1;
+  p_model->ToProto().SerializeToString(&s1);
+  std::stringstream sstr(s1);
+  ASSERT_TRUE(session_object.Load(sstr).IsOK());
+  ASSERT_STATUS_OK(session_object.Initialize());
+  unique_ptr<IOBinding> io_binding;
+  Status st = session_object.NewIOBinding(&io_binding);
+  ASSERT_TRUE(st.IsOK());
+
+  auto allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+
+  OrtValue bound_value;
+  vector<float> v1{1.f, 2.f, 3.f, 4.f};
+  CreateMLValue<float>(allocator, {2, 2}, v1, &bound_value);
+  io_binding->BindInput("A", bound_value);
+
+  // staged feeds are invisible to the bound inputs until promoted, so the next request can
+  // be prepared while a Run against the bound inputs is still in flight
+  OrtValue staged_value;
+  vector<float> v2{5.f, 6.f, 7.f, 8.f};
+  CreateMLValue<float>(allocator, {2, 2}, v2, &staged_value);
+  ASSERT_STATUS_OK(io_binding->StageInput("A", staged_value));
+  ASSERT_STATUS_OK(io_binding->SynchronizeStagedInputs());
+
+  ASSERT_EQ(io_binding->GetInputs().size(), 1u);
+  auto span = io_binding->GetInputs()[0].Get<Tensor>().DataAsSpan<float>();
+  for (size_t i = 0; i < v1.size(); ++i) {
+    ASSERT_TRUE(v1[i] == span[i]);
+  }
+
+  ASSERT_STATUS_OK(io_binding->PromoteStagedInputs());
+  ASSERT_EQ(io_binding->GetInputs().size(), 1u);
+  span = io_binding->GetInputs()[0].Get<Tensor>().DataAsSpan<float>();
+  for (size_t i = 0; i < v2.size(); ++i) {
+    ASSERT_TRUE(v2[i] == span[i]);
+  }
+
+  // promoting again is a no-op as the staging slots were cleared
+  ASSERT_STATUS_OK(io_binding->PromoteStagedInputs());
+  ASSERT_EQ(io_binding->GetInputs().size(), 1u);
+
+  // a staged name that was never bound is added as a new feed on promotion
+  OrtValue staged_b;
+  CreateMLValue<float>(allocator, {2, 2}, v1, &staged_b);
+  ASSERT_STATUS_OK(io_binding->StageInput("B", staged_b));
+  ASSERT_STATUS_OK(io_binding->PromoteStagedInputs());
+  ASSERT_EQ(io_binding->GetInputs().size(), 2u);
+}
+
 TEST(InferenceSessionTests, InvalidInputTypeOfTensorElement) {
   SessionOptions so;
 
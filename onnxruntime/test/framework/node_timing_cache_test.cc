@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/node_timing_cache.h"
+
+#include <cstdio>
+
+#include "core/graph/constants.h"
+#include "core/graph/graph_viewer.h"
+#include "core/graph/model.h"
+#include "test/test_environment.h"
+#include "asserts.h"
+#include "gtest/gtest.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+TEST(NodeTimingCacheTest, RecordAverageAndRoundTrip) {
+  const std::string path = "node_timing_cache_test.txt";
+  std::remove(path.c_str());
+
+  NodeTimingCache cache;
+  EXPECT_TRUE(cache.Empty());
+
+  // loading a file that does not exist yet leaves the cache empty
+  ASSERT_STATUS_OK(cache.Load(path));
+  EXPECT_TRUE(cache.Empty());
+
+  const std::string key_a = NodeTimingCache::MakeNodeKey("conv1", "Conv", 0);
+  const std::string key_blank = NodeTimingCache::MakeNodeKey("", "Relu", 3);
+  EXPECT_NE(key_a, key_blank);
+
+  cache.Record(key_a, "{1,3,224,224};{64,3,7,7}", 100);
+  cache.Record(key_a, "{1,3,224,224};{64,3,7,7}", 200);
+  cache.Record(key_a, "{1,3,112,112};{64,3,7,7}", 60);
+  cache.Record(key_blank, "{1,64,56,56}", 10);
+
+  double average_us = 0.0;
+  ASSERT_TRUE(cache.GetAverageDurationUs(key_a, average_us));
+  EXPECT_DOUBLE_EQ(average_us, 120.0);  // (100 + 200 + 60) / 3
+  ASSERT_TRUE(cache.GetAverageDurationUs(key_blank, average_us));
+  EXPECT_DOUBLE_EQ(average_us, 10.0);
+  EXPECT_FALSE(cache.GetAverageDurationUs("unknown", average_us));
+
+  ASSERT_STATUS_OK(cache.Save(path));
+
+  // a fresh cache loaded from the file reports the same averages
+  NodeTimingCache loaded;
+  ASSERT_STATUS_OK(loaded.Load(path));
+  ASSERT_TRUE(loaded.GetAverageDurationUs(key_a, average_us));
+  EXPECT_DOUBLE_EQ(average_us, 120.0);
+  ASSERT_TRUE(loaded.GetAverageDurationUs(key_blank, average_us));
+  EXPECT_DOUBLE_EQ(average_us, 10.0);
+
+  // loading on top of existing entries merges the counts
+  ASSERT_STATUS_OK(loaded.Load(path));
+  ASSERT_TRUE(loaded.GetAverageDurationUs(key_a, average_us));
+  EXPECT_DOUBLE_EQ(average_us, 120.0);
+
+  std::remove(path.c_str());
+}
+
+// Diamond graph:
+//   Relu(X) -> T0 -> {Sigmoid -> T1, Tanh -> T2} -> Add(T1, T2) -> Y
+// With Sigmoid much more expensive than Tanh, the path through Sigmoid is critical.
+TEST(NodeTimingCacheTest, CriticalPathCosts) {
+  onnxruntime::Model model("node_timing_cache_test", false, ModelMetaData(), PathString(),
+                           IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {},
+                           DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(16);
+
+  onnxruntime::NodeArg& x_def = graph.GetOrCreateNodeArg("X", &tensor_float);
+  onnxruntime::NodeArg& t0_def = graph.GetOrCreateNodeArg("T0", &tensor_float);
+  onnxruntime::NodeArg& t1_def = graph.GetOrCreateNodeArg("T1", &tensor_float);
+  onnxruntime::NodeArg& t2_def = graph.GetOrCreateNodeArg("T2", &tensor_float);
+  onnxruntime::NodeArg& y_def = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+  auto& relu = graph.AddNode("relu", "Relu", "", {&x_def}, {&t0_def});
+  auto& sigmoid = graph.AddNode("sigmoid", "Sigmoid", "", {&t0_def}, {&t1_def});
+  auto& tanh = graph.AddNode("tanh", "Tanh", "", {&t0_def}, {&t2_def});
+  auto& add = graph.AddNode("add", "Add", "", {&t1_def, &t2_def}, {&y_def});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  NodeTimingCache cache;
+  cache.Record(NodeTimingCache::MakeNodeKey("relu", "Relu", relu.Index()), "{16}", 10);
+  cache.Record(NodeTimingCache::MakeNodeKey("sigmoid", "Sigmoid", sigmoid.Index()), "{16}", 500);
+  cache.Record(NodeTimingCache::MakeNodeKey("tanh", "Tanh", tanh.Index()), "{16}", 20);
+  cache.Record(NodeTimingCache::MakeNodeKey("add", "Add", add.Index()), "{16};{16}", 30);
+
+  GraphViewer viewer(graph);
+  std::vector<double> costs = ComputeCriticalPathCosts(viewer, cache);
+  ASSERT_EQ(costs.size(), static_cast<size_t>(viewer.MaxNodeIndex()));
+
+  EXPECT_DOUBLE_EQ(costs[add.Index()], 30.0);
+  EXPECT_DOUBLE_EQ(costs[sigmoid.Index()], 530.0);  // sigmoid + add
+  EXPECT_DOUBLE_EQ(costs[tanh.Index()], 50.0);      // tanh + add
+  EXPECT_DOUBLE_EQ(costs[relu.Index()], 540.0);     // relu + critical (sigmoid) branch
+  EXPECT_GT(costs[sigmoid.Index()], costs[tanh.Index()]);
+
+  // a node the cache has never seen contributes a nominal cost so the path still counts
+  NodeTimingCache empty_cache;
+  std::vector<double> nominal_costs = ComputeCriticalPathCosts(viewer, empty_cache);
+  EXPECT_DOUBLE_EQ(nominal_costs[relu.Index()], 3.0);  // relu -> sigmoid/tanh -> add
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,292 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// round-trip tests need the ORT format load path
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "core/common/common.h"
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/graph/model.h"
+#include "core/graph/graph_flatbuffers_utils.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "core/flatbuffers/schema/ort.fbs.h"
+#include "flatbuffers/flatbuffers.h"
+#include "test/test_environment.h"
+#include "test_utils.h"
+#include "test/util/include/asserts.h"
+#include "test/util/include/inference_session_wrapper.h"
+
+#include "gtest/gtest.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+// Tests for initializer data round-tripping through the ORT format, including the
+// optional zlib compression added in format version 4. Compression itself is only
+// active in builds with onnxruntime_ENABLE_ORT_FORMAT_COMPRESSION; the byte-identity
+// assertions hold either way.
+
+namespace {
+
+// data stored compressed must exceed this size and save at least 10%
+// (see kCompressionMinBytes in graph_flatbuffers_utils.cc)
+constexpr size_t kCompressionThresholdBytes = 32 * 1024;
+
+TensorProto MakeFloatInitializer(const std::string& name, const std::vector<float>& values) {
+  TensorProto initializer;
+  initializer.set_name(name);
+  initializer.set_data_type(TensorProto_DataType_FLOAT);
+  initializer.add_dims(static_cast<int64_t>(values.size()));
+  initializer.set_raw_data(values.data(), values.size() * sizeof(float));
+  return initializer;
+}
+
+// repeating values deflate well, so anything over the size threshold gets compressed
+std::vector<float> CompressibleValues(size_t count) {
+  std::vector<float> values;
+  values.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    values.push_back(static_cast<float>(i % 32));
+  }
+  return values;
+}
+
+// save the initializer to a flatbuffer, note how it was stored, and load it back
+void SaveAndLoadInitializer(const TensorProto& initializer, TensorProto& loaded, bool& stored_compressed) {
+  flatbuffers::FlatBufferBuilder builder(1024);
+  flatbuffers::Offset<experimental::fbs::Tensor> fbs_offset;
+  ASSERT_STATUS_OK(experimental::utils::SaveInitializerOrtFormat(builder, initializer, fbs_offset));
+  builder.Finish(fbs_offset);
+
+  const auto* fbs_tensor = flatbuffers::GetRoot<experimental::fbs::Tensor>(builder.GetBufferPointer());
+  ASSERT_NE(fbs_tensor, nullptr);
+  stored_compressed = fbs_tensor->compressed_raw_data() != nullptr;
+  EXPECT_NE(stored_compressed, fbs_tensor->raw_data() != nullptr) << "expected exactly one data representation";
+
+  ASSERT_STATUS_OK(experimental::utils::LoadInitializerOrtFormat(*fbs_tensor, loaded));
+}
+
+void ExpectSameRawData(const TensorProto& initializer, const TensorProto& loaded) {
+  std::unique_ptr<unsigned char[]> expected;
+  size_t expected_bytes = 0;
+  ASSERT_STATUS_OK(onnxruntime::utils::UnpackInitializerData(initializer, expected, expected_bytes));
+
+  ASSERT_EQ(loaded.raw_data().size(), expected_bytes);
+  EXPECT_EQ(std::memcmp(loaded.raw_data().data(), expected.get(), expected_bytes), 0);
+}
+
+}  // namespace
+
+TEST(OrtFormatInitializerTests, LargeCompressibleRoundTrip) {
+  const auto initializer =
+      MakeFloatInitializer("large", CompressibleValues(2 * kCompressionThresholdBytes / sizeof(float)));
+
+  TensorProto loaded;
+  bool stored_compressed = false;
+  SaveAndLoadInitializer(initializer, loaded, stored_compressed);
+
+#if defined(ORT_FORMAT_COMPRESSION)
+  EXPECT_TRUE(stored_compressed) << "compressible data over the size threshold should be stored compressed";
+#else
+  EXPECT_FALSE(stored_compressed);
+#endif
+
+  ExpectSameRawData(initializer, loaded);
+}
+
+TEST(OrtFormatInitializerTests, SmallInitializerStaysUncompressed) {
+  // very compressible, but below the size threshold
+  const auto initializer = MakeFloatInitializer("small", std::vector<float>(1024, 1.f));
+
+  TensorProto loaded;
+  bool stored_compressed = false;
+  SaveAndLoadInitializer(initializer, loaded, stored_compressed);
+
+  EXPECT_FALSE(stored_compressed);
+  ExpectSameRawData(initializer, loaded);
+}
+
+TEST(OrtFormatInitializerTests, PoorlyCompressingDataStaysUncompressed) {
+  // pseudo-random bytes over the size threshold cannot deflate by the required 10%
+  TensorProto initializer;
+  initializer.set_name("noise");
+  initializer.set_data_type(TensorProto_DataType_UINT8);
+  initializer.add_dims(static_cast<int64_t>(2 * kCompressionThresholdBytes));
+
+  std::vector<uint8_t> noise;
+  noise.reserve(2 * kCompressionThresholdBytes);
+  uint32_t state = 123456789;
+  for (size_t i = 0; i < 2 * kCompressionThresholdBytes; ++i) {
+    state = state * 1664525 + 1013904223;
+    noise.push_back(static_cast<uint8_t>(state >> 24));
+  }
+  initializer.set_raw_data(noise.data(), noise.size());
+
+  TensorProto loaded;
+  bool stored_compressed = false;
+  SaveAndLoadInitializer(initializer, loaded, stored_compressed);
+
+  EXPECT_FALSE(stored_compressed);
+  ExpectSameRawData(initializer, loaded);
+}
+
+#if defined(ORT_FORMAT_COMPRESSION)
+TEST(OrtFormatInitializerTests, CompressedDataSpansMultipleBlocks) {
+  // 2.5 MB of data against the 1 MB block framing
+  constexpr size_t kBytes = 2 * 1024 * 1024 + 512 * 1024;
+  const auto initializer = MakeFloatInitializer("blocks", CompressibleValues(kBytes / sizeof(float)));
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+  flatbuffers::Offset<experimental::fbs::Tensor> fbs_offset;
+  ASSERT_STATUS_OK(experimental::utils::SaveInitializerOrtFormat(builder, initializer, fbs_offset));
+  builder.Finish(fbs_offset);
+
+  const auto* fbs_tensor = flatbuffers::GetRoot<experimental::fbs::Tensor>(builder.GetBufferPointer());
+  const auto* fbs_compressed_data = fbs_tensor->compressed_raw_data();
+  ASSERT_NE(fbs_compressed_data, nullptr);
+  EXPECT_EQ(fbs_compressed_data->uncompressed_length(), kBytes);
+  ASSERT_NE(fbs_compressed_data->blocks(), nullptr);
+  EXPECT_EQ(fbs_compressed_data->blocks()->size(), 3u);
+
+  TensorProto loaded;
+  ASSERT_STATUS_OK(experimental::utils::LoadInitializerOrtFormat(*fbs_tensor, loaded));
+  ExpectSameRawData(initializer, loaded);
+}
+#endif  // defined(ORT_FORMAT_COMPRESSION)
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+namespace {
+
+// Y = Add(X, W) where W is an initializer with 'num_values' floats
+void CreateAddModel(std::unique_ptr<Model>& model, const std::vector<float>& weights) {
+  model = onnxruntime::make_unique<Model>("OrtFormatInitializerTest", false,
+                                          DefaultLoggingManager().DefaultLogger());
+  auto& graph = model->MainGraph();
+
+  TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(
+      static_cast<int64_t>(weights.size()));
+
+  auto& x = graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& w = graph.GetOrCreateNodeArg("W", &float_tensor);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_tensor);
+
+  graph.AddInitializedTensor(MakeFloatInitializer("W", weights));
+  graph.AddNode("add", "Add", "add the weights", {&x, &w}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+// save the model to 'ort_file' in ORT format via session initialization
+void SaveToOrtFile(const std::vector<float>& weights, const std::basic_string<ORTCHAR_T>& ort_file) {
+  std::unique_ptr<Model> model;
+  CreateAddModel(model, weights);
+  if (!model) return;  // CreateAddModel already failed the test
+
+  std::string model_data;
+  model->ToProto().SerializeToString(&model_data);
+  std::stringstream sstr(model_data);
+
+  SessionOptions so;
+  so.session_logid = "OrtFormatInitializerTest.Save";
+  so.optimized_model_filepath = ort_file;
+  so.AddConfigEntry(kOrtSessionOptionsConfigSaveModelFormat, "ORT");
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(sstr));
+  ASSERT_STATUS_OK(session.Initialize());
+}
+
+}  // namespace
+
+// Full save/load round trip through an ORT format file with an initializer over the
+// compression threshold: the reloaded initializer must be bit-identical and usable.
+TEST(OrtFormatInitializerTests, SessionRoundTripOverCompressionThreshold) {
+  const auto weights = CompressibleValues(2 * kCompressionThresholdBytes / sizeof(float));
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("ort_format_initializer_roundtrip.onnx.ort");
+  SaveToOrtFile(weights, ort_file);
+
+  SessionOptions so;
+  so.session_logid = "OrtFormatInitializerTest.Load";
+  so.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT");
+  InferenceSessionWrapper session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(ort_file));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  const auto& initializers = session.GetGraph().GetAllInitializedTensors();
+  auto it = initializers.find("W");
+  ASSERT_NE(it, initializers.cend());
+  ExpectSameRawData(MakeFloatInitializer("W", weights), *it->second);
+
+  // adding zeros returns the weights, so the Run output checks the kernel sees the same bytes
+  OrtValue x;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault),
+                       {static_cast<int64_t>(weights.size())}, std::vector<float>(weights.size(), 0.f), &x);
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session.Run({{"X", x}}, {"Y"}, &fetches));
+
+  const auto& output = fetches[0].Get<Tensor>();
+  ASSERT_EQ(output.Shape().Size(), static_cast<int64_t>(weights.size()));
+  EXPECT_EQ(std::memcmp(output.Data<float>(), weights.data(), weights.size() * sizeof(float)), 0);
+}
+
+// A file whose initializers are all below the compression threshold carries the same
+// payload a version 3 writer produces, so rewriting its version tag gives a faithful
+// version 3 file, which must still load.
+TEST(OrtFormatInitializerTests, Version3ModelStillLoads) {
+  const std::vector<float> weights{1.5f, -2.5f, 3.25f, 4.75f};
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("ort_format_initializer_v3.onnx.ort");
+  SaveToOrtFile(weights, ort_file);
+
+  size_t num_bytes = 0;
+  ASSERT_STATUS_OK(Env::Default().GetFileLength(ort_file.c_str(), num_bytes));
+  std::vector<char> model_data(num_bytes);
+  std::ifstream bytes_stream(ort_file, std::ifstream::in | std::ifstream::binary);
+  bytes_stream.read(model_data.data(), num_bytes);
+  bytes_stream.close();
+
+  // the version is the length-1 flatbuffer string "4". It is created before any other
+  // buffer content, which puts it near the end of the file; require it to be unambiguous
+  // there before rewriting it to "3".
+  const char version_string[] = {0x01, 0x00, 0x00, 0x00, '4', 0x00};
+  const size_t search_window = std::min<size_t>(num_bytes, 256);
+  char* const window_begin = model_data.data() + (num_bytes - search_window);
+  char* version_pos = nullptr;
+  size_t num_matches = 0;
+  for (size_t i = 0; i + sizeof(version_string) <= search_window; ++i) {
+    if (std::memcmp(window_begin + i, version_string, sizeof(version_string)) == 0) {
+      version_pos = window_begin + i;
+      ++num_matches;
+    }
+  }
+  ASSERT_EQ(num_matches, 1u) << "could not locate the format version string unambiguously";
+  version_pos[4] = '3';
+
+  SessionOptions so;
+  so.session_logid = "OrtFormatInitializerTest.LoadV3";
+  so.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT");
+  InferenceSessionWrapper session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_data.data(), static_cast<int>(num_bytes)));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  const auto& initializers = session.GetGraph().GetAllInitializedTensors();
+  auto it = initializers.find("W");
+  ASSERT_NE(it, initializers.cend());
+  ExpectSameRawData(MakeFloatInitializer("W", weights), *it->second);
+}
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
+}  // namespace test
+}  // namespace onnxruntime
+
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD)
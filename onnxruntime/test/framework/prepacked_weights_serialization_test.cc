@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// saving needs the full build, loading the ORT format load path
+#if defined(ENABLE_ORT_FORMAT_LOAD) && !defined(ORT_MINIMAL_BUILD)
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "core/framework/prepacked_weights_container.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "core/flatbuffers/schema/ort.fbs.h"
+#include "test/test_environment.h"
+#include "test_utils.h"
+#include "test/util/include/asserts.h"
+
+#include "gtest/gtest.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+// Tests for pre-packed weight serialization in ORT format models
+// (session.save_prepacked_weights). The stored buffers can only be used on a CPU with
+// the capabilities they were packed for, so the hit and miss paths are exercised
+// in-process by tampering with the saved file: corrupting the packed buffers shows
+// whether a load consumed them or re-packed from the initializer, and corrupting the
+// fingerprint forces the mismatch path on the machine that wrote the file.
+
+namespace {
+
+// Y[2,3] = MatMul(X[2,4], W[4,3]) with constant W; the fp32 MatMul kernel pre-packs W
+// and supports shared pre-packed buffers.
+void BuildMatMulModelBytes(std::string& model_bytes) {
+  Model model("PrepackedWeightsSerializationTest", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto x_type;
+  x_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  x_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  x_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+
+  TypeProto w_type;
+  w_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  w_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+  w_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  TypeProto y_type;
+  y_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  y_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  y_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  auto& x = graph.GetOrCreateNodeArg("X", &x_type);
+  auto& w = graph.GetOrCreateNodeArg("W", &w_type);
+  auto& y = graph.GetOrCreateNodeArg("Y", &y_type);
+
+  TensorProto w_proto;
+  w_proto.set_name("W");
+  w_proto.set_data_type(TensorProto_DataType_FLOAT);
+  w_proto.add_dims(4);
+  w_proto.add_dims(3);
+  for (int i = 0; i < 12; ++i) {
+    w_proto.add_float_data(0.25f * static_cast<float>(i + 1));
+  }
+  graph.AddInitializedTensor(w_proto);
+
+  graph.AddNode("matmul", "MatMul", "matmul with constant weights", {&x, &w}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  model.ToProto().SerializeToString(&model_bytes);
+}
+
+// initialize a session that saves the model with its pre-packed weights to 'ort_file'
+void SaveOrtFileWithPrepackedWeights(const std::basic_string<ORTCHAR_T>& ort_file) {
+  std::string model_bytes;
+  BuildMatMulModelBytes(model_bytes);
+  if (model_bytes.empty()) return;  // BuildMatMulModelBytes already failed the test
+
+  std::stringstream sstr(model_bytes);
+
+  SessionOptions so;
+  so.session_logid = "PrepackedWeightsSerializationTest.Save";
+  so.optimized_model_filepath = ort_file;
+  so.AddConfigEntry(kOrtSessionOptionsConfigSaveModelFormat, "ORT");
+  so.AddConfigEntry(kOrtSessionOptionsConfigSavePrepackedWeights, "1");
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(sstr));
+  ASSERT_STATUS_OK(session.Initialize());
+}
+
+void ReadFileBytes(const std::basic_string<ORTCHAR_T>& path, std::vector<char>& bytes) {
+  size_t num_bytes = 0;
+  ASSERT_STATUS_OK(Env::Default().GetFileLength(path.c_str(), num_bytes));
+  bytes.resize(num_bytes);
+  std::ifstream stream(path, std::ifstream::in | std::ifstream::binary);
+  stream.read(bytes.data(), num_bytes);
+  stream.close();
+}
+
+// MatMul of the fixed X against the model's W, computed by hand
+const std::vector<float> kExpectedOutput{17.5f, 20.f, 22.5f, 39.5f, 46.f, 52.5f};
+
+void LoadAndRun(const std::vector<char>& model_bytes, std::vector<float>& output) {
+  SessionOptions so;
+  so.session_logid = "PrepackedWeightsSerializationTest.Load";
+  so.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT");
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_bytes.data(), static_cast<int>(model_bytes.size())));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  OrtValue x;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {2, 4},
+                       {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f}, &x);
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session.Run({{"X", x}}, {"Y"}, &fetches));
+
+  const auto& tensor = fetches[0].Get<Tensor>();
+  ASSERT_EQ(tensor.Shape().Size(), 6);
+  output.assign(tensor.Data<float>(), tensor.Data<float>() + 6);
+}
+
+const experimental::fbs::PrePackedWeightsData* GetPrepackedWeights(const std::vector<char>& model_bytes) {
+  const auto* fbs_session = experimental::fbs::GetInferenceSession(model_bytes.data());
+  return fbs_session != nullptr ? fbs_session->prepacked_weights() : nullptr;
+}
+
+}  // namespace
+
+TEST(PrepackedWeightsSerializationTests, SavedFileContainsFingerprintedWeights) {
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("prepacked_weights_saved.onnx.ort");
+  SaveOrtFileWithPrepackedWeights(ort_file);
+
+  std::vector<char> model_bytes;
+  ReadFileBytes(ort_file, model_bytes);
+
+  const auto* fbs_prepacked_weights = GetPrepackedWeights(model_bytes);
+  ASSERT_NE(fbs_prepacked_weights, nullptr);
+
+  ASSERT_NE(fbs_prepacked_weights->cpu_fingerprint(), nullptr);
+  EXPECT_EQ(fbs_prepacked_weights->cpu_fingerprint()->str(), GenerateCpuFingerprintForPrepackedWeights());
+
+  const auto* fbs_weights = fbs_prepacked_weights->weights();
+  ASSERT_NE(fbs_weights, nullptr);
+  ASSERT_EQ(fbs_weights->size(), 1u);
+
+  const auto* fbs_weight = fbs_weights->Get(0);
+  ASSERT_NE(fbs_weight->key(), nullptr);
+  EXPECT_EQ(fbs_weight->key()->str().rfind("MatMul+", 0), 0u) << fbs_weight->key()->str();
+  ASSERT_NE(fbs_weight->buffers(), nullptr);
+  ASSERT_EQ(fbs_weight->buffers()->size(), 1u);
+  ASSERT_NE(fbs_weight->buffers()->Get(0)->data(), nullptr);
+  EXPECT_GT(fbs_weight->buffers()->Get(0)->data()->size(), 0u);
+}
+
+// When the fingerprint matches, the stored buffer must be used verbatim and re-packing
+// skipped: a load of the unmodified file computes the right answer, and zeroing the
+// stored packed buffer changes the result, which it could not if the kernel re-packed
+// from the initializer.
+TEST(PrepackedWeightsSerializationTests, FingerprintMatchUsesStoredBuffers) {
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("prepacked_weights_hit.onnx.ort");
+  SaveOrtFileWithPrepackedWeights(ort_file);
+
+  std::vector<char> model_bytes;
+  ReadFileBytes(ort_file, model_bytes);
+
+  std::vector<float> output;
+  LoadAndRun(model_bytes, output);
+  EXPECT_EQ(output, kExpectedOutput);
+
+  const auto* fbs_prepacked_weights = GetPrepackedWeights(model_bytes);
+  ASSERT_NE(fbs_prepacked_weights, nullptr);
+  const auto* fbs_buffer_data = fbs_prepacked_weights->weights()->Get(0)->buffers()->Get(0)->data();
+  std::memset(const_cast<uint8_t*>(fbs_buffer_data->Data()), 0, fbs_buffer_data->size());
+
+  std::vector<float> tampered_output;
+  LoadAndRun(model_bytes, tampered_output);
+  EXPECT_NE(tampered_output, kExpectedOutput) << "stored pre-packed buffer was not used";
+}
+
+// When the fingerprint does not match, the stored buffers must be ignored and the kernel
+// must re-pack from the initializer. The packed buffers are zeroed as well, so using them
+// despite the mismatch would produce a wrong result.
+TEST(PrepackedWeightsSerializationTests, FingerprintMismatchFallsBackToRepacking) {
+  const std::basic_string<ORTCHAR_T> ort_file = ORT_TSTR("prepacked_weights_miss.onnx.ort");
+  SaveOrtFileWithPrepackedWeights(ort_file);
+
+  std::vector<char> model_bytes;
+  ReadFileBytes(ort_file, model_bytes);
+
+  const auto* fbs_prepacked_weights = GetPrepackedWeights(model_bytes);
+  ASSERT_NE(fbs_prepacked_weights, nullptr);
+
+  const auto* fbs_fingerprint = fbs_prepacked_weights->cpu_fingerprint();
+  ASSERT_GT(fbs_fingerprint->size(), 0u);
+  const_cast<char*>(fbs_fingerprint->c_str())[0] = '?';
+
+  const auto* fbs_buffer_data = fbs_prepacked_weights->weights()->Get(0)->buffers()->Get(0)->data();
+  std::memset(const_cast<uint8_t*>(fbs_buffer_data->Data()), 0, fbs_buffer_data->size());
+
+  std::vector<float> output;
+  LoadAndRun(model_bytes, output);
+  EXPECT_EQ(output, kExpectedOutput);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
+
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD) && !defined(ORT_MINIMAL_BUILD)
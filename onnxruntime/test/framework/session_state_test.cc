@@ -8,7 +8,9 @@
 #include "core/framework/graph_partitioner.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/prepacked_weights_container.h"
 #include "core/framework/session_state.h"
+#include "core/framework/session_state_utils.h"
 #include "core/graph/graph_utils.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
@@ -188,9 +190,44 @@ class PrePackingTestOpKernel : public OpKernel {
     is_packed = true;
     return Status::OK();
   }
+
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 bool& is_packed, PrePackedWeights* prepacked_weights) override {
+    ORT_UNUSED_PARAMETER(tensor);
+    ORT_UNUSED_PARAMETER(input_idx);
+    if (prepacked_weights != nullptr) {
+      constexpr size_t kFakePackedSize = 8;
+      void* packed_data = alloc->Alloc(kFakePackedSize);
+      prepacked_weights->buffers_.push_back(BufferUniquePtr(packed_data, BufferDeleter(alloc)));
+      prepacked_weights->buffer_sizes_.push_back(kFakePackedSize);
+    }
+    ++num_container_prepack_calls;
+    is_packed = true;
+    return Status::OK();
+  }
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx, const Tensor& tensor,
+                                   bool& used_shared_buffers) override {
+    ORT_UNUSED_PARAMETER(input_idx);
+    ORT_UNUSED_PARAMETER(tensor);
+    shared_packed_buffer_ = std::move(prepacked_buffers[0]);
+    ++num_shared_prepack_calls;
+    used_shared_buffers = true;
+    return Status::OK();
+  }
+
+  static int num_container_prepack_calls;
+  static int num_shared_prepack_calls;
+
+ private:
+  BufferUniquePtr shared_packed_buffer_;
 };
 
-static void CreateSimpleGraph(Graph& graph) {
+int PrePackingTestOpKernel::num_container_prepack_calls = 0;
+int PrePackingTestOpKernel::num_shared_prepack_calls = 0;
+
+static void CreateSimpleGraph(Graph& graph, const std::string& op_type = "PrePackingTest") {
   // node creation and placement
   TypeProto type;
   type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
@@ -206,7 +243,7 @@ static void CreateSimpleGraph(Graph& graph) {
   onnxruntime::NodeArg output_arg("node_0_output_0", &type);
   outputs.push_back(&output_arg);
 
-  graph.AddNode("node_0", "PrePackingTest", "node 0", inputs, outputs);
+  graph.AddNode("node_0", op_type, "node 0", inputs, outputs);
 
   // add an initializer
   ONNX_NAMESPACE::TensorProto tensor;
@@ -395,5 +432,321 @@ INSTANTIATE_TEST_SUITE_P(SessionStateTests,
                                          PrepackingTestParam{true, false},
                                          PrepackingTestParam{true, true}));
 
+TEST(SessionStatePrepackingSharingTest, SharedPrePackedWeights) {
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+  ONNX_OPERATOR_SCHEMA(PrePackingTestShared)
+      .SetDoc("Faking Node for PrePacking sharing")
+      .Input(0, "Input_0", "input 0", "tensor(float)")
+      .Input(1, "Input_1", "input 1", "tensor(float)")
+      .Output(0, "output_0", "docstr for output_0.", "tensor(float)");
+
+  ExecutionProviders execution_providers;
+  auto cpu_execution_provider = onnxruntime::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+  execution_providers.Add(kCpuExecutionProvider, std::move(cpu_execution_provider));
+
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+  std::shared_ptr<KernelRegistry> kernel_registry = std::make_shared<KernelRegistry>();
+  auto kernel_def =
+      KernelDefBuilder().SetName("PrePackingTestShared").Provider(kCpuExecutionProvider).SinceVersion(1).Build();
+  ASSERT_STATUS_OK(kernel_registry->Register(
+      KernelCreateInfo(std::move(kernel_def),
+                       [](const OpKernelInfo& info) -> OpKernel* { return new PrePackingTestOpKernel(info); })));
+  kernel_registry_manager.RegisterKernelRegistry(kernel_registry);
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 11;
+
+  PrepackedWeightsContainer prepacked_weights_container;
+  PrePackingTestOpKernel::num_container_prepack_calls = 0;
+  PrePackingTestOpKernel::num_shared_prepack_calls = 0;
+
+  SessionOptions sess_options;
+
+  // two session states (for two identical models) sharing the container. the first one packs the
+  // weight and publishes it, the second one consumes the shared copy instead of packing again.
+  for (int i = 0; i < 2; ++i) {
+    Model model("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                DefaultLoggingManager().DefaultLogger());
+    CreateSimpleGraph(model.MainGraph(), "PrePackingTestShared");
+    PlaceAllNodesToCPUEP(model.MainGraph());
+
+    SessionState session_state(model.MainGraph(),
+                               execution_providers,
+                               true, /*enable_mem_pattern*/
+                               tp.get(),
+                               nullptr, /*inter_op_thread_pool*/
+                               dtm,
+                               DefaultLoggingManager().DefaultLogger(),
+                               profiler);
+    session_state.SetPrepackedWeightsContainer(&prepacked_weights_container);
+    ASSERT_STATUS_OK(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                        kernel_registry_manager,
+                                                        sess_options));
+
+    // the constant initializer is released in both session states once packed
+    ASSERT_EQ(session_state.GetConstantInitializedTensors().size(), size_t(0));
+  }
+
+  ASSERT_EQ(PrePackingTestOpKernel::num_container_prepack_calls, 1);
+  ASSERT_EQ(PrePackingTestOpKernel::num_shared_prepack_calls, 1);
+}
+
+// Build a graph with two byte-identical constant initializers, each consumed by its own Add node.
+static void CreateGraphWithDuplicateInitializers(Graph& graph) {
+  TypeProto type_float;
+  type_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  type_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("add_input", &type_float);
+  auto& weight_0_arg = graph.GetOrCreateNodeArg("weight_0", &type_float);
+  auto& weight_1_arg = graph.GetOrCreateNodeArg("weight_1", &type_float);
+  auto& add_0_out = graph.GetOrCreateNodeArg("add_0_output", &type_float);
+  auto& add_1_out = graph.GetOrCreateNodeArg("add_1_output", &type_float);
+
+  graph.AddNode("add_0", "Add", "add 0", {&input_arg, &weight_0_arg}, {&add_0_out});
+  graph.AddNode("add_1", "Add", "add 1", {&add_0_out, &weight_1_arg}, {&add_1_out});
+
+  const float weight_data[] = {1.f, 2.f};
+  for (const auto* name : {"weight_0", "weight_1"}) {
+    ONNX_NAMESPACE::TensorProto tensor;
+    tensor.add_dims(2);
+    tensor.set_data_type(TensorProto_DataType_FLOAT);
+    tensor.set_raw_data(weight_data, sizeof(weight_data));
+    tensor.set_name(name);
+    graph.AddInitializedTensor(tensor);
+  }
+
+  auto status = graph.Resolve();
+  ASSERT_TRUE(status.IsOK());
+}
+
+TEST(SessionStateInitializerDedupTest, IdenticalInitializersShareOneBuffer) {
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+  ExecutionProviders execution_providers;
+  auto cpu_execution_provider = onnxruntime::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+  execution_providers.Add(kCpuExecutionProvider, std::move(cpu_execution_provider));
+
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 11;
+
+  for (const bool disable_dedup : {false, true}) {
+    Model model("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                DefaultLoggingManager().DefaultLogger());
+    CreateGraphWithDuplicateInitializers(model.MainGraph());
+    PlaceAllNodesToCPUEP(model.MainGraph());
+
+    SessionState session_state(model.MainGraph(),
+                               execution_providers,
+                               true, /*enable_mem_pattern*/
+                               tp.get(),
+                               nullptr, /*inter_op_thread_pool*/
+                               dtm,
+                               DefaultLoggingManager().DefaultLogger(),
+                               profiler);
+
+    SessionOptions sess_options;
+    sess_options.session_configurations[kOrtSessionOptionsConfigDisableInitializerDedup] = disable_dedup ? "1" : "0";
+    ASSERT_STATUS_OK(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                        kernel_registry_manager,
+                                                        sess_options));
+
+    const auto& name_to_idx = session_state.GetOrtValueNameIdxMap();
+    int weight_0_idx = -1;
+    int weight_1_idx = -1;
+    ASSERT_STATUS_OK(name_to_idx.GetIdx("weight_0", weight_0_idx));
+    ASSERT_STATUS_OK(name_to_idx.GetIdx("weight_1", weight_1_idx));
+
+    const auto& initialized_tensors = session_state.GetConstantInitializedTensors();
+    const auto weight_0_entry = initialized_tensors.find(weight_0_idx);
+    const auto weight_1_entry = initialized_tensors.find(weight_1_idx);
+    ASSERT_NE(weight_0_entry, initialized_tensors.cend());
+    ASSERT_NE(weight_1_entry, initialized_tensors.cend());
+
+    const void* weight_0_data = weight_0_entry->second.Get<Tensor>().DataRaw();
+    const void* weight_1_data = weight_1_entry->second.Get<Tensor>().DataRaw();
+    if (disable_dedup) {
+      ASSERT_NE(weight_0_data, weight_1_data);
+    } else {
+      ASSERT_EQ(weight_0_data, weight_1_data) << "Identical initializers should alias one buffer.";
+    }
+  }
+}
+
+TEST(SessionStateInitializerDedupTest, SessionsInSameGroupShareBuffers) {
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+  ExecutionProviders execution_providers;
+  auto cpu_execution_provider = onnxruntime::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+  execution_providers.Add(kCpuExecutionProvider, std::move(cpu_execution_provider));
+
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 11;
+
+  // one cache per model group, as handed out by Environment::GetInitializerDedupCache(group_name)
+  session_state_utils::InitializerDedupCache group_a_cache;
+  group_a_cache.cross_session = true;
+  session_state_utils::InitializerDedupCache group_b_cache;
+  group_b_cache.cross_session = true;
+
+  // finalize a session state against the given group cache and return the buffer of weight_0
+  auto load_weight_0 = [&](session_state_utils::InitializerDedupCache& dedup_cache,
+                           Model& model, SessionState& session_state) -> const void* {
+    CreateGraphWithDuplicateInitializers(model.MainGraph());
+    PlaceAllNodesToCPUEP(model.MainGraph());
+
+    session_state.SetEnvInitializerDedupCache(&dedup_cache);
+
+    SessionOptions sess_options;
+    EXPECT_TRUE(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                   kernel_registry_manager,
+                                                   sess_options)
+                    .IsOK());
+
+    int weight_0_idx = -1;
+    EXPECT_TRUE(session_state.GetOrtValueNameIdxMap().GetIdx("weight_0", weight_0_idx).IsOK());
+    const auto& initialized_tensors = session_state.GetConstantInitializedTensors();
+    const auto weight_0_entry = initialized_tensors.find(weight_0_idx);
+    EXPECT_NE(weight_0_entry, initialized_tensors.cend());
+    return weight_0_entry->second.Get<Tensor>().DataRaw();
+  };
+
+  Model model_0("graph_0", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                DefaultLoggingManager().DefaultLogger());
+  Model model_1("graph_1", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                DefaultLoggingManager().DefaultLogger());
+  Model model_2("graph_2", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                DefaultLoggingManager().DefaultLogger());
+
+  SessionState session_state_0(model_0.MainGraph(), execution_providers, true, tp.get(), nullptr, dtm,
+                               DefaultLoggingManager().DefaultLogger(), profiler);
+  SessionState session_state_1(model_1.MainGraph(), execution_providers, true, tp.get(), nullptr, dtm,
+                               DefaultLoggingManager().DefaultLogger(), profiler);
+  SessionState session_state_2(model_2.MainGraph(), execution_providers, true, tp.get(), nullptr, dtm,
+                               DefaultLoggingManager().DefaultLogger(), profiler);
+
+  const void* group_a_weight_0 = load_weight_0(group_a_cache, model_0, session_state_0);
+  const void* group_a_weight_1 = load_weight_0(group_a_cache, model_1, session_state_1);
+  const void* group_b_weight = load_weight_0(group_b_cache, model_2, session_state_2);
+
+  // sessions in the same group alias one buffer; another group loads its own copy
+  ASSERT_EQ(group_a_weight_0, group_a_weight_1) << "Sessions in one group should share identical weights.";
+  ASSERT_NE(group_a_weight_0, group_b_weight) << "Groups should not share buffers with each other.";
+}
+
+namespace {
+struct CountingKernelState : public SessionState::PooledKernelState {
+  explicit CountingKernelState(int* live_count) : live_count_(live_count) { ++*live_count_; }
+  ~CountingKernelState() override { --*live_count_; }
+  int* live_count_;
+};
+}  // namespace
+
+TEST(SessionStateTest, PooledKernelState) {
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+  onnxruntime::Model model("pooled_kernel_state", false, DefaultLoggingManager().DefaultLogger());
+
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(
+      kCpuExecutionProvider, onnxruntime::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false))));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState session_state(model.MainGraph(), execution_providers, true, tp.get(), nullptr, dtm,
+                             DefaultLoggingManager().DefaultLogger(), profiler);
+
+  int live_count = 0;
+  auto factory = [&live_count]() -> std::unique_ptr<SessionState::PooledKernelState> {
+    return onnxruntime::make_unique<CountingKernelState>(&live_count);
+  };
+
+  const NodeIndex node_index = 0;
+
+  // two overlapping checkouts (as two concurrent Runs would do) get distinct instances
+  auto state_a = session_state.CheckOutKernelState(node_index, factory);
+  auto state_b = session_state.CheckOutKernelState(node_index, factory);
+  ASSERT_NE(state_a.get(), state_b.get());
+  ASSERT_EQ(live_count, 2);
+
+  // a returned instance is handed back out instead of creating a third one
+  auto* returned = state_a.get();
+  session_state.ReturnKernelState(node_index, std::move(state_a));
+  auto state_c = session_state.CheckOutKernelState(node_index, factory);
+  ASSERT_EQ(state_c.get(), returned);
+  ASSERT_EQ(live_count, 2);
+
+  // pools are per node
+  auto state_d = session_state.CheckOutKernelState(node_index + 1, factory);
+  ASSERT_EQ(live_count, 3);
+
+  // the RAII holder returns its state on scope exit
+  session_state.ReturnKernelState(node_index, std::move(state_c));
+  {
+    SessionState::PooledKernelStateHolder holder(session_state, node_index, factory);
+    ASSERT_EQ(holder.get(), returned);
+  }
+  auto state_e = session_state.CheckOutKernelState(node_index, factory);
+  ASSERT_EQ(state_e.get(), returned);
+  ASSERT_EQ(live_count, 3);
+}
+
+TEST(SessionStateTest, FrameValuesStoragePool) {
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+  onnxruntime::Model model("frame_values_storage_pool", false, DefaultLoggingManager().DefaultLogger());
+
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(
+      kCpuExecutionProvider, onnxruntime::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false))));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState session_state(model.MainGraph(), execution_providers, true, tp.get(), nullptr, dtm,
+                             DefaultLoggingManager().DefaultLogger(), profiler);
+
+  // nothing pooled yet
+  auto storage = session_state.CheckOutFrameValuesStorage();
+  ASSERT_EQ(storage.capacity(), 0u);
+
+  // a returned buffer keeps its allocation and is handed back out empty
+  storage.resize(16);
+  const OrtValue* allocation = storage.data();
+  storage.clear();
+  session_state.ReturnFrameValuesStorage(std::move(storage));
+
+  auto reused = session_state.CheckOutFrameValuesStorage();
+  ASSERT_EQ(reused.data(), allocation);
+  ASSERT_GE(reused.capacity(), 16u);
+  ASSERT_TRUE(reused.empty());
+
+  // the pool is empty again while the buffer is checked out
+  auto second = session_state.CheckOutFrameValuesStorage();
+  ASSERT_EQ(second.capacity(), 0u);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
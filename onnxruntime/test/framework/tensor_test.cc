@@ -178,6 +178,46 @@ TEST(TensorTest, StringTensorTest) {
   }
 }
 
+TEST(TensorTest, StridedViewTest) {
+  auto alloc = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  std::vector<float> buffer(4 * 5);
+  for (size_t i = 0; i < buffer.size(); ++i)
+    buffer[i] = static_cast<float>(i);
+
+  // a {4, 3} column slice of a {4, 5} buffer keeps the physical row stride of 5
+  TensorShape shape({4, 3});
+  Tensor t(DataTypeImpl::GetType<float>(), shape, buffer.data(), alloc->Info(),
+           std::vector<int64_t>{5, 1});
+  EXPECT_FALSE(t.IsContiguous());
+  EXPECT_THAT(t.Strides(), testing::ElementsAre(5, 1));
+  EXPECT_EQ(t.Data<float>()[0], 0.f);
+
+  // reshaping a non-contiguous view is invalid
+  EXPECT_THROW(t.Reshape(TensorShape({3, 4})), OnnxRuntimeException);
+
+  // move must carry the stride info and reset the moved-from tensor
+  Tensor moved(std::move(t));
+  EXPECT_FALSE(moved.IsContiguous());
+  EXPECT_THAT(moved.Strides(), testing::ElementsAre(5, 1));
+  EXPECT_TRUE(t.IsContiguous());
+
+  // strides that match the dense row-major layout are detected as contiguous,
+  // and Strides() computes them from the shape when none were set explicitly
+  Tensor dense(DataTypeImpl::GetType<float>(), TensorShape({4, 5}), buffer.data(), alloc->Info(),
+               std::vector<int64_t>{5, 1});
+  EXPECT_TRUE(dense.IsContiguous());
+  EXPECT_THAT(dense.Strides(), testing::ElementsAre(5, 1));
+
+  Tensor plain(DataTypeImpl::GetType<float>(), TensorShape({4, 5}), buffer.data(), alloc->Info());
+  EXPECT_TRUE(plain.IsContiguous());
+  EXPECT_THAT(plain.Strides(), testing::ElementsAre(5, 1));
+
+  // number of strides must match the number of dimensions
+  EXPECT_THROW(Tensor(DataTypeImpl::GetType<float>(), shape, buffer.data(), alloc->Info(),
+                      std::vector<int64_t>{1}),
+               OnnxRuntimeException);
+}
+
 TEST(TensorTest, ConvertToString) {
   TensorShape shape({2, 3, 4});
 
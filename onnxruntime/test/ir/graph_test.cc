@@ -1310,6 +1310,42 @@ TEST_F(GraphTest, ShapeInferenceErrorHandling) {
                                                         "[ShapeInferenceError] try harder"));
 }
 
+TEST_F(GraphTest, ReinferChangedNodesOnlyPropagatesToDownstreamNodes) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("input_1", &tensor_float);
+  auto& cast_out = graph.GetOrCreateNodeArg("cast_out", nullptr);
+  auto& identity_out = graph.GetOrCreateNodeArg("identity_out", nullptr);
+
+  auto& cast_node = graph.AddNode("cast", "Cast", "cast node", {&input_arg}, {&cast_out});
+  cast_node.AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_INT32));
+  graph.AddNode("identity", "Identity", "identity node", {&cast_out}, {&identity_out});
+
+  auto status = graph.Resolve();
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+  EXPECT_EQ(*identity_out.Type(), "tensor(int32)");
+
+  // change the Cast target type. only the Cast node is tracked as changed, but inferencing must
+  // propagate the new type through the downstream Identity node.
+  cast_node.ClearAttribute("to");
+  cast_node.AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_INT64));
+
+  Graph::ResolveOptions options;
+  options.override_types = true;
+  options.reinfer_changed_nodes_only = true;
+  status = graph.Resolve(options);
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+
+  EXPECT_EQ(*cast_out.Type(), "tensor(int64)");
+  EXPECT_EQ(*identity_out.Type(), "tensor(int64)");
+}
+
 TEST_F(GraphTest, AddTensorAttribute) {
   OPERATOR_SCHEMA(__Constant)
       .SetDoc("Constant Op.")
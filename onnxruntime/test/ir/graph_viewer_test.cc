@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
 #include <iostream>
 #include "core/graph/graph_viewer.h"
 #include "test/providers/provider_test_utils.h"
@@ -101,5 +102,33 @@ TEST(GraphViewer, FilteredGraph) {
   // Pick a initializers which is not in the viewer, and check it is not part of the viewer's initializers
   EXPECT_TRUE(viewer_initializers.count("Constant15770PastValue16469") == 0);
 }
+
+TEST(GraphViewer, CachedTopologicalOrder) {
+  auto model_uri = ORT_TSTR("testdata/scan_1.onnx");
+
+  std::shared_ptr<Model> p_model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, p_model, nullptr, DefaultLoggingManager().DefaultLogger()));
+  Graph& graph = p_model->MainGraph();
+
+  // repeated viewer construction over an unchanged graph must serve the same cached ordering
+  GraphViewer viewer1{graph};
+  const auto order = viewer1.GetNodesInTopologicalOrder();
+  GraphViewer viewer2{graph};
+  EXPECT_THAT(order, testing::ContainerEq(viewer2.GetNodesInTopologicalOrder()));
+  EXPECT_EQ(&graph.GetCachedTopologicalOrder(), &graph.GetCachedTopologicalOrder());
+
+  // a mutation invalidates the cache: append an Identity consuming a graph output and the new
+  // ordering must include it
+  NodeArg* src = graph.GetNodeArg(graph.GetOutputs()[0]->Name());
+  auto& identity_out = graph.GetOrCreateNodeArg("cached_topo_order_test_out", src->TypeAsProto());
+  const auto& new_node = graph.AddNode("cached_topo_order_test", "Identity", "appended by test",
+                                       {src}, {&identity_out});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  GraphViewer viewer3{graph};
+  const auto& new_order = viewer3.GetNodesInTopologicalOrder();
+  EXPECT_EQ(new_order.size(), order.size() + 1);
+  EXPECT_TRUE(std::find(new_order.cbegin(), new_order.cend(), new_node.Index()) != new_order.cend());
+}
 }  // namespace test
 }  // namespace onnxruntime
@@ -132,3 +132,24 @@ TEST(SchemaRegistryManager, OpsetRegTest) {
   ASSERT_TRUE(manager.GetSchema("Op5", 5, "Domain1")->since_version() == 1);
   ASSERT_TRUE(manager.GetSchema("Op5", 1, "Domain1")->since_version() == 1);
 }
+
+TEST(SchemaRegistryManager, LookupCache) {
+  SchemaRegistryManager manager;
+
+  // repeated lookups (as Graph::Resolve issues per node, per Resolve round) are served from the
+  // cache and must return the same schema
+  const auto* first = manager.GetSchema("Gemm", 10, "");
+  ASSERT_NE(first, nullptr);
+  ASSERT_EQ(manager.GetSchema("Gemm", 10, ""), first);
+
+  // misses are cached too
+  ASSERT_EQ(manager.GetSchema("NoSuchOp", 10, ""), nullptr);
+  ASSERT_EQ(manager.GetSchema("NoSuchOp", 10, ""), nullptr);
+
+  // registering a registry invalidates the cache: a previously missing op becomes visible
+  std::shared_ptr<onnxruntime::OnnxRuntimeOpSchemaRegistry> registry = std::make_shared<OnnxRuntimeOpSchemaRegistry>();
+  std::vector<ONNX_NAMESPACE::OpSchema> schema = {CreateTestSchema("NoSuchOp", "", 1)};
+  ASSERT_STATUS_OK(registry->RegisterOpSet(schema, "", 0, 10));
+  manager.RegisterRegistry(registry);
+  ASSERT_NE(manager.GetSchema("NoSuchOp", 10, ""), nullptr);
+}
@@ -0,0 +1,357 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    benchmark.cpp
+
+Abstract:
+
+    This module implements microbenchmarks for the MLAS library using the
+    google benchmark framework.
+
+    The shape sweeps cover the GEMM and convolution shapes observed in
+    production transformer and convolutional model traces, so changes to the
+    blocking parameters and kernels can be evaluated against representative
+    workloads. Throughput is reported as a FLOPS or bytes rate counter per
+    shape.
+
+    On x64 builds, the float GEMM dispatch entry of MLAS_PLATFORM can be
+    pinned with --dispatch=sse|avx|fma3|avx512f to compare code paths on the
+    same processor. Pinning a kernel that the processor does not support
+    faults, so only pin kernels the processor can execute.
+
+--*/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mlasi.h"
+
+//
+// Fills a buffer with uniform random values in the supplied range.
+//
+
+template <typename T>
+std::vector<T>
+GenerateRandomBuffer(
+    size_t ElementCount,
+    float MinimumValue,
+    float MaximumValue
+    )
+{
+    std::vector<T> Buffer(ElementCount);
+
+    std::default_random_engine generator(static_cast<unsigned>(ElementCount));
+    std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+    for (size_t n = 0; n < ElementCount; n++) {
+        Buffer[n] = T(distribution(generator));
+    }
+
+    return Buffer;
+}
+
+//
+// Single precision matrix/matrix multiply.
+//
+
+static
+void
+BM_Sgemm(
+    benchmark::State& state
+    )
+{
+    const size_t M = static_cast<size_t>(state.range(0));
+    const size_t N = static_cast<size_t>(state.range(1));
+    const size_t K = static_cast<size_t>(state.range(2));
+
+    auto A = GenerateRandomBuffer<float>(M * K, -1.0f, 1.0f);
+    auto B = GenerateRandomBuffer<float>(K * N, -1.0f, 1.0f);
+    std::vector<float> C(M * N);
+
+    for (auto _ : state) {
+        MlasGemm(CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K,
+                 B.data(), N, 0.0f, C.data(), N, nullptr);
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(
+        2.0 * double(M) * double(N) * double(K),
+        benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::kIs1000);
+}
+
+static
+void
+GemmShapeSweep(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"M", "N", "K"});
+
+    // Transformer projection and feed forward shapes (batch 1, sequence
+    // lengths 128 and 384, hidden size 768).
+    b->Args({128, 768, 768});
+    b->Args({128, 3072, 768});
+    b->Args({128, 768, 3072});
+    b->Args({384, 768, 768});
+    b->Args({384, 3072, 768});
+    b->Args({384, 768, 3072});
+
+    // Square shapes for blocking parameter sweeps.
+    b->Args({256, 256, 256});
+    b->Args({512, 512, 512});
+    b->Args({1024, 1024, 1024});
+}
+
+BENCHMARK(BM_Sgemm)->Apply(GemmShapeSweep)->UseRealTime();
+
+//
+// Quantized integer matrix/matrix multiply.
+//
+
+static
+void
+BM_Qgemm(
+    benchmark::State& state
+    )
+{
+    const size_t M = static_cast<size_t>(state.range(0));
+    const size_t N = static_cast<size_t>(state.range(1));
+    const size_t K = static_cast<size_t>(state.range(2));
+
+    auto A = GenerateRandomBuffer<uint8_t>(M * K, 0.0f, 255.0f);
+    auto B = GenerateRandomBuffer<uint8_t>(K * N, 0.0f, 255.0f);
+    std::vector<int32_t> C(M * N);
+
+    for (auto _ : state) {
+        MlasGemm(M, N, K, A.data(), K, 12, B.data(), N, 34, false, C.data(),
+                 N, nullptr);
+    }
+
+    state.counters["OPS"] = benchmark::Counter(
+        2.0 * double(M) * double(N) * double(K),
+        benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::kIs1000);
+}
+
+BENCHMARK(BM_Qgemm)->Apply(GemmShapeSweep)->UseRealTime();
+
+//
+// Single precision convolution.
+//
+
+static
+void
+BM_Conv2D(
+    benchmark::State& state
+    )
+{
+    const int64_t InputChannels = state.range(0);
+    const int64_t InputSize = state.range(1);
+    const int64_t FilterCount = state.range(2);
+    const int64_t KernelSize = state.range(3);
+
+    // Pad 3x3 kernels to preserve the spatial shape, matching the residual
+    // network topologies the shapes are drawn from.
+    const int64_t Padding = (KernelSize - 1) / 2;
+    const int64_t OutputSize = InputSize + 2 * Padding - KernelSize + 1;
+
+    const int64_t InputShape[] = {InputSize, InputSize};
+    const int64_t KernelShape[] = {KernelSize, KernelSize};
+    const int64_t DilationShape[] = {1, 1};
+    const int64_t PaddingShape[] = {Padding, Padding, Padding, Padding};
+    const int64_t StrideShape[] = {1, 1};
+    const int64_t OutputShape[] = {OutputSize, OutputSize};
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = MlasIdentityActivation;
+
+    MLAS_CONV_PARAMETERS Parameters;
+    size_t WorkingBufferSize = 0;
+
+    MlasConvPrepare(&Parameters, 2, 1, 1, InputChannels, InputShape,
+                    KernelShape, DilationShape, PaddingShape, StrideShape,
+                    OutputShape, FilterCount, &Activation, &WorkingBufferSize,
+                    nullptr);
+
+    auto Input = GenerateRandomBuffer<float>(size_t(InputChannels * InputSize * InputSize), -1.0f, 1.0f);
+    auto Filter = GenerateRandomBuffer<float>(size_t(FilterCount * InputChannels * KernelSize * KernelSize), -1.0f, 1.0f);
+    std::vector<float> Output(size_t(FilterCount * OutputSize * OutputSize));
+    std::vector<float> WorkingBuffer(WorkingBufferSize);
+
+    for (auto _ : state) {
+        MlasConv(&Parameters, Input.data(), Filter.data(), nullptr,
+                 WorkingBuffer.data(), Output.data(), nullptr);
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(
+        2.0 * double(FilterCount) * double(InputChannels) *
+            double(KernelSize) * double(KernelSize) *
+            double(OutputSize) * double(OutputSize),
+        benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::kIs1000);
+}
+
+BENCHMARK(BM_Conv2D)
+    ->ArgNames({"C", "HW", "F", "KHW"})
+    // Residual network stage shapes.
+    ->Args({64, 56, 64, 3})
+    ->Args({64, 56, 256, 1})
+    ->Args({128, 28, 128, 3})
+    ->Args({256, 14, 256, 3})
+    ->Args({512, 7, 512, 3})
+    ->UseRealTime();
+
+//
+// NCHWc block reorders.
+//
+
+static
+void
+BM_ReorderInput(
+    benchmark::State& state
+    )
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    if (BlockSize <= 1) {
+        state.SkipWithError("NCHWc is not supported on this platform");
+        return;
+    }
+
+    const int64_t Channels = state.range(0);
+    const int64_t SpatialSize = state.range(1);
+
+    const int64_t AlignedChannels = (Channels + BlockSize - 1) / BlockSize * BlockSize;
+    const int64_t InputShape[] = {1, Channels, SpatialSize, SpatialSize};
+
+    auto S = GenerateRandomBuffer<float>(size_t(Channels * SpatialSize * SpatialSize), -1.0f, 1.0f);
+    std::vector<float> D(size_t(AlignedChannels * SpatialSize * SpatialSize));
+
+    for (auto _ : state) {
+        MlasReorderInput(InputShape, S.data(), D.data());
+    }
+
+    state.counters["bytes"] = benchmark::Counter(
+        double(S.size() + D.size()) * sizeof(float),
+        benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::kIs1024);
+}
+
+static
+void
+BM_ReorderOutputNchw(
+    benchmark::State& state
+    )
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    if (BlockSize <= 1) {
+        state.SkipWithError("NCHWc is not supported on this platform");
+        return;
+    }
+
+    const int64_t Channels = state.range(0);
+    const int64_t SpatialSize = state.range(1);
+
+    const int64_t AlignedChannels = (Channels + BlockSize - 1) / BlockSize * BlockSize;
+    const int64_t OutputShape[] = {1, Channels, SpatialSize, SpatialSize};
+
+    auto S = GenerateRandomBuffer<float>(size_t(AlignedChannels * SpatialSize * SpatialSize), -1.0f, 1.0f);
+    std::vector<float> D(size_t(Channels * SpatialSize * SpatialSize));
+
+    for (auto _ : state) {
+        MlasReorderOutputNchw(OutputShape, S.data(), D.data());
+    }
+
+    state.counters["bytes"] = benchmark::Counter(
+        double(S.size() + D.size()) * sizeof(float),
+        benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::kIs1024);
+}
+
+static
+void
+ReorderShapeSweep(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"C", "HW"});
+    b->Args({64, 112});
+    b->Args({128, 56});
+    b->Args({256, 28});
+    b->Args({512, 14});
+}
+
+BENCHMARK(BM_ReorderInput)->Apply(ReorderShapeSweep)->UseRealTime();
+BENCHMARK(BM_ReorderOutputNchw)->Apply(ReorderShapeSweep)->UseRealTime();
+
+//
+// Pins the MLAS_PLATFORM dispatch entries to a specific kernel tier.
+//
+
+static
+bool
+PinDispatch(
+    const std::string& name
+    )
+{
+#if defined(MLAS_TARGET_AMD64)
+    if (name == "sse") {
+        MlasPlatform.GemmFloatKernel = MlasGemmFloatKernelSse;
+        return true;
+    } else if (name == "avx") {
+        MlasPlatform.GemmFloatKernel = MlasGemmFloatKernelAvx;
+        return true;
+    } else if (name == "fma3") {
+        MlasPlatform.GemmFloatKernel = MlasGemmFloatKernelFma3;
+        return true;
+    } else if (name == "avx512f") {
+        MlasPlatform.GemmFloatKernel = MlasGemmFloatKernelAvx512F;
+        return true;
+    }
+#else
+    (void)name;
+#endif
+
+    return false;
+}
+
+int
+main(
+    int argc,
+    char** argv
+    )
+{
+    const std::string dispatch_prefix = "--dispatch=";
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.compare(0, dispatch_prefix.size(), dispatch_prefix) == 0) {
+            if (!PinDispatch(arg.substr(dispatch_prefix.size()))) {
+                fprintf(stderr, "unsupported dispatch tier: %s\n", arg.c_str());
+                return -1;
+            }
+            for (int j = i; j + 1 < argc; j++) {
+                argv[j] = argv[j + 1];
+            }
+            argc--;
+            i--;
+        }
+    }
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
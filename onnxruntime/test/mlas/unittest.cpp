@@ -15,8 +15,10 @@ Abstract:
 --*/
 
 #include <stdio.h>
+#include <math.h>
 #include <memory.h>
 #include <algorithm>
+#include <vector>
 #include <limits>
 #include <memory>
 #include <random>
@@ -527,6 +529,207 @@ public:
     }
 };
 
+class MlasFgemmBatchTest : public MlasTestBase
+{
+private:
+    void
+    Test(
+        size_t BatchCount,
+        size_t M,
+        size_t N,
+        size_t K,
+        float alpha,
+        float beta
+        )
+    {
+        Test(CblasNoTrans, CblasNoTrans, BatchCount, M, N, K, alpha, K, N, beta);
+        Test(CblasNoTrans, CblasTrans, BatchCount, M, N, K, alpha, K, K, beta);
+        Test(CblasTrans, CblasNoTrans, BatchCount, M, N, K, alpha, M, N, beta);
+        Test(CblasTrans, CblasTrans, BatchCount, M, N, K, alpha, M, K, beta);
+    }
+
+    void
+    Test(
+        CBLAS_TRANSPOSE TransA,
+        CBLAS_TRANSPOSE TransB,
+        size_t BatchCount,
+        size_t M,
+        size_t N,
+        size_t K,
+        float alpha,
+        size_t lda,
+        size_t ldb,
+        float beta
+        )
+    {
+        const size_t StrideA = M * K;
+        const size_t StrideB = K * N;
+        const size_t StrideC = M * N;
+
+        const float* A = BufferA.GetBuffer(BatchCount * StrideA);
+        const float* B = BufferB.GetBuffer(BatchCount * StrideB);
+        float* C = BufferC.GetBuffer(BatchCount * StrideC);
+        float* CReference = BufferCReference.GetBuffer(BatchCount * StrideC);
+
+        std::fill_n(C, BatchCount * StrideC, -0.5f);
+        std::fill_n(CReference, BatchCount * StrideC, -0.5f);
+
+        MlasGemmBatch(TransA, TransB, M, N, K, alpha, A, lda, StrideA, B, ldb, StrideB,
+            beta, C, N, StrideC, BatchCount, threadpool);
+
+        //
+        // The reference is the single matrix path, which the batched path
+        // must match exactly.
+        //
+
+        for (size_t batch = 0; batch < BatchCount; batch++) {
+            MlasGemm(TransA, TransB, M, N, K, alpha, A + batch * StrideA, lda,
+                B + batch * StrideB, ldb, beta, CReference + batch * StrideC, N, threadpool);
+        }
+
+        for (size_t f = 0; f < BatchCount * StrideC; f++) {
+            if (C[f] != CReference[f]) {
+                printf("mismatch TransA=%d, TransB=%d, BatchCount=%zd, M=%zd, N=%zd, K=%zd!\n", TransA, TransB, BatchCount, M, N, K);
+                break;
+            }
+        }
+    }
+
+    MatrixGuardBuffer<float> BufferA;
+    MatrixGuardBuffer<float> BufferB;
+    MatrixGuardBuffer<float> BufferC;
+    MatrixGuardBuffer<float> BufferCReference;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (size_t b = 1; b <= 5; b++) {
+            Test(b, 64, 64, 64, 1.0f, 0.0f);
+        }
+
+        Test(12, 64, 64, 64, 1.0f, 0.0f);
+        Test(96, 24, 24, 32, 1.0f, 0.0f);
+        Test(16, 128, 128, 96, 0.25f, 1.0f);
+        Test(3, 320, 16, 64, 1.0f, 0.5f);
+        Test(2, 512, 512, 64, 1.0f, 0.0f);
+    }
+};
+
+class MlasBf16GemmTest : public MlasTestBase
+{
+private:
+    void
+    Test(
+        size_t M,
+        size_t N,
+        size_t K,
+        float beta
+        )
+    {
+        const float* A = BufferA.GetBuffer(K * M);
+        const float* B = BufferB.GetBuffer(N * K);
+        float* C = BufferC.GetBuffer(N * M);
+        float* CReference = BufferCReference.GetBuffer(N * M);
+
+        std::fill_n(C, M * N, -0.5f);
+        std::fill_n(CReference, M * N, -0.5f);
+
+        size_t PackedBSize = MlasBf16GemmPackBSize(N, K);
+        uint16_t* PackedB = (uint16_t*)BufferBPacked.GetBuffer(PackedBSize / sizeof(uint16_t), true);
+        MlasBf16GemmConvertPackB(CblasNoTrans, N, K, B, N, PackedB);
+
+        MlasBf16Gemm(M, N, K, A, K, PackedB, beta, C, N, threadpool);
+        ReferenceGemm(M, N, K, A, K, B, N, beta, CReference, N);
+
+        for (size_t f = 0; f < M * N; f++) {
+            // The only difference from the reference is the accumulation
+            // order inside the dot product instruction.
+            float Tolerance = std::max(fabsf(CReference[f]) * 1e-4f, 1e-4f);
+            if (fabsf(C[f] - CReference[f]) > Tolerance) {
+                printf("mismatch M=%zd, N=%zd, K=%zd, beta=%f  %f %f!\n", M, N, K, beta, C[f], CReference[f]);
+                break;
+            }
+        }
+    }
+
+    void
+    ReferenceGemm(
+        size_t M,
+        size_t N,
+        size_t K,
+        const float* A,
+        size_t lda,
+        const float* B,
+        size_t ldb,
+        float beta,
+        float* C,
+        size_t ldc
+        )
+    {
+        //
+        // Round both inputs to bfloat16 the same way the implementation
+        // does before accumulating in single precision.
+        //
+
+        std::vector<uint16_t> ABf16(M * lda);
+        std::vector<uint16_t> BBf16(K * ldb);
+
+        MlasConvertFloatToBf16Buffer(A, ABf16.data(), ABf16.size());
+        MlasConvertFloatToBf16Buffer(B, BBf16.data(), BBf16.size());
+
+        std::vector<float> ARounded(ABf16.size());
+        std::vector<float> BRounded(BBf16.size());
+
+        MlasConvertBf16ToFloatBuffer(ABf16.data(), ARounded.data(), ARounded.size());
+        MlasConvertBf16ToFloatBuffer(BBf16.data(), BRounded.data(), BRounded.size());
+
+        for (size_t m = 0; m < M; m++) {
+
+            for (size_t n = 0; n < N; n++) {
+
+                float sum = 0.0f;
+
+                for (size_t k = 0; k < K; k++) {
+                    sum += ARounded[m * lda + k] * BRounded[k * ldb + n];
+                }
+
+                C[m * ldc + n] = (C[m * ldc + n] * beta) + sum;
+            }
+        }
+    }
+
+    MatrixGuardBuffer<float> BufferA;
+    MatrixGuardBuffer<float> BufferB;
+    MatrixGuardBuffer<uint16_t> BufferBPacked;
+    MatrixGuardBuffer<float> BufferC;
+    MatrixGuardBuffer<float> BufferCReference;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (size_t b = 1; b < 16; b++) {
+            Test(b, b, b, 0.0f);
+        }
+        for (size_t b = 16; b <= 256; b <<= 1) {
+            Test(b, b, b, 0.0f);
+        }
+        for (size_t b = 1; b < 96; b++) {
+            Test(1, b, 32, 0.0f);
+        }
+
+        Test(43, 500, 401, 0.0f);
+        Test(43, 500, 401, 1.0f);
+        Test(43, 500, 401, 0.25f);
+        Test(128, 3072, 768, 0.0f);
+    }
+};
+
 #ifdef MLAS_SUPPORTS_GEMM_U8X8
 
 template<bool Packed>
@@ -1237,6 +1440,13 @@ public:
             Test(1, 1, 16, i, i, 32, i, 1, 0, 0, 0, 0, 1, 1, 1, 1);
             Test(1, 1, 16, i, i, 32, 1, i, 0, 0, 0, 0, 1, 1, 1, 1);
         }
+
+        for (unsigned i = 1; i < 64; i <<= 1) {
+            Test(1, 16, 1, i, i, 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1);
+            Test(1, 16, 1, i, i, 1, 3, 3, 0, 1, 0, 1, 1, 1, 2, 2);
+            Test(1, 16, 1, i, i, 1, 3, 3, 2, 2, 2, 2, 2, 2, 1, 1);
+            Test(2, 24, 1, i, i, 1, 5, 5, 2, 2, 2, 2, 1, 1, 1, 1);
+        }
     }
 
     void
@@ -1292,6 +1502,130 @@ public:
     }
 };
 
+class MlasWinogradConv2DTest : public MlasTestBase
+{
+private:
+    void
+    Test(
+        size_t BatchCount,
+        size_t GroupCount,
+        size_t InputChannels,
+        size_t InputHeight,
+        size_t InputWidth,
+        size_t FilterCount,
+        size_t PaddingHeight,
+        size_t PaddingWidth
+        )
+    {
+        const size_t OutputHeight = InputHeight + 2 * PaddingHeight - 2;
+        const size_t OutputWidth = InputWidth + 2 * PaddingWidth - 2;
+
+        const size_t InputSize = InputHeight * InputWidth;
+        const size_t OutputSize = OutputHeight * OutputWidth;
+
+        const float* Input = BufferInput.GetBuffer(BatchCount * GroupCount * InputChannels * InputSize);
+        const float* Filter = BufferFilter.GetBuffer(GroupCount * FilterCount * InputChannels * 9);
+        const float* Bias = BufferBias.GetBuffer(GroupCount * FilterCount);
+        float* Output = BufferOutput.GetBuffer(BatchCount * GroupCount * FilterCount * OutputSize);
+        float* OutputReference = BufferOutputReference.GetBuffer(BatchCount * GroupCount * FilterCount * OutputSize);
+
+        int64_t InputShape[] = { int64_t(InputHeight), int64_t(InputWidth) };
+        int64_t KernelShape[] = { 3, 3 };
+        int64_t DilationShape[] = { 1, 1 };
+        int64_t Padding[] = { int64_t(PaddingHeight), int64_t(PaddingWidth), int64_t(PaddingHeight), int64_t(PaddingWidth) };
+        int64_t StrideShape[] = { 1, 1 };
+        int64_t OutputShape[] = { int64_t(OutputHeight), int64_t(OutputWidth) };
+
+        MLAS_ACTIVATION Activation;
+        Activation.ActivationKind = MlasIdentityActivation;
+
+        MLAS_CONV_PARAMETERS Parameters;
+        size_t WorkingBufferSize;
+
+        MlasConvPrepare(&Parameters,
+                        2,
+                        BatchCount,
+                        GroupCount,
+                        InputChannels,
+                        InputShape,
+                        KernelShape,
+                        DilationShape,
+                        Padding,
+                        StrideShape,
+                        OutputShape,
+                        FilterCount,
+                        &Activation,
+                        &WorkingBufferSize,
+                        nullptr);
+
+        if (!MlasConvWinogradApplicable(&Parameters)) {
+            printf("winograd not applicable: input(%zd,%zd,%zd), filter=%zd!\n",
+                InputChannels, InputHeight, InputWidth, FilterCount);
+            return;
+        }
+
+        float* TransformedFilter = BufferTransformedFilter.GetBuffer(
+            MlasConvWinogradFilterBufferSize(GroupCount, FilterCount, InputChannels));
+        MlasConvWinogradTransformFilter(Filter, GroupCount, FilterCount, InputChannels, TransformedFilter);
+
+        MlasConvWinograd(&Parameters,
+                         Input,
+                         TransformedFilter,
+                         Bias,
+                         BufferWorking.GetBuffer(MlasConvWinogradWorkingBufferSize(&Parameters)),
+                         Output,
+                         threadpool);
+
+        //
+        // Compare against the expand then GEMM path, which the Winograd
+        // transform matches up to reassociated arithmetic.
+        //
+
+        MlasConv(&Parameters,
+                 Input,
+                 Filter,
+                 Bias,
+                 BufferWorking.GetBuffer(WorkingBufferSize),
+                 OutputReference,
+                 threadpool);
+
+        for (size_t f = 0; f < BatchCount * GroupCount * FilterCount * OutputSize; f++) {
+            if (fabsf(Output[f] - OutputReference[f]) > std::max(fabsf(OutputReference[f]) * 1e-4f, 1e-3f)) {
+                printf("mismatch: batch=%zd,group=%zd,input(%zd,%zd,%zd),filter=%zd  %f %f!\n",
+                    BatchCount, GroupCount, InputChannels, InputHeight, InputWidth, FilterCount,
+                    Output[f], OutputReference[f]);
+                break;
+            }
+        }
+    }
+
+    MatrixGuardBuffer<float> BufferInput;
+    MatrixGuardBuffer<float> BufferFilter;
+    MatrixGuardBuffer<float> BufferTransformedFilter;
+    MatrixGuardBuffer<float> BufferBias;
+    MatrixGuardBuffer<float> BufferOutput;
+    MatrixGuardBuffer<float> BufferOutputReference;
+    MatrixGuardBuffer<float> BufferWorking;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (unsigned i = 16; i <= 64; i <<= 1) {
+            Test(1, 1, 16, i, i, 32, 0, 0);
+            Test(1, 1, 16, i, i, 32, 1, 1);
+            Test(1, 1, 32, i + 1, i + 1, 16, 1, 1);
+            Test(2, 1, 16, i, i + 3, 16, 1, 0);
+        }
+
+        Test(1, 2, 16, 14, 14, 32, 1, 1);
+        Test(1, 1, 64, 7, 9, 64, 1, 1);
+        Test(4, 1, 16, 28, 28, 48, 1, 1);
+    }
+};
+
 class MlasNchwcConv2DTest : public MlasConv2DTest
 {
 protected:
@@ -2564,6 +2898,89 @@ public:
     }
 };
 
+class MlasFp16ConversionTest : public MlasTestBase
+{
+private:
+    MatrixGuardBuffer<unsigned short> BufferHalf;
+    MatrixGuardBuffer<float> BufferFloat;
+    MatrixGuardBuffer<unsigned short> BufferHalfRoundTrip;
+
+    static
+    float
+    ReferenceHalfToFloat(
+        unsigned short Value
+        )
+    {
+        const uint32_t Exponent = (Value >> 10) & 0x1F;
+        const uint32_t Mantissa = Value & 0x3FF;
+        float Float32;
+
+        if (Exponent == 31) {
+            Float32 = (Mantissa == 0) ? std::numeric_limits<float>::infinity()
+                                      : std::numeric_limits<float>::quiet_NaN();
+        } else if (Exponent == 0) {
+            Float32 = std::ldexp(float(Mantissa), -24);
+        } else {
+            Float32 = std::ldexp(float(Mantissa + 1024), int(Exponent) - 25);
+        }
+
+        return (Value & 0x8000) ? -Float32 : Float32;
+    }
+
+    void
+    Test(
+        void
+        )
+    {
+        constexpr size_t N = 0x10000;
+
+        unsigned short* Half = BufferHalf.GetBuffer(N);
+        float* Float = BufferFloat.GetBuffer(N);
+        unsigned short* HalfRoundTrip = BufferHalfRoundTrip.GetBuffer(N);
+
+        //
+        // Convert every half-precision bit pattern and verify the result,
+        // then convert back and verify that every non-NaN pattern (including
+        // the denormals and both signed zeros) survives the round trip.
+        //
+
+        for (size_t n = 0; n < N; n++) {
+            Half[n] = (unsigned short)n;
+        }
+
+        MlasConvertHalfToFloatBuffer(Half, Float, N);
+
+        for (size_t n = 0; n < N; n++) {
+            float Reference = ReferenceHalfToFloat(Half[n]);
+            if (Float[n] != Reference && !(std::isnan(Float[n]) && std::isnan(Reference))) {
+                printf("half to float difference: %04x %.8f %.8f\n", unsigned(Half[n]), Float[n], Reference);
+            }
+        }
+
+        MlasConvertFloatToHalfBuffer(Float, HalfRoundTrip, N);
+
+        for (size_t n = 0; n < N; n++) {
+            if ((Half[n] & 0x7FFF) > 0x7C00) {
+                // NaN payloads are not required to round trip exactly.
+                if ((HalfRoundTrip[n] & 0x7C00) != 0x7C00 || (HalfRoundTrip[n] & 0x3FF) == 0) {
+                    printf("float to half NaN difference: %04x %04x\n", unsigned(Half[n]), unsigned(HalfRoundTrip[n]));
+                }
+            } else if (HalfRoundTrip[n] != Half[n]) {
+                printf("float to half difference: %04x %04x\n", unsigned(Half[n]), unsigned(HalfRoundTrip[n]));
+            }
+        }
+    }
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        Test();
+    }
+};
+
 class MlasQLinearBinaryOpTest : public MlasTestBase
 {
 public:
@@ -2715,6 +3132,22 @@ public:
     }
 };
 
+// MlasQLinearSub takes an extra IsScalarA flag as subtract is not commutative;
+// bind it to false so the test harness signature matches the other binary ops.
+template <typename T>
+static
+void
+MLASCALL
+MlasQLinearSubVectorA(
+    const T* InputA, float ScaleA, int32_t ZeroPointA,
+    const T* InputB, float ScaleB, int32_t ZeroPointB,
+    float ScaleC, int32_t ZeroPointC, T* OutputC,
+    size_t N, bool IsScalarB)
+{
+    MlasQLinearSub<T>(InputA, ScaleA, ZeroPointA, InputB, ScaleB, ZeroPointB,
+                      ScaleC, ZeroPointC, OutputC, N, false, IsScalarB);
+}
+
 class MlasQLinearGlobalAveragePoolU8Test : public MlasTestBase {
 private:
     MatrixGuardBuffer<uint8_t> BufferInput;
@@ -2942,6 +3375,77 @@ public:
     }
 };
 
+class MlasDynamicQuantizeLinearTest : public MlasTestBase
+{
+private:
+    MatrixGuardBuffer<float> BufferInput;
+    MatrixGuardBuffer<uint8_t> BufferOutput;
+    MatrixGuardBuffer<uint8_t> BufferOutputRef;
+
+    void
+    Test(
+        size_t N,
+        float MinimumValue,
+        float MaximumValue
+        )
+    {
+        float* Input = BufferInput.GetBuffer(N);
+        uint8_t* Output = BufferOutput.GetBuffer(N);
+        uint8_t* OutputRef = BufferOutputRef.GetBuffer(N);
+
+        std::default_random_engine generator(static_cast<unsigned>(N));
+        std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+        for (size_t n = 0; n < N; n++) {
+            Input[n] = distribution(generator);
+        }
+
+        auto min_max_pair = std::minmax_element(Input, Input + N);
+        float min_ref = std::min(*min_max_pair.first, 0.0f);
+        float max_ref = std::max(*min_max_pair.second, 0.0f);
+
+        constexpr float qmin = 0.0f;
+        constexpr float qmax = 255.0f;
+        float scale_ref = (max_ref == min_ref) ? 1.0f : (max_ref - min_ref) / (qmax - qmin);
+        float zero_point_fp = std::min(qmax, std::max(qmin, qmin - min_ref / scale_ref));
+        uint8_t zero_point_ref = (uint8_t)(int32_t)std::nearbyintf(zero_point_fp);
+        MlasQuantizeLinear(Input, OutputRef, N, scale_ref, zero_point_ref);
+
+        float scale;
+        uint8_t zero_point;
+        MlasDynamicQuantizeLinear(Input, Output, N, &scale, &zero_point);
+
+        if (scale != scale_ref) {
+            printf("scale difference: %.8f %.8f\n", scale, scale_ref);
+        }
+
+        if (zero_point != zero_point_ref) {
+            printf("zero point difference: %d %d\n", int(zero_point), int(zero_point_ref));
+        }
+
+        for (size_t n = 0; n < N; n++) {
+            if (Output[n] != OutputRef[n]) {
+                printf("output difference: size=%u, index=%u, value=%d, expected=%d\n",
+                       unsigned(N), unsigned(n), int(Output[n]), int(OutputRef[n]));
+                break;
+            }
+        }
+    }
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (size_t n = 1; n < 128; n++) {
+            Test(n, -10.f, 10.f);
+            Test(n, 1.f, 10.f);
+            Test(n, -10.f, -1.f);
+        }
+    }
+};
+
 class MlasScaleOutputTest : public MlasTestBase
 {
 private:
@@ -3042,6 +3546,12 @@ RunThreadedTests(
     onnxruntime::make_unique<MlasFgemmTest<double, false>>()->ExecuteShort();
 #endif
 
+    printf("Batched SGEMM tests.\n");
+    onnxruntime::make_unique<MlasFgemmBatchTest>()->ExecuteShort();
+
+    printf("BF16 GEMM tests (%s).\n", MlasBf16AccelerationSupported() ? "native" : "emulated");
+    onnxruntime::make_unique<MlasBf16GemmTest>()->ExecuteShort();
+
 #ifdef MLAS_SUPPORTS_GEMM_U8X8
     printf("QGEMM U8S8=int32_t tests.\n");
     onnxruntime::make_unique<MlasQgemmU8X8Test<int8_t, int32_t, false>>()->ExecuteShort();
@@ -3070,6 +3580,7 @@ RunThreadedTests(
 
     printf("Conv2D tests.\n");
     onnxruntime::make_unique<MlasConv2DTest>()->ExecuteShort();
+    onnxruntime::make_unique<MlasWinogradConv2DTest>()->ExecuteShort();
     if (MlasNchwcGetBlockSize() > 1) {
         onnxruntime::make_unique<MlasNchwcConv2DTest>()->ExecuteShort();
     }
@@ -3129,6 +3640,12 @@ main(
     printf("MinMaxElements tests.\n");
     onnxruntime::make_unique<MlasFindMinMaxElementsTest>()->ExecuteShort();
 
+    printf("DynamicQuantizeLinear tests.\n");
+    onnxruntime::make_unique<MlasDynamicQuantizeLinearTest>()->ExecuteShort();
+
+    printf("Half-precision conversion tests.\n");
+    onnxruntime::make_unique<MlasFp16ConversionTest>()->ExecuteShort();
+
     printf("ReorderOutput tests.\n");
     if (MlasNchwcGetBlockSize() > 1) {
         onnxruntime::make_unique<MlasReorderOutputTest>()->ExecuteShort();
@@ -3142,6 +3659,18 @@ main(
     onnxruntime::make_unique<MlasQLinearBinaryOpTest>(
         [](float a, float b) { return a * b; }, "*", MlasQLinearMul<int8_t>, MlasQLinearMul<uint8_t>)->ExecuteShort();
 
+    printf("QLinearSub tests.\n");
+    onnxruntime::make_unique<MlasQLinearBinaryOpTest>(
+        [](float a, float b) { return a - b; }, "-", MlasQLinearSubVectorA<int8_t>, MlasQLinearSubVectorA<uint8_t>)->ExecuteShort();
+
+    printf("QLinearMin tests.\n");
+    onnxruntime::make_unique<MlasQLinearBinaryOpTest>(
+        [](float a, float b) { return std::min(a, b); }, "min", MlasQLinearMin<int8_t>, MlasQLinearMin<uint8_t>)->ExecuteShort();
+
+    printf("QLinearMax tests.\n");
+    onnxruntime::make_unique<MlasQLinearBinaryOpTest>(
+        [](float a, float b) { return std::max(a, b); }, "max", MlasQLinearMax<int8_t>, MlasQLinearMax<uint8_t>)->ExecuteShort();
+
     printf("MlasScaleOutput tests.\n");
     onnxruntime::make_unique<MlasScaleOutputTest>()->ExecuteShort();
 
@@ -0,0 +1,121 @@
+#include "common.h"
+
+#include <benchmark/benchmark.h>
+#include <mlas.h>
+
+// Matched fp32 vs quantized kernel benchmarks. Each quantized benchmark has a
+// fp32 counterpart with the same name prefix and argument list, so the
+// per-shape speedup of the int8 path can be read directly from the output
+// table. The GEMM shapes cover the projection and feed-forward layers of
+// transformer encoders along with pointwise convolutions lowered to GEMM, the
+// same lowering used by the QLinearConv and MatMulInteger kernels. All
+// benchmarks run single threaded to isolate the kernel throughput from the
+// thread pool partitioning.
+
+static void BM_GemmFp32(benchmark::State& state) {
+  const size_t M = static_cast<size_t>(state.range(0));
+  const size_t N = static_cast<size_t>(state.range(1));
+  const size_t K = static_cast<size_t>(state.range(2));
+
+  float* A = GenerateArrayWithRandomValue<float>(M * K, -1, 1);
+  float* B = GenerateArrayWithRandomValue<float>(K * N, -1, 1);
+  float* C = (float*)aligned_alloc(sizeof(float) * M * N, 64);
+
+  for (auto _ : state) {
+    MlasGemm(CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A, K, B, N, 0.0f, C, N, nullptr);
+  }
+
+  aligned_free(A);
+  aligned_free(B);
+  aligned_free(C);
+}
+
+static void BM_GemmU8X8(benchmark::State& state, bool b_is_signed) {
+  const size_t M = static_cast<size_t>(state.range(0));
+  const size_t N = static_cast<size_t>(state.range(1));
+  const size_t K = static_cast<size_t>(state.range(2));
+
+  uint8_t* A = GenerateArrayWithRandomValue<uint8_t>(M * K, 0, 255);
+  uint8_t* B = GenerateArrayWithRandomValue<uint8_t>(K * N, 0, b_is_signed ? 127 : 255);
+  int32_t* C = (int32_t*)aligned_alloc(sizeof(int32_t) * M * N, 64);
+
+  for (auto _ : state) {
+    MlasGemm(M, N, K, A, K, 121, B, N, 114, b_is_signed, C, N, nullptr);
+  }
+
+  aligned_free(A);
+  aligned_free(B);
+  aligned_free(C);
+}
+
+static void BM_GemmU8U8(benchmark::State& state) {
+  BM_GemmU8X8(state, false);
+}
+
+static void BM_GemmU8S8(benchmark::State& state) {
+  BM_GemmU8X8(state, true);
+}
+
+#define GEMM_BENCHMARK_SHAPES                \
+  ->ArgNames({"M", "N", "K"})                \
+      ->Args({128, 768, 768})                \
+      ->Args({128, 3072, 768})               \
+      ->Args({384, 768, 768})                \
+      ->Args({384, 3072, 768})               \
+      ->Args({3136, 64, 64})                 \
+      ->Args({784, 128, 128})                \
+      ->Args({196, 256, 256})                \
+      ->UseRealTime()                        \
+      ->Unit(benchmark::TimeUnit::kMicrosecond)
+
+BENCHMARK(BM_GemmFp32) GEMM_BENCHMARK_SHAPES;
+BENCHMARK(BM_GemmU8U8) GEMM_BENCHMARK_SHAPES;
+BENCHMARK(BM_GemmU8S8) GEMM_BENCHMARK_SHAPES;
+
+static void BM_GlobalAveragePoolFp32(benchmark::State& state) {
+  const int64_t channels = state.range(0);
+  const int64_t image_size = state.range(1);
+
+  const int64_t input_shape[] = {1, channels, image_size, 1};
+  const int64_t output_shape[] = {1, channels, 1, 1};
+
+  float* input = GenerateArrayWithRandomValue<float>(static_cast<size_t>(channels * image_size), -1, 1);
+  float* output = (float*)aligned_alloc(sizeof(float) * channels, 64);
+
+  for (auto _ : state) {
+    MlasPool(MlasAveragePoolingExcludePad, 2, input_shape, nullptr, nullptr, nullptr,
+             output_shape, input, output, nullptr);
+  }
+
+  aligned_free(input);
+  aligned_free(output);
+}
+
+static void BM_GlobalAveragePoolU8(benchmark::State& state) {
+  const size_t channels = static_cast<size_t>(state.range(0));
+  const size_t image_size = static_cast<size_t>(state.range(1));
+
+  uint8_t* input = GenerateArrayWithRandomValue<uint8_t>(channels * image_size, 0, 255);
+  uint8_t* output = (uint8_t*)aligned_alloc(sizeof(uint8_t) * channels, 64);
+  int32_t* accumulate_buffer = (int32_t*)aligned_alloc(sizeof(int32_t) * channels, 64);
+
+  for (auto _ : state) {
+    MlasQLinearGlobalAveragePoolNchw(input, 1.0f / 32.0f, 121, output, 1.0f / 64.0f, 114,
+                                     channels, image_size, accumulate_buffer);
+  }
+
+  aligned_free(input);
+  aligned_free(output);
+  aligned_free(accumulate_buffer);
+}
+
+#define POOL_BENCHMARK_SHAPES                \
+  ->ArgNames({"Channels", "ImageSize"})      \
+      ->Args({1280, 49})                     \
+      ->Args({2048, 49})                     \
+      ->Args({512, 196})                     \
+      ->UseRealTime()                        \
+      ->Unit(benchmark::TimeUnit::kMicrosecond)
+
+BENCHMARK(BM_GlobalAveragePoolFp32) POOL_BENCHMARK_SHAPES;
+BENCHMARK(BM_GlobalAveragePoolU8) POOL_BENCHMARK_SHAPES;
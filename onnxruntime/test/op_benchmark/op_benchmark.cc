@@ -0,0 +1,690 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Benchmarks individual kernels from a JSON corpus of shape/attribute configs.
+//
+// Each config names an op and the shapes, element types and attributes to run it with.
+// The tool builds a single-node model per config, so the kernel is resolved through the
+// regular kernel registries exactly as it would be in a full model, and reports time and
+// bandwidth per config through google benchmark.
+//
+//   onnxruntime_op_benchmark --corpus configs.json [benchmark options]
+//
+// A capture mode turns a production model into such a corpus. Shapes come from a node
+// timing cache file recorded during real Runs (see kOrtSessionOptionsConfigNodeTimingCachePath),
+// so dynamic dimensions get the values production traffic actually used; nodes absent from
+// the cache fall back to the static shapes in the model, if fully known.
+//
+//   onnxruntime_op_benchmark --capture model.onnx --timing_cache timings.txt --corpus configs.json
+//
+// Float inputs are filled with uniform random data and integer inputs with zeros, so
+// kernels whose cost or validity depends on input values (e.g. indices) may need a
+// hand-curated config.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/make_unique.h"
+#include "core/common/path_string.h"
+#include "core/framework/allocator.h"
+#include "core/framework/data_types.h"
+#include "core/framework/node_timing_cache.h"
+#include "core/framework/tensor.h"
+#include "core/graph/graph.h"
+#include "core/graph/model.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/session/environment.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_c_api.h"
+#include "core/session/ort_env.h"
+#include "onnx/defs/schema.h"
+
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning(disable : 28020)
+#endif
+#include "single_include/nlohmann/json.hpp"
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+
+using json = nlohmann::json;
+using namespace onnxruntime;
+
+namespace {
+
+const OrtApi* g_ort = OrtGetApiBase()->GetApi(ORT_API_VERSION);
+OrtEnv* env = nullptr;
+
+struct InputSpec {
+  int32_t elem_type{ONNX_NAMESPACE::TensorProto_DataType_FLOAT};
+  std::vector<int64_t> shape;
+};
+
+struct OpConfig {
+  std::string op_type;
+  std::string domain;
+  int opset{12};
+  std::vector<InputSpec> inputs;
+  // applied to the node after it is added, mirroring how OpTester handles attributes
+  std::vector<std::function<void(Node&)>> attribute_appliers;
+};
+
+// element types the tool can generate input data for
+bool ElementTypeFromString(const std::string& name, int32_t& elem_type) {
+  static const std::unordered_map<std::string, int32_t> types = {
+      {"float", ONNX_NAMESPACE::TensorProto_DataType_FLOAT},
+      {"double", ONNX_NAMESPACE::TensorProto_DataType_DOUBLE},
+      {"int8", ONNX_NAMESPACE::TensorProto_DataType_INT8},
+      {"uint8", ONNX_NAMESPACE::TensorProto_DataType_UINT8},
+      {"int16", ONNX_NAMESPACE::TensorProto_DataType_INT16},
+      {"uint16", ONNX_NAMESPACE::TensorProto_DataType_UINT16},
+      {"int32", ONNX_NAMESPACE::TensorProto_DataType_INT32},
+      {"int64", ONNX_NAMESPACE::TensorProto_DataType_INT64},
+      {"bool", ONNX_NAMESPACE::TensorProto_DataType_BOOL},
+  };
+  auto it = types.find(name);
+  if (it == types.end()) {
+    return false;
+  }
+
+  elem_type = it->second;
+  return true;
+}
+
+const char* ElementTypeToString(int32_t elem_type) {
+  switch (elem_type) {
+    case ONNX_NAMESPACE::TensorProto_DataType_FLOAT:
+      return "float";
+    case ONNX_NAMESPACE::TensorProto_DataType_DOUBLE:
+      return "double";
+    case ONNX_NAMESPACE::TensorProto_DataType_INT8:
+      return "int8";
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT8:
+      return "uint8";
+    case ONNX_NAMESPACE::TensorProto_DataType_INT16:
+      return "int16";
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT16:
+      return "uint16";
+    case ONNX_NAMESPACE::TensorProto_DataType_INT32:
+      return "int32";
+    case ONNX_NAMESPACE::TensorProto_DataType_INT64:
+      return "int64";
+    case ONNX_NAMESPACE::TensorProto_DataType_BOOL:
+      return "bool";
+    default:
+      return nullptr;
+  }
+}
+
+template <typename T>
+void MakeTensorValue(const std::vector<int64_t>& dims, const AllocatorPtr& allocator, bool randomize,
+                     OrtValue& value) {
+  auto p_tensor = onnxruntime::make_unique<Tensor>(DataTypeImpl::GetType<T>(), TensorShape(dims), allocator);
+  T* data = p_tensor->MutableData<T>();
+  const int64_t size = p_tensor->Shape().Size();
+  if (randomize) {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    for (int64_t i = 0; i < size; ++i) {
+      data[i] = static_cast<T>(distribution(generator));
+    }
+  } else {
+    std::fill(data, data + size, T{});
+  }
+
+  value.Init(p_tensor.release(), DataTypeImpl::GetType<Tensor>(), DataTypeImpl::GetType<Tensor>()->GetDeleteFunc());
+}
+
+Status MakeInputValue(const InputSpec& spec, const AllocatorPtr& allocator, OrtValue& value) {
+  switch (spec.elem_type) {
+    case ONNX_NAMESPACE::TensorProto_DataType_FLOAT:
+      MakeTensorValue<float>(spec.shape, allocator, true, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_DOUBLE:
+      MakeTensorValue<double>(spec.shape, allocator, true, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT8:
+      MakeTensorValue<int8_t>(spec.shape, allocator, false, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT8:
+      MakeTensorValue<uint8_t>(spec.shape, allocator, false, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT16:
+      MakeTensorValue<int16_t>(spec.shape, allocator, false, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT16:
+      MakeTensorValue<uint16_t>(spec.shape, allocator, false, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT32:
+      MakeTensorValue<int32_t>(spec.shape, allocator, false, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT64:
+      MakeTensorValue<int64_t>(spec.shape, allocator, false, value);
+      break;
+    case ONNX_NAMESPACE::TensorProto_DataType_BOOL:
+      MakeTensorValue<bool>(spec.shape, allocator, false, value);
+      break;
+    default:
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Unsupported input element type: ", spec.elem_type);
+  }
+
+  return Status::OK();
+}
+
+std::string ConfigName(const OpConfig& config) {
+  std::ostringstream oss;
+  oss << config.op_type << '/';
+  for (size_t i = 0; i < config.inputs.size(); ++i) {
+    if (i > 0) {
+      oss << ';';
+    }
+    oss << TensorShape(config.inputs[i].shape).ToString();
+  }
+
+  return oss.str();
+}
+
+Status BuildSingleNodeModel(const OpConfig& config, const logging::Logger& logger,
+                            std::unique_ptr<Model>& model) {
+  const auto* schema = ONNX_NAMESPACE::OpSchemaRegistry::Schema(config.op_type, config.opset, config.domain);
+  if (schema == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "No schema for op '", config.op_type,
+                           "' in domain '", config.domain, "' at opset ", config.opset);
+  }
+
+  std::unordered_map<std::string, int> domain_to_version{{config.domain, config.opset}};
+  model = onnxruntime::make_unique<Model>("op_benchmark", false, ModelMetaData(), PathString(),
+                                          IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                          std::vector<ONNX_NAMESPACE::FunctionProto>{}, logger);
+  Graph& graph = model->MainGraph();
+
+  std::vector<NodeArg*> input_defs;
+  for (size_t i = 0; i < config.inputs.size(); ++i) {
+    ONNX_NAMESPACE::TypeProto type_proto;
+    type_proto.mutable_tensor_type()->set_elem_type(config.inputs[i].elem_type);
+    auto* shape_proto = type_proto.mutable_tensor_type()->mutable_shape();
+    for (int64_t dim : config.inputs[i].shape) {
+      shape_proto->add_dim()->set_dim_value(dim);
+    }
+
+    input_defs.push_back(&graph.GetOrCreateNodeArg(MakeString("input_", i), &type_proto));
+  }
+
+  // output types and shapes are filled in by shape inference during Resolve
+  std::vector<NodeArg*> output_defs;
+  const int output_count = std::max(1, schema->min_output());
+  for (int i = 0; i < output_count; ++i) {
+    output_defs.push_back(&graph.GetOrCreateNodeArg(MakeString("output_", i), nullptr));
+  }
+
+  Node& node = graph.AddNode("node", config.op_type, "benchmarked node", input_defs, output_defs,
+                             nullptr, config.domain);
+  for (const auto& apply_attribute : config.attribute_appliers) {
+    apply_attribute(node);
+  }
+
+  return graph.Resolve();
+}
+
+struct PreparedOp {
+  std::unique_ptr<InferenceSession> session;
+  NameMLValMap feeds;
+  std::vector<std::string> output_names;
+  int64_t bytes_per_run{0};
+};
+
+Status PrepareOp(const OpConfig& config, std::shared_ptr<PreparedOp>& prepared) {
+  auto logger = env->GetLoggingManager()->CreateLogger("op_benchmark");
+
+  std::unique_ptr<Model> model;
+  ORT_RETURN_IF_ERROR(BuildSingleNodeModel(config, *logger, model));
+
+  std::string model_bytes;
+  if (!model->ToProto().SerializeToString(&model_bytes)) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to serialize the benchmark model.");
+  }
+
+  SessionOptions so;
+  so.session_logid = "op_benchmark";
+  // keep optimizations off so the exact kernel named by the config is what runs
+  so.graph_optimization_level = TransformerLevel::Default;
+
+  prepared = std::make_shared<PreparedOp>();
+  prepared->session = onnxruntime::make_unique<InferenceSession>(so, env->GetEnvironment());
+
+  std::stringstream model_stream(model_bytes);
+  ORT_RETURN_IF_ERROR(prepared->session->Load(model_stream));
+  ORT_RETURN_IF_ERROR(prepared->session->Initialize());
+
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  for (size_t i = 0; i < config.inputs.size(); ++i) {
+    OrtValue value;
+    ORT_RETURN_IF_ERROR(MakeInputValue(config.inputs[i], allocator, value));
+    prepared->bytes_per_run += static_cast<int64_t>(value.Get<Tensor>().SizeInBytes());
+    prepared->feeds.emplace(MakeString("input_", i), value);
+  }
+
+  for (const NodeArg* output : model->MainGraph().GetOutputs()) {
+    prepared->output_names.push_back(output->Name());
+  }
+
+  // warmup run: settles lazy initialization and provides the output sizes for bandwidth
+  RunOptions run_options;
+  std::vector<OrtValue> fetches;
+  ORT_RETURN_IF_ERROR(prepared->session->Run(run_options, prepared->feeds, prepared->output_names, &fetches));
+  for (const OrtValue& fetch : fetches) {
+    if (fetch.IsTensor()) {
+      prepared->bytes_per_run += static_cast<int64_t>(fetch.Get<Tensor>().SizeInBytes());
+    }
+  }
+
+  return Status::OK();
+}
+
+void RunOpBenchmark(benchmark::State& state, std::shared_ptr<PreparedOp> op) {
+  RunOptions run_options;
+  std::vector<OrtValue> fetches;
+  for (auto _ : state) {
+    fetches.clear();
+    auto status = op->session->Run(run_options, op->feeds, op->output_names, &fetches);
+    if (!status.IsOK()) {
+      state.SkipWithError(status.ErrorMessage().c_str());
+      break;
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * op->bytes_per_run);
+}
+
+//
+// Corpus parsing
+//
+
+bool ParseAttribute(const std::string& name, const json& value, OpConfig& config) {
+  if (value.is_number_integer()) {
+    int64_t v = value.get<int64_t>();
+    config.attribute_appliers.push_back([name, v](Node& node) { node.AddAttribute(name, v); });
+  } else if (value.is_number_float()) {
+    float v = value.get<float>();
+    config.attribute_appliers.push_back([name, v](Node& node) { node.AddAttribute(name, v); });
+  } else if (value.is_string()) {
+    std::string v = value.get<std::string>();
+    config.attribute_appliers.push_back([name, v](Node& node) { node.AddAttribute(name, v); });
+  } else if (value.is_array() && std::all_of(value.begin(), value.end(),
+                                             [](const json& e) { return e.is_number_integer(); })) {
+    std::vector<int64_t> v = value.get<std::vector<int64_t>>();
+    config.attribute_appliers.push_back([name, v](Node& node) { node.AddAttribute(name, v); });
+  } else if (value.is_array() && std::all_of(value.begin(), value.end(),
+                                             [](const json& e) { return e.is_number(); })) {
+    std::vector<float> v = value.get<std::vector<float>>();
+    config.attribute_appliers.push_back([name, v](Node& node) { node.AddAttribute(name, v); });
+  } else if (value.is_array() && std::all_of(value.begin(), value.end(),
+                                             [](const json& e) { return e.is_string(); })) {
+    std::vector<std::string> v = value.get<std::vector<std::string>>();
+    config.attribute_appliers.push_back([name, v](Node& node) { node.AddAttribute(name, v); });
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+Status LoadCorpus(const std::string& path, std::vector<OpConfig>& configs) {
+  std::ifstream file(path);
+  if (!file) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to open corpus file: ", path);
+  }
+
+  json corpus;
+  ORT_TRY {
+    file >> corpus;
+  }
+  ORT_CATCH(const std::exception& e) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to parse corpus file ", path, ": ", e.what());
+  }
+
+  if (!corpus.is_array()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Corpus file must contain a JSON array of configs.");
+  }
+
+  for (const json& entry : corpus) {
+    OpConfig config;
+    if (!entry.contains("op_type") || !entry["op_type"].is_string()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Every config needs an \"op_type\" string.");
+    }
+    config.op_type = entry["op_type"].get<std::string>();
+    config.domain = entry.value("domain", std::string());
+    config.opset = entry.value("opset", 12);
+
+    if (!entry.contains("inputs") || !entry["inputs"].is_array() || entry["inputs"].empty()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Config for '", config.op_type,
+                             "' needs a non-empty \"inputs\" array.");
+    }
+
+    for (const json& input : entry["inputs"]) {
+      InputSpec spec;
+      const std::string type_name = input.value("type", std::string("float"));
+      if (!ElementTypeFromString(type_name, spec.elem_type)) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unsupported input type '", type_name, "' for '",
+                               config.op_type, "'.");
+      }
+      if (!input.contains("shape") || !input["shape"].is_array()) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Every input of '", config.op_type,
+                               "' needs a \"shape\" array.");
+      }
+      spec.shape = input["shape"].get<std::vector<int64_t>>();
+      config.inputs.push_back(std::move(spec));
+    }
+
+    if (entry.contains("attributes")) {
+      for (auto it = entry["attributes"].begin(); it != entry["attributes"].end(); ++it) {
+        if (!ParseAttribute(it.key(), it.value(), config)) {
+          return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unsupported attribute value for '", it.key(),
+                                 "' of '", config.op_type, "'.");
+        }
+      }
+    }
+
+    configs.push_back(std::move(config));
+  }
+
+  return Status::OK();
+}
+
+//
+// Capture mode
+//
+
+// parse a timing cache shape key like "{3,4};{4,1}" into per-input dims.
+// returns false for keys with non-tensor inputs (empty segments) or malformed entries.
+bool ParseShapeKey(const std::string& shape_key, size_t input_count,
+                   std::vector<std::vector<int64_t>>& shapes) {
+  shapes.clear();
+  std::istringstream stream(shape_key);
+  std::string segment;
+  while (std::getline(stream, segment, ';')) {
+    if (segment.size() < 2 || segment.front() != '{' || segment.back() != '}') {
+      return false;
+    }
+
+    std::vector<int64_t> dims;
+    const std::string dims_text = segment.substr(1, segment.size() - 2);
+    if (!dims_text.empty()) {
+      std::istringstream dims_stream(dims_text);
+      std::string dim;
+      while (std::getline(dims_stream, dim, ',')) {
+        ORT_TRY {
+          dims.push_back(std::stoll(dim));
+        }
+        ORT_CATCH(const std::exception&) {
+          return false;
+        }
+      }
+    }
+
+    shapes.push_back(std::move(dims));
+  }
+
+  return shapes.size() == input_count;
+}
+
+// attributes that a corpus config can reproduce; nodes with tensor/graph-valued
+// attributes (Constant, control flow) are not meaningful op benchmarks and are skipped.
+bool CaptureAttributes(const Node& node, json& attributes) {
+  for (const auto& entry : node.GetAttributes()) {
+    const ONNX_NAMESPACE::AttributeProto& attr = entry.second;
+    switch (attr.type()) {
+      case ONNX_NAMESPACE::AttributeProto_AttributeType_INT:
+        attributes[entry.first] = attr.i();
+        break;
+      case ONNX_NAMESPACE::AttributeProto_AttributeType_FLOAT:
+        attributes[entry.first] = attr.f();
+        break;
+      case ONNX_NAMESPACE::AttributeProto_AttributeType_STRING:
+        attributes[entry.first] = attr.s();
+        break;
+      case ONNX_NAMESPACE::AttributeProto_AttributeType_INTS:
+        attributes[entry.first] = std::vector<int64_t>(attr.ints().begin(), attr.ints().end());
+        break;
+      case ONNX_NAMESPACE::AttributeProto_AttributeType_FLOATS:
+        attributes[entry.first] = std::vector<float>(attr.floats().begin(), attr.floats().end());
+        break;
+      case ONNX_NAMESPACE::AttributeProto_AttributeType_STRINGS:
+        attributes[entry.first] = std::vector<std::string>(attr.strings().begin(), attr.strings().end());
+        break;
+      default:
+        return false;
+    }
+  }
+
+  return true;
+}
+
+void CaptureGraph(const Graph& graph, const NodeTimingCache& timing_cache, int opset,
+                  json& configs, std::set<std::string>& seen) {
+  for (const Node& node : graph.Nodes()) {
+    if (node.ContainsSubgraph()) {
+      for (gsl::not_null<const Graph*> subgraph : node.GetSubgraphs()) {
+        CaptureGraph(*subgraph, timing_cache, opset, configs, seen);
+      }
+    }
+
+    json attributes = json::object();
+    if (!CaptureAttributes(node, attributes)) {
+      continue;
+    }
+
+    const auto& input_defs = node.InputDefs();
+    std::vector<const char*> input_types;
+    bool inputs_supported = !input_defs.empty();
+    for (const NodeArg* input : input_defs) {
+      const auto* type_proto = input->Exists() ? input->TypeAsProto() : nullptr;
+      const char* type_name = type_proto != nullptr && type_proto->has_tensor_type()
+                                  ? ElementTypeToString(type_proto->tensor_type().elem_type())
+                                  : nullptr;
+      if (type_name == nullptr) {
+        inputs_supported = false;
+        break;
+      }
+      input_types.push_back(type_name);
+    }
+    if (!inputs_supported) {
+      continue;
+    }
+
+    // prefer the shapes production Runs recorded; fall back to static shapes from the model
+    std::vector<std::vector<std::vector<int64_t>>> shape_sets;
+    const std::string node_key = NodeTimingCache::MakeNodeKey(node.Name(), node.OpType(), node.Index());
+    for (const std::string& shape_key : timing_cache.GetShapeKeys(node_key)) {
+      std::vector<std::vector<int64_t>> shapes;
+      if (ParseShapeKey(shape_key, input_defs.size(), shapes)) {
+        shape_sets.push_back(std::move(shapes));
+      }
+    }
+
+    if (shape_sets.empty()) {
+      std::vector<std::vector<int64_t>> shapes;
+      bool static_shapes_known = true;
+      for (const NodeArg* input : input_defs) {
+        const auto* shape_proto = input->Shape();
+        if (shape_proto == nullptr) {
+          static_shapes_known = false;
+          break;
+        }
+
+        std::vector<int64_t> dims;
+        for (const auto& dim : shape_proto->dim()) {
+          if (!dim.has_dim_value()) {
+            static_shapes_known = false;
+            break;
+          }
+          dims.push_back(dim.dim_value());
+        }
+        if (!static_shapes_known) {
+          break;
+        }
+        shapes.push_back(std::move(dims));
+      }
+
+      if (static_shapes_known) {
+        shape_sets.push_back(std::move(shapes));
+      }
+    }
+
+    for (const auto& shapes : shape_sets) {
+      json config;
+      config["op_type"] = node.OpType();
+      if (!node.Domain().empty()) {
+        config["domain"] = node.Domain();
+      }
+      config["opset"] = opset;
+      if (!attributes.empty()) {
+        config["attributes"] = attributes;
+      }
+
+      json inputs = json::array();
+      for (size_t i = 0; i < shapes.size(); ++i) {
+        json input;
+        input["type"] = input_types[i];
+        input["shape"] = shapes[i];
+        inputs.push_back(std::move(input));
+      }
+      config["inputs"] = std::move(inputs);
+
+      // identical configs from repeated subgraph structure are only emitted once
+      const std::string fingerprint = config.dump();
+      if (seen.insert(fingerprint).second) {
+        configs.push_back(std::move(config));
+      }
+    }
+  }
+}
+
+Status CaptureCorpus(const std::string& model_path, const std::string& timing_cache_path,
+                     const std::string& corpus_path) {
+  auto logger = env->GetLoggingManager()->CreateLogger("op_benchmark");
+
+  std::shared_ptr<Model> model;
+  ORT_RETURN_IF_ERROR(Model::Load(ToPathString(model_path), model, nullptr, *logger));
+
+  NodeTimingCache timing_cache;
+  if (!timing_cache_path.empty()) {
+    ORT_RETURN_IF_ERROR(timing_cache.Load(timing_cache_path));
+  }
+
+  const auto& domain_to_version = model->MainGraph().DomainToVersionMap();
+  auto onnx_version = domain_to_version.find(kOnnxDomain);
+  const int opset = onnx_version != domain_to_version.end() ? onnx_version->second : 12;
+
+  json configs = json::array();
+  std::set<std::string> seen;
+  CaptureGraph(model->MainGraph(), timing_cache, opset, configs, seen);
+
+  std::ofstream file(corpus_path, std::ios::trunc);
+  if (!file) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to open corpus file for writing: ", corpus_path);
+  }
+  file << configs.dump(2) << '\n';
+
+  std::cout << "Captured " << configs.size() << " configs to " << corpus_path << std::endl;
+  return Status::OK();
+}
+
+void PrintUsage() {
+  std::cerr << "Usage:\n"
+            << "  onnxruntime_op_benchmark --corpus <configs.json> [benchmark options]\n"
+            << "  onnxruntime_op_benchmark --capture <model.onnx> [--timing_cache <timings.txt>]"
+            << " --corpus <configs.json>\n";
+}
+
+}  // namespace
+
+#define ORT_ABORT_ON_ERROR(expr)                             \
+  do {                                                       \
+    OrtStatus* onnx_status = (expr);                         \
+    if (onnx_status != NULL) {                               \
+      const char* msg = g_ort->GetErrorMessage(onnx_status); \
+      ::std::cerr << msg << ::std::endl;                     \
+      g_ort->ReleaseStatus(onnx_status);                     \
+      abort();                                               \
+    }                                                        \
+  } while (0);
+
+int main(int argc, char** argv) {
+  std::string corpus_path;
+  std::string capture_model_path;
+  std::string timing_cache_path;
+
+  // consume the tool's own arguments; the rest is handed to google benchmark
+  int kept = 1;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if ((arg == "--corpus" || arg == "--capture" || arg == "--timing_cache") && i + 1 < argc) {
+      const std::string value = argv[++i];
+      if (arg == "--corpus") {
+        corpus_path = value;
+      } else if (arg == "--capture") {
+        capture_model_path = value;
+      } else {
+        timing_cache_path = value;
+      }
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  argc = kept;
+
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    return -1;
+
+  if (corpus_path.empty()) {
+    PrintUsage();
+    return -1;
+  }
+
+  ORT_ABORT_ON_ERROR(g_ort->CreateEnv(ORT_LOGGING_LEVEL_ERROR, "op_benchmark", &env));
+
+  int result = 0;
+  if (!capture_model_path.empty()) {
+    auto status = CaptureCorpus(capture_model_path, timing_cache_path, corpus_path);
+    if (!status.IsOK()) {
+      std::cerr << status.ErrorMessage() << std::endl;
+      result = -1;
+    }
+  } else {
+    std::vector<OpConfig> configs;
+    auto status = LoadCorpus(corpus_path, configs);
+    if (!status.IsOK()) {
+      std::cerr << status.ErrorMessage() << std::endl;
+      result = -1;
+    } else {
+      for (const OpConfig& config : configs) {
+        std::shared_ptr<PreparedOp> prepared;
+        status = PrepareOp(config, prepared);
+        if (!status.IsOK()) {
+          std::cerr << "Skipping " << ConfigName(config) << ": " << status.ErrorMessage() << std::endl;
+          continue;
+        }
+
+        ::benchmark::RegisterBenchmark(ConfigName(config).c_str(), RunOpBenchmark, prepared);
+      }
+
+      ::benchmark::RunSpecifiedBenchmarks();
+    }
+  }
+
+  g_ort->ReleaseEnv(env);
+  return result;
+}
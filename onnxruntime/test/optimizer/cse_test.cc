@@ -286,5 +286,51 @@ TEST(CseTests, MergeConstants) {
   ASSERT_EQ(op_count["Add"], 2);
 }
 
+TEST(CseTests, MergeDuplicatedInitializers) {
+  // Two initializers with the same content but different names; expressions that differ
+  // only in which copy they reference should collapse.
+  Model model("cse_duplicated_initializers", false, DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor_type;
+  float_tensor_type.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  auto& x = graph.GetOrCreateNodeArg("x", &float_tensor_type);
+  auto& c1 = graph.GetOrCreateNodeArg("c1", &float_tensor_type);
+  auto& c2 = graph.GetOrCreateNodeArg("c2", &float_tensor_type);
+
+  ONNX_NAMESPACE::TensorProto constant_tensor;
+  constant_tensor.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  constant_tensor.add_dims(3);
+  for (float value : {1.f, 2.f, 3.f}) {
+    constant_tensor.add_float_data(value);
+  }
+  constant_tensor.set_name("c1");
+  graph.AddInitializedTensor(constant_tensor);
+  constant_tensor.set_name("c2");
+  graph.AddInitializedTensor(constant_tensor);
+
+  auto& add_1_out = graph.GetOrCreateNodeArg("Add1", &float_tensor_type);
+  auto& add_2_out = graph.GetOrCreateNodeArg("Add2", &float_tensor_type);
+  auto& result = graph.GetOrCreateNodeArg("Result", &float_tensor_type);
+
+  graph.AddNode("add_1", "Add", "", {&x, &c1}, {&add_1_out});
+  graph.AddNode("add_2", "Add", "", {&x, &c2}, {&add_2_out});
+  graph.AddNode("add_3", "Add", "", {&add_1_out, &add_2_out}, {&result});
+
+  graph.SetInputs({&x});
+  graph.SetOutputs({&result});
+  ASSERT_TRUE(graph.Resolve().IsOK());
+
+  ApplyCse(model);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count.at("Add"), 2);
+  // The copy of the constant that lost its only consumer is swept by the resolve
+  // that follows the transformation.
+  ASSERT_EQ(graph.GetAllInitializedTensors().size(), 1U);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -26,6 +26,7 @@
 #include "core/optimizer/conv_mul_fusion.h"
 #include "core/optimizer/dropout_elimination.h"
 #include "core/optimizer/dynamic_quantize_matmul_fusion.h"
+#include "core/optimizer/element_wise_chain_fusion.h"
 #include "core/optimizer/embed_layer_norm_fusion.h"
 #include "core/optimizer/expand_elimination.h"
 #include "core/optimizer/fast_gelu_fusion.h"
@@ -37,7 +38,9 @@
 #include "core/optimizer/identity_elimination.h"
 #include "core/optimizer/initializer.h"
 #include "core/optimizer/layer_norm_fusion.h"
+#include "core/optimizer/loop_invariant_code_motion.h"
 #include "core/optimizer/matmul_add_fusion.h"
+#include "core/optimizer/matmul_horizontal_fusion.h"
 #include "core/optimizer/matmul_integer_to_float.h"
 #include "core/optimizer/matmul_scale_fusion.h"
 #include "core/optimizer/matmul_transpose_fusion.h"
@@ -47,6 +50,7 @@
 #include "core/optimizer/shape_to_initializer.h"
 #include "core/optimizer/skip_layer_norm_fusion.h"
 #include "core/optimizer/slice_elimination.h"
+#include "core/optimizer/sparse_matmul_transformer.h"
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/utils.h"
 #include "core/platform/env.h"
@@ -302,6 +306,388 @@ TEST_F(GraphTransformationTests, ConstantFoldingWithScalarShapeToInitializer) {
   ASSERT_TRUE(op_to_count["Add"] == 1);
 }
 
+TEST_F(GraphTransformationTests, LoopInvariantCodeMotionScan) {
+  TypeProto float_2;
+  float_2.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  TensorProto weight_tensor;
+  weight_tensor.add_dims(2);
+  weight_tensor.add_float_data(1.f);
+  weight_tensor.add_float_data(2.f);
+  weight_tensor.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+
+  auto create_body = [&](GraphProto& graph_proto) {
+    // body with one loop-invariant node: inv_out = Add(outer_w, local_w) only depends on the
+    // outer scope value and a local initializer, while the state and scan outputs depend on the
+    // per-iteration inputs
+    Model model("ScanLICMTest_body", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, *logger_);
+    auto& graph = model.MainGraph();
+
+    TensorProto local_w(weight_tensor);
+    local_w.set_name("local_w");
+    graph.AddInitializedTensor(local_w);
+
+    auto& state_in = graph.GetOrCreateNodeArg("state_in", &float_2);
+    auto& scan_in = graph.GetOrCreateNodeArg("scan_in", &float_2);
+    auto& outer_w = graph.GetOrCreateNodeArg("outer_w", &float_2);
+    auto& local_w_arg = graph.GetOrCreateNodeArg("local_w", &float_2);
+    graph.AddOuterScopeNodeArg("outer_w");
+
+    auto& inv_out = graph.GetOrCreateNodeArg("inv_out", &float_2);
+    graph.AddNode("invariant_add", "Add", "Loop-invariant computation.", {&outer_w, &local_w_arg}, {&inv_out});
+
+    auto& state_out = graph.GetOrCreateNodeArg("state_out", &float_2);
+    graph.AddNode("state_add", "Add", "Update the state.", {&state_in, &inv_out}, {&state_out});
+
+    auto& scan_out = graph.GetOrCreateNodeArg("scan_out", &float_2);
+    graph.AddNode("scan_mul", "Mul", "Produce the scan output.", {&scan_in, &inv_out}, {&scan_out});
+
+    ASSERT_STATUS_OK(graph.Resolve());
+    graph_proto = graph.ToGraphProto();
+  };
+
+  Model model("ScanLICMTest_main_graph", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  TensorProto outer_w(weight_tensor);
+  outer_w.set_name("outer_w");
+  graph.AddInitializedTensor(outer_w);
+
+  TypeProto float_3x2;
+  float_3x2.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_3x2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+  float_3x2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& initial_state = graph.GetOrCreateNodeArg("initial_state", &float_2);
+  auto& scan_seq = graph.GetOrCreateNodeArg("scan_seq", &float_3x2);
+  auto& final_state = graph.GetOrCreateNodeArg("final_state", &float_2);
+  auto& scan_outputs = graph.GetOrCreateNodeArg("scan_outputs", &float_3x2);
+
+  auto& scan_node = graph.AddNode("scan", "Scan", "Scan node", {&initial_state, &scan_seq},
+                                  {&final_state, &scan_outputs});
+
+  GraphProto body;
+  create_body(body);
+  scan_node.AddAttribute("body", body);
+  scan_node.AddAttribute("num_scan_inputs", static_cast<int64_t>(1));
+
+  ASSERT_STATUS_OK(graph.Resolve());
+  ASSERT_EQ(scan_node.GetGraphAttribute("body")->NumberOfNodes(), 3);
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(onnxruntime::make_unique<LoopInvariantCodeMotion>(), TransformerLevel::Level1);
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  // the invariant Add is hoisted into the main graph, the state/scan computation stays in the body
+  const Graph* post_body = scan_node.GetGraphAttribute("body");
+  ASSERT_EQ(post_body->NumberOfNodes(), 2)
+      << "The loop-invariant Add should have been hoisted out of the Scan body";
+
+  int num_main_graph_adds = 0;
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Add") {
+      ++num_main_graph_adds;
+    }
+  }
+  ASSERT_EQ(num_main_graph_adds, 1) << "The hoisted Add should live in the main graph";
+
+  // the hoisted value must flow back into the body as an implicit input of the Scan node
+  ASSERT_EQ(scan_node.ImplicitInputDefs().size(), 1u);
+}
+
+namespace {
+// Transformer that counts how often it is applied, with a configurable trigger op type set.
+class CountingTransformer : public GraphTransformer {
+ public:
+  CountingTransformer(const std::string& name, bool has_trigger_op_types,
+                      std::unordered_set<std::string> trigger_op_types)
+      : GraphTransformer(name),
+        has_trigger_op_types_(has_trigger_op_types),
+        trigger_op_types_(std::move(trigger_op_types)) {}
+
+  const std::unordered_set<std::string>* TriggerOpTypes() const override {
+    return has_trigger_op_types_ ? &trigger_op_types_ : nullptr;
+  }
+
+  mutable int num_applies = 0;
+
+ private:
+  Status ApplyImpl(Graph& /*graph*/, bool& /*modified*/, int /*graph_level*/,
+                   const logging::Logger& /*logger*/) const override {
+    ++num_applies;
+    return Status::OK();
+  }
+
+  const bool has_trigger_op_types_;
+  const std::unordered_set<std::string> trigger_op_types_;
+};
+}  // namespace
+
+TEST_F(GraphTransformationTests, TransformerTriggerOpTypeSkipping) {
+  auto model_uri = MODEL_FOLDER "fusion/fuse-conv-bn-mul-add-unsqueeze.onnx";
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, model, nullptr, *logger_));
+  Graph& graph = model->MainGraph();
+
+  auto trigger_present = onnxruntime::make_unique<CountingTransformer>(
+      "trigger_present", true, std::unordered_set<std::string>{"Conv"});
+  auto trigger_absent = onnxruntime::make_unique<CountingTransformer>(
+      "trigger_absent", true, std::unordered_set<std::string>{"LSTM"});
+  auto no_trigger_set = onnxruntime::make_unique<CountingTransformer>(
+      "no_trigger_set", false, std::unordered_set<std::string>{});
+
+  const auto* trigger_present_ptr = trigger_present.get();
+  const auto* trigger_absent_ptr = trigger_absent.get();
+  const auto* no_trigger_set_ptr = no_trigger_set.get();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(trigger_present), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(trigger_absent), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(no_trigger_set), TransformerLevel::Level1));
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  EXPECT_EQ(trigger_present_ptr->num_applies, 1) << "A transformer whose trigger op is present must run";
+  EXPECT_EQ(trigger_absent_ptr->num_applies, 0) << "A transformer whose trigger ops are all absent must be skipped";
+  EXPECT_EQ(no_trigger_set_ptr->num_applies, 1) << "A transformer without a trigger set must always run";
+}
+
+TEST_F(GraphTransformationTests, MatMulHorizontalFusion) {
+  Model model("MatMulHorizontalFusionTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto float_2x4;
+  float_2x4.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_2x4.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  float_2x4.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+  auto& input_a = graph.GetOrCreateNodeArg("A", &float_2x4);
+
+  // dynamic weight fed as a graph input: its MatMul must survive the fusion untouched
+  TypeProto float_4x6;
+  float_4x6.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_4x6.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+  float_4x6.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(6);
+  auto& dynamic_weight = graph.GetOrCreateNodeArg("dynamic_weight", &float_4x6);
+
+  auto add_constant_weight = [&](const std::string& name, int64_t n, float base) -> NodeArg& {
+    TensorProto weight;
+    weight.set_name(name);
+    weight.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    weight.add_dims(4);
+    weight.add_dims(n);
+    for (int64_t i = 0; i < 4 * n; ++i) {
+      weight.add_float_data(base + static_cast<float>(i));
+    }
+    graph.AddInitializedTensor(weight);
+
+    TypeProto weight_type;
+    weight_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    weight_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+    weight_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(n);
+    return graph.GetOrCreateNodeArg(name, &weight_type);
+  };
+
+  auto& weight_0 = add_constant_weight("weight_0", 3, 0.f);
+  auto& weight_1 = add_constant_weight("weight_1", 5, 100.f);
+  auto& weight_2 = add_constant_weight("weight_2", 2, 200.f);
+
+  auto& out_0 = graph.GetOrCreateNodeArg("out_0", nullptr);
+  auto& out_1 = graph.GetOrCreateNodeArg("out_1", nullptr);
+  auto& out_2 = graph.GetOrCreateNodeArg("out_2", nullptr);
+  auto& out_dynamic = graph.GetOrCreateNodeArg("out_dynamic", nullptr);
+  graph.AddNode("matmul_0", "MatMul", "sibling head 0", {&input_a, &weight_0}, {&out_0});
+  graph.AddNode("matmul_1", "MatMul", "sibling head 1", {&input_a, &weight_1}, {&out_1});
+  graph.AddNode("matmul_2", "MatMul", "sibling head 2", {&input_a, &weight_2}, {&out_2});
+  graph.AddNode("matmul_dynamic", "MatMul", "non-constant weight", {&input_a, &dynamic_weight}, {&out_dynamic});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(onnxruntime::make_unique<MatMulHorizontalFusion>(),
+                                                     TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  // the three constant-weight siblings collapse into one MatMul + Split; the dynamic one stays
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["MatMul"], 2);
+  ASSERT_EQ(op_to_count["Split"], 1);
+
+  const Node* split_node = nullptr;
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Split") {
+      split_node = &node;
+    }
+  }
+  ASSERT_NE(split_node, nullptr);
+
+  // the Split restores the original outputs in sibling order along the last axis
+  ASSERT_EQ(split_node->GetAttributes().at("axis").i(), 1);
+  const auto& split_sizes = split_node->GetAttributes().at("split").ints();
+  ASSERT_EQ(split_sizes.size(), 3);
+  EXPECT_EQ(split_sizes.Get(0), 3);
+  EXPECT_EQ(split_sizes.Get(1), 5);
+  EXPECT_EQ(split_sizes.Get(2), 2);
+  const auto& split_outputs = split_node->OutputDefs();
+  ASSERT_EQ(split_outputs.size(), 3u);
+  EXPECT_EQ(split_outputs[0]->Name(), "out_0");
+  EXPECT_EQ(split_outputs[1]->Name(), "out_1");
+  EXPECT_EQ(split_outputs[2]->Name(), "out_2");
+
+  // the fused weight concatenates the sibling weights column-wise
+  const Node& fused_matmul = *graph.GetProducerNode(split_node->InputDefs()[0]->Name());
+  const auto* fused_weight = graph_utils::GetConstantInitializer(graph, fused_matmul.InputDefs()[1]->Name());
+  ASSERT_NE(fused_weight, nullptr);
+  ASSERT_EQ(fused_weight->dims_size(), 2);
+  EXPECT_EQ(fused_weight->dims(0), 4);
+  EXPECT_EQ(fused_weight->dims(1), 10);
+  Initializer fused_data(*fused_weight, graph.ModelPath());
+  const float* data = fused_data.data<float>();
+  const float expected_first_row[] = {0.f, 1.f, 2.f, 100.f, 101.f, 102.f, 103.f, 104.f, 200.f, 201.f};
+  for (size_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(data[i], expected_first_row[i]) << "mismatch at fused weight column " << i;
+  }
+
+  // all four original outputs are still graph outputs
+  ASSERT_EQ(graph.GetOutputs().size(), 4u);
+}
+
+// From opset 13 Split takes its sizes as an optional input instead of an attribute, so the
+// fusion must emit them as a constant initializer or the rewritten graph fails the checker.
+TEST_F(GraphTransformationTests, MatMulHorizontalFusionOpset13) {
+  Model model("MatMulHorizontalFusionOpset13Test", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 13}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto float_2x4;
+  float_2x4.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_2x4.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  float_2x4.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+  auto& input_a = graph.GetOrCreateNodeArg("A", &float_2x4);
+
+  auto add_constant_weight = [&](const std::string& name, int64_t n, float base) -> NodeArg& {
+    TensorProto weight;
+    weight.set_name(name);
+    weight.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    weight.add_dims(4);
+    weight.add_dims(n);
+    for (int64_t i = 0; i < 4 * n; ++i) {
+      weight.add_float_data(base + static_cast<float>(i));
+    }
+    graph.AddInitializedTensor(weight);
+
+    TypeProto weight_type;
+    weight_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    weight_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+    weight_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(n);
+    return graph.GetOrCreateNodeArg(name, &weight_type);
+  };
+
+  auto& weight_0 = add_constant_weight("weight_0", 3, 0.f);
+  auto& weight_1 = add_constant_weight("weight_1", 5, 100.f);
+
+  auto& out_0 = graph.GetOrCreateNodeArg("out_0", nullptr);
+  auto& out_1 = graph.GetOrCreateNodeArg("out_1", nullptr);
+  graph.AddNode("matmul_0", "MatMul", "sibling head 0", {&input_a, &weight_0}, {&out_0});
+  graph.AddNode("matmul_1", "MatMul", "sibling head 1", {&input_a, &weight_1}, {&out_1});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  // ApplyTransformers re-resolves the rewritten graph, so an attribute-form Split would
+  // already fail here with INVALID_GRAPH
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(onnxruntime::make_unique<MatMulHorizontalFusion>(),
+                                                     TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["MatMul"], 1);
+  ASSERT_EQ(op_to_count["Split"], 1);
+
+  const Node* split_node = nullptr;
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Split") {
+      split_node = &node;
+    }
+  }
+  ASSERT_NE(split_node, nullptr);
+
+  // the sizes come in through the second input as a constant initializer, not the attribute
+  ASSERT_EQ(split_node->GetAttributes().count("split"), 0u);
+  ASSERT_EQ(split_node->InputDefs().size(), 2u);
+  const auto* split_sizes_tensor =
+      graph_utils::GetConstantInitializer(graph, split_node->InputDefs()[1]->Name());
+  ASSERT_NE(split_sizes_tensor, nullptr);
+  ASSERT_EQ(split_sizes_tensor->dims_size(), 1);
+  ASSERT_EQ(split_sizes_tensor->dims(0), 2);
+  Initializer split_sizes(*split_sizes_tensor, graph.ModelPath());
+  EXPECT_EQ(split_sizes.data<int64_t>()[0], 3);
+  EXPECT_EQ(split_sizes.data<int64_t>()[1], 5);
+
+  ASSERT_EQ(split_node->GetAttributes().at("axis").i(), 1);
+  const auto& split_outputs = split_node->OutputDefs();
+  ASSERT_EQ(split_outputs.size(), 2u);
+  EXPECT_EQ(split_outputs[0]->Name(), "out_0");
+  EXPECT_EQ(split_outputs[1]->Name(), "out_1");
+}
+
+TEST_F(GraphTransformationTests, ElementWiseChainFusion) {
+  Model model("ElementWiseChainFusionTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}, {kMSDomain, 1}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto float_2x3;
+  float_2x3.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_2x3.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  float_2x3.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+  auto& input_x = graph.GetOrCreateNodeArg("X", &float_2x3);
+
+  auto& leaky_relu_out = graph.GetOrCreateNodeArg("leaky_relu_out", nullptr);
+  auto& tanh_out = graph.GetOrCreateNodeArg("tanh_out", nullptr);
+  auto& sigmoid_out = graph.GetOrCreateNodeArg("sigmoid_out", nullptr);
+  auto& relu_out = graph.GetOrCreateNodeArg("relu_out", nullptr);
+
+  Node& leaky_relu = graph.AddNode("leaky_relu", "LeakyRelu", "chain head", {&input_x}, {&leaky_relu_out});
+  leaky_relu.AddAttribute("alpha", 0.1f);
+  graph.AddNode("tanh", "Tanh", "chain tail - output has two consumers", {&leaky_relu_out}, {&tanh_out});
+  graph.AddNode("sigmoid", "Sigmoid", "first consumer", {&tanh_out}, {&sigmoid_out});
+  graph.AddNode("relu", "Relu", "second consumer", {&tanh_out}, {&relu_out});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(onnxruntime::make_unique<ElementWiseChainFusion>(),
+                                                     TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, *logger_));
+
+  // LeakyRelu and Tanh collapse into one FusedElementWise. The Tanh output has two consumers,
+  // so neither of them can be absorbed into the chain.
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["com.microsoft.FusedElementWise"], 1);
+  ASSERT_EQ(op_to_count["LeakyRelu"], 0);
+  ASSERT_EQ(op_to_count["Tanh"], 0);
+  ASSERT_EQ(op_to_count["Sigmoid"], 1);
+  ASSERT_EQ(op_to_count["Relu"], 1);
+
+  const Node* fused_node = nullptr;
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "FusedElementWise") {
+      fused_node = &node;
+    }
+  }
+  ASSERT_NE(fused_node, nullptr);
+
+  // the chain ops are listed in execution order and LeakyRelu's alpha is carried with a stage prefix
+  const auto& activations = fused_node->GetAttributes().at("activations").strings();
+  ASSERT_EQ(activations.size(), 2);
+  EXPECT_EQ(activations.Get(0), "LeakyRelu");
+  EXPECT_EQ(activations.Get(1), "Tanh");
+  EXPECT_FLOAT_EQ(fused_node->GetAttributes().at("activation_0_alpha").f(), 0.1f);
+
+  // the fused node takes over the chain tail's output
+  ASSERT_EQ(fused_node->OutputDefs().size(), 1u);
+  EXPECT_EQ(fused_node->OutputDefs()[0]->Name(), "tanh_out");
+}
+
 TEST_F(GraphTransformationTests, ShapeToInitializer) {
   auto model_uri = MODEL_FOLDER "shape-add.onnx";
   std::shared_ptr<Model> model;
@@ -3420,6 +3806,67 @@ TEST_F(GraphTransformationTests, MatMulScaleFusionUnsupportedInputType) {
       },
       {kCpuExecutionProvider});
 }
+
+// Builds a graph with two MatMul nodes sharing an input: one with a mostly-zero constant
+// weight that should be rewritten to SparseMatMul, and one with a dense constant weight
+// that should be left alone.
+TEST_F(GraphTransformationTests, SparseMatMulRewrite) {
+  Model model("SparseMatMulRewrite", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              {{"", 12}, {kMSDomain, 1}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  constexpr int64_t K = 16;
+  constexpr int64_t N = 16;
+
+  TypeProto input_type;
+  input_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(K);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("input", &input_type);
+  auto& sparse_out = graph.GetOrCreateNodeArg("sparse_out", nullptr);
+  auto& dense_out = graph.GetOrCreateNodeArg("dense_out", nullptr);
+
+  // mostly-zero weight: a single nonzero per column keeps the density far below the threshold
+  TensorProto sparse_weight;
+  sparse_weight.set_name("sparse_weight");
+  sparse_weight.add_dims(K);
+  sparse_weight.add_dims(N);
+  sparse_weight.set_data_type(TensorProto_DataType_FLOAT);
+  std::vector<float> sparse_data(K * N, 0.0f);
+  for (int64_t n = 0; n < N; ++n) {
+    sparse_data[n * N + n] = 1.0f;
+  }
+  sparse_weight.set_raw_data(sparse_data.data(), sparse_data.size() * sizeof(float));
+  graph.AddInitializedTensor(sparse_weight);
+
+  TensorProto dense_weight;
+  dense_weight.set_name("dense_weight");
+  dense_weight.add_dims(K);
+  dense_weight.add_dims(N);
+  dense_weight.set_data_type(TensorProto_DataType_FLOAT);
+  std::vector<float> dense_data(K * N, 1.0f);
+  dense_weight.set_raw_data(dense_data.data(), dense_data.size() * sizeof(float));
+  graph.AddInitializedTensor(dense_weight);
+
+  auto& sparse_weight_arg = graph.GetOrCreateNodeArg("sparse_weight", nullptr);
+  auto& dense_weight_arg = graph.GetOrCreateNodeArg("dense_weight", nullptr);
+
+  graph.AddNode("matmul_sparse", "MatMul", "MatMul with sparse weight", {&input_arg, &sparse_weight_arg},
+                {&sparse_out});
+  graph.AddNode("matmul_dense", "MatMul", "MatMul with dense weight", {&input_arg, &dense_weight_arg},
+                {&dense_out});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(onnxruntime::make_unique<SparseMatMulTransformer>(), TransformerLevel::Level2);
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, *logger_));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  EXPECT_EQ(op_to_count["MatMul"], 1);
+  EXPECT_EQ(op_to_count["com.microsoft.SparseMatMul"], 1);
+}
 #endif
 
 }  // namespace test
@@ -80,6 +80,22 @@ struct NchwcTestHelper {
     return MakeInitializer({static_cast<int64_t>(data.size())}, data);
   }
 
+  NodeArg* Make1DInt64Initializer(const std::vector<int64_t>& data) {
+    std::string name = graph_.GenerateNodeArgName("constant");
+    ONNX_NAMESPACE::TensorProto tensor_proto;
+    tensor_proto.set_name(name);
+    tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+    tensor_proto.add_dims(static_cast<int64_t>(data.size()));
+
+    for (auto value : data) {
+      tensor_proto.add_int64_data(value);
+    }
+
+    graph_.AddInitializedTensor(tensor_proto);
+
+    return &graph_.GetOrCreateNodeArg(name, nullptr);
+  }
+
   Node& AddNode(const std::string& op_type,
                 const std::vector<NodeArg*>& input_args,
                 const std::vector<NodeArg*>& output_args) {
@@ -1198,6 +1214,98 @@ TEST(NchwcOptimizerTests, Upsample) {
   }
 }
 
+TEST(NchwcOptimizerTests, Pad) {
+  auto test_case = [&](int opset_version) {
+    auto build_test_case = [&](NchwcTestHelper& helper) {
+      auto* input_arg = helper.MakeInput<float>({1, 16, 17, 13});
+      auto* conv1_output_arg = helper.MakeIntermediate();
+      auto* pad_output_arg = helper.MakeIntermediate();
+      auto* output_arg = helper.MakeOutput();
+
+      helper.AddConvNode(input_arg, conv1_output_arg, {48, 16, 3, 3});
+
+      std::vector<int64_t> pads{0, 0, 1, 2, 0, 0, 3, 1};
+      std::vector<NodeArg*> input_args{conv1_output_arg};
+      if (opset_version >= 11) {
+        input_args.push_back(helper.Make1DInt64Initializer(pads));
+        input_args.push_back(helper.MakeInitializer({}, {-0.5f}));
+      }
+      Node& pad_node = helper.AddNode("Pad", input_args, {pad_output_arg});
+      pad_node.AddAttribute("mode", "constant");
+      if (opset_version < 11) {
+        pad_node.AddAttribute("pads", pads);
+        pad_node.AddAttribute("value", -0.5f);
+      }
+
+      helper.AddConvNode(pad_output_arg, output_arg, {16, 48, 1, 1});
+    };
+
+    auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.Conv"], 2);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.Pad"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+      EXPECT_EQ(op_to_count["Pad"], 0);
+    };
+
+    NchwcOptimizerTester(build_test_case, check_nchwc_graph, opset_version);
+  };
+
+  // Verify that constant padding of the spatial dimensions stays in NCHWc
+  // format for various versions of the operator.
+  static const int opset_versions[] = {9, 11, 12};
+  for (auto opset_version : opset_versions) {
+    test_case(opset_version);
+  }
+}
+
+TEST(NchwcOptimizerTests, Slice) {
+  auto test_case = [&](int opset_version) {
+    auto build_test_case = [&](NchwcTestHelper& helper) {
+      auto* input_arg = helper.MakeInput<float>({2, 16, 19, 23});
+      auto* conv_output_arg = helper.MakeIntermediate();
+      auto* output_arg = helper.MakeOutput();
+
+      helper.AddConvNode(input_arg, conv_output_arg, {32, 16, 3, 3});
+
+      std::vector<int64_t> starts{0, 1, 2};
+      std::vector<int64_t> ends{1, 9, -3};
+      std::vector<int64_t> axes{0, 2, 3};
+      std::vector<NodeArg*> input_args{conv_output_arg};
+      if (opset_version >= 10) {
+        input_args.push_back(helper.Make1DInt64Initializer(starts));
+        input_args.push_back(helper.Make1DInt64Initializer(ends));
+        input_args.push_back(helper.Make1DInt64Initializer(axes));
+      }
+      Node& slice_node = helper.AddNode("Slice", input_args, {output_arg});
+      if (opset_version < 10) {
+        slice_node.AddAttribute("starts", starts);
+        slice_node.AddAttribute("ends", ends);
+        slice_node.AddAttribute("axes", axes);
+      }
+    };
+
+    auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.Conv"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.Slice"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+      EXPECT_EQ(op_to_count["Slice"], 0);
+    };
+
+    NchwcOptimizerTester(build_test_case, check_nchwc_graph, opset_version);
+  };
+
+  // Verify that slicing of the batch and spatial dimensions stays in NCHWc
+  // format for various versions of the operator.
+  static const int opset_versions[] = {9, 10, 11, 12};
+  for (auto opset_version : opset_versions) {
+    test_case(opset_version);
+  }
+}
+
 TEST(NchwcOptimizerTests, Activation) {
   auto test_case = [&](const std::string& activation_op_type) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
@@ -520,6 +520,73 @@ TEST(NhwcTransformerTests, ConvMixTensorRanks) {
 
 #endif
 
+TEST(NhwcTransformerTests, FloatConv) {
+  if (MlasNchwcGetBlockSize() > 1) {
+    // Float tensors are converted by the NCHWc transformer on platforms with
+    // a blocked layout kernel.
+    return;
+  }
+
+  auto test_case = [&](const std::vector<int64_t>& input_shape, const std::vector<int64_t>& weights_shape) {
+    auto build_test_case = [&](NhwcTestHelper& helper) {
+      auto* input_arg = helper.MakeInput<float>(input_shape);
+      auto* output_arg = helper.MakeOutput();
+
+      helper.AddNode("Conv", {input_arg,
+                              helper.MakeInitializer<float>(weights_shape, -15, 15),
+                              helper.MakeInitializer<float>({weights_shape[0]}, -63, 63)},
+                     {output_arg});
+    };
+
+    auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.NhwcConv"], 1);
+      EXPECT_EQ(op_to_count["Transpose"], 2);
+    };
+
+    NhwcTransformerTester(build_test_case, check_nhwc_graph);
+  };
+
+  // Test the basic case of a single 1D/2D/3D convolution.
+  test_case({1, 12, 37}, {32, 12, 5});
+  test_case({1, 23, 13, 13}, {30, 23, 3, 3});
+  test_case({1, 22, 11, 13, 15}, {30, 22, 5, 3, 3});
+}
+
+TEST(NhwcTransformerTests, FloatConvBlock) {
+  if (MlasNchwcGetBlockSize() > 1) {
+    return;
+  }
+
+  auto build_test_case = [&](NhwcTestHelper& helper) {
+    auto* input_arg = helper.MakeInput<float>({1, 23, 13, 13});
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* conv2_output_arg = helper.MakeIntermediate();
+    auto* add_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeOutput();
+
+    Node& conv1_node = helper.AddNode("Conv", {input_arg,
+                                               helper.MakeInitializer<float>({30, 23, 3, 3}, -15, 15)},
+                                      {conv1_output_arg});
+    conv1_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    helper.AddNode("Conv", {input_arg,
+                            helper.MakeInitializer<float>({30, 23, 1, 1}, -15, 15)},
+                   {conv2_output_arg});
+    helper.AddNode("Add", {conv1_output_arg, conv2_output_arg}, {add_output_arg});
+    helper.AddNode("Relu", {add_output_arg}, {output_arg});
+  };
+
+  auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.NhwcConv"], 2);
+    // Both convolutions share a single reordered input and the activation
+    // output is reordered back once.
+    EXPECT_EQ(op_to_count["Transpose"], 2);
+  };
+
+  NhwcTransformerTester(build_test_case, check_nhwc_graph);
+}
+
 #endif // DISABLE_CONTRIB_OPS
 
 }  // namespace test
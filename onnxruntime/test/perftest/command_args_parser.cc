@@ -33,6 +33,11 @@ namespace perftest {
       "\t-A: Disable memory arena\n"
       "\t-I: Generate tensor input binding (Free dimensions are treated as 1.)\n"
       "\t-c [parallel runs]: Specifies the (max) number of runs to invoke simultaneously. Default:1.\n"
+      "\t-C: Sweep the concurrency level from 1 up to the value given with -c in 'times' mode, and report latency "
+      "percentiles for each level.\n"
+      "\t-Q [qps]: Issue requests open loop at the given rate (requests per second) with Poisson arrivals for the "
+      "duration given with -t, instead of running a closed loop. Latency is measured from the scheduled arrival "
+      "time, so queueing delay counts toward the tail.\n"
       "\t-e [cpu|cuda|dnnl|tensorrt|openvino|nuphar|dml|acl]: Specifies the provider 'cpu','cuda','dnnl','tensorrt', "
       "'openvino', 'nuphar', 'dml' or 'acl'. "
       "Default:'cpu'.\n"
@@ -51,12 +56,15 @@ namespace perftest {
       "\t-d [cudnn_conv_algorithm]: Specify CUDNN convolution algothrithms: 0(benchmark), 1(heuristic), 2(default). \n"
       "\t-q: [CUDA only] use separate stream for copy. \n"
       "\t-z: Set denormal as zero. When turning on this option reduces latency dramatically, a model may have denormals.\n"
+      "\t-R [capture_file]: Replay a run capture recorded via the RunOptionsEnableRunCapture API: restores the "
+      "recorded random seed and feeds the recorded input tensors to the model instead of generated inputs. "
+      "Repeats -r times and reports latency percentiles; combine with -p to profile the replayed run.\n"
       "\t-h: help\n");
 }
 
 /*static*/ bool CommandLineParser::ParseArguments(PerformanceTestConfig& test_config, int argc, ORTCHAR_T* argv[]) {
   int ch;
-  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:AMPIvhsqz"))) != -1) {
+  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:Q:R:ACMPIvhsqz"))) != -1) {
     switch (ch) {
       case 'm':
         if (!CompareCString(optarg, ORT_TSTR("duration"))) {
@@ -147,6 +155,16 @@ namespace perftest {
           return false;
         }
         break;
+      case 'C':
+        test_config.run_config.f_sweep_concurrency = true;
+        break;
+      case 'Q':
+        test_config.run_config.target_qps = static_cast<double>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        if (test_config.run_config.target_qps <= 0) {
+          return false;
+        }
+        test_config.run_config.test_mode = TestMode::kFixDurationMode;
+        break;
       case 'o': {
         int tmp = static_cast<int>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
         switch (tmp) {
@@ -187,6 +205,9 @@ namespace perftest {
       case 'z':
         test_config.run_config.set_denormal_as_zero = true;
         break;
+      case 'R':
+        test_config.run_config.replay_capture_path = optarg;
+        break;
       case '?':
       case 'h':
       default:
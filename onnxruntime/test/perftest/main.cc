@@ -6,6 +6,7 @@
 #include <random>
 #include "command_args_parser.h"
 #include "performance_runner.h"
+#include "replay.h"
 #include <google/protobuf/stubs/common.h>
 
 using namespace onnxruntime;
@@ -41,6 +42,19 @@ int real_main(int argc, char* argv[]) {
     if (failed)
       return -1;
   }
+  if (!test_config.run_config.replay_capture_path.empty()) {
+    int ret = -1;
+    ORT_TRY {
+      ret = perftest::ReplayCapture(env, test_config);
+    }
+    ORT_CATCH(const Ort::Exception& e) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        fprintf(stderr, "Replay failed: %s\n", e.what());
+      });
+    }
+    return ret;
+  }
+
   std::random_device rd;
   perftest::PerformanceRunner perf_runner(env, test_config, rd);
   auto status = perf_runner.Run();
@@ -8,6 +8,7 @@
 
 #include "performance_runner.h"
 #include <iostream>
+#include <thread>
 
 #include "TestCase.h"
 #include "TFModelInfo.h"
@@ -146,6 +147,10 @@ Status PerformanceRunner::Run() {
 }
 
 Status PerformanceRunner::FixDurationTest() {
+  if (performance_test_config_.run_config.target_qps > 0) {
+    return RunOpenLoop();
+  }
+
   if (performance_test_config_.run_config.concurrent_session_runs <= 1) {
     return RunFixDuration();
   }
@@ -154,11 +159,15 @@ Status PerformanceRunner::FixDurationTest() {
 }
 
 Status PerformanceRunner::RepeatedTimesTest() {
+  if (performance_test_config_.run_config.f_sweep_concurrency) {
+    return ConcurrencySweep();
+  }
+
   if (performance_test_config_.run_config.concurrent_session_runs <= 1) {
     return RunRepeatedTimes();
   }
 
-  return ForkJoinRepeat();
+  return ForkJoinRepeat(performance_test_config_.run_config.concurrent_session_runs);
 }
 
 Status PerformanceRunner::RunParallelDuration() {
@@ -197,17 +206,125 @@ Status PerformanceRunner::RunParallelDuration() {
   return Status::OK();
 }
 
-Status PerformanceRunner::ForkJoinRepeat() {
+Status PerformanceRunner::RunOpenLoop() {
+  // Open-loop load generation: requests are issued at exponentially distributed
+  // inter-arrival times (a Poisson process at target_qps), whether or not earlier
+  // requests have completed.  Latency is measured from the scheduled arrival time
+  // to completion, so when the workers fall behind the queueing delay counts
+  // toward the tail, reproducing a production latency profile rather than the
+  // best case a closed loop measures.
+  auto tpool = GetDefaultThreadPool(Env::Default());
+  std::atomic<int> counter = {0};
+  OrtMutex m;
+  OrtCondVar cv;
+
+  std::mt19937_64 generator{std::random_device{}()};
+  std::exponential_distribution<double> inter_arrival(performance_test_config_.run_config.target_qps);
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  auto next_arrival = start;
+  while (true) {
+    next_arrival += std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+        std::chrono::duration<double>(inter_arrival(generator)));
+    std::chrono::duration<double> elapsed = next_arrival - start;
+    if (elapsed.count() >= static_cast<double>(performance_test_config_.run_config.duration_in_seconds)) {
+      break;
+    }
+    std::this_thread::sleep_until(next_arrival);
+
+    counter++;
+    tpool->Schedule([this, next_arrival, &counter, &m, &cv]() {
+      ORT_TRY {
+        session_->Run();
+      }
+      ORT_CATCH(const std::exception& ex) {
+        ORT_HANDLE_EXCEPTION([&]() {
+          std::cerr << "PerformanceRunner::RunOpenLoop caught exception: " << ex.what() << "\n";
+        });
+      }
+      std::chrono::duration<double> latency_seconds = std::chrono::high_resolution_clock::now() - next_arrival;
+
+      {
+        std::lock_guard<OrtMutex> guard(results_mutex_);
+        performance_result_.time_costs.emplace_back(latency_seconds.count());
+        performance_result_.total_time_cost += latency_seconds.count();
+        if (performance_test_config_.run_config.f_verbose) {
+          std::cout << "iteration:" << performance_result_.time_costs.size() << ","
+                    << "time_cost:" << performance_result_.time_costs.back() << std::endl;
+        }
+      }
+
+      // Simplified version of Eigen::Barrier
+      std::lock_guard<OrtMutex> lg(m);
+      counter--;
+      cv.notify_all();
+    });
+  }
+
+  //Join
+  std::unique_lock<OrtMutex> lock(m);
+  cv.wait(lock, [&counter]() { return counter == 0; });
+
+  return Status::OK();
+}
+
+// Print a one-line latency summary for the given (unsorted) per-request times.
+static void PrintLatencySummary(std::vector<double> times) {
+  if (times.empty()) {
+    std::cout << "no requests completed" << std::endl;
+    return;
+  }
+
+  std::sort(times.begin(), times.end());
+  size_t total = times.size();
+  auto percentile = [&](double p) { return times[static_cast<size_t>(total * p)]; };
+  std::cout << "requests:" << total
+            << " p50:" << percentile(0.5) << " s"
+            << " p95:" << percentile(0.95) << " s"
+            << " p99:" << percentile(0.99) << " s"
+            << " p99.9:" << percentile(0.999) << " s"
+            << " max:" << times[total - 1] << " s" << std::endl;
+}
+
+Status PerformanceRunner::ConcurrencySweep() {
+  // Run the repeated-times test once per concurrency level, from a single
+  // caller up to concurrent_session_runs parallel callers, and report latency
+  // percentiles for each level so the knee of the latency/concurrency curve is
+  // visible from one invocation.
+  const auto& run_config = performance_test_config_.run_config;
+
+  for (size_t level = 1; level <= run_config.concurrent_session_runs; ++level) {
+    size_t first;
+    {
+      std::lock_guard<OrtMutex> guard(results_mutex_);
+      first = performance_result_.time_costs.size();
+    }
+
+    ORT_RETURN_IF_ERROR(level == 1 ? RunRepeatedTimes() : ForkJoinRepeat(level));
+
+    std::vector<double> level_times;
+    {
+      std::lock_guard<OrtMutex> guard(results_mutex_);
+      level_times.assign(performance_result_.time_costs.begin() + first, performance_result_.time_costs.end());
+    }
+    std::cout << "Concurrency " << level << ": ";
+    PrintLatencySummary(std::move(level_times));
+  }
+
+  return Status::OK();
+}
+
+Status PerformanceRunner::ForkJoinRepeat(size_t num_parallel) {
   const auto& run_config = performance_test_config_.run_config;
 
   // create a threadpool with one thread per concurrent request
-  auto tpool = onnxruntime::make_unique<DefaultThreadPoolType>(run_config.concurrent_session_runs);
+  auto tpool = onnxruntime::make_unique<DefaultThreadPoolType>(num_parallel);
   std::atomic<int> counter{0}, requests{0};
   OrtMutex m;
   OrtCondVar cv;
 
   // Fork
-  for (size_t i = 0; i != run_config.concurrent_session_runs; ++i) {
+  for (size_t i = 0; i != num_parallel; ++i) {
     counter++;
     tpool->Schedule([this, &counter, &requests, &m, &cv, &run_config]() {
       while (requests++ < static_cast<int>(run_config.repeated_times)) {
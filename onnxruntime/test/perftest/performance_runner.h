@@ -86,8 +86,10 @@ class PerformanceRunner {
 
   Status FixDurationTest();
   Status RepeatedTimesTest();
-  Status ForkJoinRepeat();
+  Status ForkJoinRepeat(size_t num_parallel);
   Status RunParallelDuration();
+  Status RunOpenLoop();
+  Status ConcurrencySweep();
 
   inline Status RunFixDuration() {
     while (performance_result_.total_time_cost < performance_test_config_.run_config.duration_in_seconds) {
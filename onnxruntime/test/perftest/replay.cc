@@ -0,0 +1,213 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_session_options_config_keys.h>
+
+namespace onnxruntime {
+namespace perftest {
+
+namespace {
+
+// The capture layout is defined in onnxruntime/core/framework/run_capture.h and must stay
+// in sync with it: magic, int64 seed, uint32 feed count, then length-prefixed TensorProtos.
+constexpr char kCaptureMagic[8] = {'O', 'R', 'T', 'R', 'U', 'N', 'C', '1'};
+
+template <typename T>
+bool ReadPod(std::ifstream& file, T& value) {
+  file.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return static_cast<bool>(file);
+}
+
+bool ReadCapture(const std::basic_string<ORTCHAR_T>& path, int64_t& random_seed,
+                 std::vector<ONNX_NAMESPACE::TensorProto>& feeds) {
+  std::ifstream file(path.c_str(), std::ios::binary);
+  if (!file) {
+    fprintf(stderr, "Failed to open the capture file.\n");
+    return false;
+  }
+
+  char magic[sizeof(kCaptureMagic)];
+  file.read(magic, sizeof(magic));
+  if (!file || std::memcmp(magic, kCaptureMagic, sizeof(kCaptureMagic)) != 0) {
+    fprintf(stderr, "The file is not a run capture.\n");
+    return false;
+  }
+
+  uint32_t num_feeds = 0;
+  if (!ReadPod(file, random_seed) || !ReadPod(file, num_feeds)) {
+    fprintf(stderr, "The capture file is truncated.\n");
+    return false;
+  }
+
+  for (uint32_t i = 0; i < num_feeds; ++i) {
+    uint32_t proto_size = 0;
+    if (!ReadPod(file, proto_size)) {
+      fprintf(stderr, "The capture file is truncated.\n");
+      return false;
+    }
+    std::string serialized(proto_size, '\0');
+    file.read(&serialized[0], static_cast<std::streamsize>(proto_size));
+    if (!file) {
+      fprintf(stderr, "The capture file is truncated.\n");
+      return false;
+    }
+
+    feeds.emplace_back();
+    if (!feeds.back().ParseFromString(serialized)) {
+      fprintf(stderr, "The capture file contains an invalid feed entry.\n");
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool ElementTypeOf(int32_t proto_type, ONNXTensorElementDataType& elem_type) {
+  switch (proto_type) {
+    case ONNX_NAMESPACE::TensorProto_DataType_FLOAT:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_DOUBLE:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT8:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT8:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT16:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT16:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT32:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_INT64:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT32:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT64:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_BOOL:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_FLOAT16:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16;
+      return true;
+    case ONNX_NAMESPACE::TensorProto_DataType_BFLOAT16:
+      elem_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16;
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+int ReplayCapture(Ort::Env& env, const PerformanceTestConfig& test_config) {
+  int64_t random_seed = 0;
+  std::vector<ONNX_NAMESPACE::TensorProto> feed_protos;
+  if (!ReadCapture(test_config.run_config.replay_capture_path, random_seed, feed_protos)) {
+    return -1;
+  }
+
+  Ort::SessionOptions session_options;
+  session_options.SetExecutionMode(test_config.run_config.execution_mode);
+  if (!test_config.run_config.enable_memory_pattern) session_options.DisableMemPattern();
+  if (!test_config.run_config.enable_cpu_mem_arena) session_options.DisableCpuMemArena();
+  if (test_config.run_config.intra_op_num_threads > 0)
+    session_options.SetIntraOpNumThreads(test_config.run_config.intra_op_num_threads);
+  if (test_config.run_config.inter_op_num_threads > 0)
+    session_options.SetInterOpNumThreads(test_config.run_config.inter_op_num_threads);
+  session_options.SetGraphOptimizationLevel(test_config.run_config.optimization_level);
+  if (!test_config.run_config.profile_file.empty())
+    session_options.EnableProfiling(test_config.run_config.profile_file.c_str());
+  if (test_config.run_config.set_denormal_as_zero)
+    session_options.AddConfigEntry(kOrtSessionOptionsConfigSetDenormalAsZero, "1");
+
+  // restore the random streams the recorded run saw
+  Ort::ThrowOnError(Ort::GetApi().SetGlobalRandomSeed(random_seed));
+
+  Ort::Session session(env, test_config.model_info.model_file_path.c_str(), session_options);
+
+  Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  std::vector<const char*> input_names;
+  std::vector<Ort::Value> inputs;
+  for (ONNX_NAMESPACE::TensorProto& proto : feed_protos) {
+    ONNXTensorElementDataType elem_type;
+    if (!ElementTypeOf(proto.data_type(), elem_type)) {
+      fprintf(stderr, "Feed '%s' has an unsupported element type.\n", proto.name().c_str());
+      return -1;
+    }
+
+    std::vector<int64_t> dims(proto.dims().begin(), proto.dims().end());
+    std::string& data = *proto.mutable_raw_data();
+    input_names.push_back(proto.name().c_str());
+    inputs.push_back(Ort::Value::CreateTensor(memory_info, data.empty() ? nullptr : &data[0], data.size(),
+                                              dims.data(), dims.size(), elem_type));
+  }
+
+  Ort::AllocatorWithDefaultOptions allocator;
+  std::vector<std::string> output_name_storage;
+  std::vector<const char*> output_names;
+  for (size_t i = 0; i < session.GetOutputCount(); ++i) {
+    char* name = session.GetOutputName(i, allocator);
+    output_name_storage.push_back(name);
+    allocator.Free(name);
+  }
+  for (const std::string& name : output_name_storage) {
+    output_names.push_back(name.c_str());
+  }
+
+  const size_t repeat = test_config.run_config.repeated_times;
+  printf("Replaying capture with %zu feeds for %zu iterations (seed %lld).\n",
+         feed_protos.size(), repeat, static_cast<long long>(random_seed));
+
+  std::vector<double> latencies_ms;
+  latencies_ms.reserve(repeat);
+  for (size_t i = 0; i < repeat; ++i) {
+    auto start = std::chrono::high_resolution_clock::now();
+    auto outputs = session.Run(Ort::RunOptions{nullptr}, input_names.data(), inputs.data(), inputs.size(),
+                               output_names.data(), output_names.size());
+    auto duration = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start);
+    latencies_ms.push_back(duration.count());
+  }
+
+  std::sort(latencies_ms.begin(), latencies_ms.end());
+  double total_ms = 0.0;
+  for (double latency : latencies_ms) total_ms += latency;
+  auto percentile = [&latencies_ms](double p) {
+    const size_t index = static_cast<size_t>(p * static_cast<double>(latencies_ms.size() - 1));
+    return latencies_ms[index];
+  };
+
+  printf("Runs: %zu\n", latencies_ms.size());
+  printf("Average latency: %.4f ms\n", total_ms / static_cast<double>(latencies_ms.size()));
+  printf("Min latency: %.4f ms\n", latencies_ms.front());
+  printf("P50 latency: %.4f ms\n", percentile(0.5));
+  printf("P90 latency: %.4f ms\n", percentile(0.9));
+  printf("P99 latency: %.4f ms\n", percentile(0.99));
+  printf("Max latency: %.4f ms\n", latencies_ms.back());
+
+  return 0;
+}
+
+}  // namespace perftest
+}  // namespace onnxruntime
@@ -0,0 +1,21 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <core/session/onnxruntime_cxx_api.h>
+
+#include "test_configuration.h"
+
+namespace onnxruntime {
+namespace perftest {
+
+// Re-execute a run capture recorded via OrtRunOptions run capture support (see
+// RunOptionsEnableRunCapture): restore the recorded random seed, feed the recorded
+// input tensors to the model and report per-run latencies. Honors the usual session
+// configuration options (-e, -x, -p, ...), so a capture replays under the profiler.
+// Returns 0 on success.
+int ReplayCapture(Ort::Env& env, const PerformanceTestConfig& test_config);
+
+}  // namespace perftest
+}  // namespace onnxruntime
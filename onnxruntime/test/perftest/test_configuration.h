@@ -53,6 +53,15 @@ struct RunConfig {
   int cudnn_conv_algo{0};
   bool do_cuda_copy_in_separate_stream{false};
   bool set_denormal_as_zero{false};
+  // If > 0, 'duration' mode issues requests open loop at this rate (requests per second) with
+  // exponentially distributed inter-arrival times instead of running a closed loop.
+  double target_qps{0.0};
+  // If true, 'times' mode runs once per concurrency level from 1 up to concurrent_session_runs
+  // and reports latency percentiles for each level.
+  bool f_sweep_concurrency{false};
+  // If non-empty, replay this run capture (recorded via OrtRunOptions run capture support)
+  // against the model instead of generating test inputs.
+  std::basic_string<ORTCHAR_T> replay_capture_path;
 };
 
 struct PerformanceTestConfig {
@@ -9,8 +9,11 @@
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <functional>
+#include <thread>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -76,6 +79,47 @@ void TestBatchParallelFor(const std::string& name, int num_threads, int num_task
   ValidateTestData(*test_data);
 }
 
+void TestHelpWithPendingTasks(const std::string& name, int num_threads, int num_tasks) {
+  // TryRunPendingTask lets a thread that must wait for pool work lend itself
+  // to the pool.  Validate that tasks drained this way run exactly once, that
+  // helping coexists with the workers taking tasks, and that the call is
+  // harmless once the queues are empty.
+  auto test_data = CreateTestData(num_tasks);
+  std::atomic<int> remaining{num_tasks};
+  CreateThreadPoolAndTest(name, num_threads, [&](ThreadPool* tp) {
+    for (int i = 0; i < num_tasks; i++) {
+      ThreadPool::Schedule(tp, [&, i]() {
+        IncrementElement(*test_data, i);
+        remaining--;
+      });
+    }
+    while (remaining > 0) {
+      if (!ThreadPool::TryRunPendingTask(tp)) {
+        std::this_thread::yield();
+      }
+    }
+    ASSERT_FALSE(ThreadPool::TryRunPendingTask(tp));
+  });
+  ValidateTestData(*test_data);
+}
+
+void TestCostedParallelFor(const std::string& name, int num_threads, int num_tasks, double cost_per_unit) {
+  // Exercise the cost-model-driven TryParallelFor entry point.  A low
+  // per-unit cost should keep the loop inline in the caller, while a high
+  // cost should fan it out across the pool; either way every index must be
+  // visited exactly once.
+  auto test_data = CreateTestData(num_tasks);
+  CreateThreadPoolAndTest(name, num_threads, [&](ThreadPool* tp) {
+    ThreadPool::TryParallelFor(tp, num_tasks, cost_per_unit,
+                               [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+                                 for (std::ptrdiff_t i = first; i < last; i++) {
+                                   IncrementElement(*test_data, i);
+                                 }
+                               });
+  });
+  ValidateTestData(*test_data);
+}
+
 void TestConcurrentParallelFor(const std::string& name, int num_threads, int num_concurrent, int num_tasks) {
   // Test running multiple concurrent loops over the same thread pool.  This aims to provoke a
   // more diverse mix of interleavings than with a single loop running at a time.
@@ -146,6 +190,102 @@ void TestBurstScheduling(const std::string& name, int num_tasks) {
   }
 }
 
+void TestStickyScheduling(const std::string&, int num_tasks) {
+  // Test scheduling from outside the pool with sticky submission enabled.
+  // With this option, successive tasks from a single external submitter are
+  // pushed to the same worker's queue; the test checks that every task still
+  // runs exactly once, including when the preferred queue fills and submission
+  // falls back to another queue (or to synchronous execution).
+  for (int rep = 0; rep < 5; rep++) {
+    std::atomic<int> ctr{0};
+    onnxruntime::ThreadOptions to;
+    to.use_sticky_task_queues = true;
+    {
+      auto tp = onnxruntime::make_unique<ThreadPool>(&onnxruntime::Env::Default(), to, nullptr, 2, true);
+      for (int tasks = 0; tasks < num_tasks; tasks++) {
+        ThreadPool::Schedule(tp.get(), [&]() {
+          ctr++;
+        });
+      }
+    }
+    ASSERT_TRUE(ctr == num_tasks);
+  }
+}
+
+void TestSpinPolicy(const std::string&, int spin_count_log2, bool adaptive_spinning) {
+  // Test that parallel loops behave correctly under the configurable
+  // spin-then-park policies: a reduced or zero spin duration and the adaptive
+  // mode that skips spinning when no other worker has executed work.  The
+  // policies only affect how quickly idle workers block, so the test runs
+  // batches of small loops separated by idle gaps to push workers through the
+  // spin/block transitions and checks that every iteration runs exactly once.
+  const int num_tasks = 128;
+  onnxruntime::ThreadOptions to;
+  to.spin_count_log2 = spin_count_log2;
+  to.adaptive_spinning = adaptive_spinning;
+  auto tp = onnxruntime::make_unique<ThreadPool>(&onnxruntime::Env::Default(), to, nullptr, 4, true);
+  for (int rep = 0; rep < 5; rep++) {
+    auto test_data = CreateTestData(num_tasks);
+    for (int l = 0; l < 10; l++) {
+      ThreadPool::TrySimpleParallelFor(tp.get(), num_tasks,
+                                       [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+    }
+    ValidateTestData(*test_data, 10);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+void TestHighPriorityScheduling(const std::string& name) {
+  // Test that a task scheduled at high priority runs ahead of normal-priority
+  // tasks that were queued before it.  We use a pool with a single worker
+  // thread, occupy that worker with a gate task, queue a batch of
+  // normal-priority tasks behind it, and then submit one high-priority task.
+  // Once the gate is released, the high-priority task must be the next to run.
+  for (int rep = 0; rep < 5; rep++) {
+    std::atomic<bool> release{false};
+    std::atomic<int> completed{0};
+    std::vector<int> order;
+    onnxruntime::OrtMutex order_mutex;
+    constexpr int num_normal_tasks = 4;
+
+    CreateThreadPoolAndTest(name, 2, [&](ThreadPool* tp) {
+      ThreadPool::Schedule(tp, [&]() {
+        while (!release) {
+          onnxruntime::concurrency::SpinPause();
+        }
+        completed++;
+      });
+
+      for (int i = 0; i < num_normal_tasks; i++) {
+        ThreadPool::Schedule(tp, [&, i]() {
+          {
+            std::lock_guard<onnxruntime::OrtMutex> lock(order_mutex);
+            order.push_back(i);
+          }
+          completed++;
+        });
+      }
+
+      ThreadPool::Schedule(tp, [&]() {
+        {
+          std::lock_guard<onnxruntime::OrtMutex> lock(order_mutex);
+          order.push_back(-1);
+        }
+        completed++;
+      },
+      TaskPriority::kHigh);
+
+      release = true;
+      while (completed != num_normal_tasks + 2) {
+        onnxruntime::concurrency::SpinPause();
+      }
+    });
+
+    ASSERT_EQ(order.size(), static_cast<size_t>(num_normal_tasks + 1));
+    ASSERT_EQ(order.front(), -1);
+  }
+}
+
 void TestPoolCreation(const std::string&, int iter) {
   // Test creating and destroying thread pools.  This can be used with Valgrind to help
   // check for memory leaks related to the initialization and clean-up code.  For instance
@@ -211,6 +351,79 @@ TEST(ThreadPoolTest, TestParallelFor_1_Thread_50_Task) {
   TestParallelFor("TestParallelFor_1_Thread_50_Task", 1, 50);
 }
 
+TEST(ThreadPoolTest, TestCostedParallelFor_4_Thread_50_Task_CheapUnits) {
+  TestCostedParallelFor("TestCostedParallelFor_4_Thread_50_Task_CheapUnits", 4, 50, 1.0);
+}
+
+TEST(ThreadPoolTest, TestCostedParallelFor_4_Thread_50_Task_ExpensiveUnits) {
+  TestCostedParallelFor("TestCostedParallelFor_4_Thread_50_Task_ExpensiveUnits", 4, 50, 1e6);
+}
+
+TEST(ThreadPoolTest, TestCostedParallelFor_0_Thread_50_Task_ExpensiveUnits) {
+  TestCostedParallelFor("TestCostedParallelFor_0_Thread_50_Task_ExpensiveUnits", 0, 50, 1e6);
+}
+
+#ifndef _OPENMP
+TEST(ThreadPoolTest, TestDegreeOfParallelismLimit) {
+  auto tp = onnxruntime::make_unique<ThreadPool>(&onnxruntime::Env::Default(), onnxruntime::ThreadOptions(), nullptr,
+                                                 4, true);
+  ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), 4);
+  {
+    ThreadPool::DegreeOfParallelismLimit limit(2);
+    ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), 2);
+
+    // Loops started under the limit still cover the full iteration space.
+    constexpr int num_tasks = 64;
+    auto test_data = CreateTestData(num_tasks);
+    ThreadPool::TrySimpleParallelFor(tp.get(), num_tasks,
+                                     [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+    ValidateTestData(*test_data);
+
+    // A limit larger than the pool has no effect.
+    ThreadPool::DegreeOfParallelismLimit wide_limit(100);
+    ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), 4);
+  }
+  ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), 4);
+}
+
+TEST(ThreadPoolTest, TestStats) {
+  auto tp = onnxruntime::make_unique<ThreadPool>(&onnxruntime::Env::Default(), onnxruntime::ThreadOptions(), nullptr,
+                                                 4, true);
+  ThreadPoolStats before;
+  ThreadPool::GetStats(tp.get(), before);
+  // A pool with degree-of-parallelism 4 creates 3 threads; the caller is the 4th.
+  ASSERT_EQ(before.num_threads, 3);
+
+  constexpr int num_tasks = 128;
+  auto test_data = CreateTestData(num_tasks);
+  ThreadPool::TrySimpleParallelFor(tp.get(), num_tasks,
+                                   [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+  ValidateTestData(*test_data);
+
+  ThreadPoolStats after;
+  ThreadPool::GetStats(tp.get(), after);
+  ASSERT_GT(after.num_parallel_regions, before.num_parallel_regions);
+  ASSERT_GE(after.region_degree_sum - before.region_degree_sum,
+            after.num_parallel_regions - before.num_parallel_regions);
+  ASSERT_GE(after.num_tasks_executed, before.num_tasks_executed);
+
+  // A null pool snapshot comes back zeroed.
+  ThreadPoolStats null_stats;
+  null_stats.num_tasks_executed = 1;
+  ThreadPool::GetStats(nullptr, null_stats);
+  ASSERT_EQ(null_stats.num_tasks_executed, 0u);
+  ASSERT_EQ(null_stats.num_threads, 0);
+}
+#endif
+
+TEST(ThreadPoolTest, TestHelpWithPendingTasks_0_Thread_16_Tasks) {
+  TestHelpWithPendingTasks("TestHelpWithPendingTasks_0_Thread_16_Tasks", 0, 16);
+}
+
+TEST(ThreadPoolTest, TestHelpWithPendingTasks_2_Thread_128_Tasks) {
+  TestHelpWithPendingTasks("TestHelpWithPendingTasks_2_Thread_128_Tasks", 2, 128);
+}
+
 TEST(ThreadPoolTest, TestBatchParallelFor_0_Thread_50_Task_10_Batch) {
   TestBatchParallelFor("TestBatchParallelFor_0_Thread_50_Task_10_Batch", 0, 50, 10);
 }
@@ -321,6 +534,34 @@ TEST(ThreadPoolTest, TestBurstScheduling_65536Task) {
   TestBurstScheduling("TestBurstScheduling_65536Tasks", 65536);
 }
 
+TEST(ThreadPoolTest, TestStickyScheduling_16Tasks) {
+  TestStickyScheduling("TestStickyScheduling_16Tasks", 16);
+}
+
+TEST(ThreadPoolTest, TestStickyScheduling_65536Tasks) {
+  TestStickyScheduling("TestStickyScheduling_65536Tasks", 65536);
+}
+
+TEST(ThreadPoolTest, TestSpinPolicy_NoSpin) {
+  TestSpinPolicy("TestSpinPolicy_NoSpin", 0, false);
+}
+
+TEST(ThreadPoolTest, TestSpinPolicy_ShortSpin) {
+  TestSpinPolicy("TestSpinPolicy_ShortSpin", 10, false);
+}
+
+TEST(ThreadPoolTest, TestSpinPolicy_Adaptive) {
+  TestSpinPolicy("TestSpinPolicy_Adaptive", -1, true);
+}
+
+TEST(ThreadPoolTest, TestSpinPolicy_ShortSpinAdaptive) {
+  TestSpinPolicy("TestSpinPolicy_ShortSpinAdaptive", 10, true);
+}
+
+TEST(ThreadPoolTest, TestHighPriorityScheduling) {
+  TestHighPriorityScheduling("TestHighPriorityScheduling");
+}
+
 TEST(ThreadPoolTest, TestPoolCreation_1Iter) {
   TestPoolCreation("TestPoolCreation_1Iter", 1);
 }
@@ -381,6 +622,42 @@ TEST(ThreadPoolTest, TestMultiLoopSections_4Thread_100Loop) {
   TestMultiLoopSections("TestMultiLoopSections_4Thread_100Loop", 4, 100);
 }
 
+namespace {
+std::atomic<int> custom_threads_created{0};
+std::atomic<int> custom_threads_joined{0};
+
+OrtCustomThreadHandle TestCustomCreateThread(void* /*options*/, OrtThreadWorkerFn worker_fn, void* worker_arg) {
+  custom_threads_created++;
+  return reinterpret_cast<OrtCustomThreadHandle>(new std::thread(worker_fn, worker_arg));
+}
+
+void TestCustomJoinThread(OrtCustomThreadHandle handle) {
+  std::thread* t = reinterpret_cast<std::thread*>(const_cast<OrtCustomHandleType*>(handle));
+  t->join();
+  delete t;
+  custom_threads_joined++;
+}
+}  // namespace
+
+TEST(ThreadPoolTest, TestCustomThreadCreation) {
+  custom_threads_created = 0;
+  custom_threads_joined = 0;
+  constexpr int num_tasks = 128;
+  auto test_data = CreateTestData(num_tasks);
+  {
+    ThreadOptions to;
+    to.custom_create_thread_fn = TestCustomCreateThread;
+    to.custom_join_thread_fn = TestCustomJoinThread;
+    auto tp = onnxruntime::make_unique<ThreadPool>(&onnxruntime::Env::Default(), to, nullptr, 3, true);
+    ThreadPool::TrySimpleParallelFor(tp.get(), num_tasks,
+                                     [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+  }
+  ValidateTestData(*test_data);
+  // every worker came from the creation callback and was handed back on shutdown
+  ASSERT_GT(custom_threads_created.load(), 0);
+  ASSERT_EQ(custom_threads_created.load(), custom_threads_joined.load());
+}
+
 #ifdef _WIN32
 TEST(ThreadPoolTest, TestStackSize) {
   ThreadOptions to;
@@ -207,6 +207,18 @@ TEST(Einsum, ExplicitEinsumAsMatmul_Multi_Input) {
   test.Run();
 }
 
+TEST(Einsum, ExplicitEinsumAsMatmul_Multi_Input_Unordered_Operands) {
+  // The two operands sharing labels are not adjacent in the equation -
+  // contracting them first (rather than left-to-right) avoids an outer product
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ij,kl,jk->il");
+  test.AddInput<float>("x", {2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  test.AddInput<float>("y", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddInput<float>("z", {3, 2}, {1.f, 0.f, 2.f, 1.f, 0.f, 3.f});
+  test.AddOutput<float>("o", {2, 2}, {38.f, 54.f, 83.f, 120.f});
+  test.Run();
+}
+
 TEST(Einsum, ExplicitEinsumAsBatchedMatmul) {
   OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
   test.AddAttribute<std::string>("equation", "bij,bjk->bik");
@@ -1,12 +1,15 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/util/include/default_providers.h"
+#include "core/providers/cpu/math/element_wise_ops.h"
 #include "core/util/math.h"
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 namespace onnxruntime {
 namespace test {
@@ -2039,5 +2042,75 @@ TEST(BitShiftOpTest, BroadcastXRight_Uint8) {
   test.Run();
 }
 
+// InputBroadcaster must iterate a non-contiguous view in place using its strides
+TEST(BroadcasterTest, StridedViewInput) {
+  // {4, 3} column slice of a {4, 5} buffer, so each row keeps the physical stride of 5
+  std::vector<float> buffer(4 * 5);
+  std::iota(buffer.begin(), buffer.end(), 0.f);
+  Tensor input0(DataTypeImpl::GetType<float>(), TensorShape({4, 3}), buffer.data(), OrtMemoryInfo(),
+                std::vector<int64_t>{5, 1});
+  ASSERT_FALSE(input0.IsContiguous());
+
+  std::vector<float> bias{100.f, 200.f, 300.f};
+  Tensor input1(DataTypeImpl::GetType<float>(), TensorShape({3}), bias.data(), OrtMemoryInfo());
+
+  InputBroadcaster input_broadcaster(input0, input1);
+  EXPECT_EQ(input_broadcaster.GetOutputShape(), TensorShape({4, 3}));
+  ASSERT_EQ(input_broadcaster.GetSpanSize(), 3u);
+  ASSERT_FALSE(input_broadcaster.IsInput0Scalar());
+  ASSERT_FALSE(input_broadcaster.IsInput1Scalar());
+
+  std::vector<float> sums;
+  for (int span = 0; span < 4; ++span) {
+    auto span0 = input_broadcaster.Span0<float>(0, 3);
+    auto span1 = input_broadcaster.Span1<float>(0, 3);
+    for (size_t i = 0; i < 3; ++i)
+      sums.push_back(span0[i] + span1[i]);
+    input_broadcaster.Next();
+  }
+
+  EXPECT_THAT(sums, testing::ElementsAre(100.f, 201.f, 302.f,
+                                         105.f, 206.f, 307.f,
+                                         110.f, 211.f, 312.f,
+                                         115.f, 216.f, 317.f));
+}
+
+// a strided view that broadcasts its innermost axis is handed out as a scalar per span
+TEST(BroadcasterTest, StridedViewScalarInput) {
+  // {4, 1} view of the first column of a {4, 5} buffer
+  std::vector<float> buffer(4 * 5);
+  std::iota(buffer.begin(), buffer.end(), 0.f);
+  Tensor input0(DataTypeImpl::GetType<float>(), TensorShape({4, 1}), buffer.data(), OrtMemoryInfo(),
+                std::vector<int64_t>{5, 1});
+  ASSERT_FALSE(input0.IsContiguous());
+
+  std::vector<float> bias{100.f, 200.f, 300.f};
+  Tensor input1(DataTypeImpl::GetType<float>(), TensorShape({3}), bias.data(), OrtMemoryInfo());
+
+  InputBroadcaster input_broadcaster(input0, input1);
+  EXPECT_EQ(input_broadcaster.GetOutputShape(), TensorShape({4, 3}));
+  ASSERT_EQ(input_broadcaster.GetSpanSize(), 3u);
+  ASSERT_TRUE(input_broadcaster.IsInput0Scalar());
+
+  std::vector<float> scalars;
+  for (int span = 0; span < 4; ++span) {
+    scalars.push_back(input_broadcaster.Scalar0<float>());
+    input_broadcaster.Next();
+  }
+
+  EXPECT_THAT(scalars, testing::ElementsAre(0.f, 5.f, 10.f, 15.f));
+}
+
+// a non-contiguous innermost axis cannot be handed out as a contiguous span
+TEST(BroadcasterTest, StridedViewNonContiguousInnerAxisThrows) {
+  std::vector<float> buffer(4 * 5);
+  // {4, 5} transposed view of a {5, 4} buffer
+  Tensor input0(DataTypeImpl::GetType<float>(), TensorShape({4, 5}), buffer.data(), OrtMemoryInfo(),
+                std::vector<int64_t>{1, 4});
+  Tensor input1(DataTypeImpl::GetType<float>(), TensorShape({5}), buffer.data(), OrtMemoryInfo());
+
+  ASSERT_THROW(InputBroadcaster(input0, input1), OnnxRuntimeException);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
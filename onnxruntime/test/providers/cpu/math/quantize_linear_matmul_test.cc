@@ -117,6 +117,22 @@ TEST(QuantizeLinearMatmulOpTest, QLinearMatMul) {
   QLinearMatMul2DTest(false);
 }
 
+TEST(QuantizeLinearMatmulOpTest, QLinearMatMul2D_PerColumn) {
+  OpTester test("QLinearMatMul", 10);
+  test.AddInput<uint8_t>("T1", {2, 4}, {208, 236, 0, 238, 3, 214, 255, 29});
+  test.AddInput<float>("a_scale", {}, {0.0066f});
+  test.AddInput<uint8_t>("a_zero_point", {}, {113});
+  test.AddInput<uint8_t>("T2", {4, 3}, {152, 51, 244, 60, 26, 255, 0, 127, 246, 127, 254, 247});
+  test.AddInput<float>("b_scale", {3}, {0.005f, 0.00705f, 0.009f});
+  test.AddInput<uint8_t>("b_zero_point", {3}, {114, 114, 114});
+  test.AddInput<float>("y_scale", {}, {0.0107f});
+  test.AddInput<uint8_t>("y_zero_point", {}, {118});
+  test.AddOutput<uint8_t>("T3", {2, 3}, {153, 115, 255, 35, 66, 160});
+
+  // Skip NNAPI as it does not support per-column quantization.
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kNnapiExecutionProvider});
+}
+
 // NNAPI EP requires weight to be an initializer
 TEST(QuantizeLinearMatmulOpTest, QLinearMatMulAllInputExceptT1AreInitializers) {
   QLinearMatMul2DTest(true);
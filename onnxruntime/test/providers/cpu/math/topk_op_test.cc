@@ -556,5 +556,14 @@ TEST(TopKOperator, SelectTopKThreaded) {
   TestThreaded(k, n, batch_size);
 }
 
+// single huge row: exercises the chunked selection path that splits the reduction axis
+// across threads and merges the chunk-local top k candidates
+TEST(TopKOperator, SingleRowChunkedSelection) {
+  const int64_t k = 7;
+  const int64_t n = 1;
+  const int64_t batch_size = 20000;
+  TestThreaded(k, n, batch_size);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -1212,6 +1212,50 @@ TEST(ReductionOpTest, ReduceSum_batch_by_seq_by_128) {
   }
 }
 
+// Reduces the last axis so that every output is computed over one large
+// contiguous span, which takes the chunked tree reduction path when there
+// are fewer rows than threads.
+void test_tail_reduce_sum(int64_t m, int64_t n) {
+  OpTester test("ReduceSum");
+  std::vector<float> X(m * n, 0.0f);
+  std::vector<float> Y(m, 0.0f);
+  std::default_random_engine generator(0);
+  std::uniform_real_distribution<float> distribution(0.0, 1.0);
+  for (int64_t i = 0; i < m; ++i) {
+    for (int64_t j = 0; j < n; ++j) {
+      const float value = distribution(generator) / float(n);
+      X[i * n + j] = value;
+      Y[i] += value;
+    }
+  }
+
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddAttribute("axes", std::vector<int64_t>{1});
+  test.AddInput<float>("data", {m, n}, X);
+  test.AddOutput<float>("reduced", {m}, Y);
+  test.Run();
+}
+
+TEST(ReductionOpTest, ReduceSum_tail_axis_large) {
+  test_tail_reduce_sum(2, 16 * 1024);
+  test_tail_reduce_sum(3, 8 * 1024 + 17);
+}
+
+TEST(ReductionOpTest, ReduceMax_all_axes_large) {
+  OpTester test("ReduceMax");
+  const int64_t size = 16 * 1024 + 3;
+  std::vector<float> X(size);
+  for (int64_t i = 0; i < size; ++i) {
+    X[i] = float(i % 4096) - 2048.0f;
+  }
+  X[12345] = 4096.0f;
+
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddInput<float>("data", {size}, X);
+  test.AddOutput<float>("reduced", {}, {4096.0f});
+  test.Run();
+}
+
 #ifdef USE_CUDA
 TEST(ReductionOpTest, ReduceSum_batch_by_seq_by_30528) {
   test_apex_reduce_sum(4 * 128, 30528);
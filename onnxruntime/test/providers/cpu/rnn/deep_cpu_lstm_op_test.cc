@@ -12,6 +12,40 @@ using namespace std;
 namespace onnxruntime {
 namespace test {
 
+TEST(LSTMTest, ScratchArenaReusesBlockAcrossRuns) {
+  auto arena = std::make_shared<rnn::detail::RnnScratchArena>(std::make_shared<CPUAllocator>());
+
+  // first 'Run' is served by the base allocator while the request size is recorded
+  arena->Reset();
+  IAllocatorUniquePtr<float> run1_a = IAllocator::MakeUniquePtr<float>(arena, 128);
+  IAllocatorUniquePtr<float> run1_b = IAllocator::MakeUniquePtr<float>(arena, 64);
+  ASSERT_NE(run1_a, nullptr);
+  ASSERT_NE(run1_b, nullptr);
+  run1_a.reset();
+  run1_b.reset();
+
+  // after Reset the block covers the recorded high-water mark, so same-sized Runs
+  // get stable addresses out of the cached block
+  arena->Reset();
+  IAllocatorUniquePtr<float> run2_a = IAllocator::MakeUniquePtr<float>(arena, 128);
+  IAllocatorUniquePtr<float> run2_b = IAllocator::MakeUniquePtr<float>(arena, 64);
+  const float* run2_a_addr = run2_a.get();
+  const float* run2_b_addr = run2_b.get();
+  run2_a.reset();
+  run2_b.reset();
+
+  arena->Reset();
+  IAllocatorUniquePtr<float> run3_a = IAllocator::MakeUniquePtr<float>(arena, 128);
+  IAllocatorUniquePtr<float> run3_b = IAllocator::MakeUniquePtr<float>(arena, 64);
+  EXPECT_EQ(run3_a.get(), run2_a_addr);
+  EXPECT_EQ(run3_b.get(), run2_b_addr);
+
+  // a larger request overflows to the base allocator without invalidating the block
+  IAllocatorUniquePtr<float> run3_c = IAllocator::MakeUniquePtr<float>(arena, 1024);
+  ASSERT_NE(run3_c, nullptr);
+  EXPECT_NE(run3_c.get(), run2_a_addr);
+}
+
 // copy the contents of the container to the end so the original values are duplicated
 template <typename T>
 T DuplicateContainer(const T& container) {
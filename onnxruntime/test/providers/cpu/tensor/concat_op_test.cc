@@ -98,6 +98,25 @@ TEST(ConcatOpTest, Concat2D_2) {
   test.Run();
 }
 
+TEST(ConcatOpTest, Concat2D_ManyInputsMixedSizes) {
+  // exercises the flattened copy-chunk partitioning: uneven input widths (including an
+  // empty input) mean the chunk-to-input mapping changes mid-partition
+  OpTester test("Concat");
+  test.AddAttribute("axis", int64_t{1});
+
+  test.AddInput<float>("input1", {2, 1}, {11.0f, 21.0f});
+  test.AddInput<float>("input2", {2, 3}, {12.0f, 13.0f, 14.0f, 22.0f, 23.0f, 24.0f});
+  test.AddInput<float>("input3", {2, 0}, {});
+  test.AddInput<float>("input4", {2, 2}, {15.0f, 16.0f, 25.0f, 26.0f});
+  test.AddInput<float>("input5", {2, 1}, {17.0f, 27.0f});
+  test.AddOutput<float>("concat_result", {2, 7},
+                        {11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f, 17.0f,
+                         21.0f, 22.0f, 23.0f, 24.0f, 25.0f, 26.0f, 27.0f});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "",
+           {kTensorrtExecutionProvider,  //TensorRT: no support for dynamic shape tensor
+            kNnapiExecutionProvider});   // NNAPI: concat does not support 0 size input
+}
+
 TEST(ConcatOpTest, Concat2D_3) {
   OpTester test("Concat");
   test.AddAttribute("axis", int64_t{1});
@@ -158,6 +158,27 @@ TEST(GatherOpTest, Gather_axis0_indices2d) {
   test.Run();
 }
 
+TEST(GatherOpTest, Gather_axis0_consecutive_indices) {
+  // runs of consecutive indices (including negative ones that normalize into a run)
+  // are coalesced into single memcpys, interleaved with non-consecutive ones
+  OpTester test("Gather");
+  test.AddAttribute<int64_t>("axis", 0LL);
+  test.AddInput<float>("data", {4, 2},
+                       {0.0f, 0.1f,
+                        1.0f, 1.1f,
+                        2.0f, 2.1f,
+                        3.0f, 3.1f});
+  test.AddInput<int64_t>("indices", {6}, {1LL, 2LL, 3LL, 0LL, -3LL, 2LL});
+  test.AddOutput<float>("output", {6, 2},
+                        {1.0f, 1.1f,
+                         2.0f, 2.1f,
+                         3.0f, 3.1f,
+                         0.0f, 0.1f,
+                         1.0f, 1.1f,
+                         2.0f, 2.1f});
+  test.Run();
+}
+
 TEST(GatherOpTest, Gather_axis1_indices2d) {
   OpTester test("Gather");
   test.AddAttribute<int64_t>("axis", 1LL);
@@ -82,6 +82,29 @@ TEST(NonZeroOpTest, Scalar) {
   }
 }
 
+TEST(NonZeroOpTest, LargeSparseInput) {
+  // large enough to be scanned in multiple chunks
+  constexpr int64_t kRows = 4;
+  constexpr int64_t kCols = 20000;
+  std::vector<float> input(kRows * kCols, 0.0f);
+  std::vector<int64_t> expected_rows;
+  std::vector<int64_t> expected_cols;
+  for (int64_t i = 0; i < kRows * kCols; i += 97) {
+    input[i] = 1.0f;
+    expected_rows.push_back(i / kCols);
+    expected_cols.push_back(i % kCols);
+  }
+
+  std::vector<int64_t> expected;
+  expected.insert(expected.end(), expected_rows.begin(), expected_rows.end());
+  expected.insert(expected.end(), expected_cols.begin(), expected_cols.end());
+
+  OpTester test{kOpName, kOpVersion};
+  test.AddInput<float>("X", {kRows, kCols}, input);
+  test.AddOutput<int64_t>("Y", {2, static_cast<int64_t>(expected_rows.size())}, expected);
+  test.Run();
+}
+
 TEST(NonZeroOpTest, EmptyInput) {
   OpTester test{kOpName, kOpVersion};
   test.AddInput<int32_t>(
@@ -155,5 +155,37 @@ TEST(ScatterNDOpTest, ScatterND_batched_3tensor_int64) {
   test3.Run();
 }
 
+TEST(ScatterNDOpTest, ScatterND_many_updates_float_int64) {
+  // enough updates/rows to make the offset flattening and the initial clone split across threads
+  constexpr int64_t kNumRows = 512;
+  constexpr int64_t kRowSize = 4;
+  constexpr int64_t kNumUpdates = 256;
+
+  std::vector<float> data(kNumRows * kRowSize);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<float>(i);
+  }
+
+  // scatter into every other row, starting from the back
+  std::vector<int64_t> indices(kNumUpdates);
+  std::vector<float> updates(kNumUpdates * kRowSize);
+  std::vector<float> expected(data);
+  for (int64_t i = 0; i < kNumUpdates; ++i) {
+    const int64_t row = kNumRows - 1 - 2 * i;
+    indices[i] = row;
+    for (int64_t j = 0; j < kRowSize; ++j) {
+      updates[i * kRowSize + j] = static_cast<float>(1000 + i * kRowSize + j);
+      expected[row * kRowSize + j] = updates[i * kRowSize + j];
+    }
+  }
+
+  OpTester test("ScatterND", 11);
+  test.AddInput<float>("data", {kNumRows, kRowSize}, data);
+  test.AddInput<int64_t>("indices", {kNumUpdates, 1}, indices);
+  test.AddInput<float>("updates", {kNumUpdates, kRowSize}, updates);
+  test.AddOutput<float>("output", {kNumRows, kRowSize}, expected);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
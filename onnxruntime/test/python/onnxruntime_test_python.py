@@ -234,6 +234,18 @@ class TestInferenceSession(unittest.TestCase):
         output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
         np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
 
+    def testRunBatch(self):
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        input_name = sess.get_inputs()[0].name
+        output_name = sess.get_outputs()[0].name
+        feeds = [{input_name: np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32) * (i + 1)}
+                 for i in range(8)]
+        results = sess.run_batch([output_name], feeds)
+        self.assertEqual(len(results), len(feeds))
+        for i, res in enumerate(results):
+            x = feeds[i][input_name]
+            np.testing.assert_allclose(x * x, res[0], rtol=1e-05, atol=1e-08)
+
     def testRunModelFromBytes(self):
         with open(get_name("mul_1.onnx"), "rb") as f:
             content = f.read()
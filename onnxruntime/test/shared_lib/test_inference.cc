@@ -13,6 +13,7 @@
 #include <fstream>
 #include <sstream>
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <algorithm>
 #include <gtest/gtest.h>
@@ -179,6 +180,64 @@ TEST_P(CApiTestWithProvider, simple) {
   TestInference<PATH_TYPE, float>(*ort_env, MODEL_URI, inputs, "Y", expected_dims_y, expected_values_y, GetParam(), nullptr, nullptr);
 }
 
+namespace {
+struct RunAsyncTestState {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool called = false;
+  OrtStatusPtr status = nullptr;
+};
+
+void ORT_API_CALL RunAsyncTestCallback(void* user_data, OrtValue** /*outputs*/, size_t /*num_outputs*/,
+                                       OrtStatusPtr status) {
+  auto* state = static_cast<RunAsyncTestState*>(user_data);
+  std::lock_guard<std::mutex> lock(state->mutex);
+  state->status = status;
+  state->called = true;
+  state->cv.notify_one();
+}
+}  // namespace
+
+TEST(CApiTest, run_async) {
+  Ort::SessionOptions session_options;
+  // RunAsync needs a spare thread in the intra-op pool when there is no inter-op pool
+  session_options.SetIntraOpNumThreads(2);
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  std::vector<int64_t> dims_x = {3, 2};
+  std::vector<float> values_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  std::vector<float> expected_values_y = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+
+  auto memory_info = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeDefault);
+  Ort::Value input_tensor = Ort::Value::CreateTensor<float>(memory_info, values_x.data(), values_x.size(),
+                                                            dims_x.data(), dims_x.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  const OrtValue* inputs[] = {input_tensor};
+  OrtValue* outputs[] = {nullptr};
+
+  RunAsyncTestState state;
+  Ort::ThrowOnError(Ort::GetApi().RunAsync(session, nullptr, input_names, inputs, 1, output_names, 1, outputs,
+                                           RunAsyncTestCallback, &state));
+
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.cv.wait(lock, [&state]() { return state.called; });
+  }
+
+  ASSERT_EQ(state.status, nullptr) << Ort::GetApi().GetErrorMessage(state.status);
+  ASSERT_NE(outputs[0], nullptr);
+
+  Ort::Value output_tensor{outputs[0]};
+  auto type_info = output_tensor.GetTensorTypeAndShapeInfo();
+  ASSERT_EQ(type_info.GetShape(), dims_x);
+  const float* values_y = output_tensor.GetTensorMutableData<float>();
+  for (size_t i = 0; i != expected_values_y.size(); ++i) {
+    ASSERT_EQ(values_y[i], expected_values_y[i]);
+  }
+}
+
 TEST(CApiTest, dim_param) {
   Ort::SessionOptions session_options;
   Ort::Session session(*ort_env, NAMED_AND_ANON_DIM_PARAM_URI, session_options);
@@ -0,0 +1,341 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "orttraining/core/framework/binary_checkpoint.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "core/common/common.h"
+#include "core/common/logging/logging.h"
+#include "core/framework/data_transfer_utils.h"
+#include "core/framework/endian_utils.h"
+#include "core/framework/ml_value.h"
+#include "core/platform/path_lib.h"
+
+namespace onnxruntime {
+namespace training {
+
+namespace {
+
+// file identification, with the format version in the last byte
+constexpr char k_magic[8] = {'O', 'R', 'T', 'C', 'K', 'P', 'T', '1'};
+
+// tensor data offsets are aligned so pointers into the mapped file can be used directly
+constexpr uint64_t k_data_alignment = 64;
+
+constexpr const PathChar* k_tensors_file_prefix = ORT_TSTR("tensors.bin.");
+
+PathString GetGenerationFilePath(const PathString& checkpoint_directory, uint64_t generation) {
+  return ConcatPathComponent<PathChar>(
+      checkpoint_directory, k_tensors_file_prefix + ToPathString(std::to_string(generation)));
+}
+
+uint64_t AlignOffset(uint64_t offset) {
+  return (offset + k_data_alignment - 1) / k_data_alignment * k_data_alignment;
+}
+
+uint64_t GetTensorVersion(
+    const std::unordered_map<std::string, uint64_t>& tensor_versions, const std::string& tensor_name) {
+  const auto it = tensor_versions.find(tensor_name);
+  return it != tensor_versions.end() ? it->second : 0;
+}
+
+// serialization helpers - fixed width little-endian values and length prefixed strings
+
+template <typename T>
+void AppendValue(T value, std::vector<char>& buffer) {
+  static_assert(std::is_integral<T>::value, "AppendValue requires an integral type");
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void AppendString(const std::string& value, std::vector<char>& buffer) {
+  AppendValue(static_cast<uint32_t>(value.size()), buffer);
+  buffer.insert(buffer.end(), value.data(), value.data() + value.size());
+}
+
+template <typename T>
+Status ReadValue(gsl::span<const char> bytes, size_t& offset, T& value) {
+  static_assert(std::is_integral<T>::value, "ReadValue requires an integral type");
+  ORT_RETURN_IF(offset + sizeof(T) > static_cast<size_t>(bytes.size()),
+                "Unexpected end of checkpoint file.");
+  std::memcpy(&value, bytes.data() + offset, sizeof(T));
+  offset += sizeof(T);
+  return Status::OK();
+}
+
+Status ReadString(gsl::span<const char> bytes, size_t& offset, std::string& value) {
+  uint32_t length;
+  ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, length));
+  ORT_RETURN_IF(offset + length > static_cast<size_t>(bytes.size()),
+                "Unexpected end of checkpoint file.");
+  value.assign(bytes.data() + offset, length);
+  offset += length;
+  return Status::OK();
+}
+
+size_t GetTensorEntrySize(const std::string& tensor_name, size_t rank) {
+  return sizeof(uint32_t) + tensor_name.size() +  // name
+         sizeof(uint64_t) +                       // version
+         sizeof(int32_t) +                        // data type
+         sizeof(uint32_t) +                       // rank
+         rank * sizeof(int64_t) +                 // dims
+         sizeof(uint64_t) +                       // data offset
+         sizeof(uint64_t);                        // data length
+}
+
+}  // namespace
+
+BinaryCheckpointWriter::BinaryCheckpointWriter(PathString checkpoint_path)
+    : checkpoint_path_{std::move(checkpoint_path)} {
+}
+
+Status BinaryCheckpointWriter::SaveFull(
+    const DataTransferManager& data_transfer_manager,
+    const NameMLValMap& runtime_tensors,
+    const std::unordered_map<std::string, uint64_t>& tensor_versions,
+    const std::unordered_map<std::string, std::string>& properties) {
+  return Save(true, data_transfer_manager, runtime_tensors, tensor_versions, properties);
+}
+
+Status BinaryCheckpointWriter::SaveDelta(
+    const DataTransferManager& data_transfer_manager,
+    const NameMLValMap& runtime_tensors,
+    const std::unordered_map<std::string, uint64_t>& tensor_versions,
+    const std::unordered_map<std::string, std::string>& properties) {
+  if (!has_full_save_) {
+    LOGS_DEFAULT(INFO) << "No full checkpoint was saved through this writer yet - saving a full checkpoint.";
+    return Save(true, data_transfer_manager, runtime_tensors, tensor_versions, properties);
+  }
+
+  return Save(false, data_transfer_manager, runtime_tensors, tensor_versions, properties);
+}
+
+Status BinaryCheckpointWriter::Save(
+    bool full,
+    const DataTransferManager& data_transfer_manager,
+    const NameMLValMap& runtime_tensors,
+    const std::unordered_map<std::string, uint64_t>& tensor_versions,
+    const std::unordered_map<std::string, std::string>& properties) {
+  if (endian::native != endian::little) {
+    ORT_NOT_IMPLEMENTED("binary checkpointing currently requires little-endian host byte order");
+  }
+
+  // determine which tensors this save writes, in a consistent order
+  std::vector<std::string> tensors_to_save{};
+  tensors_to_save.reserve(runtime_tensors.size());
+  for (const auto& name_and_value : runtime_tensors) {
+    const auto& tensor_name = name_and_value.first;
+    const uint64_t version = GetTensorVersion(tensor_versions, tensor_name);
+    const auto saved_it = saved_versions_.find(tensor_name);
+    if (full || saved_it == saved_versions_.end() || saved_it->second != version) {
+      tensors_to_save.push_back(tensor_name);
+    }
+  }
+  std::sort(tensors_to_save.begin(), tensors_to_save.end());
+
+  const uint64_t generation = full ? 0 : generation_ + 1;
+
+  LOGS_DEFAULT(INFO) << "Saving " << (full ? "full" : "delta") << " binary checkpoint (generation "
+                     << generation << ", " << tensors_to_save.size() << " of " << runtime_tensors.size()
+                     << " tensors) to " << ToMBString(checkpoint_path_);
+
+  if (full) {
+    // a full save starts a new delta chain - remove stale delta files from a previous one
+    if (Env::Default().FolderExists(checkpoint_path_)) {
+      ORT_RETURN_IF_ERROR(Env::Default().DeleteFolder(checkpoint_path_));
+    }
+    ORT_RETURN_IF_ERROR(Env::Default().CreateFolder(checkpoint_path_));
+  }
+
+  // lay out the file - header, tensor table, property table, then aligned tensor data
+  size_t metadata_size = sizeof(k_magic) + 3 * sizeof(uint64_t);
+  for (const auto& tensor_name : tensors_to_save) {
+    const Tensor& tensor = runtime_tensors.at(tensor_name).Get<Tensor>();
+    metadata_size += GetTensorEntrySize(tensor_name, tensor.Shape().NumDimensions());
+  }
+  for (const auto& property : properties) {
+    metadata_size += 2 * sizeof(uint32_t) + property.first.size() + property.second.size();
+  }
+
+  std::vector<char> metadata{};
+  metadata.reserve(metadata_size);
+  metadata.insert(metadata.end(), k_magic, k_magic + sizeof(k_magic));
+  AppendValue(generation, metadata);
+  AppendValue(static_cast<uint64_t>(tensors_to_save.size()), metadata);
+  AppendValue(static_cast<uint64_t>(properties.size()), metadata);
+
+  uint64_t data_offset = AlignOffset(metadata_size);
+  for (const auto& tensor_name : tensors_to_save) {
+    const OrtValue& ort_value = runtime_tensors.at(tensor_name);
+    ORT_RETURN_IF_NOT(ort_value.IsTensor(), "Checkpointed value is not a tensor: ", tensor_name);
+    const Tensor& tensor = ort_value.Get<Tensor>();
+    ORT_RETURN_IF(tensor.DataType() == DataTypeImpl::GetType<std::string>(),
+                  "Cannot checkpoint string tensor: ", tensor_name);
+
+    AppendString(tensor_name, metadata);
+    AppendValue(GetTensorVersion(tensor_versions, tensor_name), metadata);
+    AppendValue(static_cast<int32_t>(tensor.GetElementType()), metadata);
+    AppendValue(static_cast<uint32_t>(tensor.Shape().NumDimensions()), metadata);
+    for (const auto dim : tensor.Shape().GetDims()) {
+      AppendValue(dim, metadata);
+    }
+    AppendValue(data_offset, metadata);
+    AppendValue(static_cast<uint64_t>(tensor.SizeInBytes()), metadata);
+
+    data_offset = AlignOffset(data_offset + tensor.SizeInBytes());
+  }
+
+  for (const auto& property : properties) {
+    AppendString(property.first, metadata);
+    AppendString(property.second, metadata);
+  }
+
+  ORT_RETURN_IF_NOT(metadata.size() == metadata_size, "Checkpoint metadata size mismatch.");
+
+  const PathString file_path = GetGenerationFilePath(checkpoint_path_, generation);
+  std::ofstream file{file_path, std::ios::binary};
+  ORT_RETURN_IF_NOT(file, "Failed to open checkpoint file for writing: ", ToMBString(file_path));
+
+  ORT_RETURN_IF_NOT(file.write(metadata.data(), metadata.size()),
+                    "Failed to write to checkpoint file: ", ToMBString(file_path));
+
+  static const OrtMemoryInfo cpu_alloc_info{onnxruntime::CPU, OrtDeviceAllocator};
+  std::vector<char> tensor_data_buffer{};
+  uint64_t current_offset = metadata_size;
+  for (const auto& tensor_name : tensors_to_save) {
+    const Tensor& tensor = runtime_tensors.at(tensor_name).Get<Tensor>();
+
+    tensor_data_buffer.resize(tensor.SizeInBytes());
+    ORT_RETURN_IF_ERROR(CopyTensorDataToByteSpan(
+        data_transfer_manager, tensor, cpu_alloc_info, gsl::make_span(tensor_data_buffer)));
+
+    const uint64_t aligned_offset = AlignOffset(current_offset);
+    const std::string padding(aligned_offset - current_offset, '\0');
+    if (!padding.empty()) {
+      ORT_RETURN_IF_NOT(file.write(padding.data(), padding.size()),
+                        "Failed to write to checkpoint file: ", ToMBString(file_path));
+    }
+    ORT_RETURN_IF_NOT(file.write(tensor_data_buffer.data(), tensor_data_buffer.size()),
+                      "Failed to write to checkpoint file: ", ToMBString(file_path));
+
+    current_offset = aligned_offset + tensor_data_buffer.size();
+  }
+
+  file.close();
+  ORT_RETURN_IF_NOT(!file.fail(), "Failed to close checkpoint file: ", ToMBString(file_path));
+
+  // the save is durable - record what it covered so the next delta only writes newer versions
+  has_full_save_ = true;
+  generation_ = generation;
+  if (full) {
+    saved_versions_.clear();
+  }
+  for (const auto& name_and_value : runtime_tensors) {
+    saved_versions_[name_and_value.first] = GetTensorVersion(tensor_versions, name_and_value.first);
+  }
+
+  LOGS_DEFAULT(INFO) << "Binary checkpoint saved successfully.";
+
+  return Status::OK();
+}
+
+Status BinaryCheckpoint::Load(
+    const PathString& checkpoint_path, std::unique_ptr<BinaryCheckpoint>& checkpoint) {
+  if (endian::native != endian::little) {
+    ORT_NOT_IMPLEMENTED("binary checkpointing currently requires little-endian host byte order");
+  }
+
+  LOGS_DEFAULT(INFO) << "Loading binary checkpoint from " << ToMBString(checkpoint_path);
+
+  std::unique_ptr<BinaryCheckpoint> loaded_checkpoint{new BinaryCheckpoint{}};
+
+  // apply the full snapshot and then each delta in order, so later saves override earlier ones
+  uint64_t generation = 0;
+  for (;; ++generation) {
+    const PathString file_path = GetGenerationFilePath(checkpoint_path, generation);
+    size_t file_size;
+    if (!Env::Default().GetFileLength(file_path.c_str(), file_size).IsOK()) {
+      ORT_RETURN_IF(generation == 0,
+                    "No binary checkpoint found at: ", ToMBString(checkpoint_path));
+      break;
+    }
+
+    ORT_RETURN_IF_ERROR(loaded_checkpoint->LoadGenerationFile(file_path, generation));
+  }
+
+  LOGS_DEFAULT(INFO) << "Binary checkpoint loaded successfully (" << generation << " file(s), "
+                     << loaded_checkpoint->tensors_.size() << " tensors).";
+
+  checkpoint = std::move(loaded_checkpoint);
+
+  return Status::OK();
+}
+
+Status BinaryCheckpoint::LoadGenerationFile(const PathString& file_path, uint64_t expected_generation) {
+  size_t file_size;
+  ORT_RETURN_IF_ERROR(Env::Default().GetFileLength(file_path.c_str(), file_size));
+
+  Env::MappedMemoryPtr mapped_file{};
+  ORT_RETURN_IF_ERROR(Env::Default().MapFileIntoMemory(file_path.c_str(), 0, file_size, mapped_file));
+
+  const gsl::span<const char> bytes{mapped_file.get(), file_size};
+  size_t offset = 0;
+
+  ORT_RETURN_IF(file_size < sizeof(k_magic) ||
+                    std::memcmp(bytes.data(), k_magic, sizeof(k_magic)) != 0,
+                "Not a binary checkpoint file: ", ToMBString(file_path));
+  offset += sizeof(k_magic);
+
+  uint64_t generation, tensor_count, property_count;
+  ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, generation));
+  ORT_RETURN_IF(generation != expected_generation,
+                "Unexpected generation in checkpoint file: ", ToMBString(file_path));
+  ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, tensor_count));
+  ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, property_count));
+
+  for (uint64_t i = 0; i < tensor_count; ++i) {
+    std::string tensor_name;
+    ORT_RETURN_IF_ERROR(ReadString(bytes, offset, tensor_name));
+
+    TensorView tensor_view{};
+    ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, tensor_view.version));
+    ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, tensor_view.data_type));
+
+    uint32_t rank;
+    ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, rank));
+    tensor_view.dims.resize(rank);
+    for (uint32_t dim_idx = 0; dim_idx < rank; ++dim_idx) {
+      ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, tensor_view.dims[dim_idx]));
+    }
+
+    uint64_t data_offset, data_length;
+    ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, data_offset));
+    ORT_RETURN_IF_ERROR(ReadValue(bytes, offset, data_length));
+    ORT_RETURN_IF(data_offset > file_size || data_length > file_size - data_offset,
+                  "Tensor data out of bounds in checkpoint file: ", ToMBString(file_path));
+    tensor_view.data = bytes.subspan(data_offset, data_length);
+
+    tensors_[tensor_name] = std::move(tensor_view);
+  }
+
+  // each file carries the complete property set from its save, so the newest file wins wholesale
+  std::unordered_map<std::string, std::string> loaded_properties{};
+  for (uint64_t i = 0; i < property_count; ++i) {
+    std::string key, value;
+    ORT_RETURN_IF_ERROR(ReadString(bytes, offset, key));
+    ORT_RETURN_IF_ERROR(ReadString(bytes, offset, value));
+    loaded_properties.emplace(std::move(key), std::move(value));
+  }
+  properties_ = std::move(loaded_properties);
+
+  mapped_files_.emplace_back(std::move(mapped_file));
+
+  return Status::OK();
+}
+
+}  // namespace training
+}  // namespace onnxruntime
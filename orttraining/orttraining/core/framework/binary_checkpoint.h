@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/path_string.h"
+#include "core/common/status.h"
+#include "core/framework/data_transfer_manager.h"
+#include "core/framework/framework_common.h"
+#include "core/platform/env.h"
+
+namespace onnxruntime {
+namespace training {
+
+/**
+ * A binary checkpoint is a directory of memory mappable files:
+ * checkpoint/
+ *   tensors.bin.0 - full snapshot of every tensor
+ *   tensors.bin.N - delta files holding only the tensors that changed between save N-1 and save N
+ *
+ * Unlike the protobuf checkpoint format (see checkpointing.h), tensor data is written at aligned
+ * offsets so a restore can memory map the files and read tensor bytes in place, and saves after
+ * the first only write the tensors whose version counter advanced, making save time proportional
+ * to the amount of changed data rather than the model size.
+ */
+
+/**
+ * Writes binary checkpoints, tracking per tensor version counters across saves so that delta
+ * saves only write the tensors that changed. One writer owns one checkpoint directory; saving
+ * a full checkpoint replaces whatever is at that path and starts a new delta chain.
+ */
+class BinaryCheckpointWriter {
+ public:
+  explicit BinaryCheckpointWriter(PathString checkpoint_path);
+
+  /**
+   * Saves every tensor, replacing any existing checkpoint at the path and starting a new
+   * delta chain.
+   *
+   * @param data_transfer_manager The DataTransferManager instance.
+   * @param runtime_tensors The tensors to persist.
+   * @param tensor_versions Version counter per tensor name, advanced by the caller whenever the
+   *        tensor's contents change. Tensors without an entry are treated as version 0.
+   * @param properties The properties to persist. The complete set is written on every save.
+   * @return The status of the operation.
+   */
+  common::Status SaveFull(
+      const DataTransferManager& data_transfer_manager,
+      const NameMLValMap& runtime_tensors,
+      const std::unordered_map<std::string, uint64_t>& tensor_versions,
+      const std::unordered_map<std::string, std::string>& properties);
+
+  /**
+   * Saves only the tensors whose version counter advanced since the last save through this
+   * writer, appending a delta file to the chain. Falls back to a full save when this writer
+   * has not written one yet. The set of tensor names must not shrink within one chain - the
+   * format records changed tensors, not removals.
+   *
+   * Parameters are as for SaveFull.
+   */
+  common::Status SaveDelta(
+      const DataTransferManager& data_transfer_manager,
+      const NameMLValMap& runtime_tensors,
+      const std::unordered_map<std::string, uint64_t>& tensor_versions,
+      const std::unordered_map<std::string, std::string>& properties);
+
+ private:
+  common::Status Save(
+      bool full,
+      const DataTransferManager& data_transfer_manager,
+      const NameMLValMap& runtime_tensors,
+      const std::unordered_map<std::string, uint64_t>& tensor_versions,
+      const std::unordered_map<std::string, std::string>& properties);
+
+  PathString checkpoint_path_;
+  bool has_full_save_{false};
+  uint64_t generation_{0};
+  std::unordered_map<std::string, uint64_t> saved_versions_;
+};
+
+/**
+ * A loaded binary checkpoint. The checkpoint files are memory mapped and the tensor views point
+ * into the mappings, so no tensor data is copied on load and untouched tensors are only paged in
+ * when read. The views stay valid for the lifetime of this object.
+ */
+class BinaryCheckpoint {
+ public:
+  struct TensorView {
+    int32_t data_type;  // ONNX_NAMESPACE::TensorProto_DataType
+    std::vector<int64_t> dims;
+    gsl::span<const char> data;  // view into the mapped checkpoint file
+    uint64_t version;            // version counter recorded when the tensor was saved
+  };
+
+  /**
+   * Loads the binary checkpoint at the specified location, applying the delta files in order
+   * so that each tensor resolves to its most recently saved contents.
+   *
+   * @param checkpoint_path The checkpoint location.
+   * @param checkpoint The loaded checkpoint.
+   * @return The status of the operation.
+   */
+  static common::Status Load(const PathString& checkpoint_path, std::unique_ptr<BinaryCheckpoint>& checkpoint);
+
+  const std::unordered_map<std::string, TensorView>& Tensors() const { return tensors_; }
+  const std::unordered_map<std::string, std::string>& Properties() const { return properties_; }
+
+ private:
+  BinaryCheckpoint() = default;
+
+  common::Status LoadGenerationFile(const PathString& file_path, uint64_t expected_generation);
+
+  std::vector<Env::MappedMemoryPtr> mapped_files_;
+  std::unordered_map<std::string, TensorView> tensors_;
+  std::unordered_map<std::string, std::string> properties_;
+};
+
+}  // namespace training
+}  // namespace onnxruntime
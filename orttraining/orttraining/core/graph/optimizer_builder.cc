@@ -4,6 +4,7 @@
 #include "orttraining/core/graph/optimizer_builder.h"
 #include "orttraining/core/graph/optimizer/adam_optimizer_builder.h"
 #include "orttraining/core/graph/optimizer/lamb_optimizer_builder.h"
+#include "orttraining/core/graph/optimizer/multi_tensor_adam_optimizer_builder.h"
 #include "orttraining/core/graph/optimizer/sgd_optimizer_builder.h"
 
 namespace onnxruntime {
@@ -12,6 +13,7 @@ namespace training {
 // Register all optimizers here.
 void OptimizerBuilderRegistry::RegisterBuilders() {
   GetInstance().Register<AdamOptimizerBuilder>("AdamOptimizer");
+  GetInstance().Register<MultiTensorAdamOptimizerBuilder>("MultiTensorAdamOptimizer");
   GetInstance().Register<LambOptimizerBuilder>("LambOptimizer");
   GetInstance().Register<SGDOptimizerBuilder>("SGDOptimizer");
 }
@@ -320,6 +320,189 @@ OpSchema& RegisterLambOpSchema(OpSchema&& op_schema) {
   return op_schema;
 }
 
+// Multi-tensor variant of AdamOptimizer. It shares AdamOptimizer's update rule
+// and attributes (one entry per updated weight tensor for the FLOATS ones) but
+// follows LambOptimizer's grouped input/output layout so that one node can
+// update many weight tensors with a few packed kernel calls.
+OpSchema& RegisterMultiTensorAdamOpSchema(OpSchema&& op_schema) {
+  op_schema
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .Attr(
+          "alpha",
+          "Coefficient of previous gradient in running average.",
+          AttributeProto::FLOATS,
+          std::vector<float>(1024, 0.9f))
+      .Attr(
+          "beta",
+          "Coefficient of previous squared gradient in running average.",
+          AttributeProto::FLOATS,
+          std::vector<float>(1024, 0.999f))
+      .Attr(
+          "lambda",
+          "Regularization coefficient of 0.5 * lambda * ||X||_2^2. Default to 0, "
+          "which means no regularization.",
+          AttributeProto::FLOATS,
+          std::vector<float>(1024, 0.0f))
+      .Attr(
+          "epsilon",
+          "Small scalar to avoid dividing by zero.",
+          AttributeProto::FLOATS,
+          std::vector<float>(1024, 1e-8f))
+      .Attr(
+          "do_bias_correction",
+          "Compute unbiased 1st and 2nd momentums.",
+          AttributeProto::INT,
+          static_cast<int64_t>(1))
+      .Attr(
+          "weight_decay_mode",
+          "Modes for applying weight decay, "
+          "0 means applying decay before weight update, "
+          "1 means applying decay after weight update.",
+          AttributeProto::INT,
+          static_cast<int64_t>(0))
+      .TypeConstraint(
+          "T1",
+          {"tensor(float16)", "tensor(float)", "tensor(double)", "tensor(bfloat16)"},
+          "Constrain learning rate to float")
+      .TypeConstraint(
+          "T2",
+          {"int64"},
+          "Constrain step count to 64-bit integer")
+      .TypeConstraint(
+          "T3",
+          {"tensor(float)", "tensor(double)"},
+          "Constrain input types to float tensors.")
+      .TypeConstraint(
+          "T4",
+          {"tensor(float16)", "tensor(float)", "tensor(double)", "tensor(bfloat16)"},
+          "Constrain input types to float tensors.")
+      .TypeConstraint(
+          "T_GRAD",
+          {"tensor(float16)", "tensor(float)", "tensor(double)", "tensor(bfloat16)"},
+          "Constrain input types to float tensors.")
+      .TypeConstraint(
+          "T_MIXED_PRECISION_FP",
+          {"tensor(float16)", "tensor(bfloat16)"},
+          "Constrain input types to float16 or bfloat16 tensors.")
+      .TypeConstraint(
+          "T_GRAD_NORM",
+          {"tensor(float16)", "tensor(float)", "tensor(double)", "tensor(bfloat16)"},
+          "Constrain input types to float tensors.")
+      .TypeConstraint(
+          "T_BOOL",
+          {"tensor(bool)"},
+          "Constrain types to boolean tensors.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        // Handle update count, the first output.
+        const size_t step_input_index = 4;
+        const size_t step_output_index = 0;
+        auto input_type = ctx.getInputType(step_input_index);
+        if (input_type != nullptr) {
+          propagateElemTypeFromInputToOutput(ctx, step_input_index, step_output_index);
+          if (hasInputShape(ctx, step_input_index)) {
+            propagateShapeFromInputToOutput(ctx, step_input_index, step_output_index);
+          }
+        }
+
+        // Handle other tensors including new weight, new gradient, new momentums.
+        for (size_t i = 0; i < ctx.getNumInputs() - 5; ++i) {
+          const size_t input_index = 5 + i;   // The first 5 inputs don't affect output shape.
+          const size_t output_index = 1 + i;  // The first output has been processed above.
+          input_type = ctx.getInputType(input_index);
+          if (input_type != nullptr) {
+            propagateElemTypeFromInputToOutput(ctx, input_index, output_index);
+            if (hasInputShape(ctx, input_index)) {
+              propagateShapeFromInputToOutput(ctx, input_index, output_index);
+            }
+          }
+        }
+      });
+
+  op_schema
+      .Input(
+          0,
+          "update_signal",
+          "This signal indicates if weight tensors should be updated.",
+          "T_BOOL",
+          OpSchema::Optional)
+      .Input(
+          1,
+          "loss_scale",
+          "Loss scale for mixed precision training.",
+          "T3",
+          OpSchema::Optional)
+      .Input(
+          2,
+          "gradient_norm",
+          "Norm of global gradient.",
+          "T_GRAD_NORM",
+          OpSchema::Optional)
+      .Input(
+          3,
+          "R",
+          "The initial learning rate.",
+          "T1")
+      .Input(
+          4,
+          "T",
+          "The shared update count. It should be a scalar.",
+          "T2",
+          OpSchema::Optional);
+
+  AddRepeatedInputs(
+      op_schema,
+      5,
+      1024,
+      {"weights",
+       "gradients",
+       "moment1",
+       "moment2",
+       "mixed_precision_weights"},
+      {"weights to optimize.",
+       "gradients computed in this iteration.",
+       "exponentially averaged historical gradients.",
+       "exponentially averaged historical squared gradients.",
+       "FP16 or BF16 weights to optimize."},
+      {"T3",
+       "T_GRAD",
+       "T4",
+       "T4",
+       "T_MIXED_PRECISION_FP"},
+      OpSchema::Optional);
+
+  op_schema
+      .Output(
+          0,
+          "new_T",
+          "New update count.",
+          "T2",
+          OpSchema::Optional);
+
+  AddRepeatedOutputs(
+      op_schema,
+      1,
+      1024,
+      {"new_weights",
+       "new_gradients",
+       "new_moment_1",
+       "new_moment_2",
+       "new_mixed_precision_weights"},
+      {"New weights",
+       "New gradients",
+       "New averaged gradients",
+       "New averaged squared gradients",
+       "New FP16 or BF16 weights"},
+      {"T3",
+       "T_GRAD",
+       "T4",
+       "T4",
+       "T_MIXED_PRECISION_FP"},
+      OpSchema::Optional);
+
+  return op_schema;
+}
+
 void RegisterTrainingOpSchemas() {
   ONNX_CONTRIB_OPERATOR_SCHEMA(ReluGrad)
       .SetDomain(kMSDomain)
@@ -709,6 +892,8 @@ void RegisterTrainingOpSchemas() {
 
   ONNX_CONTRIB_OPERATOR_SCHEMA_ELSEWHERE(LambOptimizer, RegisterLambOpSchema);
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA_ELSEWHERE(MultiTensorAdamOptimizer, RegisterMultiTensorAdamOpSchema);
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(InPlaceAccumulator)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -733,6 +918,32 @@ void RegisterTrainingOpSchemas() {
         propagateShapeAndTypeFromFirstInput(ctx);
       });
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(GemmAccumulator)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(
+          "General matrix multiplication accumulating into C in-place: Y = alpha * A' * B' + C, "
+          "where input A' is transpose(A) if transA is non-zero, and similarly for B'. "
+          "The output aliases the C buffer, fusing the Gemm + InPlaceAccumulator pair "
+          "used for gradient accumulation.")
+      .Attr("transA", "Whether A should be transposed", AttributeProto::INT, static_cast<int64_t>(0))
+      .Attr("transB", "Whether B should be transposed", AttributeProto::INT, static_cast<int64_t>(0))
+      .Attr("alpha", "Scalar multiplier for the product of input tensors A * B.", AttributeProto::FLOAT, 1.0f)
+      .Input(0, "A", "Input tensor A.", "T")
+      .Input(1, "B", "Input tensor B.", "T")
+      .Input(2, "C", "Accumulation buffer, must have the same shape as the output.", "T")
+      .Output(0, "Y", "Updated result of the accumulation, aliasing C.", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float16)", "tensor(float)", "tensor(double)"},
+          "Constrain input and output types to float tensors.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 2, 0);
+        if (hasInputShape(ctx, 2)) {
+          propagateShapeFromInputToOutput(ctx, 2, 0);
+        }
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(ZeroGradient)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "orttraining/core/optimizer/gemm_accumulation_fusion.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+// In-place accumulation allows no broadcast, so buffer and gradient must
+// agree on every dimension and all dimensions must be known.
+static bool HasKnownEqualShape(const NodeArg& lhs, const NodeArg& rhs) {
+  const TensorShapeProto* lhs_shape = lhs.Shape();
+  const TensorShapeProto* rhs_shape = rhs.Shape();
+  if (lhs_shape == nullptr ||
+      rhs_shape == nullptr ||
+      lhs_shape->dim_size() != rhs_shape->dim_size()) {
+    return false;
+  }
+
+  for (int i = 0; i < lhs_shape->dim_size(); ++i) {
+    if (!utils::HasDimValue(lhs_shape->dim(i)) ||
+        !utils::HasDimValue(rhs_shape->dim(i)) ||
+        lhs_shape->dim(i).dim_value() != rhs_shape->dim(i).dim_value()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+Status GemmAccumulationFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    // matching for the Gemm producing the gradient
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Gemm", {7, 9, 11, 13}) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        node.GetOutputEdgesCount() != 1) {
+      continue;
+    }
+
+    // C must not contribute anything to the Gemm: it is either missing or a
+    // constant zero, and beta is 1 (its default).
+    if (node.InputDefs().size() > 2 && node.InputDefs()[2]->Exists() &&
+        !optimizer_utils::IsInitializerWithExpectedValue(graph, *node.InputDefs()[2], 0.0f, true)) {
+      continue;
+    }
+    const NodeAttributes& gemm_attrs = node.GetAttributes();
+    auto beta_iter = gemm_attrs.find("beta");
+    if (beta_iter != gemm_attrs.end() && beta_iter->second.f() != 1.0f) {
+      continue;
+    }
+
+    // Gemm's output is not part of graph output
+    if (!graph.GetNodeOutputsInGraphOutputs(node).empty()) {
+      continue;
+    }
+
+    // matching for the InPlaceAccumulator consuming the gradient
+    const Node& next_node = *node.OutputNodesBegin();
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "InPlaceAccumulator", {1}, kMSDomain) ||
+        next_node.GetExecutionProviderType() != node.GetExecutionProviderType()) {
+      continue;
+    }
+
+    Node& accumulator_node = *graph.GetNode(next_node.Index());
+
+    // The gradient must feed the accumulator's value input, and the
+    // accumulation must be unconditional (no update_signal input).
+    if (accumulator_node.InputDefs()[1]->Name() != node.OutputDefs()[0]->Name() ||
+        (accumulator_node.InputDefs().size() > 2 && accumulator_node.InputDefs()[2]->Exists())) {
+      continue;
+    }
+
+    // The epilogue accumulates in the gradient's own type, so buffer and
+    // gradient must have the same element type (this skips the mixed
+    // precision case where an fp16 gradient feeds an fp32 buffer).
+    NodeArg* buffer_arg = accumulator_node.MutableInputDefs()[0];
+    const NodeArg* gradient_arg = node.OutputDefs()[0];
+    if (buffer_arg->Type() == nullptr || gradient_arg->Type() == nullptr ||
+        *buffer_arg->Type() != *gradient_arg->Type() ||
+        !HasKnownEqualShape(*buffer_arg, *gradient_arg)) {
+      continue;
+    }
+
+    const std::string op_type = "GemmAccumulator";
+    Node& gemm_accumulator_node = graph.AddNode(graph.GenerateNodeName(op_type),
+                                                op_type,
+                                                "fused Gemm and InPlaceAccumulator",
+                                                {node.MutableInputDefs()[0], node.MutableInputDefs()[1], buffer_arg},
+                                                {accumulator_node.MutableOutputDefs()[0]},
+                                                {},
+                                                kMSDomain);
+
+    // Carry over the Gemm attributes; beta is implicitly 1 in the fused node.
+    for (const auto* attr_name : {"transA", "transB", "alpha"}) {
+      auto attr_iter = gemm_attrs.find(attr_name);
+      if (attr_iter != gemm_attrs.end()) {
+        gemm_accumulator_node.AddAttribute(attr_name, attr_iter->second);
+      }
+    }
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    gemm_accumulator_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    // delete the Gemm node and the InPlaceAccumulator node
+    graph_utils::RemoveNodeOutputEdges(graph, node);
+    graph.RemoveNode(node.Index());
+    graph_utils::RemoveNodeOutputEdges(graph, accumulator_node);
+    graph.RemoveNode(accumulator_node.Index());
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
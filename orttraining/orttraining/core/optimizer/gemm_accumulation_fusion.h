@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class GemmAccumulationFusion
+
+Fuse Gemm + InPlaceAccumulator to GemmAccumulator, accumulating the gradient
+into its persistent buffer directly in the Gemm epilogue instead of streaming
+it through memory a second time per accumulation step.
+
+*/
+class GemmAccumulationFusion : public GraphTransformer {
+ public:
+  GemmAccumulationFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("GemmAccumulationFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -40,6 +40,7 @@
 #include "orttraining/core/framework/distributed_run_context.h"
 #include "orttraining/core/optimizer/bias_dropout_fusion.h"
 #include "orttraining/core/optimizer/concat_replacement.h"
+#include "orttraining/core/optimizer/gemm_accumulation_fusion.h"
 #include "orttraining/core/optimizer/insert_output_rewriter.h"
 #include "orttraining/core/optimizer/localized_recompute.h"
 #include "orttraining/core/optimizer/megatron_transformer.h"
@@ -112,6 +113,12 @@ std::vector<std::unique_ptr<GraphTransformer>> GeneratePreTrainingTransformers(
       if (config.attn_dropout_recompute) {
         transformers.emplace_back(onnxruntime::make_unique<AttentionDropoutRecompute>());
       }
+      if (config.attn_softmax_recompute) {
+        transformers.emplace_back(onnxruntime::make_unique<AttentionSoftmaxRecompute>());
+      }
+      if (config.layernorm_recompute) {
+        transformers.emplace_back(onnxruntime::make_unique<LayerNormRecompute>());
+      }
       if (config.transformer_layer_recompute) {
         transformers.emplace_back(onnxruntime::make_unique<TransformerLayerRecompute>(
             config.number_recompute_layers, compatible_eps));
@@ -188,12 +195,14 @@ std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
 
     case TransformerLevel::Level2: {
       std::unordered_set<std::string> cpu_execution_providers = {onnxruntime::kCpuExecutionProvider};
+      std::unordered_set<std::string> cuda_execution_providers = {onnxruntime::kCudaExecutionProvider};
 
       // create rule based transformer consisting of all the level2 rewrite rules
       rule_transformer = optimizer_utils::GenerateRuleBasedGraphTransformer(level, transformers_and_rules_to_enable, cpu_execution_providers);
 
       transformers.emplace_back(onnxruntime::make_unique<GemmActivationFusion>(cpu_execution_providers));
       transformers.emplace_back(onnxruntime::make_unique<ConvActivationFusion>(cpu_execution_providers));
+      transformers.emplace_back(onnxruntime::make_unique<GemmAccumulationFusion>(cuda_execution_providers));
     } break;
 
     case TransformerLevel::Level3: {
@@ -10,6 +10,28 @@ using namespace ONNX_NAMESPACE;
 
 namespace onnxruntime {
 
+// Clone `node` into a low-priority recompute node producing the
+// "Recomputed_" counterpart of its first output, which the gradient builder
+// prefers over the original when wiring the backward graph.
+static void InsertRecomputeNode(Graph& graph, Node& node, bool& modified) {
+  const auto& output = node.OutputDefs()[0];
+
+  auto& recomputed_output = graph.GetOrCreateNodeArg(graph_utils::RecomputeName(output->Name()),
+                                                     output->TypeAsProto());
+
+  Node& recompute_node = graph.AddNode(node.Name() + "_recompute",
+                                       node.OpType(),
+                                       "Recompute of " + node.Name(),
+                                       node.MutableInputDefs(),
+                                       {&recomputed_output},
+                                       &node.GetAttributes(),
+                                       node.Domain());
+
+  recompute_node.SetPriority(static_cast<int>(ExecutionPriority::LOCAL_LOW));
+
+  modified = true;
+}
+
 bool GeluRecompute::SatisfyCondition(const Node& node) const {
   static const std::unordered_set<std::string> target_optypes = {"Gelu", "FastGelu", "BiasGelu"};
   if (target_optypes.find(node.OpType()) == target_optypes.end()) {
@@ -36,22 +58,83 @@ Status GeluRecompute::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*
       continue;
     }
 
-    const auto& output = node.OutputDefs()[0];
+    InsertRecomputeNode(graph, node, modified);
+  }
 
-    auto& recomputed_output = graph.GetOrCreateNodeArg(graph_utils::RecomputeName(output->Name()),
-                                                       output->TypeAsProto());
+  return Status::OK();
+}
 
-    Node& recompute_node = graph.AddNode(node.Name() + "_recompute",
-                                         node.OpType(),
-                                         "Recompute of " + node.Name(),
-                                         node.MutableInputDefs(),
-                                         {&recomputed_output},
-                                         &node.GetAttributes(),
-                                         node.Domain());
+bool LayerNormRecompute::SatisfyCondition(const Node& node) const {
+  static const std::unordered_set<std::string> target_optypes = {"LayerNormalization", "SimplifiedLayerNormalization"};
+  if (target_optypes.find(node.OpType()) == target_optypes.end()) {
+    return false;
+  }
 
-    recompute_node.SetPriority(static_cast<int>(ExecutionPriority::LOCAL_LOW));
+  // Only worth recomputing when the normalized output is kept alive as an
+  // activation input of a MatMul's (or fused Attention's) gradient.
+  for (auto it = node.OutputNodesBegin(); it != node.OutputNodesEnd(); ++it) {
+    if (it->OpType() == "MatMul" || it->OpType() == "Attention") {
+      return true;
+    }
+  }
+  return false;
+}
 
-    modified = true;
+Status LayerNormRecompute::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/, const logging::Logger& /*logger*/) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_ids = graph_viewer.GetNodesInTopologicalOrder();
+
+  // Traverse backward from the bottom of the graph, so that the recompute nodes
+  // for lower layers are executed earlier
+  for (int i = static_cast<int>(node_ids.size() - 1); i >= 0; --i) {
+    Node& node = *graph.GetNode(node_ids[i]);
+
+    if (!SatisfyCondition(node)) {
+      continue;
+    }
+
+    InsertRecomputeNode(graph, node, modified);
+  }
+
+  return Status::OK();
+}
+
+bool AttentionSoftmaxRecompute::SatisfyCondition(const Node& node) const {
+  if (node.OpType() != "Softmax")
+    return false;
+
+  // The attention softmax output feeds the value MatMul, either directly or
+  // through the attention dropout.
+  const auto next_node = node.OutputNodesBegin();
+  if (next_node == node.OutputNodesEnd()) {
+    return false;
+  }
+  if (next_node->OpType() == "MatMul") {
+    return true;
+  }
+  if (next_node->OpType() == "Dropout") {
+    const auto next_next_node = next_node->OutputNodesBegin();
+    if (next_next_node != next_node->OutputNodesEnd() && next_next_node->OpType() == "MatMul") {
+      return true;
+    }
+  }
+  return false;
+}
+
+Status AttentionSoftmaxRecompute::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/, const logging::Logger& /*logger*/) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_ids = graph_viewer.GetNodesInTopologicalOrder();
+
+  // Traverse backward from the bottom of the graph, so that the recompute nodes
+  // for lower layers are executed earlier
+  for (int i = static_cast<int>(node_ids.size() - 1); i >= 0; --i) {
+    Node& node = *graph.GetNode(node_ids[i]);
+
+    if (!SatisfyCondition(node)) {
+      continue;
+    }
+
+    InsertRecomputeNode(graph, node, modified);
   }
 
   return Status::OK();
@@ -198,6 +198,10 @@ class TrainingSession : public InferenceSession {
       bool attn_dropout_recompute{false};
       // Enable recompute of Gelu activation output to save memory
       bool gelu_recompute{false};
+      // Enable recompute of attention softmax to save memory
+      bool attn_softmax_recompute{false};
+      // Enable recompute of LayerNorm output to save memory
+      bool layernorm_recompute{false};
       // Enable recompute of transformer layer ouput to save memory
       bool transformer_layer_recompute{false};
       // Number of layers to apply recompute
@@ -186,6 +186,10 @@ Status ParseArguments(int argc, char* argv[], BertParameters& params, OrtParamet
         cxxopts::value<bool>()->default_value("false"))
       ("gelu_recompute", "Enable checkpointing of Gelu activation output to save memory.",
         cxxopts::value<bool>()->default_value("false"))
+      ("attn_softmax_recompute", "Enable checkpointing of attention softmax to save memory.",
+        cxxopts::value<bool>()->default_value("false"))
+      ("layernorm_recompute", "Enable checkpointing of LayerNorm output to save memory.",
+        cxxopts::value<bool>()->default_value("false"))
       ("transformer_layer_recompute", "Enable checkpointing of transformer layer output to save memory.",
         cxxopts::value<bool>()->default_value("false"))
       ("number_recompute_layers", "Number of layers to apply recompute.",
@@ -482,6 +486,8 @@ Status ParseArguments(int argc, char* argv[], BertParameters& params, OrtParamet
     params.enable_gelu_approximation = flags["enable_gelu_approximation"].as<bool>();
     params.attn_dropout_recompute = flags["attn_dropout_recompute"].as<bool>();
     params.gelu_recompute = flags["gelu_recompute"].as<bool>();
+    params.attn_softmax_recompute = flags["attn_softmax_recompute"].as<bool>();
+    params.layernorm_recompute = flags["layernorm_recompute"].as<bool>();
     params.transformer_layer_recompute = flags["transformer_layer_recompute"].as<bool>();
     params.number_recompute_layers = flags["number_recompute_layers"].as<int>();
 
@@ -55,7 +55,7 @@ std::ostream& operator<<(std::ostream& stream, const PipelineTask& slot) {
     throw std::invalid_argument("Unsupported pass type.");
   }
   std::ios state(nullptr);
-  state.copyfmt(state);
+  state.copyfmt(stream);
   stream << std::setw(2) << std::setfill('0') << slot.batch;
   stream.copyfmt(state);
   return stream;
@@ -129,7 +129,7 @@ std::ostream& operator<<(std::ostream& stream, const PipelineSlot& slot) {
   return stream;
 }
 
-void PipelineSlot::SetWaitedEvent(const std::vector<int> events) {
+void PipelineSlot::SetWaitedEvent(std::vector<int> events) {
   waited_events_ = std::move(events);
 }
 
@@ -137,7 +137,7 @@ std::vector<int> PipelineSlot::GetWaitedEvent() const {
   return waited_events_;
 }
 
-void PipelineSlot::SetRecordedEvent(const std::vector<int> events) {
+void PipelineSlot::SetRecordedEvent(std::vector<int> events) {
   recorded_events_ = std::move(events);
 }
 
@@ -124,9 +124,9 @@ class PipelineSlot {
   // Print this structure following a fixed-length format.
   // It assumes there are at most 2 actions per slot.
   friend std::ostream& operator<<(std::ostream& stream, const PipelineSlot& slot);
-  void SetWaitedEvent(const std::vector<int> event);
+  void SetWaitedEvent(std::vector<int> event);
   std::vector<int> GetWaitedEvent() const;
-  void SetRecordedEvent(const std::vector<int> event);
+  void SetRecordedEvent(std::vector<int> event);
   std::vector<int> GetRecordedEvent() const;
 
   std::vector<PipelineTask> GetTasks() { return tasks_; }
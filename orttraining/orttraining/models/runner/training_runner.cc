@@ -186,6 +186,8 @@ Status TrainingRunner::Initialize() {
     gt_config.enable_gelu_approximation = params_.enable_gelu_approximation;
     gt_config.attn_dropout_recompute = params_.attn_dropout_recompute;
     gt_config.gelu_recompute = params_.gelu_recompute;
+    gt_config.attn_softmax_recompute = params_.attn_softmax_recompute;
+    gt_config.layernorm_recompute = params_.layernorm_recompute;
     gt_config.transformer_layer_recompute = params_.transformer_layer_recompute;
     gt_config.number_recompute_layers = params_.number_recompute_layers;
 
@@ -129,6 +129,14 @@ class ORTTrainerOptions(object):
                             'type': 'boolean',
                             'default': False
                         },
+                        'attn_softmax_recompute': {
+                            'type': 'boolean',
+                            'default': False
+                        },
+                        'layernorm_recompute': {
+                            'type': 'boolean',
+                            'default': False
+                        },
                         'transformer_layer_recompute': {
                             'type': 'boolean',
                             'default': False
@@ -251,6 +259,10 @@ class ORTTrainerOptions(object):
             enable recomputing attention dropout to save memory
         gelu_recompute (bool, default is False):
             enable recomputing Gelu activation output to save memory
+        attn_softmax_recompute (bool, default is False):
+            enable recomputing attention softmax to save memory
+        layernorm_recompute (bool, default is False):
+            enable recomputing LayerNorm output to save memory
         transformer_layer_recompute (bool, default is False):
             enable recomputing transformer layerwise to save memory
         number_recompute_layers (int, default is 0)
@@ -483,6 +495,14 @@ _ORTTRAINER_OPTIONS_SCHEMA = {
                 'type': 'boolean',
                 'default': False
             },
+            'attn_softmax_recompute': {
+                'type': 'boolean',
+                'default': False
+            },
+            'layernorm_recompute': {
+                'type': 'boolean',
+                'default': False
+            },
             'transformer_layer_recompute': {
                 'type': 'boolean',
                 'default': False
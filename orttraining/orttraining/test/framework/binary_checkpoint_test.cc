@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "orttraining/core/framework/binary_checkpoint.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "core/common/common.h"
+#include "core/framework/data_transfer.h"
+#include "core/framework/ml_value.h"
+#include "core/framework/tensor.h"
+#include "core/framework/tensorprotoutils.h"
+#include "core/platform/path_lib.h"
+#include "test/util/include/asserts.h"
+#include "test/util/include/temp_dir.h"
+
+using onnxruntime::test::TemporaryDirectory;
+
+namespace onnxruntime {
+namespace training {
+namespace test {
+
+namespace {
+const OrtMemoryInfo cpu_alloc_info(onnxruntime::CPU, OrtDeviceAllocator);
+
+class OrtValueTensorData {
+ public:
+  OrtValueTensorData(TensorShape shape, std::vector<float> data) {
+    ORT_ENFORCE(shape.Size() == static_cast<int64_t>(data.size()));
+    shape_ = std::move(shape);
+    data_ = std::move(data);
+  }
+
+  OrtValue GetOrtValue() {
+    return OrtValue(
+        new Tensor(DataTypeImpl::GetType<float>(), shape_, data_.data(), cpu_alloc_info),
+        DataTypeImpl::GetType<Tensor>(), DataTypeImpl::GetType<Tensor>()->GetDeleteFunc());
+  }
+
+  std::vector<float>& Data() { return data_; }
+
+ private:
+  TensorShape shape_;
+  std::vector<float> data_;
+};
+
+void CheckTensorView(
+    const BinaryCheckpoint& checkpoint,
+    const std::string& name,
+    const std::vector<int64_t>& expected_dims,
+    const std::vector<float>& expected_data) {
+  const auto& tensors = checkpoint.Tensors();
+  const auto it = tensors.find(name);
+  ASSERT_NE(it, tensors.end());
+
+  const auto& tensor_view = it->second;
+  ASSERT_EQ(tensor_view.data_type, ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  ASSERT_EQ(tensor_view.dims, expected_dims);
+  ASSERT_EQ(static_cast<size_t>(tensor_view.data.size()), expected_data.size() * sizeof(float));
+  ASSERT_EQ(std::memcmp(tensor_view.data.data(), expected_data.data(), tensor_view.data.size()), 0);
+}
+}  // namespace
+
+TEST(BinaryCheckpointTest, SaveFullAndLoad) {
+  std::unordered_map<std::string, OrtValueTensorData> name_to_ort_value_data{
+      {"first", {{3}, {1.0f, 2.0f, 3.0f}}},
+      {"second", {{2, 2}, {1.0f, 2.0f, 3.0f, 4.0f}}},
+  };
+
+  NameMLValMap name_to_ort_value{};
+  for (auto& name_and_ort_value_data : name_to_ort_value_data) {
+    name_to_ort_value.emplace(
+        name_and_ort_value_data.first, name_and_ort_value_data.second.GetOrtValue());
+  }
+
+  std::unordered_map<std::string, uint64_t> tensor_versions{
+      {"first", 1},
+      {"second", 1},
+  };
+
+  std::unordered_map<std::string, std::string> properties{
+      {"one", "1"},
+      {"two", "2"},
+  };
+
+  TemporaryDirectory tmp_dir{ORT_TSTR("binary_checkpoint_test_dir")};
+  PathString checkpoint_path{
+      ConcatPathComponent<PathChar>(tmp_dir.Path(), ORT_TSTR("test_checkpoint"))};
+
+  DataTransferManager data_transfer{};
+  ASSERT_STATUS_OK(data_transfer.RegisterDataTransfer(onnxruntime::make_unique<CPUDataTransfer>()));
+
+  BinaryCheckpointWriter writer{checkpoint_path};
+  ASSERT_STATUS_OK(writer.SaveFull(
+      data_transfer, name_to_ort_value, tensor_versions, properties));
+
+  std::unique_ptr<BinaryCheckpoint> checkpoint{};
+  ASSERT_STATUS_OK(BinaryCheckpoint::Load(checkpoint_path, checkpoint));
+
+  ASSERT_EQ(checkpoint->Properties(), properties);
+  ASSERT_EQ(checkpoint->Tensors().size(), name_to_ort_value.size());
+  CheckTensorView(*checkpoint, "first", {3}, {1.0f, 2.0f, 3.0f});
+  CheckTensorView(*checkpoint, "second", {2, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+}
+
+TEST(BinaryCheckpointTest, DeltaSaveOnlyWritesChangedTensors) {
+  std::unordered_map<std::string, OrtValueTensorData> name_to_ort_value_data{
+      {"first", {{3}, {1.0f, 2.0f, 3.0f}}},
+      {"second", {{2, 2}, {1.0f, 2.0f, 3.0f, 4.0f}}},
+  };
+
+  NameMLValMap name_to_ort_value{};
+  for (auto& name_and_ort_value_data : name_to_ort_value_data) {
+    name_to_ort_value.emplace(
+        name_and_ort_value_data.first, name_and_ort_value_data.second.GetOrtValue());
+  }
+
+  std::unordered_map<std::string, uint64_t> tensor_versions{
+      {"first", 1},
+      {"second", 1},
+  };
+
+  std::unordered_map<std::string, std::string> properties{
+      {"step", "100"},
+  };
+
+  TemporaryDirectory tmp_dir{ORT_TSTR("binary_checkpoint_test_dir")};
+  PathString checkpoint_path{
+      ConcatPathComponent<PathChar>(tmp_dir.Path(), ORT_TSTR("test_checkpoint"))};
+
+  DataTransferManager data_transfer{};
+  ASSERT_STATUS_OK(data_transfer.RegisterDataTransfer(onnxruntime::make_unique<CPUDataTransfer>()));
+
+  BinaryCheckpointWriter writer{checkpoint_path};
+  ASSERT_STATUS_OK(writer.SaveFull(
+      data_transfer, name_to_ort_value, tensor_versions, properties));
+
+  // change one tensor in place and advance its version counter
+  auto& first_data = name_to_ort_value_data.at("first").Data();
+  first_data = {10.0f, 20.0f, 30.0f};
+  tensor_versions["first"] = 2;
+  properties["step"] = "200";
+
+  ASSERT_STATUS_OK(writer.SaveDelta(
+      data_transfer, name_to_ort_value, tensor_versions, properties));
+
+  // the delta file holds only the changed tensor, so it is smaller than the full snapshot
+  size_t full_file_size, delta_file_size;
+  ASSERT_STATUS_OK(Env::Default().GetFileLength(
+      ConcatPathComponent<PathChar>(checkpoint_path, ORT_TSTR("tensors.bin.0")).c_str(), full_file_size));
+  ASSERT_STATUS_OK(Env::Default().GetFileLength(
+      ConcatPathComponent<PathChar>(checkpoint_path, ORT_TSTR("tensors.bin.1")).c_str(), delta_file_size));
+  ASSERT_LT(delta_file_size, full_file_size);
+
+  std::unique_ptr<BinaryCheckpoint> checkpoint{};
+  ASSERT_STATUS_OK(BinaryCheckpoint::Load(checkpoint_path, checkpoint));
+
+  ASSERT_EQ(checkpoint->Properties(), properties);
+  ASSERT_EQ(checkpoint->Tensors().size(), name_to_ort_value.size());
+  CheckTensorView(*checkpoint, "first", {3}, {10.0f, 20.0f, 30.0f});
+  CheckTensorView(*checkpoint, "second", {2, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+  ASSERT_EQ(checkpoint->Tensors().at("first").version, 2u);
+
+  // a delta save with no changed tensors still records the latest properties
+  properties["step"] = "300";
+  ASSERT_STATUS_OK(writer.SaveDelta(
+      data_transfer, name_to_ort_value, tensor_versions, properties));
+
+  ASSERT_STATUS_OK(BinaryCheckpoint::Load(checkpoint_path, checkpoint));
+  ASSERT_EQ(checkpoint->Properties(), properties);
+  CheckTensorView(*checkpoint, "first", {3}, {10.0f, 20.0f, 30.0f});
+}
+
+}  // namespace test
+}  // namespace training
+}  // namespace onnxruntime
@@ -365,6 +365,102 @@ TEST(OptimizerTest, AdamOptimizerMixPrecisionTest_Gradient) {
   test.Run();
 }
 
+TEST(OptimizerTest, MultiTensorAdamOptimizerTest) {
+  OpTester test("MultiTensorAdamOptimizer", 1, onnxruntime::kMSDomain);
+  AdamOptimizerInputOutput data;
+
+  // Update two identical weight tensors in one node. Their per-tensor
+  // results should match the single-tensor AdamOptimizer baselines.
+  constexpr int group_count = 2;
+
+  test.AddMissingOptionalInput<bool>();
+  test.AddMissingOptionalInput<float>();
+  test.AddMissingOptionalInput<float>();
+  test.AddInput<float>("ETA", {}, data.eta);
+  test.AddInput<int64_t>("Step", {}, {3});
+
+  test.AddOutput<int64_t>("Step_Out", {}, {4});
+
+  for (int i = 0; i < group_count; ++i) {
+    std::string w_name = "W_" + std::to_string(i);
+    std::string g_name = "G_" + std::to_string(i);
+    std::string m1_name = "Moment_1_" + std::to_string(i);
+    std::string m2_name = "Moment_2_" + std::to_string(i);
+    std::string w_new_name = "W_Out_" + std::to_string(i);
+    std::string m1_new_name = "Moment_1_Out_" + std::to_string(i);
+    std::string m2_new_name = "Moment_2_Out_" + std::to_string(i);
+
+    test.AddInput<float>(w_name.c_str(), {3}, data.w);
+    test.AddInput<float>(g_name.c_str(), {3}, data.g);
+    test.AddInput<float>(m1_name.c_str(), {3}, data.m1);
+    test.AddInput<float>(m2_name.c_str(), {3}, data.m2);
+    test.AddMissingOptionalInput<MLFloat16>();
+
+    test.AddOutput<float>(w_new_name.c_str(), {3}, data.w_new);
+    test.AddMissingOptionalOutput<float>();
+    test.AddOutput<float>(m1_new_name.c_str(), {3}, data.m1_new);
+    test.AddOutput<float>(m2_new_name.c_str(), {3}, data.m2_new);
+    test.AddMissingOptionalOutput<MLFloat16>();
+  }
+
+  test.AddAttribute("alpha", std::vector<float>(group_count, 0.9f));
+  test.AddAttribute("beta", std::vector<float>(group_count, 0.999f));
+  test.AddAttribute("lambda", std::vector<float>(group_count, 0.0f));
+  test.AddAttribute("epsilon", std::vector<float>(group_count, 1e-8f));
+  test.AddAttribute("do_bias_correction", static_cast<int64_t>(0));
+  test.AddAttribute("weight_decay_mode", static_cast<int64_t>(0));
+
+  test.Run();
+}
+
+TEST(OptimizerTest, MultiTensorAdamOptimizerTest_Gradient) {
+  OpTester test("MultiTensorAdamOptimizer", 1, onnxruntime::kMSDomain);
+  AdamOptimizerInputOutput data;
+
+  test.AddMissingOptionalInput<bool>();
+  test.AddMissingOptionalInput<float>();
+  test.AddMissingOptionalInput<float>();
+  test.AddInput<float>("ETA", {}, data.eta);
+  test.AddInput<int64_t>("Step", {}, {3});
+
+  test.AddOutput<int64_t>("Step_Out", {}, {4});
+
+  // The first group produces a new weight tensor while the second
+  // group produces a new gradient tensor.
+  test.AddInput<float>("W_0", {3}, data.w);
+  test.AddInput<float>("G_0", {3}, data.g);
+  test.AddInput<float>("Moment_1_0", {3}, data.m1);
+  test.AddInput<float>("Moment_2_0", {3}, data.m2);
+  test.AddMissingOptionalInput<MLFloat16>();
+
+  test.AddOutput<float>("W_Out_0", {3}, data.w_new);
+  test.AddMissingOptionalOutput<float>();
+  test.AddOutput<float>("Moment_1_Out_0", {3}, data.m1_new);
+  test.AddOutput<float>("Moment_2_Out_0", {3}, data.m2_new);
+  test.AddMissingOptionalOutput<MLFloat16>();
+
+  test.AddInput<float>("W_1", {3}, data.w);
+  test.AddInput<float>("G_1", {3}, data.g);
+  test.AddInput<float>("Moment_1_1", {3}, data.m1);
+  test.AddInput<float>("Moment_2_1", {3}, data.m2);
+  test.AddMissingOptionalInput<MLFloat16>();
+
+  test.AddMissingOptionalOutput<float>();
+  test.AddOutput<float>("G_Out_1", {3}, data.g_new);
+  test.AddOutput<float>("Moment_1_Out_1", {3}, data.m1_new);
+  test.AddOutput<float>("Moment_2_Out_1", {3}, data.m2_new);
+  test.AddMissingOptionalOutput<MLFloat16>();
+
+  test.AddAttribute("alpha", std::vector<float>(2, 0.9f));
+  test.AddAttribute("beta", std::vector<float>(2, 0.999f));
+  test.AddAttribute("lambda", std::vector<float>(2, 0.0f));
+  test.AddAttribute("epsilon", std::vector<float>(2, 1e-8f));
+  test.AddAttribute("do_bias_correction", static_cast<int64_t>(0));
+  test.AddAttribute("weight_decay_mode", static_cast<int64_t>(0));
+
+  test.Run();
+}
+
 // This helper function is a CPU-based LAMB optimizer
 // implementation. It mainly focuses on readability.
 void compute_lamb(
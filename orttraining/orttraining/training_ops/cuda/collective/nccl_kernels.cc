@@ -54,7 +54,7 @@ Status NcclAllGather::ComputeInternal(OpKernelContext* context) const {
   // so pad to multiple of 32 and world size.
   // Note: the alignment here needs to be kept in-sync with the alignment in zero_optimizer_graph_builder.cc
   const int64_t alignment = size * 32;
-  const int64_t padded_count = total_count + alignment - (total_count % alignment);
+  const int64_t padded_count = total_count % alignment == 0 ? total_count : total_count + alignment - (total_count % alignment);
   const int64_t padded_size = padded_count * element_size;
   auto fusion_buffer = GetScratchBuffer<void>(padded_size);
   void* fusion_data = fusion_buffer.get();
@@ -143,7 +143,7 @@ Status NcclReduceScatter::ComputeInternal(OpKernelContext* context) const {
   // so pad to multiple of 32 and world size.
   // Note: the alignment here needs to be kept in-sync with the alignment in zero_optimizer_graph_builder.cc
   const int64_t alignment = size * 32;
-  const int64_t padded_count = total_count + alignment - (total_count % alignment);
+  const int64_t padded_count = total_count % alignment == 0 ? total_count : total_count + alignment - (total_count % alignment);
   const int64_t padded_size = padded_count * element_size;
   auto fusion_buffer = GetScratchBuffer<void>(padded_size);
   void* fusion_data = fusion_buffer.get();
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "orttraining/training_ops/cuda/math/gemm_accumulator.h"
+#include "core/providers/cpu/math/gemm_helper.h"
+#include "core/providers/cuda/cuda_common.h"
+#include "core/providers/cuda/shared_inc/fpgeneric.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+#define REGISTER_GEMM_ACCUMULATOR_TYPED(T)                         \
+  ONNX_OPERATOR_TYPED_KERNEL_EX(                                   \
+      GemmAccumulator,                                             \
+      kMSDomain,                                                   \
+      1,                                                           \
+      T,                                                           \
+      kCudaExecutionProvider,                                      \
+      KernelDefBuilder()                                           \
+          .Alias(2, 0) /* Accumulate into C in-place */            \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<T>()),  \
+      GemmAccumulator<T>);
+
+REGISTER_GEMM_ACCUMULATOR_TYPED(float)
+REGISTER_GEMM_ACCUMULATOR_TYPED(double)
+REGISTER_GEMM_ACCUMULATOR_TYPED(MLFloat16)
+
+template <typename T>
+Status GemmAccumulator<T>::ComputeInternal(OpKernelContext* ctx) const {
+  typedef typename ToCudaType<T>::MappedType CudaT;
+
+  const auto* A = ctx->Input<Tensor>(0);
+  const auto* B = ctx->Input<Tensor>(1);
+  const auto* C = ctx->Input<Tensor>(2);
+  GemmHelper helper(A->Shape(), trans_A_, B->Shape(), trans_B_, C->Shape());
+
+  if (!helper.State().IsOK())
+    return helper.State();
+
+  int M = gsl::narrow_cast<int>(helper.M());
+  int N = gsl::narrow_cast<int>(helper.N());
+  int K = gsl::narrow_cast<int>(helper.K());
+  ORT_RETURN_IF_NOT(C->Shape() == TensorShape({M, N}),
+                    "In-place accumulation requires C to have the same shape as the output.");
+
+  auto* Y = ctx->Output(0, {M, N});
+  CudaT* out_data = reinterpret_cast<CudaT*>(Y->template MutableData<T>());
+  const CudaT* c_data = reinterpret_cast<const CudaT*>(C->template Data<T>());
+
+  // The output normally aliases C; copy only if the allocation planner could not reuse the buffer.
+  if (out_data != c_data) {
+    CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(out_data, c_data, M * N * sizeof(T), cudaMemcpyDeviceToDevice));
+  }
+
+  CudaT alpha = ToCudaType<T>::FromFloat(alpha_);
+  CudaT one = ToCudaType<T>::FromFloat(1.0f);
+  auto& device_prop = GetDeviceProp();
+  // Gemm, note that CUDA assumes col-major, so Y(N,M) = alpha * op(W) x op(X) + 1 * Y
+  CUBLAS_RETURN_IF_ERROR(cublasGemmHelper(
+      CublasHandle(),
+      trans_B_ ? CUBLAS_OP_T : CUBLAS_OP_N,
+      trans_A_ ? CUBLAS_OP_T : CUBLAS_OP_N,
+      N, M, K,
+      &alpha,
+      reinterpret_cast<const CudaT*>(B->template Data<T>()),
+      (trans_B_ ? K : N),
+      reinterpret_cast<const CudaT*>(A->template Data<T>()),
+      (trans_A_ ? M : K),
+      &one,
+      out_data, N, device_prop));
+
+  return Status::OK();
+}
+
+}  // namespace cuda
+}  // namespace onnxruntime
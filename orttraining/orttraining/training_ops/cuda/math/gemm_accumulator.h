@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/providers/cuda/cuda_common.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+// Gemm whose epilogue accumulates into the C buffer in-place:
+//   Y = alpha * op(A) * op(B) + C, with Y aliasing C.
+// This is the fused form of the Gemm + InPlaceAccumulator pair emitted for
+// gradient accumulation; aliasing C keeps the accumulation buffer updated
+// across runs without streaming the gradient through memory a second time.
+template <typename T>
+class GemmAccumulator final : public CudaKernel {
+ public:
+  GemmAccumulator(const OpKernelInfo& info) : CudaKernel(info) {
+    int64_t temp;
+    info.GetAttrOrDefault<int64_t>("transA", &temp, int64_t(0));
+    trans_A_ = (temp != 0);
+
+    info.GetAttrOrDefault<int64_t>("transB", &temp, int64_t(0));
+    trans_B_ = (temp != 0);
+
+    info.GetAttrOrDefault<float>("alpha", &alpha_, 1.0f);
+  }
+
+  Status ComputeInternal(OpKernelContext* context) const override;
+
+ private:
+  bool trans_A_;
+  bool trans_B_;
+  float alpha_;
+};
+
+}  // namespace cuda
+}  // namespace onnxruntime
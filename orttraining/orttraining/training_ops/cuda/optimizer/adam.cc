@@ -150,5 +150,361 @@ Status AdamOptimizer<T1, T2, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP>:
   return Status::OK();
 }
 
+std::vector<std::pair<int, int>> GenerateMultiTensorAdamExtraAliasMapping() {
+  // Starting index of extra inputs.
+  constexpr int input_index_bias = 5;
+  // Starting index of extra outputs.
+  constexpr int output_index_bias = 1;
+  // Count of extra I/O groups. One group corresponds to a weight update.
+  constexpr int group_count = 1024;
+  // length of [w, g, m1, m2, w_mixed_precision].
+  constexpr int input_stride = 5;
+  // length of [w_new, g_new, m1_new, m2_new, w_mixed_precision_new].
+  constexpr int output_stride = 5;
+
+  std::vector<std::pair<int, int>> alias_pairs{};
+  for (int i = 0; i < group_count; ++i) {
+    const int input = input_index_bias + i * input_stride;
+    const int output = output_index_bias + i * output_stride;
+    // w --> w_new
+    alias_pairs.emplace_back(std::make_pair(input, output));
+    // g --> g_new
+    alias_pairs.emplace_back(std::make_pair(input + 1, output + 1));
+    // m1 --> m1_new
+    alias_pairs.emplace_back(std::make_pair(input + 2, output + 2));
+    // m2 --> m2_new
+    alias_pairs.emplace_back(std::make_pair(input + 3, output + 3));
+    // w_mixed_precision --> w_mixed_precision_new
+    alias_pairs.emplace_back(std::make_pair(input + 4, output + 4));
+  }
+
+  // update_count is updated in place.
+  alias_pairs.emplace_back(std::make_pair(4, 0));
+
+  return alias_pairs;
+}
+
+#define REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(T1, T2, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP) \
+  ONNX_OPERATOR_TYPED_KERNEL_EX(                                                                           \
+      MultiTensorAdamOptimizer,                                                                            \
+      kMSDomain,                                                                                           \
+      1,                                                                                                   \
+      T1##_##T2##_##T3##_##T4##_##T_GRAD##_##T_GRAD_NORM##_##T_MIXED_PRECISION_FP,                         \
+      kCudaExecutionProvider,                                                                              \
+      KernelDefBuilder()                                                                                   \
+          .Alias(GenerateMultiTensorAdamExtraAliasMapping())                                               \
+          .InputMemoryType<OrtMemTypeCPUInput>(0)   /* Keep update_signal in CPU */                        \
+          .InputMemoryType<OrtMemTypeCPUInput>(4)   /* Keep step count in CPU */                           \
+          .OutputMemoryType<OrtMemTypeCPUOutput>(0) /* Keep step count in CPU */                           \
+          .TypeConstraint("T1", DataTypeImpl::GetTensorType<T1>())                                         \
+          .TypeConstraint("T2", DataTypeImpl::GetTensorType<T2>())                                         \
+          .TypeConstraint("T3", DataTypeImpl::GetTensorType<T3>())                                         \
+          .TypeConstraint("T4", DataTypeImpl::GetTensorType<T4>())                                         \
+          .TypeConstraint("T_GRAD", DataTypeImpl::GetTensorType<T_GRAD>())                                 \
+          .TypeConstraint("T_MIXED_PRECISION_FP", DataTypeImpl::GetTensorType<T_MIXED_PRECISION_FP>())     \
+          .TypeConstraint("T_GRAD_NORM", DataTypeImpl::GetTensorType<T_GRAD_NORM>()),                      \
+      MultiTensorAdamOptimizer<T1, T2, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP>);
+
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(float, int64_t, float, float, float, float, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(MLFloat16, int64_t, float, MLFloat16, float, float, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(float, int64_t, float, MLFloat16, float, float, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(float, int64_t, float, float, MLFloat16, MLFloat16, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(float, int64_t, float, float, MLFloat16, float, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(MLFloat16, int64_t, float, MLFloat16, MLFloat16, MLFloat16, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(MLFloat16, int64_t, float, MLFloat16, MLFloat16, float, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(float, int64_t, float, MLFloat16, MLFloat16, MLFloat16, MLFloat16)
+REGISTER_MULTI_TENSOR_ADAM_KERNEL_TYPED(float, int64_t, float, MLFloat16, MLFloat16, float, MLFloat16)
+
+template <typename TWeight, typename TGradient, typename TMomentum, typename TMixedPrecision>
+static Status copy_adam_inputs_to_outputs(
+    OpKernelContext* ctx,
+    const int non_grouped_input_count,
+    const int non_grouped_output_count,
+    const int group_count,
+    const int input_group_size,
+    const int output_group_size) {
+  const Tensor* step_tensor = ctx->Input<Tensor>(4);
+  if (step_tensor) {
+    const int64_t* step_data = step_tensor->template Data<int64_t>();
+    Tensor* step_tensor_new = ctx->Output(0, step_tensor->Shape());
+    ORT_ENFORCE(step_tensor_new != nullptr, "Step tensor (input) and updated step tensor (output) must be specified together.");
+    int64_t* step_data_new = step_tensor_new->template MutableData<int64_t>();
+    *step_data_new = *step_data;
+  }
+
+  for (int group_index = 0; group_index < group_count; ++group_index) {
+    const int input_start_index = non_grouped_input_count + group_index * input_group_size;
+    const Tensor& w = *ctx->Input<Tensor>(input_start_index);
+    const Tensor& g = *ctx->Input<Tensor>(input_start_index + 1);
+    const Tensor& m1 = *ctx->Input<Tensor>(input_start_index + 2);
+    const Tensor& m2 = *ctx->Input<Tensor>(input_start_index + 3);
+    const Tensor* w_mixed_precision = ctx->Input<Tensor>(input_start_index + 4);
+    const int output_start_index = non_grouped_output_count + group_index * output_group_size;
+    Tensor* w_new = ctx->Output(output_start_index, w.Shape());
+    Tensor* g_new = ctx->Output(output_start_index + 1, g.Shape());
+    Tensor& m1_new = *ctx->Output(output_start_index + 2, m1.Shape());
+    Tensor& m2_new = *ctx->Output(output_start_index + 3, m2.Shape());
+    Tensor* w_mixed_precision_new = w_mixed_precision != nullptr ? ctx->Output(output_start_index + 4, w_mixed_precision->Shape()) : nullptr;
+
+    // TODO: temporary hack until View is improved (it doesn't work with Alias)
+    if (w_new != nullptr)
+      w_new->SetByteOffset(w.ByteOffset());
+    if (g_new != nullptr)
+      g_new->SetByteOffset(g.ByteOffset());
+    if (w_mixed_precision_new != nullptr)
+      w_mixed_precision_new->SetByteOffset(w_mixed_precision->ByteOffset());
+
+    if (w_new) {
+      ORT_RETURN_IF_ERROR(CopyIfNotSameBuffer<TWeight>(w, *w_new));
+    }
+    if (g_new) {
+      ORT_RETURN_IF_ERROR(CopyIfNotSameBuffer<TGradient>(g, *g_new));
+    }
+    ORT_RETURN_IF_ERROR(CopyIfNotSameBuffer<TMomentum>(m1, m1_new));
+    ORT_RETURN_IF_ERROR(CopyIfNotSameBuffer<TMomentum>(m2, m2_new));
+
+    if (w_mixed_precision_new) {
+      ORT_RETURN_IF_ERROR(CopyIfNotSameBuffer<TMixedPrecision>(*w_mixed_precision, *w_mixed_precision_new));
+    }
+  }
+
+  return Status::OK();
+}
+
+template <typename T1, typename T2, typename T3, typename T4, typename T_GRAD, typename T_GRAD_NORM, typename T_MIXED_PRECISION_FP>
+Status MultiTensorAdamOptimizer<T1, T2, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP>::ComputeInternal(OpKernelContext* ctx) const {
+  typedef typename ToCudaType<T1>::MappedType CudaT1;
+  typedef typename ToCudaType<T3>::MappedType CudaT3;
+  typedef typename ToCudaType<T4>::MappedType CudaT4;
+  typedef typename ToCudaType<T_GRAD>::MappedType CudaT_GRAD;
+  typedef typename ToCudaType<T_GRAD_NORM>::MappedType CudaT_GRAD_NORM;
+  typedef typename ToCudaType<T_MIXED_PRECISION_FP>::MappedType CudaT_MIXED_PRECISION_FP;
+
+  constexpr int non_grouped_input_count = 5;
+  constexpr int input_group_size = 5;
+  constexpr int output_group_size = 5;
+  constexpr int non_grouped_output_count = 1;
+  constexpr int minimal_input_count = non_grouped_input_count + 1 * input_group_size - 1;
+  constexpr int minimal_output_count = non_grouped_output_count + 1 * output_group_size - 1;
+  const int grouped_input_tensor_count = ctx->InputCount() - non_grouped_input_count;
+  const int grouped_output_tensor_count = ctx->OutputCount() - non_grouped_output_count;
+
+  // At least one variable group for updating one weight tensor.
+  ORT_ENFORCE(
+      ctx->InputCount() >= minimal_input_count,
+      "Expect at least ", minimal_input_count, " inputs but got ",
+      ctx->InputCount());
+  // At least one variable group for updating one weight tensor.
+  ORT_ENFORCE(
+      ctx->OutputCount() >= minimal_output_count,
+      "Expect at least ", minimal_output_count, " outputs but got ",
+      ctx->OutputCount());
+
+  // In addition to the first non_grouped_input_count inputs, all inputs are repeated sequence of [w, g, m1, m2, w_mixed_precision].
+  ORT_ENFORCE(
+      grouped_input_tensor_count % input_group_size == 0,
+      "Input count must be ", non_grouped_input_count, " + ", input_group_size,
+      " x (number of weights to optimize).");
+  // Outputs are repeated sequence of [w_new, g_new, m1_new, m2_new, w_mixed_precision_new].
+  ORT_ENFORCE(
+      grouped_output_tensor_count % output_group_size == 0,
+      "Output count must be ", non_grouped_output_count, " + ", output_group_size,
+      " x (number of weights to optimize).");
+  // Number of repeated [w, g, m1, m2, w_mixed_precision]'s should match number of repeated [w_new, g_new, m1_new, m2_new, w_mixed_precision_new].
+  ORT_ENFORCE(
+      grouped_input_tensor_count / input_group_size == grouped_output_tensor_count / output_group_size,
+      "Input and output tensor counts are not aligned. Please check MultiTensorAdamOptimizer's input and output lists.");
+
+  // Number of [w, g, m1, m2, (w_mixed_precision)] (or [w_new, g_new, m1_new, m2_new, (w_mixed_precision_new)]).
+  const int group_count = (grouped_input_tensor_count + input_group_size - 1) / input_group_size;
+
+  // At least we need one group of alpha, beta, lambda, ..., for processing one group.
+  ORT_ENFORCE(alpha_.size() >= static_cast<size_t>(group_count));
+  ORT_ENFORCE(beta_.size() >= static_cast<size_t>(group_count));
+  ORT_ENFORCE(lambda_.size() >= static_cast<size_t>(group_count));
+  ORT_ENFORCE(epsilon_.size() >= static_cast<size_t>(group_count));
+
+  // If gradient norm is not finite, we copy inputs to outputs directly.
+  if (ctx->Input<Tensor>(0)) {
+    auto update_signal_tensor = ctx->Input<Tensor>(0);
+    auto update_signal = *update_signal_tensor->template Data<bool>();
+    if (!update_signal) {
+      return copy_adam_inputs_to_outputs<T3, T_GRAD, T4, T_MIXED_PRECISION_FP>(
+          ctx,
+          non_grouped_input_count,
+          non_grouped_output_count,
+          group_count,
+          input_group_size,
+          output_group_size);
+    }
+  }
+
+  const CudaT3* loss_scale_data = nullptr;
+  if (ctx->Input<Tensor>(1)) {
+    const Tensor& loss_scale_tensor = *ctx->Input<Tensor>(1);
+    loss_scale_data = reinterpret_cast<const CudaT3*>(loss_scale_tensor.template Data<T3>());
+  }
+
+  const CudaT_GRAD_NORM* g_norm_data = nullptr;
+  if (ctx->Input<Tensor>(2)) {
+    const Tensor& g_norm_tensor = *ctx->Input<Tensor>(2);
+    g_norm_data = reinterpret_cast<const CudaT_GRAD_NORM*>(g_norm_tensor.template Data<T_GRAD_NORM>());
+  }
+
+  const Tensor& eta = *ctx->Input<Tensor>(3);
+  const CudaT1* eta_data = reinterpret_cast<const CudaT1*>(eta.template Data<T1>());
+
+  const Tensor* step_tensor = ctx->Input<Tensor>(4);
+  const int64_t* step_data = nullptr;
+  if (step_tensor) {
+    step_data = step_tensor->template Data<int64_t>();
+  }
+  const int64_t update_count = step_data ? *step_data : 0;
+
+  // Tensors in the multi-tensor path can only be indexed by a 32-bit integer,
+  // so larger tensors fall back to one AdamOptimizerImpl call each.
+  constexpr int tensor_count_per_group = 9;
+  const int max_tensor_size = compute_max_tensor_size_per_launch<tensor_count_per_group>(4);
+
+  // Bucketize tensor groups by the associated optimizer configuration.
+  // If two tensor groups use different "alpha", they should be put into two distinct buckets.
+  std::map<std::tuple<float, float, float, float>, std::vector<std::vector<void*>>> buckets;
+  std::map<std::tuple<float, float, float, float>, std::vector<int>> tensor_sizes_in_buckets;
+
+  for (int group_index = 0; group_index < group_count; ++group_index) {
+    // Prepare used input tensors for this group.
+    const int input_start_index = non_grouped_input_count + group_index * input_group_size;
+    const Tensor* w = ctx->Input<Tensor>(input_start_index);
+    const Tensor* g = ctx->Input<Tensor>(input_start_index + 1);
+    const Tensor* m1 = ctx->Input<Tensor>(input_start_index + 2);
+    const Tensor* m2 = ctx->Input<Tensor>(input_start_index + 3);
+    const Tensor* w_mixed_precision = ctx->Input<Tensor>(input_start_index + 4);
+
+    ORT_ENFORCE(w, "Weight tensor should not be null.");
+    ORT_ENFORCE(g, "Gradient tensor should not be null.");
+    ORT_ENFORCE(m1, "First-order momentum tensor should not be null.");
+    ORT_ENFORCE(m2, "Second-order momentum tensor should not be null.");
+
+    // Prepare used output tensors for this group.
+    const int output_start_index = non_grouped_output_count + group_index * output_group_size;
+    Tensor* w_new = ctx->Output(output_start_index, w->Shape());
+    Tensor* g_new = ctx->Output(output_start_index + 1, g->Shape());
+    Tensor* m1_new = ctx->Output(output_start_index + 2, m1->Shape());
+    Tensor* m2_new = ctx->Output(output_start_index + 3, m2->Shape());
+    Tensor* w_mixed_precision_new = w_mixed_precision != nullptr ? ctx->Output(output_start_index + 4, w_mixed_precision->Shape()) : nullptr;
+
+    ORT_ENFORCE(m1_new, "New first-order momentum tensor should not be null.");
+    ORT_ENFORCE(m2_new, "New second-order momentum tensor should not be null.");
+    ORT_ENFORCE(m1->Shape() == w->Shape());
+    ORT_ENFORCE(m2->Shape() == w->Shape());
+    ORT_ENFORCE(g->Shape() == w->Shape());
+
+    // TODO: temporary hack until View is improved (it doesn't work with Alias)
+    if (w_new != nullptr)
+      w_new->SetByteOffset(w->ByteOffset());
+    if (g_new != nullptr)
+      g_new->SetByteOffset(g->ByteOffset());
+    if (w_mixed_precision_new != nullptr)
+      w_mixed_precision_new->SetByteOffset(w_mixed_precision->ByteOffset());
+
+    // The index in CUDA system is 32-bit integer.
+    ORT_ENFORCE(
+        w->Shape().Size() <
+        static_cast<int64_t>(std::numeric_limits<int>::max()));
+    const int tensor_size = static_cast<int>(w->Shape().Size());
+
+    const CudaT3* p_w = reinterpret_cast<const CudaT3*>(w->template Data<T3>());
+    const CudaT_GRAD* p_g = reinterpret_cast<const CudaT_GRAD*>(g->template Data<T_GRAD>());
+    const CudaT4* p_m1 = reinterpret_cast<const CudaT4*>(m1->template Data<T4>());
+    const CudaT4* p_m2 = reinterpret_cast<const CudaT4*>(m2->template Data<T4>());
+    CudaT4* p_m1_new = reinterpret_cast<CudaT4*>(m1_new->template MutableData<T4>());
+    CudaT4* p_m2_new = reinterpret_cast<CudaT4*>(m2_new->template MutableData<T4>());
+    CudaT3* p_w_new = w_new != nullptr ? reinterpret_cast<CudaT3*>(w_new->template MutableData<T3>()) : nullptr;
+    CudaT_GRAD* p_g_new = g_new != nullptr ? reinterpret_cast<CudaT_GRAD*>(g_new->template MutableData<T_GRAD>()) : nullptr;
+    CudaT_MIXED_PRECISION_FP* p_w_mixed_precision_new = w_mixed_precision_new != nullptr ? reinterpret_cast<CudaT_MIXED_PRECISION_FP*>(w_mixed_precision_new->template MutableData<T_MIXED_PRECISION_FP>()) : nullptr;
+
+    if (tensor_size > max_tensor_size) {
+      AdamOptimizerImpl(
+          eta_data,
+          update_count,
+          p_w,
+          p_g,
+          p_m1,
+          p_m2,
+          loss_scale_data,
+          g_norm_data,
+          ToCudaType<T4>::FromFloat(alpha_[group_index]),
+          ToCudaType<T4>::FromFloat(beta_[group_index]),
+          ToCudaType<T4>::FromFloat(lambda_[group_index]),
+          ToCudaType<T4>::FromFloat(epsilon_[group_index]),
+          do_bias_correction_,
+          weight_decay_mode_,
+          p_m1_new,
+          p_m2_new,
+          p_w_new,
+          p_g_new,
+          p_w_mixed_precision_new,
+          static_cast<size_t>(tensor_size));
+    } else {
+      std::vector<void*> ptrs(tensor_count_per_group);
+      ptrs[0] = const_cast<CudaT3*>(p_w);          // weight tensor
+      ptrs[1] = const_cast<CudaT_GRAD*>(p_g);      // gradient
+      ptrs[2] = const_cast<CudaT4*>(p_m1);         // 1st momentum
+      ptrs[3] = const_cast<CudaT4*>(p_m2);         // 2nd momentum
+      ptrs[4] = p_m1_new;                          // new 1st momentum
+      ptrs[5] = p_m2_new;                          // new 2nd momentum
+      ptrs[6] = p_w_new;                           // new weight tensor
+      ptrs[7] = p_g_new;                           // new gradient tensor
+      ptrs[8] = p_w_mixed_precision_new;           // new mixed-precision weight tensor
+
+      auto key = std::make_tuple(alpha_[group_index], beta_[group_index], lambda_[group_index], epsilon_[group_index]);
+      buckets[key].push_back(ptrs);
+      tensor_sizes_in_buckets[key].push_back(tensor_size);
+    }
+  }
+
+  for (auto& pair : buckets) {
+    const auto key = pair.first;
+    float alpha = 0.f, beta = 0.f, lambda = 0.f, epsilon = 0.f;
+    std::tie(alpha, beta, lambda, epsilon) = key;
+
+    // If bias correction coefficients are set to 1s, it's equivalent to disabling bias correction.
+    const float alpha_correction =
+        do_bias_correction_ ? onnxruntime::contrib::compute_bias_correction_coefficient(alpha, update_count) : 1.f;
+    const float beta_correction =
+        do_bias_correction_ ? onnxruntime::contrib::compute_bias_correction_coefficient(beta, update_count) : 1.f;
+
+    typedef AdamMultiTensorFunctor<CudaT1, CudaT3, CudaT4, CudaT_GRAD, CudaT_GRAD_NORM, CudaT_MIXED_PRECISION_FP> TFunctor;
+    TFunctor adam_functor;
+
+    launch_multi_tensor_functor<tensor_count_per_group, TFunctor,
+                                const CudaT1*, const CudaT3*, const CudaT_GRAD_NORM*,
+                                CudaT4, CudaT4, CudaT4, CudaT4, CudaT4, CudaT4, int64_t>(
+        2048 * 32,
+        tensor_sizes_in_buckets[key],
+        buckets[key],
+        adam_functor,
+        eta_data,
+        loss_scale_data,
+        g_norm_data,
+        ToCudaType<T4>::FromFloat(alpha),
+        ToCudaType<T4>::FromFloat(beta),
+        ToCudaType<T4>::FromFloat(lambda),
+        ToCudaType<T4>::FromFloat(epsilon),
+        ToCudaType<T4>::FromFloat(alpha_correction),
+        ToCudaType<T4>::FromFloat(beta_correction),
+        weight_decay_mode_);
+  }
+
+  if (step_tensor) {
+    Tensor* step_tensor_new = ctx->Output(0, step_tensor->Shape());
+    ORT_ENFORCE(step_tensor_new != nullptr, "Step tensor (input) and updated step tensor (output) must be specified together.");
+    int64_t* step_data_new = step_tensor_new->template MutableData<int64_t>();
+    *step_data_new = *step_data + 1;
+  }
+
+  return Status::OK();
+}
+
 }  // namespace cuda
 }  // namespace onnxruntime
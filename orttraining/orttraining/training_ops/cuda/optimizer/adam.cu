@@ -255,5 +255,168 @@ SPECIALIZED_AdamOptimizerImpl(half, int64_t, float, half, half, float, half)
 SPECIALIZED_AdamOptimizerImpl(float, int64_t, float, half, half, half, half)
 SPECIALIZED_AdamOptimizerImpl(float, int64_t, float, half, half, float, half)
 
+// Shared per-element update rule used by the multi-tensor kernel. The math
+// matches _AdamOptimizer_mode0/_AdamOptimizer_mode1 above; the scaled
+// gradient is computed by the caller.
+template <typename T1, typename T3, typename T4, typename T_GRAD, typename T_MIXED_PRECISION_FP>
+__device__ __forceinline__ void _AdamUpdateRule(
+    const T1 eta,
+    const T4 g,
+    const T3 w,
+    const T4 m1,
+    const T4 m2,
+    const T4 alpha,
+    const T4 beta,
+    const T4 lambda,
+    const T4 epsilon,
+    const T4 alpha_correction,
+    const T4 beta_correction,
+    const int64_t weight_decay_mode,
+    T4& m1_new,
+    T4& m2_new,
+    T3* w_new,
+    T_GRAD* g_new,
+    T_MIXED_PRECISION_FP* mixed_precision_w_new) {
+  // A shared constant.
+  const T4 one = T4(1.0f);
+
+  // Compute exponentially-averaged historical gradient and squared gradient.
+  m1_new = alpha * m1 + (one - alpha) * g;
+  m2_new = beta * m2 + (one - beta) * g * g;
+
+  T4 delta;
+  if (weight_decay_mode == 0) {
+    // Pytorch AdamW; bias correction is applied on m and v individually,
+    // weight decay is applied before weight is updated.
+    const T4 denom = _Sqrt(m2_new / beta_correction) + epsilon;
+    const T4 update = (m1_new / alpha_correction) / denom + (lambda * T4(w));
+    delta = -T4(eta) * update;
+  } else {
+    // Huggingface AdamW; bias correction is applied on the learning rate,
+    // weight decay is applied after weight is updated.
+    const T4 denom = _Sqrt(m2_new) + epsilon;
+    const T4 step_size = T4(eta) * _Sqrt(beta_correction) / alpha_correction;
+    delta = -step_size * m1_new / denom - T4(eta) * lambda * (T4(w) - step_size * m1_new / denom);
+  }
+
+  // Compute the new gradient.
+  if (g_new != nullptr) {
+    *g_new = T_GRAD(delta);
+  }
+
+  // Compute the new weight.
+  if (w_new != nullptr) {
+    *w_new = w + T3(delta);
+
+    if (mixed_precision_w_new != nullptr) {
+      *mixed_precision_w_new = static_cast<T_MIXED_PRECISION_FP>(*w_new);
+    }
+  }
+}
+
+template <typename T1, typename T3, typename T4, typename T_GRAD, typename T_GRAD_NORM, typename T_MIXED_PRECISION_FP>
+__global__ void AdamMultiTensorImpl(
+    ChunkGroup<9> chunk_group,
+    const T1* eta,
+    const T3* loss_scale,
+    const T_GRAD_NORM* g_norm,
+    const T4 alpha,
+    const T4 beta,
+    const T4 lambda,
+    const T4 epsilon,
+    const T4 alpha_correction,
+    const T4 beta_correction,
+    const int64_t weight_decay_mode) {
+  const int group_index = chunk_group.block_index_to_tensor_group_index[blockIdx.x];
+  const int tensor_size = chunk_group.tensor_sizes[group_index];
+  const int chunk_size = chunk_group.chunk_size;
+  const int chunk_start = chunk_group.block_index_to_chunk_start_index[blockIdx.x];
+  const T3* w = reinterpret_cast<const T3*>(chunk_group.tensor_ptrs[0][group_index]) + chunk_start;
+  const T_GRAD* g = reinterpret_cast<const T_GRAD*>(chunk_group.tensor_ptrs[1][group_index]) + chunk_start;
+  const T4* m1 = reinterpret_cast<const T4*>(chunk_group.tensor_ptrs[2][group_index]) + chunk_start;
+  const T4* m2 = reinterpret_cast<const T4*>(chunk_group.tensor_ptrs[3][group_index]) + chunk_start;
+  T4* m1_new = reinterpret_cast<T4*>(chunk_group.tensor_ptrs[4][group_index]) + chunk_start;
+  T4* m2_new = reinterpret_cast<T4*>(chunk_group.tensor_ptrs[5][group_index]) + chunk_start;
+  T3* w_new = chunk_group.tensor_ptrs[6][group_index] != nullptr ? reinterpret_cast<T3*>(chunk_group.tensor_ptrs[6][group_index]) + chunk_start : nullptr;
+  T_GRAD* g_new = chunk_group.tensor_ptrs[7][group_index] != nullptr ? reinterpret_cast<T_GRAD*>(chunk_group.tensor_ptrs[7][group_index]) + chunk_start : nullptr;
+  T_MIXED_PRECISION_FP* mixed_precision_w_new = chunk_group.tensor_ptrs[8][group_index] != nullptr ? reinterpret_cast<T_MIXED_PRECISION_FP*>(chunk_group.tensor_ptrs[8][group_index]) + chunk_start : nullptr;
+  const T4 actual_scale = _ComputeGradScale<T3, T_GRAD_NORM, T4>(loss_scale, g_norm);
+
+  for (int i = threadIdx.x; i < chunk_size && i + chunk_start < tensor_size; i += blockDim.x) {
+    _AdamUpdateRule(
+        *eta,
+        T4(g[i]) / actual_scale,
+        w[i],
+        m1[i],
+        m2[i],
+        alpha,
+        beta,
+        lambda,
+        epsilon,
+        alpha_correction,
+        beta_correction,
+        weight_decay_mode,
+        m1_new[i],
+        m2_new[i],
+        w_new != nullptr ? w_new + i : nullptr,
+        g_new != nullptr ? g_new + i : nullptr,
+        mixed_precision_w_new != nullptr ? mixed_precision_w_new + i : nullptr);
+  }
+}
+
+template <typename T1, typename T3, typename T4, typename T_GRAD, typename T_GRAD_NORM, typename T_MIXED_PRECISION_FP>
+void AdamMultiTensorFunctor<T1, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP>::operator()(
+    ChunkGroup<9> chunk_group,
+    const T1* eta,
+    const T3* loss_scale,
+    const T_GRAD_NORM* grad_norm,
+    const T4 alpha,
+    const T4 beta,
+    const T4 lambda,
+    const T4 epsilon,
+    const T4 alpha_correction,
+    const T4 beta_correction,
+    const int64_t weight_decay_mode) {
+  const int thread_count = ChunkGroup<9>::thread_count_per_block;
+  const int block_count = chunk_group.chunk_count;
+
+  AdamMultiTensorImpl<T1, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP><<<block_count, thread_count, 0>>>(
+      chunk_group,
+      eta,
+      loss_scale,
+      grad_norm,
+      alpha,
+      beta,
+      lambda,
+      epsilon,
+      alpha_correction,
+      beta_correction,
+      weight_decay_mode);
+}
+
+#define INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(T1, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP)       \
+  template void AdamMultiTensorFunctor<T1, T3, T4, T_GRAD, T_GRAD_NORM, T_MIXED_PRECISION_FP>::operator()( \
+      ChunkGroup<9> chunk_group,                                                                           \
+      const T1* eta,                                                                                       \
+      const T3* loss_scale,                                                                                \
+      const T_GRAD_NORM* grad_norm,                                                                        \
+      const T4 alpha,                                                                                      \
+      const T4 beta,                                                                                       \
+      const T4 lambda,                                                                                     \
+      const T4 epsilon,                                                                                    \
+      const T4 alpha_correction,                                                                           \
+      const T4 beta_correction,                                                                            \
+      const int64_t weight_decay_mode);
+
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(float, float, float, float, float, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(half, float, half, float, float, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(float, float, half, float, float, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(float, float, float, half, half, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(float, float, float, half, float, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(half, float, half, half, half, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(half, float, half, half, float, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(float, float, half, half, half, half)
+INSTANTIATE_ADAM_MULTI_TENSOR_FUNCTOR(float, float, half, half, float, half)
+
 }  // namespace cuda
 }  // namespace onnxruntime
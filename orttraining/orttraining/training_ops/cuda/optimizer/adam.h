@@ -4,6 +4,7 @@
 #pragma once
 #include "core/common/common.h"
 #include "core/providers/cuda/cuda_common.h"
+#include "core/providers/cuda/multi_tensor/common.cuh"
 
 namespace onnxruntime {
 namespace cuda {
@@ -58,5 +59,69 @@ class AdamOptimizer final : public CudaKernel {
   int64_t weight_decay_mode_;
 };
 
+// Adam's update maps [w, g, m1, m2] to [m1_new, m2_new, w_new, g_new, w_mixed_precision_new].
+// In contrast to Lamb, there is no reduction between the momentum update and
+// the weight update, so the whole optimizer step (including the gradient
+// scaling done for mixed-precision training) is applied in one pass.
+// There are 9 distinct tensors in total and therefore the type of
+// chunk_group is ChunkGroup<9>.
+//
+// Tensor pointers associated with the i-th tensor in this chunk:
+//  w: chunk_group.tensor_ptrs[0][i]
+//  g: chunk_group.tensor_ptrs[1][i]
+//  m1: chunk_group.tensor_ptrs[2][i]
+//  m2: chunk_group.tensor_ptrs[3][i]
+//  m1_new: chunk_group.tensor_ptrs[4][i]
+//  m2_new: chunk_group.tensor_ptrs[5][i]
+//  w_new: chunk_group.tensor_ptrs[6][i] (can be null)
+//  g_new: chunk_group.tensor_ptrs[7][i] (can be null)
+//  w_mixed_precision_new: chunk_group.tensor_ptrs[8][i] (can be null)
+template <typename T1, typename T3, typename T4, typename T_GRAD, typename T_GRAD_NORM, typename T_MIXED_PRECISION_FP>
+struct AdamMultiTensorFunctor {
+  void operator()(
+      ChunkGroup<9> chunk_group,
+      const T1* eta,
+      const T3* loss_scale,
+      const T_GRAD_NORM* grad_norm,
+      const T4 alpha,
+      const T4 beta,
+      const T4 lambda,
+      const T4 epsilon,
+      const T4 alpha_correction,
+      const T4 beta_correction,
+      const int64_t weight_decay_mode);
+};
+
+// Update several weight tensors in one node. The i-th updated weight
+// tensor and its auxiliary tensors form the i-th tensor group; small
+// groups are packed together and processed by a few packed kernel calls
+// instead of one kernel call per weight tensor.
+template <typename T1, typename T2, typename T3, typename T4, typename T_GRAD, typename T_GRAD_NORM, typename T_MIXED_PRECISION_FP>
+class MultiTensorAdamOptimizer final : public CudaKernel {
+ public:
+  MultiTensorAdamOptimizer(const OpKernelInfo& info) : CudaKernel(info) {
+    alpha_ = info.GetAttrsOrDefault("alpha", std::vector<float>(1024, 0.9f));
+    beta_ = info.GetAttrsOrDefault("beta", std::vector<float>(1024, 0.999f));
+    lambda_ = info.GetAttrsOrDefault("lambda", std::vector<float>(1024, 0.0f));
+    epsilon_ = info.GetAttrsOrDefault("epsilon", std::vector<float>(1024, 1e-8f));
+
+    int64_t tmp_flag = static_cast<int64_t>(0);
+    ORT_ENFORCE(info.GetAttr<int64_t>("do_bias_correction", &tmp_flag).IsOK(), "Missing/Invalid do_bias_correction");
+    ORT_ENFORCE(tmp_flag == 0 || tmp_flag == 1, "do_bias_correction must be either 0 or 1.");
+    do_bias_correction_ = tmp_flag != 0 ? true : false;
+    info.GetAttrOrDefault("weight_decay_mode", &weight_decay_mode_, static_cast<int64_t>(0));
+  }
+
+  Status ComputeInternal(OpKernelContext* context) const override;
+
+ private:
+  std::vector<float> alpha_;
+  std::vector<float> beta_;
+  std::vector<float> lambda_;
+  std::vector<float> epsilon_;
+  bool do_bias_correction_;
+  int64_t weight_decay_mode_;
+};
+
 }  // namespace cuda
 }  // namespace onnxruntime
@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+#include "batcher.h"
+#include "environment.h"
+#include "executor.h"
+
+namespace onnxruntime {
+namespace server {
+
+namespace protobufutil = google::protobuf::util;
+
+RequestBatcher::RequestBatcher(ServerEnvironment* server_env, std::string model_name, std::string model_version,
+                               size_t max_batch_size, std::chrono::microseconds batch_timeout)
+    : env_(server_env),
+      model_name_(std::move(model_name)),
+      model_version_(std::move(model_version)),
+      max_batch_size_(max_batch_size),
+      batch_timeout_(batch_timeout) {}
+
+bool RequestBatcher::IsBatchable(const onnxruntime::server::PredictRequest& request,
+                                 /* out */ int64_t& rows) const {
+  rows = -1;
+  if (request.inputs().empty()) {
+    return false;
+  }
+
+  for (const auto& input : request.inputs()) {
+    const auto& tensor = input.second;
+    // concatenation and scattering work on raw bytes, so every input needs raw_data and at least
+    // one dimension to concatenate along
+    if (!tensor.has_raw_data() || tensor.dims_size() < 1 || tensor.dims(0) < 1) {
+      return false;
+    }
+    if (rows == -1) {
+      rows = tensor.dims(0);
+    } else if (tensor.dims(0) != rows) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::string RequestBatcher::BatchSignature(const onnxruntime::server::PredictRequest& request) const {
+  // the inputs live in a protobuf map whose iteration order is unspecified, so collect and sort
+  std::vector<std::string> parts;
+  parts.reserve(request.inputs().size());
+  for (const auto& input : request.inputs()) {
+    const auto& tensor = input.second;
+    std::ostringstream part;
+    part << input.first << ':' << tensor.data_type();
+    for (int i = 1; i < tensor.dims_size(); ++i) {
+      part << 'x' << tensor.dims(i);
+    }
+    parts.push_back(part.str());
+  }
+  std::sort(parts.begin(), parts.end());
+
+  std::ostringstream signature;
+  for (const auto& part : parts) {
+    signature << part << ';';
+  }
+  signature << '|';
+  for (const auto& name : request.output_filter()) {
+    signature << name << ';';
+  }
+  return signature.str();
+}
+
+protobufutil::Status RequestBatcher::Predict(const onnxruntime::server::PredictRequest& request,
+                                             /* out */ onnxruntime::server::PredictResponse& response,
+                                             const std::string& request_id) {
+  int64_t rows = -1;
+  if (max_batch_size_ <= 1 || !IsBatchable(request, rows)) {
+    Executor executor(env_, request_id);
+    return executor.RunModel(model_name_, model_version_, request, response);
+  }
+
+  PendingRequest pending{&request, &response, &request_id, rows, {}};
+  auto done = pending.status.get_future();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  const bool leader = queue_.empty();
+  queue_.push_back(&pending);
+  if (leader) {
+    // first request of a batch: wait for more requests until the deadline or the batch fills up
+    batch_full_.wait_for(lock, batch_timeout_, [this] { return queue_.size() >= max_batch_size_; });
+    std::vector<PendingRequest*> batch;
+    batch.swap(queue_);
+    lock.unlock();
+    ProcessBatch(batch);
+  } else {
+    if (queue_.size() >= max_batch_size_) {
+      batch_full_.notify_one();
+    }
+    lock.unlock();
+  }
+
+  return done.get();
+}
+
+void RequestBatcher::ProcessBatch(std::vector<PendingRequest*>& batch) {
+  // requests only merge when they agree on input names, data types, trailing dims and output
+  // filter, so split the batch into mergeable groups first
+  std::unordered_map<std::string, std::vector<PendingRequest*>> groups;
+  for (auto* pending : batch) {
+    groups[BatchSignature(*pending->request)].push_back(pending);
+  }
+
+  for (auto& group : groups) {
+    if (group.second.size() > 1) {
+      auto status = RunMerged(group.second);
+      if (status.ok()) {
+        continue;
+      }
+      auto logger = env_->GetLogger(*group.second.front()->request_id);
+      logger->warn("Batched run failed, re-running the {} member requests individually: {}",
+                   group.second.size(), status.ToString());
+    }
+
+    for (auto* pending : group.second) {
+      Executor executor(env_, *pending->request_id);
+      pending->status.set_value(
+          executor.RunModel(model_name_, model_version_, *pending->request, *pending->response));
+    }
+  }
+}
+
+protobufutil::Status RequestBatcher::RunMerged(const std::vector<PendingRequest*>& group) {
+  auto logger = env_->GetLogger(*group.front()->request_id);
+
+  int64_t total_rows = 0;
+  for (const auto* pending : group) {
+    total_rows += pending->rows;
+  }
+
+  // Merge the group into one request by concatenating each input along dim 0.
+  onnxruntime::server::PredictRequest merged_request{};
+  for (const auto& name : group.front()->request->output_filter()) {
+    merged_request.add_output_filter(name);
+  }
+
+  for (const auto& input : group.front()->request->inputs()) {
+    const auto& name = input.first;
+    onnx::TensorProto merged_tensor{};
+    merged_tensor.set_data_type(input.second.data_type());
+    merged_tensor.add_dims(total_rows);
+    for (int i = 1; i < input.second.dims_size(); ++i) {
+      merged_tensor.add_dims(input.second.dims(i));
+    }
+
+    const size_t row_bytes = input.second.raw_data().size() / group.front()->rows;
+    std::string& merged_data = *merged_tensor.mutable_raw_data();
+    merged_data.reserve(row_bytes * total_rows);
+    for (const auto* pending : group) {
+      const auto& member_data = pending->request->inputs().at(name).raw_data();
+      if (member_data.size() != row_bytes * pending->rows) {
+        return protobufutil::Status(protobufutil::error::Code::FAILED_PRECONDITION,
+                                    "Input " + name + " has an inconsistent row size across the batch");
+      }
+      merged_data.append(member_data);
+    }
+
+    (*merged_request.mutable_inputs())[name] = merged_tensor;
+  }
+
+  logger->debug("Running a batch of {} requests ({} rows) as one model run", group.size(), total_rows);
+
+  // the merged run is logged under the id of the request that opened the batch
+  onnxruntime::server::PredictResponse merged_response{};
+  Executor executor(env_, *group.front()->request_id);
+  auto status = executor.RunModel(model_name_, model_version_, merged_request, merged_response);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Validate every output before scattering anything so a non-batched output (e.g. one whose
+  // dim 0 is not the batch dimension) leaves the member responses untouched.
+  for (const auto& output : merged_response.outputs()) {
+    const auto& tensor = output.second;
+    if (tensor.dims_size() < 1 || tensor.dims(0) != total_rows ||
+        !tensor.has_raw_data() || tensor.raw_data().size() % total_rows != 0) {
+      return protobufutil::Status(protobufutil::error::Code::FAILED_PRECONDITION,
+                                  "Output " + output.first + " is not batched along dim 0");
+    }
+  }
+
+  // Scatter each output's rows back to the member responses.
+  for (const auto& output : merged_response.outputs()) {
+    const auto& tensor = output.second;
+    const size_t row_bytes = tensor.raw_data().size() / total_rows;
+    int64_t row_offset = 0;
+    for (auto* pending : group) {
+      onnx::TensorProto member_tensor = tensor;
+      member_tensor.set_dims(0, pending->rows);
+      member_tensor.set_raw_data(tensor.raw_data().substr(row_offset * row_bytes,
+                                                          pending->rows * row_bytes));
+      (*pending->response->mutable_outputs())[output.first] = std::move(member_tensor);
+      row_offset += pending->rows;
+    }
+  }
+
+  for (auto* pending : group) {
+    pending->status.set_value(protobufutil::Status::OK);
+  }
+
+  return protobufutil::Status::OK;
+}
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/status.h>
+
+#include "predict.pb.h"
+
+namespace onnxruntime {
+namespace server {
+
+class ServerEnvironment;
+
+// Coalesces concurrent Predict requests for one model into a single session Run.
+// The first request to arrive becomes the batch leader and waits until either max_batch_size
+// requests have queued up or the batch timeout expires, merges the compatible requests along
+// the batch dimension (dim 0), runs the model once and scatters the output rows back to the
+// per-request responses. Requests whose inputs cannot be concatenated (no raw_data, scalar
+// inputs, or inputs that disagree on their own batch size) bypass the queue and run alone.
+class RequestBatcher {
+ public:
+  RequestBatcher(ServerEnvironment* server_env, std::string model_name, std::string model_version,
+                 size_t max_batch_size, std::chrono::microseconds batch_timeout);
+
+  // Queues the request and blocks until the batch it joined has run and the response has been
+  // filled in. Safe to call from any number of threads.
+  google::protobuf::util::Status Predict(const onnxruntime::server::PredictRequest& request,
+                                         /* out */ onnxruntime::server::PredictResponse& response,
+                                         const std::string& request_id);
+
+ private:
+  struct PendingRequest {
+    const onnxruntime::server::PredictRequest* request;
+    onnxruntime::server::PredictResponse* response;
+    const std::string* request_id;
+    int64_t rows;  // extent of dim 0, shared by all inputs of the request
+    std::promise<google::protobuf::util::Status> status;
+  };
+
+  // A request can join a batch if every input carries raw_data and all inputs agree on dim 0.
+  bool IsBatchable(const onnxruntime::server::PredictRequest& request, /* out */ int64_t& rows) const;
+
+  // Requests merge only when they match on input names, data types, trailing dims and output
+  // filter; the signature encodes exactly that so a batch can be split into mergeable groups.
+  std::string BatchSignature(const onnxruntime::server::PredictRequest& request) const;
+
+  // Runs every request collected for one batch and fulfills their promises.
+  void ProcessBatch(std::vector<PendingRequest*>& batch);
+
+  // Runs one mergeable group as a single model run and scatters the outputs. Fulfills the group's
+  // promises on success; returns a non-OK status (with no promise touched) when the group could
+  // not be run or scattered as one batch, so the caller can fall back to per-request runs.
+  google::protobuf::util::Status RunMerged(const std::vector<PendingRequest*>& group);
+
+  ServerEnvironment* env_;
+  const std::string model_name_;
+  const std::string model_version_;
+  const size_t max_batch_size_;
+  const std::chrono::microseconds batch_timeout_;
+
+  std::mutex mutex_;
+  std::condition_variable batch_full_;
+  std::vector<PendingRequest*> queue_;
+};
+
+}  // namespace server
+}  // namespace onnxruntime
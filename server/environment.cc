@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include <memory>
+#include "batcher.h"
 #include "environment.h"
 #include "onnxruntime_cxx_api.h"
 
@@ -50,6 +51,9 @@ void ORT_API_CALL Log(void* param, OrtLoggingLevel severity, const char* categor
   return;
 }
 
+// out of line as RequestBatcher is only forward declared in the header
+ServerEnvironment::~ServerEnvironment() = default;
+
 ServerEnvironment::ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink) : severity_(severity),
                                                                                                logger_id_("ServerApp"),
                                                                                                sink_(sink),
@@ -136,8 +140,26 @@ void ServerEnvironment::UnloadModel(const std::string& model_name, const std::st
     throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
   }
 
+  batchers_.erase(identifier);
   sessions_.erase(it);
 }
 
+void ServerEnvironment::EnableBatching(const std::string& model_name, const std::string& model_version,
+                                       size_t max_batch_size, std::chrono::microseconds batch_timeout) {
+  auto identifier = std::make_pair(model_name, model_version);
+  if (sessions_.find(identifier) == sessions_.end()) {
+    throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+  }
+
+  batchers_[identifier] = std::make_unique<RequestBatcher>(this, model_name, model_version,
+                                                           max_batch_size, batch_timeout);
+}
+
+RequestBatcher* ServerEnvironment::GetBatcher(const std::string& model_name, const std::string& model_version) const {
+  auto identifier = std::make_pair(model_name, model_version);
+  auto it = batchers_.find(identifier);
+  return it == batchers_.end() ? nullptr : it->second.get();
+}
+
 }  // namespace server
 }  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -14,10 +15,12 @@
 namespace onnxruntime {
 namespace server {
 
+class RequestBatcher;
+
 class ServerEnvironment {
  public:
   explicit ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink);
-  ~ServerEnvironment() = default;
+  ~ServerEnvironment();
   ServerEnvironment(const ServerEnvironment&) = delete;
 
   OrtLoggingLevel GetLogSeverity() const;
@@ -30,6 +33,14 @@ class ServerEnvironment {
   void UnloadModel(const std::string& model_name, const std::string& model_version);
   void RegisterExecutionProviders();
 
+  // Puts a batching queue in front of an already loaded model so concurrent Predict requests are
+  // coalesced along the batch dimension into a single Run. Call before serving starts.
+  void EnableBatching(const std::string& model_name, const std::string& model_version,
+                      size_t max_batch_size, std::chrono::microseconds batch_timeout);
+
+  // The model's batching queue, or nullptr when batching is not enabled for it.
+  RequestBatcher* GetBatcher(const std::string& model_name, const std::string& model_version) const;
+
  private:
   const OrtLoggingLevel severity_;
   const std::string logger_id_;
@@ -52,6 +63,7 @@ class ServerEnvironment {
   };
 
   std::unordered_map<std::pair<std::string, std::string>, ServerEnvironment::SessionHolder, boost::hash<std::pair<std::string, std::string>>> sessions_;
+  std::unordered_map<std::pair<std::string, std::string>, std::unique_ptr<RequestBatcher>, boost::hash<std::pair<std::string, std::string>>> batchers_;
 };
 
 }  // namespace server
@@ -8,6 +8,7 @@
 #include "onnx-ml.pb.h"
 #include "predict.pb.h"
 
+#include "batcher.h"
 #include "converter.h"
 #include "executor.h"
 #include "util.h"
@@ -31,12 +32,17 @@ protobufutil::Status Executor::SetMLValue(const onnx::TensorProto& input_tensor,
     return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
   }
 
-  auto* buf = buffers.AllocNewBuffer(cpu_tensor_length);
   try {
-    onnxruntime::server::TensorProtoToMLValue(input_tensor,
-                                              onnxruntime::server::MemBuffer(buf, cpu_tensor_length, *cpu_memory_info),
-                                              ml_value);
-
+    if (onnxruntime::server::CanAliasRawData(input_tensor, cpu_tensor_length)) {
+      // Zero-copy path: the response is fully built before the request protobuf is freed, so the
+      // tensor can alias the request's raw_data for the duration of the Run instead of copying it.
+      onnxruntime::server::TensorProtoToMLValueNoCopy(input_tensor, *cpu_memory_info, ml_value);
+    } else {
+      auto* buf = buffers.AllocNewBuffer(cpu_tensor_length);
+      onnxruntime::server::TensorProtoToMLValue(input_tensor,
+                                                onnxruntime::server::MemBuffer(buf, cpu_tensor_length, *cpu_memory_info),
+                                                ml_value);
+    }
   } catch (const Ort::Exception& e) {
     logger->error("TensorProtoToMLValue() failed. Message: {}", e.what());
     return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
@@ -101,6 +107,18 @@ protobufutil::Status Executor::Predict(const std::string& model_name,
                                        const std::string& model_version,
                                        const onnxruntime::server::PredictRequest& request,
                                        /* out */ onnxruntime::server::PredictResponse& response) {
+  auto* batcher = env_->GetBatcher(model_name, model_version);
+  if (batcher != nullptr) {
+    return batcher->Predict(request, response, request_id_);
+  }
+
+  return RunModel(model_name, model_version, request, response);
+}
+
+protobufutil::Status Executor::RunModel(const std::string& model_name,
+                                        const std::string& model_version,
+                                        const onnxruntime::server::PredictRequest& request,
+                                        /* out */ onnxruntime::server::PredictResponse& response) {
   auto logger = env_->GetLogger(request_id_);
 
   // Convert PredictRequest to NameMLValMap
@@ -19,12 +19,19 @@ class Executor {
                                                                     request_id_(std::move(request_id)),
                                                                     using_raw_data_(true) {}
 
-  // Prediction method
+  // Prediction method. Routes through the model's batching queue when one is enabled.
   google::protobuf::util::Status Predict(const std::string& model_name,
                                          const std::string& model_version,
                                          const onnxruntime::server::PredictRequest& request,
                                          /* out */ onnxruntime::server::PredictResponse& response);
 
+  // Runs the model once for exactly this request, bypassing any batching queue. Used by the
+  // RequestBatcher for the (merged or singular) requests it has decided to run.
+  google::protobuf::util::Status RunModel(const std::string& model_name,
+                                          const std::string& model_version,
+                                          const onnxruntime::server::PredictRequest& request,
+                                          /* out */ onnxruntime::server::PredictResponse& response);
+
  private:
   ServerEnvironment* env_;
   const std::string request_id_;
@@ -3,6 +3,7 @@
 
 #include "prediction_service_impl.h"
 #include "request_id.h"
+#include "streaming_session.h"
 
 namespace onnxruntime {
 namespace server {
@@ -21,6 +22,26 @@ PredictionServiceImpl::PredictionServiceImpl(const std::shared_ptr<onnxruntime::
   return ::grpc::Status::OK;
 }
 
+::grpc::Status PredictionServiceImpl::PredictStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<::onnxruntime::server::PredictResponse, ::onnxruntime::server::PredictRequest>* stream) {
+  auto request_id = SetRequestContext(context);
+  //TODO: (csteegz) Add modelspec for both paths.
+  onnxruntime::server::StreamingSession streaming(environment_.get(), "default", "1", request_id);  // Currently only support one model so hard coded.
+
+  ::onnxruntime::server::PredictRequest request{};
+  while (stream->Read(&request)) {
+    ::onnxruntime::server::PredictResponse response{};
+    auto status = streaming.Predict(request, response);
+    if (!status.ok()) {
+      return ::grpc::Status(::grpc::StatusCode(status.error_code()), status.error_message());
+    }
+    if (!stream->Write(response)) {
+      break;
+    }
+    request.Clear();
+  }
+  return ::grpc::Status::OK;
+}
+
 std::string PredictionServiceImpl::SetRequestContext(::grpc::ServerContext* context) {
   auto metadata = context->client_metadata();
   auto request_id = util::InternalRequestId();
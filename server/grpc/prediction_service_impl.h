@@ -15,6 +15,10 @@ class PredictionServiceImpl final : public onnxruntime::server::PredictionServic
   PredictionServiceImpl(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env);
   ::grpc::Status Predict(::grpc::ServerContext* context, const ::onnxruntime::server::PredictRequest* request, ::onnxruntime::server::PredictResponse* response);
 
+  // Runs one prediction per streamed request, keeping per-connection state (carried tensors,
+  // previously sent inputs) server-side. See PredictStream in prediction_service.proto.
+  ::grpc::Status PredictStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<::onnxruntime::server::PredictResponse, ::onnxruntime::server::PredictRequest>* stream);
+
  private:
   std::shared_ptr<onnxruntime::server::ServerEnvironment> environment_;
 
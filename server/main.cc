@@ -72,6 +72,12 @@ int main(int argc, char* argv[]) {
     exit(EXIT_FAILURE);
   }
 
+  if (config.batch_max_size > 1) {
+    env->EnableBatching(config.model_name, config.model_version, config.batch_max_size,
+                        std::chrono::microseconds{config.batch_timeout_microseconds});
+    logger->info("Batching enabled: max batch size {}, timeout {}us", config.batch_max_size, config.batch_timeout_microseconds);
+  }
+
   //Setup GRPC Server
   auto const grpc_address = config.address;
   auto const grpc_port = config.grpc_port;
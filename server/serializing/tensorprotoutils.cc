@@ -378,6 +378,31 @@ void TensorProtoToMLValue(const onnx::TensorProto& tensor_proto, const MemBuffer
   value = Ort::Value::CreateTensor(&allocator, tensor_data, m.GetLen(), tensor_shape_vec.data(), tensor_shape_vec.size(), (ONNXTensorElementDataType)tensor_proto.data_type());
   return;
 }
+bool CanAliasRawData(const onnx::TensorProto& tensor_proto, size_t expected_bytes) noexcept {
+  if (!tensor_proto.has_raw_data()) {
+    return false;
+  }
+  ONNXTensorElementDataType ele_type = GetTensorElementType(tensor_proto);
+  if (ele_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING || ele_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED) {
+    return false;
+  }
+  // raw_data is little-endian on the wire; a big-endian host has to go through the copying path
+  if (!IsLittleEndianOrder()) {
+    return false;
+  }
+  return tensor_proto.raw_data().size() == expected_bytes;
+}
+
+void TensorProtoToMLValueNoCopy(const onnx::TensorProto& tensor_proto, const OrtMemoryInfo& memory_info,
+                                Ort::Value& value) {
+  // the runtime does not write to input tensors, so aliasing the proto's payload is safe
+  void* tensor_data = const_cast<char*>(tensor_proto.raw_data().data());
+  std::vector<int64_t> tensor_shape_vec = GetTensorShapeFromTensorProto(tensor_proto);
+  value = Ort::Value::CreateTensor(&memory_info, tensor_data, tensor_proto.raw_data().size(),
+                                   tensor_shape_vec.data(), tensor_shape_vec.size(),
+                                   (ONNXTensorElementDataType)tensor_proto.data_type());
+}
+
 template void GetSizeInBytesFromTensorProto<256>(const onnx::TensorProto& tensor_proto,
                                                  size_t* out);
 template void GetSizeInBytesFromTensorProto<0>(const onnx::TensorProto& tensor_proto, size_t* out);
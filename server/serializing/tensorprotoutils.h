@@ -27,6 +27,20 @@ void GetSizeInBytesFromTensorProto(const onnx::TensorProto& tensor_proto, size_t
  */
 void TensorProtoToMLValue(const onnx::TensorProto& input, const server::MemBuffer& m, /* out */ Ort::Value& value);
 
+/**
+ * Whether the proto's raw_data can back the tensor directly instead of being copied into a
+ * preallocated buffer: a non-string tensor whose raw_data holds exactly expected_bytes, on a
+ * little-endian host (raw_data is little-endian on the wire).
+ */
+bool CanAliasRawData(const onnx::TensorProto& tensor_proto, size_t expected_bytes) noexcept;
+
+/**
+ * Creates a tensor that aliases the proto's raw_data rather than copying it. Only valid when
+ * CanAliasRawData() is true, and the proto must stay alive for as long as the value is used.
+ */
+void TensorProtoToMLValueNoCopy(const onnx::TensorProto& input, const OrtMemoryInfo& memory_info,
+                                /* out */ Ort::Value& value);
+
 template <typename T>
 void UnpackTensor(const onnx::TensorProto& tensor, const void* raw_data, size_t raw_data_len,
                   /*out*/ T* p_data, int64_t expected_size);
@@ -45,6 +45,8 @@ class ServerConfiguration {
   unsigned short http_port = 8001;
   unsigned short grpc_port = 50051;
   int num_http_threads = std::thread::hardware_concurrency();
+  int batch_max_size = 1;
+  int batch_timeout_microseconds = 5000;
   OrtLoggingLevel logging_level{};
 
   ServerConfiguration() {
@@ -57,6 +59,8 @@ class ServerConfiguration {
     desc.add_options()("http_port", po::value(&http_port)->default_value(http_port), "HTTP port to listen to requests");
     desc.add_options()("num_http_threads", po::value(&num_http_threads)->default_value(num_http_threads), "Number of http threads");
     desc.add_options()("grpc_port", po::value(&grpc_port)->default_value(grpc_port), "GRPC port to listen to requests");
+    desc.add_options()("batch_max_size", po::value(&batch_max_size)->default_value(batch_max_size), "Maximum number of concurrent requests to coalesce into a single model run. 1 disables server-side batching");
+    desc.add_options()("batch_timeout_microseconds", po::value(&batch_timeout_microseconds)->default_value(batch_timeout_microseconds), "How long the first request of a batch waits for more requests before the batch runs");
   }
 
   // Parses argc and argv and sets the values for the class
@@ -103,6 +107,12 @@ class ServerConfiguration {
     } else if (num_http_threads <= 0) {
       PrintHelp(std::cerr, "num_http_threads must be greater than 0");
       return Result::ExitFailure;
+    } else if (batch_max_size <= 0) {
+      PrintHelp(std::cerr, "batch_max_size must be greater than 0");
+      return Result::ExitFailure;
+    } else if (batch_timeout_microseconds < 0) {
+      PrintHelp(std::cerr, "batch_timeout_microseconds must not be negative");
+      return Result::ExitFailure;
     } else if (!file_exists(model_path)) {
       PrintHelp(std::cerr, "model_path must be the location of a valid file");
       return Result::ExitFailure;
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+
+#include "serializing/mem_buffer.h"
+#include "serializing/tensorprotoutils.h"
+
+#include "onnx-ml.pb.h"
+#include "predict.pb.h"
+
+#include "converter.h"
+#include "streaming_session.h"
+
+namespace onnxruntime {
+namespace server {
+
+namespace protobufutil = google::protobuf::util;
+
+StreamingSession::StreamingSession(ServerEnvironment* server_env, std::string model_name,
+                                   std::string model_version, std::string request_id)
+    : env_(server_env),
+      model_name_(std::move(model_name)),
+      model_version_(std::move(model_version)),
+      request_id_(std::move(request_id)),
+      using_raw_data_(true),
+      binding_(const_cast<Ort::Session&>(server_env->GetSession(model_name_, model_version_))) {
+  const auto& session = env_->GetSession(model_name_, model_version_);
+  auto input_count = session.GetInputCount();
+
+  Ort::AllocatorWithDefaultOptions allocator;
+  for (size_t i = 0; i < input_count; i++) {
+    auto name = session.GetInputName(i, allocator);
+    model_input_names_.push_back(name);
+    allocator.Free(name);
+  }
+}
+
+protobufutil::Status StreamingSession::Predict(const onnxruntime::server::PredictRequest& request,
+                                               /* out */ onnxruntime::server::PredictResponse& response) {
+  auto logger = env_->GetLogger(request_id_);
+
+  OrtMemoryInfo* memory_info = nullptr;
+  auto ort_status = Ort::GetApi().CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info);
+  if (ort_status != nullptr || memory_info == nullptr) {
+    logger->error("OrtCreateCpuMemoryInfo failed");
+    return protobufutil::Status(protobufutil::error::Code::RESOURCE_EXHAUSTED, "OrtCreateCpuMemoryInfo() failed");
+  }
+
+  // Merge the incremental inputs into the connection state. The latest tensor per name wins,
+  // including over an output carried from the previous step.
+  for (const auto& input : request.inputs()) {
+    using_raw_data_ = using_raw_data_ && input.second.has_raw_data();
+
+    ClientInput incoming;
+    incoming.buffer = std::make_unique<MemBufferArray>();
+
+    size_t cpu_tensor_length = 0;
+    try {
+      onnxruntime::server::GetSizeInBytesFromTensorProto<0>(input.second, &cpu_tensor_length);
+      auto* buf = incoming.buffer->AllocNewBuffer(cpu_tensor_length);
+      onnxruntime::server::TensorProtoToMLValue(input.second,
+                                                onnxruntime::server::MemBuffer(buf, cpu_tensor_length, *memory_info),
+                                                incoming.value);
+    } catch (const Ort::Exception& e) {
+      Ort::GetApi().ReleaseMemoryInfo(memory_info);
+      logger->error("Deserializing streamed input failed. Input name: {}. Error Message: {}", input.first, e.what());
+      return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+    }
+
+    client_inputs_[input.first] = std::move(incoming);
+    carried_inputs_.erase(input.first);
+  }
+
+  Ort::GetApi().ReleaseMemoryInfo(memory_info);
+
+  try {
+    binding_.ClearBoundInputs();
+    for (auto& entry : client_inputs_) {
+      binding_.BindInput(entry.first.c_str(), entry.second.value);
+    }
+    for (auto& entry : carried_inputs_) {
+      binding_.BindInput(entry.first.c_str(), entry.second);
+    }
+
+    // all outputs are produced server-side; the output filter only limits what is sent back
+    binding_.ClearBoundOutputs();
+    auto output_location = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+    for (const auto& name : env_->GetModelOutputNames(model_name_, model_version_)) {
+      binding_.BindOutput(name.c_str(), output_location);
+    }
+
+    Ort::RunOptions run_options{};
+    run_options.SetRunLogVerbosityLevel(static_cast<int>(env_->GetLogSeverity()));
+    run_options.SetRunTag(request_id_.c_str());
+
+    const_cast<Ort::Session&>(env_->GetSession(model_name_, model_version_)).Run(run_options, binding_);
+
+    auto output_names = binding_.GetOutputNames();
+    auto output_values = binding_.GetOutputValues();
+    for (size_t i = 0, sz = output_names.size(); i < sz; ++i) {
+      const auto& name = output_names[i];
+      const auto& filter = request.output_filter();
+      if (filter.empty() || std::find(filter.begin(), filter.end(), name) != filter.end()) {
+        onnx::TensorProto output_tensor{};
+        MLValueToTensorProto(output_values[i], using_raw_data_, logger, output_tensor);
+        (*response.mutable_outputs())[name] = output_tensor;
+      }
+
+      // an output named like a model input becomes that input for the next step
+      if (std::find(model_input_names_.begin(), model_input_names_.end(), name) != model_input_names_.end()) {
+        auto it = carried_inputs_.find(name);
+        if (it != carried_inputs_.end()) {
+          it->second = std::move(output_values[i]);
+        } else {
+          carried_inputs_.emplace(name, std::move(output_values[i]));
+        }
+        client_inputs_.erase(name);
+      }
+    }
+  } catch (const Ort::Exception& e) {
+    logger->error("Streamed prediction step failed. Error Message: {}", e.what());
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
+  return protobufutil::Status::OK;
+}
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/status.h>
+
+#include "environment.h"
+#include "predict.pb.h"
+#include "util.h"
+#include "onnxruntime_cxx_api.h"
+
+namespace onnxruntime {
+namespace server {
+
+// Per-connection prediction state for the streaming RPC. Holds an IO binding against the model's
+// session: after every run, each output whose name matches a model input stays bound server-side
+// and is fed to the next step, so a step-wise client (e.g. a token-by-token decoder whose
+// exported graph names the present key/values like the past ones) only sends the inputs that
+// changed instead of re-uploading the carried tensors on every step. Inputs the client does send
+// persist across steps until overwritten, and always take precedence over a carried output of
+// the same name.
+//
+// Not thread safe; a StreamingSession serves the messages of one stream in order.
+class StreamingSession {
+ public:
+  StreamingSession(ServerEnvironment* server_env, std::string model_name, std::string model_version,
+                   std::string request_id);
+
+  // Runs one step: merges the request's inputs into the connection state, runs the model and
+  // fills the response with the outputs selected by the request's output filter.
+  google::protobuf::util::Status Predict(const onnxruntime::server::PredictRequest& request,
+                                         /* out */ onnxruntime::server::PredictResponse& response);
+
+ private:
+  // a client supplied input and the buffer backing it, kept alive until the input is replaced
+  struct ClientInput {
+    std::unique_ptr<MemBufferArray> buffer;
+    Ort::Value value{nullptr};
+  };
+
+  ServerEnvironment* env_;
+  const std::string model_name_;
+  const std::string model_version_;
+  const std::string request_id_;
+  bool using_raw_data_;
+
+  Ort::IoBinding binding_;
+  std::map<std::string, ClientInput> client_inputs_;  // latest tensor sent per input name
+  std::map<std::string, Ort::Value> carried_inputs_;  // previous outputs fed as next inputs
+  std::vector<std::string> model_input_names_;
+};
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "batcher.h"
+#include "executor.h"
+#include "test_server_environment.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+class BatcherTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const static auto model_file = "testdata/mul_1.onnx";
+
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->InitializeModel(model_file, "Name", "version");
+  }
+
+  void TearDown() override {
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->UnloadModel("Name", "version");
+  }
+
+  // mul_1 computes Y = X * X for a [3, 2] float input. raw_data is used so the request can
+  // join a batch.
+  static onnxruntime::server::PredictRequest MakeRequest(const std::vector<float>& data) {
+    onnxruntime::server::PredictRequest request{};
+    onnx::TensorProto& tensor = (*request.mutable_inputs())["X"];
+    tensor.set_data_type(1 /* FLOAT */);
+    tensor.add_dims(3);
+    tensor.add_dims(2);
+    tensor.set_raw_data(data.data(), data.size() * sizeof(float));
+    request.add_output_filter("Y");
+    return request;
+  }
+
+  static std::vector<float> GetOutput(const onnxruntime::server::PredictResponse& response) {
+    const auto& tensor = response.outputs().at("Y");
+    std::vector<float> values(tensor.raw_data().size() / sizeof(float));
+    std::memcpy(values.data(), tensor.raw_data().data(), tensor.raw_data().size());
+    return values;
+  }
+};
+
+TEST_F(BatcherTest, SingleRequestRunsAfterTimeout) {
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+  env->EnableBatching("Name", "version", 4, std::chrono::microseconds{1000});
+
+  const std::vector<float> data{1, 2, 3, 4, 5, 6};
+  auto request = MakeRequest(data);
+  onnxruntime::server::PredictResponse response{};
+
+  onnxruntime::server::Executor executor(env, "RequestId");
+  auto status = executor.Predict("Name", "version", request, response);
+  EXPECT_TRUE(status.ok());
+
+  auto values = GetOutput(response);
+  ASSERT_EQ(values.size(), data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    EXPECT_FLOAT_EQ(values[i], data[i] * data[i]);
+  }
+}
+
+TEST_F(BatcherTest, ConcurrentRequestsAllAnswered) {
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+  env->EnableBatching("Name", "version", 2, std::chrono::microseconds{100000});
+
+  const std::vector<std::vector<float>> data{{1, 2, 3, 4, 5, 6}, {7, 8, 9, 10, 11, 12}};
+  std::vector<onnxruntime::server::PredictResponse> responses(data.size());
+  std::vector<google::protobuf::util::Status> statuses(data.size());
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < data.size(); ++i) {
+    threads.emplace_back([env, &data, &responses, &statuses, i]() {
+      auto request = MakeRequest(data[i]);
+      onnxruntime::server::Executor executor(env, "RequestId" + std::to_string(i));
+      statuses[i] = executor.Predict("Name", "version", request, responses[i]);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < data.size(); ++i) {
+    EXPECT_TRUE(statuses[i].ok());
+    auto values = GetOutput(responses[i]);
+    ASSERT_EQ(values.size(), data[i].size());
+    for (size_t j = 0; j < data[i].size(); ++j) {
+      EXPECT_FLOAT_EQ(values[j], data[i][j] * data[i][j]);
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -1,7 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -52,6 +54,35 @@ TEST_F(ExecutorTest, TestMul_1) {
   EXPECT_EQ(expected, body);
 }
 
+// raw_data inputs of the right length are aliased rather than copied; the prediction result
+// must be the same as with the copying path
+TEST_F(ExecutorTest, TestMul_1_RawData) {
+  const std::vector<float> data{1, 2, 3, 4, 5, 6};
+
+  onnxruntime::server::PredictRequest request{};
+  onnx::TensorProto& tensor = (*request.mutable_inputs())["X"];
+  tensor.set_data_type(1 /* FLOAT */);
+  tensor.add_dims(3);
+  tensor.add_dims(2);
+  tensor.set_raw_data(data.data(), data.size() * sizeof(float));
+  request.add_output_filter("Y");
+
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+  onnxruntime::server::Executor executor(env, "RequestId");
+  onnxruntime::server::PredictResponse response{};
+
+  auto prediction_res = executor.Predict("Name", "version", request, response);
+  EXPECT_TRUE(prediction_res.ok());
+
+  const auto& output = response.outputs().at("Y");
+  ASSERT_EQ(output.raw_data().size(), data.size() * sizeof(float));
+  std::vector<float> values(data.size());
+  std::memcpy(values.data(), output.raw_data().data(), output.raw_data().size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    EXPECT_FLOAT_EQ(values[i], data[i] * data[i]);
+  }
+}
+
 }  // namespace test
 }  // namespace server
 }  // namespace onnxruntime
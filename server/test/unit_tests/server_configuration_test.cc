@@ -61,6 +61,42 @@ TEST(ConfigParsingTests, Help) {
   EXPECT_EQ(res, Result::ExitSuccess);
 }
 
+TEST(ConfigParsingTests, BatchingArgs) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--batch_max_size"), const_cast<char*>("8"),
+      const_cast<char*>("--batch_timeout_microseconds"), const_cast<char*>("2000")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(7, test_argv);
+  EXPECT_EQ(res, Result::ContinueSuccess);
+  EXPECT_EQ(config.batch_max_size, 8);
+  EXPECT_EQ(config.batch_timeout_microseconds, 2000);
+}
+
+TEST(ConfigParsingTests, BatchingDisabledByDefault) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(3, test_argv);
+  EXPECT_EQ(res, Result::ContinueSuccess);
+  EXPECT_EQ(config.batch_max_size, 1);
+}
+
+TEST(ConfigParsingTests, InvalidBatchMaxSize) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--batch_max_size"), const_cast<char*>("0")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(5, test_argv);
+  EXPECT_EQ(res, Result::ExitFailure);
+}
+
 TEST(ConfigParsingTests, NoModelArg) {
   char* test_argv[] = {
       const_cast<char*>("/path/to/binary"),
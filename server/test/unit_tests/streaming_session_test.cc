@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "streaming_session.h"
+#include "test_server_environment.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+class StreamingSessionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const static auto model_file = "testdata/mul_1.onnx";
+
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->InitializeModel(model_file, "Name", "version");
+  }
+
+  void TearDown() override {
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->UnloadModel("Name", "version");
+  }
+
+  static onnxruntime::server::PredictRequest MakeRequest(const std::vector<float>& data) {
+    onnxruntime::server::PredictRequest request{};
+    onnx::TensorProto& tensor = (*request.mutable_inputs())["X"];
+    tensor.set_data_type(1 /* FLOAT */);
+    tensor.add_dims(3);
+    tensor.add_dims(2);
+    tensor.set_raw_data(data.data(), data.size() * sizeof(float));
+    request.add_output_filter("Y");
+    return request;
+  }
+
+  static std::vector<float> GetOutput(const onnxruntime::server::PredictResponse& response) {
+    const auto& tensor = response.outputs().at("Y");
+    std::vector<float> values(tensor.raw_data().size() / sizeof(float));
+    std::memcpy(values.data(), tensor.raw_data().data(), tensor.raw_data().size());
+    return values;
+  }
+};
+
+TEST_F(StreamingSessionTest, InputsPersistAcrossSteps) {
+  onnxruntime::server::StreamingSession streaming(ServerEnv(), "Name", "version", "RequestId");
+
+  const std::vector<float> data{1, 2, 3, 4, 5, 6};
+  onnxruntime::server::PredictResponse first_response{};
+  auto status = streaming.Predict(MakeRequest(data), first_response);
+  EXPECT_TRUE(status.ok());
+
+  // the second step sends no inputs and reruns with the tensor kept from the first step
+  onnxruntime::server::PredictRequest empty_request{};
+  empty_request.add_output_filter("Y");
+  onnxruntime::server::PredictResponse second_response{};
+  status = streaming.Predict(empty_request, second_response);
+  EXPECT_TRUE(status.ok());
+
+  for (const auto* response : {&first_response, &second_response}) {
+    auto values = GetOutput(*response);
+    ASSERT_EQ(values.size(), data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+      EXPECT_FLOAT_EQ(values[i], data[i] * data[i]);
+    }
+  }
+}
+
+TEST_F(StreamingSessionTest, NewInputReplacesOldOne) {
+  onnxruntime::server::StreamingSession streaming(ServerEnv(), "Name", "version", "RequestId");
+
+  onnxruntime::server::PredictResponse first_response{};
+  auto status = streaming.Predict(MakeRequest({1, 2, 3, 4, 5, 6}), first_response);
+  EXPECT_TRUE(status.ok());
+
+  const std::vector<float> data{7, 8, 9, 10, 11, 12};
+  onnxruntime::server::PredictResponse second_response{};
+  status = streaming.Predict(MakeRequest(data), second_response);
+  EXPECT_TRUE(status.ok());
+
+  auto values = GetOutput(second_response);
+  ASSERT_EQ(values.size(), data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    EXPECT_FLOAT_EQ(values[i], data[i] * data[i]);
+  }
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
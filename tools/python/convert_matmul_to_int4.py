@@ -0,0 +1,116 @@
+import argparse
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+def quantize_blockwise_int4(weight, block_size):
+    """Quantize a (K, N) float weight matrix to block-wise int4.
+
+    Returns the packed uint8 data with shape (N, ceil(K / block_size) * block_size / 2),
+    two values per byte with the lower nibble first, and the float scales with shape
+    (N, ceil(K / block_size)). A stored nibble q dequantizes to (q - 8) * scale.
+    """
+    k, n = weight.shape
+    blocks_per_col = (k + block_size - 1) // block_size
+
+    # work on the transposed weight so each output column is contiguous
+    padded = np.zeros((n, blocks_per_col * block_size), dtype=np.float32)
+    padded[:, :k] = weight.transpose()
+    blocked = padded.reshape(n, blocks_per_col, block_size)
+
+    # symmetric quantization: one scale per block, values in [-8, 7]
+    amax = np.abs(blocked).max(axis=2)
+    scales = (amax / 7.0).astype(np.float32)
+    nonzero_scales = np.where(scales == 0.0, 1.0, scales)
+    quantized = np.clip(np.rint(blocked / nonzero_scales[:, :, np.newaxis]), -8, 7)
+    quantized = (quantized + 8).astype(np.uint8)
+
+    flat = quantized.reshape(n, -1)
+    packed = (flat[:, 0::2] | (flat[:, 1::2] << 4)).astype(np.uint8)
+
+    return packed, scales
+
+
+def convert_matmul_nodes(model, block_size, min_elements):
+    graph = model.graph
+    initializers = {init.name: init for init in graph.initializer}
+
+    converted = 0
+    converted_weights = []
+    for node in graph.node:
+        if node.op_type != "MatMul" or node.domain not in ("", "ai.onnx"):
+            continue
+
+        weight_proto = initializers.get(node.input[1])
+        if weight_proto is None or len(weight_proto.dims) != 2:
+            continue
+
+        weight = numpy_helper.to_array(weight_proto)
+        if weight.dtype != np.float32 or weight.size < min_elements:
+            continue
+
+        packed, scales = quantize_blockwise_int4(weight, block_size)
+        k, n = weight.shape
+
+        packed_name = node.input[1] + "_int4"
+        scales_name = node.input[1] + "_scales"
+        graph.initializer.extend([
+            numpy_helper.from_array(packed, packed_name),
+            numpy_helper.from_array(scales, scales_name),
+        ])
+        converted_weights.append(node.input[1])
+
+        node.op_type = "MatMulInt4"
+        node.domain = "com.microsoft"
+        del node.input[1:]
+        node.input.extend([packed_name, scales_name])
+        del node.attribute[:]
+        node.attribute.extend([
+            onnx.helper.make_attribute("K", k),
+            onnx.helper.make_attribute("N", n),
+            onnx.helper.make_attribute("block_size", block_size),
+        ])
+        converted += 1
+
+    # drop the original float weights that no longer have any consumers
+    remaining_uses = set()
+    for node in graph.node:
+        remaining_uses.update(node.input)
+    for name in converted_weights:
+        if name not in remaining_uses and name in initializers:
+            graph.initializer.remove(initializers[name])
+
+    if converted > 0 and all(opset.domain != "com.microsoft" for opset in model.opset_import):
+        model.opset_import.extend([onnx.helper.make_opsetid("com.microsoft", 1)])
+
+    return converted
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Convert large float MatMul initializers to block-wise int4 weights "
+                    "consumed by the com.microsoft.MatMulInt4 operator.")
+    parser.add_argument("--input", required=True, help="input onnx model path")
+    parser.add_argument("--output", required=True, help="output onnx model path")
+    parser.add_argument("--block_size", type=int, default=32,
+                        help="number of weight values sharing one scale (power of two, >= 16)")
+    parser.add_argument("--min_elements", type=int, default=1024 * 1024,
+                        help="only convert weight initializers with at least this many elements")
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    if args.block_size < 16 or (args.block_size & (args.block_size - 1)) != 0:
+        raise ValueError("block_size must be a power of two and at least 16")
+
+    model = onnx.load(args.input)
+    converted = convert_matmul_nodes(model, args.block_size, args.min_elements)
+    print("Converted {} MatMul node(s)".format(converted))
+    onnx.save(model, args.output)
+
+
+if __name__ == "__main__":
+    main()
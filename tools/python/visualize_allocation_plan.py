@@ -0,0 +1,143 @@
+import argparse
+import json
+
+
+def load_plan(path):
+    with open(path, 'r') as f:
+        return json.load(f)
+
+
+def print_summary(plan):
+    counts = {}
+    for value in plan['values']:
+        kind = value['alloc_kind']
+        counts[kind] = counts.get(kind, 0) + 1
+
+    print('Allocation kind summary:')
+    for kind in sorted(counts):
+        print('  {}: {}'.format(kind, counts[kind]))
+    print()
+
+
+def reuse_chains(plan):
+    """Group values into chains that share a buffer, keyed by the index of the value
+    that owns the allocation."""
+    values = {value['index']: value for value in plan['values']}
+    chains = {}
+    for value in plan['values']:
+        if 'reused_buffer' not in value:
+            continue
+        # walk to the value that actually owns the buffer
+        root = value
+        while 'reused_buffer' in root and root['reused_buffer'] in values:
+            root = values[root['reused_buffer']]
+        chains.setdefault(root['index'], []).append(value)
+    return values, chains
+
+
+def print_reuse_chains(plan):
+    values, chains = reuse_chains(plan)
+    if not chains:
+        print('No buffer reuse in this plan.')
+        return
+
+    def describe(value):
+        return '({}) {}'.format(value['index'], value['name'] or '<unnamed>')
+
+    print('Buffer reuse chains (owner <- reusing values):')
+    for root_index in sorted(chains):
+        members = ', '.join(describe(v) for v in chains[root_index])
+        print('  {} <- {}'.format(describe(values[root_index]), members))
+    print()
+
+
+def print_timeline(plan, width):
+    """Render value lifetimes as one row per value over the execution-plan steps."""
+    num_steps = len(plan['execution_plan'])
+    if num_steps == 0:
+        print('Execution plan is empty.')
+        return
+
+    with_lifetimes = [v for v in plan['values'] if v.get('lifetimes')]
+    if not with_lifetimes:
+        print('The plan does not record lifetime intervals.')
+        return
+
+    name_width = max(len(v['name'] or '<unnamed>') for v in with_lifetimes)
+    name_width = min(name_width, 40)
+    scale = max(1, (num_steps + width - 1) // width)
+    chart_width = (num_steps + scale - 1) // scale
+
+    print('Value lifetimes over {} execution steps ({} steps per column):'.format(num_steps, scale))
+    for value in with_lifetimes:
+        row = [' '] * chart_width
+        for start, end in value['lifetimes']:
+            for col in range(start // scale, min(end // scale + 1, chart_width)):
+                row[col] = '#'
+        name = (value['name'] or '<unnamed>')[:name_width]
+        print('  {:<{}} |{}|'.format(name, name_width, ''.join(row)))
+    print()
+
+
+def print_diff(plan, baseline):
+    """Report values whose allocation kind or reuse target changed between two plans,
+    matching values by name."""
+    def by_name(p):
+        return {v['name']: v for v in p['values'] if v['name']}
+
+    current = by_name(plan)
+    previous = by_name(baseline)
+
+    changed = []
+    for name in sorted(set(current) & set(previous)):
+        cur, prev = current[name], previous[name]
+        if cur['alloc_kind'] != prev['alloc_kind'] or cur.get('reused_buffer') != prev.get('reused_buffer'):
+            changed.append((name, prev, cur))
+
+    if not changed:
+        print('No allocation kind or reuse changes between the two plans.')
+        return
+
+    print('Changed values (baseline -> current):')
+    for name, prev, cur in changed:
+        def describe(value):
+            kind = value['alloc_kind']
+            if 'reused_buffer' in value:
+                kind += '({})'.format(value['reused_buffer'])
+            return kind
+        print('  {}: {} -> {}'.format(name, describe(prev), describe(cur)))
+    print()
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Render an allocation plan dumped by onnxruntime. Produce the input file by '
+                    'setting the session config entry "session.allocation_plan_dump_path" to a '
+                    'file path before creating the session.')
+    parser.add_argument('plan', help='Path to the allocation plan JSON file.')
+    parser.add_argument('--timeline', action='store_true',
+                        help='Render value lifetimes as an ASCII chart over the execution steps.')
+    parser.add_argument('--timeline-width', type=int, default=120,
+                        help='Maximum number of columns for the timeline chart.')
+    parser.add_argument('--diff', metavar='BASELINE',
+                        help='Path to a baseline plan JSON file. Reports values whose allocation '
+                             'kind or reuse target changed, to catch reuse regressions.')
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    plan = load_plan(args.plan)
+
+    print_summary(plan)
+    print_reuse_chains(plan)
+
+    if args.timeline:
+        print_timeline(plan, args.timeline_width)
+
+    if args.diff:
+        print_diff(plan, load_plan(args.diff))
+
+
+if __name__ == '__main__':
+    main()